@@ -0,0 +1,639 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Measures how the mock ICD's own costs scale with the number of threads calling it. Each scenario repeats one operation on
+// every thread at once, with objects of its own so the only contention is inside the ICD, and is run with 1, 2, 4... up to
+// the given number of threads.
+//
+// Usage: mock_icd_bench [--icd PATH] [--threads N] [--ops N] [SCENARIO...]
+//
+//   --icd      Path to the mock ICD library, by default the one built alongside
+//   --threads  Most threads to run each scenario on, by default the number of hardware threads
+//   --ops      Operations each thread times per run, 100000 by default
+//
+// Scenarios, all of them by default:
+//   create_destroy  vkCreateBuffer then vkDestroyBuffer
+//   samplers        vkCreateSampler then vkDestroySampler
+//   descriptors     vkAllocateDescriptorSets then vkFreeDescriptorSets
+//   pipelines       vkCreateComputePipelines of an empty shader, without a pipeline cache, then vkDestroyPipeline
+//   record_submit   Records a few commands, submits them and waits for the fence
+//   map_unmap       vkMapMemory then vkUnmapMemory
+//   proc_addr       vkGetDeviceProcAddr of a device command
+//   texture_upload  Copies a 256x256 RGBA8 staging buffer to an image, submits it and waits for the fence. Each upload is
+//                   256 KiB, so Ops/s times 256 KiB is the upload throughput.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include "vulkan/vulkan.h"
+
+#ifndef MOCK_ICD_PATH
+#define MOCK_ICD_PATH ""
+#endif
+
+// Loader interface version the benchmark negotiates, as the loader would. The mock ICD fails vkCreateInstance below 5.
+static const uint32_t kLoaderIcdInterfaceVersion = 5;
+
+// Device commands a layer or app looks up, for proc_addr
+static const char *const kDeviceCommands[] = {
+    "vkQueueSubmit", "vkAllocateMemory", "vkMapMemory", "vkCreateBuffer", "vkCreateImage", "vkCreateImageView",
+    "vkCreateGraphicsPipelines", "vkAllocateDescriptorSets", "vkUpdateDescriptorSets", "vkBeginCommandBuffer",
+    "vkCmdBindPipeline", "vkCmdBindDescriptorSets", "vkCmdDraw", "vkCmdDrawIndexed", "vkCmdPipelineBarrier", "vkEndCommandBuffer",
+};
+
+// The ICD's commands the benchmark calls
+struct Icd {
+    PFN_vkGetInstanceProcAddr GetInstanceProcAddr;
+    PFN_vkCreateInstance CreateInstance;
+    PFN_vkDestroyInstance DestroyInstance;
+    PFN_vkEnumeratePhysicalDevices EnumeratePhysicalDevices;
+    PFN_vkGetPhysicalDeviceMemoryProperties GetPhysicalDeviceMemoryProperties;
+    PFN_vkCreateDevice CreateDevice;
+    PFN_vkGetDeviceProcAddr GetDeviceProcAddr;
+    PFN_vkDestroyDevice DestroyDevice;
+    PFN_vkGetDeviceQueue GetDeviceQueue;
+    PFN_vkQueueSubmit QueueSubmit;
+    PFN_vkAllocateMemory AllocateMemory;
+    PFN_vkFreeMemory FreeMemory;
+    PFN_vkMapMemory MapMemory;
+    PFN_vkUnmapMemory UnmapMemory;
+    PFN_vkBindBufferMemory BindBufferMemory;
+    PFN_vkBindImageMemory BindImageMemory;
+    PFN_vkCreateFence CreateFence;
+    PFN_vkDestroyFence DestroyFence;
+    PFN_vkResetFences ResetFences;
+    PFN_vkWaitForFences WaitForFences;
+    PFN_vkCreateBuffer CreateBuffer;
+    PFN_vkDestroyBuffer DestroyBuffer;
+    PFN_vkCreateImage CreateImage;
+    PFN_vkDestroyImage DestroyImage;
+    PFN_vkGetImageMemoryRequirements GetImageMemoryRequirements;
+    PFN_vkCreateSampler CreateSampler;
+    PFN_vkDestroySampler DestroySampler;
+    PFN_vkCreateShaderModule CreateShaderModule;
+    PFN_vkDestroyShaderModule DestroyShaderModule;
+    PFN_vkCreatePipelineLayout CreatePipelineLayout;
+    PFN_vkDestroyPipelineLayout DestroyPipelineLayout;
+    PFN_vkCreateComputePipelines CreateComputePipelines;
+    PFN_vkDestroyPipeline DestroyPipeline;
+    PFN_vkCreateDescriptorSetLayout CreateDescriptorSetLayout;
+    PFN_vkDestroyDescriptorSetLayout DestroyDescriptorSetLayout;
+    PFN_vkCreateDescriptorPool CreateDescriptorPool;
+    PFN_vkDestroyDescriptorPool DestroyDescriptorPool;
+    PFN_vkAllocateDescriptorSets AllocateDescriptorSets;
+    PFN_vkFreeDescriptorSets FreeDescriptorSets;
+    PFN_vkCreateCommandPool CreateCommandPool;
+    PFN_vkDestroyCommandPool DestroyCommandPool;
+    PFN_vkAllocateCommandBuffers AllocateCommandBuffers;
+    PFN_vkBeginCommandBuffer BeginCommandBuffer;
+    PFN_vkEndCommandBuffer EndCommandBuffer;
+    PFN_vkCmdFillBuffer CmdFillBuffer;
+    PFN_vkCmdPipelineBarrier CmdPipelineBarrier;
+    PFN_vkCmdCopyBufferToImage CmdCopyBufferToImage;
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    uint32_t host_visible_type = 0;
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+};
+
+// An empty compute shader with a 1x1x1 workgroup, for pipelines
+static const uint32_t kComputeShader[] = {
+    0x07230203, 0x00010000, 0x00000000, 5, 0,  // Header, with an ID bound of 5
+    0x00020011, 1,  // OpCapability Shader
+    0x0003000E, 0, 1,  // OpMemoryModel Logical GLSL450
+    0x0005000F, 5, 1, 0x6E69616D, 0x00000000,  // OpEntryPoint GLCompute %1 "main"
+    0x00060010, 1, 17, 1, 1, 1,  // OpExecutionMode %1 LocalSize 1 1 1
+    0x00020013, 2,  // %2 = OpTypeVoid
+    0x00030021, 3, 2,  // %3 = OpTypeFunction %2
+    0x00050036, 2, 1, 0, 3,  // %1 = OpFunction %2 None %3
+    0x000200F8, 4,  // %4 = OpLabel
+    0x000100FD,  // OpReturn
+    0x00010038,  // OpFunctionEnd
+};
+
+typedef VkResult(VKAPI_PTR *PFN_NegotiateLoaderICDInterfaceVersion)(uint32_t *pVersion);
+
+static PFN_vkGetInstanceProcAddr LoadIcd(const char *path) {
+#if defined(_WIN32)
+    HMODULE library = LoadLibraryA(path);
+    if (!library) return nullptr;
+    auto negotiate = reinterpret_cast<PFN_NegotiateLoaderICDInterfaceVersion>(
+        GetProcAddress(library, "vk_icdNegotiateLoaderICDInterfaceVersion"));
+    auto get_instance_proc_addr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(GetProcAddress(library, "vk_icdGetInstanceProcAddr"));
+#else
+    void *library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!library) return nullptr;
+    auto negotiate =
+        reinterpret_cast<PFN_NegotiateLoaderICDInterfaceVersion>(dlsym(library, "vk_icdNegotiateLoaderICDInterfaceVersion"));
+    auto get_instance_proc_addr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(dlsym(library, "vk_icdGetInstanceProcAddr"));
+#endif
+    uint32_t version = kLoaderIcdInterfaceVersion;
+    if (!negotiate || negotiate(&version) != VK_SUCCESS) return nullptr;
+    return get_instance_proc_addr;
+}
+
+template <typename T>
+static bool LoadCommand(PFN_vkGetInstanceProcAddr get_instance_proc_addr, VkInstance instance, const char *name, T &command) {
+    command = reinterpret_cast<T>(get_instance_proc_addr(instance, name));
+    if (!command) fprintf(stderr, "The ICD doesn't have %s\n", name);
+    return command != nullptr;
+}
+
+template <typename T>
+static bool LoadCommand(PFN_vkGetDeviceProcAddr get_device_proc_addr, VkDevice device, const char *name, T &command) {
+    command = reinterpret_cast<T>(get_device_proc_addr(device, name));
+    if (!command) fprintf(stderr, "The ICD doesn't have %s\n", name);
+    return command != nullptr;
+}
+
+// Creates an instance, and a device with a queue for each thread. The mock ICD doesn't limit how many queues a family has,
+// so threads submitting don't have to share one.
+static bool CreateDevice(Icd &icd, uint32_t queue_count) {
+    PFN_vkGetInstanceProcAddr gipa = icd.GetInstanceProcAddr;
+    if (!LoadCommand(gipa, VK_NULL_HANDLE, "vkCreateInstance", icd.CreateInstance)) return false;
+    VkApplicationInfo app_info = {VK_STRUCTURE_TYPE_APPLICATION_INFO};
+    app_info.pApplicationName = "mock_icd_bench";
+    app_info.apiVersion = VK_API_VERSION_1_1;
+    VkInstanceCreateInfo instance_info = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    instance_info.pApplicationInfo = &app_info;
+    if (icd.CreateInstance(&instance_info, nullptr, &icd.instance) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateInstance failed\n");
+        return false;
+    }
+
+    VkInstance instance = icd.instance;
+    if (!LoadCommand(gipa, instance, "vkDestroyInstance", icd.DestroyInstance) ||
+        !LoadCommand(gipa, instance, "vkEnumeratePhysicalDevices", icd.EnumeratePhysicalDevices) ||
+        !LoadCommand(gipa, instance, "vkGetPhysicalDeviceMemoryProperties", icd.GetPhysicalDeviceMemoryProperties) ||
+        !LoadCommand(gipa, instance, "vkCreateDevice", icd.CreateDevice) ||
+        !LoadCommand(gipa, instance, "vkGetDeviceProcAddr", icd.GetDeviceProcAddr)) {
+        return false;
+    }
+    uint32_t physical_device_count = 1;
+    VkPhysicalDevice physical_device = VK_NULL_HANDLE;
+    const VkResult result = icd.EnumeratePhysicalDevices(instance, &physical_device_count, &physical_device);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || !physical_device) {
+        fprintf(stderr, "The ICD has no physical devices\n");
+        return false;
+    }
+    VkPhysicalDeviceMemoryProperties memory_properties = {};
+    icd.GetPhysicalDeviceMemoryProperties(physical_device, &memory_properties);
+    for (uint32_t i = memory_properties.memoryTypeCount; i-- > 0;) {
+        if (memory_properties.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) icd.host_visible_type = i;
+    }
+
+    std::vector<float> priorities(queue_count, 1.0f);
+    VkDeviceQueueCreateInfo queue_info = {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+    queue_info.queueFamilyIndex = 0;
+    queue_info.queueCount = queue_count;
+    queue_info.pQueuePriorities = priorities.data();
+    VkDeviceCreateInfo device_info = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    if (icd.CreateDevice(physical_device, &device_info, nullptr, &icd.device) != VK_SUCCESS) {
+        fprintf(stderr, "vkCreateDevice failed\n");
+        return false;
+    }
+
+    PFN_vkGetDeviceProcAddr gdpa = icd.GetDeviceProcAddr;
+    VkDevice device = icd.device;
+    if (!LoadCommand(gdpa, device, "vkDestroyDevice", icd.DestroyDevice) ||
+        !LoadCommand(gdpa, device, "vkGetDeviceQueue", icd.GetDeviceQueue) ||
+        !LoadCommand(gdpa, device, "vkQueueSubmit", icd.QueueSubmit) ||
+        !LoadCommand(gdpa, device, "vkAllocateMemory", icd.AllocateMemory) ||
+        !LoadCommand(gdpa, device, "vkFreeMemory", icd.FreeMemory) || !LoadCommand(gdpa, device, "vkMapMemory", icd.MapMemory) ||
+        !LoadCommand(gdpa, device, "vkUnmapMemory", icd.UnmapMemory) ||
+        !LoadCommand(gdpa, device, "vkBindBufferMemory", icd.BindBufferMemory) ||
+        !LoadCommand(gdpa, device, "vkBindImageMemory", icd.BindImageMemory) ||
+        !LoadCommand(gdpa, device, "vkCreateFence", icd.CreateFence) ||
+        !LoadCommand(gdpa, device, "vkDestroyFence", icd.DestroyFence) ||
+        !LoadCommand(gdpa, device, "vkResetFences", icd.ResetFences) ||
+        !LoadCommand(gdpa, device, "vkWaitForFences", icd.WaitForFences) ||
+        !LoadCommand(gdpa, device, "vkCreateBuffer", icd.CreateBuffer) ||
+        !LoadCommand(gdpa, device, "vkDestroyBuffer", icd.DestroyBuffer) ||
+        !LoadCommand(gdpa, device, "vkCreateImage", icd.CreateImage) ||
+        !LoadCommand(gdpa, device, "vkDestroyImage", icd.DestroyImage) ||
+        !LoadCommand(gdpa, device, "vkGetImageMemoryRequirements", icd.GetImageMemoryRequirements) ||
+        !LoadCommand(gdpa, device, "vkCreateSampler", icd.CreateSampler) ||
+        !LoadCommand(gdpa, device, "vkDestroySampler", icd.DestroySampler) ||
+        !LoadCommand(gdpa, device, "vkCreateShaderModule", icd.CreateShaderModule) ||
+        !LoadCommand(gdpa, device, "vkDestroyShaderModule", icd.DestroyShaderModule) ||
+        !LoadCommand(gdpa, device, "vkCreatePipelineLayout", icd.CreatePipelineLayout) ||
+        !LoadCommand(gdpa, device, "vkDestroyPipelineLayout", icd.DestroyPipelineLayout) ||
+        !LoadCommand(gdpa, device, "vkCreateComputePipelines", icd.CreateComputePipelines) ||
+        !LoadCommand(gdpa, device, "vkDestroyPipeline", icd.DestroyPipeline) ||
+        !LoadCommand(gdpa, device, "vkCreateDescriptorSetLayout", icd.CreateDescriptorSetLayout) ||
+        !LoadCommand(gdpa, device, "vkDestroyDescriptorSetLayout", icd.DestroyDescriptorSetLayout) ||
+        !LoadCommand(gdpa, device, "vkCreateDescriptorPool", icd.CreateDescriptorPool) ||
+        !LoadCommand(gdpa, device, "vkDestroyDescriptorPool", icd.DestroyDescriptorPool) ||
+        !LoadCommand(gdpa, device, "vkAllocateDescriptorSets", icd.AllocateDescriptorSets) ||
+        !LoadCommand(gdpa, device, "vkFreeDescriptorSets", icd.FreeDescriptorSets) ||
+        !LoadCommand(gdpa, device, "vkCreateCommandPool", icd.CreateCommandPool) ||
+        !LoadCommand(gdpa, device, "vkDestroyCommandPool", icd.DestroyCommandPool) ||
+        !LoadCommand(gdpa, device, "vkAllocateCommandBuffers", icd.AllocateCommandBuffers) ||
+        !LoadCommand(gdpa, device, "vkBeginCommandBuffer", icd.BeginCommandBuffer) ||
+        !LoadCommand(gdpa, device, "vkEndCommandBuffer", icd.EndCommandBuffer) ||
+        !LoadCommand(gdpa, device, "vkCmdFillBuffer", icd.CmdFillBuffer) ||
+        !LoadCommand(gdpa, device, "vkCmdPipelineBarrier", icd.CmdPipelineBarrier) ||
+        !LoadCommand(gdpa, device, "vkCmdCopyBufferToImage", icd.CmdCopyBufferToImage)) {
+        return false;
+    }
+
+    VkDescriptorSetLayoutBinding binding = {};
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    binding.descriptorCount = 1;
+    binding.stageFlags = VK_SHADER_STAGE_ALL;
+    VkDescriptorSetLayoutCreateInfo layout_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    layout_info.bindingCount = 1;
+    layout_info.pBindings = &binding;
+    VkShaderModuleCreateInfo shader_info = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+    shader_info.codeSize = sizeof(kComputeShader);
+    shader_info.pCode = kComputeShader;
+    VkPipelineLayoutCreateInfo pipeline_layout_info = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+    return icd.CreateDescriptorSetLayout(device, &layout_info, nullptr, &icd.set_layout) == VK_SUCCESS &&
+           icd.CreateShaderModule(device, &shader_info, nullptr, &icd.shader_module) == VK_SUCCESS &&
+           icd.CreatePipelineLayout(device, &pipeline_layout_info, nullptr, &icd.pipeline_layout) == VK_SUCCESS;
+}
+
+static void DestroyDevice(Icd &icd) {
+    icd.DestroyPipelineLayout(icd.device, icd.pipeline_layout, nullptr);
+    icd.DestroyShaderModule(icd.device, icd.shader_module, nullptr);
+    icd.DestroyDescriptorSetLayout(icd.device, icd.set_layout, nullptr);
+    icd.DestroyDevice(icd.device, nullptr);
+    icd.DestroyInstance(icd.instance, nullptr);
+}
+
+static const VkDeviceSize kBufferSize = 256;
+static const uint32_t kTextureSize = 256;  // Width and height of texture_upload's RGBA8 image
+
+// What each thread works with, created before it's timed
+struct Worker {
+    VkQueue queue = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkFence fence = VK_NULL_HANDLE;
+    VkCommandPool command_pool = VK_NULL_HANDLE;
+    VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    VkDeviceMemory staging_memory = VK_NULL_HANDLE;
+    VkBuffer staging_buffer = VK_NULL_HANDLE;
+    VkDeviceMemory image_memory = VK_NULL_HANDLE;
+    VkImage image = VK_NULL_HANDLE;
+    std::vector<uint64_t> latencies;  // Of each operation, in nanoseconds
+};
+
+static bool CreateWorker(const Icd &icd, uint32_t index, Worker &worker) {
+    VkDevice device = icd.device;
+    icd.GetDeviceQueue(device, 0, index, &worker.queue);
+
+    VkMemoryAllocateInfo memory_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    memory_info.allocationSize = kBufferSize;
+    memory_info.memoryTypeIndex = icd.host_visible_type;
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = kBufferSize;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+    VkCommandPoolCreateInfo command_pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+    command_pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    if (icd.AllocateMemory(device, &memory_info, nullptr, &worker.memory) != VK_SUCCESS ||
+        icd.CreateBuffer(device, &buffer_info, nullptr, &worker.buffer) != VK_SUCCESS ||
+        icd.BindBufferMemory(device, worker.buffer, worker.memory, 0) != VK_SUCCESS ||
+        icd.CreateFence(device, &fence_info, nullptr, &worker.fence) != VK_SUCCESS ||
+        icd.CreateCommandPool(device, &command_pool_info, nullptr, &worker.command_pool) != VK_SUCCESS) {
+        return false;
+    }
+    VkCommandBufferAllocateInfo command_buffer_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+    command_buffer_info.commandPool = worker.command_pool;
+    command_buffer_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    command_buffer_info.commandBufferCount = 1;
+    if (icd.AllocateCommandBuffers(device, &command_buffer_info, &worker.command_buffer) != VK_SUCCESS) return false;
+
+    VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1};
+    VkDescriptorPoolCreateInfo descriptor_pool_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+    descriptor_pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    descriptor_pool_info.maxSets = 1;
+    descriptor_pool_info.poolSizeCount = 1;
+    descriptor_pool_info.pPoolSizes = &pool_size;
+    if (icd.CreateDescriptorPool(device, &descriptor_pool_info, nullptr, &worker.descriptor_pool) != VK_SUCCESS) return false;
+
+    // A staging buffer filled with a texture, as vkcube uploads its own, and the image it's copied to
+    const VkDeviceSize texture_bytes = VkDeviceSize(kTextureSize) * kTextureSize * 4;
+    memory_info.allocationSize = texture_bytes;
+    buffer_info.size = texture_bytes;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    void *texels = nullptr;
+    if (icd.AllocateMemory(device, &memory_info, nullptr, &worker.staging_memory) != VK_SUCCESS ||
+        icd.CreateBuffer(device, &buffer_info, nullptr, &worker.staging_buffer) != VK_SUCCESS ||
+        icd.BindBufferMemory(device, worker.staging_buffer, worker.staging_memory, 0) != VK_SUCCESS ||
+        icd.MapMemory(device, worker.staging_memory, 0, VK_WHOLE_SIZE, 0, &texels) != VK_SUCCESS) {
+        return false;
+    }
+    for (VkDeviceSize i = 0; i < texture_bytes; ++i) static_cast<uint8_t *>(texels)[i] = static_cast<uint8_t>(i * 7 + index);
+    icd.UnmapMemory(device, worker.staging_memory);
+    VkImageCreateInfo image_info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_info.extent = {kTextureSize, kTextureSize, 1};
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    if (icd.CreateImage(device, &image_info, nullptr, &worker.image) != VK_SUCCESS) return false;
+    VkMemoryRequirements requirements;
+    icd.GetImageMemoryRequirements(device, worker.image, &requirements);
+    if (!requirements.memoryTypeBits) return false;
+    memory_info.allocationSize = requirements.size;
+    memory_info.memoryTypeIndex = 0;
+    while (!(requirements.memoryTypeBits & (1u << memory_info.memoryTypeIndex))) ++memory_info.memoryTypeIndex;
+    return icd.AllocateMemory(device, &memory_info, nullptr, &worker.image_memory) == VK_SUCCESS &&
+           icd.BindImageMemory(device, worker.image, worker.image_memory, 0) == VK_SUCCESS;
+}
+
+static void DestroyWorker(const Icd &icd, Worker &worker) {
+    VkDevice device = icd.device;
+    if (worker.image) icd.DestroyImage(device, worker.image, nullptr);
+    if (worker.image_memory) icd.FreeMemory(device, worker.image_memory, nullptr);
+    if (worker.staging_buffer) icd.DestroyBuffer(device, worker.staging_buffer, nullptr);
+    if (worker.staging_memory) icd.FreeMemory(device, worker.staging_memory, nullptr);
+    if (worker.descriptor_pool) icd.DestroyDescriptorPool(device, worker.descriptor_pool, nullptr);
+    if (worker.command_pool) icd.DestroyCommandPool(device, worker.command_pool, nullptr);
+    if (worker.fence) icd.DestroyFence(device, worker.fence, nullptr);
+    if (worker.buffer) icd.DestroyBuffer(device, worker.buffer, nullptr);
+    if (worker.memory) icd.FreeMemory(device, worker.memory, nullptr);
+}
+
+static bool CreateDestroy(const Icd &icd, Worker &worker, uint64_t op) {
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = kBufferSize;
+    buffer_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    VkBuffer buffer;
+    if (icd.CreateBuffer(icd.device, &buffer_info, nullptr, &buffer) != VK_SUCCESS) return false;
+    icd.DestroyBuffer(icd.device, buffer, nullptr);
+    return true;
+}
+
+static bool Samplers(const Icd &icd, Worker &worker, uint64_t op) {
+    VkSamplerCreateInfo sampler_info = {VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO};
+    sampler_info.magFilter = VK_FILTER_LINEAR;
+    sampler_info.minFilter = VK_FILTER_LINEAR;
+    sampler_info.maxLod = 1.0f;
+    VkSampler sampler;
+    if (icd.CreateSampler(icd.device, &sampler_info, nullptr, &sampler) != VK_SUCCESS) return false;
+    icd.DestroySampler(icd.device, sampler, nullptr);
+    return true;
+}
+
+static bool Descriptors(const Icd &icd, Worker &worker, uint64_t op) {
+    VkDescriptorSetAllocateInfo set_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+    set_info.descriptorPool = worker.descriptor_pool;
+    set_info.descriptorSetCount = 1;
+    set_info.pSetLayouts = &icd.set_layout;
+    VkDescriptorSet set;
+    if (icd.AllocateDescriptorSets(icd.device, &set_info, &set) != VK_SUCCESS) return false;
+    return icd.FreeDescriptorSets(icd.device, worker.descriptor_pool, 1, &set) == VK_SUCCESS;
+}
+
+static bool Pipelines(const Icd &icd, Worker &worker, uint64_t op) {
+    VkComputePipelineCreateInfo pipeline_info = {VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+    pipeline_info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipeline_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_info.stage.module = icd.shader_module;
+    pipeline_info.stage.pName = "main";
+    pipeline_info.layout = icd.pipeline_layout;
+    VkPipeline pipeline;
+    if (icd.CreateComputePipelines(icd.device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipeline) != VK_SUCCESS) return false;
+    icd.DestroyPipeline(icd.device, pipeline, nullptr);
+    return true;
+}
+
+static bool RecordSubmit(const Icd &icd, Worker &worker, uint64_t op) {
+    VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (icd.BeginCommandBuffer(worker.command_buffer, &begin_info) != VK_SUCCESS) return false;
+    VkMemoryBarrier barrier = {VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    icd.CmdFillBuffer(worker.command_buffer, worker.buffer, 0, kBufferSize, static_cast<uint32_t>(op));
+    icd.CmdPipelineBarrier(worker.command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                           nullptr, 0, nullptr);
+    icd.CmdFillBuffer(worker.command_buffer, worker.buffer, 0, kBufferSize / 2, ~static_cast<uint32_t>(op));
+    if (icd.EndCommandBuffer(worker.command_buffer) != VK_SUCCESS) return false;
+
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &worker.command_buffer;
+    return icd.QueueSubmit(worker.queue, 1, &submit_info, worker.fence) == VK_SUCCESS &&
+           icd.WaitForFences(icd.device, 1, &worker.fence, VK_TRUE, UINT64_MAX) == VK_SUCCESS &&
+           icd.ResetFences(icd.device, 1, &worker.fence) == VK_SUCCESS;
+}
+
+static bool TextureUpload(const Icd &icd, Worker &worker, uint64_t op) {
+    VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (icd.BeginCommandBuffer(worker.command_buffer, &begin_info) != VK_SUCCESS) return false;
+    VkImageMemoryBarrier barrier = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = worker.image;
+    barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    icd.CmdPipelineBarrier(worker.command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                           nullptr, 1, &barrier);
+    VkBufferImageCopy region = {};
+    region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.imageExtent = {kTextureSize, kTextureSize, 1};
+    icd.CmdCopyBufferToImage(worker.command_buffer, worker.staging_buffer, worker.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+                             &region);
+    if (icd.EndCommandBuffer(worker.command_buffer) != VK_SUCCESS) return false;
+
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &worker.command_buffer;
+    return icd.QueueSubmit(worker.queue, 1, &submit_info, worker.fence) == VK_SUCCESS &&
+           icd.WaitForFences(icd.device, 1, &worker.fence, VK_TRUE, UINT64_MAX) == VK_SUCCESS &&
+           icd.ResetFences(icd.device, 1, &worker.fence) == VK_SUCCESS;
+}
+
+static bool MapUnmap(const Icd &icd, Worker &worker, uint64_t op) {
+    void *data;
+    if (icd.MapMemory(icd.device, worker.memory, 0, VK_WHOLE_SIZE, 0, &data) != VK_SUCCESS) return false;
+    icd.UnmapMemory(icd.device, worker.memory);
+    return true;
+}
+
+static bool ProcAddr(const Icd &icd, Worker &worker, uint64_t op) {
+    return icd.GetDeviceProcAddr(icd.device, kDeviceCommands[op % (sizeof(kDeviceCommands) / sizeof(kDeviceCommands[0]))]);
+}
+
+struct Scenario {
+    const char *name;
+    bool (*op)(const Icd &icd, Worker &worker, uint64_t op);
+};
+
+static const Scenario kScenarios[] = {
+    {"create_destroy", CreateDestroy}, {"samplers", Samplers}, {"descriptors", Descriptors}, {"pipelines", Pipelines},
+    {"record_submit", RecordSubmit}, {"map_unmap", MapUnmap}, {"proc_addr", ProcAddr}, {"texture_upload", TextureUpload},
+};
+
+// Runs the scenario on a thread for each worker, all starting at once. Returns false if an operation failed.
+static bool RunScenario(const Icd &icd, const Scenario &scenario, Worker *workers, uint32_t thread_count, uint64_t ops,
+                        double *seconds) {
+    std::atomic<uint32_t> ready(0);
+    std::atomic<bool> go(false);
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        Worker &worker = workers[i];
+        worker.latencies.assign(ops, 0);
+        threads.emplace_back([&icd, &scenario, &worker, &ready, &go, &failed, ops]() {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            for (uint64_t op = 0; op < ops; ++op) {
+                const auto start = std::chrono::steady_clock::now();
+                const bool succeeded = scenario.op(icd, worker, op);
+                const auto end = std::chrono::steady_clock::now();
+                if (!succeeded) {
+                    failed = true;
+                    return;
+                }
+                worker.latencies[op] = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            }
+        });
+    }
+    while (ready.load() < thread_count) std::this_thread::yield();
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread &thread : threads) thread.join();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    *seconds = elapsed.count();
+    return !failed;
+}
+
+static uint64_t Percentile(const std::vector<uint64_t> &sorted, double fraction) {
+    const size_t rank = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+    return sorted[rank];
+}
+
+static void Usage(const char *program) {
+    fprintf(stderr, "Usage: %s [--icd PATH] [--threads N] [--ops N] [SCENARIO...]\nScenarios:", program);
+    for (const Scenario &scenario : kScenarios) fprintf(stderr, " %s", scenario.name);
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv) {
+    const char *path = MOCK_ICD_PATH;
+    uint32_t max_threads = (std::max)(1u, std::thread::hardware_concurrency());
+    uint64_t ops = 100000;
+    std::vector<const Scenario *> scenarios;
+    for (int i = 1; i < argc; ++i) {
+        char *end = nullptr;
+        if (strcmp(argv[i], "--icd") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            max_threads = static_cast<uint32_t>(strtoul(argv[++i], &end, 10));
+            if (*end || max_threads == 0) {
+                Usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--ops") == 0 && i + 1 < argc) {
+            ops = strtoull(argv[++i], &end, 10);
+            if (*end || ops == 0) {
+                Usage(argv[0]);
+                return 1;
+            }
+        } else {
+            const Scenario *found = nullptr;
+            for (const Scenario &scenario : kScenarios) {
+                if (strcmp(argv[i], scenario.name) == 0) found = &scenario;
+            }
+            if (!found) {
+                Usage(argv[0]);
+                return 1;
+            }
+            scenarios.push_back(found);
+        }
+    }
+    if (!*path) {
+        Usage(argv[0]);
+        return 1;
+    }
+    if (scenarios.empty()) {
+        for (const Scenario &scenario : kScenarios) scenarios.push_back(&scenario);
+    }
+
+    Icd icd = {};
+    icd.GetInstanceProcAddr = LoadIcd(path);
+    if (!icd.GetInstanceProcAddr) {
+        fprintf(stderr, "Can't load the ICD interface from %s\n", path);
+        return 1;
+    }
+    if (!CreateDevice(icd, max_threads)) return 1;
+    std::vector<Worker> workers(max_threads);
+    for (uint32_t i = 0; i < max_threads; ++i) {
+        if (!CreateWorker(icd, i, workers[i])) {
+            fprintf(stderr, "Can't create the objects for thread %u\n", i);
+            return 1;
+        }
+    }
+
+    printf("%-16s %8s %14s %10s %10s\n", "Scenario", "Threads", "Ops/s", "p50 ns", "p99 ns");
+    int status = 0;
+    for (const Scenario *scenario : scenarios) {
+        for (uint32_t thread_count = 1;; thread_count = (std::min)(thread_count * 2, max_threads)) {
+            double seconds = 0.0;
+            if (!RunScenario(icd, *scenario, workers.data(), thread_count, ops, &seconds)) {
+                fprintf(stderr, "%s failed with %u threads\n", scenario->name, thread_count);
+                status = 1;
+                break;
+            }
+            std::vector<uint64_t> latencies;
+            for (uint32_t i = 0; i < thread_count; ++i) {
+                latencies.insert(latencies.end(), workers[i].latencies.begin(), workers[i].latencies.end());
+            }
+            std::sort(latencies.begin(), latencies.end());
+            printf("%-16s %8u %14.0f %10llu %10llu\n", scenario->name, thread_count, latencies.size() / seconds,
+                   static_cast<unsigned long long>(Percentile(latencies, 0.5)),
+                   static_cast<unsigned long long>(Percentile(latencies, 0.99)));
+            if (thread_count == max_threads) break;
+        }
+    }
+
+    for (Worker &worker : workers) DestroyWorker(icd, worker);
+    DestroyDevice(icd);
+    return status;
+}
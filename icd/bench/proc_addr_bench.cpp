@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Measures how fast the mock ICD resolves entry points. The loader and every layer look up each command for every instance and
+// device they create, so this is part of what creating a device costs.
+//
+// Usage: mock_icd_proc_addr_bench [path to the mock ICD library] [iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include "vulkan/vulkan.h"
+
+#ifndef MOCK_ICD_PATH
+#define MOCK_ICD_PATH ""
+#endif
+
+// Core Vulkan 1.0 to 1.2 commands
+static const char *const kCoreCommands[] = {
+    "vkCreateInstance", "vkDestroyInstance", "vkEnumeratePhysicalDevices", "vkGetPhysicalDeviceFeatures",
+    "vkGetPhysicalDeviceFormatProperties", "vkGetPhysicalDeviceImageFormatProperties", "vkGetPhysicalDeviceProperties",
+    "vkGetPhysicalDeviceQueueFamilyProperties", "vkGetPhysicalDeviceMemoryProperties", "vkGetInstanceProcAddr",
+    "vkGetDeviceProcAddr", "vkCreateDevice", "vkDestroyDevice", "vkEnumerateInstanceExtensionProperties",
+    "vkEnumerateDeviceExtensionProperties", "vkEnumerateInstanceLayerProperties", "vkEnumerateDeviceLayerProperties",
+    "vkGetDeviceQueue", "vkQueueSubmit", "vkQueueWaitIdle", "vkDeviceWaitIdle", "vkAllocateMemory", "vkFreeMemory", "vkMapMemory",
+    "vkUnmapMemory", "vkFlushMappedMemoryRanges", "vkInvalidateMappedMemoryRanges", "vkGetDeviceMemoryCommitment",
+    "vkBindBufferMemory", "vkBindImageMemory", "vkGetBufferMemoryRequirements", "vkGetImageMemoryRequirements",
+    "vkGetImageSparseMemoryRequirements", "vkGetPhysicalDeviceSparseImageFormatProperties", "vkQueueBindSparse", "vkCreateFence",
+    "vkDestroyFence", "vkResetFences", "vkGetFenceStatus", "vkWaitForFences", "vkCreateSemaphore", "vkDestroySemaphore",
+    "vkCreateEvent", "vkDestroyEvent", "vkGetEventStatus", "vkSetEvent", "vkResetEvent", "vkCreateQueryPool", "vkDestroyQueryPool",
+    "vkGetQueryPoolResults", "vkCreateBuffer", "vkDestroyBuffer", "vkCreateBufferView", "vkDestroyBufferView", "vkCreateImage",
+    "vkDestroyImage", "vkGetImageSubresourceLayout", "vkCreateImageView", "vkDestroyImageView", "vkCreateShaderModule",
+    "vkDestroyShaderModule", "vkCreatePipelineCache", "vkDestroyPipelineCache", "vkGetPipelineCacheData", "vkMergePipelineCaches",
+    "vkCreateGraphicsPipelines", "vkCreateComputePipelines", "vkDestroyPipeline", "vkCreatePipelineLayout",
+    "vkDestroyPipelineLayout", "vkCreateSampler", "vkDestroySampler", "vkCreateDescriptorSetLayout", "vkDestroyDescriptorSetLayout",
+    "vkCreateDescriptorPool", "vkDestroyDescriptorPool", "vkResetDescriptorPool", "vkAllocateDescriptorSets",
+    "vkFreeDescriptorSets", "vkUpdateDescriptorSets", "vkCreateFramebuffer", "vkDestroyFramebuffer", "vkCreateRenderPass",
+    "vkDestroyRenderPass", "vkGetRenderAreaGranularity", "vkCreateCommandPool", "vkDestroyCommandPool", "vkResetCommandPool",
+    "vkAllocateCommandBuffers", "vkFreeCommandBuffers", "vkBeginCommandBuffer", "vkEndCommandBuffer", "vkResetCommandBuffer",
+    "vkCmdBindPipeline", "vkCmdSetViewport", "vkCmdSetScissor", "vkCmdSetLineWidth", "vkCmdSetDepthBias", "vkCmdSetBlendConstants",
+    "vkCmdSetDepthBounds", "vkCmdSetStencilCompareMask", "vkCmdSetStencilWriteMask", "vkCmdSetStencilReference",
+    "vkCmdBindDescriptorSets", "vkCmdBindIndexBuffer", "vkCmdBindVertexBuffers", "vkCmdDraw", "vkCmdDrawIndexed",
+    "vkCmdDrawIndirect", "vkCmdDrawIndexedIndirect", "vkCmdDispatch", "vkCmdDispatchIndirect", "vkCmdCopyBuffer", "vkCmdCopyImage",
+    "vkCmdBlitImage", "vkCmdCopyBufferToImage", "vkCmdCopyImageToBuffer", "vkCmdUpdateBuffer", "vkCmdFillBuffer",
+    "vkCmdClearColorImage", "vkCmdClearDepthStencilImage", "vkCmdClearAttachments", "vkCmdResolveImage", "vkCmdSetEvent",
+    "vkCmdResetEvent", "vkCmdWaitEvents", "vkCmdPipelineBarrier", "vkCmdBeginQuery", "vkCmdEndQuery", "vkCmdResetQueryPool",
+    "vkCmdWriteTimestamp", "vkCmdCopyQueryPoolResults", "vkCmdPushConstants", "vkCmdBeginRenderPass", "vkCmdNextSubpass",
+    "vkCmdEndRenderPass", "vkCmdExecuteCommands", "vkEnumerateInstanceVersion", "vkBindBufferMemory2", "vkBindImageMemory2",
+    "vkGetDeviceGroupPeerMemoryFeatures", "vkCmdSetDeviceMask", "vkCmdDispatchBase", "vkEnumeratePhysicalDeviceGroups",
+    "vkGetImageMemoryRequirements2", "vkGetBufferMemoryRequirements2", "vkGetImageSparseMemoryRequirements2",
+    "vkGetPhysicalDeviceFeatures2", "vkGetPhysicalDeviceProperties2", "vkGetPhysicalDeviceFormatProperties2",
+    "vkGetPhysicalDeviceImageFormatProperties2", "vkGetPhysicalDeviceQueueFamilyProperties2",
+    "vkGetPhysicalDeviceMemoryProperties2", "vkGetPhysicalDeviceSparseImageFormatProperties2", "vkTrimCommandPool",
+    "vkGetDeviceQueue2", "vkCreateSamplerYcbcrConversion", "vkDestroySamplerYcbcrConversion", "vkCreateDescriptorUpdateTemplate",
+    "vkDestroyDescriptorUpdateTemplate", "vkUpdateDescriptorSetWithTemplate", "vkGetPhysicalDeviceExternalBufferProperties",
+    "vkGetPhysicalDeviceExternalFenceProperties", "vkGetPhysicalDeviceExternalSemaphoreProperties",
+    "vkGetDescriptorSetLayoutSupport", "vkCmdDrawIndirectCount", "vkCmdDrawIndexedIndirectCount", "vkCreateRenderPass2",
+    "vkCmdBeginRenderPass2", "vkCmdNextSubpass2", "vkCmdEndRenderPass2", "vkResetQueryPool", "vkGetSemaphoreCounterValue",
+    "vkWaitSemaphores", "vkSignalSemaphore", "vkGetBufferDeviceAddress", "vkGetBufferOpaqueCaptureAddress",
+    "vkGetDeviceMemoryOpaqueCaptureAddress",
+};
+
+static PFN_vkGetInstanceProcAddr LoadIcd(const char *path) {
+#if defined(_WIN32)
+    HMODULE library = LoadLibraryA(path);
+    if (!library) return nullptr;
+    return reinterpret_cast<PFN_vkGetInstanceProcAddr>(GetProcAddress(library, "vk_icdGetInstanceProcAddr"));
+#else
+    void *library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!library) return nullptr;
+    return reinterpret_cast<PFN_vkGetInstanceProcAddr>(dlsym(library, "vk_icdGetInstanceProcAddr"));
+#endif
+}
+
+// Returns the average time of a lookup in nanoseconds
+static double TimeLookups(PFN_vkGetInstanceProcAddr get_instance_proc_addr, const std::vector<const char *> &names,
+                          uint32_t iterations, uint32_t *found) {
+    *found = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        for (const char *name : names) {
+            if (get_instance_proc_addr(VK_NULL_HANDLE, name)) ++*found;
+        }
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    *found /= iterations;
+    return elapsed.count() / (static_cast<double>(iterations) * names.size());
+}
+
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : MOCK_ICD_PATH;
+    const uint32_t iterations = argc > 2 ? static_cast<uint32_t>(strtoul(argv[2], nullptr, 10)) : 10000;
+    if (!*path || iterations == 0) {
+        fprintf(stderr, "Usage: %s [path to the mock ICD library] [iterations]\n", argv[0]);
+        return 1;
+    }
+    PFN_vkGetInstanceProcAddr get_instance_proc_addr = LoadIcd(path);
+    if (!get_instance_proc_addr) {
+        fprintf(stderr, "Can't load vk_icdGetInstanceProcAddr from %s\n", path);
+        return 1;
+    }
+
+    std::vector<const char *> hits(std::begin(kCoreCommands), std::end(kCoreCommands));
+    // The same names with a made-up vendor suffix, like the extension commands layers look for that the ICD doesn't have
+    std::vector<std::string> missing_names;
+    for (const char *name : hits) missing_names.push_back(std::string(name) + "ZZZ");
+    std::vector<const char *> misses;
+    for (const auto &name : missing_names) misses.push_back(name.c_str());
+
+    uint32_t found = 0;
+    const double hit_ns = TimeLookups(get_instance_proc_addr, hits, iterations, &found);
+    printf("%zu commands that exist (%u found): %.1f ns per lookup, %.1f us for all of them\n", hits.size(), found, hit_ns,
+           hit_ns * hits.size() / 1000.0);
+    const double miss_ns = TimeLookups(get_instance_proc_addr, misses, iterations, &found);
+    printf("%zu commands that don't exist (%u found): %.1f ns per lookup\n", misses.size(), found, miss_ns);
+    return 0;
+}
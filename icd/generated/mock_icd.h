@@ -23,10 +23,13 @@
 */
 
 #include <unordered_map>
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <cstring>
 #include "vulkan/vk_icd.h"
+#include "mock_icd_proc_table.h"
+#include "mock_icd_image.h"
 namespace vkmock {
 
 
@@ -35,10 +38,24 @@ using lock_guard_t = std::lock_guard<mutex_t>;
 using unique_lock_t = std::unique_lock<mutex_t>;
 
 static mutex_t global_lock;
-static uint64_t global_unique_handle = 1;
+// Next block of non-dispatchable handle values to hand out. Handle value 0 is VK_NULL_HANDLE so start at 1.
+static std::atomic<uint64_t> global_unique_handle{1};
+// Number of handle values a thread reserves at a time from global_unique_handle
+static constexpr uint64_t kHandleBlockSize = 4096;
 static const uint32_t SUPPORTED_LOADER_ICD_INTERFACE_VERSION = 5;
 static uint32_t loader_interface_version = 0;
 static bool negotiate_loader_icd_interface_called = false;
+// Each thread reserves a block of handle values with a single atomic add and then hands them out without any
+//  synchronization, so non-dispatchable object creation doesn't contend on global_lock.
+static uint64_t AllocateNonDispHandle() {
+    thread_local uint64_t next_handle = 0;
+    thread_local uint64_t block_end = 0;
+    if (next_handle == block_end) {
+        next_handle = global_unique_handle.fetch_add(kHandleBlockSize, std::memory_order_relaxed);
+        block_end = next_handle + kHandleBlockSize;
+    }
+    return next_handle++;
+}
 static void* CreateDispObjHandle() {
     auto handle = new VK_LOADER_DATA;
     set_loader_magic_value(handle);
@@ -48,252 +65,504 @@ static void DestroyDispObjHandle(void* handle) {
     delete reinterpret_cast<VK_LOADER_DATA*>(handle);
 }
 
-// Map of instance extension name to version
-static const std::unordered_map<std::string, uint32_t> instance_extension_map = {
-    {"VK_KHR_surface", 25},
-    {"VK_KHR_display", 23},
-    {"VK_KHR_xlib_surface", 6},
-    {"VK_KHR_xcb_surface", 6},
-    {"VK_KHR_wayland_surface", 6},
-    {"VK_KHR_android_surface", 6},
-    {"VK_KHR_win32_surface", 6},
+// Instance extensions the mock ICD implements, sorted by name
+static const VkExtensionProperties kInstanceExtensions[] = {
+    {"VK_EXT_acquire_xlib_display", 1},
     {"VK_EXT_debug_report", 10},
-    {"VK_GGP_stream_descriptor_surface", 1},
-    {"VK_NV_external_memory_capabilities", 1},
-    {"VK_KHR_get_physical_device_properties2", 2},
-    {"VK_EXT_validation_flags", 2},
-    {"VK_NN_vi_surface", 1},
-    {"VK_KHR_device_group_creation", 1},
-    {"VK_KHR_external_memory_capabilities", 1},
-    {"VK_KHR_external_semaphore_capabilities", 1},
+    {"VK_EXT_debug_utils", 2},
     {"VK_EXT_direct_mode_display", 1},
-    {"VK_EXT_acquire_xlib_display", 1},
+    {"VK_EXT_directfb_surface", 1},
     {"VK_EXT_display_surface_counter", 1},
+    {"VK_EXT_headless_surface", 1},
+    {"VK_EXT_metal_surface", 1},
     {"VK_EXT_swapchain_colorspace", 4},
+    {"VK_EXT_validation_features", 4},
+    {"VK_EXT_validation_flags", 2},
+    {"VK_FUCHSIA_imagepipe_surface", 1},
+    {"VK_GGP_stream_descriptor_surface", 1},
+    {"VK_KHR_android_surface", 6},
+    {"VK_KHR_device_group_creation", 1},
+    {"VK_KHR_display", 23},
     {"VK_KHR_external_fence_capabilities", 1},
-    {"VK_KHR_get_surface_capabilities2", 1},
+    {"VK_KHR_external_memory_capabilities", 1},
+    {"VK_KHR_external_semaphore_capabilities", 1},
     {"VK_KHR_get_display_properties2", 1},
+    {"VK_KHR_get_physical_device_properties2", 2},
+    {"VK_KHR_get_surface_capabilities2", 1},
+    {"VK_KHR_surface", 25},
+    {"VK_KHR_surface_protected_capabilities", 1},
+    {"VK_KHR_wayland_surface", 6},
+    {"VK_KHR_win32_surface", 6},
+    {"VK_KHR_xcb_surface", 6},
+    {"VK_KHR_xlib_surface", 6},
     {"VK_MVK_ios_surface", 3},
     {"VK_MVK_macos_surface", 3},
-    {"VK_EXT_debug_utils", 2},
-    {"VK_FUCHSIA_imagepipe_surface", 1},
-    {"VK_EXT_metal_surface", 1},
-    {"VK_KHR_surface_protected_capabilities", 1},
-    {"VK_EXT_validation_features", 4},
-    {"VK_EXT_headless_surface", 1},
-    {"VK_EXT_directfb_surface", 1},
+    {"VK_NN_vi_surface", 1},
+    {"VK_NV_external_memory_capabilities", 1},
     {"VK_QNX_screen_surface", 1},
 };
-// Map of device extension name to version
-static const std::unordered_map<std::string, uint32_t> device_extension_map = {
-    {"VK_KHR_swapchain", 70},
-    {"VK_KHR_display_swapchain", 10},
-    {"VK_NV_glsl_shader", 1},
-    {"VK_EXT_depth_range_unrestricted", 1},
-    {"VK_KHR_sampler_mirror_clamp_to_edge", 3},
-    {"VK_IMG_filter_cubic", 1},
-    {"VK_AMD_rasterization_order", 1},
-    {"VK_AMD_shader_trinary_minmax", 1},
-    {"VK_AMD_shader_explicit_vertex_parameter", 1},
-    {"VK_EXT_debug_marker", 4},
-    {"VK_KHR_video_queue", 1},
-    {"VK_KHR_video_decode_queue", 1},
-    {"VK_AMD_gcn_shader", 1},
-    {"VK_NV_dedicated_allocation", 1},
-    {"VK_EXT_transform_feedback", 1},
-    {"VK_NVX_binary_import", 1},
-    {"VK_NVX_image_view_handle", 2},
+// Device extensions the mock ICD implements, sorted by name
+static const VkExtensionProperties kDeviceExtensions[] = {
+    {"VK_AMD_buffer_marker", 1},
+    {"VK_AMD_device_coherent_memory", 1},
+    {"VK_AMD_display_native_hdr", 1},
     {"VK_AMD_draw_indirect_count", 2},
-    {"VK_AMD_negative_viewport_height", 1},
+    {"VK_AMD_gcn_shader", 1},
     {"VK_AMD_gpu_shader_half_float", 2},
+    {"VK_AMD_gpu_shader_int16", 2},
+    {"VK_AMD_memory_overallocation_behavior", 1},
+    {"VK_AMD_mixed_attachment_samples", 1},
+    {"VK_AMD_negative_viewport_height", 1},
+    {"VK_AMD_pipeline_compiler_control", 1},
+    {"VK_AMD_rasterization_order", 1},
     {"VK_AMD_shader_ballot", 1},
-    {"VK_EXT_video_encode_h264", 1},
-    {"VK_EXT_video_decode_h264", 1},
-    {"VK_AMD_texture_gather_bias_lod", 1},
-    {"VK_AMD_shader_info", 1},
+    {"VK_AMD_shader_core_properties", 2},
+    {"VK_AMD_shader_core_properties2", 1},
+    {"VK_AMD_shader_explicit_vertex_parameter", 1},
+    {"VK_AMD_shader_fragment_mask", 1},
     {"VK_AMD_shader_image_load_store_lod", 1},
-    {"VK_NV_corner_sampled_image", 2},
-    {"VK_KHR_multiview", 1},
-    {"VK_IMG_format_pvrtc", 1},
-    {"VK_NV_external_memory", 1},
-    {"VK_NV_external_memory_win32", 1},
-    {"VK_NV_win32_keyed_mutex", 2},
-    {"VK_KHR_device_group", 4},
-    {"VK_KHR_shader_draw_parameters", 1},
-    {"VK_EXT_shader_subgroup_ballot", 1},
-    {"VK_EXT_shader_subgroup_vote", 1},
-    {"VK_EXT_texture_compression_astc_hdr", 1},
+    {"VK_AMD_shader_info", 1},
+    {"VK_AMD_shader_trinary_minmax", 1},
+    {"VK_AMD_texture_gather_bias_lod", 1},
+    {"VK_ANDROID_external_memory_android_hardware_buffer", 3},
+    {"VK_EXT_4444_formats", 1},
     {"VK_EXT_astc_decode_mode", 1},
-    {"VK_KHR_maintenance1", 2},
-    {"VK_KHR_external_memory", 1},
-    {"VK_KHR_external_memory_win32", 1},
-    {"VK_KHR_external_memory_fd", 1},
-    {"VK_KHR_win32_keyed_mutex", 1},
-    {"VK_KHR_external_semaphore", 1},
-    {"VK_KHR_external_semaphore_win32", 1},
-    {"VK_KHR_external_semaphore_fd", 1},
-    {"VK_KHR_push_descriptor", 2},
+    {"VK_EXT_blend_operation_advanced", 2},
+    {"VK_EXT_buffer_device_address", 2},
+    {"VK_EXT_calibrated_timestamps", 2},
+    {"VK_EXT_color_write_enable", 1},
     {"VK_EXT_conditional_rendering", 2},
-    {"VK_KHR_shader_float16_int8", 1},
-    {"VK_KHR_16bit_storage", 1},
-    {"VK_KHR_incremental_present", 2},
-    {"VK_KHR_descriptor_update_template", 1},
-    {"VK_NV_clip_space_w_scaling", 1},
-    {"VK_EXT_display_control", 1},
-    {"VK_GOOGLE_display_timing", 1},
-    {"VK_NV_sample_mask_override_coverage", 1},
-    {"VK_NV_geometry_shader_passthrough", 1},
-    {"VK_NV_viewport_array2", 1},
-    {"VK_NVX_multiview_per_view_attributes", 1},
-    {"VK_NV_viewport_swizzle", 1},
-    {"VK_EXT_discard_rectangles", 1},
     {"VK_EXT_conservative_rasterization", 1},
+    {"VK_EXT_custom_border_color", 12},
+    {"VK_EXT_debug_marker", 4},
     {"VK_EXT_depth_clip_enable", 1},
-    {"VK_EXT_hdr_metadata", 2},
-    {"VK_KHR_imageless_framebuffer", 1},
-    {"VK_KHR_create_renderpass2", 1},
-    {"VK_KHR_shared_presentable_image", 1},
-    {"VK_KHR_external_fence", 1},
-    {"VK_KHR_external_fence_win32", 1},
-    {"VK_KHR_external_fence_fd", 1},
-    {"VK_KHR_performance_query", 1},
-    {"VK_KHR_maintenance2", 1},
-    {"VK_KHR_variable_pointers", 1},
+    {"VK_EXT_depth_range_unrestricted", 1},
+    {"VK_EXT_descriptor_indexing", 2},
+    {"VK_EXT_device_memory_report", 2},
+    {"VK_EXT_discard_rectangles", 1},
+    {"VK_EXT_display_control", 1},
+    {"VK_EXT_extended_dynamic_state", 1},
+    {"VK_EXT_extended_dynamic_state2", 1},
     {"VK_EXT_external_memory_dma_buf", 1},
+    {"VK_EXT_external_memory_host", 1},
+    {"VK_EXT_filter_cubic", 3},
+    {"VK_EXT_fragment_density_map", 1},
+    {"VK_EXT_fragment_density_map2", 1},
+    {"VK_EXT_fragment_shader_interlock", 1},
+    {"VK_EXT_full_screen_exclusive", 4},
+    {"VK_EXT_global_priority", 2},
+    {"VK_EXT_hdr_metadata", 2},
+    {"VK_EXT_host_query_reset", 1},
+    {"VK_EXT_image_drm_format_modifier", 1},
+    {"VK_EXT_image_robustness", 1},
+    {"VK_EXT_index_type_uint8", 1},
+    {"VK_EXT_inline_uniform_block", 1},
+    {"VK_EXT_line_rasterization", 1},
+    {"VK_EXT_memory_budget", 1},
+    {"VK_EXT_memory_priority", 1},
+    {"VK_EXT_pci_bus_info", 2},
+    {"VK_EXT_pipeline_creation_cache_control", 3},
+    {"VK_EXT_pipeline_creation_feedback", 1},
+    {"VK_EXT_post_depth_coverage", 1},
+    {"VK_EXT_private_data", 1},
+    {"VK_EXT_provoking_vertex", 1},
     {"VK_EXT_queue_family_foreign", 1},
-    {"VK_KHR_dedicated_allocation", 3},
-    {"VK_ANDROID_external_memory_android_hardware_buffer", 3},
+    {"VK_EXT_robustness2", 1},
+    {"VK_EXT_sample_locations", 1},
     {"VK_EXT_sampler_filter_minmax", 2},
-    {"VK_KHR_storage_buffer_storage_class", 1},
-    {"VK_AMD_gpu_shader_int16", 2},
-    {"VK_AMD_mixed_attachment_samples", 1},
-    {"VK_AMD_shader_fragment_mask", 1},
-    {"VK_EXT_inline_uniform_block", 1},
+    {"VK_EXT_scalar_block_layout", 1},
+    {"VK_EXT_separate_stencil_usage", 1},
+    {"VK_EXT_shader_atomic_float", 1},
+    {"VK_EXT_shader_demote_to_helper_invocation", 1},
+    {"VK_EXT_shader_image_atomic_int64", 1},
     {"VK_EXT_shader_stencil_export", 1},
-    {"VK_EXT_sample_locations", 1},
-    {"VK_KHR_relaxed_block_layout", 1},
-    {"VK_KHR_get_memory_requirements2", 1},
-    {"VK_KHR_image_format_list", 1},
-    {"VK_EXT_blend_operation_advanced", 2},
-    {"VK_NV_fragment_coverage_to_color", 1},
-    {"VK_KHR_acceleration_structure", 11},
-    {"VK_KHR_ray_tracing_pipeline", 1},
-    {"VK_KHR_ray_query", 1},
-    {"VK_NV_framebuffer_mixed_samples", 1},
-    {"VK_NV_fill_rectangle", 1},
-    {"VK_NV_shader_sm_builtins", 1},
-    {"VK_EXT_post_depth_coverage", 1},
-    {"VK_KHR_sampler_ycbcr_conversion", 14},
-    {"VK_KHR_bind_memory2", 1},
-    {"VK_EXT_image_drm_format_modifier", 1},
-    {"VK_EXT_descriptor_indexing", 2},
+    {"VK_EXT_shader_subgroup_ballot", 1},
+    {"VK_EXT_shader_subgroup_vote", 1},
     {"VK_EXT_shader_viewport_index_layer", 1},
-    {"VK_NV_shading_rate_image", 3},
-    {"VK_NV_ray_tracing", 3},
-    {"VK_NV_representative_fragment_test", 2},
-    {"VK_KHR_maintenance3", 1},
-    {"VK_KHR_draw_indirect_count", 1},
-    {"VK_EXT_filter_cubic", 3},
-    {"VK_QCOM_render_pass_shader_resolve", 4},
-    {"VK_EXT_global_priority", 2},
-    {"VK_KHR_shader_subgroup_extended_types", 1},
-    {"VK_KHR_8bit_storage", 1},
-    {"VK_EXT_external_memory_host", 1},
-    {"VK_AMD_buffer_marker", 1},
-    {"VK_KHR_shader_atomic_int64", 1},
-    {"VK_KHR_shader_clock", 1},
-    {"VK_AMD_pipeline_compiler_control", 1},
-    {"VK_EXT_calibrated_timestamps", 2},
-    {"VK_AMD_shader_core_properties", 2},
-    {"VK_EXT_video_decode_h265", 1},
-    {"VK_AMD_memory_overallocation_behavior", 1},
+    {"VK_EXT_subgroup_size_control", 2},
+    {"VK_EXT_texel_buffer_alignment", 1},
+    {"VK_EXT_texture_compression_astc_hdr", 1},
+    {"VK_EXT_tooling_info", 1},
+    {"VK_EXT_transform_feedback", 1},
     {"VK_EXT_vertex_attribute_divisor", 3},
+    {"VK_EXT_vertex_input_dynamic_state", 2},
+    {"VK_EXT_video_decode_h264", 1},
+    {"VK_EXT_video_decode_h265", 1},
+    {"VK_EXT_video_encode_h264", 1},
+    {"VK_EXT_ycbcr_2plane_444_formats", 1},
+    {"VK_EXT_ycbcr_image_arrays", 1},
+    {"VK_FUCHSIA_external_memory", 1},
+    {"VK_FUCHSIA_external_semaphore", 1},
     {"VK_GGP_frame_token", 1},
-    {"VK_EXT_pipeline_creation_feedback", 1},
-    {"VK_KHR_driver_properties", 1},
-    {"VK_KHR_shader_float_controls", 4},
-    {"VK_NV_shader_subgroup_partitioned", 1},
-    {"VK_KHR_depth_stencil_resolve", 1},
-    {"VK_KHR_swapchain_mutable_format", 1},
-    {"VK_NV_compute_shader_derivatives", 1},
-    {"VK_NV_mesh_shader", 1},
-    {"VK_NV_fragment_shader_barycentric", 1},
-    {"VK_NV_shader_image_footprint", 2},
-    {"VK_NV_scissor_exclusive", 1},
-    {"VK_NV_device_diagnostic_checkpoints", 2},
-    {"VK_KHR_timeline_semaphore", 2},
-    {"VK_INTEL_shader_integer_functions2", 1},
-    {"VK_INTEL_performance_query", 2},
-    {"VK_KHR_vulkan_memory_model", 3},
-    {"VK_EXT_pci_bus_info", 2},
-    {"VK_AMD_display_native_hdr", 1},
-    {"VK_KHR_shader_terminate_invocation", 1},
-    {"VK_EXT_fragment_density_map", 1},
-    {"VK_EXT_scalar_block_layout", 1},
-    {"VK_GOOGLE_hlsl_functionality1", 1},
     {"VK_GOOGLE_decorate_string", 1},
-    {"VK_EXT_subgroup_size_control", 2},
-    {"VK_KHR_fragment_shading_rate", 1},
-    {"VK_AMD_shader_core_properties2", 1},
-    {"VK_AMD_device_coherent_memory", 1},
-    {"VK_EXT_shader_image_atomic_int64", 1},
-    {"VK_KHR_spirv_1_4", 1},
-    {"VK_EXT_memory_budget", 1},
-    {"VK_EXT_memory_priority", 1},
-    {"VK_NV_dedicated_allocation_image_aliasing", 1},
-    {"VK_KHR_separate_depth_stencil_layouts", 1},
-    {"VK_EXT_buffer_device_address", 2},
-    {"VK_EXT_tooling_info", 1},
-    {"VK_EXT_separate_stencil_usage", 1},
-    {"VK_NV_cooperative_matrix", 1},
-    {"VK_NV_coverage_reduction_mode", 1},
-    {"VK_EXT_fragment_shader_interlock", 1},
-    {"VK_EXT_ycbcr_image_arrays", 1},
-    {"VK_KHR_uniform_buffer_standard_layout", 1},
-    {"VK_EXT_provoking_vertex", 1},
-    {"VK_EXT_full_screen_exclusive", 4},
+    {"VK_GOOGLE_display_timing", 1},
+    {"VK_GOOGLE_hlsl_functionality1", 1},
+    {"VK_GOOGLE_user_type", 1},
+    {"VK_IMG_filter_cubic", 1},
+    {"VK_IMG_format_pvrtc", 1},
+    {"VK_INTEL_performance_query", 2},
+    {"VK_INTEL_shader_integer_functions2", 1},
+    {"VK_KHR_16bit_storage", 1},
+    {"VK_KHR_8bit_storage", 1},
+    {"VK_KHR_acceleration_structure", 11},
+    {"VK_KHR_bind_memory2", 1},
     {"VK_KHR_buffer_device_address", 1},
-    {"VK_EXT_line_rasterization", 1},
-    {"VK_EXT_shader_atomic_float", 1},
-    {"VK_EXT_host_query_reset", 1},
-    {"VK_EXT_index_type_uint8", 1},
-    {"VK_EXT_extended_dynamic_state", 1},
+    {"VK_KHR_copy_commands2", 1},
+    {"VK_KHR_create_renderpass2", 1},
+    {"VK_KHR_dedicated_allocation", 3},
     {"VK_KHR_deferred_host_operations", 4},
+    {"VK_KHR_depth_stencil_resolve", 1},
+    {"VK_KHR_descriptor_update_template", 1},
+    {"VK_KHR_device_group", 4},
+    {"VK_KHR_display_swapchain", 10},
+    {"VK_KHR_draw_indirect_count", 1},
+    {"VK_KHR_driver_properties", 1},
+    {"VK_KHR_external_fence", 1},
+    {"VK_KHR_external_fence_fd", 1},
+    {"VK_KHR_external_fence_win32", 1},
+    {"VK_KHR_external_memory", 1},
+    {"VK_KHR_external_memory_fd", 1},
+    {"VK_KHR_external_memory_win32", 1},
+    {"VK_KHR_external_semaphore", 1},
+    {"VK_KHR_external_semaphore_fd", 1},
+    {"VK_KHR_external_semaphore_win32", 1},
+    {"VK_KHR_fragment_shading_rate", 1},
+    {"VK_KHR_get_memory_requirements2", 1},
+    {"VK_KHR_image_format_list", 1},
+    {"VK_KHR_imageless_framebuffer", 1},
+    {"VK_KHR_incremental_present", 2},
+    {"VK_KHR_maintenance1", 2},
+    {"VK_KHR_maintenance2", 1},
+    {"VK_KHR_maintenance3", 1},
+    {"VK_KHR_multiview", 1},
+    {"VK_KHR_performance_query", 1},
     {"VK_KHR_pipeline_executable_properties", 1},
-    {"VK_EXT_shader_demote_to_helper_invocation", 1},
-    {"VK_NV_device_generated_commands", 3},
-    {"VK_NV_inherited_viewport_scissor", 1},
-    {"VK_EXT_texel_buffer_alignment", 1},
-    {"VK_QCOM_render_pass_transform", 2},
-    {"VK_EXT_device_memory_report", 2},
-    {"VK_EXT_robustness2", 1},
-    {"VK_EXT_custom_border_color", 12},
-    {"VK_GOOGLE_user_type", 1},
     {"VK_KHR_pipeline_library", 1},
+    {"VK_KHR_push_descriptor", 2},
+    {"VK_KHR_ray_query", 1},
+    {"VK_KHR_ray_tracing_pipeline", 1},
+    {"VK_KHR_relaxed_block_layout", 1},
+    {"VK_KHR_sampler_mirror_clamp_to_edge", 3},
+    {"VK_KHR_sampler_ycbcr_conversion", 14},
+    {"VK_KHR_separate_depth_stencil_layouts", 1},
+    {"VK_KHR_shader_atomic_int64", 1},
+    {"VK_KHR_shader_clock", 1},
+    {"VK_KHR_shader_draw_parameters", 1},
+    {"VK_KHR_shader_float16_int8", 1},
+    {"VK_KHR_shader_float_controls", 4},
     {"VK_KHR_shader_non_semantic_info", 1},
-    {"VK_EXT_private_data", 1},
-    {"VK_EXT_pipeline_creation_cache_control", 3},
-    {"VK_KHR_video_encode_queue", 2},
-    {"VK_NV_device_diagnostics_config", 1},
-    {"VK_QCOM_render_pass_store_ops", 2},
+    {"VK_KHR_shader_subgroup_extended_types", 1},
+    {"VK_KHR_shader_terminate_invocation", 1},
+    {"VK_KHR_shared_presentable_image", 1},
+    {"VK_KHR_spirv_1_4", 1},
+    {"VK_KHR_storage_buffer_storage_class", 1},
+    {"VK_KHR_swapchain", 70},
+    {"VK_KHR_swapchain_mutable_format", 1},
     {"VK_KHR_synchronization2", 1},
+    {"VK_KHR_timeline_semaphore", 2},
+    {"VK_KHR_uniform_buffer_standard_layout", 1},
+    {"VK_KHR_variable_pointers", 1},
+    {"VK_KHR_video_decode_queue", 1},
+    {"VK_KHR_video_encode_queue", 2},
+    {"VK_KHR_video_queue", 1},
+    {"VK_KHR_vulkan_memory_model", 3},
+    {"VK_KHR_win32_keyed_mutex", 1},
+    {"VK_KHR_workgroup_memory_explicit_layout", 1},
     {"VK_KHR_zero_initialize_workgroup_memory", 1},
+    {"VK_NVX_binary_import", 1},
+    {"VK_NVX_image_view_handle", 2},
+    {"VK_NVX_multiview_per_view_attributes", 1},
+    {"VK_NV_acquire_winrt_display", 1},
+    {"VK_NV_clip_space_w_scaling", 1},
+    {"VK_NV_compute_shader_derivatives", 1},
+    {"VK_NV_cooperative_matrix", 1},
+    {"VK_NV_corner_sampled_image", 2},
+    {"VK_NV_coverage_reduction_mode", 1},
+    {"VK_NV_dedicated_allocation", 1},
+    {"VK_NV_dedicated_allocation_image_aliasing", 1},
+    {"VK_NV_device_diagnostic_checkpoints", 2},
+    {"VK_NV_device_diagnostics_config", 1},
+    {"VK_NV_device_generated_commands", 3},
+    {"VK_NV_external_memory", 1},
+    {"VK_NV_external_memory_win32", 1},
+    {"VK_NV_fill_rectangle", 1},
+    {"VK_NV_fragment_coverage_to_color", 1},
+    {"VK_NV_fragment_shader_barycentric", 1},
     {"VK_NV_fragment_shading_rate_enums", 1},
-    {"VK_EXT_ycbcr_2plane_444_formats", 1},
-    {"VK_EXT_fragment_density_map2", 1},
+    {"VK_NV_framebuffer_mixed_samples", 1},
+    {"VK_NV_geometry_shader_passthrough", 1},
+    {"VK_NV_glsl_shader", 1},
+    {"VK_NV_inherited_viewport_scissor", 1},
+    {"VK_NV_mesh_shader", 1},
+    {"VK_NV_ray_tracing", 3},
+    {"VK_NV_representative_fragment_test", 2},
+    {"VK_NV_sample_mask_override_coverage", 1},
+    {"VK_NV_scissor_exclusive", 1},
+    {"VK_NV_shader_image_footprint", 2},
+    {"VK_NV_shader_sm_builtins", 1},
+    {"VK_NV_shader_subgroup_partitioned", 1},
+    {"VK_NV_shading_rate_image", 3},
+    {"VK_NV_viewport_array2", 1},
+    {"VK_NV_viewport_swizzle", 1},
+    {"VK_NV_win32_keyed_mutex", 2},
+    {"VK_QCOM_render_pass_shader_resolve", 4},
+    {"VK_QCOM_render_pass_store_ops", 2},
+    {"VK_QCOM_render_pass_transform", 2},
     {"VK_QCOM_rotated_copy_commands", 1},
-    {"VK_EXT_image_robustness", 1},
-    {"VK_KHR_workgroup_memory_explicit_layout", 1},
-    {"VK_KHR_copy_commands2", 1},
-    {"VK_EXT_4444_formats", 1},
-    {"VK_NV_acquire_winrt_display", 1},
     {"VK_VALVE_mutable_descriptor_type", 1},
-    {"VK_EXT_vertex_input_dynamic_state", 2},
-    {"VK_FUCHSIA_external_memory", 1},
-    {"VK_FUCHSIA_external_semaphore", 1},
-    {"VK_EXT_extended_dynamic_state2", 1},
-    {"VK_EXT_color_write_enable", 1},
 };
+// Texel block layout of every format in the registry
+static FormatInfo GetFormatInfo(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_R4G4_UNORM_PACK8: return {1, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R4G4B4A4_UNORM_PACK16: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B4G4R4A4_UNORM_PACK16: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R5G6B5_UNORM_PACK16: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B5G6R5_UNORM_PACK16: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R5G5B5A1_UNORM_PACK16: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B5G5R5A1_UNORM_PACK16: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A1R5G5B5_UNORM_PACK16: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8_UNORM: return {1, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8_SNORM: return {1, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8_USCALED: return {1, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8_SSCALED: return {1, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8_UINT: return {1, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8_SINT: return {1, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8_SRGB: return {1, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8_UNORM: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8_SNORM: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8_USCALED: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8_SSCALED: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8_UINT: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8_SINT: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8_SRGB: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8_UNORM: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8_SNORM: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8_USCALED: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8_SSCALED: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8_UINT: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8_SINT: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8_SRGB: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8_UNORM: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8_SNORM: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8_USCALED: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8_SSCALED: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8_UINT: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8_SINT: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8_SRGB: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8A8_UNORM: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8A8_SNORM: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8A8_USCALED: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8A8_SSCALED: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8A8_UINT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8A8_SINT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R8G8B8A8_SRGB: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8A8_UNORM: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8A8_SNORM: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8A8_USCALED: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8A8_SSCALED: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8A8_UINT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8A8_SINT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8A8_SRGB: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A8B8G8R8_UNORM_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A8B8G8R8_SNORM_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A8B8G8R8_USCALED_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A8B8G8R8_SSCALED_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A8B8G8R8_UINT_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A8B8G8R8_SINT_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A8B8G8R8_SRGB_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2R10G10B10_UNORM_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2R10G10B10_SNORM_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2R10G10B10_USCALED_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2R10G10B10_SSCALED_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2R10G10B10_UINT_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2R10G10B10_SINT_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2B10G10R10_UNORM_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2B10G10R10_SNORM_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2B10G10R10_USCALED_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2B10G10R10_SSCALED_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2B10G10R10_UINT_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A2B10G10R10_SINT_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16_UNORM: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16_SNORM: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16_USCALED: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16_SSCALED: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16_UINT: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16_SINT: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16_SFLOAT: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16_UNORM: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16_SNORM: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16_USCALED: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16_SSCALED: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16_UINT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16_SINT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16_SFLOAT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16_UNORM: return {6, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16_SNORM: return {6, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16_USCALED: return {6, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16_SSCALED: return {6, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16_UINT: return {6, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16_SINT: return {6, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16_SFLOAT: return {6, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16A16_UNORM: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16A16_SNORM: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16A16_USCALED: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16A16_SSCALED: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16A16_UINT: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16A16_SINT: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R16G16B16A16_SFLOAT: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32_UINT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32_SINT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32_SFLOAT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32G32_UINT: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32G32_SINT: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32G32_SFLOAT: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32G32B32_UINT: return {12, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32G32B32_SINT: return {12, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32G32B32_SFLOAT: return {12, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32G32B32A32_UINT: return {16, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32G32B32A32_SINT: return {16, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R32G32B32A32_SFLOAT: return {16, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64_UINT: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64_SINT: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64_SFLOAT: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64G64_UINT: return {16, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64G64_SINT: return {16, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64G64_SFLOAT: return {16, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64G64B64_UINT: return {24, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64G64B64_SINT: return {24, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64G64B64_SFLOAT: return {24, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64G64B64A64_UINT: return {32, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64G64B64A64_SINT: return {32, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R64G64B64A64_SFLOAT: return {32, 1, 1, 1, 0, {}};
+        case VK_FORMAT_B10G11R11_UFLOAT_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_E5B9G9R9_UFLOAT_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_D16_UNORM: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_X8_D24_UNORM_PACK32: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_D32_SFLOAT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_S8_UINT: return {1, 1, 1, 1, 0, {}};
+        case VK_FORMAT_D16_UNORM_S8_UINT: return {3, 1, 1, 1, 0, {}};
+        case VK_FORMAT_D24_UNORM_S8_UINT: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_D32_SFLOAT_S8_UINT: return {5, 1, 1, 1, 0, {}};
+        case VK_FORMAT_BC1_RGB_UNORM_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC2_UNORM_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC2_SRGB_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC3_UNORM_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC3_SRGB_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC4_UNORM_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC4_SNORM_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC5_UNORM_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC5_SNORM_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC6H_UFLOAT_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC6H_SFLOAT_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC7_UNORM_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_BC7_SRGB_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_EAC_R11_UNORM_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_EAC_R11_SNORM_BLOCK: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_EAC_R11G11_UNORM_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_EAC_R11G11_SNORM_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ASTC_4x4_UNORM_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ASTC_4x4_SRGB_BLOCK: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ASTC_5x4_UNORM_BLOCK: return {16, 5, 4, 1, 0, {}};
+        case VK_FORMAT_ASTC_5x4_SRGB_BLOCK: return {16, 5, 4, 1, 0, {}};
+        case VK_FORMAT_ASTC_5x5_UNORM_BLOCK: return {16, 5, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_5x5_SRGB_BLOCK: return {16, 5, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_6x5_UNORM_BLOCK: return {16, 6, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_6x5_SRGB_BLOCK: return {16, 6, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_6x6_UNORM_BLOCK: return {16, 6, 6, 1, 0, {}};
+        case VK_FORMAT_ASTC_6x6_SRGB_BLOCK: return {16, 6, 6, 1, 0, {}};
+        case VK_FORMAT_ASTC_8x5_UNORM_BLOCK: return {16, 8, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_8x5_SRGB_BLOCK: return {16, 8, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_8x6_UNORM_BLOCK: return {16, 8, 6, 1, 0, {}};
+        case VK_FORMAT_ASTC_8x6_SRGB_BLOCK: return {16, 8, 6, 1, 0, {}};
+        case VK_FORMAT_ASTC_8x8_UNORM_BLOCK: return {16, 8, 8, 1, 0, {}};
+        case VK_FORMAT_ASTC_8x8_SRGB_BLOCK: return {16, 8, 8, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x5_UNORM_BLOCK: return {16, 10, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x5_SRGB_BLOCK: return {16, 10, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x6_UNORM_BLOCK: return {16, 10, 6, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x6_SRGB_BLOCK: return {16, 10, 6, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x8_UNORM_BLOCK: return {16, 10, 8, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x8_SRGB_BLOCK: return {16, 10, 8, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x10_UNORM_BLOCK: return {16, 10, 10, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x10_SRGB_BLOCK: return {16, 10, 10, 1, 0, {}};
+        case VK_FORMAT_ASTC_12x10_UNORM_BLOCK: return {16, 12, 10, 1, 0, {}};
+        case VK_FORMAT_ASTC_12x10_SRGB_BLOCK: return {16, 12, 10, 1, 0, {}};
+        case VK_FORMAT_ASTC_12x12_UNORM_BLOCK: return {16, 12, 12, 1, 0, {}};
+        case VK_FORMAT_ASTC_12x12_SRGB_BLOCK: return {16, 12, 12, 1, 0, {}};
+        case VK_FORMAT_G8B8G8R8_422_UNORM: return {4, 2, 1, 1, 0, {}};
+        case VK_FORMAT_B8G8R8G8_422_UNORM: return {4, 2, 1, 1, 0, {}};
+        case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM: return {3, 1, 1, 1, 3, {{1, 1, 1}, {2, 2, 1}, {2, 2, 1}}};
+        case VK_FORMAT_G8_B8R8_2PLANE_420_UNORM: return {3, 1, 1, 1, 2, {{1, 1, 1}, {2, 2, 2}}};
+        case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM: return {3, 1, 1, 1, 3, {{1, 1, 1}, {2, 1, 1}, {2, 1, 1}}};
+        case VK_FORMAT_G8_B8R8_2PLANE_422_UNORM: return {3, 1, 1, 1, 2, {{1, 1, 1}, {2, 1, 2}}};
+        case VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM: return {3, 1, 1, 1, 3, {{1, 1, 1}, {1, 1, 1}, {1, 1, 1}}};
+        case VK_FORMAT_R10X6_UNORM_PACK16: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R10X6G10X6_UNORM_2PACK16: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16: return {8, 2, 1, 1, 0, {}};
+        case VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16: return {8, 2, 1, 1, 0, {}};
+        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16: return {6, 1, 1, 1, 3, {{1, 1, 2}, {2, 2, 2}, {2, 2, 2}}};
+        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16: return {6, 1, 1, 1, 2, {{1, 1, 2}, {2, 2, 4}}};
+        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16: return {6, 1, 1, 1, 3, {{1, 1, 2}, {2, 1, 2}, {2, 1, 2}}};
+        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16: return {6, 1, 1, 1, 2, {{1, 1, 2}, {2, 1, 4}}};
+        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16: return {6, 1, 1, 1, 3, {{1, 1, 2}, {1, 1, 2}, {1, 1, 2}}};
+        case VK_FORMAT_R12X4_UNORM_PACK16: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R12X4G12X4_UNORM_2PACK16: return {4, 1, 1, 1, 0, {}};
+        case VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16: return {8, 1, 1, 1, 0, {}};
+        case VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16: return {8, 2, 1, 1, 0, {}};
+        case VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16: return {8, 2, 1, 1, 0, {}};
+        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16: return {6, 1, 1, 1, 3, {{1, 1, 2}, {2, 2, 2}, {2, 2, 2}}};
+        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16: return {6, 1, 1, 1, 2, {{1, 1, 2}, {2, 2, 4}}};
+        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16: return {6, 1, 1, 1, 3, {{1, 1, 2}, {2, 1, 2}, {2, 1, 2}}};
+        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16: return {6, 1, 1, 1, 2, {{1, 1, 2}, {2, 1, 4}}};
+        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16: return {6, 1, 1, 1, 3, {{1, 1, 2}, {1, 1, 2}, {1, 1, 2}}};
+        case VK_FORMAT_G16B16G16R16_422_UNORM: return {8, 2, 1, 1, 0, {}};
+        case VK_FORMAT_B16G16R16G16_422_UNORM: return {8, 2, 1, 1, 0, {}};
+        case VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM: return {6, 1, 1, 1, 3, {{1, 1, 2}, {2, 2, 2}, {2, 2, 2}}};
+        case VK_FORMAT_G16_B16R16_2PLANE_420_UNORM: return {6, 1, 1, 1, 2, {{1, 1, 2}, {2, 2, 4}}};
+        case VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM: return {6, 1, 1, 1, 3, {{1, 1, 2}, {2, 1, 2}, {2, 1, 2}}};
+        case VK_FORMAT_G16_B16R16_2PLANE_422_UNORM: return {6, 1, 1, 1, 2, {{1, 1, 2}, {2, 1, 4}}};
+        case VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM: return {6, 1, 1, 1, 3, {{1, 1, 2}, {1, 1, 2}, {1, 1, 2}}};
+        case VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG: return {8, 8, 4, 1, 0, {}};
+        case VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG: return {8, 8, 4, 1, 0, {}};
+        case VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG: return {8, 8, 4, 1, 0, {}};
+        case VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG: return {8, 8, 4, 1, 0, {}};
+        case VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG: return {8, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK_EXT: return {16, 4, 4, 1, 0, {}};
+        case VK_FORMAT_ASTC_5x4_SFLOAT_BLOCK_EXT: return {16, 5, 4, 1, 0, {}};
+        case VK_FORMAT_ASTC_5x5_SFLOAT_BLOCK_EXT: return {16, 5, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_6x5_SFLOAT_BLOCK_EXT: return {16, 6, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_6x6_SFLOAT_BLOCK_EXT: return {16, 6, 6, 1, 0, {}};
+        case VK_FORMAT_ASTC_8x5_SFLOAT_BLOCK_EXT: return {16, 8, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_8x6_SFLOAT_BLOCK_EXT: return {16, 8, 6, 1, 0, {}};
+        case VK_FORMAT_ASTC_8x8_SFLOAT_BLOCK_EXT: return {16, 8, 8, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x5_SFLOAT_BLOCK_EXT: return {16, 10, 5, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x6_SFLOAT_BLOCK_EXT: return {16, 10, 6, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x8_SFLOAT_BLOCK_EXT: return {16, 10, 8, 1, 0, {}};
+        case VK_FORMAT_ASTC_10x10_SFLOAT_BLOCK_EXT: return {16, 10, 10, 1, 0, {}};
+        case VK_FORMAT_ASTC_12x10_SFLOAT_BLOCK_EXT: return {16, 12, 10, 1, 0, {}};
+        case VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK_EXT: return {16, 12, 12, 1, 0, {}};
+        case VK_FORMAT_G8_B8R8_2PLANE_444_UNORM_EXT: return {3, 1, 1, 1, 2, {{1, 1, 1}, {1, 1, 2}}};
+        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16_EXT: return {6, 1, 1, 1, 2, {{1, 1, 2}, {1, 1, 4}}};
+        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16_EXT: return {6, 1, 1, 1, 2, {{1, 1, 2}, {1, 1, 4}}};
+        case VK_FORMAT_G16_B16R16_2PLANE_444_UNORM_EXT: return {6, 1, 1, 1, 2, {{1, 1, 2}, {1, 1, 4}}};
+        case VK_FORMAT_A4R4G4B4_UNORM_PACK16_EXT: return {2, 1, 1, 1, 0, {}};
+        case VK_FORMAT_A4B4G4R4_UNORM_PACK16_EXT: return {2, 1, 1, 1, 0, {}};
+        default: return {};
+    }
+}
 
 
 static VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(
@@ -3295,604 +3564,1681 @@ static VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(
     uint32_t                                    pipelineStackSize);
 
 
-// Map of all APIs to be intercepted by this layer
-static const std::unordered_map<std::string, void*> name_to_funcptr_map = {
-    {"vkCreateInstance", (void*)CreateInstance},
-    {"vkDestroyInstance", (void*)DestroyInstance},
-    {"vkEnumeratePhysicalDevices", (void*)EnumeratePhysicalDevices},
-    {"vkGetPhysicalDeviceFeatures", (void*)GetPhysicalDeviceFeatures},
-    {"vkGetPhysicalDeviceFormatProperties", (void*)GetPhysicalDeviceFormatProperties},
-    {"vkGetPhysicalDeviceImageFormatProperties", (void*)GetPhysicalDeviceImageFormatProperties},
-    {"vkGetPhysicalDeviceProperties", (void*)GetPhysicalDeviceProperties},
-    {"vkGetPhysicalDeviceQueueFamilyProperties", (void*)GetPhysicalDeviceQueueFamilyProperties},
-    {"vkGetPhysicalDeviceMemoryProperties", (void*)GetPhysicalDeviceMemoryProperties},
-    {"vkGetInstanceProcAddr", (void*)GetInstanceProcAddr},
-    {"vkGetDeviceProcAddr", (void*)GetDeviceProcAddr},
-    {"vkCreateDevice", (void*)CreateDevice},
-    {"vkDestroyDevice", (void*)DestroyDevice},
-    {"vkEnumerateInstanceExtensionProperties", (void*)EnumerateInstanceExtensionProperties},
-    {"vkEnumerateDeviceExtensionProperties", (void*)EnumerateDeviceExtensionProperties},
-    {"vkEnumerateInstanceLayerProperties", (void*)EnumerateInstanceLayerProperties},
-    {"vkEnumerateDeviceLayerProperties", (void*)EnumerateDeviceLayerProperties},
-    {"vkGetDeviceQueue", (void*)GetDeviceQueue},
-    {"vkQueueSubmit", (void*)QueueSubmit},
-    {"vkQueueWaitIdle", (void*)QueueWaitIdle},
-    {"vkDeviceWaitIdle", (void*)DeviceWaitIdle},
-    {"vkAllocateMemory", (void*)AllocateMemory},
-    {"vkFreeMemory", (void*)FreeMemory},
-    {"vkMapMemory", (void*)MapMemory},
-    {"vkUnmapMemory", (void*)UnmapMemory},
-    {"vkFlushMappedMemoryRanges", (void*)FlushMappedMemoryRanges},
-    {"vkInvalidateMappedMemoryRanges", (void*)InvalidateMappedMemoryRanges},
-    {"vkGetDeviceMemoryCommitment", (void*)GetDeviceMemoryCommitment},
-    {"vkBindBufferMemory", (void*)BindBufferMemory},
-    {"vkBindImageMemory", (void*)BindImageMemory},
-    {"vkGetBufferMemoryRequirements", (void*)GetBufferMemoryRequirements},
-    {"vkGetImageMemoryRequirements", (void*)GetImageMemoryRequirements},
-    {"vkGetImageSparseMemoryRequirements", (void*)GetImageSparseMemoryRequirements},
-    {"vkGetPhysicalDeviceSparseImageFormatProperties", (void*)GetPhysicalDeviceSparseImageFormatProperties},
-    {"vkQueueBindSparse", (void*)QueueBindSparse},
-    {"vkCreateFence", (void*)CreateFence},
-    {"vkDestroyFence", (void*)DestroyFence},
-    {"vkResetFences", (void*)ResetFences},
-    {"vkGetFenceStatus", (void*)GetFenceStatus},
-    {"vkWaitForFences", (void*)WaitForFences},
-    {"vkCreateSemaphore", (void*)CreateSemaphore},
-    {"vkDestroySemaphore", (void*)DestroySemaphore},
-    {"vkCreateEvent", (void*)CreateEvent},
-    {"vkDestroyEvent", (void*)DestroyEvent},
-    {"vkGetEventStatus", (void*)GetEventStatus},
-    {"vkSetEvent", (void*)SetEvent},
-    {"vkResetEvent", (void*)ResetEvent},
-    {"vkCreateQueryPool", (void*)CreateQueryPool},
-    {"vkDestroyQueryPool", (void*)DestroyQueryPool},
-    {"vkGetQueryPoolResults", (void*)GetQueryPoolResults},
-    {"vkCreateBuffer", (void*)CreateBuffer},
-    {"vkDestroyBuffer", (void*)DestroyBuffer},
-    {"vkCreateBufferView", (void*)CreateBufferView},
-    {"vkDestroyBufferView", (void*)DestroyBufferView},
-    {"vkCreateImage", (void*)CreateImage},
-    {"vkDestroyImage", (void*)DestroyImage},
-    {"vkGetImageSubresourceLayout", (void*)GetImageSubresourceLayout},
-    {"vkCreateImageView", (void*)CreateImageView},
-    {"vkDestroyImageView", (void*)DestroyImageView},
-    {"vkCreateShaderModule", (void*)CreateShaderModule},
-    {"vkDestroyShaderModule", (void*)DestroyShaderModule},
-    {"vkCreatePipelineCache", (void*)CreatePipelineCache},
-    {"vkDestroyPipelineCache", (void*)DestroyPipelineCache},
-    {"vkGetPipelineCacheData", (void*)GetPipelineCacheData},
-    {"vkMergePipelineCaches", (void*)MergePipelineCaches},
-    {"vkCreateGraphicsPipelines", (void*)CreateGraphicsPipelines},
-    {"vkCreateComputePipelines", (void*)CreateComputePipelines},
-    {"vkDestroyPipeline", (void*)DestroyPipeline},
-    {"vkCreatePipelineLayout", (void*)CreatePipelineLayout},
-    {"vkDestroyPipelineLayout", (void*)DestroyPipelineLayout},
-    {"vkCreateSampler", (void*)CreateSampler},
-    {"vkDestroySampler", (void*)DestroySampler},
-    {"vkCreateDescriptorSetLayout", (void*)CreateDescriptorSetLayout},
-    {"vkDestroyDescriptorSetLayout", (void*)DestroyDescriptorSetLayout},
-    {"vkCreateDescriptorPool", (void*)CreateDescriptorPool},
-    {"vkDestroyDescriptorPool", (void*)DestroyDescriptorPool},
-    {"vkResetDescriptorPool", (void*)ResetDescriptorPool},
-    {"vkAllocateDescriptorSets", (void*)AllocateDescriptorSets},
-    {"vkFreeDescriptorSets", (void*)FreeDescriptorSets},
-    {"vkUpdateDescriptorSets", (void*)UpdateDescriptorSets},
-    {"vkCreateFramebuffer", (void*)CreateFramebuffer},
-    {"vkDestroyFramebuffer", (void*)DestroyFramebuffer},
-    {"vkCreateRenderPass", (void*)CreateRenderPass},
-    {"vkDestroyRenderPass", (void*)DestroyRenderPass},
-    {"vkGetRenderAreaGranularity", (void*)GetRenderAreaGranularity},
-    {"vkCreateCommandPool", (void*)CreateCommandPool},
-    {"vkDestroyCommandPool", (void*)DestroyCommandPool},
-    {"vkResetCommandPool", (void*)ResetCommandPool},
-    {"vkAllocateCommandBuffers", (void*)AllocateCommandBuffers},
-    {"vkFreeCommandBuffers", (void*)FreeCommandBuffers},
-    {"vkBeginCommandBuffer", (void*)BeginCommandBuffer},
-    {"vkEndCommandBuffer", (void*)EndCommandBuffer},
-    {"vkResetCommandBuffer", (void*)ResetCommandBuffer},
-    {"vkCmdBindPipeline", (void*)CmdBindPipeline},
-    {"vkCmdSetViewport", (void*)CmdSetViewport},
-    {"vkCmdSetScissor", (void*)CmdSetScissor},
-    {"vkCmdSetLineWidth", (void*)CmdSetLineWidth},
-    {"vkCmdSetDepthBias", (void*)CmdSetDepthBias},
-    {"vkCmdSetBlendConstants", (void*)CmdSetBlendConstants},
-    {"vkCmdSetDepthBounds", (void*)CmdSetDepthBounds},
-    {"vkCmdSetStencilCompareMask", (void*)CmdSetStencilCompareMask},
-    {"vkCmdSetStencilWriteMask", (void*)CmdSetStencilWriteMask},
-    {"vkCmdSetStencilReference", (void*)CmdSetStencilReference},
-    {"vkCmdBindDescriptorSets", (void*)CmdBindDescriptorSets},
-    {"vkCmdBindIndexBuffer", (void*)CmdBindIndexBuffer},
-    {"vkCmdBindVertexBuffers", (void*)CmdBindVertexBuffers},
-    {"vkCmdDraw", (void*)CmdDraw},
-    {"vkCmdDrawIndexed", (void*)CmdDrawIndexed},
-    {"vkCmdDrawIndirect", (void*)CmdDrawIndirect},
-    {"vkCmdDrawIndexedIndirect", (void*)CmdDrawIndexedIndirect},
-    {"vkCmdDispatch", (void*)CmdDispatch},
-    {"vkCmdDispatchIndirect", (void*)CmdDispatchIndirect},
-    {"vkCmdCopyBuffer", (void*)CmdCopyBuffer},
-    {"vkCmdCopyImage", (void*)CmdCopyImage},
-    {"vkCmdBlitImage", (void*)CmdBlitImage},
-    {"vkCmdCopyBufferToImage", (void*)CmdCopyBufferToImage},
-    {"vkCmdCopyImageToBuffer", (void*)CmdCopyImageToBuffer},
-    {"vkCmdUpdateBuffer", (void*)CmdUpdateBuffer},
-    {"vkCmdFillBuffer", (void*)CmdFillBuffer},
-    {"vkCmdClearColorImage", (void*)CmdClearColorImage},
-    {"vkCmdClearDepthStencilImage", (void*)CmdClearDepthStencilImage},
-    {"vkCmdClearAttachments", (void*)CmdClearAttachments},
-    {"vkCmdResolveImage", (void*)CmdResolveImage},
-    {"vkCmdSetEvent", (void*)CmdSetEvent},
-    {"vkCmdResetEvent", (void*)CmdResetEvent},
-    {"vkCmdWaitEvents", (void*)CmdWaitEvents},
-    {"vkCmdPipelineBarrier", (void*)CmdPipelineBarrier},
-    {"vkCmdBeginQuery", (void*)CmdBeginQuery},
-    {"vkCmdEndQuery", (void*)CmdEndQuery},
-    {"vkCmdResetQueryPool", (void*)CmdResetQueryPool},
-    {"vkCmdWriteTimestamp", (void*)CmdWriteTimestamp},
-    {"vkCmdCopyQueryPoolResults", (void*)CmdCopyQueryPoolResults},
-    {"vkCmdPushConstants", (void*)CmdPushConstants},
-    {"vkCmdBeginRenderPass", (void*)CmdBeginRenderPass},
-    {"vkCmdNextSubpass", (void*)CmdNextSubpass},
-    {"vkCmdEndRenderPass", (void*)CmdEndRenderPass},
-    {"vkCmdExecuteCommands", (void*)CmdExecuteCommands},
-    {"vkEnumerateInstanceVersion", (void*)EnumerateInstanceVersion},
-    {"vkBindBufferMemory2", (void*)BindBufferMemory2},
-    {"vkBindImageMemory2", (void*)BindImageMemory2},
-    {"vkGetDeviceGroupPeerMemoryFeatures", (void*)GetDeviceGroupPeerMemoryFeatures},
-    {"vkCmdSetDeviceMask", (void*)CmdSetDeviceMask},
-    {"vkCmdDispatchBase", (void*)CmdDispatchBase},
-    {"vkEnumeratePhysicalDeviceGroups", (void*)EnumeratePhysicalDeviceGroups},
-    {"vkGetImageMemoryRequirements2", (void*)GetImageMemoryRequirements2},
-    {"vkGetBufferMemoryRequirements2", (void*)GetBufferMemoryRequirements2},
-    {"vkGetImageSparseMemoryRequirements2", (void*)GetImageSparseMemoryRequirements2},
-    {"vkGetPhysicalDeviceFeatures2", (void*)GetPhysicalDeviceFeatures2},
-    {"vkGetPhysicalDeviceProperties2", (void*)GetPhysicalDeviceProperties2},
-    {"vkGetPhysicalDeviceFormatProperties2", (void*)GetPhysicalDeviceFormatProperties2},
-    {"vkGetPhysicalDeviceImageFormatProperties2", (void*)GetPhysicalDeviceImageFormatProperties2},
-    {"vkGetPhysicalDeviceQueueFamilyProperties2", (void*)GetPhysicalDeviceQueueFamilyProperties2},
-    {"vkGetPhysicalDeviceMemoryProperties2", (void*)GetPhysicalDeviceMemoryProperties2},
-    {"vkGetPhysicalDeviceSparseImageFormatProperties2", (void*)GetPhysicalDeviceSparseImageFormatProperties2},
-    {"vkTrimCommandPool", (void*)TrimCommandPool},
-    {"vkGetDeviceQueue2", (void*)GetDeviceQueue2},
-    {"vkCreateSamplerYcbcrConversion", (void*)CreateSamplerYcbcrConversion},
-    {"vkDestroySamplerYcbcrConversion", (void*)DestroySamplerYcbcrConversion},
-    {"vkCreateDescriptorUpdateTemplate", (void*)CreateDescriptorUpdateTemplate},
-    {"vkDestroyDescriptorUpdateTemplate", (void*)DestroyDescriptorUpdateTemplate},
-    {"vkUpdateDescriptorSetWithTemplate", (void*)UpdateDescriptorSetWithTemplate},
-    {"vkGetPhysicalDeviceExternalBufferProperties", (void*)GetPhysicalDeviceExternalBufferProperties},
-    {"vkGetPhysicalDeviceExternalFenceProperties", (void*)GetPhysicalDeviceExternalFenceProperties},
-    {"vkGetPhysicalDeviceExternalSemaphoreProperties", (void*)GetPhysicalDeviceExternalSemaphoreProperties},
-    {"vkGetDescriptorSetLayoutSupport", (void*)GetDescriptorSetLayoutSupport},
-    {"vkCmdDrawIndirectCount", (void*)CmdDrawIndirectCount},
-    {"vkCmdDrawIndexedIndirectCount", (void*)CmdDrawIndexedIndirectCount},
-    {"vkCreateRenderPass2", (void*)CreateRenderPass2},
-    {"vkCmdBeginRenderPass2", (void*)CmdBeginRenderPass2},
-    {"vkCmdNextSubpass2", (void*)CmdNextSubpass2},
-    {"vkCmdEndRenderPass2", (void*)CmdEndRenderPass2},
-    {"vkResetQueryPool", (void*)ResetQueryPool},
-    {"vkGetSemaphoreCounterValue", (void*)GetSemaphoreCounterValue},
-    {"vkWaitSemaphores", (void*)WaitSemaphores},
-    {"vkSignalSemaphore", (void*)SignalSemaphore},
-    {"vkGetBufferDeviceAddress", (void*)GetBufferDeviceAddress},
-    {"vkGetBufferOpaqueCaptureAddress", (void*)GetBufferOpaqueCaptureAddress},
-    {"vkGetDeviceMemoryOpaqueCaptureAddress", (void*)GetDeviceMemoryOpaqueCaptureAddress},
-    {"vkDestroySurfaceKHR", (void*)DestroySurfaceKHR},
-    {"vkGetPhysicalDeviceSurfaceSupportKHR", (void*)GetPhysicalDeviceSurfaceSupportKHR},
-    {"vkGetPhysicalDeviceSurfaceCapabilitiesKHR", (void*)GetPhysicalDeviceSurfaceCapabilitiesKHR},
-    {"vkGetPhysicalDeviceSurfaceFormatsKHR", (void*)GetPhysicalDeviceSurfaceFormatsKHR},
-    {"vkGetPhysicalDeviceSurfacePresentModesKHR", (void*)GetPhysicalDeviceSurfacePresentModesKHR},
-    {"vkCreateSwapchainKHR", (void*)CreateSwapchainKHR},
-    {"vkDestroySwapchainKHR", (void*)DestroySwapchainKHR},
-    {"vkGetSwapchainImagesKHR", (void*)GetSwapchainImagesKHR},
-    {"vkAcquireNextImageKHR", (void*)AcquireNextImageKHR},
-    {"vkQueuePresentKHR", (void*)QueuePresentKHR},
-    {"vkGetDeviceGroupPresentCapabilitiesKHR", (void*)GetDeviceGroupPresentCapabilitiesKHR},
-    {"vkGetDeviceGroupSurfacePresentModesKHR", (void*)GetDeviceGroupSurfacePresentModesKHR},
-    {"vkGetPhysicalDevicePresentRectanglesKHR", (void*)GetPhysicalDevicePresentRectanglesKHR},
-    {"vkAcquireNextImage2KHR", (void*)AcquireNextImage2KHR},
-    {"vkGetPhysicalDeviceDisplayPropertiesKHR", (void*)GetPhysicalDeviceDisplayPropertiesKHR},
-    {"vkGetPhysicalDeviceDisplayPlanePropertiesKHR", (void*)GetPhysicalDeviceDisplayPlanePropertiesKHR},
-    {"vkGetDisplayPlaneSupportedDisplaysKHR", (void*)GetDisplayPlaneSupportedDisplaysKHR},
-    {"vkGetDisplayModePropertiesKHR", (void*)GetDisplayModePropertiesKHR},
-    {"vkCreateDisplayModeKHR", (void*)CreateDisplayModeKHR},
-    {"vkGetDisplayPlaneCapabilitiesKHR", (void*)GetDisplayPlaneCapabilitiesKHR},
-    {"vkCreateDisplayPlaneSurfaceKHR", (void*)CreateDisplayPlaneSurfaceKHR},
-    {"vkCreateSharedSwapchainsKHR", (void*)CreateSharedSwapchainsKHR},
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-    {"vkCreateXlibSurfaceKHR", (void*)CreateXlibSurfaceKHR},
-#endif
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-    {"vkGetPhysicalDeviceXlibPresentationSupportKHR", (void*)GetPhysicalDeviceXlibPresentationSupportKHR},
-#endif
-#ifdef VK_USE_PLATFORM_XCB_KHR
-    {"vkCreateXcbSurfaceKHR", (void*)CreateXcbSurfaceKHR},
-#endif
-#ifdef VK_USE_PLATFORM_XCB_KHR
-    {"vkGetPhysicalDeviceXcbPresentationSupportKHR", (void*)GetPhysicalDeviceXcbPresentationSupportKHR},
-#endif
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    {"vkCreateWaylandSurfaceKHR", (void*)CreateWaylandSurfaceKHR},
-#endif
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    {"vkGetPhysicalDeviceWaylandPresentationSupportKHR", (void*)GetPhysicalDeviceWaylandPresentationSupportKHR},
-#endif
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-    {"vkCreateAndroidSurfaceKHR", (void*)CreateAndroidSurfaceKHR},
-#endif
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkCreateWin32SurfaceKHR", (void*)CreateWin32SurfaceKHR},
-#endif
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkGetPhysicalDeviceWin32PresentationSupportKHR", (void*)GetPhysicalDeviceWin32PresentationSupportKHR},
-#endif
+// Opcode of each command recorded into a command buffer, see RecordCommand()
+enum class CmdOpcode : uint32_t {
+    BindPipeline,
+    SetViewport,
+    SetScissor,
+    SetLineWidth,
+    SetDepthBias,
+    SetBlendConstants,
+    SetDepthBounds,
+    SetStencilCompareMask,
+    SetStencilWriteMask,
+    SetStencilReference,
+    BindDescriptorSets,
+    BindIndexBuffer,
+    BindVertexBuffers,
+    Draw,
+    DrawIndexed,
+    DrawIndirect,
+    DrawIndexedIndirect,
+    Dispatch,
+    DispatchIndirect,
+    CopyBuffer,
+    CopyImage,
+    BlitImage,
+    CopyBufferToImage,
+    CopyImageToBuffer,
+    UpdateBuffer,
+    FillBuffer,
+    ClearColorImage,
+    ClearDepthStencilImage,
+    ClearAttachments,
+    ResolveImage,
+    SetEvent,
+    ResetEvent,
+    WaitEvents,
+    PipelineBarrier,
+    BeginQuery,
+    EndQuery,
+    ResetQueryPool,
+    WriteTimestamp,
+    CopyQueryPoolResults,
+    PushConstants,
+    BeginRenderPass,
+    NextSubpass,
+    EndRenderPass,
+    ExecuteCommands,
+    SetDeviceMask,
+    DispatchBase,
+    DrawIndirectCount,
+    DrawIndexedIndirectCount,
+    BeginRenderPass2,
+    NextSubpass2,
+    EndRenderPass2,
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkGetPhysicalDeviceVideoCapabilitiesKHR", (void*)GetPhysicalDeviceVideoCapabilitiesKHR},
+    BeginVideoCodingKHR,
 #endif
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkGetPhysicalDeviceVideoFormatPropertiesKHR", (void*)GetPhysicalDeviceVideoFormatPropertiesKHR},
+    EndVideoCodingKHR,
 #endif
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkCreateVideoSessionKHR", (void*)CreateVideoSessionKHR},
+    ControlVideoCodingKHR,
 #endif
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkDestroyVideoSessionKHR", (void*)DestroyVideoSessionKHR},
+    DecodeVideoKHR,
 #endif
+    PushDescriptorSetKHR,
+    PushDescriptorSetWithTemplateKHR,
+    SetFragmentShadingRateKHR,
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkGetVideoSessionMemoryRequirementsKHR", (void*)GetVideoSessionMemoryRequirementsKHR},
+    EncodeVideoKHR,
 #endif
+    SetEvent2KHR,
+    ResetEvent2KHR,
+    WaitEvents2KHR,
+    PipelineBarrier2KHR,
+    WriteTimestamp2KHR,
+    WriteBufferMarker2AMD,
+    CopyBuffer2KHR,
+    CopyImage2KHR,
+    CopyBufferToImage2KHR,
+    CopyImageToBuffer2KHR,
+    BlitImage2KHR,
+    ResolveImage2KHR,
+    DebugMarkerBeginEXT,
+    DebugMarkerEndEXT,
+    DebugMarkerInsertEXT,
+    BindTransformFeedbackBuffersEXT,
+    BeginTransformFeedbackEXT,
+    EndTransformFeedbackEXT,
+    BeginQueryIndexedEXT,
+    EndQueryIndexedEXT,
+    DrawIndirectByteCountEXT,
+    CuLaunchKernelNVX,
+    BeginConditionalRenderingEXT,
+    EndConditionalRenderingEXT,
+    SetViewportWScalingNV,
+    SetDiscardRectangleEXT,
+    BeginDebugUtilsLabelEXT,
+    EndDebugUtilsLabelEXT,
+    InsertDebugUtilsLabelEXT,
+    SetSampleLocationsEXT,
+    BindShadingRateImageNV,
+    SetViewportShadingRatePaletteNV,
+    SetCoarseSampleOrderNV,
+    BuildAccelerationStructureNV,
+    CopyAccelerationStructureNV,
+    TraceRaysNV,
+    WriteAccelerationStructuresPropertiesNV,
+    WriteBufferMarkerAMD,
+    DrawMeshTasksNV,
+    DrawMeshTasksIndirectNV,
+    DrawMeshTasksIndirectCountNV,
+    SetExclusiveScissorNV,
+    SetCheckpointNV,
+    SetPerformanceMarkerINTEL,
+    SetPerformanceStreamMarkerINTEL,
+    SetPerformanceOverrideINTEL,
+    SetLineStippleEXT,
+    SetCullModeEXT,
+    SetFrontFaceEXT,
+    SetPrimitiveTopologyEXT,
+    SetViewportWithCountEXT,
+    SetScissorWithCountEXT,
+    BindVertexBuffers2EXT,
+    SetDepthTestEnableEXT,
+    SetDepthWriteEnableEXT,
+    SetDepthCompareOpEXT,
+    SetDepthBoundsTestEnableEXT,
+    SetStencilTestEnableEXT,
+    SetStencilOpEXT,
+    PreprocessGeneratedCommandsNV,
+    ExecuteGeneratedCommandsNV,
+    BindPipelineShaderGroupNV,
+    SetFragmentShadingRateEnumNV,
+    SetVertexInputEXT,
+    SetPatchControlPointsEXT,
+    SetRasterizerDiscardEnableEXT,
+    SetDepthBiasEnableEXT,
+    SetLogicOpEXT,
+    SetPrimitiveRestartEnableEXT,
+    BuildAccelerationStructuresKHR,
+    BuildAccelerationStructuresIndirectKHR,
+    CopyAccelerationStructureKHR,
+    CopyAccelerationStructureToMemoryKHR,
+    CopyMemoryToAccelerationStructureKHR,
+    WriteAccelerationStructuresPropertiesKHR,
+    TraceRaysKHR,
+    TraceRaysIndirectKHR,
+    SetRayTracingPipelineStackSizeKHR,
+};
+
+// Arguments of each recorded command, stored right after its CommandHeader. What the arguments point to is copied in
+// after the struct, see RECORD_FOLLOWED_STRUCTS in the generator. Pointers to structs that aren't followed are
+// recorded as null, and opaque pointers the mock can't know the size of (e.g. pCheckpointMarker) as they are.
+struct CmdBindPipelineArgs {
+    VkPipelineBindPoint                         pipelineBindPoint;
+    VkPipeline                                  pipeline;
+};
+
+struct CmdSetViewportArgs {
+    uint32_t                                    firstViewport;
+    uint32_t                                    viewportCount;
+    const VkViewport*                           pViewports;
+};
+
+struct CmdSetScissorArgs {
+    uint32_t                                    firstScissor;
+    uint32_t                                    scissorCount;
+    const VkRect2D*                             pScissors;
+};
+
+struct CmdSetLineWidthArgs {
+    float                                       lineWidth;
+};
+
+struct CmdSetDepthBiasArgs {
+    float                                       depthBiasConstantFactor;
+    float                                       depthBiasClamp;
+    float                                       depthBiasSlopeFactor;
+};
+
+struct CmdSetBlendConstantsArgs {
+    float                                       blendConstants[4];
+};
+
+struct CmdSetDepthBoundsArgs {
+    float                                       minDepthBounds;
+    float                                       maxDepthBounds;
+};
+
+struct CmdSetStencilCompareMaskArgs {
+    VkStencilFaceFlags                          faceMask;
+    uint32_t                                    compareMask;
+};
+
+struct CmdSetStencilWriteMaskArgs {
+    VkStencilFaceFlags                          faceMask;
+    uint32_t                                    writeMask;
+};
+
+struct CmdSetStencilReferenceArgs {
+    VkStencilFaceFlags                          faceMask;
+    uint32_t                                    reference;
+};
+
+struct CmdBindDescriptorSetsArgs {
+    VkPipelineBindPoint                         pipelineBindPoint;
+    VkPipelineLayout                            layout;
+    uint32_t                                    firstSet;
+    uint32_t                                    descriptorSetCount;
+    const VkDescriptorSet*                      pDescriptorSets;
+    uint32_t                                    dynamicOffsetCount;
+    const uint32_t*                             pDynamicOffsets;
+};
+
+struct CmdBindIndexBufferArgs {
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkIndexType                                 indexType;
+};
+
+struct CmdBindVertexBuffersArgs {
+    uint32_t                                    firstBinding;
+    uint32_t                                    bindingCount;
+    const VkBuffer*                             pBuffers;
+    const VkDeviceSize*                         pOffsets;
+};
+
+struct CmdDrawArgs {
+    uint32_t                                    vertexCount;
+    uint32_t                                    instanceCount;
+    uint32_t                                    firstVertex;
+    uint32_t                                    firstInstance;
+};
+
+struct CmdDrawIndexedArgs {
+    uint32_t                                    indexCount;
+    uint32_t                                    instanceCount;
+    uint32_t                                    firstIndex;
+    int32_t                                     vertexOffset;
+    uint32_t                                    firstInstance;
+};
+
+struct CmdDrawIndirectArgs {
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    uint32_t                                    drawCount;
+    uint32_t                                    stride;
+};
+
+struct CmdDrawIndexedIndirectArgs {
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    uint32_t                                    drawCount;
+    uint32_t                                    stride;
+};
+
+struct CmdDispatchArgs {
+    uint32_t                                    groupCountX;
+    uint32_t                                    groupCountY;
+    uint32_t                                    groupCountZ;
+};
+
+struct CmdDispatchIndirectArgs {
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+};
+
+struct CmdCopyBufferArgs {
+    VkBuffer                                    srcBuffer;
+    VkBuffer                                    dstBuffer;
+    uint32_t                                    regionCount;
+    const VkBufferCopy*                         pRegions;
+};
+
+struct CmdCopyImageArgs {
+    VkImage                                     srcImage;
+    VkImageLayout                               srcImageLayout;
+    VkImage                                     dstImage;
+    VkImageLayout                               dstImageLayout;
+    uint32_t                                    regionCount;
+    const VkImageCopy*                          pRegions;
+};
+
+struct CmdBlitImageArgs {
+    VkImage                                     srcImage;
+    VkImageLayout                               srcImageLayout;
+    VkImage                                     dstImage;
+    VkImageLayout                               dstImageLayout;
+    uint32_t                                    regionCount;
+    const VkImageBlit*                          pRegions;
+    VkFilter                                    filter;
+};
+
+struct CmdCopyBufferToImageArgs {
+    VkBuffer                                    srcBuffer;
+    VkImage                                     dstImage;
+    VkImageLayout                               dstImageLayout;
+    uint32_t                                    regionCount;
+    const VkBufferImageCopy*                    pRegions;
+};
+
+struct CmdCopyImageToBufferArgs {
+    VkImage                                     srcImage;
+    VkImageLayout                               srcImageLayout;
+    VkBuffer                                    dstBuffer;
+    uint32_t                                    regionCount;
+    const VkBufferImageCopy*                    pRegions;
+};
+
+struct CmdUpdateBufferArgs {
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    VkDeviceSize                                dataSize;
+    const void*                                 pData;
+};
+
+struct CmdFillBufferArgs {
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    VkDeviceSize                                size;
+    uint32_t                                    data;
+};
+
+struct CmdClearColorImageArgs {
+    VkImage                                     image;
+    VkImageLayout                               imageLayout;
+    const VkClearColorValue*                    pColor;
+    uint32_t                                    rangeCount;
+    const VkImageSubresourceRange*              pRanges;
+};
+
+struct CmdClearDepthStencilImageArgs {
+    VkImage                                     image;
+    VkImageLayout                               imageLayout;
+    const VkClearDepthStencilValue*             pDepthStencil;
+    uint32_t                                    rangeCount;
+    const VkImageSubresourceRange*              pRanges;
+};
+
+struct CmdClearAttachmentsArgs {
+    uint32_t                                    attachmentCount;
+    const VkClearAttachment*                    pAttachments;
+    uint32_t                                    rectCount;
+    const VkClearRect*                          pRects;
+};
+
+struct CmdResolveImageArgs {
+    VkImage                                     srcImage;
+    VkImageLayout                               srcImageLayout;
+    VkImage                                     dstImage;
+    VkImageLayout                               dstImageLayout;
+    uint32_t                                    regionCount;
+    const VkImageResolve*                       pRegions;
+};
+
+struct CmdSetEventArgs {
+    VkEvent                                     event;
+    VkPipelineStageFlags                        stageMask;
+};
+
+struct CmdResetEventArgs {
+    VkEvent                                     event;
+    VkPipelineStageFlags                        stageMask;
+};
+
+struct CmdWaitEventsArgs {
+    uint32_t                                    eventCount;
+    const VkEvent*                              pEvents;
+    VkPipelineStageFlags                        srcStageMask;
+    VkPipelineStageFlags                        dstStageMask;
+    uint32_t                                    memoryBarrierCount;
+    const VkMemoryBarrier*                      pMemoryBarriers;
+    uint32_t                                    bufferMemoryBarrierCount;
+    const VkBufferMemoryBarrier*                pBufferMemoryBarriers;
+    uint32_t                                    imageMemoryBarrierCount;
+    const VkImageMemoryBarrier*                 pImageMemoryBarriers;
+};
+
+struct CmdPipelineBarrierArgs {
+    VkPipelineStageFlags                        srcStageMask;
+    VkPipelineStageFlags                        dstStageMask;
+    VkDependencyFlags                           dependencyFlags;
+    uint32_t                                    memoryBarrierCount;
+    const VkMemoryBarrier*                      pMemoryBarriers;
+    uint32_t                                    bufferMemoryBarrierCount;
+    const VkBufferMemoryBarrier*                pBufferMemoryBarriers;
+    uint32_t                                    imageMemoryBarrierCount;
+    const VkImageMemoryBarrier*                 pImageMemoryBarriers;
+};
+
+struct CmdBeginQueryArgs {
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+    VkQueryControlFlags                         flags;
+};
+
+struct CmdEndQueryArgs {
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+};
+
+struct CmdResetQueryPoolArgs {
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+    uint32_t                                    queryCount;
+};
+
+struct CmdWriteTimestampArgs {
+    VkPipelineStageFlagBits                     pipelineStage;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+};
+
+struct CmdCopyQueryPoolResultsArgs {
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+    uint32_t                                    queryCount;
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    VkDeviceSize                                stride;
+    VkQueryResultFlags                          flags;
+};
+
+struct CmdPushConstantsArgs {
+    VkPipelineLayout                            layout;
+    VkShaderStageFlags                          stageFlags;
+    uint32_t                                    offset;
+    uint32_t                                    size;
+    const void*                                 pValues;
+};
+
+struct CmdBeginRenderPassArgs {
+    const VkRenderPassBeginInfo*                pRenderPassBegin;
+    VkSubpassContents                           contents;
+};
+
+struct CmdNextSubpassArgs {
+    VkSubpassContents                           contents;
+};
+
+struct CmdExecuteCommandsArgs {
+    uint32_t                                    commandBufferCount;
+    const VkCommandBuffer*                      pCommandBuffers;
+};
+
+struct CmdSetDeviceMaskArgs {
+    uint32_t                                    deviceMask;
+};
+
+struct CmdDispatchBaseArgs {
+    uint32_t                                    baseGroupX;
+    uint32_t                                    baseGroupY;
+    uint32_t                                    baseGroupZ;
+    uint32_t                                    groupCountX;
+    uint32_t                                    groupCountY;
+    uint32_t                                    groupCountZ;
+};
+
+struct CmdDrawIndirectCountArgs {
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+struct CmdDrawIndexedIndirectCountArgs {
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+struct CmdBeginRenderPass2Args {
+    const VkRenderPassBeginInfo*                pRenderPassBegin;
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo;
+};
+
+struct CmdNextSubpass2Args {
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo;
+    const VkSubpassEndInfo*                     pSubpassEndInfo;
+};
+
+struct CmdEndRenderPass2Args {
+    const VkSubpassEndInfo*                     pSubpassEndInfo;
+};
+
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkBindVideoSessionMemoryKHR", (void*)BindVideoSessionMemoryKHR},
+struct CmdBeginVideoCodingKHRArgs {
+    const VkVideoBeginCodingInfoKHR*            pBeginInfo;
+};
 #endif
+
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkCreateVideoSessionParametersKHR", (void*)CreateVideoSessionParametersKHR},
+struct CmdEndVideoCodingKHRArgs {
+    const VkVideoEndCodingInfoKHR*              pEndCodingInfo;
+};
 #endif
+
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkUpdateVideoSessionParametersKHR", (void*)UpdateVideoSessionParametersKHR},
+struct CmdControlVideoCodingKHRArgs {
+    const VkVideoCodingControlInfoKHR*          pCodingControlInfo;
+};
 #endif
+
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkDestroyVideoSessionParametersKHR", (void*)DestroyVideoSessionParametersKHR},
+struct CmdDecodeVideoKHRArgs {
+    const VkVideoDecodeInfoKHR*                 pFrameInfo;
+};
 #endif
+
+struct CmdPushDescriptorSetKHRArgs {
+    VkPipelineBindPoint                         pipelineBindPoint;
+    VkPipelineLayout                            layout;
+    uint32_t                                    set;
+    uint32_t                                    descriptorWriteCount;
+    const VkWriteDescriptorSet*                 pDescriptorWrites;
+};
+
+struct CmdPushDescriptorSetWithTemplateKHRArgs {
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate;
+    VkPipelineLayout                            layout;
+    uint32_t                                    set;
+    const void*                                 pData;
+};
+
+struct CmdSetFragmentShadingRateKHRArgs {
+    const VkExtent2D*                           pFragmentSize;
+    VkFragmentShadingRateCombinerOpKHR          combinerOps[2];
+};
+
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkCmdBeginVideoCodingKHR", (void*)CmdBeginVideoCodingKHR},
+struct CmdEncodeVideoKHRArgs {
+    const VkVideoEncodeInfoKHR*                 pEncodeInfo;
+};
 #endif
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkCmdEndVideoCodingKHR", (void*)CmdEndVideoCodingKHR},
+
+struct CmdSetEvent2KHRArgs {
+    VkEvent                                     event;
+    const VkDependencyInfoKHR*                  pDependencyInfo;
+};
+
+struct CmdResetEvent2KHRArgs {
+    VkEvent                                     event;
+    VkPipelineStageFlags2KHR                    stageMask;
+};
+
+struct CmdWaitEvents2KHRArgs {
+    uint32_t                                    eventCount;
+    const VkEvent*                              pEvents;
+    const VkDependencyInfoKHR*                  pDependencyInfos;
+};
+
+struct CmdPipelineBarrier2KHRArgs {
+    const VkDependencyInfoKHR*                  pDependencyInfo;
+};
+
+struct CmdWriteTimestamp2KHRArgs {
+    VkPipelineStageFlags2KHR                    stage;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+};
+
+struct CmdWriteBufferMarker2AMDArgs {
+    VkPipelineStageFlags2KHR                    stage;
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    uint32_t                                    marker;
+};
+
+struct CmdCopyBuffer2KHRArgs {
+    const VkCopyBufferInfo2KHR*                 pCopyBufferInfo;
+};
+
+struct CmdCopyImage2KHRArgs {
+    const VkCopyImageInfo2KHR*                  pCopyImageInfo;
+};
+
+struct CmdCopyBufferToImage2KHRArgs {
+    const VkCopyBufferToImageInfo2KHR*          pCopyBufferToImageInfo;
+};
+
+struct CmdCopyImageToBuffer2KHRArgs {
+    const VkCopyImageToBufferInfo2KHR*          pCopyImageToBufferInfo;
+};
+
+struct CmdBlitImage2KHRArgs {
+    const VkBlitImageInfo2KHR*                  pBlitImageInfo;
+};
+
+struct CmdResolveImage2KHRArgs {
+    const VkResolveImageInfo2KHR*               pResolveImageInfo;
+};
+
+struct CmdDebugMarkerBeginEXTArgs {
+    const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo;
+};
+
+struct CmdDebugMarkerInsertEXTArgs {
+    const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo;
+};
+
+struct CmdBindTransformFeedbackBuffersEXTArgs {
+    uint32_t                                    firstBinding;
+    uint32_t                                    bindingCount;
+    const VkBuffer*                             pBuffers;
+    const VkDeviceSize*                         pOffsets;
+    const VkDeviceSize*                         pSizes;
+};
+
+struct CmdBeginTransformFeedbackEXTArgs {
+    uint32_t                                    firstCounterBuffer;
+    uint32_t                                    counterBufferCount;
+    const VkBuffer*                             pCounterBuffers;
+    const VkDeviceSize*                         pCounterBufferOffsets;
+};
+
+struct CmdEndTransformFeedbackEXTArgs {
+    uint32_t                                    firstCounterBuffer;
+    uint32_t                                    counterBufferCount;
+    const VkBuffer*                             pCounterBuffers;
+    const VkDeviceSize*                         pCounterBufferOffsets;
+};
+
+struct CmdBeginQueryIndexedEXTArgs {
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+    VkQueryControlFlags                         flags;
+    uint32_t                                    index;
+};
+
+struct CmdEndQueryIndexedEXTArgs {
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+    uint32_t                                    index;
+};
+
+struct CmdDrawIndirectByteCountEXTArgs {
+    uint32_t                                    instanceCount;
+    uint32_t                                    firstInstance;
+    VkBuffer                                    counterBuffer;
+    VkDeviceSize                                counterBufferOffset;
+    uint32_t                                    counterOffset;
+    uint32_t                                    vertexStride;
+};
+
+struct CmdCuLaunchKernelNVXArgs {
+    const VkCuLaunchInfoNVX*                    pLaunchInfo;
+};
+
+struct CmdBeginConditionalRenderingEXTArgs {
+    const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin;
+};
+
+struct CmdSetViewportWScalingNVArgs {
+    uint32_t                                    firstViewport;
+    uint32_t                                    viewportCount;
+    const VkViewportWScalingNV*                 pViewportWScalings;
+};
+
+struct CmdSetDiscardRectangleEXTArgs {
+    uint32_t                                    firstDiscardRectangle;
+    uint32_t                                    discardRectangleCount;
+    const VkRect2D*                             pDiscardRectangles;
+};
+
+struct CmdBeginDebugUtilsLabelEXTArgs {
+    const VkDebugUtilsLabelEXT*                 pLabelInfo;
+};
+
+struct CmdInsertDebugUtilsLabelEXTArgs {
+    const VkDebugUtilsLabelEXT*                 pLabelInfo;
+};
+
+struct CmdSetSampleLocationsEXTArgs {
+    const VkSampleLocationsInfoEXT*             pSampleLocationsInfo;
+};
+
+struct CmdBindShadingRateImageNVArgs {
+    VkImageView                                 imageView;
+    VkImageLayout                               imageLayout;
+};
+
+struct CmdSetViewportShadingRatePaletteNVArgs {
+    uint32_t                                    firstViewport;
+    uint32_t                                    viewportCount;
+    const VkShadingRatePaletteNV*               pShadingRatePalettes;
+};
+
+struct CmdSetCoarseSampleOrderNVArgs {
+    VkCoarseSampleOrderTypeNV                   sampleOrderType;
+    uint32_t                                    customSampleOrderCount;
+    const VkCoarseSampleOrderCustomNV*          pCustomSampleOrders;
+};
+
+struct CmdBuildAccelerationStructureNVArgs {
+    const VkAccelerationStructureInfoNV*        pInfo;
+    VkBuffer                                    instanceData;
+    VkDeviceSize                                instanceOffset;
+    VkBool32                                    update;
+    VkAccelerationStructureNV                   dst;
+    VkAccelerationStructureNV                   src;
+    VkBuffer                                    scratch;
+    VkDeviceSize                                scratchOffset;
+};
+
+struct CmdCopyAccelerationStructureNVArgs {
+    VkAccelerationStructureNV                   dst;
+    VkAccelerationStructureNV                   src;
+    VkCopyAccelerationStructureModeKHR          mode;
+};
+
+struct CmdTraceRaysNVArgs {
+    VkBuffer                                    raygenShaderBindingTableBuffer;
+    VkDeviceSize                                raygenShaderBindingOffset;
+    VkBuffer                                    missShaderBindingTableBuffer;
+    VkDeviceSize                                missShaderBindingOffset;
+    VkDeviceSize                                missShaderBindingStride;
+    VkBuffer                                    hitShaderBindingTableBuffer;
+    VkDeviceSize                                hitShaderBindingOffset;
+    VkDeviceSize                                hitShaderBindingStride;
+    VkBuffer                                    callableShaderBindingTableBuffer;
+    VkDeviceSize                                callableShaderBindingOffset;
+    VkDeviceSize                                callableShaderBindingStride;
+    uint32_t                                    width;
+    uint32_t                                    height;
+    uint32_t                                    depth;
+};
+
+struct CmdWriteAccelerationStructuresPropertiesNVArgs {
+    uint32_t                                    accelerationStructureCount;
+    const VkAccelerationStructureNV*            pAccelerationStructures;
+    VkQueryType                                 queryType;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+};
+
+struct CmdWriteBufferMarkerAMDArgs {
+    VkPipelineStageFlagBits                     pipelineStage;
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    uint32_t                                    marker;
+};
+
+struct CmdDrawMeshTasksNVArgs {
+    uint32_t                                    taskCount;
+    uint32_t                                    firstTask;
+};
+
+struct CmdDrawMeshTasksIndirectNVArgs {
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    uint32_t                                    drawCount;
+    uint32_t                                    stride;
+};
+
+struct CmdDrawMeshTasksIndirectCountNVArgs {
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+struct CmdSetExclusiveScissorNVArgs {
+    uint32_t                                    firstExclusiveScissor;
+    uint32_t                                    exclusiveScissorCount;
+    const VkRect2D*                             pExclusiveScissors;
+};
+
+struct CmdSetCheckpointNVArgs {
+    const void*                                 pCheckpointMarker;
+};
+
+struct CmdSetPerformanceMarkerINTELArgs {
+    const VkPerformanceMarkerInfoINTEL*         pMarkerInfo;
+};
+
+struct CmdSetPerformanceStreamMarkerINTELArgs {
+    const VkPerformanceStreamMarkerInfoINTEL*   pMarkerInfo;
+};
+
+struct CmdSetPerformanceOverrideINTELArgs {
+    const VkPerformanceOverrideInfoINTEL*       pOverrideInfo;
+};
+
+struct CmdSetLineStippleEXTArgs {
+    uint32_t                                    lineStippleFactor;
+    uint16_t                                    lineStipplePattern;
+};
+
+struct CmdSetCullModeEXTArgs {
+    VkCullModeFlags                             cullMode;
+};
+
+struct CmdSetFrontFaceEXTArgs {
+    VkFrontFace                                 frontFace;
+};
+
+struct CmdSetPrimitiveTopologyEXTArgs {
+    VkPrimitiveTopology                         primitiveTopology;
+};
+
+struct CmdSetViewportWithCountEXTArgs {
+    uint32_t                                    viewportCount;
+    const VkViewport*                           pViewports;
+};
+
+struct CmdSetScissorWithCountEXTArgs {
+    uint32_t                                    scissorCount;
+    const VkRect2D*                             pScissors;
+};
+
+struct CmdBindVertexBuffers2EXTArgs {
+    uint32_t                                    firstBinding;
+    uint32_t                                    bindingCount;
+    const VkBuffer*                             pBuffers;
+    const VkDeviceSize*                         pOffsets;
+    const VkDeviceSize*                         pSizes;
+    const VkDeviceSize*                         pStrides;
+};
+
+struct CmdSetDepthTestEnableEXTArgs {
+    VkBool32                                    depthTestEnable;
+};
+
+struct CmdSetDepthWriteEnableEXTArgs {
+    VkBool32                                    depthWriteEnable;
+};
+
+struct CmdSetDepthCompareOpEXTArgs {
+    VkCompareOp                                 depthCompareOp;
+};
+
+struct CmdSetDepthBoundsTestEnableEXTArgs {
+    VkBool32                                    depthBoundsTestEnable;
+};
+
+struct CmdSetStencilTestEnableEXTArgs {
+    VkBool32                                    stencilTestEnable;
+};
+
+struct CmdSetStencilOpEXTArgs {
+    VkStencilFaceFlags                          faceMask;
+    VkStencilOp                                 failOp;
+    VkStencilOp                                 passOp;
+    VkStencilOp                                 depthFailOp;
+    VkCompareOp                                 compareOp;
+};
+
+struct CmdPreprocessGeneratedCommandsNVArgs {
+    const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo;
+};
+
+struct CmdExecuteGeneratedCommandsNVArgs {
+    VkBool32                                    isPreprocessed;
+    const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo;
+};
+
+struct CmdBindPipelineShaderGroupNVArgs {
+    VkPipelineBindPoint                         pipelineBindPoint;
+    VkPipeline                                  pipeline;
+    uint32_t                                    groupIndex;
+};
+
+struct CmdSetFragmentShadingRateEnumNVArgs {
+    VkFragmentShadingRateNV                     shadingRate;
+    VkFragmentShadingRateCombinerOpKHR          combinerOps[2];
+};
+
+struct CmdSetVertexInputEXTArgs {
+    uint32_t                                    vertexBindingDescriptionCount;
+    const VkVertexInputBindingDescription2EXT*  pVertexBindingDescriptions;
+    uint32_t                                    vertexAttributeDescriptionCount;
+    const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions;
+};
+
+struct CmdSetPatchControlPointsEXTArgs {
+    uint32_t                                    patchControlPoints;
+};
+
+struct CmdSetRasterizerDiscardEnableEXTArgs {
+    VkBool32                                    rasterizerDiscardEnable;
+};
+
+struct CmdSetDepthBiasEnableEXTArgs {
+    VkBool32                                    depthBiasEnable;
+};
+
+struct CmdSetLogicOpEXTArgs {
+    VkLogicOp                                   logicOp;
+};
+
+struct CmdSetPrimitiveRestartEnableEXTArgs {
+    VkBool32                                    primitiveRestartEnable;
+};
+
+struct CmdBuildAccelerationStructuresKHRArgs {
+    uint32_t                                    infoCount;
+    const VkAccelerationStructureBuildGeometryInfoKHR* pInfos;
+    const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos;
+};
+
+struct CmdBuildAccelerationStructuresIndirectKHRArgs {
+    uint32_t                                    infoCount;
+    const VkAccelerationStructureBuildGeometryInfoKHR* pInfos;
+    const VkDeviceAddress*                      pIndirectDeviceAddresses;
+    const uint32_t*                             pIndirectStrides;
+    const uint32_t* const*                      ppMaxPrimitiveCounts;
+};
+
+struct CmdCopyAccelerationStructureKHRArgs {
+    const VkCopyAccelerationStructureInfoKHR*   pInfo;
+};
+
+struct CmdCopyAccelerationStructureToMemoryKHRArgs {
+    const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo;
+};
+
+struct CmdCopyMemoryToAccelerationStructureKHRArgs {
+    const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo;
+};
+
+struct CmdWriteAccelerationStructuresPropertiesKHRArgs {
+    uint32_t                                    accelerationStructureCount;
+    const VkAccelerationStructureKHR*           pAccelerationStructures;
+    VkQueryType                                 queryType;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+};
+
+struct CmdTraceRaysKHRArgs {
+    const VkStridedDeviceAddressRegionKHR*      pRaygenShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pMissShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pHitShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pCallableShaderBindingTable;
+    uint32_t                                    width;
+    uint32_t                                    height;
+    uint32_t                                    depth;
+};
+
+struct CmdTraceRaysIndirectKHRArgs {
+    const VkStridedDeviceAddressRegionKHR*      pRaygenShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pMissShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pHitShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pCallableShaderBindingTable;
+    VkDeviceAddress                             indirectDeviceAddress;
+};
+
+struct CmdSetRayTracingPipelineStackSizeKHRArgs {
+    uint32_t                                    pipelineStackSize;
+};
+
+// Every API the mock ICD intercepts, placed by a minimal perfect hash of its name. Functions of platforms that
+// aren't being built for stay in as nullptr, so the layout is the same on every platform.
+static const ProcEntry kProcTable[486] = {
+    {"vkQueueBindSparse", (void*)QueueBindSparse},
+    {"vkCmdBindTransformFeedbackBuffersEXT", (void*)CmdBindTransformFeedbackBuffersEXT},
+    {"vkDeferredOperationJoinKHR", (void*)DeferredOperationJoinKHR},
+    {"vkCmdSetDepthCompareOpEXT", (void*)CmdSetDepthCompareOpEXT},
+    {"vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", (void*)GetRayTracingCaptureReplayShaderGroupHandlesKHR},
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+    {"vkCreateScreenSurfaceQNX", (void*)CreateScreenSurfaceQNX},
+#else
+    {"vkCreateScreenSurfaceQNX", nullptr},
 #endif
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkCmdControlVideoCodingKHR", (void*)CmdControlVideoCodingKHR},
+    {"vkDestroyBufferView", (void*)DestroyBufferView},
+    {"vkCreateSamplerYcbcrConversionKHR", (void*)CreateSamplerYcbcrConversionKHR},
+    {"vkCmdDrawIndexedIndirect", (void*)CmdDrawIndexedIndirect},
+    {"vkGetDeviceGroupPeerMemoryFeaturesKHR", (void*)GetDeviceGroupPeerMemoryFeaturesKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetMemoryWin32HandleNV", (void*)GetMemoryWin32HandleNV},
+#else
+    {"vkGetMemoryWin32HandleNV", nullptr},
 #endif
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkCmdDecodeVideoKHR", (void*)CmdDecodeVideoKHR},
+    {"vkCmdSetDiscardRectangleEXT", (void*)CmdSetDiscardRectangleEXT},
+    {"vkImportSemaphoreFdKHR", (void*)ImportSemaphoreFdKHR},
+#ifdef VK_USE_PLATFORM_VI_NN
+    {"vkCreateViSurfaceNN", (void*)CreateViSurfaceNN},
+#else
+    {"vkCreateViSurfaceNN", nullptr},
 #endif
-    {"vkGetPhysicalDeviceFeatures2KHR", (void*)GetPhysicalDeviceFeatures2KHR},
-    {"vkGetPhysicalDeviceProperties2KHR", (void*)GetPhysicalDeviceProperties2KHR},
-    {"vkGetPhysicalDeviceFormatProperties2KHR", (void*)GetPhysicalDeviceFormatProperties2KHR},
-    {"vkGetPhysicalDeviceImageFormatProperties2KHR", (void*)GetPhysicalDeviceImageFormatProperties2KHR},
-    {"vkGetPhysicalDeviceQueueFamilyProperties2KHR", (void*)GetPhysicalDeviceQueueFamilyProperties2KHR},
-    {"vkGetPhysicalDeviceMemoryProperties2KHR", (void*)GetPhysicalDeviceMemoryProperties2KHR},
-    {"vkGetPhysicalDeviceSparseImageFormatProperties2KHR", (void*)GetPhysicalDeviceSparseImageFormatProperties2KHR},
-    {"vkGetDeviceGroupPeerMemoryFeaturesKHR", (void*)GetDeviceGroupPeerMemoryFeaturesKHR},
-    {"vkCmdSetDeviceMaskKHR", (void*)CmdSetDeviceMaskKHR},
-    {"vkCmdDispatchBaseKHR", (void*)CmdDispatchBaseKHR},
-    {"vkTrimCommandPoolKHR", (void*)TrimCommandPoolKHR},
-    {"vkEnumeratePhysicalDeviceGroupsKHR", (void*)EnumeratePhysicalDeviceGroupsKHR},
-    {"vkGetPhysicalDeviceExternalBufferPropertiesKHR", (void*)GetPhysicalDeviceExternalBufferPropertiesKHR},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     {"vkGetMemoryWin32HandleKHR", (void*)GetMemoryWin32HandleKHR},
+#else
+    {"vkGetMemoryWin32HandleKHR", nullptr},
 #endif
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkGetMemoryWin32HandlePropertiesKHR", (void*)GetMemoryWin32HandlePropertiesKHR},
+    {"vkGetRayTracingShaderGroupHandlesNV", (void*)GetRayTracingShaderGroupHandlesNV},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkUpdateVideoSessionParametersKHR", (void*)UpdateVideoSessionParametersKHR},
+#else
+    {"vkUpdateVideoSessionParametersKHR", nullptr},
 #endif
-    {"vkGetMemoryFdKHR", (void*)GetMemoryFdKHR},
-    {"vkGetMemoryFdPropertiesKHR", (void*)GetMemoryFdPropertiesKHR},
-    {"vkGetPhysicalDeviceExternalSemaphorePropertiesKHR", (void*)GetPhysicalDeviceExternalSemaphorePropertiesKHR},
+    {"vkCmdNextSubpass", (void*)CmdNextSubpass},
+    {"vkBindAccelerationStructureMemoryNV", (void*)BindAccelerationStructureMemoryNV},
+    {"vkTrimCommandPoolKHR", (void*)TrimCommandPoolKHR},
+    {"vkGetCalibratedTimestampsEXT", (void*)GetCalibratedTimestampsEXT},
+    {"vkGetDisplayModePropertiesKHR", (void*)GetDisplayModePropertiesKHR},
+    {"vkBeginCommandBuffer", (void*)BeginCommandBuffer},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkGetPhysicalDeviceVideoFormatPropertiesKHR", (void*)GetPhysicalDeviceVideoFormatPropertiesKHR},
+#else
+    {"vkGetPhysicalDeviceVideoFormatPropertiesKHR", nullptr},
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    {"vkCreateWaylandSurfaceKHR", (void*)CreateWaylandSurfaceKHR},
+#else
+    {"vkCreateWaylandSurfaceKHR", nullptr},
+#endif
+    {"vkCmdSetVertexInputEXT", (void*)CmdSetVertexInputEXT},
+    {"vkCmdDebugMarkerInsertEXT", (void*)CmdDebugMarkerInsertEXT},
+    {"vkCmdDispatchBase", (void*)CmdDispatchBase},
+    {"vkGetPhysicalDeviceMemoryProperties2KHR", (void*)GetPhysicalDeviceMemoryProperties2KHR},
+    {"vkGetBufferDeviceAddress", (void*)GetBufferDeviceAddress},
+    {"vkCmdSetDepthBoundsTestEnableEXT", (void*)CmdSetDepthBoundsTestEnableEXT},
+    {"vkCmdTraceRaysIndirectKHR", (void*)CmdTraceRaysIndirectKHR},
+    {"vkCmdDrawIndirectCountKHR", (void*)CmdDrawIndirectCountKHR},
+    {"vkImportFenceFdKHR", (void*)ImportFenceFdKHR},
+    {"vkSetDebugUtilsObjectNameEXT", (void*)SetDebugUtilsObjectNameEXT},
+    {"vkGetPhysicalDeviceQueueFamilyProperties2", (void*)GetPhysicalDeviceQueueFamilyProperties2},
+    {"vkCmdSetDepthBias", (void*)CmdSetDepthBias},
+    {"vkCreateComputePipelines", (void*)CreateComputePipelines},
+    {"vkGetShaderInfoAMD", (void*)GetShaderInfoAMD},
+    {"vkGetPipelineExecutableInternalRepresentationsKHR", (void*)GetPipelineExecutableInternalRepresentationsKHR},
+    {"vkUpdateDescriptorSetWithTemplate", (void*)UpdateDescriptorSetWithTemplate},
+    {"vkCmdBindPipelineShaderGroupNV", (void*)CmdBindPipelineShaderGroupNV},
+    {"vkEnumeratePhysicalDevices", (void*)EnumeratePhysicalDevices},
+    {"vkCmdSetColorWriteEnableEXT", (void*)CmdSetColorWriteEnableEXT},
+    {"vkCmdDrawMeshTasksIndirectCountNV", (void*)CmdDrawMeshTasksIndirectCountNV},
+    {"vkCmdDrawIndexedIndirectCount", (void*)CmdDrawIndexedIndirectCount},
+    {"vkCreateRayTracingPipelinesNV", (void*)CreateRayTracingPipelinesNV},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkImportSemaphoreWin32HandleKHR", (void*)ImportSemaphoreWin32HandleKHR},
+    {"vkGetPhysicalDeviceSurfacePresentModes2EXT", (void*)GetPhysicalDeviceSurfacePresentModes2EXT},
+#else
+    {"vkGetPhysicalDeviceSurfacePresentModes2EXT", nullptr},
 #endif
+    {"vkBuildAccelerationStructuresKHR", (void*)BuildAccelerationStructuresKHR},
+    {"vkAcquireNextImageKHR", (void*)AcquireNextImageKHR},
+    {"vkCmdBlitImage", (void*)CmdBlitImage},
+    {"vkSetHdrMetadataEXT", (void*)SetHdrMetadataEXT},
+    {"vkDestroyDebugUtilsMessengerEXT", (void*)DestroyDebugUtilsMessengerEXT},
+    {"vkGetPhysicalDeviceFormatProperties2KHR", (void*)GetPhysicalDeviceFormatProperties2KHR},
+    {"vkCmdWriteBufferMarker2AMD", (void*)CmdWriteBufferMarker2AMD},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     {"vkGetSemaphoreWin32HandleKHR", (void*)GetSemaphoreWin32HandleKHR},
+#else
+    {"vkGetSemaphoreWin32HandleKHR", nullptr},
 #endif
-    {"vkImportSemaphoreFdKHR", (void*)ImportSemaphoreFdKHR},
-    {"vkGetSemaphoreFdKHR", (void*)GetSemaphoreFdKHR},
-    {"vkCmdPushDescriptorSetKHR", (void*)CmdPushDescriptorSetKHR},
-    {"vkCmdPushDescriptorSetWithTemplateKHR", (void*)CmdPushDescriptorSetWithTemplateKHR},
-    {"vkCreateDescriptorUpdateTemplateKHR", (void*)CreateDescriptorUpdateTemplateKHR},
-    {"vkDestroyDescriptorUpdateTemplateKHR", (void*)DestroyDescriptorUpdateTemplateKHR},
-    {"vkUpdateDescriptorSetWithTemplateKHR", (void*)UpdateDescriptorSetWithTemplateKHR},
-    {"vkCreateRenderPass2KHR", (void*)CreateRenderPass2KHR},
-    {"vkCmdBeginRenderPass2KHR", (void*)CmdBeginRenderPass2KHR},
-    {"vkCmdNextSubpass2KHR", (void*)CmdNextSubpass2KHR},
-    {"vkCmdEndRenderPass2KHR", (void*)CmdEndRenderPass2KHR},
-    {"vkGetSwapchainStatusKHR", (void*)GetSwapchainStatusKHR},
-    {"vkGetPhysicalDeviceExternalFencePropertiesKHR", (void*)GetPhysicalDeviceExternalFencePropertiesKHR},
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkImportFenceWin32HandleKHR", (void*)ImportFenceWin32HandleKHR},
+    {"vkCmdEndQuery", (void*)CmdEndQuery},
+    {"vkCmdBeginRenderPass", (void*)CmdBeginRenderPass},
+    {"vkCreateDebugUtilsMessengerEXT", (void*)CreateDebugUtilsMessengerEXT},
+    {"vkCreateCuModuleNVX", (void*)CreateCuModuleNVX},
+    {"vkCmdDrawIndirect", (void*)CmdDrawIndirect},
+    {"vkResetFences", (void*)ResetFences},
+    {"vkCmdEndDebugUtilsLabelEXT", (void*)CmdEndDebugUtilsLabelEXT},
+    {"vkCreateDescriptorSetLayout", (void*)CreateDescriptorSetLayout},
+    {"vkCmdWriteTimestamp", (void*)CmdWriteTimestamp},
+    {"vkCmdSetFragmentShadingRateEnumNV", (void*)CmdSetFragmentShadingRateEnumNV},
+    {"vkCmdSetViewportWithCountEXT", (void*)CmdSetViewportWithCountEXT},
+    {"vkCmdCopyImageToBuffer2KHR", (void*)CmdCopyImageToBuffer2KHR},
+    {"vkCreateDisplayModeKHR", (void*)CreateDisplayModeKHR},
+    {"vkCmdCopyAccelerationStructureNV", (void*)CmdCopyAccelerationStructureNV},
+    {"vkWaitForFences", (void*)WaitForFences},
+    {"vkDestroyPrivateDataSlotEXT", (void*)DestroyPrivateDataSlotEXT},
+    {"vkCmdWriteTimestamp2KHR", (void*)CmdWriteTimestamp2KHR},
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {"vkGetAndroidHardwareBufferPropertiesANDROID", (void*)GetAndroidHardwareBufferPropertiesANDROID},
+#else
+    {"vkGetAndroidHardwareBufferPropertiesANDROID", nullptr},
 #endif
+    {"vkCmdDrawIndirectByteCountEXT", (void*)CmdDrawIndirectByteCountEXT},
+    {"vkCmdSetStencilOpEXT", (void*)CmdSetStencilOpEXT},
+    {"vkGetDeviceMemoryOpaqueCaptureAddressKHR", (void*)GetDeviceMemoryOpaqueCaptureAddressKHR},
+    {"vkGetDescriptorSetLayoutSupportKHR", (void*)GetDescriptorSetLayoutSupportKHR},
+    {"vkCopyMemoryToAccelerationStructureKHR", (void*)CopyMemoryToAccelerationStructureKHR},
+    {"vkDestroyDescriptorSetLayout", (void*)DestroyDescriptorSetLayout},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkGetFenceWin32HandleKHR", (void*)GetFenceWin32HandleKHR},
+    {"vkCreateWin32SurfaceKHR", (void*)CreateWin32SurfaceKHR},
+#else
+    {"vkCreateWin32SurfaceKHR", nullptr},
 #endif
-    {"vkImportFenceFdKHR", (void*)ImportFenceFdKHR},
-    {"vkGetFenceFdKHR", (void*)GetFenceFdKHR},
-    {"vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR", (void*)EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR},
-    {"vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR", (void*)GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR},
-    {"vkAcquireProfilingLockKHR", (void*)AcquireProfilingLockKHR},
-    {"vkReleaseProfilingLockKHR", (void*)ReleaseProfilingLockKHR},
-    {"vkGetPhysicalDeviceSurfaceCapabilities2KHR", (void*)GetPhysicalDeviceSurfaceCapabilities2KHR},
-    {"vkGetPhysicalDeviceSurfaceFormats2KHR", (void*)GetPhysicalDeviceSurfaceFormats2KHR},
-    {"vkGetPhysicalDeviceDisplayProperties2KHR", (void*)GetPhysicalDeviceDisplayProperties2KHR},
+    {"vkGetDeviceQueue", (void*)GetDeviceQueue},
     {"vkGetPhysicalDeviceDisplayPlaneProperties2KHR", (void*)GetPhysicalDeviceDisplayPlaneProperties2KHR},
-    {"vkGetDisplayModeProperties2KHR", (void*)GetDisplayModeProperties2KHR},
-    {"vkGetDisplayPlaneCapabilities2KHR", (void*)GetDisplayPlaneCapabilities2KHR},
-    {"vkGetImageMemoryRequirements2KHR", (void*)GetImageMemoryRequirements2KHR},
-    {"vkGetBufferMemoryRequirements2KHR", (void*)GetBufferMemoryRequirements2KHR},
-    {"vkGetImageSparseMemoryRequirements2KHR", (void*)GetImageSparseMemoryRequirements2KHR},
-    {"vkCreateSamplerYcbcrConversionKHR", (void*)CreateSamplerYcbcrConversionKHR},
-    {"vkDestroySamplerYcbcrConversionKHR", (void*)DestroySamplerYcbcrConversionKHR},
-    {"vkBindBufferMemory2KHR", (void*)BindBufferMemory2KHR},
-    {"vkBindImageMemory2KHR", (void*)BindImageMemory2KHR},
-    {"vkGetDescriptorSetLayoutSupportKHR", (void*)GetDescriptorSetLayoutSupportKHR},
-    {"vkCmdDrawIndirectCountKHR", (void*)CmdDrawIndirectCountKHR},
-    {"vkCmdDrawIndexedIndirectCountKHR", (void*)CmdDrawIndexedIndirectCountKHR},
-    {"vkGetSemaphoreCounterValueKHR", (void*)GetSemaphoreCounterValueKHR},
+    {"vkGetFenceStatus", (void*)GetFenceStatus},
+    {"vkGetPhysicalDeviceExternalBufferProperties", (void*)GetPhysicalDeviceExternalBufferProperties},
     {"vkWaitSemaphoresKHR", (void*)WaitSemaphoresKHR},
-    {"vkSignalSemaphoreKHR", (void*)SignalSemaphoreKHR},
-    {"vkGetPhysicalDeviceFragmentShadingRatesKHR", (void*)GetPhysicalDeviceFragmentShadingRatesKHR},
-    {"vkCmdSetFragmentShadingRateKHR", (void*)CmdSetFragmentShadingRateKHR},
-    {"vkGetBufferDeviceAddressKHR", (void*)GetBufferDeviceAddressKHR},
-    {"vkGetBufferOpaqueCaptureAddressKHR", (void*)GetBufferOpaqueCaptureAddressKHR},
-    {"vkGetDeviceMemoryOpaqueCaptureAddressKHR", (void*)GetDeviceMemoryOpaqueCaptureAddressKHR},
-    {"vkCreateDeferredOperationKHR", (void*)CreateDeferredOperationKHR},
-    {"vkDestroyDeferredOperationKHR", (void*)DestroyDeferredOperationKHR},
-    {"vkGetDeferredOperationMaxConcurrencyKHR", (void*)GetDeferredOperationMaxConcurrencyKHR},
-    {"vkGetDeferredOperationResultKHR", (void*)GetDeferredOperationResultKHR},
-    {"vkDeferredOperationJoinKHR", (void*)DeferredOperationJoinKHR},
-    {"vkGetPipelineExecutablePropertiesKHR", (void*)GetPipelineExecutablePropertiesKHR},
-    {"vkGetPipelineExecutableStatisticsKHR", (void*)GetPipelineExecutableStatisticsKHR},
-    {"vkGetPipelineExecutableInternalRepresentationsKHR", (void*)GetPipelineExecutableInternalRepresentationsKHR},
+    {"vkQueueSubmit2KHR", (void*)QueueSubmit2KHR},
+    {"vkQueueBeginDebugUtilsLabelEXT", (void*)QueueBeginDebugUtilsLabelEXT},
+    {"vkGetPhysicalDeviceSurfaceFormats2KHR", (void*)GetPhysicalDeviceSurfaceFormats2KHR},
+    {"vkWriteAccelerationStructuresPropertiesKHR", (void*)WriteAccelerationStructuresPropertiesKHR},
+    {"vkDestroyInstance", (void*)DestroyInstance},
+    {"vkCmdSetPerformanceMarkerINTEL", (void*)CmdSetPerformanceMarkerINTEL},
+    {"vkCmdFillBuffer", (void*)CmdFillBuffer},
+    {"vkCreateRenderPass", (void*)CreateRenderPass},
+    {"vkGetPhysicalDeviceQueueFamilyProperties2KHR", (void*)GetPhysicalDeviceQueueFamilyProperties2KHR},
+    {"vkCreatePipelineCache", (void*)CreatePipelineCache},
+    {"vkCmdPushConstants", (void*)CmdPushConstants},
+    {"vkGetBufferOpaqueCaptureAddress", (void*)GetBufferOpaqueCaptureAddress},
+    {"vkCmdSetLineStippleEXT", (void*)CmdSetLineStippleEXT},
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+    {"vkGetPhysicalDeviceScreenPresentationSupportQNX", (void*)GetPhysicalDeviceScreenPresentationSupportQNX},
+#else
+    {"vkGetPhysicalDeviceScreenPresentationSupportQNX", nullptr},
+#endif
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    {"vkCmdEncodeVideoKHR", (void*)CmdEncodeVideoKHR},
+    {"vkCreateVideoSessionParametersKHR", (void*)CreateVideoSessionParametersKHR},
+#else
+    {"vkCreateVideoSessionParametersKHR", nullptr},
 #endif
-    {"vkCmdSetEvent2KHR", (void*)CmdSetEvent2KHR},
-    {"vkCmdResetEvent2KHR", (void*)CmdResetEvent2KHR},
-    {"vkCmdWaitEvents2KHR", (void*)CmdWaitEvents2KHR},
-    {"vkCmdPipelineBarrier2KHR", (void*)CmdPipelineBarrier2KHR},
-    {"vkCmdWriteTimestamp2KHR", (void*)CmdWriteTimestamp2KHR},
-    {"vkQueueSubmit2KHR", (void*)QueueSubmit2KHR},
-    {"vkCmdWriteBufferMarker2AMD", (void*)CmdWriteBufferMarker2AMD},
-    {"vkGetQueueCheckpointData2NV", (void*)GetQueueCheckpointData2NV},
+    {"vkMergePipelineCaches", (void*)MergePipelineCaches},
+    {"vkDestroyImage", (void*)DestroyImage},
+    {"vkResetQueryPoolEXT", (void*)ResetQueryPoolEXT},
+    {"vkGetPrivateDataEXT", (void*)GetPrivateDataEXT},
+    {"vkCmdBindPipeline", (void*)CmdBindPipeline},
+    {"vkCmdSetDeviceMask", (void*)CmdSetDeviceMask},
+    {"vkCreateQueryPool", (void*)CreateQueryPool},
+    {"vkCmdSetDepthBounds", (void*)CmdSetDepthBounds},
+    {"vkQueueSubmit", (void*)QueueSubmit},
+    {"vkQueueEndDebugUtilsLabelEXT", (void*)QueueEndDebugUtilsLabelEXT},
+    {"vkCmdBindIndexBuffer", (void*)CmdBindIndexBuffer},
+    {"vkDestroyValidationCacheEXT", (void*)DestroyValidationCacheEXT},
+    {"vkUpdateDescriptorSetWithTemplateKHR", (void*)UpdateDescriptorSetWithTemplateKHR},
+    {"vkDestroySurfaceKHR", (void*)DestroySurfaceKHR},
+    {"vkCmdSetRasterizerDiscardEnableEXT", (void*)CmdSetRasterizerDiscardEnableEXT},
+    {"vkGetImageSparseMemoryRequirements", (void*)GetImageSparseMemoryRequirements},
+    {"vkDestroyFramebuffer", (void*)DestroyFramebuffer},
+    {"vkDisplayPowerControlEXT", (void*)DisplayPowerControlEXT},
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    {"vkGetPhysicalDeviceWaylandPresentationSupportKHR", (void*)GetPhysicalDeviceWaylandPresentationSupportKHR},
+#else
+    {"vkGetPhysicalDeviceWaylandPresentationSupportKHR", nullptr},
+#endif
+    {"vkGetPhysicalDeviceExternalSemaphoreProperties", (void*)GetPhysicalDeviceExternalSemaphoreProperties},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkGetPhysicalDeviceVideoCapabilitiesKHR", (void*)GetPhysicalDeviceVideoCapabilitiesKHR},
+#else
+    {"vkGetPhysicalDeviceVideoCapabilitiesKHR", nullptr},
+#endif
+    {"vkCmdTraceRaysNV", (void*)CmdTraceRaysNV},
+    {"vkCmdCopyAccelerationStructureToMemoryKHR", (void*)CmdCopyAccelerationStructureToMemoryKHR},
     {"vkCmdCopyBuffer2KHR", (void*)CmdCopyBuffer2KHR},
-    {"vkCmdCopyImage2KHR", (void*)CmdCopyImage2KHR},
-    {"vkCmdCopyBufferToImage2KHR", (void*)CmdCopyBufferToImage2KHR},
-    {"vkCmdCopyImageToBuffer2KHR", (void*)CmdCopyImageToBuffer2KHR},
-    {"vkCmdBlitImage2KHR", (void*)CmdBlitImage2KHR},
-    {"vkCmdResolveImage2KHR", (void*)CmdResolveImage2KHR},
-    {"vkCreateDebugReportCallbackEXT", (void*)CreateDebugReportCallbackEXT},
-    {"vkDestroyDebugReportCallbackEXT", (void*)DestroyDebugReportCallbackEXT},
-    {"vkDebugReportMessageEXT", (void*)DebugReportMessageEXT},
-    {"vkDebugMarkerSetObjectTagEXT", (void*)DebugMarkerSetObjectTagEXT},
-    {"vkDebugMarkerSetObjectNameEXT", (void*)DebugMarkerSetObjectNameEXT},
-    {"vkCmdDebugMarkerBeginEXT", (void*)CmdDebugMarkerBeginEXT},
-    {"vkCmdDebugMarkerEndEXT", (void*)CmdDebugMarkerEndEXT},
-    {"vkCmdDebugMarkerInsertEXT", (void*)CmdDebugMarkerInsertEXT},
-    {"vkCmdBindTransformFeedbackBuffersEXT", (void*)CmdBindTransformFeedbackBuffersEXT},
-    {"vkCmdBeginTransformFeedbackEXT", (void*)CmdBeginTransformFeedbackEXT},
-    {"vkCmdEndTransformFeedbackEXT", (void*)CmdEndTransformFeedbackEXT},
-    {"vkCmdBeginQueryIndexedEXT", (void*)CmdBeginQueryIndexedEXT},
-    {"vkCmdEndQueryIndexedEXT", (void*)CmdEndQueryIndexedEXT},
-    {"vkCmdDrawIndirectByteCountEXT", (void*)CmdDrawIndirectByteCountEXT},
-    {"vkCreateCuModuleNVX", (void*)CreateCuModuleNVX},
-    {"vkCreateCuFunctionNVX", (void*)CreateCuFunctionNVX},
-    {"vkDestroyCuModuleNVX", (void*)DestroyCuModuleNVX},
-    {"vkDestroyCuFunctionNVX", (void*)DestroyCuFunctionNVX},
-    {"vkCmdCuLaunchKernelNVX", (void*)CmdCuLaunchKernelNVX},
-    {"vkGetImageViewHandleNVX", (void*)GetImageViewHandleNVX},
-    {"vkGetImageViewAddressNVX", (void*)GetImageViewAddressNVX},
-    {"vkCmdDrawIndirectCountAMD", (void*)CmdDrawIndirectCountAMD},
-    {"vkCmdDrawIndexedIndirectCountAMD", (void*)CmdDrawIndexedIndirectCountAMD},
-    {"vkGetShaderInfoAMD", (void*)GetShaderInfoAMD},
-#ifdef VK_USE_PLATFORM_GGP
-    {"vkCreateStreamDescriptorSurfaceGGP", (void*)CreateStreamDescriptorSurfaceGGP},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkDestroyVideoSessionParametersKHR", (void*)DestroyVideoSessionParametersKHR},
+#else
+    {"vkDestroyVideoSessionParametersKHR", nullptr},
 #endif
-    {"vkGetPhysicalDeviceExternalImageFormatPropertiesNV", (void*)GetPhysicalDeviceExternalImageFormatPropertiesNV},
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    {"vkGetPhysicalDeviceXcbPresentationSupportKHR", (void*)GetPhysicalDeviceXcbPresentationSupportKHR},
+#else
+    {"vkGetPhysicalDeviceXcbPresentationSupportKHR", nullptr},
+#endif
+    {"vkQueuePresentKHR", (void*)QueuePresentKHR},
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    {"vkCreateIOSSurfaceMVK", (void*)CreateIOSSurfaceMVK},
+#else
+    {"vkCreateIOSSurfaceMVK", nullptr},
+#endif
+    {"vkCmdNextSubpass2", (void*)CmdNextSubpass2},
+    {"vkGetAccelerationStructureDeviceAddressKHR", (void*)GetAccelerationStructureDeviceAddressKHR},
+    {"vkAllocateMemory", (void*)AllocateMemory},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetPhysicalDeviceWin32PresentationSupportKHR", (void*)GetPhysicalDeviceWin32PresentationSupportKHR},
+#else
+    {"vkGetPhysicalDeviceWin32PresentationSupportKHR", nullptr},
+#endif
+    {"vkCmdSetSampleLocationsEXT", (void*)CmdSetSampleLocationsEXT},
+    {"vkWaitSemaphores", (void*)WaitSemaphores},
+    {"vkCmdResetEvent", (void*)CmdResetEvent},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdControlVideoCodingKHR", (void*)CmdControlVideoCodingKHR},
+#else
+    {"vkCmdControlVideoCodingKHR", nullptr},
+#endif
+    {"vkGetQueueCheckpointDataNV", (void*)GetQueueCheckpointDataNV},
+    {"vkDestroyDescriptorPool", (void*)DestroyDescriptorPool},
+    {"vkResetEvent", (void*)ResetEvent},
+    {"vkGetPhysicalDeviceFormatProperties", (void*)GetPhysicalDeviceFormatProperties},
+    {"vkCreateFramebuffer", (void*)CreateFramebuffer},
+    {"vkGetPipelineExecutablePropertiesKHR", (void*)GetPipelineExecutablePropertiesKHR},
+    {"vkGetBufferDeviceAddressEXT", (void*)GetBufferDeviceAddressEXT},
+    {"vkEnumerateInstanceLayerProperties", (void*)EnumerateInstanceLayerProperties},
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    {"vkCreateXlibSurfaceKHR", (void*)CreateXlibSurfaceKHR},
+#else
+    {"vkCreateXlibSurfaceKHR", nullptr},
+#endif
+    {"vkCmdBeginDebugUtilsLabelEXT", (void*)CmdBeginDebugUtilsLabelEXT},
+    {"vkGetPhysicalDeviceMultisamplePropertiesEXT", (void*)GetPhysicalDeviceMultisamplePropertiesEXT},
+    {"vkGetDeviceMemoryCommitment", (void*)GetDeviceMemoryCommitment},
+    {"vkDestroyDevice", (void*)DestroyDevice},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdDecodeVideoKHR", (void*)CmdDecodeVideoKHR},
+#else
+    {"vkCmdDecodeVideoKHR", nullptr},
+#endif
+    {"vkCmdSetLogicOpEXT", (void*)CmdSetLogicOpEXT},
+    {"vkGetDeviceGroupPresentCapabilitiesKHR", (void*)GetDeviceGroupPresentCapabilitiesKHR},
+    {"vkGetDisplayModeProperties2KHR", (void*)GetDisplayModeProperties2KHR},
+    {"vkGetPhysicalDeviceDisplayProperties2KHR", (void*)GetPhysicalDeviceDisplayProperties2KHR},
+    {"vkGetQueueCheckpointData2NV", (void*)GetQueueCheckpointData2NV},
+    {"vkGetPhysicalDevicePresentRectanglesKHR", (void*)GetPhysicalDevicePresentRectanglesKHR},
+    {"vkGetPhysicalDeviceSurfaceSupportKHR", (void*)GetPhysicalDeviceSurfaceSupportKHR},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkGetMemoryWin32HandleNV", (void*)GetMemoryWin32HandleNV},
-#endif
-#ifdef VK_USE_PLATFORM_VI_NN
-    {"vkCreateViSurfaceNN", (void*)CreateViSurfaceNN},
+    {"vkAcquireFullScreenExclusiveModeEXT", (void*)AcquireFullScreenExclusiveModeEXT},
+#else
+    {"vkAcquireFullScreenExclusiveModeEXT", nullptr},
 #endif
-    {"vkCmdBeginConditionalRenderingEXT", (void*)CmdBeginConditionalRenderingEXT},
-    {"vkCmdEndConditionalRenderingEXT", (void*)CmdEndConditionalRenderingEXT},
-    {"vkCmdSetViewportWScalingNV", (void*)CmdSetViewportWScalingNV},
-    {"vkReleaseDisplayEXT", (void*)ReleaseDisplayEXT},
-#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
-    {"vkAcquireXlibDisplayEXT", (void*)AcquireXlibDisplayEXT},
+    {"vkDestroyPipelineLayout", (void*)DestroyPipelineLayout},
+    {"vkDestroyRenderPass", (void*)DestroyRenderPass},
+    {"vkCmdSetStencilTestEnableEXT", (void*)CmdSetStencilTestEnableEXT},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties", (void*)GetPhysicalDeviceSparseImageFormatProperties},
+    {"vkEnumerateDeviceExtensionProperties", (void*)EnumerateDeviceExtensionProperties},
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    {"vkCreateMetalSurfaceEXT", (void*)CreateMetalSurfaceEXT},
+#else
+    {"vkCreateMetalSurfaceEXT", nullptr},
 #endif
 #ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
     {"vkGetRandROutputDisplayEXT", (void*)GetRandROutputDisplayEXT},
+#else
+    {"vkGetRandROutputDisplayEXT", nullptr},
 #endif
-    {"vkGetPhysicalDeviceSurfaceCapabilities2EXT", (void*)GetPhysicalDeviceSurfaceCapabilities2EXT},
-    {"vkDisplayPowerControlEXT", (void*)DisplayPowerControlEXT},
-    {"vkRegisterDeviceEventEXT", (void*)RegisterDeviceEventEXT},
-    {"vkRegisterDisplayEventEXT", (void*)RegisterDisplayEventEXT},
-    {"vkGetSwapchainCounterEXT", (void*)GetSwapchainCounterEXT},
-    {"vkGetRefreshCycleDurationGOOGLE", (void*)GetRefreshCycleDurationGOOGLE},
-    {"vkGetPastPresentationTimingGOOGLE", (void*)GetPastPresentationTimingGOOGLE},
-    {"vkCmdSetDiscardRectangleEXT", (void*)CmdSetDiscardRectangleEXT},
-    {"vkSetHdrMetadataEXT", (void*)SetHdrMetadataEXT},
-#ifdef VK_USE_PLATFORM_IOS_MVK
-    {"vkCreateIOSSurfaceMVK", (void*)CreateIOSSurfaceMVK},
+    {"vkGetBufferDeviceAddressKHR", (void*)GetBufferDeviceAddressKHR},
+    {"vkGetPhysicalDeviceCooperativeMatrixPropertiesNV", (void*)GetPhysicalDeviceCooperativeMatrixPropertiesNV},
+    {"vkCmdSetStencilReference", (void*)CmdSetStencilReference},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkImportFenceWin32HandleKHR", (void*)ImportFenceWin32HandleKHR},
+#else
+    {"vkImportFenceWin32HandleKHR", nullptr},
 #endif
-#ifdef VK_USE_PLATFORM_MACOS_MVK
-    {"vkCreateMacOSSurfaceMVK", (void*)CreateMacOSSurfaceMVK},
+    {"vkGetInstanceProcAddr", (void*)GetInstanceProcAddr},
+    {"vkAllocateDescriptorSets", (void*)AllocateDescriptorSets},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkGetVideoSessionMemoryRequirementsKHR", (void*)GetVideoSessionMemoryRequirementsKHR},
+#else
+    {"vkGetVideoSessionMemoryRequirementsKHR", nullptr},
 #endif
-    {"vkSetDebugUtilsObjectNameEXT", (void*)SetDebugUtilsObjectNameEXT},
-    {"vkSetDebugUtilsObjectTagEXT", (void*)SetDebugUtilsObjectTagEXT},
-    {"vkQueueBeginDebugUtilsLabelEXT", (void*)QueueBeginDebugUtilsLabelEXT},
-    {"vkQueueEndDebugUtilsLabelEXT", (void*)QueueEndDebugUtilsLabelEXT},
-    {"vkQueueInsertDebugUtilsLabelEXT", (void*)QueueInsertDebugUtilsLabelEXT},
-    {"vkCmdBeginDebugUtilsLabelEXT", (void*)CmdBeginDebugUtilsLabelEXT},
-    {"vkCmdEndDebugUtilsLabelEXT", (void*)CmdEndDebugUtilsLabelEXT},
-    {"vkCmdInsertDebugUtilsLabelEXT", (void*)CmdInsertDebugUtilsLabelEXT},
-    {"vkCreateDebugUtilsMessengerEXT", (void*)CreateDebugUtilsMessengerEXT},
-    {"vkDestroyDebugUtilsMessengerEXT", (void*)DestroyDebugUtilsMessengerEXT},
+    {"vkCmdExecuteCommands", (void*)CmdExecuteCommands},
+    {"vkCmdBindVertexBuffers", (void*)CmdBindVertexBuffers},
+    {"vkCmdBeginRenderPass2", (void*)CmdBeginRenderPass2},
+    {"vkGetRefreshCycleDurationGOOGLE", (void*)GetRefreshCycleDurationGOOGLE},
+    {"vkBindImageMemory2", (void*)BindImageMemory2},
+    {"vkCmdBuildAccelerationStructuresIndirectKHR", (void*)CmdBuildAccelerationStructuresIndirectKHR},
+    {"vkCmdSetEvent", (void*)CmdSetEvent},
+    {"vkDestroyBuffer", (void*)DestroyBuffer},
+    {"vkEnumerateInstanceVersion", (void*)EnumerateInstanceVersion},
+    {"vkCmdPreprocessGeneratedCommandsNV", (void*)CmdPreprocessGeneratedCommandsNV},
+    {"vkGetPhysicalDeviceProperties2KHR", (void*)GetPhysicalDeviceProperties2KHR},
+    {"vkGetPhysicalDeviceExternalSemaphorePropertiesKHR", (void*)GetPhysicalDeviceExternalSemaphorePropertiesKHR},
+    {"vkCreateSemaphore", (void*)CreateSemaphore},
+    {"vkGetPhysicalDeviceFeatures2", (void*)GetPhysicalDeviceFeatures2},
+    {"vkDestroyCuFunctionNVX", (void*)DestroyCuFunctionNVX},
+    {"vkCmdClearAttachments", (void*)CmdClearAttachments},
+    {"vkResetQueryPool", (void*)ResetQueryPool},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetDeviceGroupSurfacePresentModes2EXT", (void*)GetDeviceGroupSurfacePresentModes2EXT},
+#else
+    {"vkGetDeviceGroupSurfacePresentModes2EXT", nullptr},
+#endif
+    {"vkCreateDescriptorUpdateTemplate", (void*)CreateDescriptorUpdateTemplate},
+    {"vkGetDeviceAccelerationStructureCompatibilityKHR", (void*)GetDeviceAccelerationStructureCompatibilityKHR},
+    {"vkCmdSetPrimitiveRestartEnableEXT", (void*)CmdSetPrimitiveRestartEnableEXT},
+    {"vkCmdSetPrimitiveTopologyEXT", (void*)CmdSetPrimitiveTopologyEXT},
+    {"vkGetMemoryFdKHR", (void*)GetMemoryFdKHR},
+    {"vkGetDeferredOperationResultKHR", (void*)GetDeferredOperationResultKHR},
+    {"vkCmdWriteAccelerationStructuresPropertiesNV", (void*)CmdWriteAccelerationStructuresPropertiesNV},
+    {"vkGetPhysicalDeviceExternalFencePropertiesKHR", (void*)GetPhysicalDeviceExternalFencePropertiesKHR},
+    {"vkCmdDebugMarkerBeginEXT", (void*)CmdDebugMarkerBeginEXT},
+    {"vkFreeMemory", (void*)FreeMemory},
+    {"vkEnumerateDeviceLayerProperties", (void*)EnumerateDeviceLayerProperties},
+    {"vkCmdBeginQueryIndexedEXT", (void*)CmdBeginQueryIndexedEXT},
+    {"vkDestroyIndirectCommandsLayoutNV", (void*)DestroyIndirectCommandsLayoutNV},
     {"vkSubmitDebugUtilsMessageEXT", (void*)SubmitDebugUtilsMessageEXT},
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-    {"vkGetAndroidHardwareBufferPropertiesANDROID", (void*)GetAndroidHardwareBufferPropertiesANDROID},
+    {"vkCmdPushDescriptorSetWithTemplateKHR", (void*)CmdPushDescriptorSetWithTemplateKHR},
+    {"vkCreateRenderPass2", (void*)CreateRenderPass2},
+    {"vkCmdSetViewport", (void*)CmdSetViewport},
+    {"vkCreateCommandPool", (void*)CreateCommandPool},
+    {"vkGetEventStatus", (void*)GetEventStatus},
+    {"vkGetDeviceMemoryOpaqueCaptureAddress", (void*)GetDeviceMemoryOpaqueCaptureAddress},
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    {"vkGetPhysicalDeviceDirectFBPresentationSupportEXT", (void*)GetPhysicalDeviceDirectFBPresentationSupportEXT},
+#else
+    {"vkGetPhysicalDeviceDirectFBPresentationSupportEXT", nullptr},
 #endif
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-    {"vkGetMemoryAndroidHardwareBufferANDROID", (void*)GetMemoryAndroidHardwareBufferANDROID},
+    {"vkCmdBindDescriptorSets", (void*)CmdBindDescriptorSets},
+    {"vkCmdBeginQuery", (void*)CmdBeginQuery},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkDestroyVideoSessionKHR", (void*)DestroyVideoSessionKHR},
+#else
+    {"vkDestroyVideoSessionKHR", nullptr},
 #endif
-    {"vkCmdSetSampleLocationsEXT", (void*)CmdSetSampleLocationsEXT},
-    {"vkGetPhysicalDeviceMultisamplePropertiesEXT", (void*)GetPhysicalDeviceMultisamplePropertiesEXT},
-    {"vkGetImageDrmFormatModifierPropertiesEXT", (void*)GetImageDrmFormatModifierPropertiesEXT},
-    {"vkCreateValidationCacheEXT", (void*)CreateValidationCacheEXT},
-    {"vkDestroyValidationCacheEXT", (void*)DestroyValidationCacheEXT},
+    {"vkCmdEndConditionalRenderingEXT", (void*)CmdEndConditionalRenderingEXT},
+    {"vkResetCommandPool", (void*)ResetCommandPool},
+    {"vkBindImageMemory2KHR", (void*)BindImageMemory2KHR},
     {"vkMergeValidationCachesEXT", (void*)MergeValidationCachesEXT},
-    {"vkGetValidationCacheDataEXT", (void*)GetValidationCacheDataEXT},
-    {"vkCmdBindShadingRateImageNV", (void*)CmdBindShadingRateImageNV},
-    {"vkCmdSetViewportShadingRatePaletteNV", (void*)CmdSetViewportShadingRatePaletteNV},
-    {"vkCmdSetCoarseSampleOrderNV", (void*)CmdSetCoarseSampleOrderNV},
-    {"vkCreateAccelerationStructureNV", (void*)CreateAccelerationStructureNV},
+    {"vkGetPipelineExecutableStatisticsKHR", (void*)GetPipelineExecutableStatisticsKHR},
+    {"vkGetFenceFdKHR", (void*)GetFenceFdKHR},
+    {"vkCmdBeginConditionalRenderingEXT", (void*)CmdBeginConditionalRenderingEXT},
+    {"vkCreateRenderPass2KHR", (void*)CreateRenderPass2KHR},
+    {"vkCmdBuildAccelerationStructureNV", (void*)CmdBuildAccelerationStructureNV},
+    {"vkCreateEvent", (void*)CreateEvent},
+    {"vkGetPhysicalDeviceFragmentShadingRatesKHR", (void*)GetPhysicalDeviceFragmentShadingRatesKHR},
+    {"vkCreateSampler", (void*)CreateSampler},
+    {"vkQueueInsertDebugUtilsLabelEXT", (void*)QueueInsertDebugUtilsLabelEXT},
+    {"vkCreateDevice", (void*)CreateDevice},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkBindVideoSessionMemoryKHR", (void*)BindVideoSessionMemoryKHR},
+#else
+    {"vkBindVideoSessionMemoryKHR", nullptr},
+#endif
+    {"vkDestroySampler", (void*)DestroySampler},
     {"vkDestroyAccelerationStructureNV", (void*)DestroyAccelerationStructureNV},
+    {"vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV", (void*)GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV},
+    {"vkCmdSetStencilWriteMask", (void*)CmdSetStencilWriteMask},
+    {"vkCmdSetViewportWScalingNV", (void*)CmdSetViewportWScalingNV},
+    {"vkRegisterDisplayEventEXT", (void*)RegisterDisplayEventEXT},
+    {"vkGetImageMemoryRequirements2KHR", (void*)GetImageMemoryRequirements2KHR},
+    {"vkGetBufferMemoryRequirements2", (void*)GetBufferMemoryRequirements2},
+    {"vkGetPhysicalDeviceExternalFenceProperties", (void*)GetPhysicalDeviceExternalFenceProperties},
+    {"vkCmdSetPerformanceOverrideINTEL", (void*)CmdSetPerformanceOverrideINTEL},
+    {"vkDestroySamplerYcbcrConversion", (void*)DestroySamplerYcbcrConversion},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties2", (void*)GetPhysicalDeviceSparseImageFormatProperties2},
+    {"vkUninitializePerformanceApiINTEL", (void*)UninitializePerformanceApiINTEL},
+    {"vkDestroySemaphore", (void*)DestroySemaphore},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdBeginVideoCodingKHR", (void*)CmdBeginVideoCodingKHR},
+#else
+    {"vkCmdBeginVideoCodingKHR", nullptr},
+#endif
+    {"vkCreateRayTracingPipelinesKHR", (void*)CreateRayTracingPipelinesKHR},
+    {"vkGetPhysicalDeviceExternalBufferPropertiesKHR", (void*)GetPhysicalDeviceExternalBufferPropertiesKHR},
+    {"vkCopyAccelerationStructureKHR", (void*)CopyAccelerationStructureKHR},
+    {"vkCmdCopyQueryPoolResults", (void*)CmdCopyQueryPoolResults},
+    {"vkUpdateDescriptorSets", (void*)UpdateDescriptorSets},
     {"vkGetAccelerationStructureMemoryRequirementsNV", (void*)GetAccelerationStructureMemoryRequirementsNV},
-    {"vkBindAccelerationStructureMemoryNV", (void*)BindAccelerationStructureMemoryNV},
-    {"vkCmdBuildAccelerationStructureNV", (void*)CmdBuildAccelerationStructureNV},
-    {"vkCmdCopyAccelerationStructureNV", (void*)CmdCopyAccelerationStructureNV},
-    {"vkCmdTraceRaysNV", (void*)CmdTraceRaysNV},
-    {"vkCreateRayTracingPipelinesNV", (void*)CreateRayTracingPipelinesNV},
-    {"vkGetRayTracingShaderGroupHandlesKHR", (void*)GetRayTracingShaderGroupHandlesKHR},
-    {"vkGetRayTracingShaderGroupHandlesNV", (void*)GetRayTracingShaderGroupHandlesNV},
-    {"vkGetAccelerationStructureHandleNV", (void*)GetAccelerationStructureHandleNV},
-    {"vkCmdWriteAccelerationStructuresPropertiesNV", (void*)CmdWriteAccelerationStructuresPropertiesNV},
-    {"vkCompileDeferredNV", (void*)CompileDeferredNV},
-    {"vkGetMemoryHostPointerPropertiesEXT", (void*)GetMemoryHostPointerPropertiesEXT},
-    {"vkCmdWriteBufferMarkerAMD", (void*)CmdWriteBufferMarkerAMD},
+    {"vkCreateImage", (void*)CreateImage},
     {"vkGetPhysicalDeviceCalibrateableTimeDomainsEXT", (void*)GetPhysicalDeviceCalibrateableTimeDomainsEXT},
-    {"vkGetCalibratedTimestampsEXT", (void*)GetCalibratedTimestampsEXT},
-    {"vkCmdDrawMeshTasksNV", (void*)CmdDrawMeshTasksNV},
-    {"vkCmdDrawMeshTasksIndirectNV", (void*)CmdDrawMeshTasksIndirectNV},
-    {"vkCmdDrawMeshTasksIndirectCountNV", (void*)CmdDrawMeshTasksIndirectCountNV},
+    {"vkCmdEndTransformFeedbackEXT", (void*)CmdEndTransformFeedbackEXT},
+    {"vkSetEvent", (void*)SetEvent},
+    {"vkEnumerateInstanceExtensionProperties", (void*)EnumerateInstanceExtensionProperties},
+    {"vkCmdDraw", (void*)CmdDraw},
+    {"vkCmdBlitImage2KHR", (void*)CmdBlitImage2KHR},
+    {"vkDebugReportMessageEXT", (void*)DebugReportMessageEXT},
+    {"vkGetDeviceGroupPeerMemoryFeatures", (void*)GetDeviceGroupPeerMemoryFeatures},
+    {"vkDestroyPipeline", (void*)DestroyPipeline},
+    {"vkGetImageSubresourceLayout", (void*)GetImageSubresourceLayout},
+    {"vkTrimCommandPool", (void*)TrimCommandPool},
+    {"vkCreateDescriptorPool", (void*)CreateDescriptorPool},
     {"vkCmdSetExclusiveScissorNV", (void*)CmdSetExclusiveScissorNV},
-    {"vkCmdSetCheckpointNV", (void*)CmdSetCheckpointNV},
-    {"vkGetQueueCheckpointDataNV", (void*)GetQueueCheckpointDataNV},
-    {"vkInitializePerformanceApiINTEL", (void*)InitializePerformanceApiINTEL},
-    {"vkUninitializePerformanceApiINTEL", (void*)UninitializePerformanceApiINTEL},
-    {"vkCmdSetPerformanceMarkerINTEL", (void*)CmdSetPerformanceMarkerINTEL},
-    {"vkCmdSetPerformanceStreamMarkerINTEL", (void*)CmdSetPerformanceStreamMarkerINTEL},
-    {"vkCmdSetPerformanceOverrideINTEL", (void*)CmdSetPerformanceOverrideINTEL},
+    {"vkCreateAccelerationStructureNV", (void*)CreateAccelerationStructureNV},
+    {"vkGetBufferOpaqueCaptureAddressKHR", (void*)GetBufferOpaqueCaptureAddressKHR},
+    {"vkAcquireProfilingLockKHR", (void*)AcquireProfilingLockKHR},
+    {"vkCmdCopyBufferToImage2KHR", (void*)CmdCopyBufferToImage2KHR},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkGetSemaphoreZirconHandleFUCHSIA", (void*)GetSemaphoreZirconHandleFUCHSIA},
+#else
+    {"vkGetSemaphoreZirconHandleFUCHSIA", nullptr},
+#endif
+    {"vkCmdDispatch", (void*)CmdDispatch},
+    {"vkGetPhysicalDeviceFormatProperties2", (void*)GetPhysicalDeviceFormatProperties2},
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    {"vkCreateXcbSurfaceKHR", (void*)CreateXcbSurfaceKHR},
+#else
+    {"vkCreateXcbSurfaceKHR", nullptr},
+#endif
+    {"vkCmdSetBlendConstants", (void*)CmdSetBlendConstants},
+    {"vkGetImageSparseMemoryRequirements2KHR", (void*)GetImageSparseMemoryRequirements2KHR},
+    {"vkEnumeratePhysicalDeviceGroups", (void*)EnumeratePhysicalDeviceGroups},
+    {"vkSetPrivateDataEXT", (void*)SetPrivateDataEXT},
+    {"vkCmdEndRenderPass", (void*)CmdEndRenderPass},
+    {"vkCmdSetEvent2KHR", (void*)CmdSetEvent2KHR},
+    {"vkDestroyCuModuleNVX", (void*)DestroyCuModuleNVX},
+    {"vkGetPhysicalDeviceProperties2", (void*)GetPhysicalDeviceProperties2},
+    {"vkGetPastPresentationTimingGOOGLE", (void*)GetPastPresentationTimingGOOGLE},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdEndVideoCodingKHR", (void*)CmdEndVideoCodingKHR},
+#else
+    {"vkCmdEndVideoCodingKHR", nullptr},
+#endif
+    {"vkCmdDrawIndirectCountAMD", (void*)CmdDrawIndirectCountAMD},
+    {"vkBindBufferMemory2", (void*)BindBufferMemory2},
+    {"vkCmdPipelineBarrier2KHR", (void*)CmdPipelineBarrier2KHR},
+    {"vkCmdSetScissor", (void*)CmdSetScissor},
+    {"vkCmdDispatchIndirect", (void*)CmdDispatchIndirect},
+    {"vkCmdResolveImage", (void*)CmdResolveImage},
+    {"vkGetSemaphoreCounterValue", (void*)GetSemaphoreCounterValue},
+    {"vkDestroySwapchainKHR", (void*)DestroySwapchainKHR},
+    {"vkCmdSetStencilCompareMask", (void*)CmdSetStencilCompareMask},
+    {"vkGetSwapchainStatusKHR", (void*)GetSwapchainStatusKHR},
+    {"vkGetPhysicalDeviceSurfacePresentModesKHR", (void*)GetPhysicalDeviceSurfacePresentModesKHR},
+    {"vkCreateImageView", (void*)CreateImageView},
+    {"vkGetImageDrmFormatModifierPropertiesEXT", (void*)GetImageDrmFormatModifierPropertiesEXT},
+    {"vkUnmapMemory", (void*)UnmapMemory},
+    {"vkCreateDisplayPlaneSurfaceKHR", (void*)CreateDisplayPlaneSurfaceKHR},
+    {"vkGetSwapchainCounterEXT", (void*)GetSwapchainCounterEXT},
+    {"vkGetPhysicalDeviceQueueFamilyProperties", (void*)GetPhysicalDeviceQueueFamilyProperties},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkGetMemoryZirconHandleFUCHSIA", (void*)GetMemoryZirconHandleFUCHSIA},
+#else
+    {"vkGetMemoryZirconHandleFUCHSIA", nullptr},
+#endif
+    {"vkGetImageMemoryRequirements2", (void*)GetImageMemoryRequirements2},
+    {"vkBindBufferMemory2KHR", (void*)BindBufferMemory2KHR},
+    {"vkCmdDrawIndexed", (void*)CmdDrawIndexed},
+    {"vkCmdSetScissorWithCountEXT", (void*)CmdSetScissorWithCountEXT},
+    {"vkCreateDeferredOperationKHR", (void*)CreateDeferredOperationKHR},
+    {"vkCopyAccelerationStructureToMemoryKHR", (void*)CopyAccelerationStructureToMemoryKHR},
+    {"vkCreateValidationCacheEXT", (void*)CreateValidationCacheEXT},
+    {"vkGetDisplayPlaneCapabilities2KHR", (void*)GetDisplayPlaneCapabilities2KHR},
+    {"vkBindBufferMemory", (void*)BindBufferMemory},
     {"vkAcquirePerformanceConfigurationINTEL", (void*)AcquirePerformanceConfigurationINTEL},
-    {"vkReleasePerformanceConfigurationINTEL", (void*)ReleasePerformanceConfigurationINTEL},
-    {"vkQueueSetPerformanceConfigurationINTEL", (void*)QueueSetPerformanceConfigurationINTEL},
-    {"vkGetPerformanceParameterINTEL", (void*)GetPerformanceParameterINTEL},
-    {"vkSetLocalDimmingAMD", (void*)SetLocalDimmingAMD},
+    {"vkCmdEndRenderPass2", (void*)CmdEndRenderPass2},
+    {"vkCmdWaitEvents2KHR", (void*)CmdWaitEvents2KHR},
+    {"vkGetPhysicalDeviceImageFormatProperties", (void*)GetPhysicalDeviceImageFormatProperties},
+    {"vkCmdResetQueryPool", (void*)CmdResetQueryPool},
+    {"vkDebugMarkerSetObjectTagEXT", (void*)DebugMarkerSetObjectTagEXT},
+    {"vkCmdDebugMarkerEndEXT", (void*)CmdDebugMarkerEndEXT},
+    {"vkGetPhysicalDeviceSurfaceFormatsKHR", (void*)GetPhysicalDeviceSurfaceFormatsKHR},
+    {"vkCreateIndirectCommandsLayoutNV", (void*)CreateIndirectCommandsLayoutNV},
+    {"vkCmdPushDescriptorSetKHR", (void*)CmdPushDescriptorSetKHR},
+    {"vkCmdCopyBuffer", (void*)CmdCopyBuffer},
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    {"vkCreateDirectFBSurfaceEXT", (void*)CreateDirectFBSurfaceEXT},
+#else
+    {"vkCreateDirectFBSurfaceEXT", nullptr},
+#endif
+    {"vkQueueWaitIdle", (void*)QueueWaitIdle},
+    {"vkReleasePerformanceConfigurationINTEL", (void*)ReleasePerformanceConfigurationINTEL},
+    {"vkCmdSetDepthWriteEnableEXT", (void*)CmdSetDepthWriteEnableEXT},
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    {"vkCreateImagePipeSurfaceFUCHSIA", (void*)CreateImagePipeSurfaceFUCHSIA},
+    {"vkGetMemoryZirconHandlePropertiesFUCHSIA", (void*)GetMemoryZirconHandlePropertiesFUCHSIA},
+#else
+    {"vkGetMemoryZirconHandlePropertiesFUCHSIA", nullptr},
 #endif
-#ifdef VK_USE_PLATFORM_METAL_EXT
-    {"vkCreateMetalSurfaceEXT", (void*)CreateMetalSurfaceEXT},
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    {"vkGetPhysicalDeviceXlibPresentationSupportKHR", (void*)GetPhysicalDeviceXlibPresentationSupportKHR},
+#else
+    {"vkGetPhysicalDeviceXlibPresentationSupportKHR", nullptr},
 #endif
-    {"vkGetBufferDeviceAddressEXT", (void*)GetBufferDeviceAddressEXT},
-    {"vkGetPhysicalDeviceToolPropertiesEXT", (void*)GetPhysicalDeviceToolPropertiesEXT},
-    {"vkGetPhysicalDeviceCooperativeMatrixPropertiesNV", (void*)GetPhysicalDeviceCooperativeMatrixPropertiesNV},
-    {"vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV", (void*)GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV},
+    {"vkCmdSetPatchControlPointsEXT", (void*)CmdSetPatchControlPointsEXT},
+    {"vkAcquireNextImage2KHR", (void*)AcquireNextImage2KHR},
+    {"vkDestroyDebugReportCallbackEXT", (void*)DestroyDebugReportCallbackEXT},
+    {"vkCmdCopyImage2KHR", (void*)CmdCopyImage2KHR},
+    {"vkCmdSetCoarseSampleOrderNV", (void*)CmdSetCoarseSampleOrderNV},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkGetPhysicalDeviceSurfacePresentModes2EXT", (void*)GetPhysicalDeviceSurfacePresentModes2EXT},
+    {"vkAcquireWinrtDisplayNV", (void*)AcquireWinrtDisplayNV},
+#else
+    {"vkAcquireWinrtDisplayNV", nullptr},
 #endif
+    {"vkGetDescriptorSetLayoutSupport", (void*)GetDescriptorSetLayoutSupport},
+    {"vkGetPhysicalDeviceDisplayPropertiesKHR", (void*)GetPhysicalDeviceDisplayPropertiesKHR},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkAcquireFullScreenExclusiveModeEXT", (void*)AcquireFullScreenExclusiveModeEXT},
+    {"vkGetWinrtDisplayNV", (void*)GetWinrtDisplayNV},
+#else
+    {"vkGetWinrtDisplayNV", nullptr},
 #endif
+    {"vkDestroyCommandPool", (void*)DestroyCommandPool},
+    {"vkCreateFence", (void*)CreateFence},
+    {"vkCmdBindShadingRateImageNV", (void*)CmdBindShadingRateImageNV},
+    {"vkDestroyImageView", (void*)DestroyImageView},
+    {"vkCmdDrawMeshTasksNV", (void*)CmdDrawMeshTasksNV},
+    {"vkCmdDrawIndexedIndirectCountAMD", (void*)CmdDrawIndexedIndirectCountAMD},
+    {"vkGetPhysicalDeviceToolPropertiesEXT", (void*)GetPhysicalDeviceToolPropertiesEXT},
+    {"vkGetPhysicalDeviceExternalImageFormatPropertiesNV", (void*)GetPhysicalDeviceExternalImageFormatPropertiesNV},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     {"vkReleaseFullScreenExclusiveModeEXT", (void*)ReleaseFullScreenExclusiveModeEXT},
+#else
+    {"vkReleaseFullScreenExclusiveModeEXT", nullptr},
 #endif
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkGetDeviceGroupSurfacePresentModes2EXT", (void*)GetDeviceGroupSurfacePresentModes2EXT},
+    {"vkGetAccelerationStructureHandleNV", (void*)GetAccelerationStructureHandleNV},
+    {"vkCmdClearColorImage", (void*)CmdClearColorImage},
+    {"vkFlushMappedMemoryRanges", (void*)FlushMappedMemoryRanges},
+    {"vkCmdUpdateBuffer", (void*)CmdUpdateBuffer},
+    {"vkCmdBeginRenderPass2KHR", (void*)CmdBeginRenderPass2KHR},
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {"vkGetMemoryAndroidHardwareBufferANDROID", (void*)GetMemoryAndroidHardwareBufferANDROID},
+#else
+    {"vkGetMemoryAndroidHardwareBufferANDROID", nullptr},
 #endif
-    {"vkCreateHeadlessSurfaceEXT", (void*)CreateHeadlessSurfaceEXT},
-    {"vkCmdSetLineStippleEXT", (void*)CmdSetLineStippleEXT},
-    {"vkResetQueryPoolEXT", (void*)ResetQueryPoolEXT},
-    {"vkCmdSetCullModeEXT", (void*)CmdSetCullModeEXT},
-    {"vkCmdSetFrontFaceEXT", (void*)CmdSetFrontFaceEXT},
-    {"vkCmdSetPrimitiveTopologyEXT", (void*)CmdSetPrimitiveTopologyEXT},
-    {"vkCmdSetViewportWithCountEXT", (void*)CmdSetViewportWithCountEXT},
-    {"vkCmdSetScissorWithCountEXT", (void*)CmdSetScissorWithCountEXT},
+    {"vkBindImageMemory", (void*)BindImageMemory},
+    {"vkGetPipelineCacheData", (void*)GetPipelineCacheData},
+    {"vkCreateGraphicsPipelines", (void*)CreateGraphicsPipelines},
     {"vkCmdBindVertexBuffers2EXT", (void*)CmdBindVertexBuffers2EXT},
-    {"vkCmdSetDepthTestEnableEXT", (void*)CmdSetDepthTestEnableEXT},
-    {"vkCmdSetDepthWriteEnableEXT", (void*)CmdSetDepthWriteEnableEXT},
-    {"vkCmdSetDepthCompareOpEXT", (void*)CmdSetDepthCompareOpEXT},
-    {"vkCmdSetDepthBoundsTestEnableEXT", (void*)CmdSetDepthBoundsTestEnableEXT},
-    {"vkCmdSetStencilTestEnableEXT", (void*)CmdSetStencilTestEnableEXT},
-    {"vkCmdSetStencilOpEXT", (void*)CmdSetStencilOpEXT},
-    {"vkGetGeneratedCommandsMemoryRequirementsNV", (void*)GetGeneratedCommandsMemoryRequirementsNV},
-    {"vkCmdPreprocessGeneratedCommandsNV", (void*)CmdPreprocessGeneratedCommandsNV},
-    {"vkCmdExecuteGeneratedCommandsNV", (void*)CmdExecuteGeneratedCommandsNV},
-    {"vkCmdBindPipelineShaderGroupNV", (void*)CmdBindPipelineShaderGroupNV},
-    {"vkCreateIndirectCommandsLayoutNV", (void*)CreateIndirectCommandsLayoutNV},
-    {"vkDestroyIndirectCommandsLayoutNV", (void*)DestroyIndirectCommandsLayoutNV},
+    {"vkCmdCopyMemoryToAccelerationStructureKHR", (void*)CmdCopyMemoryToAccelerationStructureKHR},
+    {"vkCmdSetRayTracingPipelineStackSizeKHR", (void*)CmdSetRayTracingPipelineStackSizeKHR},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCreateVideoSessionKHR", (void*)CreateVideoSessionKHR},
+#else
+    {"vkCreateVideoSessionKHR", nullptr},
+#endif
+    {"vkFreeCommandBuffers", (void*)FreeCommandBuffers},
+    {"vkGetValidationCacheDataEXT", (void*)GetValidationCacheDataEXT},
+    {"vkGetDeviceGroupSurfacePresentModesKHR", (void*)GetDeviceGroupSurfacePresentModesKHR},
     {"vkCreatePrivateDataSlotEXT", (void*)CreatePrivateDataSlotEXT},
-    {"vkDestroyPrivateDataSlotEXT", (void*)DestroyPrivateDataSlotEXT},
-    {"vkSetPrivateDataEXT", (void*)SetPrivateDataEXT},
-    {"vkGetPrivateDataEXT", (void*)GetPrivateDataEXT},
-    {"vkCmdSetFragmentShadingRateEnumNV", (void*)CmdSetFragmentShadingRateEnumNV},
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkAcquireWinrtDisplayNV", (void*)AcquireWinrtDisplayNV},
+    {"vkCmdSetFrontFaceEXT", (void*)CmdSetFrontFaceEXT},
+    {"vkCmdPipelineBarrier", (void*)CmdPipelineBarrier},
+    {"vkCmdEndRenderPass2KHR", (void*)CmdEndRenderPass2KHR},
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {"vkAcquireXlibDisplayEXT", (void*)AcquireXlibDisplayEXT},
+#else
+    {"vkAcquireXlibDisplayEXT", nullptr},
 #endif
+    {"vkCreateDescriptorUpdateTemplateKHR", (void*)CreateDescriptorUpdateTemplateKHR},
+    {"vkCreateBuffer", (void*)CreateBuffer},
+    {"vkCreateShaderModule", (void*)CreateShaderModule},
+    {"vkGetDeviceProcAddr", (void*)GetDeviceProcAddr},
+    {"vkCmdInsertDebugUtilsLabelEXT", (void*)CmdInsertDebugUtilsLabelEXT},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    {"vkGetWinrtDisplayNV", (void*)GetWinrtDisplayNV},
-#endif
-#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-    {"vkCreateDirectFBSurfaceEXT", (void*)CreateDirectFBSurfaceEXT},
+    {"vkGetMemoryWin32HandlePropertiesKHR", (void*)GetMemoryWin32HandlePropertiesKHR},
+#else
+    {"vkGetMemoryWin32HandlePropertiesKHR", nullptr},
 #endif
-#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-    {"vkGetPhysicalDeviceDirectFBPresentationSupportEXT", (void*)GetPhysicalDeviceDirectFBPresentationSupportEXT},
+    {"vkDestroySamplerYcbcrConversionKHR", (void*)DestroySamplerYcbcrConversionKHR},
+    {"vkCmdSetFragmentShadingRateKHR", (void*)CmdSetFragmentShadingRateKHR},
+    {"vkCmdSetLineWidth", (void*)CmdSetLineWidth},
+#ifdef VK_USE_PLATFORM_GGP
+    {"vkCreateStreamDescriptorSurfaceGGP", (void*)CreateStreamDescriptorSurfaceGGP},
+#else
+    {"vkCreateStreamDescriptorSurfaceGGP", nullptr},
 #endif
-    {"vkCmdSetVertexInputEXT", (void*)CmdSetVertexInputEXT},
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    {"vkGetMemoryZirconHandleFUCHSIA", (void*)GetMemoryZirconHandleFUCHSIA},
+    {"vkGetDisplayPlaneSupportedDisplaysKHR", (void*)GetDisplayPlaneSupportedDisplaysKHR},
+    {"vkCmdTraceRaysKHR", (void*)CmdTraceRaysKHR},
+    {"vkCmdSetCullModeEXT", (void*)CmdSetCullModeEXT},
+    {"vkCmdSetDepthBiasEnableEXT", (void*)CmdSetDepthBiasEnableEXT},
+    {"vkCmdCopyImage", (void*)CmdCopyImage},
+    {"vkCmdResetEvent2KHR", (void*)CmdResetEvent2KHR},
+    {"vkGetRayTracingShaderGroupStackSizeKHR", (void*)GetRayTracingShaderGroupStackSizeKHR},
+    {"vkDestroyAccelerationStructureKHR", (void*)DestroyAccelerationStructureKHR},
+    {"vkDestroyDeferredOperationKHR", (void*)DestroyDeferredOperationKHR},
+    {"vkGetGeneratedCommandsMemoryRequirementsNV", (void*)GetGeneratedCommandsMemoryRequirementsNV},
+    {"vkGetSemaphoreCounterValueKHR", (void*)GetSemaphoreCounterValueKHR},
+    {"vkDestroyPipelineCache", (void*)DestroyPipelineCache},
+    {"vkCmdSetDeviceMaskKHR", (void*)CmdSetDeviceMaskKHR},
+    {"vkCmdDispatchBaseKHR", (void*)CmdDispatchBaseKHR},
+    {"vkCmdCopyAccelerationStructureKHR", (void*)CmdCopyAccelerationStructureKHR},
+    {"vkDestroyQueryPool", (void*)DestroyQueryPool},
+    {"vkDestroyDescriptorUpdateTemplate", (void*)DestroyDescriptorUpdateTemplate},
+    {"vkGetBufferMemoryRequirements2KHR", (void*)GetBufferMemoryRequirements2KHR},
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {"vkCreateAndroidSurfaceKHR", (void*)CreateAndroidSurfaceKHR},
+#else
+    {"vkCreateAndroidSurfaceKHR", nullptr},
 #endif
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    {"vkGetMemoryZirconHandlePropertiesFUCHSIA", (void*)GetMemoryZirconHandlePropertiesFUCHSIA},
+    {"vkCmdSetViewportShadingRatePaletteNV", (void*)CmdSetViewportShadingRatePaletteNV},
+    {"vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR", (void*)EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR},
+    {"vkCmdExecuteGeneratedCommandsNV", (void*)CmdExecuteGeneratedCommandsNV},
+    {"vkGetPhysicalDeviceMemoryProperties2", (void*)GetPhysicalDeviceMemoryProperties2},
+    {"vkGetPhysicalDeviceDisplayPlanePropertiesKHR", (void*)GetPhysicalDeviceDisplayPlanePropertiesKHR},
+    {"vkCreateSwapchainKHR", (void*)CreateSwapchainKHR},
+    {"vkDestroyShaderModule", (void*)DestroyShaderModule},
+    {"vkCreateSharedSwapchainsKHR", (void*)CreateSharedSwapchainsKHR},
+    {"vkCreateAccelerationStructureKHR", (void*)CreateAccelerationStructureKHR},
+    {"vkGetPhysicalDeviceMemoryProperties", (void*)GetPhysicalDeviceMemoryProperties},
+    {"vkGetPhysicalDeviceProperties", (void*)GetPhysicalDeviceProperties},
+    {"vkGetImageMemoryRequirements", (void*)GetImageMemoryRequirements},
+    {"vkGetPerformanceParameterINTEL", (void*)GetPerformanceParameterINTEL},
+    {"vkResetDescriptorPool", (void*)ResetDescriptorPool},
+    {"vkGetAccelerationStructureBuildSizesKHR", (void*)GetAccelerationStructureBuildSizesKHR},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdEncodeVideoKHR", (void*)CmdEncodeVideoKHR},
+#else
+    {"vkCmdEncodeVideoKHR", nullptr},
 #endif
+    {"vkCmdNextSubpass2KHR", (void*)CmdNextSubpass2KHR},
+    {"vkCreateBufferView", (void*)CreateBufferView},
+    {"vkCreateDebugReportCallbackEXT", (void*)CreateDebugReportCallbackEXT},
+    {"vkDestroyEvent", (void*)DestroyEvent},
+    {"vkGetPhysicalDeviceImageFormatProperties2KHR", (void*)GetPhysicalDeviceImageFormatProperties2KHR},
+    {"vkCmdCopyImageToBuffer", (void*)CmdCopyImageToBuffer},
+    {"vkRegisterDeviceEventEXT", (void*)RegisterDeviceEventEXT},
+    {"vkReleaseDisplayEXT", (void*)ReleaseDisplayEXT},
+    {"vkGetRayTracingShaderGroupHandlesKHR", (void*)GetRayTracingShaderGroupHandlesKHR},
+    {"vkSetLocalDimmingAMD", (void*)SetLocalDimmingAMD},
+    {"vkCmdWaitEvents", (void*)CmdWaitEvents},
+    {"vkCreateCuFunctionNVX", (void*)CreateCuFunctionNVX},
 #ifdef VK_USE_PLATFORM_FUCHSIA
     {"vkImportSemaphoreZirconHandleFUCHSIA", (void*)ImportSemaphoreZirconHandleFUCHSIA},
+#else
+    {"vkImportSemaphoreZirconHandleFUCHSIA", nullptr},
 #endif
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    {"vkGetSemaphoreZirconHandleFUCHSIA", (void*)GetSemaphoreZirconHandleFUCHSIA},
+    {"vkGetPhysicalDeviceFeatures", (void*)GetPhysicalDeviceFeatures},
+    {"vkGetPhysicalDeviceImageFormatProperties2", (void*)GetPhysicalDeviceImageFormatProperties2},
+    {"vkDestroyFence", (void*)DestroyFence},
+    {"vkGetQueryPoolResults", (void*)GetQueryPoolResults},
+    {"vkSignalSemaphore", (void*)SignalSemaphore},
+    {"vkGetPhysicalDeviceSurfaceCapabilities2KHR", (void*)GetPhysicalDeviceSurfaceCapabilities2KHR},
+    {"vkDestroyDescriptorUpdateTemplateKHR", (void*)DestroyDescriptorUpdateTemplateKHR},
+    {"vkGetPhysicalDeviceSurfaceCapabilities2EXT", (void*)GetPhysicalDeviceSurfaceCapabilities2EXT},
+    {"vkGetImageViewAddressNVX", (void*)GetImageViewAddressNVX},
+    {"vkGetPhysicalDeviceSurfaceCapabilitiesKHR", (void*)GetPhysicalDeviceSurfaceCapabilitiesKHR},
+    {"vkCmdCuLaunchKernelNVX", (void*)CmdCuLaunchKernelNVX},
+    {"vkDebugMarkerSetObjectNameEXT", (void*)DebugMarkerSetObjectNameEXT},
+    {"vkCmdDrawIndirectCount", (void*)CmdDrawIndirectCount},
+    {"vkGetRenderAreaGranularity", (void*)GetRenderAreaGranularity},
+    {"vkGetSwapchainImagesKHR", (void*)GetSwapchainImagesKHR},
+    {"vkQueueSetPerformanceConfigurationINTEL", (void*)QueueSetPerformanceConfigurationINTEL},
+    {"vkGetMemoryFdPropertiesKHR", (void*)GetMemoryFdPropertiesKHR},
+    {"vkCmdEndQueryIndexedEXT", (void*)CmdEndQueryIndexedEXT},
+    {"vkCmdSetPerformanceStreamMarkerINTEL", (void*)CmdSetPerformanceStreamMarkerINTEL},
+    {"vkCmdDrawIndexedIndirectCountKHR", (void*)CmdDrawIndexedIndirectCountKHR},
+    {"vkFreeDescriptorSets", (void*)FreeDescriptorSets},
+    {"vkGetImageViewHandleNVX", (void*)GetImageViewHandleNVX},
+    {"vkEndCommandBuffer", (void*)EndCommandBuffer},
+    {"vkCmdBuildAccelerationStructuresKHR", (void*)CmdBuildAccelerationStructuresKHR},
+    {"vkCmdBeginTransformFeedbackEXT", (void*)CmdBeginTransformFeedbackEXT},
+    {"vkResetCommandBuffer", (void*)ResetCommandBuffer},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetFenceWin32HandleKHR", (void*)GetFenceWin32HandleKHR},
+#else
+    {"vkGetFenceWin32HandleKHR", nullptr},
 #endif
-    {"vkCmdSetPatchControlPointsEXT", (void*)CmdSetPatchControlPointsEXT},
-    {"vkCmdSetRasterizerDiscardEnableEXT", (void*)CmdSetRasterizerDiscardEnableEXT},
-    {"vkCmdSetDepthBiasEnableEXT", (void*)CmdSetDepthBiasEnableEXT},
-    {"vkCmdSetLogicOpEXT", (void*)CmdSetLogicOpEXT},
-    {"vkCmdSetPrimitiveRestartEnableEXT", (void*)CmdSetPrimitiveRestartEnableEXT},
-#ifdef VK_USE_PLATFORM_SCREEN_QNX
-    {"vkCreateScreenSurfaceQNX", (void*)CreateScreenSurfaceQNX},
+    {"vkGetMemoryHostPointerPropertiesEXT", (void*)GetMemoryHostPointerPropertiesEXT},
+    {"vkCmdWriteBufferMarkerAMD", (void*)CmdWriteBufferMarkerAMD},
+    {"vkSignalSemaphoreKHR", (void*)SignalSemaphoreKHR},
+    {"vkGetDisplayPlaneCapabilitiesKHR", (void*)GetDisplayPlaneCapabilitiesKHR},
+    {"vkEnumeratePhysicalDeviceGroupsKHR", (void*)EnumeratePhysicalDeviceGroupsKHR},
+    {"vkCmdResolveImage2KHR", (void*)CmdResolveImage2KHR},
+    {"vkMapMemory", (void*)MapMemory},
+    {"vkGetBufferMemoryRequirements", (void*)GetBufferMemoryRequirements},
+    {"vkCmdSetDepthTestEnableEXT", (void*)CmdSetDepthTestEnableEXT},
+    {"vkGetDeferredOperationMaxConcurrencyKHR", (void*)GetDeferredOperationMaxConcurrencyKHR},
+    {"vkCmdWriteAccelerationStructuresPropertiesKHR", (void*)CmdWriteAccelerationStructuresPropertiesKHR},
+    {"vkCmdDrawMeshTasksIndirectNV", (void*)CmdDrawMeshTasksIndirectNV},
+    {"vkCmdCopyBufferToImage", (void*)CmdCopyBufferToImage},
+    {"vkInvalidateMappedMemoryRanges", (void*)InvalidateMappedMemoryRanges},
+    {"vkGetDeviceQueue2", (void*)GetDeviceQueue2},
+    {"vkCreateHeadlessSurfaceEXT", (void*)CreateHeadlessSurfaceEXT},
+    {"vkDeviceWaitIdle", (void*)DeviceWaitIdle},
+    {"vkSetDebugUtilsObjectTagEXT", (void*)SetDebugUtilsObjectTagEXT},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties2KHR", (void*)GetPhysicalDeviceSparseImageFormatProperties2KHR},
+    {"vkAllocateCommandBuffers", (void*)AllocateCommandBuffers},
+    {"vkGetSemaphoreFdKHR", (void*)GetSemaphoreFdKHR},
+    {"vkGetImageSparseMemoryRequirements2", (void*)GetImageSparseMemoryRequirements2},
+    {"vkCompileDeferredNV", (void*)CompileDeferredNV},
+    {"vkCmdSetCheckpointNV", (void*)CmdSetCheckpointNV},
+    {"vkReleaseProfilingLockKHR", (void*)ReleaseProfilingLockKHR},
+    {"vkCmdClearDepthStencilImage", (void*)CmdClearDepthStencilImage},
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    {"vkCreateMacOSSurfaceMVK", (void*)CreateMacOSSurfaceMVK},
+#else
+    {"vkCreateMacOSSurfaceMVK", nullptr},
 #endif
-#ifdef VK_USE_PLATFORM_SCREEN_QNX
-    {"vkGetPhysicalDeviceScreenPresentationSupportQNX", (void*)GetPhysicalDeviceScreenPresentationSupportQNX},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkCreateImagePipeSurfaceFUCHSIA", (void*)CreateImagePipeSurfaceFUCHSIA},
+#else
+    {"vkCreateImagePipeSurfaceFUCHSIA", nullptr},
 #endif
-    {"vkCmdSetColorWriteEnableEXT", (void*)CmdSetColorWriteEnableEXT},
-    {"vkCreateAccelerationStructureKHR", (void*)CreateAccelerationStructureKHR},
-    {"vkDestroyAccelerationStructureKHR", (void*)DestroyAccelerationStructureKHR},
-    {"vkCmdBuildAccelerationStructuresKHR", (void*)CmdBuildAccelerationStructuresKHR},
-    {"vkCmdBuildAccelerationStructuresIndirectKHR", (void*)CmdBuildAccelerationStructuresIndirectKHR},
-    {"vkBuildAccelerationStructuresKHR", (void*)BuildAccelerationStructuresKHR},
-    {"vkCopyAccelerationStructureKHR", (void*)CopyAccelerationStructureKHR},
-    {"vkCopyAccelerationStructureToMemoryKHR", (void*)CopyAccelerationStructureToMemoryKHR},
-    {"vkCopyMemoryToAccelerationStructureKHR", (void*)CopyMemoryToAccelerationStructureKHR},
-    {"vkWriteAccelerationStructuresPropertiesKHR", (void*)WriteAccelerationStructuresPropertiesKHR},
-    {"vkCmdCopyAccelerationStructureKHR", (void*)CmdCopyAccelerationStructureKHR},
-    {"vkCmdCopyAccelerationStructureToMemoryKHR", (void*)CmdCopyAccelerationStructureToMemoryKHR},
-    {"vkCmdCopyMemoryToAccelerationStructureKHR", (void*)CmdCopyMemoryToAccelerationStructureKHR},
-    {"vkGetAccelerationStructureDeviceAddressKHR", (void*)GetAccelerationStructureDeviceAddressKHR},
-    {"vkCmdWriteAccelerationStructuresPropertiesKHR", (void*)CmdWriteAccelerationStructuresPropertiesKHR},
-    {"vkGetDeviceAccelerationStructureCompatibilityKHR", (void*)GetDeviceAccelerationStructureCompatibilityKHR},
-    {"vkGetAccelerationStructureBuildSizesKHR", (void*)GetAccelerationStructureBuildSizesKHR},
-    {"vkCmdTraceRaysKHR", (void*)CmdTraceRaysKHR},
-    {"vkCreateRayTracingPipelinesKHR", (void*)CreateRayTracingPipelinesKHR},
-    {"vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", (void*)GetRayTracingCaptureReplayShaderGroupHandlesKHR},
-    {"vkCmdTraceRaysIndirectKHR", (void*)CmdTraceRaysIndirectKHR},
-    {"vkGetRayTracingShaderGroupStackSizeKHR", (void*)GetRayTracingShaderGroupStackSizeKHR},
-    {"vkCmdSetRayTracingPipelineStackSizeKHR", (void*)CmdSetRayTracingPipelineStackSizeKHR},
+    {"vkCreateInstance", (void*)CreateInstance},
+    {"vkGetPhysicalDeviceFeatures2KHR", (void*)GetPhysicalDeviceFeatures2KHR},
+    {"vkCreatePipelineLayout", (void*)CreatePipelineLayout},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkImportSemaphoreWin32HandleKHR", (void*)ImportSemaphoreWin32HandleKHR},
+#else
+    {"vkImportSemaphoreWin32HandleKHR", nullptr},
+#endif
+    {"vkInitializePerformanceApiINTEL", (void*)InitializePerformanceApiINTEL},
+    {"vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR", (void*)GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR},
+    {"vkCreateSamplerYcbcrConversion", (void*)CreateSamplerYcbcrConversion},
+};
+// Displacement of each bucket of names in kProcTable
+static const uint16_t kProcDisplacements[122] = {
+    35, 35, 4, 4, 17, 11, 4, 9, 113, 152, 1, 18, 13, 49, 2, 3,
+    43, 7, 1, 4, 67, 193, 11, 6, 0, 16, 117, 37, 232, 6, 0, 421,
+    1, 30, 6, 1, 7, 21, 278, 32, 5, 61, 0, 23, 0, 873, 55, 51,
+    14, 12, 890, 116, 165, 165, 0, 315, 9, 48, 159, 0, 60, 1362, 70, 15,
+    13, 3, 310, 102, 3, 282, 18, 4, 12, 148, 4, 68, 50, 0, 2730, 66,
+    192, 13, 138, 530, 97, 9, 19, 0, 52, 212, 53, 0, 10, 145, 616, 35,
+    39, 1, 14, 18, 161, 573, 105, 403, 744, 51, 1, 485, 3, 1, 279, 2,
+    35, 1806, 799, 10, 190, 24, 580, 16, 63, 2139,
 };
-
 
 } // namespace vkmock
 
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+#include "mock_icd_config.h"
+#include "mock_icd_proc_table.h"
+
+// With VKMOCK_CALL_STATS set, the mock ICD counts the calls the app makes to each entry point and how many cycles each
+// took, in a histogram of power of two buckets. mock_icd_generator.py generates an entry point for each API that times the
+// call, see CountedCreateInstance() etc. at the end of mock_icd.cpp, which GetInstanceProcAddr only returns while calls are
+// being counted, so counting costs nothing otherwise. Each thread counts its calls in memory of its own, and the counts of
+// every thread are added up when they're written out, at vkDestroyInstance or on SIGUSR1.
+
+namespace vkmock {
+
+// Bucket i counts calls taking 2^i up to 2^(i+1) cycles, except that bucket 0 also counts calls under a cycle and the last
+// bucket every call longer than that
+static constexpr uint32_t kCallLatencyBuckets = 40;
+
+// The CPU's cycle counter, or nanoseconds of the steady clock on CPUs without one that can be read
+static inline uint64_t ReadCycleCounter() {
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+static inline uint32_t CallLatencyBucket(uint64_t cycles) {
+#if defined(__GNUC__)
+    const uint32_t bucket = cycles ? 63 - __builtin_clzll(cycles) : 0;
+#else
+    uint32_t bucket = 0;
+    while (cycles >>= 1) ++bucket;
+#endif
+    return (std::min)(bucket, kCallLatencyBuckets - 1);
+}
+
+// One thread's calls of one entry point. Only that thread writes it, so it adds without atomic read-modify-writes, while
+// dumps read it from other threads.
+struct EntryPointCallStats {
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> cycles;
+    std::atomic<uint64_t> buckets[kCallLatencyBuckets];
+};
+
+class CallStats {
+  public:
+    // Returns nullptr unless VKMOCK_CALL_STATS names the file to write the counts to, as CSV if its name ends in .csv and
+    // as JSON otherwise
+    static CallStats *Open(const ProcEntry *entry_points, size_t entry_point_count) {
+        const char *path = GetConfigString("VKMOCK_CALL_STATS");
+        if (!path) return nullptr;
+        CallStats *call_stats = new CallStats(entry_points, entry_point_count, path);
+#if !defined(_WIN32)
+        call_stats->DumpOnSignal();
+#endif
+        return call_stats;
+    }
+
+    void Record(size_t entry_point, uint64_t cycles) {
+        static thread_local std::atomic<EntryPointCallStats *> *thread_stats = nullptr;
+        if (!thread_stats) thread_stats = AddThread();
+        EntryPointCallStats *stats = thread_stats[entry_point].load(std::memory_order_relaxed);
+        if (!stats) {
+            // Value-initializing zeroes the counts
+            stats = new EntryPointCallStats();
+            thread_stats[entry_point].store(stats, std::memory_order_release);
+        }
+        Add(&stats->calls, 1);
+        Add(&stats->cycles, cycles);
+        Add(&stats->buckets[CallLatencyBucket(cycles)], 1);
+    }
+
+    // Writes the counts of every call so far, replacing what the file held
+    void Dump() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<Totals> totals(entry_point_count_);
+        for (const auto &thread_stats : threads_) {
+            for (size_t i = 0; i < entry_point_count_; ++i) {
+                const EntryPointCallStats *stats = thread_stats[i].load(std::memory_order_acquire);
+                if (!stats) continue;
+                totals[i].entry_point = i;
+                totals[i].calls += stats->calls.load(std::memory_order_relaxed);
+                totals[i].cycles += stats->cycles.load(std::memory_order_relaxed);
+                for (uint32_t j = 0; j < kCallLatencyBuckets; ++j) {
+                    totals[i].buckets[j] += stats->buckets[j].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        // Frames end with a present
+        const uint64_t frames = present_entry_point_ < entry_point_count_ ? totals[present_entry_point_].calls : 0;
+        totals.erase(std::remove_if(totals.begin(), totals.end(), [](const Totals &entry) { return entry.calls == 0; }),
+                     totals.end());
+        std::sort(totals.begin(), totals.end(), [](const Totals &a, const Totals &b) { return a.cycles > b.cycles; });
+
+        FILE *file = fopen(path_.c_str(), "w");
+        if (!file) {
+            fprintf(stderr, "vkmock: VKMOCK_CALL_STATS: can't write \"%s\"\n", path_.c_str());
+            return;
+        }
+        const double cycles_per_ns = CyclesPerNanosecond();
+        const bool csv = path_.size() >= 4 && path_.compare(path_.size() - 4, 4, ".csv") == 0;
+        if (csv) {
+            fprintf(file, "name,calls,calls_per_frame,cycles,mean_ns,p50_cycles,p99_cycles");
+            for (uint32_t j = 0; j < kCallLatencyBuckets; ++j) fprintf(file, ",%llu", BucketStart(j));
+            fprintf(file, "\n");
+        } else {
+            fprintf(file, "{\n  \"frames\": %llu,\n  \"cycles_per_ns\": %.4f,\n  \"entry_points\": [", (unsigned long long)frames,
+                    cycles_per_ns);
+        }
+        for (size_t i = 0; i < totals.size(); ++i) {
+            const Totals &entry = totals[i];
+            const char *name = entry_points_[entry.entry_point].name;
+            const double calls_per_frame = frames ? double(entry.calls) / frames : 0.0;
+            const double mean_ns = double(entry.cycles) / entry.calls / cycles_per_ns;
+            if (csv) {
+                fprintf(file, "%s,%llu,%.3f,%llu,%.1f,%llu,%llu", name, (unsigned long long)entry.calls, calls_per_frame,
+                        (unsigned long long)entry.cycles, mean_ns, Percentile(entry, 0.5), Percentile(entry, 0.99));
+                for (uint32_t j = 0; j < kCallLatencyBuckets; ++j) fprintf(file, ",%llu", (unsigned long long)entry.buckets[j]);
+                fprintf(file, "\n");
+                continue;
+            }
+            fprintf(file,
+                    "%s\n    {\"name\": \"%s\", \"calls\": %llu, \"calls_per_frame\": %.3f, \"cycles\": %llu, \"mean_ns\": %.1f, "
+                    "\"p50_cycles\": %llu, \"p99_cycles\": %llu, \"histogram\": [",
+                    i ? "," : "", name, (unsigned long long)entry.calls, calls_per_frame, (unsigned long long)entry.cycles,
+                    mean_ns, Percentile(entry, 0.5), Percentile(entry, 0.99));
+            // Buckets past the slowest call are left out
+            uint32_t bucket_count = kCallLatencyBuckets;
+            while (bucket_count > 1 && entry.buckets[bucket_count - 1] == 0) --bucket_count;
+            for (uint32_t j = 0; j < bucket_count; ++j) {
+                fprintf(file, "%s%llu", j ? ", " : "", (unsigned long long)entry.buckets[j]);
+            }
+            fprintf(file, "]}");
+        }
+        if (!csv) fprintf(file, "\n  ]\n}\n");
+        fclose(file);
+    }
+
+  private:
+    struct Totals {
+        size_t entry_point = 0;
+        uint64_t calls = 0;
+        uint64_t cycles = 0;
+        uint64_t buckets[kCallLatencyBuckets] = {};
+    };
+
+    CallStats(const ProcEntry *entry_points, size_t entry_point_count, const char *path)
+        : entry_points_(entry_points),
+          entry_point_count_(entry_point_count),
+          present_entry_point_(entry_point_count),
+          path_(path),
+          start_cycles_(ReadCycleCounter()),
+          start_time_(std::chrono::steady_clock::now()) {
+        for (size_t i = 0; i < entry_point_count; ++i) {
+            if (strcmp(entry_points[i].name, "vkQueuePresentKHR") == 0) present_entry_point_ = i;
+        }
+    }
+
+    static void Add(std::atomic<uint64_t> *counter, uint64_t value) {
+        counter->store(counter->load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    // The calling thread's stats of each entry point, which it allocates as it first calls each
+    std::atomic<EntryPointCallStats *> *AddThread() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        threads_.emplace_back(new std::atomic<EntryPointCallStats *>[entry_point_count_]());
+        return threads_.back().get();
+    }
+
+    static unsigned long long BucketStart(uint32_t bucket) { return bucket ? 1ull << bucket : 0; }
+
+    // The end of the bucket the given fraction of calls took no longer than
+    static unsigned long long Percentile(const Totals &entry, double fraction) {
+        const uint64_t rank = static_cast<uint64_t>(fraction * (entry.calls - 1)) + 1;
+        uint64_t calls = 0;
+        for (uint32_t i = 0; i + 1 < kCallLatencyBuckets; ++i) {
+            calls += entry.buckets[i];
+            if (calls >= rank) return 2ull << i;
+        }
+        return BucketStart(kCallLatencyBuckets - 1);
+    }
+
+    // Measured against the steady clock since the stats were opened
+    double CyclesPerNanosecond() const {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_);
+        const uint64_t cycles = ReadCycleCounter() - start_cycles_;
+        return elapsed.count() > 0 && cycles > 0 ? double(cycles) / elapsed.count() : 1.0;
+    }
+
+#if !defined(_WIN32)
+    // Dumps on SIGUSR1, unless the app handles that itself. A signal handler can only do async-signal-safe things, so it
+    // wakes a thread that does the dump. The handler and thread stay behind when the loader unloads the mock ICD, so the
+    // library is kept loaded.
+    void DumpOnSignal() {
+        struct sigaction current;
+        if (sigaction(SIGUSR1, nullptr, &current) != 0 || (current.sa_flags & SA_SIGINFO) || current.sa_handler != SIG_DFL) {
+            return;
+        }
+        Dl_info library;
+        if (!dladdr(reinterpret_cast<void *>(&CallStats::Open), &library) ||
+            !dlopen(library.dli_fname, RTLD_NOW | RTLD_NOLOAD | RTLD_NODELETE)) {
+            return;
+        }
+        int fds[2];
+        if (pipe(fds) != 0) return;
+        SignalFd() = fds[1];
+        const int read_fd = fds[0];
+        std::thread([this, read_fd]() {
+            char byte;
+            for (;;) {
+                const ssize_t result = read(read_fd, &byte, 1);
+                if (result == 1) {
+                    Dump();
+                } else if (result == 0 || errno != EINTR) {
+                    return;
+                }
+            }
+        }).detach();
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = OnSignal;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGUSR1, &action, nullptr);
+    }
+
+    static int &SignalFd() {
+        static int fd = -1;
+        return fd;
+    }
+
+    static void OnSignal(int) {
+        const int saved_errno = errno;
+        const char byte = 0;
+        if (write(SignalFd(), &byte, 1) < 0) {
+            // Nothing a signal handler can do about it
+        }
+        errno = saved_errno;
+    }
+#endif
+
+    const ProcEntry *const entry_points_;
+    const size_t entry_point_count_;
+    size_t present_entry_point_;  // vkQueuePresentKHR's entry point, to count frames by
+    const std::string path_;
+    const uint64_t start_cycles_;
+    const std::chrono::steady_clock::time_point start_time_;
+    std::mutex mutex_;  // Guards threads_, and keeps dumps from overlapping
+    std::vector<std::unique_ptr<std::atomic<EntryPointCallStats *>[]>> threads_;
+};
+
+// Records the call an entry point makes while it's in scope
+class CallTimer {
+  public:
+    CallTimer(CallStats *call_stats, size_t entry_point)
+        : call_stats_(call_stats), entry_point_(entry_point), start_(ReadCycleCounter()) {}
+    ~CallTimer() { call_stats_->Record(entry_point_, ReadCycleCounter() - start_); }
+
+  private:
+    CallStats *const call_stats_;
+    const size_t entry_point_;
+    const uint64_t start_;
+};
+
+}  // namespace vkmock
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+namespace vkmock {
+
+// Recorded commands are packed back to back: a CommandHeader, then the command's generated Cmd*Args struct, then copies of
+// what the arguments point to, see CommandPayload. Everything is kept 8-byte aligned.
+static constexpr size_t kCommandAlignment = 8;
+
+static size_t AlignCommandSize(size_t size) { return (size + kCommandAlignment - 1) & ~(kCommandAlignment - 1); }
+
+struct CommandHeader {
+    CommandHeader *next;  // Next command recorded into the same command buffer
+    uint32_t opcode;      // CmdOpcode of the command
+    uint32_t size;        // Bytes that follow this header
+
+    template <typename Args>
+    const Args *GetArgs() const {
+        return reinterpret_cast<const Args *>(this + 1);
+    }
+};
+
+// A chunk of command memory. Standard blocks are handed to one command buffer at a time and recycled through the pool's free
+// list. Commands too big for a standard block get a dedicated block, freed when the command buffer or the pool is reset.
+struct CommandBlock {
+    CommandBlock *next;  // Next block in the owning command buffer's chain, its dedicated blocks, or the pool's free list
+    size_t capacity;
+    size_t used;
+
+    uint8_t *Data() { return reinterpret_cast<uint8_t *>(this + 1); }
+
+    static CommandBlock *Create(size_t capacity) {
+        auto block = static_cast<CommandBlock *>(::operator new(sizeof(CommandBlock) + capacity));
+        block->next = nullptr;
+        block->capacity = capacity;
+        block->used = 0;
+        return block;
+    }
+    static void Destroy(CommandBlock *block) { ::operator delete(block); }
+};
+
+// Bump allocator shared by all command buffers of a command pool.
+// Resetting the pool is O(1): the epoch advances, which invalidates every command buffer's recording at once, and all standard
+// blocks become available again without being touched.
+class CommandArena {
+  public:
+    static constexpr size_t kBlockSize = 256 * 1024 - sizeof(CommandBlock);
+
+    CommandArena() = default;
+    CommandArena(const CommandArena &) = delete;
+    CommandArena &operator=(const CommandArena &) = delete;
+    ~CommandArena() {
+        for (auto block : blocks_) CommandBlock::Destroy(block);
+        FreeDedicatedBlocks();
+    }
+
+    uint64_t Epoch() const { return epoch_; }
+
+    // Returns an empty block with room for at least size bytes
+    CommandBlock *AcquireBlock(size_t size) {
+        CommandBlock *block = nullptr;
+        if (size > kBlockSize) {
+            block = CommandBlock::Create(size);
+            dedicated_blocks_.push_back(block);
+        } else if (free_list_) {
+            block = free_list_;
+            free_list_ = block->next;
+        } else if (next_unused_ < blocks_.size()) {
+            block = blocks_[next_unused_++];
+        } else {
+            block = CommandBlock::Create(kBlockSize);
+            blocks_.push_back(block);
+            ++next_unused_;
+        }
+        block->next = nullptr;
+        block->used = 0;
+        return block;
+    }
+
+    // Returns a command buffer's chain of standard blocks for reuse
+    void ReleaseBlocks(CommandBlock *first, CommandBlock *last) {
+        if (!first) return;
+        last->next = free_list_;
+        free_list_ = first;
+    }
+
+    // Frees a dedicated block AcquireBlock() returned since the last Reset(). Commands this big are rare, so finding it is
+    // a linear search.
+    void FreeDedicatedBlock(CommandBlock *block) {
+        for (size_t i = 0; i < dedicated_blocks_.size(); ++i) {
+            if (dedicated_blocks_[i] == block) {
+                dedicated_blocks_[i] = dedicated_blocks_.back();
+                dedicated_blocks_.pop_back();
+                CommandBlock::Destroy(block);
+                return;
+            }
+        }
+    }
+
+    void Reset() {
+        ++epoch_;
+        free_list_ = nullptr;
+        next_unused_ = 0;
+        FreeDedicatedBlocks();
+    }
+
+    // Frees the standard blocks no command buffer is using
+    void Trim() {
+        static constexpr size_t kFreeMarker = ~size_t(0);
+        for (CommandBlock *block = free_list_; block; block = block->next) block->used = kFreeMarker;
+        size_t kept = 0;
+        for (size_t i = 0; i < blocks_.size(); ++i) {
+            if (i >= next_unused_ || blocks_[i]->used == kFreeMarker) {
+                CommandBlock::Destroy(blocks_[i]);
+            } else {
+                blocks_[kept++] = blocks_[i];
+            }
+        }
+        blocks_.resize(kept);
+        next_unused_ = kept;
+        free_list_ = nullptr;
+    }
+
+  private:
+    void FreeDedicatedBlocks() {
+        for (auto block : dedicated_blocks_) CommandBlock::Destroy(block);
+        dedicated_blocks_.clear();
+    }
+
+    uint64_t epoch_ = 1;
+    std::vector<CommandBlock *> blocks_;  // Every standard block this arena owns
+    size_t next_unused_ = 0;              // blocks_ at or after this index haven't been handed out since the last Reset()
+    CommandBlock *free_list_ = nullptr;   // Blocks handed back by command buffer resets
+    std::vector<CommandBlock *> dedicated_blocks_;
+};
+
+// The recorded contents of one command buffer
+class CommandStream {
+  public:
+    void SetArena(CommandArena *arena) {
+        arena_ = arena;
+        epoch_ = arena->Epoch();
+    }
+
+    // Appends a command and returns the space for its arguments and payload, size bytes in total
+    void *Record(uint32_t opcode, size_t size) {
+        if (epoch_ != arena_->Epoch()) Forget();
+        const size_t total = sizeof(CommandHeader) + AlignCommandSize(size);
+        if (!last_block_ || last_block_->capacity - last_block_->used < total) {
+            CommandBlock *block = arena_->AcquireBlock(total);
+            // Dedicated blocks can't be recycled through the free list, so keep them out of this stream's chain
+            if (block->capacity == CommandArena::kBlockSize) {
+                if (last_block_) {
+                    last_block_->next = block;
+                } else {
+                    first_block_ = block;
+                }
+                last_block_ = block;
+            } else {
+                block->used = total;
+                block->next = dedicated_blocks_;
+                dedicated_blocks_ = block;
+                return Link(block->Data(), opcode, size);
+            }
+        }
+        uint8_t *data = last_block_->Data() + last_block_->used;
+        last_block_->used += total;
+        return Link(data, opcode, size);
+    }
+
+    // Empties the stream and hands its memory back to the pool
+    void Reset() {
+        if (epoch_ == arena_->Epoch()) {
+            arena_->ReleaseBlocks(first_block_, last_block_);
+            while (dedicated_blocks_) {
+                CommandBlock *block = dedicated_blocks_;
+                dedicated_blocks_ = block->next;
+                arena_->FreeDedicatedBlock(block);
+            }
+        }
+        Forget();
+    }
+
+    uint32_t CommandCount() const { return epoch_ == arena_->Epoch() ? command_count_ : 0; }
+
+    // Calls func(const CommandHeader &) for every command in recording order
+    template <typename Func>
+    void ForEachCommand(Func func) const {
+        if (epoch_ != arena_->Epoch()) return;
+        for (const CommandHeader *command = first_command_; command; command = command->next) func(*command);
+    }
+
+  private:
+    void *Link(uint8_t *data, uint32_t opcode, size_t size) {
+        auto header = reinterpret_cast<CommandHeader *>(data);
+        header->next = nullptr;
+        header->opcode = opcode;
+        header->size = static_cast<uint32_t>(AlignCommandSize(size));
+        if (last_command_) {
+            last_command_->next = header;
+        } else {
+            first_command_ = header;
+        }
+        last_command_ = header;
+        ++command_count_;
+        return header + 1;
+    }
+
+    // Drops the recording without returning its blocks, for when the pool has already reclaimed them
+    void Forget() {
+        epoch_ = arena_->Epoch();
+        first_block_ = last_block_ = nullptr;
+        dedicated_blocks_ = nullptr;
+        first_command_ = last_command_ = nullptr;
+        command_count_ = 0;
+    }
+
+    CommandArena *arena_ = nullptr;
+    uint64_t epoch_ = 0;
+    CommandBlock *first_block_ = nullptr;
+    CommandBlock *last_block_ = nullptr;
+    CommandBlock *dedicated_blocks_ = nullptr;  // Linked through next, outside the chain of standard blocks
+    CommandHeader *first_command_ = nullptr;
+    CommandHeader *last_command_ = nullptr;
+    uint32_t command_count_ = 0;
+};
+
+class CommandPayload;
+
+// What a recorded struct points to beyond its own bytes. The generator specializes this for the structs in
+// RECORD_FOLLOWED_STRUCTS, to size and copy the arrays, strings and pNext chains they point to along with them.
+template <typename T>
+struct CommandDeepCopy {
+    static constexpr bool kDeep = false;
+    static size_t Size(const T &) { return 0; }
+    static void Copy(CommandPayload &, T &) {}
+};
+
+// Bytes needed to copy count elements of src, and what they point to, into a command's payload
+template <typename T>
+static size_t PayloadSize(const T *src, size_t count) {
+    if (!src) return 0;
+    size_t size = AlignCommandSize(sizeof(T) * count);
+    if (CommandDeepCopy<T>::kDeep) {
+        for (size_t i = 0; i < count; ++i) size += CommandDeepCopy<T>::Size(src[i]);
+    }
+    return size;
+}
+
+// Bytes needed to copy count arrays of src, the i-th inner_count(i) elements long, e.g. ppBuildRangeInfos
+template <typename T, typename Count>
+static size_t PayloadSize(const T *const *src, size_t count, Count inner_count) {
+    if (!src) return 0;
+    size_t size = AlignCommandSize(sizeof(T *) * count);
+    for (size_t i = 0; i < count; ++i) size += PayloadSize(src[i], inner_count(i));
+    return size;
+}
+
+static size_t PayloadBytes(const void *src, size_t size) { return src ? AlignCommandSize(size) : 0; }
+
+static size_t PayloadString(const char *src) { return src ? AlignCommandSize(strlen(src) + 1) : 0; }
+
+// Copies what a command points to into the space reserved after its argument struct. Copies of structs point to copies of
+// what the originals point to, so nothing a recorded command holds refers to the app's memory.
+class CommandPayload {
+  public:
+    template <typename Args>
+    explicit CommandPayload(Args *args)
+        : cursor_(reinterpret_cast<uint8_t *>(args) + AlignCommandSize(sizeof(Args))) {}
+
+    template <typename T>
+    const T *CopyArray(const T *src, size_t count) {
+        T *dst = static_cast<T *>(Allocate(src, sizeof(T) * count));
+        if (dst && CommandDeepCopy<T>::kDeep) {
+            for (size_t i = 0; i < count; ++i) CommandDeepCopy<T>::Copy(*this, dst[i]);
+        }
+        return dst;
+    }
+
+    template <typename T, typename Count>
+    const T *const *CopyArrays(const T *const *src, size_t count, Count inner_count) {
+        auto dst = static_cast<const T **>(Allocate(src, sizeof(T *) * count));
+        if (dst) {
+            for (size_t i = 0; i < count; ++i) dst[i] = CopyArray(src[i], inner_count(i));
+        }
+        return dst;
+    }
+
+    const void *CopyBytes(const void *src, size_t size) { return Allocate(src, size); }
+
+    const char *CopyString(const char *src) { return src ? static_cast<const char *>(Allocate(src, strlen(src) + 1)) : nullptr; }
+
+  private:
+    void *Allocate(const void *src, size_t size) {
+        if (!src) return nullptr;
+        void *dst = cursor_;
+        memcpy(dst, src, size);
+        cursor_ += AlignCommandSize(size);
+        return dst;
+    }
+
+    uint8_t *cursor_;
+};
+
+}  // namespace vkmock
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+#include "mock_icd_spirv.h"
+
+namespace vkmock {
+
+// Helper threads that run the workgroups of a dispatch with the queue thread executing it. Each thread starts with an even
+// share of the workgroups and takes them from the front of its share, and a thread that runs out steals the back half of
+// another's, so workgroups that take longer than others, such as ones that loop more, don't leave threads idle. As with
+// TransferThreadPool, threads are started for the first dispatch needing them, and a queue thread that finds the pool busy
+// runs its dispatch alone.
+class ComputeThreadPool {
+  public:
+    // thread_count includes the thread calling ParallelFor, so 1 or less never starts any
+    explicit ComputeThreadPool(uint32_t thread_count)
+        : helper_count_(thread_count > 1 ? thread_count - 1 : 0), ranges_(new Range[helper_count_ + 1]) {}
+    ComputeThreadPool(const ComputeThreadPool &) = delete;
+    ComputeThreadPool &operator=(const ComputeThreadPool &) = delete;
+    ~ComputeThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto &thread : threads_) thread.join();
+    }
+
+    uint32_t ThreadCount() const { return helper_count_ + 1; }
+
+    // Calls func(i, thread) for every i below count, thread being which of the ThreadCount() threads made the call, and
+    // returns once they're done
+    void ParallelFor(size_t count, const std::function<void(size_t, uint32_t)> &func) {
+        std::unique_lock<std::mutex> busy(busy_mutex_, std::try_to_lock);
+        if (count < 2 || !helper_count_ || !busy.owns_lock()) {
+            for (size_t i = 0; i < count; ++i) func(i, 0);
+            return;
+        }
+        if (threads_.empty()) {
+            for (uint32_t i = 1; i <= helper_count_; ++i) threads_.emplace_back(&ComputeThreadPool::Run, this, i);
+        }
+        const size_t thread_count = helper_count_ + 1;
+        for (size_t i = 0; i < thread_count; ++i) {
+            std::lock_guard<std::mutex> lock(ranges_[i].mutex);
+            ranges_[i].begin = count * i / thread_count;
+            ranges_[i].end = count * (i + 1) / thread_count;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            func_ = &func;
+            ++generation_;
+        }
+        work_cv_.notify_all();
+        RunItems(func, 0);
+        // Helpers that are still running items are counted as active until they finish them
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&]() { return active_ == 0; });
+        func_ = nullptr;
+    }
+
+  private:
+    // The items a thread has left, padded so threads taking items don't share cache lines
+    struct Range {
+        std::mutex mutex;
+        size_t begin = 0;
+        size_t end = 0;
+        uint8_t padding[64];
+    };
+
+    bool TakeOwn(uint32_t thread, size_t *item) {
+        Range &range = ranges_[thread];
+        std::lock_guard<std::mutex> lock(range.mutex);
+        if (range.begin == range.end) return false;
+        *item = range.begin++;
+        return true;
+    }
+
+    // Takes the back half of the first other thread's range that has any items left, returning the first of them and
+    // keeping the rest
+    bool Steal(uint32_t thread, size_t *item) {
+        const uint32_t thread_count = helper_count_ + 1;
+        for (uint32_t i = 1; i < thread_count; ++i) {
+            Range &victim = ranges_[(thread + i) % thread_count];
+            size_t begin;
+            size_t end;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (victim.begin == victim.end) continue;
+                begin = victim.begin + (victim.end - victim.begin) / 2;
+                end = victim.end;
+                victim.end = begin;
+            }
+            Range &own = ranges_[thread];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = begin + 1;
+            own.end = end;
+            *item = begin;
+            return true;
+        }
+        return false;
+    }
+
+    void RunItems(const std::function<void(size_t, uint32_t)> &func, uint32_t thread) {
+        size_t item;
+        while (TakeOwn(thread, &item) || Steal(thread, &item)) func(item, thread);
+    }
+
+    void Run(uint32_t thread) {
+        uint64_t seen_generation = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            work_cv_.wait(lock, [&]() { return stop_ || generation_ != seen_generation; });
+            if (stop_) return;
+            seen_generation = generation_;
+            // A helper waking after the dispatch finished has nothing left to do
+            if (!func_) continue;
+            const std::function<void(size_t, uint32_t)> *func = func_;
+            ++active_;
+            lock.unlock();
+            RunItems(*func, thread);
+            lock.lock();
+            if (--active_ == 0) done_cv_.notify_all();
+        }
+    }
+
+    const uint32_t helper_count_;
+    std::unique_ptr<Range[]> ranges_;
+    std::vector<std::thread> threads_;
+    std::mutex busy_mutex_;  // Held by the thread whose dispatch is using the pool
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    const std::function<void(size_t, uint32_t)> *func_ = nullptr;
+    uint32_t active_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+};
+
+// Runs every workgroup of a dispatch across pool, with an executor for each thread that runs any of them
+static void RunComputeDispatch(ComputeThreadPool *pool, const ComputeDispatch &dispatch) {
+    const size_t group_count = size_t(dispatch.group_count[0]) * dispatch.group_count[1] * dispatch.group_count[2];
+    if (!group_count) return;
+    std::vector<std::unique_ptr<ComputeExecutor>> executors(pool->ThreadCount());
+    pool->ParallelFor(group_count, [&](size_t index, uint32_t thread) {
+        std::unique_ptr<ComputeExecutor> &executor = executors[thread];
+        if (!executor) executor.reset(new ComputeExecutor(dispatch));
+        const size_t row = index / dispatch.group_count[0];
+        executor->RunWorkgroup(static_cast<uint32_t>(index % dispatch.group_count[0]),
+                               static_cast<uint32_t>(row % dispatch.group_count[1]),
+                               static_cast<uint32_t>(row / dispatch.group_count[1]));
+    });
+}
+
+}  // namespace vkmock
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+namespace vkmock {
+
+// Optional mock ICD behavior is configured through VKMOCK_* environment variables, so an application under test doesn't
+// need to know it's running on the mock ICD.
+
+// Returns the variable's value, or nullptr if it's unset or empty
+static const char *GetConfigString(const char *name) {
+    const char *value = getenv(name);
+    return (value && *value) ? value : nullptr;
+}
+
+// "0", "false" and "off" (in any case) disable a setting, any other value enables it
+static bool GetConfigBool(const char *name, bool default_value) {
+    const char *value = GetConfigString(name);
+    if (!value) return default_value;
+    std::string lower;
+    for (const char *c = value; *c; ++c) lower += static_cast<char>(tolower(static_cast<unsigned char>(*c)));
+    return lower != "0" && lower != "false" && lower != "off";
+}
+
+static uint64_t GetConfigUint(const char *name, uint64_t default_value) {
+    const char *value = GetConfigString(name);
+    if (!value) return default_value;
+    char *end = nullptr;
+    const unsigned long long result = strtoull(value, &end, 0);
+    return (end == value || *end) ? default_value : static_cast<uint64_t>(result);
+}
+
+static double GetConfigDouble(const char *name, double default_value) {
+    const char *value = GetConfigString(name);
+    if (!value) return default_value;
+    char *end = nullptr;
+    const double result = strtod(value, &end);
+    return (end == value || *end) ? default_value : result;
+}
+
+// Parses a byte count with an optional K, M or G suffix (powers of 1024)
+static bool ParseConfigSize(const std::string &text, uint64_t *size) {
+    char *end = nullptr;
+    const unsigned long long value = strtoull(text.c_str(), &end, 10);
+    if (end == text.c_str()) return false;
+    int shift = 0;
+    switch (*end) {
+        case 'K':
+        case 'k':
+            shift = 10;
+            break;
+        case 'M':
+        case 'm':
+            shift = 20;
+            break;
+        case 'G':
+        case 'g':
+            shift = 30;
+            break;
+        case '\0':
+            break;
+        default:
+            return false;
+    }
+    if (shift && *++end) return false;
+    if (value > (UINT64_MAX >> shift)) return false;
+    *size = static_cast<uint64_t>(value) << shift;
+    return true;
+}
+
+// Splits the variable's value at each separator. Empty items are kept, so items in parallel lists stay lined up.
+static std::vector<std::string> GetConfigList(const char *name, char separator) {
+    std::vector<std::string> items;
+    const char *value = GetConfigString(name);
+    if (!value) return items;
+    items.emplace_back();
+    for (const char *c = value; *c; ++c) {
+        if (*c == separator) {
+            items.emplace_back();
+        } else {
+            items.back() += *c;
+        }
+    }
+    return items;
+}
+
+// Lists of paths are separated like PATH
+#ifdef _WIN32
+static constexpr char kConfigPathSeparator = ';';
+#else
+static constexpr char kConfigPathSeparator = ':';
+#endif
+
+}  // namespace vkmock
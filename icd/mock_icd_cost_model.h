@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "mock_icd_config.h"
+
+namespace vkmock {
+
+// How long the simulated GPU takes to execute work, in nanoseconds. Submissions advance their queue's simulated clock by the
+// cost of their commands, which is what timestamp queries read, and with VKMOCK_ASYNC_QUEUE the queue worker also takes that
+// long in real time before signaling. Pipeline compiles and host acceleration structure builds are host work instead, and
+// take their cost in real time on the thread doing them, which for deferred operations is a thread joining the operation.
+// Everything costs nothing unless configured.
+struct CostModel {
+    double submit_ns = 0;     // Each batch submitted to a queue
+    double command_ns = 0;    // Each recorded command
+    double draw_ns = 0;       // Each draw, counting every draw of an indirect draw
+    double vertex_ns = 0;     // Each vertex (or index) of each instance drawn
+    double dispatch_ns = 0;   // Each dispatch
+    double workgroup_ns = 0;  // Each workgroup dispatched
+    double copy_byte_ns = 0;  // Each byte written by a copy, fill or update
+    double compile_ns = 0;    // Each pipeline created that isn't in its pipeline cache
+    double build_primitive_ns = 0;  // Each primitive of vkBuildAccelerationStructuresKHR's builds
+
+    bool Set(const std::string &key, double value) {
+        struct Field {
+            const char *name;
+            double CostModel::*member;
+        };
+        static const Field kFields[] = {
+            {"submit_ns", &CostModel::submit_ns},     {"command_ns", &CostModel::command_ns},
+            {"draw_ns", &CostModel::draw_ns},         {"vertex_ns", &CostModel::vertex_ns},
+            {"dispatch_ns", &CostModel::dispatch_ns}, {"workgroup_ns", &CostModel::workgroup_ns},
+            {"copy_byte_ns", &CostModel::copy_byte_ns}, {"compile_ns", &CostModel::compile_ns},
+            {"build_primitive_ns", &CostModel::build_primitive_ns},
+        };
+        for (const auto &field : kFields) {
+            if (key == field.name) {
+                this->*field.member = value;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+static std::string TrimCostModelToken(const std::string &text) {
+    const char *whitespace = " \t\r\n";
+    const size_t begin = text.find_first_not_of(whitespace);
+    if (begin == std::string::npos) return std::string();
+    return text.substr(begin, text.find_last_not_of(whitespace) - begin + 1);
+}
+
+// Parses "key=value" settings separated by commas, semicolons or newlines, e.g. "draw_ns=2000,vertex_ns=0.5". '#' starts
+// a comment that runs to the end of the line. Returns false and describes the first bad setting in error.
+static bool ParseCostModel(const std::string &text, CostModel *model, std::string *error) {
+    std::string settings;
+    bool in_comment = false;
+    for (char c : text) {
+        if (c == '#') in_comment = true;
+        if (c == '\n') in_comment = false;
+        if (!in_comment) settings += (c == ',' || c == ';') ? '\n' : c;
+    }
+    std::istringstream lines(settings);
+    std::string line;
+    while (std::getline(lines, line)) {
+        line = TrimCostModelToken(line);
+        if (line.empty()) continue;
+        const size_t equals = line.find('=');
+        const std::string key = TrimCostModelToken(line.substr(0, equals));
+        const std::string value = equals == std::string::npos ? std::string() : TrimCostModelToken(line.substr(equals + 1));
+        char *end = nullptr;
+        const double number = strtod(value.c_str(), &end);
+        if (value.empty() || *end || number < 0) {
+            *error = "bad value in \"" + line + "\"";
+            return false;
+        }
+        if (!model->Set(key, number)) {
+            *error = "unknown cost \"" + key + "\"";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Settings come from the file named by VKMOCK_COST_MODEL_FILE, then from VKMOCK_COST_MODEL, which takes precedence
+static CostModel LoadCostModel() {
+    CostModel model;
+    std::string error;
+    const char *path = GetConfigString("VKMOCK_COST_MODEL_FILE");
+    if (path) {
+        std::ifstream file(path);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        if (!file) {
+            fprintf(stderr, "vkmock: can't read cost model file %s\n", path);
+        } else if (!ParseCostModel(contents.str(), &model, &error)) {
+            fprintf(stderr, "vkmock: %s: %s\n", path, error.c_str());
+        }
+    }
+    const char *settings = GetConfigString("VKMOCK_COST_MODEL");
+    if (settings && !ParseCostModel(settings, &model, &error)) {
+        fprintf(stderr, "vkmock: VKMOCK_COST_MODEL: %s\n", error.c_str());
+    }
+    return model;
+}
+
+}  // namespace vkmock
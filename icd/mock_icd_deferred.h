@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <functional>
+
+#include "vulkan/vulkan.h"
+
+// VK_KHR_deferred_host_operations. A deferred command splits its work into tasks, such as one per pipeline, which the
+// threads calling vkDeferredOperationJoinKHR claim one at a time, so the operation runs on as many threads as the app joins
+// to it.
+
+namespace vkmock {
+
+class DeferredOperation {
+  public:
+    // Makes task(0) to task(task_count - 1) the operation's work, followed by finish(), which gives the operation's result
+    // and runs on the thread finishing the last task. As Vulkan requires, the app doesn't join the operation until the
+    // command deferring to it returns, and doesn't defer to it again until it's complete.
+    void Defer(uint32_t task_count, std::function<void(uint32_t)> task, std::function<VkResult()> finish) {
+        task_ = std::move(task);
+        finish_ = std::move(finish);
+        task_count_ = task_count;
+        next_task_.store(0, std::memory_order_relaxed);
+        done_tasks_.store(0, std::memory_order_relaxed);
+        result_.store(VK_NOT_READY, std::memory_order_relaxed);
+        if (task_count == 0) Complete();
+    }
+
+    // Runs tasks until none are left to claim. Returns VK_SUCCESS once the operation is complete, or VK_THREAD_DONE_KHR if
+    // other threads are still running its last tasks.
+    VkResult Join() {
+        while (next_task_.load(std::memory_order_relaxed) < task_count_) {
+            const uint32_t index = next_task_.fetch_add(1, std::memory_order_relaxed);
+            if (index >= task_count_) break;
+            task_(index);
+            // Finishing makes every task's writes visible to the thread running finish()
+            if (done_tasks_.fetch_add(1, std::memory_order_acq_rel) + 1 == task_count_) {
+                Complete();
+                return VK_SUCCESS;
+            }
+        }
+        return Result() == VK_NOT_READY ? VK_THREAD_DONE_KHR : VK_SUCCESS;
+    }
+
+    // How many more threads joining would find a task to run, which is 0 once every task is claimed
+    uint32_t MaxConcurrency() const {
+        const uint32_t next_task = next_task_.load(std::memory_order_relaxed);
+        return next_task < task_count_ ? task_count_ - next_task : 0;
+    }
+
+    // VK_NOT_READY until the operation is complete, and VK_SUCCESS before anything is deferred to it
+    VkResult Result() const { return result_.load(std::memory_order_acquire); }
+
+  private:
+    void Complete() { result_.store(finish_(), std::memory_order_release); }
+
+    std::function<void(uint32_t)> task_;
+    std::function<VkResult()> finish_;
+    uint32_t task_count_ = 0;
+    std::atomic<uint32_t> next_task_{0};
+    std::atomic<uint32_t> done_tasks_{0};
+    std::atomic<VkResult> result_{VK_SUCCESS};
+};
+
+}  // namespace vkmock
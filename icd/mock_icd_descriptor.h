@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+// Descriptor sets and what their descriptors refer to, which compute dispatches need to find the memory their shaders
+// access. Only tracked with compute execution enabled.
+
+namespace vkmock {
+
+struct SamplerState {
+    bool linear_filter;
+    bool unnormalized_coordinates;
+    VkSamplerAddressMode address_modes[3];
+};
+
+struct ImageViewState {
+    VkImage image;
+    VkFormat format;
+    VkImageViewType view_type;
+    VkImageSubresourceRange subresource_range;
+};
+
+// What a descriptor refers to. Texel buffer views and inline uniform blocks aren't tracked.
+struct DescriptorState {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize range = 0;
+    VkImageView image_view = VK_NULL_HANDLE;
+    VkSampler sampler = VK_NULL_HANDLE;
+};
+
+struct DescriptorSetLayoutBinding {
+    uint32_t binding;
+    VkDescriptorType type;
+    uint32_t count;
+    uint32_t first;  // Index of the binding's first descriptor in the set
+    uint32_t dynamic_first;  // Index of the binding's first dynamic offset, for dynamic buffers
+    std::vector<VkSampler> immutable_samplers;
+};
+
+static bool IsDynamicDescriptor(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+}
+
+struct DescriptorSetLayoutState {
+    explicit DescriptorSetLayoutState(const VkDescriptorSetLayoutCreateInfo &create_info) {
+        for (uint32_t i = 0; i < create_info.bindingCount; ++i) {
+            const VkDescriptorSetLayoutBinding &binding = create_info.pBindings[i];
+            DescriptorSetLayoutBinding state = {binding.binding, binding.descriptorType, binding.descriptorCount, 0, 0, {}};
+            const bool has_samplers = binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER ||
+                                      binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            if (has_samplers && binding.pImmutableSamplers) {
+                state.immutable_samplers.assign(binding.pImmutableSamplers, binding.pImmutableSamplers + binding.descriptorCount);
+            }
+            bindings.push_back(state);
+        }
+        std::sort(bindings.begin(), bindings.end(),
+                  [](const DescriptorSetLayoutBinding &a, const DescriptorSetLayoutBinding &b) { return a.binding < b.binding; });
+        for (auto &binding : bindings) {
+            binding.first = descriptor_count;
+            binding.dynamic_first = dynamic_count;
+            descriptor_count += binding.count;
+            if (IsDynamicDescriptor(binding.type)) dynamic_count += binding.count;
+        }
+    }
+
+    // Index in bindings of a binding number, or bindings.size() if the layout doesn't have it
+    size_t Find(uint32_t binding) const {
+        const auto it = std::lower_bound(bindings.begin(), bindings.end(), binding,
+                                         [](const DescriptorSetLayoutBinding &a, uint32_t b) { return a.binding < b; });
+        return it != bindings.end() && it->binding == binding ? static_cast<size_t>(it - bindings.begin()) : bindings.size();
+    }
+
+    std::vector<DescriptorSetLayoutBinding> bindings;  // In binding number order
+    uint32_t descriptor_count = 0;
+    uint32_t dynamic_count = 0;  // Dynamic offsets binding the set takes
+};
+
+struct DescriptorSetState {
+    DescriptorSetState(std::shared_ptr<const DescriptorSetLayoutState> set_layout, VkDescriptorPool descriptor_pool)
+        : layout(std::move(set_layout)), descriptors(layout->descriptor_count), pool(descriptor_pool) {
+        for (const auto &binding : layout->bindings) {
+            for (uint32_t i = 0; i < binding.immutable_samplers.size(); ++i) {
+                descriptors[binding.first + i].sampler = binding.immutable_samplers[i];
+            }
+        }
+    }
+
+    // Calls func(descriptor, binding, i) for count descriptors from array element of a binding. As with descriptor
+    // writes, updates running past the end of a binding carry on with the next one. Call with mutex held.
+    template <typename Func>
+    void ForEachDescriptor(uint32_t binding, uint32_t element, uint32_t count, Func func) {
+        size_t index = layout->Find(binding);
+        for (uint32_t i = 0; i < count && index < layout->bindings.size();) {
+            const DescriptorSetLayoutBinding &current = layout->bindings[index];
+            if (element >= current.count) {
+                element -= current.count;
+                ++index;
+                continue;
+            }
+            func(descriptors[current.first + element], current, i);
+            ++element;
+            ++i;
+        }
+    }
+
+    const std::shared_ptr<const DescriptorSetLayoutState> layout;
+    std::mutex mutex;  // Guards descriptors, which updates write while queues executing dispatches read them
+    std::vector<DescriptorState> descriptors;
+    const VkDescriptorPool pool;
+};
+
+struct DescriptorPoolState {
+    std::mutex mutex;
+    std::unordered_set<VkDescriptorSet> sets;
+};
+
+// Writes what an image or buffer info refers to into a descriptor of the given type
+static void WriteDescriptor(DescriptorState *descriptor, const DescriptorSetLayoutBinding &binding, VkDescriptorType type,
+                            const VkDescriptorImageInfo *image_info, const VkDescriptorBufferInfo *buffer_info) {
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            // Immutable samplers stay as they are
+            if (binding.immutable_samplers.empty()) descriptor->sampler = image_info->sampler;
+            if (type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER) descriptor->image_view = image_info->imageView;
+            break;
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            descriptor->image_view = image_info->imageView;
+            break;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            descriptor->buffer = buffer_info->buffer;
+            descriptor->offset = buffer_info->offset;
+            descriptor->range = buffer_info->range;
+            break;
+        default:
+            break;
+    }
+}
+
+static bool IsImageDescriptor(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_SAMPLER || type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER ||
+           type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE || type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE ||
+           type == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+}
+
+static bool IsBufferDescriptor(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER || IsDynamicDescriptor(type);
+}
+
+static bool IsTexelBufferDescriptor(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+}
+
+static void ApplyDescriptorWrite(DescriptorSetState *set, const VkWriteDescriptorSet &write) {
+    const bool image = IsImageDescriptor(write.descriptorType);
+    if ((image && !write.pImageInfo) || (IsBufferDescriptor(write.descriptorType) && !write.pBufferInfo)) return;
+    std::lock_guard<std::mutex> lock(set->mutex);
+    set->ForEachDescriptor(write.dstBinding, write.dstArrayElement, write.descriptorCount,
+                           [&](DescriptorState &descriptor, const DescriptorSetLayoutBinding &binding, uint32_t i) {
+                               WriteDescriptor(&descriptor, binding, write.descriptorType, image ? &write.pImageInfo[i] : nullptr,
+                                               image ? nullptr : &write.pBufferInfo[i]);
+                           });
+}
+
+static void ApplyDescriptorCopy(DescriptorSetState *src, DescriptorSetState *dst, const VkCopyDescriptorSet &copy) {
+    std::vector<DescriptorState> descriptors;
+    {
+        std::lock_guard<std::mutex> lock(src->mutex);
+        src->ForEachDescriptor(copy.srcBinding, copy.srcArrayElement, copy.descriptorCount,
+                               [&](DescriptorState &descriptor, const DescriptorSetLayoutBinding &, uint32_t) {
+                                   descriptors.push_back(descriptor);
+                               });
+    }
+    std::lock_guard<std::mutex> lock(dst->mutex);
+    dst->ForEachDescriptor(copy.dstBinding, copy.dstArrayElement, static_cast<uint32_t>(descriptors.size()),
+                           [&](DescriptorState &descriptor, const DescriptorSetLayoutBinding &, uint32_t i) {
+                               descriptor = descriptors[i];
+                           });
+}
+
+struct DescriptorUpdateTemplateState {
+    explicit DescriptorUpdateTemplateState(const VkDescriptorUpdateTemplateCreateInfo &create_info)
+        : entries(create_info.pDescriptorUpdateEntries,
+                  create_info.pDescriptorUpdateEntries + create_info.descriptorUpdateEntryCount),
+          push_descriptors(create_info.templateType != VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {}
+
+    std::vector<VkDescriptorUpdateTemplateEntry> entries;
+    bool push_descriptors;  // Push descriptors aren't tracked, so these templates do nothing
+};
+
+static void ApplyDescriptorUpdateTemplate(DescriptorSetState *set, const DescriptorUpdateTemplateState &update_template,
+                                          const void *data) {
+    if (update_template.push_descriptors || !data) return;
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    std::lock_guard<std::mutex> lock(set->mutex);
+    for (const auto &entry : update_template.entries) {
+        const bool image = IsImageDescriptor(entry.descriptorType);
+        if (!image && !IsBufferDescriptor(entry.descriptorType)) continue;
+        set->ForEachDescriptor(entry.dstBinding, entry.dstArrayElement, entry.descriptorCount,
+                               [&](DescriptorState &descriptor, const DescriptorSetLayoutBinding &binding, uint32_t i) {
+                                   const uint8_t *info = bytes + entry.offset + i * entry.stride;
+                                   WriteDescriptor(&descriptor, binding, entry.descriptorType,
+                                                   image ? reinterpret_cast<const VkDescriptorImageInfo *>(info) : nullptr,
+                                                   image ? nullptr : reinterpret_cast<const VkDescriptorBufferInfo *>(info));
+                               });
+    }
+}
+
+}  // namespace vkmock
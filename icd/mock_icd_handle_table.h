@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+namespace vkmock {
+
+// Reader/writer spin lock. Lookups from any number of threads proceed in parallel and only wait while a writer holds the lock.
+class RWSpinLock {
+  public:
+    void lock_shared() {
+        for (;;) {
+            uint32_t state = state_.load(std::memory_order_relaxed);
+            if (!(state & kWriterBit) && state_.compare_exchange_weak(state, state + 1, std::memory_order_acquire)) return;
+            std::this_thread::yield();
+        }
+    }
+    void unlock_shared() { state_.fetch_sub(1, std::memory_order_release); }
+    void lock() {
+        // Claim the writer bit first so no new readers get in, then wait for the current readers to drain
+        for (;;) {
+            uint32_t state = state_.load(std::memory_order_relaxed);
+            if (!(state & kWriterBit) && state_.compare_exchange_weak(state, state | kWriterBit, std::memory_order_acquire)) break;
+            std::this_thread::yield();
+        }
+        while (state_.load(std::memory_order_acquire) != kWriterBit) std::this_thread::yield();
+    }
+    void unlock() { state_.store(0, std::memory_order_release); }
+
+  private:
+    static constexpr uint32_t kWriterBit = 0x80000000u;
+    std::atomic<uint32_t> state_{0};
+};
+
+class SharedLockGuard {
+  public:
+    explicit SharedLockGuard(RWSpinLock &lock) : lock_(lock) { lock_.lock_shared(); }
+    ~SharedLockGuard() { lock_.unlock_shared(); }
+    SharedLockGuard(const SharedLockGuard &) = delete;
+    SharedLockGuard &operator=(const SharedLockGuard &) = delete;
+
+  private:
+    RWSpinLock &lock_;
+};
+
+class ExclusiveLockGuard {
+  public:
+    explicit ExclusiveLockGuard(RWSpinLock &lock) : lock_(lock) { lock_.lock(); }
+    ~ExclusiveLockGuard() { lock_.unlock(); }
+    ExclusiveLockGuard(const ExclusiveLockGuard &) = delete;
+    ExclusiveLockGuard &operator=(const ExclusiveLockGuard &) = delete;
+
+  private:
+    RWSpinLock &lock_;
+};
+
+// Open-addressing hash table keyed by Vulkan handle values.
+// Entries live in one flat array with linear probing, so inserts don't allocate nodes and a lookup is usually a single cache
+// line. Keys must be non-zero (VK_NULL_HANDLE is never stored) and must not be ~0, which marks erased slots.
+template <typename Key, typename T>
+class HandleTable {
+  public:
+    void Insert(Key key, const T &value) {
+        ExclusiveLockGuard guard(lock_);
+        InsertLocked(ToKey(key), value);
+    }
+
+    // Copies the value out rather than returning a pointer, since the slot may move once the lock is released
+    bool Find(Key key, T *value) const {
+        SharedLockGuard guard(lock_);
+        const Slot *slot = FindLocked(ToKey(key));
+        if (!slot) return false;
+        *value = slot->value;
+        return true;
+    }
+
+    // Returns the existing value for key, or stores and returns create() if there isn't one
+    template <typename Create>
+    T FindOrInsert(Key key, Create create) {
+        T value;
+        if (Find(key, &value)) return value;
+        ExclusiveLockGuard guard(lock_);
+        const Slot *slot = FindLocked(ToKey(key));
+        if (slot) return slot->value;
+        value = create();
+        InsertLocked(ToKey(key), value);
+        return value;
+    }
+
+    // Removes key from the table, optionally returning the value it had
+    bool Erase(Key key, T *value = nullptr) {
+        ExclusiveLockGuard guard(lock_);
+        Slot *slot = const_cast<Slot *>(FindLocked(ToKey(key)));
+        if (!slot) return false;
+        if (value) *value = slot->value;
+        slot->key = kErasedKey;
+        slot->value = T();
+        --size_;
+        ++erased_;
+        return true;
+    }
+
+    // Calls func(key, value) for every entry
+    template <typename Func>
+    void ForEach(Func func) const {
+        SharedLockGuard guard(lock_);
+        for (const auto &slot : slots_) {
+            if (slot.key != kEmptyKey && slot.key != kErasedKey) func(slot.key, slot.value);
+        }
+    }
+
+    void Clear() {
+        ExclusiveLockGuard guard(lock_);
+        slots_.clear();
+        size_ = 0;
+        erased_ = 0;
+    }
+
+    size_t Size() const {
+        SharedLockGuard guard(lock_);
+        return size_;
+    }
+
+  private:
+    static constexpr uint64_t kEmptyKey = 0;
+    static constexpr uint64_t kErasedKey = ~0ull;
+    static constexpr size_t kMinCapacity = 64;
+
+    struct Slot {
+        uint64_t key;
+        T value;
+    };
+
+    static uint64_t ToKey(Key key) { return (uint64_t)key; }
+
+    // Handle values are mostly sequential, so mix the bits before masking to keep probe sequences short
+    static size_t Hash(uint64_t key) {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdull;
+        key ^= key >> 33;
+        return static_cast<size_t>(key);
+    }
+
+    const Slot *FindLocked(uint64_t key) const {
+        if (slots_.empty()) return nullptr;
+        const size_t mask = slots_.size() - 1;
+        for (size_t i = Hash(key) & mask;; i = (i + 1) & mask) {
+            const Slot &slot = slots_[i];
+            if (slot.key == key) return &slot;
+            if (slot.key == kEmptyKey) return nullptr;
+        }
+    }
+
+    void InsertLocked(uint64_t key, const T &value) {
+        Slot *existing = const_cast<Slot *>(FindLocked(key));
+        if (existing) {
+            existing->value = value;
+            return;
+        }
+        // Keep at least a quarter of the slots empty so probe sequences always terminate quickly
+        if ((size_ + erased_ + 1) * 4 > slots_.size() * 3) Rehash();
+        const size_t mask = slots_.size() - 1;
+        for (size_t i = Hash(key) & mask;; i = (i + 1) & mask) {
+            Slot &slot = slots_[i];
+            if (slot.key == kEmptyKey || slot.key == kErasedKey) {
+                if (slot.key == kErasedKey) --erased_;
+                slot.key = key;
+                slot.value = value;
+                ++size_;
+                return;
+            }
+        }
+    }
+
+    // Grows the table when it's mostly live entries, otherwise rebuilds it at the same size to drop erased slots
+    void Rehash() {
+        size_t capacity = slots_.empty() ? kMinCapacity : slots_.size();
+        while ((size_ + 1) * 2 > capacity) capacity *= 2;
+        std::vector<Slot> old_slots(capacity, Slot{kEmptyKey, T()});
+        old_slots.swap(slots_);
+        size_ = 0;
+        erased_ = 0;
+        for (const auto &slot : old_slots) {
+            if (slot.key != kEmptyKey && slot.key != kErasedKey) InsertLocked(slot.key, slot.value);
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+    size_t erased_ = 0;
+    mutable RWSpinLock lock_;
+};
+
+}  // namespace vkmock
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+namespace vkmock {
+
+// One plane of a multi-planar format
+struct FormatPlane {
+    uint8_t width_divisor;  // Subsampling of the plane relative to the image
+    uint8_t height_divisor;
+    uint8_t block_size;  // Bytes per texel of the plane's compatible format
+};
+
+// A format's texel block layout, as the registry describes it. GetFormatInfo() in mock_icd.h has one for every format.
+struct FormatInfo {
+    uint8_t block_size;  // Bytes per texel block, 0 for formats the mock ICD doesn't know
+    uint8_t block_width;  // Texel block extent, more than 1 for compressed and 422 formats
+    uint8_t block_height;
+    uint8_t block_depth;
+    uint8_t plane_count;  // 0 unless the format is multi-planar, in which case the layout comes from the planes
+    FormatPlane planes[3];
+};
+
+// Row pitches and subresource offsets are aligned to this, so it's also the alignment images need in memory
+static constexpr VkDeviceSize kImageLayoutAlignment = 64;
+// Formats the mock ICD doesn't know, such as VK_FORMAT_UNDEFINED for external formats, get the largest texel size there is
+static constexpr uint8_t kUnknownFormatBlockSize = 32;
+
+static uint32_t DivideRoundingUp(uint32_t value, uint32_t divisor) { return (value + divisor - 1) / divisor; }
+
+// The texel blocks one mip level of one plane is made of. A plane of a multi-planar format is addressed in its own texels,
+// which are its blocks.
+struct MipLevelBlocks {
+    uint32_t block_size;  // Bytes per texel block
+    uint32_t block_width;  // Texel block extent
+    uint32_t block_height;
+    uint32_t block_depth;
+    uint32_t width;  // Extent of the mip level in blocks
+    uint32_t height;
+    uint32_t depth;
+};
+
+static MipLevelBlocks GetMipLevelBlocks(const FormatInfo &format, uint32_t plane_index, const VkExtent3D &extent, uint32_t level) {
+    MipLevelBlocks blocks;
+    blocks.block_size = format.block_size ? format.block_size : kUnknownFormatBlockSize;
+    blocks.block_width = std::max<uint32_t>(format.block_width, 1);
+    blocks.block_height = std::max<uint32_t>(format.block_height, 1);
+    blocks.block_depth = std::max<uint32_t>(format.block_depth, 1);
+    uint32_t texels_per_block_x = blocks.block_width;
+    uint32_t texels_per_block_y = blocks.block_height;
+    uint32_t texels_per_block_z = blocks.block_depth;
+    if (format.plane_count) {
+        // A plane is the size of the image divided down by the plane's subsampling
+        const FormatPlane &plane = format.planes[plane_index];
+        blocks.block_size = plane.block_size;
+        blocks.block_width = blocks.block_height = blocks.block_depth = 1;
+        texels_per_block_x = plane.width_divisor;
+        texels_per_block_y = plane.height_divisor;
+        texels_per_block_z = 1;
+    }
+    blocks.width = DivideRoundingUp((std::max)(extent.width >> level, 1u), texels_per_block_x);
+    blocks.height = DivideRoundingUp((std::max)(extent.height >> level, 1u), texels_per_block_y);
+    blocks.depth = DivideRoundingUp((std::max)(extent.depth >> level, 1u), texels_per_block_z);
+    return blocks;
+}
+
+// The plane an aspect of a multi-planar image selects. Other aspects, such as depth and stencil, share the one plane.
+static uint32_t GetAspectPlane(VkImageAspectFlags aspect) {
+    if (aspect & VK_IMAGE_ASPECT_PLANE_1_BIT) return 1;
+    if (aspect & VK_IMAGE_ASPECT_PLANE_2_BIT) return 2;
+    return 0;
+}
+
+// Where each subresource of an image lives in its memory. Every image is laid out the same way whatever its tiling: plane
+// after plane, each holding the array layers in order, each of which holds its mip levels in order. Formats with several
+// aspects but one plane, like depth/stencil formats, interleave them in their texel blocks.
+class ImageLayout {
+  public:
+    // A disjoint image binds memory to each plane separately, so each plane's offsets start at 0
+    ImageLayout(const FormatInfo &format, const VkImageCreateInfo &create_info) : array_layers_(create_info.arrayLayers) {
+        const uint32_t plane_count = std::max<uint32_t>(format.plane_count, 1);
+        const bool disjoint = (create_info.flags & VK_IMAGE_CREATE_DISJOINT_BIT) != 0;
+        VkDeviceSize offset = 0;
+        for (uint32_t plane_index = 0; plane_index < plane_count; ++plane_index) {
+            Plane plane;
+            VkDeviceSize layer_size = 0;
+            for (uint32_t level = 0; level < create_info.mipLevels; ++level) {
+                VkSubresourceLayout mip = {};
+                mip.offset = layer_size;
+                AddMipLevel(format, plane_index, create_info, level, &mip);
+                layer_size += AlignImageOffset(mip.size);
+                plane.mip_levels.push_back(mip);
+            }
+            plane.array_pitch = layer_size;
+            plane.size = layer_size * array_layers_;
+            plane.offset = disjoint ? 0 : offset;
+            offset += plane.size;
+            planes_.push_back(plane);
+        }
+        size_ = offset;
+    }
+
+    // Bytes of memory the whole image takes
+    VkDeviceSize Size() const { return size_; }
+
+    // Bytes of memory one plane of a disjoint image takes
+    VkDeviceSize PlaneSize(uint32_t plane) const { return plane < planes_.size() ? planes_[plane].size : 0; }
+
+    // Layout of one subresource, as vkGetImageSubresourceLayout reports it. Subresources that don't exist get all zeros.
+    VkSubresourceLayout Subresource(uint32_t plane, uint32_t mip_level, uint32_t array_layer) const {
+        VkSubresourceLayout layout = {};
+        if (plane >= planes_.size() || mip_level >= planes_[plane].mip_levels.size() || array_layer >= array_layers_) {
+            return layout;
+        }
+        layout = planes_[plane].mip_levels[mip_level];
+        layout.offset += planes_[plane].offset + array_layer * planes_[plane].array_pitch;
+        layout.arrayPitch = planes_[plane].array_pitch;
+        return layout;
+    }
+
+  private:
+    struct Plane {
+        VkDeviceSize offset;
+        VkDeviceSize size;
+        VkDeviceSize array_pitch;
+        std::vector<VkSubresourceLayout> mip_levels;  // Offsets are from the start of the array layer
+    };
+
+    static VkDeviceSize AlignImageOffset(VkDeviceSize offset) {
+        return (offset + kImageLayoutAlignment - 1) & ~(kImageLayoutAlignment - 1);
+    }
+
+    // Fills in the pitches and size of one mip level of one plane
+    static void AddMipLevel(const FormatInfo &format, uint32_t plane_index, const VkImageCreateInfo &create_info, uint32_t level,
+                            VkSubresourceLayout *mip) {
+        const MipLevelBlocks blocks = GetMipLevelBlocks(format, plane_index, create_info.extent, level);
+        mip->rowPitch = AlignImageOffset(static_cast<VkDeviceSize>(blocks.width) * blocks.block_size);
+        mip->depthPitch = mip->rowPitch * blocks.height;
+        // Multisampled images have a sample per texel. They're always optimally tiled, so only their size is visible.
+        mip->size = mip->depthPitch * blocks.depth * std::max<uint32_t>(create_info.samples, 1);
+    }
+
+    uint32_t array_layers_;
+    VkDeviceSize size_;
+    std::vector<Plane> planes_;
+};
+
+// An image's layout, and once it's bound, the memory it's in
+struct ImageState {
+    ImageState(const FormatInfo &format_info, const VkImageCreateInfo &create_info)
+        : layout(format_info, create_info),
+          format_info(format_info),
+          format(create_info.format),
+          type(create_info.imageType),
+          extent(create_info.extent),
+          mip_levels(create_info.mipLevels),
+          array_layers(create_info.arrayLayers) {}
+
+    ImageLayout layout;
+    FormatInfo format_info;
+    VkFormat format;
+    VkImageType type;
+    VkExtent3D extent;
+    uint32_t mip_levels;
+    uint32_t array_layers;
+    // The memory each plane is bound to. Only disjoint images bind their planes separately: the others have the same binding
+    // for every plane, and their plane offsets count the planes before.
+    VkDeviceMemory memory[3] = {};
+    VkDeviceSize memory_offset[3] = {};
+};
+
+}  // namespace vkmock
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace vkmock {
+
+// Host memory backing a VkDeviceMemory allocation. Mapping returns a pointer into this region, so data written through a
+// mapping persists across map/unmap and every offset aliases the same allocation.
+//
+// Allocations at or above kBackingMemoryMmapThreshold are reserved straight from the OS without committing them, which lets
+// tests allocate heap-sized blocks that are only paid for as they are touched. Smaller ones come from the C heap.
+static constexpr size_t kBackingMemoryMmapThreshold = 64 * 1024;
+// Matches the minMemoryMapAlignment limit the mock ICD reports
+static constexpr size_t kBackingMemoryAlignment = 64;
+
+// Returns zero-filled memory of the given size, or nullptr if the host can't provide it
+static void *AllocateBackingMemory(size_t size) {
+    if (size == 0) return nullptr;
+    if (size >= kBackingMemoryMmapThreshold) {
+#if defined(_WIN32)
+        return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_NORESERVE)
+        flags |= MAP_NORESERVE;
+#endif
+        void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        return data == MAP_FAILED ? nullptr : data;
+#endif
+    }
+#if defined(_WIN32)
+    void *data = _aligned_malloc(size, kBackingMemoryAlignment);
+#else
+    void *data = nullptr;
+    if (posix_memalign(&data, kBackingMemoryAlignment, size) != 0) data = nullptr;
+#endif
+    if (data) memset(data, 0, size);
+    return data;
+}
+
+// size must be the value passed to AllocateBackingMemory
+static void FreeBackingMemory(void *data, size_t size) {
+    if (!data) return;
+    if (size >= kBackingMemoryMmapThreshold) {
+#if defined(_WIN32)
+        VirtualFree(data, 0, MEM_RELEASE);
+#else
+        munmap(data, size);
+#endif
+        return;
+    }
+#if defined(_WIN32)
+    _aligned_free(data);
+#else
+    free(data);
+#endif
+}
+
+}  // namespace vkmock
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "mock_icd_config.h"
+
+namespace vkmock {
+
+// Bytes allocated from each memory heap of a physical device, counting every device created from it. This is the usage
+// VK_EXT_memory_budget reports.
+class HeapUsage {
+  public:
+    static constexpr uint32_t kMaxHeaps = 16;  // VK_MAX_MEMORY_HEAPS
+
+    // Adds size bytes to the heap's usage. If limit isn't 0 and the usage would go past it, adds nothing and returns false.
+    bool Add(uint32_t heap, uint64_t size, uint64_t limit) {
+        std::atomic<uint64_t> &usage = usage_[heap];
+        uint64_t current = usage.load(std::memory_order_relaxed);
+        do {
+            if (limit && (size > limit || current > limit - size)) return false;
+        } while (!usage.compare_exchange_weak(current, current + size, std::memory_order_relaxed));
+        return true;
+    }
+
+    void Remove(uint32_t heap, uint64_t size) { usage_[heap].fetch_sub(size, std::memory_order_relaxed); }
+
+    uint64_t Get(uint32_t heap) const { return usage_[heap].load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<uint64_t> usage_[kMaxHeaps] = {};
+};
+
+// Reads VKMOCK_HEAP_SIZE, a comma-separated list of heap sizes in heap index order, e.g. "256M,2G". Heaps past the end of the
+// list or with an empty or 0 item keep the device's own size, which the returned list gives as 0.
+static std::vector<uint64_t> LoadHeapSizes() {
+    std::vector<uint64_t> sizes;
+    for (const auto &item : GetConfigList("VKMOCK_HEAP_SIZE", ',')) {
+        uint64_t size = 0;
+        if (!item.empty() && !ParseConfigSize(item, &size)) {
+            fprintf(stderr, "vkmock: VKMOCK_HEAP_SIZE: bad heap size \"%s\"\n", item.c_str());
+            size = 0;
+        }
+        sizes.push_back(size);
+    }
+    if (sizes.size() > HeapUsage::kMaxHeaps) sizes.resize(HeapUsage::kMaxHeaps);
+    return sizes;
+}
+
+}  // namespace vkmock
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace vkmock {
+
+// Hands out objects from chunks of slots, so allocating or freeing one is a free list pop or push. Freed slots are reused
+// before new ones are carved out, and destroying the slab releases every chunk at once without visiting the objects still
+// allocated from it. Not thread-safe: each externally synchronized owner, such as a command pool, has its own.
+template <typename T>
+class ObjectSlab {
+    static_assert(std::is_trivially_destructible<T>::value, "ObjectSlab releases objects without destroying them");
+
+  public:
+    ObjectSlab() = default;
+    ObjectSlab(const ObjectSlab &) = delete;
+    ObjectSlab &operator=(const ObjectSlab &) = delete;
+
+    // Returns a value-initialized object
+    T *Allocate() {
+        Slot *slot = free_list_;
+        if (slot) {
+            free_list_ = slot->next;
+        } else {
+            if (next_slot_ == chunk_end_) AddChunk();
+            slot = next_slot_++;
+        }
+        return new (&slot->storage) T();
+    }
+
+    // object must have come from this slab's Allocate()
+    void Free(T *object) {
+        Slot *slot = reinterpret_cast<Slot *>(object);
+        slot->next = free_list_;
+        free_list_ = slot;
+    }
+
+  private:
+    union Slot {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        Slot *next;  // While the slot is on the free list
+    };
+
+    // Chunks double in size up to kMaxChunkSize slots, so small pools stay small
+    static constexpr size_t kFirstChunkSize = 16;
+    static constexpr size_t kMaxChunkSize = 1024;
+
+    void AddChunk() {
+        size_t size = chunks_.empty() ? kFirstChunkSize : chunk_size_ * 2;
+        if (size > kMaxChunkSize) size = kMaxChunkSize;
+        chunks_.emplace_back(new Slot[size]);
+        chunk_size_ = size;
+        next_slot_ = chunks_.back().get();
+        chunk_end_ = next_slot_ + size;
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> chunks_;
+    size_t chunk_size_ = 0;
+    Slot *next_slot_ = nullptr;  // First never-used slot of the newest chunk
+    Slot *chunk_end_ = nullptr;
+    Slot *free_list_ = nullptr;
+};
+
+}  // namespace vkmock
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+#include "mock_icd_config.h"
+#include "mock_icd_profile.h"
+
+namespace vkmock {
+
+// The physical devices every instance has and how they're grouped
+struct PhysicalDeviceConfig {
+    std::vector<std::unique_ptr<DeviceProfile>> profiles;  // As VKMOCK_PROFILE lists them
+    std::vector<const DeviceProfile *> device_profiles;    // One per physical device, nullptr for the mock ICD's own device
+    std::vector<uint32_t> group_sizes;                     // Each device group is the next group_sizes[i] physical devices
+    VkPeerMemoryFeatureFlags peer_memory_features = 0;     // Between any two physical devices in a group, for every heap
+
+    uint32_t DeviceCount() const { return static_cast<uint32_t>(device_profiles.size()); }
+};
+
+// More than anyone will benchmark with, and few enough that a bad setting can't exhaust memory
+static constexpr uint32_t kMaxPhysicalDeviceCount = 1024;
+
+// Parses VKMOCK_DEVICE_GROUPS, the size of each group in order, e.g. "2,2". Devices it doesn't cover get a group each.
+static std::vector<uint32_t> LoadDeviceGroupSizes(uint32_t device_count) {
+    std::vector<uint32_t> group_sizes;
+    uint32_t grouped = 0;
+    for (const std::string &item : GetConfigList("VKMOCK_DEVICE_GROUPS", ',')) {
+        char *end = nullptr;
+        const unsigned long size = strtoul(item.c_str(), &end, 10);
+        if (item.empty() || *end || size == 0 || size > VK_MAX_DEVICE_GROUP_SIZE) {
+            fprintf(stderr, "vkmock: VKMOCK_DEVICE_GROUPS: bad group size \"%s\"\n", item.c_str());
+            group_sizes.clear();
+            grouped = 0;
+            break;
+        }
+        if (grouped == device_count) break;
+        group_sizes.push_back((std::min)(static_cast<uint32_t>(size), device_count - grouped));
+        grouped += group_sizes.back();
+    }
+    group_sizes.resize(group_sizes.size() + device_count - grouped, 1);
+    return group_sizes;
+}
+
+// Parses VKMOCK_PEER_MEMORY_FEATURES, e.g. "copy_src,copy_dst". All memory is host memory that every device in a group can
+// reach, so by default peers can use each other's memory every way there is. Copying to peer memory is always supported, as
+// Vulkan requires.
+static VkPeerMemoryFeatureFlags LoadPeerMemoryFeatures() {
+    struct Feature {
+        const char *name;
+        VkPeerMemoryFeatureFlagBits bit;
+    };
+    static const Feature kFeatures[] = {
+        {"copy_src", VK_PEER_MEMORY_FEATURE_COPY_SRC_BIT},
+        {"copy_dst", VK_PEER_MEMORY_FEATURE_COPY_DST_BIT},
+        {"generic_src", VK_PEER_MEMORY_FEATURE_GENERIC_SRC_BIT},
+        {"generic_dst", VK_PEER_MEMORY_FEATURE_GENERIC_DST_BIT},
+    };
+    if (!GetConfigString("VKMOCK_PEER_MEMORY_FEATURES")) {
+        return VK_PEER_MEMORY_FEATURE_COPY_SRC_BIT | VK_PEER_MEMORY_FEATURE_COPY_DST_BIT | VK_PEER_MEMORY_FEATURE_GENERIC_SRC_BIT |
+               VK_PEER_MEMORY_FEATURE_GENERIC_DST_BIT;
+    }
+    VkPeerMemoryFeatureFlags features = VK_PEER_MEMORY_FEATURE_COPY_DST_BIT;
+    for (const std::string &item : GetConfigList("VKMOCK_PEER_MEMORY_FEATURES", ',')) {
+        const Feature *feature = std::find_if(std::begin(kFeatures), std::end(kFeatures),
+                                              [&item](const Feature &f) { return item == f.name; });
+        if (feature == std::end(kFeatures)) {
+            fprintf(stderr, "vkmock: VKMOCK_PEER_MEMORY_FEATURES: unknown feature \"%s\"\n", item.c_str());
+        } else {
+            features |= feature->bit;
+        }
+    }
+    return features;
+}
+
+// VKMOCK_PROFILE lists a profile for each physical device, separated like PATH, and the last one is reused for any devices
+// after it. An empty item gives a device no profile. Each profile's cache is the matching item of VKMOCK_PROFILE_CACHE, by
+// default the profile's path with .cache appended. There are as many physical devices as VKMOCK_PHYSICAL_DEVICE_COUNT says,
+// by default one per profile.
+static PhysicalDeviceConfig LoadPhysicalDeviceConfig(const DeviceProfileSchema &schema) {
+    PhysicalDeviceConfig config;
+    const std::vector<std::string> paths = GetConfigList("VKMOCK_PROFILE", kConfigPathSeparator);
+    const std::vector<std::string> cache_paths = GetConfigList("VKMOCK_PROFILE_CACHE", kConfigPathSeparator);
+    for (size_t i = 0; i < paths.size(); ++i) {
+        std::unique_ptr<DeviceProfile> profile;
+        if (!paths[i].empty()) {
+            const bool has_cache_path = i < cache_paths.size() && !cache_paths[i].empty();
+            profile = LoadDeviceProfile(paths[i], has_cache_path ? cache_paths[i] : paths[i] + ".cache", schema);
+        }
+        config.profiles.push_back(std::move(profile));
+    }
+
+    const uint64_t default_count = (std::max)(config.profiles.size(), static_cast<size_t>(1));
+    const uint64_t device_count = GetConfigUint("VKMOCK_PHYSICAL_DEVICE_COUNT", default_count);
+    if (device_count > kMaxPhysicalDeviceCount) {
+        fprintf(stderr, "vkmock: VKMOCK_PHYSICAL_DEVICE_COUNT: limiting %llu devices to %u\n",
+                static_cast<unsigned long long>(device_count), kMaxPhysicalDeviceCount);
+    }
+    config.device_profiles.resize((std::min)(device_count, static_cast<uint64_t>(kMaxPhysicalDeviceCount)));
+    for (size_t i = 0; i < config.device_profiles.size() && !config.profiles.empty(); ++i) {
+        config.device_profiles[i] = config.profiles[(std::min)(i, config.profiles.size() - 1)].get();
+    }
+
+    config.group_sizes = LoadDeviceGroupSizes(config.DeviceCount());
+    config.peer_memory_features = LoadPeerMemoryFeatures();
+    return config;
+}
+
+}  // namespace vkmock
@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+#include "mock_icd_handle_table.h"
+#include "mock_icd_trace.h"
+
+// Pipeline caches hold content hashes of the pipelines created with them. A pipeline's key covers everything in its create
+// info, with the shader modules, samplers, layouts and render passes it refers to replaced by content hashes of their own
+// create infos, so keys match across runs and vkGetPipelineCacheData's data warms a later run's cache.
+
+namespace vkmock {
+
+// 128-bit content hash of a pipeline or of an object a pipeline's create info refers to. lo is never 0 or ~0, so it can key
+// a HandleTable.
+struct PipelineKey {
+    uint64_t lo;
+    uint64_t hi;
+};
+
+static bool operator==(const PipelineKey &a, const PipelineKey &b) { return a.lo == b.lo && a.hi == b.hi; }
+
+// Content keys of shader modules, samplers, descriptor set and pipeline layouts, render passes and pipeline libraries,
+// keyed by handle
+using ObjectKeyTable = HandleTable<uint64_t, PipelineKey>;
+
+// Hashes bytes 8 at a time into two independently mixed 64-bit lanes
+class PipelineHasher {
+  public:
+    void Bytes(const void *data, size_t size) {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        for (; size >= sizeof(uint64_t); bytes += sizeof(uint64_t), size -= sizeof(uint64_t)) {
+            uint64_t word;
+            memcpy(&word, bytes, sizeof(word));
+            Mix(word);
+        }
+        if (size) {
+            // The tail's length goes in the top byte, which the tail never reaches
+            uint64_t word = 0;
+            memcpy(&word, bytes, size);
+            Mix(word ^ (uint64_t(size) << 56));
+        }
+    }
+
+    // For scalars and structs without pointers or padding
+    template <typename T>
+    void Value(const T &value) {
+        Bytes(&value, sizeof(value));
+    }
+
+    template <typename T>
+    void Array(const T *values, size_t count) {
+        Value(uint64_t(values ? count : 0));
+        if (values && count) Bytes(values, sizeof(T) * count);
+    }
+
+    void String(const char *text) {
+        const size_t length = text ? strlen(text) : 0;
+        Value(uint64_t(length));
+        Bytes(text, length);
+    }
+
+    // Hashes a struct's pNext chain and its members from after pNext through last, which must have no pointers between
+    // them. Stopping at the last member keeps the struct's tail padding out of the hash.
+    template <typename T, typename Last>
+    void Fields(const T &value, const Last &last) {
+        Chain(value.pNext);
+        const uint8_t *begin = reinterpret_cast<const uint8_t *>(&value) + sizeof(VkBaseInStructure);
+        const uint8_t *end = reinterpret_cast<const uint8_t *>(&last) + sizeof(Last);
+        Bytes(begin, end - begin);
+    }
+
+    // The content key of an object, or a null key for objects without one
+    template <typename Handle>
+    void Object(const ObjectKeyTable &object_keys, Handle handle) {
+        PipelineKey key = {0, 0};
+        if (handle) object_keys.Find((uint64_t)handle, &key);
+        Value(key);
+    }
+
+    // Structs in a chain are hashed as their bytes, so pointers in the ones not handled here count by address and only
+    // match within a run. Creation feedback is written by the call rather than describing the object, so it's left out.
+    void Chain(const void *next) {
+        for (auto link = static_cast<const VkBaseInStructure *>(next); link; link = link->pNext) {
+            switch (link->sType) {
+                case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT:
+                    continue;
+                case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO: {
+                    auto flags = reinterpret_cast<const VkDescriptorSetLayoutBindingFlagsCreateInfo *>(link);
+                    Value(link->sType);
+                    Array(flags->pBindingFlags, flags->bindingCount);
+                    continue;
+                }
+                case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT: {
+                    auto divisors = reinterpret_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT *>(link);
+                    Value(link->sType);
+                    Array(divisors->pVertexBindingDivisors, divisors->vertexBindingDivisorCount);
+                    continue;
+                }
+                default:
+                    break;
+            }
+            const uint32_t size = TraceStructSize(link->sType);
+            Value(link->sType);
+            if (size > sizeof(VkBaseInStructure)) {
+                Bytes(reinterpret_cast<const uint8_t *>(link) + sizeof(VkBaseInStructure), size - sizeof(VkBaseInStructure));
+            }
+        }
+    }
+
+    PipelineKey Finish() const {
+        PipelineKey key = {Avalanche(lo_ ^ words_), Avalanche(hi_ + lo_)};
+        if (key.lo == 0 || key.lo == ~0ull) key.lo = 1;
+        return key;
+    }
+
+  private:
+    static uint64_t Avalanche(uint64_t value) {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ull;
+        value ^= value >> 33;
+        return value;
+    }
+
+    void Mix(uint64_t word) {
+        lo_ = (lo_ ^ word) * 0x9e3779b97f4a7c15ull;
+        lo_ ^= lo_ >> 29;
+        hi_ = ((hi_ << 23) | (hi_ >> 41)) + word;
+        hi_ *= 0xc2b2ae3d27d4eb4full;
+        ++words_;
+    }
+
+    uint64_t lo_ = 0x243f6a8885a308d3ull;
+    uint64_t hi_ = 0x13198a2e03707344ull;
+    uint64_t words_ = 0;
+};
+
+static PipelineKey ShaderModuleKey(const VkShaderModuleCreateInfo &create_info) {
+    PipelineHasher hasher;
+    hasher.Fields(create_info, create_info.flags);
+    hasher.Array(create_info.pCode, create_info.codeSize / sizeof(uint32_t));
+    return hasher.Finish();
+}
+
+static PipelineKey SamplerKey(const VkSamplerCreateInfo &create_info) {
+    PipelineHasher hasher;
+    hasher.Fields(create_info, create_info.unnormalizedCoordinates);
+    return hasher.Finish();
+}
+
+static PipelineKey DescriptorSetLayoutKey(const ObjectKeyTable &object_keys, const VkDescriptorSetLayoutCreateInfo &create_info) {
+    PipelineHasher hasher;
+    hasher.Fields(create_info, create_info.flags);
+    hasher.Value(create_info.bindingCount);
+    for (uint32_t i = 0; i < create_info.bindingCount; ++i) {
+        const VkDescriptorSetLayoutBinding &binding = create_info.pBindings[i];
+        hasher.Value(binding.binding);
+        hasher.Value(binding.descriptorType);
+        hasher.Value(binding.descriptorCount);
+        hasher.Value(binding.stageFlags);
+        const bool has_samplers = binding.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER ||
+                                  binding.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        if (!has_samplers || !binding.pImmutableSamplers) continue;
+        for (uint32_t j = 0; j < binding.descriptorCount; ++j) hasher.Object(object_keys, binding.pImmutableSamplers[j]);
+    }
+    return hasher.Finish();
+}
+
+static PipelineKey PipelineLayoutKey(const ObjectKeyTable &object_keys, const VkPipelineLayoutCreateInfo &create_info) {
+    PipelineHasher hasher;
+    hasher.Fields(create_info, create_info.flags);
+    hasher.Value(create_info.setLayoutCount);
+    for (uint32_t i = 0; i < create_info.setLayoutCount; ++i) hasher.Object(object_keys, create_info.pSetLayouts[i]);
+    hasher.Array(create_info.pPushConstantRanges, create_info.pushConstantRangeCount);
+    return hasher.Finish();
+}
+
+static PipelineKey RenderPassKey(const VkRenderPassCreateInfo &create_info) {
+    PipelineHasher hasher;
+    hasher.Fields(create_info, create_info.flags);
+    hasher.Array(create_info.pAttachments, create_info.attachmentCount);
+    hasher.Value(create_info.subpassCount);
+    for (uint32_t i = 0; i < create_info.subpassCount; ++i) {
+        const VkSubpassDescription &subpass = create_info.pSubpasses[i];
+        hasher.Value(subpass.flags);
+        hasher.Value(subpass.pipelineBindPoint);
+        hasher.Array(subpass.pInputAttachments, subpass.inputAttachmentCount);
+        hasher.Array(subpass.pColorAttachments, subpass.colorAttachmentCount);
+        hasher.Array(subpass.pResolveAttachments, subpass.pResolveAttachments ? subpass.colorAttachmentCount : 0);
+        hasher.Array(subpass.pDepthStencilAttachment, 1);
+        hasher.Array(subpass.pPreserveAttachments, subpass.preserveAttachmentCount);
+    }
+    hasher.Array(create_info.pDependencies, create_info.dependencyCount);
+    return hasher.Finish();
+}
+
+static void HashAttachmentReferences(PipelineHasher *hasher, const VkAttachmentReference2 *references, uint32_t count) {
+    hasher->Value(uint64_t(references ? count : 0));
+    if (!references) return;
+    for (uint32_t i = 0; i < count; ++i) hasher->Fields(references[i], references[i].aspectMask);
+}
+
+static PipelineKey RenderPass2Key(const VkRenderPassCreateInfo2 &create_info) {
+    PipelineHasher hasher;
+    hasher.Fields(create_info, create_info.flags);
+    hasher.Value(create_info.attachmentCount);
+    for (uint32_t i = 0; i < create_info.attachmentCount; ++i) {
+        hasher.Fields(create_info.pAttachments[i], create_info.pAttachments[i].finalLayout);
+    }
+    hasher.Value(create_info.subpassCount);
+    for (uint32_t i = 0; i < create_info.subpassCount; ++i) {
+        const VkSubpassDescription2 &subpass = create_info.pSubpasses[i];
+        hasher.Fields(subpass, subpass.viewMask);
+        HashAttachmentReferences(&hasher, subpass.pInputAttachments, subpass.inputAttachmentCount);
+        HashAttachmentReferences(&hasher, subpass.pColorAttachments, subpass.colorAttachmentCount);
+        HashAttachmentReferences(&hasher, subpass.pResolveAttachments, subpass.colorAttachmentCount);
+        HashAttachmentReferences(&hasher, subpass.pDepthStencilAttachment, 1);
+        hasher.Array(subpass.pPreserveAttachments, subpass.preserveAttachmentCount);
+    }
+    hasher.Value(create_info.dependencyCount);
+    for (uint32_t i = 0; i < create_info.dependencyCount; ++i) {
+        hasher.Fields(create_info.pDependencies[i], create_info.pDependencies[i].viewOffset);
+    }
+    hasher.Array(create_info.pCorrelatedViewMasks, create_info.correlatedViewMaskCount);
+    return hasher.Finish();
+}
+
+// Whether a pipeline is the same doesn't depend on how its creation should fail or return
+static VkPipelineCreateFlags PipelineKeyFlags(VkPipelineCreateFlags flags) {
+    return flags &
+           ~(VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT_EXT | VK_PIPELINE_CREATE_EARLY_RETURN_ON_FAILURE_BIT_EXT);
+}
+
+static void HashShaderStage(PipelineHasher *hasher, const ObjectKeyTable &object_keys,
+                            const VkPipelineShaderStageCreateInfo &stage) {
+    hasher->Fields(stage, stage.stage);
+    hasher->Object(object_keys, stage.module);
+    hasher->String(stage.pName);
+    const VkSpecializationInfo *specialization = stage.pSpecializationInfo;
+    hasher->Value(specialization != nullptr);
+    if (!specialization) return;
+    hasher->Array(specialization->pMapEntries, specialization->mapEntryCount);
+    hasher->Array(static_cast<const uint8_t *>(specialization->pData), specialization->dataSize);
+}
+
+static PipelineKey ComputePipelineKey(const ObjectKeyTable &object_keys, const VkComputePipelineCreateInfo &create_info) {
+    PipelineHasher hasher;
+    hasher.Chain(create_info.pNext);
+    hasher.Value(PipelineKeyFlags(create_info.flags));
+    HashShaderStage(&hasher, object_keys, create_info.stage);
+    hasher.Object(object_keys, create_info.layout);
+    return hasher.Finish();
+}
+
+static bool HasDynamicState(const VkPipelineDynamicStateCreateInfo *dynamic_state, VkDynamicState state) {
+    if (!dynamic_state) return false;
+    for (uint32_t i = 0; i < dynamic_state->dynamicStateCount; ++i) {
+        if (dynamic_state->pDynamicStates[i] == state) return true;
+    }
+    return false;
+}
+
+// Only hashes the state Vulkan says to read, since the app can leave pointers to ignored state dangling
+static PipelineKey GraphicsPipelineKey(const ObjectKeyTable &object_keys, const VkGraphicsPipelineCreateInfo &create_info) {
+    PipelineHasher hasher;
+    hasher.Chain(create_info.pNext);
+    hasher.Value(PipelineKeyFlags(create_info.flags));
+    hasher.Value(create_info.stageCount);
+    VkShaderStageFlags stages = 0;
+    for (uint32_t i = 0; i < create_info.stageCount; ++i) {
+        HashShaderStage(&hasher, object_keys, create_info.pStages[i]);
+        stages |= create_info.pStages[i].stage;
+    }
+    const VkPipelineDynamicStateCreateInfo *dynamic_state = create_info.pDynamicState;
+    hasher.Value(dynamic_state != nullptr);
+    if (dynamic_state) {
+        hasher.Fields(*dynamic_state, dynamic_state->flags);
+        hasher.Array(dynamic_state->pDynamicStates, dynamic_state->dynamicStateCount);
+    }
+
+    const bool mesh = (stages & VK_SHADER_STAGE_MESH_BIT_NV) != 0;
+    const VkPipelineVertexInputStateCreateInfo *vertex_input = mesh ? nullptr : create_info.pVertexInputState;
+    hasher.Value(vertex_input != nullptr);
+    if (vertex_input) {
+        hasher.Fields(*vertex_input, vertex_input->flags);
+        hasher.Array(vertex_input->pVertexBindingDescriptions, vertex_input->vertexBindingDescriptionCount);
+        hasher.Array(vertex_input->pVertexAttributeDescriptions, vertex_input->vertexAttributeDescriptionCount);
+    }
+    const VkPipelineInputAssemblyStateCreateInfo *input_assembly = mesh ? nullptr : create_info.pInputAssemblyState;
+    hasher.Value(input_assembly != nullptr);
+    if (input_assembly) hasher.Fields(*input_assembly, input_assembly->primitiveRestartEnable);
+    const bool tessellation = (stages & VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT) != 0;
+    const VkPipelineTessellationStateCreateInfo *tessellation_state = tessellation ? create_info.pTessellationState : nullptr;
+    hasher.Value(tessellation_state != nullptr);
+    if (tessellation_state) hasher.Fields(*tessellation_state, tessellation_state->patchControlPoints);
+
+    const VkPipelineRasterizationStateCreateInfo *rasterization = create_info.pRasterizationState;
+    hasher.Value(rasterization != nullptr);
+    if (rasterization) hasher.Fields(*rasterization, rasterization->lineWidth);
+    const bool discard = rasterization && rasterization->rasterizerDiscardEnable &&
+                         !HasDynamicState(dynamic_state, VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE_EXT);
+    const VkPipelineViewportStateCreateInfo *viewport = discard ? nullptr : create_info.pViewportState;
+    hasher.Value(viewport != nullptr);
+    if (viewport) {
+        hasher.Fields(*viewport, viewport->flags);
+        hasher.Value(viewport->viewportCount);
+        hasher.Value(viewport->scissorCount);
+        if (!HasDynamicState(dynamic_state, VK_DYNAMIC_STATE_VIEWPORT) &&
+            !HasDynamicState(dynamic_state, VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT_EXT)) {
+            hasher.Array(viewport->pViewports, viewport->viewportCount);
+        }
+        if (!HasDynamicState(dynamic_state, VK_DYNAMIC_STATE_SCISSOR) &&
+            !HasDynamicState(dynamic_state, VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT_EXT)) {
+            hasher.Array(viewport->pScissors, viewport->scissorCount);
+        }
+    }
+    const VkPipelineMultisampleStateCreateInfo *multisample = discard ? nullptr : create_info.pMultisampleState;
+    hasher.Value(multisample != nullptr);
+    if (multisample) {
+        hasher.Fields(*multisample, multisample->minSampleShading);
+        hasher.Array(multisample->pSampleMask, (multisample->rasterizationSamples + 31) / 32);
+        hasher.Value(multisample->alphaToCoverageEnable);
+        hasher.Value(multisample->alphaToOneEnable);
+    }
+    const VkPipelineDepthStencilStateCreateInfo *depth_stencil = discard ? nullptr : create_info.pDepthStencilState;
+    hasher.Value(depth_stencil != nullptr);
+    if (depth_stencil) hasher.Fields(*depth_stencil, depth_stencil->maxDepthBounds);
+    const VkPipelineColorBlendStateCreateInfo *color_blend = discard ? nullptr : create_info.pColorBlendState;
+    hasher.Value(color_blend != nullptr);
+    if (color_blend) {
+        hasher.Fields(*color_blend, color_blend->logicOp);
+        hasher.Array(color_blend->pAttachments, color_blend->attachmentCount);
+        hasher.Value(color_blend->blendConstants);
+    }
+
+    hasher.Object(object_keys, create_info.layout);
+    hasher.Object(object_keys, create_info.renderPass);
+    hasher.Value(create_info.subpass);
+    return hasher.Finish();
+}
+
+// Pipeline libraries count by their own keys, which object_keys holds for pipelines created with
+// VK_PIPELINE_CREATE_LIBRARY_BIT_KHR
+static PipelineKey RayTracingPipelineKey(const ObjectKeyTable &object_keys, const VkRayTracingPipelineCreateInfoKHR &create_info) {
+    PipelineHasher hasher;
+    hasher.Chain(create_info.pNext);
+    hasher.Value(PipelineKeyFlags(create_info.flags));
+    hasher.Value(create_info.stageCount);
+    for (uint32_t i = 0; i < create_info.stageCount; ++i) HashShaderStage(&hasher, object_keys, create_info.pStages[i]);
+    hasher.Value(create_info.groupCount);
+    // Capture replay handles only say which handles the groups get
+    for (uint32_t i = 0; i < create_info.groupCount; ++i) {
+        const VkRayTracingShaderGroupCreateInfoKHR &group = create_info.pGroups[i];
+        hasher.Fields(group, group.intersectionShader);
+    }
+    hasher.Value(create_info.maxPipelineRayRecursionDepth);
+    const VkPipelineLibraryCreateInfoKHR *library_info = create_info.pLibraryInfo;
+    hasher.Value(library_info != nullptr);
+    if (library_info) {
+        hasher.Chain(library_info->pNext);
+        hasher.Value(library_info->libraryCount);
+        for (uint32_t i = 0; i < library_info->libraryCount; ++i) hasher.Object(object_keys, library_info->pLibraries[i]);
+    }
+    const VkRayTracingPipelineInterfaceCreateInfoKHR *library_interface = create_info.pLibraryInterface;
+    hasher.Value(library_interface != nullptr);
+    if (library_interface) hasher.Fields(*library_interface, library_interface->maxPipelineRayHitAttributeSize);
+    const VkPipelineDynamicStateCreateInfo *dynamic_state = create_info.pDynamicState;
+    hasher.Value(dynamic_state != nullptr);
+    if (dynamic_state) {
+        hasher.Fields(*dynamic_state, dynamic_state->flags);
+        hasher.Array(dynamic_state->pDynamicStates, dynamic_state->dynamicStateCount);
+    }
+    hasher.Object(object_keys, create_info.layout);
+    return hasher.Finish();
+}
+
+// vkGetPipelineCacheData's data after the VkPipelineCacheHeaderVersionOne, then entry_count PipelineKeys
+struct PipelineCacheBlobHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t entry_count;
+    PipelineKey checksum;  // Hash of the entries
+};
+
+// The keys of the pipelines created with a cache, or loaded or merged into it. Any number of threads can create pipelines
+// with the same cache at once.
+class PipelineCache {
+  public:
+    static constexpr uint32_t kBlobMagic = 0x504b4d56;  // "VMKP"
+    static constexpr uint32_t kBlobVersion = 1;
+
+    explicit PipelineCache(const VkPipelineCacheHeaderVersionOne &header) : header_(header) {}
+
+    // Counts a hit or a miss
+    bool Find(const PipelineKey &key) {
+        uint64_t hi = 0;
+        const bool hit = entries_.Find(key.lo, &hi) && hi == key.hi;
+        (hit ? hits_ : misses_).fetch_add(1, std::memory_order_relaxed);
+        return hit;
+    }
+
+    void Add(const PipelineKey &key) { entries_.Insert(key.lo, key.hi); }
+
+    void Merge(const PipelineCache &src) {
+        src.entries_.ForEach([this](uint64_t lo, uint64_t hi) { entries_.Insert(lo, hi); });
+    }
+
+    uint64_t Hits() const { return hits_.load(std::memory_order_relaxed); }
+    uint64_t Misses() const { return misses_.load(std::memory_order_relaxed); }
+    size_t Size() const { return entries_.Size(); }
+
+    // Adds the entries of data from vkGetPipelineCacheData, if it came from a compatible device. As Vulkan allows, data that
+    // didn't is ignored.
+    void Load(const void *data, size_t size) {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        VkPipelineCacheHeaderVersionOne header;
+        PipelineCacheBlobHeader blob;
+        if (!data || size < sizeof(header) + sizeof(blob)) return;
+        memcpy(&header, bytes, sizeof(header));
+        if (header.headerSize != sizeof(header) || header.headerVersion != header_.headerVersion ||
+            header.vendorID != header_.vendorID || header.deviceID != header_.deviceID ||
+            memcmp(header.pipelineCacheUUID, header_.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+            return;
+        }
+        memcpy(&blob, bytes + sizeof(header), sizeof(blob));
+        const size_t available = (size - sizeof(header) - sizeof(blob)) / sizeof(PipelineKey);
+        if (blob.magic != kBlobMagic || blob.version != kBlobVersion || blob.entry_count > available) return;
+        std::vector<PipelineKey> keys(static_cast<size_t>(blob.entry_count));
+        if (!keys.empty()) memcpy(keys.data(), bytes + sizeof(header) + sizeof(blob), keys.size() * sizeof(PipelineKey));
+        if (!(Checksum(keys) == blob.checksum)) return;
+        for (const auto &key : keys) Add(key);
+    }
+
+    // vkGetPipelineCacheData. Writes as many whole entries as fit, so even incomplete data can be loaded.
+    VkResult GetData(size_t *data_size, void *data) const {
+        std::vector<PipelineKey> keys;
+        entries_.ForEach([&keys](uint64_t lo, uint64_t hi) { keys.push_back({lo, hi}); });
+        const size_t prefix_size = sizeof(header_) + sizeof(PipelineCacheBlobHeader);
+        const size_t full_size = prefix_size + keys.size() * sizeof(PipelineKey);
+        if (!data) {
+            *data_size = full_size;
+            return VK_SUCCESS;
+        }
+        if (*data_size < prefix_size) {
+            *data_size = 0;
+            return VK_INCOMPLETE;
+        }
+        const size_t fitting = (*data_size - prefix_size) / sizeof(PipelineKey);
+        const VkResult result = fitting < keys.size() ? VK_INCOMPLETE : VK_SUCCESS;
+        if (fitting < keys.size()) keys.resize(fitting);
+        const PipelineCacheBlobHeader blob = {kBlobMagic, kBlobVersion, keys.size(), Checksum(keys)};
+        uint8_t *bytes = static_cast<uint8_t *>(data);
+        memcpy(bytes, &header_, sizeof(header_));
+        memcpy(bytes + sizeof(header_), &blob, sizeof(blob));
+        if (!keys.empty()) memcpy(bytes + prefix_size, keys.data(), keys.size() * sizeof(PipelineKey));
+        *data_size = prefix_size + keys.size() * sizeof(PipelineKey);
+        return result;
+    }
+
+  private:
+    static PipelineKey Checksum(const std::vector<PipelineKey> &keys) {
+        PipelineHasher hasher;
+        hasher.Array(keys.data(), keys.size());
+        return hasher.Finish();
+    }
+
+    const VkPipelineCacheHeaderVersionOne header_;  // Of the device the cache belongs to
+    HandleTable<uint64_t, uint64_t> entries_;        // PipelineKey hi by lo
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+}  // namespace vkmock
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace vkmock {
+
+// An entry point GetInstanceProcAddr can return. func is nullptr for functions of platforms the ICD isn't built for.
+struct ProcEntry {
+    const char *name;
+    void *func;
+};
+
+// mock_icd_generator.py lays out the table of entry points with these same functions, so they must stay in step with
+// ProcNameHash() and MixProcHash() there
+
+// Reads up to 8 bytes of a name as a little-endian word
+static inline uint64_t LoadProcNameWord(const char *bytes, size_t count) {
+    uint64_t word = 0;
+    memcpy(&word, bytes, count);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+// Hashes a word at a time, which is several times faster than hashing names byte by byte
+static inline uint64_t ProcNameHash(const char *name, size_t length) {
+    static constexpr uint64_t kMultiplier = 0x9e3779b97f4a7c15ull;
+    uint64_t hash = length;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) hash = (hash ^ LoadProcNameWord(name + i, 8)) * kMultiplier;
+    return (hash ^ LoadProcNameWord(name + i, length - i)) * kMultiplier;
+}
+
+// MurmurHash3's finalizer
+static inline uint64_t MixProcHash(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+// Slot FindProcSlot() returns for names that aren't in the table
+static constexpr size_t kProcNotFound = SIZE_MAX;
+
+// Finds name in a table laid out by a minimal perfect hash, built by hash-and-displace: the high bits of the name's hash pick
+// a bucket, and the bucket's displacement moves the hash to the one slot the name can be in. A lookup hashes the name once
+// and compares it with one entry, and never allocates.
+template <size_t kBucketCount, size_t kSlotCount>
+static size_t FindProcSlot(const uint16_t (&displacements)[kBucketCount], const ProcEntry (&table)[kSlotCount],
+                           const char *name) {
+    const uint64_t hash = ProcNameHash(name, strlen(name));
+    const size_t slot = MixProcHash(hash + displacements[(hash >> 32) % kBucketCount]) % kSlotCount;
+    return strcmp(table[slot].name, name) == 0 ? slot : kProcNotFound;
+}
+
+}  // namespace vkmock
@@ -0,0 +1,832 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "vulkan/vulkan.h"
+
+namespace vkmock {
+
+// A device profile makes the mock ICD report a real device. It's the DevSim-format JSON that vulkaninfo --json writes, parsed
+// once into a binary cache file that later runs map in place of parsing the JSON again.
+
+// Just enough JSON for vulkaninfo output
+struct JsonNode {
+    enum Type { kNull, kBool, kNumber, kString, kArray, kObject };
+    Type type = kNull;
+    bool boolean = false;
+    std::string text;  // String contents, or a number as written
+    std::string key;   // Member name, if the parent is an object
+    int first_child = -1;
+    int next_sibling = -1;
+};
+
+// A parsed JSON document. Nodes live in one vector and link to their children by index.
+class JsonDocument {
+  public:
+    // Returns false and describes the problem in error if text isn't valid JSON
+    bool Parse(const std::string &text, std::string *error) {
+        text_ = &text;
+        pos_ = 0;
+        nodes_.assign(1, JsonNode());
+        bool ok = ParseValue(0, 0);
+        SkipWhitespace();
+        if (ok && pos_ != text.size()) ok = Fail("unexpected text after the document");
+        if (!ok) *error = error_ + " at offset " + std::to_string(pos_);
+        return ok;
+    }
+
+    const JsonNode *Root() const { return &nodes_[0]; }
+    const JsonNode *FirstChild(const JsonNode &node) const { return Get(node.first_child); }
+    const JsonNode *Next(const JsonNode &node) const { return Get(node.next_sibling); }
+
+    // Returns the object's member with the given name, or nullptr
+    const JsonNode *Member(const JsonNode *object, const char *key) const {
+        if (!object || object->type != JsonNode::kObject) return nullptr;
+        for (const JsonNode *member = FirstChild(*object); member; member = Next(*member)) {
+            if (member->key == key) return member;
+        }
+        return nullptr;
+    }
+
+  private:
+    static constexpr int kMaxDepth = 64;
+
+    const JsonNode *Get(int index) const { return index < 0 ? nullptr : &nodes_[index]; }
+
+    char Peek() const { return pos_ < text_->size() ? (*text_)[pos_] : '\0'; }
+
+    void SkipWhitespace() {
+        while (pos_ < text_->size()) {
+            const char c = (*text_)[pos_];
+            if (c != ' ' && c != '\t' && c != '\r' && c != '\n') break;
+            ++pos_;
+        }
+    }
+
+    bool Consume(const char *literal) {
+        const size_t length = strlen(literal);
+        if (text_->compare(pos_, length, literal) != 0) return false;
+        pos_ += length;
+        return true;
+    }
+
+    static bool IsNumberChar(char c) { return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'; }
+
+    bool Fail(const char *message) {
+        error_ = message;
+        return false;
+    }
+
+    // Nodes may move while a value is parsed, so nodes are referred to by index
+    bool ParseValue(size_t index, int depth) {
+        if (depth > kMaxDepth) return Fail("nesting too deep");
+        SkipWhitespace();
+        const char c = Peek();
+        if (c == '{' || c == '[') return ParseContainer(index, depth);
+        if (c == '"') {
+            nodes_[index].type = JsonNode::kString;
+            return ParseString(&nodes_[index].text);
+        }
+        if (Consume("true")) {
+            nodes_[index].type = JsonNode::kBool;
+            nodes_[index].boolean = true;
+            return true;
+        }
+        if (Consume("false")) {
+            nodes_[index].type = JsonNode::kBool;
+            return true;
+        }
+        if (Consume("null")) return true;
+        const size_t begin = pos_;
+        while (pos_ < text_->size() && IsNumberChar((*text_)[pos_])) ++pos_;
+        if (pos_ == begin) return Fail("unexpected character");
+        nodes_[index].type = JsonNode::kNumber;
+        nodes_[index].text = text_->substr(begin, pos_ - begin);
+        return true;
+    }
+
+    bool ParseContainer(size_t index, int depth) {
+        const bool is_object = (*text_)[pos_++] == '{';
+        const char close = is_object ? '}' : ']';
+        nodes_[index].type = is_object ? JsonNode::kObject : JsonNode::kArray;
+        SkipWhitespace();
+        if (Peek() == close) {
+            ++pos_;
+            return true;
+        }
+        int last_child = -1;
+        while (true) {
+            std::string key;
+            if (is_object) {
+                SkipWhitespace();
+                if (Peek() != '"') return Fail("expected a member name");
+                if (!ParseString(&key)) return false;
+                SkipWhitespace();
+                if (Peek() != ':') return Fail("expected ':'");
+                ++pos_;
+            }
+            const int child = static_cast<int>(nodes_.size());
+            nodes_.push_back(JsonNode());
+            nodes_[child].key.swap(key);
+            if (last_child < 0) {
+                nodes_[index].first_child = child;
+            } else {
+                nodes_[last_child].next_sibling = child;
+            }
+            last_child = child;
+            if (!ParseValue(child, depth + 1)) return false;
+            SkipWhitespace();
+            const char c = Peek();
+            if (c != ',' && c != close) return Fail(is_object ? "expected ',' or '}'" : "expected ',' or ']'");
+            ++pos_;
+            if (c == close) return true;
+        }
+    }
+
+    bool ParseHex4(uint32_t *value) {
+        if (pos_ + 4 > text_->size()) return Fail("bad \\u escape");
+        *value = 0;
+        for (int i = 0; i < 4; ++i) {
+            const char c = (*text_)[pos_++];
+            uint32_t digit = 0;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                digit = c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                digit = c - 'A' + 10;
+            } else {
+                return Fail("bad \\u escape");
+            }
+            *value = *value * 16 + digit;
+        }
+        return true;
+    }
+
+    bool ParseString(std::string *out) {
+        ++pos_;  // Opening quote
+        while (pos_ < text_->size()) {
+            const char c = (*text_)[pos_++];
+            if (c == '"') return true;
+            if (c != '\\') {
+                *out += c;
+                continue;
+            }
+            const char escape = Peek();
+            ++pos_;
+            switch (escape) {
+                case '"':
+                case '\\':
+                case '/':
+                    *out += escape;
+                    break;
+                case 'b':
+                    *out += '\b';
+                    break;
+                case 'f':
+                    *out += '\f';
+                    break;
+                case 'n':
+                    *out += '\n';
+                    break;
+                case 'r':
+                    *out += '\r';
+                    break;
+                case 't':
+                    *out += '\t';
+                    break;
+                case 'u': {
+                    uint32_t code_point = 0;
+                    if (!ParseHex4(&code_point)) return false;
+                    if (code_point >= 0xD800 && code_point < 0xDC00 && Consume("\\u")) {
+                        uint32_t low = 0;
+                        if (!ParseHex4(&low)) return false;
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    AppendUtf8(code_point, out);
+                    break;
+                }
+                default:
+                    return Fail("bad escape in string");
+            }
+        }
+        return Fail("unterminated string");
+    }
+
+    static void AppendUtf8(uint32_t code_point, std::string *out) {
+        if (code_point < 0x80) {
+            *out += static_cast<char>(code_point);
+        } else if (code_point < 0x800) {
+            *out += static_cast<char>(0xC0 | (code_point >> 6));
+            *out += static_cast<char>(0x80 | (code_point & 0x3F));
+        } else if (code_point < 0x10000) {
+            *out += static_cast<char>(0xE0 | (code_point >> 12));
+            *out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            *out += static_cast<char>(0x80 | (code_point & 0x3F));
+        } else {
+            *out += static_cast<char>(0xF0 | (code_point >> 18));
+            *out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+            *out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            *out += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+    }
+
+    const std::string *text_ = nullptr;
+    size_t pos_ = 0;
+    std::string error_;
+    std::vector<JsonNode> nodes_;
+};
+
+// Numbers may also be written as strings, such as "0x1000", and booleans count as 0 or 1
+static bool GetJsonDouble(const JsonNode &node, double *value) {
+    if (node.type == JsonNode::kBool) {
+        *value = node.boolean ? 1 : 0;
+        return true;
+    }
+    if ((node.type != JsonNode::kNumber && node.type != JsonNode::kString) || node.text.empty()) return false;
+    char *end = nullptr;
+    *value = strtod(node.text.c_str(), &end);
+    return *end == '\0';
+}
+
+static bool GetJsonUint64(const JsonNode &node, uint64_t *value) {
+    if ((node.type == JsonNode::kNumber || node.type == JsonNode::kString) && !node.text.empty() && node.text[0] != '-') {
+        // Parse integers directly, since doubles can't hold every 64-bit value
+        char *end = nullptr;
+        const unsigned long long integer = strtoull(node.text.c_str(), &end, 0);
+        if (*end == '\0') {
+            *value = integer;
+            return true;
+        }
+    }
+    double number = 0;
+    if (!GetJsonDouble(node, &number) || number < 0 || number >= 18446744073709551616.0) return false;
+    *value = static_cast<uint64_t>(number);
+    return true;
+}
+
+static bool GetJsonInt64(const JsonNode &node, int64_t *value) {
+    double number = 0;
+    if (!GetJsonDouble(node, &number) || number < -9223372036854775808.0 || number >= 9223372036854775808.0) return false;
+    *value = static_cast<int64_t>(number);
+    return true;
+}
+
+enum class ProfileFieldType : uint32_t {
+    Uint8,
+    Uint32,
+    Int32,
+    Uint64,
+    Size,
+    Float,
+    Bool32,
+};
+
+// Where a profile's JSON member goes in the Vulkan struct it describes. Arrays have a count above 1.
+struct ProfileField {
+    const char *name;
+    size_t offset;
+    ProfileFieldType type;
+    uint32_t count;
+};
+
+struct ProfileFieldList {
+    const ProfileField *fields;
+    size_t count;
+};
+
+template <size_t N>
+static ProfileFieldList MakeProfileFieldList(const ProfileField (&fields)[N]) {
+    return {fields, N};
+}
+
+// The structs too big to list here, whose fields are generated from the Vulkan registry
+struct DeviceProfileSchema {
+    ProfileFieldList limits;
+    ProfileFieldList sparse_properties;
+    ProfileFieldList features;
+};
+
+static size_t ProfileFieldTypeSize(ProfileFieldType type) {
+    switch (type) {
+        case ProfileFieldType::Uint8:
+            return sizeof(uint8_t);
+        case ProfileFieldType::Int32:
+            return sizeof(int32_t);
+        case ProfileFieldType::Uint64:
+            return sizeof(uint64_t);
+        case ProfileFieldType::Size:
+            return sizeof(size_t);
+        case ProfileFieldType::Float:
+            return sizeof(float);
+        case ProfileFieldType::Bool32:
+            return sizeof(VkBool32);
+        default:
+            return sizeof(uint32_t);
+    }
+}
+
+static bool SetProfileValue(const JsonNode &node, ProfileFieldType type, uint8_t *dst) {
+    uint64_t unsigned_value = 0;
+    int64_t signed_value = 0;
+    double float_value = 0;
+    switch (type) {
+        case ProfileFieldType::Uint8:
+            if (!GetJsonUint64(node, &unsigned_value) || unsigned_value > UINT8_MAX) return false;
+            *dst = static_cast<uint8_t>(unsigned_value);
+            return true;
+        case ProfileFieldType::Uint32:
+            if (!GetJsonUint64(node, &unsigned_value) || unsigned_value > UINT32_MAX) return false;
+            *reinterpret_cast<uint32_t *>(dst) = static_cast<uint32_t>(unsigned_value);
+            return true;
+        case ProfileFieldType::Int32:
+            if (!GetJsonInt64(node, &signed_value) || signed_value < INT32_MIN || signed_value > INT32_MAX) return false;
+            *reinterpret_cast<int32_t *>(dst) = static_cast<int32_t>(signed_value);
+            return true;
+        case ProfileFieldType::Uint64:
+            if (!GetJsonUint64(node, &unsigned_value)) return false;
+            *reinterpret_cast<uint64_t *>(dst) = unsigned_value;
+            return true;
+        case ProfileFieldType::Size:
+            if (!GetJsonUint64(node, &unsigned_value) || unsigned_value > SIZE_MAX) return false;
+            *reinterpret_cast<size_t *>(dst) = static_cast<size_t>(unsigned_value);
+            return true;
+        case ProfileFieldType::Float:
+            if (!GetJsonDouble(node, &float_value)) return false;
+            *reinterpret_cast<float *>(dst) = static_cast<float>(float_value);
+            return true;
+        case ProfileFieldType::Bool32:
+            if (!GetJsonDouble(node, &float_value)) return false;
+            *reinterpret_cast<VkBool32 *>(dst) = float_value != 0 ? VK_TRUE : VK_FALSE;
+            return true;
+    }
+    return false;
+}
+
+// Sets the members of the struct at base that the JSON object names. Members it doesn't mention are left alone, and ones the
+// struct doesn't have are ignored, so profiles from newer vulkaninfo versions still load.
+static bool SetProfileFields(const JsonDocument &document, const JsonNode &object, const ProfileFieldList &fields, void *base,
+                             std::string *error) {
+    if (object.type != JsonNode::kObject) {
+        *error = "\"" + object.key + "\" isn't an object";
+        return false;
+    }
+    for (const JsonNode *member = document.FirstChild(object); member; member = document.Next(*member)) {
+        const ProfileField *field = nullptr;
+        for (size_t i = 0; i < fields.count && !field; ++i) {
+            if (member->key == fields.fields[i].name) field = &fields.fields[i];
+        }
+        if (!field) continue;
+        uint8_t *dst = static_cast<uint8_t *>(base) + field->offset;
+        bool ok = true;
+        if (field->count == 1) {
+            ok = SetProfileValue(*member, field->type, dst);
+        } else {
+            ok = member->type == JsonNode::kArray;
+            uint32_t i = 0;
+            for (const JsonNode *element = document.FirstChild(*member); ok && element && i < field->count;
+                 element = document.Next(*element), ++i) {
+                ok = SetProfileValue(*element, field->type, dst + i * ProfileFieldTypeSize(field->type));
+            }
+        }
+        if (!ok) {
+            *error = "bad value for \"" + member->key + "\"";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Parts of a profile. The mock ICD reports its own values for whatever the profile leaves out.
+enum DeviceProfileSection : uint32_t {
+    kProfileProperties = 1 << 0,
+    kProfileFeatures = 1 << 1,
+    kProfileMemoryProperties = 1 << 2,
+    kProfileQueueFamilies = 1 << 3,
+    kProfileExtensions = 1 << 4,
+    kProfileFormats = 1 << 5,
+};
+
+struct DeviceProfileFormat {
+    VkFormat format;
+    VkFormatProperties properties;
+};
+
+// A loaded profile, laid out the same in memory and in the cache file: this struct, then queue_family_count
+// VkQueueFamilyProperties, extension_count VkExtensionProperties sorted by name and format_count DeviceProfileFormats sorted
+// by format
+struct DeviceProfileData {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t data_size;  // Bytes in all, including the arrays
+    // The JSON file the profile came from, so a cache can tell it's out of date
+    uint64_t source_size;
+    int64_t source_mtime;
+    uint32_t sections;  // DeviceProfileSection bits
+    uint32_t queue_family_count;
+    uint32_t extension_count;
+    uint32_t format_count;
+    VkPhysicalDeviceProperties properties;
+    VkPhysicalDeviceFeatures features;
+    VkPhysicalDeviceMemoryProperties memory_properties;
+};
+
+static constexpr uint32_t kDeviceProfileMagic = 0x504B4D56;  // "VMKP"
+// Bump when DeviceProfileData or the arrays after it change, so old caches are rebuilt
+static constexpr uint32_t kDeviceProfileVersion = 1;
+
+static const ProfileField kPhysicalDevicePropertiesFields[] = {
+    {"apiVersion", offsetof(VkPhysicalDeviceProperties, apiVersion), ProfileFieldType::Uint32, 1},
+    {"driverVersion", offsetof(VkPhysicalDeviceProperties, driverVersion), ProfileFieldType::Uint32, 1},
+    {"vendorID", offsetof(VkPhysicalDeviceProperties, vendorID), ProfileFieldType::Uint32, 1},
+    {"deviceID", offsetof(VkPhysicalDeviceProperties, deviceID), ProfileFieldType::Uint32, 1},
+    {"deviceType", offsetof(VkPhysicalDeviceProperties, deviceType), ProfileFieldType::Uint32, 1},
+    {"pipelineCacheUUID", offsetof(VkPhysicalDeviceProperties, pipelineCacheUUID), ProfileFieldType::Uint8, VK_UUID_SIZE},
+};
+
+static const ProfileField kMemoryHeapFields[] = {
+    {"flags", offsetof(VkMemoryHeap, flags), ProfileFieldType::Uint32, 1},
+    {"size", offsetof(VkMemoryHeap, size), ProfileFieldType::Uint64, 1},
+};
+
+static const ProfileField kMemoryTypeFields[] = {
+    {"heapIndex", offsetof(VkMemoryType, heapIndex), ProfileFieldType::Uint32, 1},
+    {"propertyFlags", offsetof(VkMemoryType, propertyFlags), ProfileFieldType::Uint32, 1},
+};
+
+static const ProfileField kQueueFamilyPropertiesFields[] = {
+    {"queueFlags", offsetof(VkQueueFamilyProperties, queueFlags), ProfileFieldType::Uint32, 1},
+    {"queueCount", offsetof(VkQueueFamilyProperties, queueCount), ProfileFieldType::Uint32, 1},
+    {"timestampValidBits", offsetof(VkQueueFamilyProperties, timestampValidBits), ProfileFieldType::Uint32, 1},
+};
+
+static const ProfileField kExtent3DFields[] = {
+    {"width", offsetof(VkExtent3D, width), ProfileFieldType::Uint32, 1},
+    {"height", offsetof(VkExtent3D, height), ProfileFieldType::Uint32, 1},
+    {"depth", offsetof(VkExtent3D, depth), ProfileFieldType::Uint32, 1},
+};
+
+static const ProfileField kExtensionPropertiesFields[] = {
+    {"specVersion", offsetof(VkExtensionProperties, specVersion), ProfileFieldType::Uint32, 1},
+};
+
+static const ProfileField kFormatFields[] = {
+    {"formatID", offsetof(DeviceProfileFormat, format), ProfileFieldType::Uint32, 1},
+    {"linearTilingFeatures", offsetof(DeviceProfileFormat, properties) + offsetof(VkFormatProperties, linearTilingFeatures),
+     ProfileFieldType::Uint32, 1},
+    {"optimalTilingFeatures", offsetof(DeviceProfileFormat, properties) + offsetof(VkFormatProperties, optimalTilingFeatures),
+     ProfileFieldType::Uint32, 1},
+    {"bufferFeatures", offsetof(DeviceProfileFormat, properties) + offsetof(VkFormatProperties, bufferFeatures),
+     ProfileFieldType::Uint32, 1},
+};
+
+// Copies a JSON string into a fixed-size char array, truncating it if needed
+template <size_t N>
+static void CopyProfileString(const JsonNode *node, char (&dst)[N]) {
+    if (!node || node->type != JsonNode::kString) return;
+    const size_t length = (std::min)(node->text.size(), N - 1);
+    memcpy(dst, node->text.data(), length);
+    dst[length] = '\0';
+}
+
+class DeviceProfile {
+  public:
+    DeviceProfile() = default;
+    DeviceProfile(const DeviceProfile &) = delete;
+    DeviceProfile &operator=(const DeviceProfile &) = delete;
+    ~DeviceProfile() { Unmap(); }
+
+    bool Has(DeviceProfileSection section) const { return (data_->sections & section) != 0; }
+    const VkPhysicalDeviceProperties &Properties() const { return data_->properties; }
+    const VkPhysicalDeviceFeatures &Features() const { return data_->features; }
+    const VkPhysicalDeviceMemoryProperties &MemoryProperties() const { return data_->memory_properties; }
+
+    uint32_t QueueFamilyCount() const { return data_->queue_family_count; }
+    const VkQueueFamilyProperties *QueueFamilies() const {
+        return reinterpret_cast<const VkQueueFamilyProperties *>(reinterpret_cast<const uint8_t *>(data_) + sizeof(*data_));
+    }
+
+    uint32_t ExtensionCount() const { return data_->extension_count; }
+    const VkExtensionProperties *Extensions() const {
+        return reinterpret_cast<const VkExtensionProperties *>(QueueFamilies() + data_->queue_family_count);
+    }
+
+    // Returns the extension with the given name, or nullptr if the device doesn't have it
+    const VkExtensionProperties *FindExtension(const char *name) const {
+        const VkExtensionProperties *end = Extensions() + data_->extension_count;
+        const VkExtensionProperties *extension = std::lower_bound(
+            Extensions(), end, name, [](const VkExtensionProperties &a, const char *b) { return strcmp(a.extensionName, b) < 0; });
+        return (extension != end && strcmp(extension->extensionName, name) == 0) ? extension : nullptr;
+    }
+
+    // Formats the profile doesn't list are unsupported, as vulkaninfo leaves those out
+    VkFormatProperties GetFormatProperties(VkFormat format) const {
+        const DeviceProfileFormat *formats = reinterpret_cast<const DeviceProfileFormat *>(Extensions() + data_->extension_count);
+        const DeviceProfileFormat *end = formats + data_->format_count;
+        const DeviceProfileFormat *entry = std::lower_bound(
+            formats, end, format, [](const DeviceProfileFormat &a, VkFormat b) { return a.format < b; });
+        if (entry != end && entry->format == format) return entry->properties;
+        VkFormatProperties unsupported = {};
+        return unsupported;
+    }
+
+    // Maps the cache made from a JSON file of the given size and modification time. Returns false if there's no such cache.
+    bool MapCache(const std::string &path, uint64_t source_size, int64_t source_mtime) {
+#if defined(_WIN32)
+        // Windows reads the cache instead of mapping it, which still skips parsing the JSON
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        if (!file) return false;
+        const std::string bytes = contents.str();
+        storage_.assign((bytes.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+        if (!bytes.empty()) memcpy(storage_.data(), bytes.data(), bytes.size());
+        if (IsValid(storage_.data(), bytes.size(), source_size, source_mtime)) {
+            data_ = reinterpret_cast<const DeviceProfileData *>(storage_.data());
+            return true;
+        }
+        storage_.clear();
+        return false;
+#else
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat cache_stat;
+        void *mapping = MAP_FAILED;
+        if (fstat(fd, &cache_stat) == 0 && cache_stat.st_size >= static_cast<off_t>(sizeof(DeviceProfileData))) {
+            mapping = mmap(nullptr, static_cast<size_t>(cache_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+        if (mapping == MAP_FAILED) return false;
+        const size_t size = static_cast<size_t>(cache_stat.st_size);
+        if (!IsValid(mapping, size, source_size, source_mtime)) {
+            munmap(mapping, size);
+            return false;
+        }
+        mapping_ = mapping;
+        mapping_size_ = size;
+        data_ = static_cast<const DeviceProfileData *>(mapping);
+        return true;
+#endif
+    }
+
+    // Parses the JSON vulkaninfo --json writes, which came from a file of the given size and modification time
+    bool Parse(const std::string &json, uint64_t source_size, int64_t source_mtime, const DeviceProfileSchema &schema,
+               std::string *error) {
+        JsonDocument document;
+        if (!document.Parse(json, error)) return false;
+        const JsonNode *root = document.Root();
+        if (root->type != JsonNode::kObject) {
+            *error = "the profile isn't a JSON object";
+            return false;
+        }
+
+        DeviceProfileData data = {};
+        data.magic = kDeviceProfileMagic;
+        data.version = kDeviceProfileVersion;
+        data.source_size = source_size;
+        data.source_mtime = source_mtime;
+
+        const JsonNode *properties = document.Member(root, "VkPhysicalDeviceProperties");
+        if (properties) {
+            data.sections |= kProfileProperties;
+            if (!SetProfileFields(document, *properties, MakeProfileFieldList(kPhysicalDevicePropertiesFields), &data.properties,
+                                  error)) {
+                return false;
+            }
+            CopyProfileString(document.Member(properties, "deviceName"), data.properties.deviceName);
+            const JsonNode *limits = document.Member(properties, "limits");
+            if (limits && !SetProfileFields(document, *limits, schema.limits, &data.properties.limits, error)) return false;
+            const JsonNode *sparse = document.Member(properties, "sparseProperties");
+            auto sparse_properties = &data.properties.sparseProperties;
+            if (sparse && !SetProfileFields(document, *sparse, schema.sparse_properties, sparse_properties, error)) return false;
+        }
+
+        const JsonNode *features = document.Member(root, "VkPhysicalDeviceFeatures");
+        if (features) {
+            data.sections |= kProfileFeatures;
+            if (!SetProfileFields(document, *features, schema.features, &data.features, error)) return false;
+        }
+
+        const JsonNode *memory_properties = document.Member(root, "VkPhysicalDeviceMemoryProperties");
+        if (memory_properties) {
+            data.sections |= kProfileMemoryProperties;
+            std::vector<VkMemoryHeap> heaps;
+            std::vector<VkMemoryType> types;
+            if (!ParseArray(document, document.Member(memory_properties, "memoryHeaps"), MakeProfileFieldList(kMemoryHeapFields),
+                            VK_MAX_MEMORY_HEAPS, &heaps, error) ||
+                !ParseArray(document, document.Member(memory_properties, "memoryTypes"), MakeProfileFieldList(kMemoryTypeFields),
+                            VK_MAX_MEMORY_TYPES, &types, error)) {
+                return false;
+            }
+            data.memory_properties.memoryHeapCount = static_cast<uint32_t>(heaps.size());
+            std::copy(heaps.begin(), heaps.end(), data.memory_properties.memoryHeaps);
+            data.memory_properties.memoryTypeCount = static_cast<uint32_t>(types.size());
+            std::copy(types.begin(), types.end(), data.memory_properties.memoryTypes);
+        }
+
+        std::vector<VkQueueFamilyProperties> queue_families;
+        const JsonNode *queue_family_array = document.Member(root, "ArrayOfVkQueueFamilyProperties");
+        if (queue_family_array) {
+            data.sections |= kProfileQueueFamilies;
+            if (!ParseArray(document, queue_family_array, MakeProfileFieldList(kQueueFamilyPropertiesFields), UINT32_MAX,
+                            &queue_families, error)) {
+                return false;
+            }
+            size_t i = 0;
+            for (const JsonNode *element = document.FirstChild(*queue_family_array); element; element = document.Next(*element)) {
+                const JsonNode *granularity = document.Member(element, "minImageTransferGranularity");
+                if (granularity && !SetProfileFields(document, *granularity, MakeProfileFieldList(kExtent3DFields),
+                                                     &queue_families[i].minImageTransferGranularity, error)) {
+                    return false;
+                }
+                ++i;
+            }
+        }
+
+        std::vector<VkExtensionProperties> extensions;
+        const JsonNode *extension_array = document.Member(root, "ArrayOfVkExtensionProperties");
+        if (extension_array) {
+            data.sections |= kProfileExtensions;
+            if (!ParseArray(document, extension_array, MakeProfileFieldList(kExtensionPropertiesFields), UINT32_MAX, &extensions,
+                            error)) {
+                return false;
+            }
+            size_t i = 0;
+            for (const JsonNode *element = document.FirstChild(*extension_array); element; element = document.Next(*element)) {
+                CopyProfileString(document.Member(element, "extensionName"), extensions[i++].extensionName);
+            }
+            std::sort(extensions.begin(), extensions.end(), [](const VkExtensionProperties &a, const VkExtensionProperties &b) {
+                return strcmp(a.extensionName, b.extensionName) < 0;
+            });
+        }
+
+        std::vector<DeviceProfileFormat> formats;
+        const JsonNode *format_array = document.Member(root, "ArrayOfVkFormatProperties");
+        if (format_array) {
+            data.sections |= kProfileFormats;
+            if (!ParseArray(document, format_array, MakeProfileFieldList(kFormatFields), UINT32_MAX, &formats, error)) return false;
+            std::sort(formats.begin(), formats.end(),
+                      [](const DeviceProfileFormat &a, const DeviceProfileFormat &b) { return a.format < b.format; });
+        }
+
+        data.queue_family_count = static_cast<uint32_t>(queue_families.size());
+        data.extension_count = static_cast<uint32_t>(extensions.size());
+        data.format_count = static_cast<uint32_t>(formats.size());
+        data.data_size = DataSize(data);
+        storage_.assign((data.data_size + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+        uint8_t *dst = reinterpret_cast<uint8_t *>(storage_.data());
+        memcpy(dst, &data, sizeof(data));
+        dst += sizeof(data);
+        if (!queue_families.empty()) memcpy(dst, queue_families.data(), queue_families.size() * sizeof(queue_families[0]));
+        dst += queue_families.size() * sizeof(VkQueueFamilyProperties);
+        if (!extensions.empty()) memcpy(dst, extensions.data(), extensions.size() * sizeof(extensions[0]));
+        dst += extensions.size() * sizeof(VkExtensionProperties);
+        if (!formats.empty()) memcpy(dst, formats.data(), formats.size() * sizeof(formats[0]));
+        data_ = reinterpret_cast<const DeviceProfileData *>(storage_.data());
+        return true;
+    }
+
+    // Writes the profile where MapCache() will find it. Returns false if it can't.
+    bool WriteCache(const std::string &path) const {
+        // Write a temporary file and rename it over the cache, so another process loading the profile never maps a partial one
+#if defined(_WIN32)
+        const std::string temp_path = path + "." + std::to_string(_getpid()) + ".tmp";
+#else
+        const std::string temp_path = path + "." + std::to_string(getpid()) + ".tmp";
+#endif
+        FILE *file = fopen(temp_path.c_str(), "wb");
+        if (!file) return false;
+        const bool written = fwrite(data_, 1, static_cast<size_t>(data_->data_size), file) == data_->data_size;
+        if (fclose(file) != 0 || !written) {
+            remove(temp_path.c_str());
+            return false;
+        }
+#if defined(_WIN32)
+        remove(path.c_str());  // rename() won't replace an existing file here
+#endif
+        if (rename(temp_path.c_str(), path.c_str()) != 0) {
+            remove(temp_path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+  private:
+    static uint64_t DataSize(const DeviceProfileData &data) {
+        return sizeof(DeviceProfileData) + uint64_t(data.queue_family_count) * sizeof(VkQueueFamilyProperties) +
+               uint64_t(data.extension_count) * sizeof(VkExtensionProperties) +
+               uint64_t(data.format_count) * sizeof(DeviceProfileFormat);
+    }
+
+    static bool IsValid(const void *bytes, size_t size, uint64_t source_size, int64_t source_mtime) {
+        if (size < sizeof(DeviceProfileData)) return false;
+        const DeviceProfileData &data = *static_cast<const DeviceProfileData *>(bytes);
+        return data.magic == kDeviceProfileMagic && data.version == kDeviceProfileVersion && data.data_size == size &&
+               DataSize(data) == size && data.source_size == source_size && data.source_mtime == source_mtime;
+    }
+
+    // Parses an array of objects, each into an element that starts out zeroed
+    template <typename T>
+    static bool ParseArray(const JsonDocument &document, const JsonNode *array, const ProfileFieldList &fields, size_t max_count,
+                           std::vector<T> *elements, std::string *error) {
+        if (!array) return true;
+        if (array->type != JsonNode::kArray) {
+            *error = "\"" + array->key + "\" isn't an array";
+            return false;
+        }
+        for (const JsonNode *element = document.FirstChild(*array); element; element = document.Next(*element)) {
+            if (elements->size() == max_count) {
+                *error = "too many elements in \"" + array->key + "\"";
+                return false;
+            }
+            elements->push_back(T());
+            if (!SetProfileFields(document, *element, fields, &elements->back(), error)) return false;
+        }
+        return true;
+    }
+
+    void Unmap() {
+#if !defined(_WIN32)
+        if (mapping_) munmap(mapping_, mapping_size_);
+#endif
+        mapping_ = nullptr;
+    }
+
+    const DeviceProfileData *data_ = nullptr;
+    std::vector<uint64_t> storage_;  // The profile when it isn't mapped. uint64_t keeps it aligned for DeviceProfileData.
+    void *mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+};
+
+// Loads the profile at path from the cache at cache_path when that's up to date, and otherwise from the JSON, which then
+// refreshes the cache. Returns nullptr if the profile can't be loaded.
+static std::unique_ptr<DeviceProfile> LoadDeviceProfile(const std::string &path, const std::string &cache_path,
+                                                        const DeviceProfileSchema &schema) {
+    std::unique_ptr<DeviceProfile> profile;
+    struct stat source_stat;
+    if (stat(path.c_str(), &source_stat) != 0) {
+        fprintf(stderr, "vkmock: can't read profile %s\n", path.c_str());
+        return profile;
+    }
+    const uint64_t source_size = static_cast<uint64_t>(source_stat.st_size);
+    const int64_t source_mtime = static_cast<int64_t>(source_stat.st_mtime);
+
+    profile.reset(new DeviceProfile());
+    if (profile->MapCache(cache_path, source_size, source_mtime)) return profile;
+
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::string error;
+    if (!file) {
+        fprintf(stderr, "vkmock: can't read profile %s\n", path.c_str());
+        profile.reset();
+    } else if (!profile->Parse(contents.str(), source_size, source_mtime, schema, &error)) {
+        fprintf(stderr, "vkmock: %s: %s\n", path.c_str(), error.c_str());
+        profile.reset();
+    } else if (!profile->WriteCache(cache_path)) {
+        fprintf(stderr, "vkmock: can't write profile cache %s\n", cache_path.c_str());
+    }
+    return profile;
+}
+
+}  // namespace vkmock
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "mock_icd_command_buffer.h"
+
+namespace vkmock {
+
+// Wakes host threads and queue workers blocked on fences, semaphores or idle queues. There's one per device: every signal
+// notifies all waiters, which then recheck their own condition.
+class SyncNotifier {
+  public:
+    // Call after changing state a waiter may be checking
+    void Notify() {
+        // Taking the lock orders the change before any waiter's next check of its condition
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        cv_.notify_all();
+    }
+
+    template <typename Pred>
+    void Wait(Pred pred) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, pred);
+    }
+
+    // Returns false if pred is still false after timeout_ns. Like Vulkan timeouts, UINT64_MAX (and anything close to it)
+    // waits forever.
+    template <typename Pred>
+    bool WaitFor(uint64_t timeout_ns, Pred pred) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (timeout_ns >= kInfiniteTimeout) {
+            cv_.wait(lock, pred);
+            return true;
+        }
+        return cv_.wait_for(lock, std::chrono::nanoseconds(timeout_ns), pred);
+    }
+
+  private:
+    // Longer timeouts would overflow the steady clock's time_point
+    static constexpr uint64_t kInfiniteTimeout = 1ull << 62;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+struct FenceState {
+    std::atomic<bool> signaled{false};
+};
+
+// Binary semaphore. Waiting on it consumes the signal.
+struct SemaphoreState {
+    std::atomic<bool> signaled{false};
+    double gpu_time_ns = 0;  // Simulated GPU time of the last signal, set before signaled
+};
+
+// Event. The host and queues executing vkCmdSetEvent and vkCmdResetEvent both change it, and notify the device's
+// SyncNotifier when they set it, for queues waiting on it.
+struct EventState {
+    std::atomic<bool> set{false};
+    std::atomic<double> gpu_time_ns{0};  // Simulated GPU time of the last set from a queue, set before set is
+};
+
+// A 32-bit word threads can sleep on until it changes. On Linux waiters park in the kernel on the word's address, so waking
+// nobody costs an atomic increment, and elsewhere a mutex and condition variable stand in.
+class Futex {
+  public:
+    using Deadline = std::chrono::steady_clock::time_point;
+
+    uint32_t Load() const { return word_.load(std::memory_order_seq_cst); }
+
+    // Changes the word and wakes every thread waiting on it
+    void Bump() {
+        word_.fetch_add(1, std::memory_order_seq_cst);
+#if defined(__linux__)
+        // A waiter that registered after the increment sees the new word and doesn't sleep
+        if (waiters_.load(std::memory_order_seq_cst) == 0) return;
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word_), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#else
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        cv_.notify_all();
+#endif
+    }
+
+    // Sleeps while the word is still seen, until deadline. Can return early, so callers recheck what they wait for.
+    void Wait(uint32_t seen, Deadline deadline) {
+#if defined(__linux__)
+        timespec timeout = {};
+        const bool forever = deadline == Deadline::max();
+        if (!forever) {
+            const auto now = std::chrono::steady_clock::now();
+            if (deadline <= now) return;
+            const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+            timeout.tv_sec = static_cast<time_t>(remaining / 1000000000);
+            timeout.tv_nsec = static_cast<long>(remaining % 1000000000);
+        }
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word_), FUTEX_WAIT_PRIVATE, seen, forever ? nullptr : &timeout,
+                nullptr, 0);
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+#else
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto changed = [&]() { return word_.load() != seen; };
+        if (deadline == Deadline::max()) {
+            cv_.wait(lock, changed);
+        } else {
+            cv_.wait_until(lock, deadline, changed);
+        }
+#endif
+    }
+
+  private:
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32-bit word");
+    std::atomic<uint32_t> word_{0};
+#if defined(__linux__)
+    std::atomic<uint32_t> waiters_{0};
+#else
+    std::mutex mutex_;
+    std::condition_variable cv_;
+#endif
+};
+
+// Converts a Vulkan timeout to a deadline. Like SyncNotifier::WaitFor(), timeouts past the steady clock's range never end.
+static Futex::Deadline TimeoutDeadline(uint64_t timeout_ns) {
+    if (timeout_ns >= (1ull << 62)) return Futex::Deadline::max();
+    return std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeout_ns);
+}
+
+// Timeline semaphore. Its counter only moves forward, and every signal bumps both its own futex and the device's, which
+// waiters on several semaphores at once sleep on.
+class TimelineSemaphore {
+  public:
+    TimelineSemaphore(uint64_t initial_value, Futex *device_futex) : value_(initial_value), device_futex_(device_futex) {}
+
+    uint64_t Value() const { return value_.load(std::memory_order_acquire); }
+
+    void Signal(uint64_t value) {
+        uint64_t current = value_.load(std::memory_order_relaxed);
+        while (current < value && !value_.compare_exchange_weak(current, value, std::memory_order_release)) {
+        }
+        futex_.Bump();
+        device_futex_->Bump();
+    }
+
+    // False if the counter is still below value at deadline
+    bool WaitFor(uint64_t value, Futex::Deadline deadline) {
+        while (true) {
+            const uint32_t seen = futex_.Load();
+            if (Value() >= value) return true;
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            futex_.Wait(seen, deadline);
+        }
+    }
+
+    std::atomic<double> gpu_time_ns{0};  // Simulated GPU time of the last signal from a queue, set before the counter
+
+  private:
+    std::atomic<uint64_t> value_;
+    Futex futex_;
+    Futex *device_futex_;
+};
+
+// A timeline semaphore value that a batch waits for or signals
+struct TimelinePoint {
+    TimelineSemaphore *semaphore;
+    uint64_t value;
+};
+
+// Waits until all of points, or any of them, are reached. False if that doesn't happen by deadline.
+static bool WaitForTimelinePoints(Futex *device_futex, const std::vector<TimelinePoint> &points, bool wait_any,
+                                  Futex::Deadline deadline) {
+    if (!wait_any || points.size() == 1) {
+        // Each semaphore's own futex only wakes this for its own signals
+        for (const auto &point : points) {
+            if (!point.semaphore->WaitFor(point.value, deadline)) return false;
+        }
+        return true;
+    }
+    while (true) {
+        const uint32_t seen = device_futex->Load();
+        for (const auto &point : points) {
+            if (point.semaphore->Value() >= point.value) return true;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) return false;
+        device_futex->Wait(seen, deadline);
+    }
+}
+
+// One batch of work for a queue worker: a vkQueueSubmit batch, a sparse bind or a present
+struct QueueSubmission {
+    std::atomic<QueueSubmission *> next{nullptr};  // Link in the worker's SubmissionQueue
+    std::vector<SemaphoreState *> wait_semaphores;
+    std::vector<TimelinePoint> timeline_waits;
+    std::vector<const CommandStream *> command_streams;
+    std::vector<SemaphoreState *> signal_semaphores;
+    std::vector<TimelinePoint> timeline_signals;
+    FenceState *fence = nullptr;
+    std::function<void()> on_executed;  // Runs once the batch has executed, before its signals, e.g. to present images
+};
+
+// Lock-free multi-producer single-consumer queue (Dmitry Vyukov's intrusive MPSC queue). Push never blocks or allocates.
+// Pop can miss an item whose Push is still in progress, so a consumer that goes to sleep on an empty queue must be woken by
+// the producer after Push returns.
+class SubmissionQueue {
+  public:
+    SubmissionQueue() : head_(&stub_), tail_(&stub_) {}
+    SubmissionQueue(const SubmissionQueue &) = delete;
+    SubmissionQueue &operator=(const SubmissionQueue &) = delete;
+
+    void Push(QueueSubmission *submission) {
+        submission->next.store(nullptr, std::memory_order_relaxed);
+        QueueSubmission *prev = head_.exchange(submission, std::memory_order_acq_rel);
+        prev->next.store(submission, std::memory_order_release);
+    }
+
+    // Consumer thread only
+    QueueSubmission *Pop() {
+        QueueSubmission *tail = tail_;
+        QueueSubmission *next = tail->next.load(std::memory_order_acquire);
+        if (tail == &stub_) {
+            if (!next) return nullptr;
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next) {
+            tail_ = next;
+            return tail;
+        }
+        // tail is the last item unless a Push is in progress
+        if (tail != head_.load(std::memory_order_acquire)) return nullptr;
+        Push(&stub_);
+        next = tail->next.load(std::memory_order_acquire);
+        if (next) {
+            tail_ = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+  private:
+    QueueSubmission stub_;
+    std::atomic<QueueSubmission *> head_;  // Most recently pushed item
+    QueueSubmission *tail_;                // Next item to pop
+};
+
+// Executes a queue's submissions in order on its own thread, so the app sees the work complete asynchronously
+class QueueWorker {
+  public:
+    QueueWorker() = default;
+    QueueWorker(const QueueWorker &) = delete;
+    QueueWorker &operator=(const QueueWorker &) = delete;
+    ~QueueWorker() { Stop(); }
+
+    // Runs a submission once its semaphore waits are satisfied and returns how long, in nanoseconds, its simulated execution
+    // takes. The worker holds off signaling for that long.
+    using ExecuteFunc = std::function<uint64_t(const QueueSubmission &)>;
+
+    // Timeline semaphore waits sleep on timeline_futex, which every timeline signal on the device bumps
+    void Start(SyncNotifier *notifier, Futex *timeline_futex, ExecuteFunc execute) {
+        notifier_ = notifier;
+        timeline_futex_ = timeline_futex;
+        execute_ = execute;
+        thread_ = std::thread(&QueueWorker::Run, this);
+    }
+
+    bool Running() const { return thread_.joinable(); }
+
+    // Takes ownership of submission. Callers must be externally synchronized, as vkQueueSubmit is.
+    void Submit(QueueSubmission *submission) {
+        submitted_.fetch_add(1);
+        queue_.Push(submission);
+        // Pairs with the fence in Run(): either the worker sees the new submission, or this sees it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            wake_cv_.notify_one();
+        }
+    }
+
+    // Blocks the worker's thread, from inside its ExecuteFunc, until pred is true or the worker is stopping. For commands
+    // that wait on something the host does, such as vkCmdWaitEvents on an event set with vkSetEvent.
+    template <typename Pred>
+    void WaitFromExecute(Pred pred) {
+        notifier_->Wait([&]() { return stop_.load() || pred(); });
+    }
+
+    // Blocks until everything submitted so far has executed
+    void WaitIdle() {
+        const uint64_t target = submitted_.load();
+        notifier_->Wait([&]() { return completed_.load() >= target || stop_.load(); });
+    }
+
+    // Abandons any submissions that haven't executed yet
+    void Stop() {
+        if (!thread_.joinable()) return;
+        stop_ = true;
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            wake_cv_.notify_one();
+        }
+        notifier_->Notify();
+        timeline_futex_->Bump();
+        thread_.join();
+        while (QueueSubmission *submission = queue_.Pop()) delete submission;
+    }
+
+  private:
+    void Run() {
+        while (!stop_) {
+            QueueSubmission *submission = queue_.Pop();
+            if (!submission) {
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                sleeping_.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                submission = queue_.Pop();
+                if (!submission && !stop_) wake_cv_.wait(lock);
+                sleeping_.store(false, std::memory_order_relaxed);
+                if (!submission) continue;
+            }
+            Execute(*submission);
+            delete submission;
+        }
+    }
+
+    void Execute(QueueSubmission &submission) {
+        // Timeline values can also be signaled from the host, so the batch may wait for a signal submitted after it
+        while (!stop_) {
+            const uint32_t seen = timeline_futex_->Load();
+            bool reached = true;
+            for (const auto &wait : submission.timeline_waits) reached = reached && wait.semaphore->Value() >= wait.value;
+            if (reached) break;
+            timeline_futex_->Wait(seen, Futex::Deadline::max());
+        }
+        const auto &waits = submission.wait_semaphores;
+        notifier_->Wait([&]() {
+            if (stop_) return true;
+            for (auto semaphore : waits) {
+                if (!semaphore->signaled.load()) return false;
+            }
+            return true;
+        });
+        for (auto semaphore : waits) semaphore->signaled = false;
+        const uint64_t duration_ns = execute_ ? execute_(submission) : 0;
+        if (duration_ns) {
+            // Finish when a GPU executing submissions back to back would have
+            const auto now = std::chrono::steady_clock::now();
+            if (busy_until_ < now) busy_until_ = now;
+            busy_until_ += std::chrono::nanoseconds(duration_ns);
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            wake_cv_.wait_until(lock, busy_until_, [&]() { return stop_.load(); });
+        }
+        if (submission.on_executed) submission.on_executed();
+        for (auto semaphore : submission.signal_semaphores) semaphore->signaled = true;
+        for (const auto &signal : submission.timeline_signals) signal.semaphore->Signal(signal.value);
+        if (submission.fence) submission.fence->signaled = true;
+        completed_.fetch_add(1);
+        notifier_->Notify();
+    }
+
+    SyncNotifier *notifier_ = nullptr;
+    Futex *timeline_futex_ = nullptr;
+    ExecuteFunc execute_;
+    std::chrono::steady_clock::time_point busy_until_;
+    SubmissionQueue queue_;
+    std::thread thread_;
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> sleeping_{false};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    std::atomic<uint64_t> submitted_{0};
+    std::atomic<uint64_t> completed_{0};
+};
+
+}  // namespace vkmock
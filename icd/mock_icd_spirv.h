@@ -0,0 +1,2937 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+#include "mock_icd_texel.h"
+
+// An interpreter for GLCompute SPIR-V. CompileComputeProgram() translates a shader module's entry point into a
+// ComputeProgram: instructions whose operands are offsets into a register file each invocation has, with every id given
+// its own registers, so running them needs no lookups. ComputeExecutor then runs the workgroups of a dispatch one at a
+// time, switching between a workgroup's invocations whenever one reaches a barrier.
+//
+// Values are made of 32-bit words: a scalar is one, and composites are their components one after another. Only 32-bit
+// integers and floats are supported, along with booleans. Pointers are two words, a region and a byte offset into it: a
+// descriptor's buffer, push constants, workgroup memory or the invocation's own memory. Every access is bounds checked
+// against its region, so shaders reading past the end of a buffer get zeros and their writes there are dropped, as with
+// robustBufferAccess.
+
+namespace vkmock {
+
+// Values from the SPIR-V specification, for the parts of it the interpreter understands
+enum SpvOp : uint32_t {
+    SpvOpNop = 0,
+    SpvOpUndef = 1,
+    SpvOpSourceContinued = 2,
+    SpvOpSource = 3,
+    SpvOpSourceExtension = 4,
+    SpvOpName = 5,
+    SpvOpMemberName = 6,
+    SpvOpString = 7,
+    SpvOpLine = 8,
+    SpvOpExtension = 10,
+    SpvOpExtInstImport = 11,
+    SpvOpExtInst = 12,
+    SpvOpMemoryModel = 14,
+    SpvOpEntryPoint = 15,
+    SpvOpExecutionMode = 16,
+    SpvOpCapability = 17,
+    SpvOpTypeVoid = 19,
+    SpvOpTypeBool = 20,
+    SpvOpTypeInt = 21,
+    SpvOpTypeFloat = 22,
+    SpvOpTypeVector = 23,
+    SpvOpTypeMatrix = 24,
+    SpvOpTypeImage = 25,
+    SpvOpTypeSampler = 26,
+    SpvOpTypeSampledImage = 27,
+    SpvOpTypeArray = 28,
+    SpvOpTypeRuntimeArray = 29,
+    SpvOpTypeStruct = 30,
+    SpvOpTypePointer = 32,
+    SpvOpTypeFunction = 33,
+    SpvOpConstantTrue = 41,
+    SpvOpConstantFalse = 42,
+    SpvOpConstant = 43,
+    SpvOpConstantComposite = 44,
+    SpvOpConstantNull = 46,
+    SpvOpSpecConstantTrue = 48,
+    SpvOpSpecConstantFalse = 49,
+    SpvOpSpecConstant = 50,
+    SpvOpSpecConstantComposite = 51,
+    SpvOpSpecConstantOp = 52,
+    SpvOpFunction = 54,
+    SpvOpFunctionParameter = 55,
+    SpvOpFunctionEnd = 56,
+    SpvOpFunctionCall = 57,
+    SpvOpVariable = 59,
+    SpvOpLoad = 61,
+    SpvOpStore = 62,
+    SpvOpCopyMemory = 63,
+    SpvOpAccessChain = 65,
+    SpvOpInBoundsAccessChain = 66,
+    SpvOpArrayLength = 68,
+    SpvOpDecorate = 71,
+    SpvOpMemberDecorate = 72,
+    SpvOpDecorationGroup = 73,
+    SpvOpGroupDecorate = 74,
+    SpvOpGroupMemberDecorate = 75,
+    SpvOpVectorExtractDynamic = 77,
+    SpvOpVectorInsertDynamic = 78,
+    SpvOpVectorShuffle = 79,
+    SpvOpCompositeConstruct = 80,
+    SpvOpCompositeExtract = 81,
+    SpvOpCompositeInsert = 82,
+    SpvOpCopyObject = 83,
+    SpvOpTranspose = 84,
+    SpvOpSampledImage = 86,
+    SpvOpImageSampleImplicitLod = 87,
+    SpvOpImageSampleExplicitLod = 88,
+    SpvOpImageFetch = 95,
+    SpvOpImageRead = 98,
+    SpvOpImageWrite = 99,
+    SpvOpImage = 100,
+    SpvOpImageQuerySizeLod = 103,
+    SpvOpImageQuerySize = 104,
+    SpvOpImageQueryLevels = 106,
+    SpvOpImageQuerySamples = 107,
+    SpvOpConvertFToU = 109,
+    SpvOpConvertFToS = 110,
+    SpvOpConvertSToF = 111,
+    SpvOpConvertUToF = 112,
+    SpvOpUConvert = 113,
+    SpvOpSConvert = 114,
+    SpvOpFConvert = 115,
+    SpvOpQuantizeToF16 = 116,
+    SpvOpBitcast = 124,
+    SpvOpSNegate = 126,
+    SpvOpFNegate = 127,
+    SpvOpIAdd = 128,
+    SpvOpFAdd = 129,
+    SpvOpISub = 130,
+    SpvOpFSub = 131,
+    SpvOpIMul = 132,
+    SpvOpFMul = 133,
+    SpvOpUDiv = 134,
+    SpvOpSDiv = 135,
+    SpvOpFDiv = 136,
+    SpvOpUMod = 137,
+    SpvOpSRem = 138,
+    SpvOpSMod = 139,
+    SpvOpFRem = 140,
+    SpvOpFMod = 141,
+    SpvOpVectorTimesScalar = 142,
+    SpvOpMatrixTimesScalar = 143,
+    SpvOpVectorTimesMatrix = 144,
+    SpvOpMatrixTimesVector = 145,
+    SpvOpMatrixTimesMatrix = 146,
+    SpvOpOuterProduct = 147,
+    SpvOpDot = 148,
+    SpvOpAny = 154,
+    SpvOpAll = 155,
+    SpvOpIsNan = 156,
+    SpvOpIsInf = 157,
+    SpvOpLogicalEqual = 164,
+    SpvOpLogicalNotEqual = 165,
+    SpvOpLogicalOr = 166,
+    SpvOpLogicalAnd = 167,
+    SpvOpLogicalNot = 168,
+    SpvOpSelect = 169,
+    SpvOpIEqual = 170,
+    SpvOpINotEqual = 171,
+    SpvOpUGreaterThan = 172,
+    SpvOpSGreaterThan = 173,
+    SpvOpUGreaterThanEqual = 174,
+    SpvOpSGreaterThanEqual = 175,
+    SpvOpULessThan = 176,
+    SpvOpSLessThan = 177,
+    SpvOpULessThanEqual = 178,
+    SpvOpSLessThanEqual = 179,
+    SpvOpFOrdEqual = 180,
+    SpvOpFUnordEqual = 181,
+    SpvOpFOrdNotEqual = 182,
+    SpvOpFUnordNotEqual = 183,
+    SpvOpFOrdLessThan = 184,
+    SpvOpFUnordLessThan = 185,
+    SpvOpFOrdGreaterThan = 186,
+    SpvOpFUnordGreaterThan = 187,
+    SpvOpFOrdLessThanEqual = 188,
+    SpvOpFUnordLessThanEqual = 189,
+    SpvOpFOrdGreaterThanEqual = 190,
+    SpvOpFUnordGreaterThanEqual = 191,
+    SpvOpShiftRightLogical = 194,
+    SpvOpShiftRightArithmetic = 195,
+    SpvOpShiftLeftLogical = 196,
+    SpvOpBitwiseOr = 197,
+    SpvOpBitwiseXor = 198,
+    SpvOpBitwiseAnd = 199,
+    SpvOpNot = 200,
+    SpvOpBitFieldInsert = 201,
+    SpvOpBitFieldSExtract = 202,
+    SpvOpBitFieldUExtract = 203,
+    SpvOpBitReverse = 204,
+    SpvOpBitCount = 205,
+    SpvOpControlBarrier = 224,
+    SpvOpMemoryBarrier = 225,
+    SpvOpAtomicLoad = 227,
+    SpvOpAtomicStore = 228,
+    SpvOpAtomicExchange = 229,
+    SpvOpAtomicCompareExchange = 230,
+    SpvOpAtomicCompareExchangeWeak = 231,
+    SpvOpAtomicIIncrement = 232,
+    SpvOpAtomicIDecrement = 233,
+    SpvOpAtomicIAdd = 234,
+    SpvOpAtomicISub = 235,
+    SpvOpAtomicSMin = 236,
+    SpvOpAtomicUMin = 237,
+    SpvOpAtomicSMax = 238,
+    SpvOpAtomicUMax = 239,
+    SpvOpAtomicAnd = 240,
+    SpvOpAtomicOr = 241,
+    SpvOpAtomicXor = 242,
+    SpvOpPhi = 245,
+    SpvOpLoopMerge = 246,
+    SpvOpSelectionMerge = 247,
+    SpvOpLabel = 248,
+    SpvOpBranch = 249,
+    SpvOpBranchConditional = 250,
+    SpvOpSwitch = 251,
+    SpvOpKill = 252,
+    SpvOpReturn = 253,
+    SpvOpReturnValue = 254,
+    SpvOpUnreachable = 255,
+    SpvOpLifetimeStart = 256,
+    SpvOpLifetimeStop = 257,
+    SpvOpNoLine = 317,
+    SpvOpModuleProcessed = 330,
+    SpvOpExecutionModeId = 331,
+    SpvOpDecorateId = 332,
+    SpvOpCopyLogical = 400,
+    SpvOpTerminateInvocation = 4416,
+    SpvOpDecorateString = 5632,
+    SpvOpMemberDecorateString = 5633,
+};
+
+enum SpvDecoration : uint32_t {
+    SpvDecorationSpecId = 1,
+    SpvDecorationRowMajor = 4,
+    SpvDecorationArrayStride = 6,
+    SpvDecorationMatrixStride = 7,
+    SpvDecorationBuiltIn = 11,
+    SpvDecorationBinding = 33,
+    SpvDecorationDescriptorSet = 34,
+    SpvDecorationOffset = 35,
+};
+
+enum SpvBuiltIn : uint32_t {
+    SpvBuiltInNumWorkgroups = 24,
+    SpvBuiltInWorkgroupSize = 25,
+    SpvBuiltInWorkgroupId = 26,
+    SpvBuiltInLocalInvocationId = 27,
+    SpvBuiltInGlobalInvocationId = 28,
+    SpvBuiltInLocalInvocationIndex = 29,
+};
+
+enum SpvStorageClass : uint32_t {
+    SpvStorageClassUniformConstant = 0,
+    SpvStorageClassInput = 1,
+    SpvStorageClassUniform = 2,
+    SpvStorageClassWorkgroup = 4,
+    SpvStorageClassPrivate = 6,
+    SpvStorageClassFunction = 7,
+    SpvStorageClassPushConstant = 9,
+    SpvStorageClassStorageBuffer = 12,
+};
+
+enum SpvDim : uint32_t {
+    SpvDim1D = 0,
+    SpvDim2D = 1,
+    SpvDim3D = 2,
+    SpvDimCube = 3,
+    SpvDimRect = 4,
+};
+
+static constexpr uint32_t kSpirvMagic = 0x07230203;
+static constexpr uint32_t kSpvExecutionModelGLCompute = 5;
+static constexpr uint32_t kSpvExecutionModeLocalSize = 17;
+static constexpr uint32_t kSpvExecutionModeLocalSizeId = 38;
+
+// GLSL.std.450 extended instructions
+enum GLSLstd450 : uint32_t {
+    GLSLstd450Round = 1,
+    GLSLstd450RoundEven = 2,
+    GLSLstd450Trunc = 3,
+    GLSLstd450FAbs = 4,
+    GLSLstd450SAbs = 5,
+    GLSLstd450FSign = 6,
+    GLSLstd450SSign = 7,
+    GLSLstd450Floor = 8,
+    GLSLstd450Ceil = 9,
+    GLSLstd450Fract = 10,
+    GLSLstd450Radians = 11,
+    GLSLstd450Degrees = 12,
+    GLSLstd450Sin = 13,
+    GLSLstd450Cos = 14,
+    GLSLstd450Tan = 15,
+    GLSLstd450Asin = 16,
+    GLSLstd450Acos = 17,
+    GLSLstd450Atan = 18,
+    GLSLstd450Sinh = 19,
+    GLSLstd450Cosh = 20,
+    GLSLstd450Tanh = 21,
+    GLSLstd450Asinh = 22,
+    GLSLstd450Acosh = 23,
+    GLSLstd450Atanh = 24,
+    GLSLstd450Atan2 = 25,
+    GLSLstd450Pow = 26,
+    GLSLstd450Exp = 27,
+    GLSLstd450Log = 28,
+    GLSLstd450Exp2 = 29,
+    GLSLstd450Log2 = 30,
+    GLSLstd450Sqrt = 31,
+    GLSLstd450InverseSqrt = 32,
+    GLSLstd450FMin = 37,
+    GLSLstd450UMin = 38,
+    GLSLstd450SMin = 39,
+    GLSLstd450FMax = 40,
+    GLSLstd450UMax = 41,
+    GLSLstd450SMax = 42,
+    GLSLstd450FClamp = 43,
+    GLSLstd450UClamp = 44,
+    GLSLstd450SClamp = 45,
+    GLSLstd450FMix = 46,
+    GLSLstd450Step = 48,
+    GLSLstd450SmoothStep = 49,
+    GLSLstd450Fma = 50,
+    GLSLstd450Ldexp = 53,
+    GLSLstd450PackSnorm4x8 = 54,
+    GLSLstd450PackUnorm4x8 = 55,
+    GLSLstd450PackSnorm2x16 = 56,
+    GLSLstd450PackUnorm2x16 = 57,
+    GLSLstd450PackHalf2x16 = 58,
+    GLSLstd450UnpackSnorm2x16 = 60,
+    GLSLstd450UnpackUnorm2x16 = 61,
+    GLSLstd450UnpackHalf2x16 = 62,
+    GLSLstd450UnpackSnorm4x8 = 63,
+    GLSLstd450UnpackUnorm4x8 = 64,
+    GLSLstd450Length = 66,
+    GLSLstd450Distance = 67,
+    GLSLstd450Cross = 68,
+    GLSLstd450Normalize = 69,
+    GLSLstd450FaceForward = 70,
+    GLSLstd450Reflect = 71,
+    GLSLstd450Refract = 72,
+    GLSLstd450FindILsb = 73,
+    GLSLstd450FindSMsb = 74,
+    GLSLstd450FindUMsb = 75,
+    GLSLstd450NMin = 79,
+    GLSLstd450NMax = 80,
+    GLSLstd450NClamp = 81,
+};
+
+// Interpreter instructions without a SPIR-V equivalent, numbered past every SPIR-V opcode
+enum ComputeOp : uint32_t {
+    kComputeOpGather = 0x10000,  // Copies the words data lists into the result, for shuffles and composite construction
+    kComputeOpLoadHandle,  // Loads the region of an image or sampler variable, which is what stands for it
+};
+
+// A compiled instruction. Operands are register offsets unless noted otherwise.
+struct SpirvInstruction {
+    uint32_t op;  // SpvOp or ComputeOp
+    uint32_t result;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+    uint32_t count;  // Words of the result, which component-wise operations have one of per component
+    uint32_t aux;  // Operation specific, such as the GLSL.std.450 instruction
+    uint32_t data;  // Offset of any further operands in ComputeProgram::data
+};
+
+static constexpr uint32_t kNoOperand = ~0u;
+
+// Pointer regions. Descriptors are kFirstResourceRegion plus the resource index shifted up 16 bits plus the array element.
+static constexpr uint32_t kNullRegion = 0;
+static constexpr uint32_t kPushConstantRegion = 1;
+static constexpr uint32_t kWorkgroupRegion = 2;
+static constexpr uint32_t kInvocationRegion = 3;
+static constexpr uint32_t kFirstResourceRegion = 4;
+static constexpr uint32_t kResourceElementBits = 16;
+
+static constexpr uint32_t kMaxPushConstantSize = 256;
+
+// A descriptor set binding the program uses
+struct ComputeResource {
+    uint32_t set;
+    uint32_t binding;
+    uint32_t count;  // Array elements, 0 for runtime arrays
+};
+
+// An input variable the invocation's memory holds at offset
+struct ComputeBuiltin {
+    uint32_t builtin;
+    uint32_t offset;
+};
+
+struct ComputeProgram {
+    std::vector<SpirvInstruction> code;
+    std::vector<uint32_t> data;
+    uint32_t entry = 0;  // Where the entry point's code starts
+    std::vector<uint32_t> registers;  // Every invocation's registers start as these: constants, variable pointers and zeros
+    std::vector<uint8_t> invocation_memory;  // Private, Function and Input variables, holding Private initializers
+    uint32_t workgroup_memory_size = 0;
+    std::vector<ComputeResource> resources;
+    std::vector<ComputeBuiltin> builtins;
+    uint32_t local_size[3] = {1, 1, 1};
+};
+
+// What a descriptor gives the program. Buffers are just data and size, while images are one mip level of the view, from its
+// base array layer, and samplers have the filtering and addressing of the descriptor's sampler.
+struct ComputeBinding {
+    uint8_t *data = nullptr;
+    uint32_t size = 0;
+    const TexelFormat *format = nullptr;  // nullptr for images whose texels can't be converted, which read as zeros
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t depth = 0;  // Depth of 3D images, array layers of the others
+    size_t row_pitch = 0;
+    size_t slice_pitch = 0;  // Between depth slices or array layers
+    bool linear_filter = false;
+    bool unnormalized_coordinates = false;
+    VkSamplerAddressMode address_modes[3] = {VK_SAMPLER_ADDRESS_MODE_REPEAT, VK_SAMPLER_ADDRESS_MODE_REPEAT,
+                                             VK_SAMPLER_ADDRESS_MODE_REPEAT};
+};
+
+struct ComputeDispatch {
+    const ComputeProgram *program = nullptr;
+    std::vector<std::vector<ComputeBinding>> resources;  // For each of the program's resources, each array element
+    uint8_t push_constants[kMaxPushConstantSize] = {};
+    uint32_t base_group[3] = {0, 0, 0};
+    uint32_t group_count[3] = {0, 0, 0};
+};
+
+static inline float AsFloat(uint32_t word) {
+    float value;
+    memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+static inline int32_t AsInt(uint32_t word) { return static_cast<int32_t>(word); }
+
+static inline uint32_t FloatWord(float value) {
+    uint32_t word;
+    memcpy(&word, &value, sizeof(word));
+    return word;
+}
+
+// Float to integer conversions are undefined out of range, so they saturate rather than trap
+static inline uint32_t FloatToUint(float value) {
+    if (!(value > 0.0f)) return 0;
+    if (value >= 4294967296.0f) return UINT32_MAX;
+    return static_cast<uint32_t>(value);
+}
+
+static inline uint32_t FloatToInt(float value) {
+    if (value != value) return 0;
+    if (value <= -2147483648.0f) return 0x80000000u;
+    if (value >= 2147483648.0f) return 0x7FFFFFFFu;
+    return static_cast<uint32_t>(static_cast<int32_t>(value));
+}
+
+static inline uint32_t BitReverse(uint32_t value) {
+    value = ((value >> 1) & 0x55555555u) | ((value & 0x55555555u) << 1);
+    value = ((value >> 2) & 0x33333333u) | ((value & 0x33333333u) << 2);
+    value = ((value >> 4) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4);
+    value = ((value >> 8) & 0x00FF00FFu) | ((value & 0x00FF00FFu) << 8);
+    return (value >> 16) | (value << 16);
+}
+
+static inline uint32_t BitCount(uint32_t value) {
+    uint32_t count = 0;
+    for (; value; value &= value - 1) ++count;
+    return count;
+}
+
+// Index of the most significant set bit, or -1
+static inline uint32_t FindMsb(uint32_t value) {
+    uint32_t index = ~0u;
+    for (; value; value >>= 1) ++index;
+    return index;
+}
+
+static inline uint32_t BitFieldMask(uint32_t count) { return count >= 32 ? ~0u : (1u << count) - 1; }
+
+template <typename Func>
+static inline void ComponentWise(uint32_t *r, const SpirvInstruction &i, Func func) {
+    for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = func(r[i.a + k]);
+}
+
+template <typename Func>
+static inline void ComponentWise2(uint32_t *r, const SpirvInstruction &i, Func func) {
+    for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = func(r[i.a + k], r[i.b + k]);
+}
+
+template <typename Func>
+static inline void ComponentWise3(uint32_t *r, const SpirvInstruction &i, Func func) {
+    for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = func(r[i.a + k], r[i.b + k], r[i.c + k]);
+}
+
+template <typename Func>
+static inline void FloatWise(uint32_t *r, const SpirvInstruction &i, Func func) {
+    for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = FloatWord(func(AsFloat(r[i.a + k])));
+}
+
+template <typename Func>
+static inline void FloatWise2(uint32_t *r, const SpirvInstruction &i, Func func) {
+    for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = FloatWord(func(AsFloat(r[i.a + k]), AsFloat(r[i.b + k])));
+}
+
+template <typename Func>
+static inline void FloatWise3(uint32_t *r, const SpirvInstruction &i, Func func) {
+    for (uint32_t k = 0; k < i.count; ++k) {
+        r[i.result + k] = FloatWord(func(AsFloat(r[i.a + k]), AsFloat(r[i.b + k]), AsFloat(r[i.c + k])));
+    }
+}
+
+template <typename Func>
+static inline void FloatCompare(uint32_t *r, const SpirvInstruction &i, Func func) {
+    for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = func(AsFloat(r[i.a + k]), AsFloat(r[i.b + k])) ? 1 : 0;
+}
+
+static inline float FloatDot(const uint32_t *a, const uint32_t *b, uint32_t count) {
+    float sum = 0.0f;
+    for (uint32_t k = 0; k < count; ++k) sum += AsFloat(a[k]) * AsFloat(b[k]);
+    return sum;
+}
+
+static inline float Unorm(uint32_t value, uint32_t max) { return static_cast<float>(value) / static_cast<float>(max); }
+
+static inline float Snorm(int32_t value, int32_t max) { return (std::max)(static_cast<float>(value) / max, -1.0f); }
+
+static inline uint32_t PackNorm(float value, bool is_signed, uint32_t bits) {
+    const float max = static_cast<float>((1u << (is_signed ? bits - 1 : bits)) - 1);
+    value = (std::min)((std::max)(value, is_signed ? -1.0f : 0.0f), 1.0f);
+    return static_cast<uint32_t>(static_cast<int32_t>(roundf(value * max))) & BitFieldMask(bits);
+}
+
+// The GLSL.std.450 instruction in i.aux. i.data is the component count of the first operand for the instructions whose
+// result has a different one.
+static void ExecuteGlsl(uint32_t *r, const SpirvInstruction &i) {
+    switch (i.aux) {
+        case GLSLstd450Round:
+            FloatWise(r, i, [](float x) { return roundf(x); });
+            break;
+        case GLSLstd450RoundEven:
+            FloatWise(r, i, [](float x) { return nearbyintf(x); });
+            break;
+        case GLSLstd450Trunc:
+            FloatWise(r, i, [](float x) { return truncf(x); });
+            break;
+        case GLSLstd450FAbs:
+            FloatWise(r, i, [](float x) { return fabsf(x); });
+            break;
+        case GLSLstd450SAbs:
+            ComponentWise(r, i, [](uint32_t x) { return static_cast<int32_t>(x) < 0 ? 0u - x : x; });
+            break;
+        case GLSLstd450FSign:
+            FloatWise(r, i, [](float x) { return x > 0.0f ? 1.0f : (x < 0.0f ? -1.0f : 0.0f); });
+            break;
+        case GLSLstd450SSign:
+            ComponentWise(r, i, [](uint32_t x) {
+                return static_cast<int32_t>(x) > 0 ? 1u : (static_cast<int32_t>(x) < 0 ? ~0u : 0u);
+            });
+            break;
+        case GLSLstd450Floor:
+            FloatWise(r, i, [](float x) { return floorf(x); });
+            break;
+        case GLSLstd450Ceil:
+            FloatWise(r, i, [](float x) { return ceilf(x); });
+            break;
+        case GLSLstd450Fract:
+            FloatWise(r, i, [](float x) { return x - floorf(x); });
+            break;
+        case GLSLstd450Radians:
+            FloatWise(r, i, [](float x) { return x * 0.017453292519943295f; });
+            break;
+        case GLSLstd450Degrees:
+            FloatWise(r, i, [](float x) { return x * 57.29577951308232f; });
+            break;
+        case GLSLstd450Sin:
+            FloatWise(r, i, [](float x) { return sinf(x); });
+            break;
+        case GLSLstd450Cos:
+            FloatWise(r, i, [](float x) { return cosf(x); });
+            break;
+        case GLSLstd450Tan:
+            FloatWise(r, i, [](float x) { return tanf(x); });
+            break;
+        case GLSLstd450Asin:
+            FloatWise(r, i, [](float x) { return asinf(x); });
+            break;
+        case GLSLstd450Acos:
+            FloatWise(r, i, [](float x) { return acosf(x); });
+            break;
+        case GLSLstd450Atan:
+            FloatWise(r, i, [](float x) { return atanf(x); });
+            break;
+        case GLSLstd450Sinh:
+            FloatWise(r, i, [](float x) { return sinhf(x); });
+            break;
+        case GLSLstd450Cosh:
+            FloatWise(r, i, [](float x) { return coshf(x); });
+            break;
+        case GLSLstd450Tanh:
+            FloatWise(r, i, [](float x) { return tanhf(x); });
+            break;
+        case GLSLstd450Asinh:
+            FloatWise(r, i, [](float x) { return asinhf(x); });
+            break;
+        case GLSLstd450Acosh:
+            FloatWise(r, i, [](float x) { return acoshf(x); });
+            break;
+        case GLSLstd450Atanh:
+            FloatWise(r, i, [](float x) { return atanhf(x); });
+            break;
+        case GLSLstd450Atan2:
+            FloatWise2(r, i, [](float y, float x) { return atan2f(y, x); });
+            break;
+        case GLSLstd450Pow:
+            FloatWise2(r, i, [](float x, float y) { return powf(x, y); });
+            break;
+        case GLSLstd450Exp:
+            FloatWise(r, i, [](float x) { return expf(x); });
+            break;
+        case GLSLstd450Log:
+            FloatWise(r, i, [](float x) { return logf(x); });
+            break;
+        case GLSLstd450Exp2:
+            FloatWise(r, i, [](float x) { return exp2f(x); });
+            break;
+        case GLSLstd450Log2:
+            FloatWise(r, i, [](float x) { return log2f(x); });
+            break;
+        case GLSLstd450Sqrt:
+            FloatWise(r, i, [](float x) { return sqrtf(x); });
+            break;
+        case GLSLstd450InverseSqrt:
+            FloatWise(r, i, [](float x) { return 1.0f / sqrtf(x); });
+            break;
+        case GLSLstd450FMin:
+        case GLSLstd450NMin:
+            FloatWise2(r, i, [](float x, float y) { return fminf(x, y); });
+            break;
+        case GLSLstd450UMin:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return (std::min)(x, y); });
+            break;
+        case GLSLstd450SMin:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) {
+                return static_cast<uint32_t>((std::min)(static_cast<int32_t>(x), static_cast<int32_t>(y)));
+            });
+            break;
+        case GLSLstd450FMax:
+        case GLSLstd450NMax:
+            FloatWise2(r, i, [](float x, float y) { return fmaxf(x, y); });
+            break;
+        case GLSLstd450UMax:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return (std::max)(x, y); });
+            break;
+        case GLSLstd450SMax:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) {
+                return static_cast<uint32_t>((std::max)(static_cast<int32_t>(x), static_cast<int32_t>(y)));
+            });
+            break;
+        case GLSLstd450FClamp:
+        case GLSLstd450NClamp:
+            FloatWise3(r, i, [](float x, float lo, float hi) { return fminf(fmaxf(x, lo), hi); });
+            break;
+        case GLSLstd450UClamp:
+            ComponentWise3(r, i, [](uint32_t x, uint32_t lo, uint32_t hi) { return (std::min)((std::max)(x, lo), hi); });
+            break;
+        case GLSLstd450SClamp:
+            ComponentWise3(r, i, [](uint32_t x, uint32_t lo, uint32_t hi) {
+                const int32_t value = (std::max)(static_cast<int32_t>(x), static_cast<int32_t>(lo));
+                return static_cast<uint32_t>((std::min)(value, static_cast<int32_t>(hi)));
+            });
+            break;
+        case GLSLstd450FMix:
+            FloatWise3(r, i, [](float x, float y, float a) { return x * (1.0f - a) + y * a; });
+            break;
+        case GLSLstd450Step:
+            FloatWise2(r, i, [](float edge, float x) { return x < edge ? 0.0f : 1.0f; });
+            break;
+        case GLSLstd450SmoothStep:
+            FloatWise3(r, i, [](float edge0, float edge1, float x) {
+                const float t = fminf(fmaxf((x - edge0) / (edge1 - edge0), 0.0f), 1.0f);
+                return t * t * (3.0f - 2.0f * t);
+            });
+            break;
+        case GLSLstd450Fma:
+            FloatWise3(r, i, [](float a, float b, float c) { return fmaf(a, b, c); });
+            break;
+        case GLSLstd450Ldexp:
+            for (uint32_t k = 0; k < i.count; ++k) {
+                r[i.result + k] = FloatWord(ldexpf(AsFloat(r[i.a + k]), static_cast<int32_t>(r[i.b + k])));
+            }
+            break;
+        case GLSLstd450PackSnorm4x8:
+        case GLSLstd450PackUnorm4x8: {
+            uint32_t packed = 0;
+            for (uint32_t k = 0; k < 4; ++k) {
+                packed |= PackNorm(AsFloat(r[i.a + k]), i.aux == GLSLstd450PackSnorm4x8, 8) << (8 * k);
+            }
+            r[i.result] = packed;
+            break;
+        }
+        case GLSLstd450PackSnorm2x16:
+        case GLSLstd450PackUnorm2x16:
+            r[i.result] = PackNorm(AsFloat(r[i.a]), i.aux == GLSLstd450PackSnorm2x16, 16) |
+                          PackNorm(AsFloat(r[i.a + 1]), i.aux == GLSLstd450PackSnorm2x16, 16) << 16;
+            break;
+        case GLSLstd450PackHalf2x16:
+            r[i.result] = FloatToHalf(AsFloat(r[i.a])) | static_cast<uint32_t>(FloatToHalf(AsFloat(r[i.a + 1]))) << 16;
+            break;
+        case GLSLstd450UnpackSnorm2x16:
+            for (uint32_t k = 0; k < 2; ++k) {
+                r[i.result + k] = FloatWord(Snorm(static_cast<int16_t>(r[i.a] >> (16 * k)), 32767));
+            }
+            break;
+        case GLSLstd450UnpackUnorm2x16:
+            for (uint32_t k = 0; k < 2; ++k) r[i.result + k] = FloatWord(Unorm((r[i.a] >> (16 * k)) & 0xFFFF, 65535));
+            break;
+        case GLSLstd450UnpackHalf2x16:
+            for (uint32_t k = 0; k < 2; ++k) {
+                r[i.result + k] = FloatWord(HalfToFloat(static_cast<uint16_t>(r[i.a] >> (16 * k))));
+            }
+            break;
+        case GLSLstd450UnpackSnorm4x8:
+            for (uint32_t k = 0; k < 4; ++k) {
+                r[i.result + k] = FloatWord(Snorm(static_cast<int8_t>(r[i.a] >> (8 * k)), 127));
+            }
+            break;
+        case GLSLstd450UnpackUnorm4x8:
+            for (uint32_t k = 0; k < 4; ++k) r[i.result + k] = FloatWord(Unorm((r[i.a] >> (8 * k)) & 0xFF, 255));
+            break;
+        case GLSLstd450Length:
+            r[i.result] = FloatWord(sqrtf(FloatDot(&r[i.a], &r[i.a], i.data)));
+            break;
+        case GLSLstd450Distance: {
+            float sum = 0.0f;
+            for (uint32_t k = 0; k < i.data; ++k) {
+                const float d = AsFloat(r[i.a + k]) - AsFloat(r[i.b + k]);
+                sum += d * d;
+            }
+            r[i.result] = FloatWord(sqrtf(sum));
+            break;
+        }
+        case GLSLstd450Cross: {
+            const float a[3] = {AsFloat(r[i.a]), AsFloat(r[i.a + 1]), AsFloat(r[i.a + 2])};
+            const float b[3] = {AsFloat(r[i.b]), AsFloat(r[i.b + 1]), AsFloat(r[i.b + 2])};
+            r[i.result] = FloatWord(a[1] * b[2] - b[1] * a[2]);
+            r[i.result + 1] = FloatWord(a[2] * b[0] - b[2] * a[0]);
+            r[i.result + 2] = FloatWord(a[0] * b[1] - b[0] * a[1]);
+            break;
+        }
+        case GLSLstd450Normalize: {
+            const float scale = 1.0f / sqrtf(FloatDot(&r[i.a], &r[i.a], i.count));
+            for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = FloatWord(AsFloat(r[i.a + k]) * scale);
+            break;
+        }
+        case GLSLstd450FaceForward: {
+            // a is N, b is I and c is Nref
+            const float sign = FloatDot(&r[i.c], &r[i.b], i.count) < 0.0f ? 1.0f : -1.0f;
+            for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = FloatWord(sign * AsFloat(r[i.a + k]));
+            break;
+        }
+        case GLSLstd450Reflect: {
+            // a is I and b is N
+            const float d = 2.0f * FloatDot(&r[i.b], &r[i.a], i.count);
+            for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = FloatWord(AsFloat(r[i.a + k]) - d * AsFloat(r[i.b + k]));
+            break;
+        }
+        case GLSLstd450Refract: {
+            // a is I, b is N and c is the scalar eta
+            const float eta = AsFloat(r[i.c]);
+            const float d = FloatDot(&r[i.b], &r[i.a], i.count);
+            const float k2 = 1.0f - eta * eta * (1.0f - d * d);
+            for (uint32_t k = 0; k < i.count; ++k) {
+                const float refracted = eta * AsFloat(r[i.a + k]) - (eta * d + sqrtf(k2)) * AsFloat(r[i.b + k]);
+                r[i.result + k] = FloatWord(k2 < 0.0f ? 0.0f : refracted);
+            }
+            break;
+        }
+        case GLSLstd450FindILsb:
+            ComponentWise(r, i, [](uint32_t x) { return x ? FindMsb(x & (0u - x)) : ~0u; });
+            break;
+        case GLSLstd450FindSMsb:
+            ComponentWise(r, i, [](uint32_t x) { return FindMsb(static_cast<int32_t>(x) < 0 ? ~x : x); });
+            break;
+        case GLSLstd450FindUMsb:
+            ComponentWise(r, i, [](uint32_t x) { return FindMsb(x); });
+            break;
+        default:
+            break;
+    }
+}
+
+// Executes the instructions that only compute values from registers, which are also the ones OpSpecConstantOp can use.
+// Returns false for any other instruction.
+static bool ExecuteValueInstruction(uint32_t *r, const uint32_t *data, const SpirvInstruction &i) {
+    switch (i.op) {
+        case SpvOpCopyObject:
+            memmove(&r[i.result], &r[i.a], i.count * sizeof(uint32_t));
+            return true;
+        case kComputeOpGather:
+            // kNoOperand words are undefined shuffle components
+            for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = data[i.data + k] != kNoOperand ? r[data[i.data + k]] : 0;
+            return true;
+        case SpvOpVectorExtractDynamic:
+            r[i.result] = r[i.b] < i.aux ? r[i.a + r[i.b]] : 0;
+            return true;
+        case SpvOpVectorInsertDynamic:
+            memcpy(&r[i.result], &r[i.a], i.count * sizeof(uint32_t));
+            if (r[i.c] < i.count) r[i.result + r[i.c]] = r[i.b];
+            return true;
+        case SpvOpSNegate:
+            ComponentWise(r, i, [](uint32_t x) { return 0u - x; });
+            return true;
+        case SpvOpFNegate:
+            FloatWise(r, i, [](float x) { return -x; });
+            return true;
+        case SpvOpIAdd:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x + y; });
+            return true;
+        case SpvOpFAdd:
+            FloatWise2(r, i, [](float x, float y) { return x + y; });
+            return true;
+        case SpvOpISub:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x - y; });
+            return true;
+        case SpvOpFSub:
+            FloatWise2(r, i, [](float x, float y) { return x - y; });
+            return true;
+        case SpvOpIMul:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x * y; });
+            return true;
+        case SpvOpFMul:
+            FloatWise2(r, i, [](float x, float y) { return x * y; });
+            return true;
+        // Integer division by zero is undefined, so it gives 0 rather than trap, as does the INT_MIN / -1 overflow
+        case SpvOpUDiv:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return y ? x / y : 0u; });
+            return true;
+        case SpvOpSDiv:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) {
+                if (!y || (x == 0x80000000u && y == ~0u)) return 0u;
+                return static_cast<uint32_t>(static_cast<int32_t>(x) / static_cast<int32_t>(y));
+            });
+            return true;
+        case SpvOpFDiv:
+            FloatWise2(r, i, [](float x, float y) { return x / y; });
+            return true;
+        case SpvOpUMod:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return y ? x % y : 0u; });
+            return true;
+        case SpvOpSRem:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) {
+                if (!y || y == ~0u) return 0u;
+                return static_cast<uint32_t>(static_cast<int32_t>(x) % static_cast<int32_t>(y));
+            });
+            return true;
+        case SpvOpSMod:
+            // The remainder takes the sign of the divisor
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) {
+                if (!y || y == ~0u) return 0u;
+                int32_t remainder = static_cast<int32_t>(x) % static_cast<int32_t>(y);
+                if (remainder && ((remainder < 0) != (static_cast<int32_t>(y) < 0))) remainder += static_cast<int32_t>(y);
+                return static_cast<uint32_t>(remainder);
+            });
+            return true;
+        case SpvOpFRem:
+            FloatWise2(r, i, [](float x, float y) { return fmodf(x, y); });
+            return true;
+        case SpvOpFMod:
+            FloatWise2(r, i, [](float x, float y) { return x - y * floorf(x / y); });
+            return true;
+        case SpvOpVectorTimesScalar:
+        case SpvOpMatrixTimesScalar: {
+            const float scalar = AsFloat(r[i.b]);
+            for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = FloatWord(AsFloat(r[i.a + k]) * scalar);
+            return true;
+        }
+        case SpvOpDot:
+            r[i.result] = FloatWord(FloatDot(&r[i.a], &r[i.b], i.aux));
+            return true;
+        case SpvOpMatrixTimesVector: {
+            // a has aux columns of count rows
+            float sum[4] = {};
+            for (uint32_t column = 0; column < i.aux; ++column) {
+                const float scalar = AsFloat(r[i.b + column]);
+                for (uint32_t row = 0; row < i.count; ++row) sum[row] += AsFloat(r[i.a + column * i.count + row]) * scalar;
+            }
+            for (uint32_t row = 0; row < i.count; ++row) r[i.result + row] = FloatWord(sum[row]);
+            return true;
+        }
+        case SpvOpVectorTimesMatrix:
+            // b has count columns of aux rows
+            for (uint32_t column = 0; column < i.count; ++column) {
+                r[i.result + column] = FloatWord(FloatDot(&r[i.a], &r[i.b + column * i.aux], i.aux));
+            }
+            return true;
+        case SpvOpMatrixTimesMatrix: {
+            // a has aux columns of data rows, and the result count / data columns of data rows
+            const uint32_t rows = i.data;
+            for (uint32_t column = 0; column < i.count / rows; ++column) {
+                for (uint32_t row = 0; row < rows; ++row) {
+                    float sum = 0.0f;
+                    for (uint32_t k = 0; k < i.aux; ++k) {
+                        sum += AsFloat(r[i.a + k * rows + row]) * AsFloat(r[i.b + column * i.aux + k]);
+                    }
+                    r[i.result + column * rows + row] = FloatWord(sum);
+                }
+            }
+            return true;
+        }
+        case SpvOpOuterProduct:
+            // a has aux components, the rows of the result
+            for (uint32_t column = 0; column < i.count / i.aux; ++column) {
+                for (uint32_t row = 0; row < i.aux; ++row) {
+                    r[i.result + column * i.aux + row] = FloatWord(AsFloat(r[i.a + row]) * AsFloat(r[i.b + column]));
+                }
+            }
+            return true;
+        case SpvOpTranspose: {
+            // a has aux columns of data rows
+            for (uint32_t column = 0; column < i.aux; ++column) {
+                for (uint32_t row = 0; row < i.data; ++row) r[i.result + row * i.aux + column] = r[i.a + column * i.data + row];
+            }
+            return true;
+        }
+        case SpvOpConvertFToU:
+            ComponentWise(r, i, [](uint32_t x) { return FloatToUint(AsFloat(x)); });
+            return true;
+        case SpvOpConvertFToS:
+            ComponentWise(r, i, [](uint32_t x) { return FloatToInt(AsFloat(x)); });
+            return true;
+        case SpvOpConvertSToF:
+            ComponentWise(r, i, [](uint32_t x) { return FloatWord(static_cast<float>(static_cast<int32_t>(x))); });
+            return true;
+        case SpvOpConvertUToF:
+            ComponentWise(r, i, [](uint32_t x) { return FloatWord(static_cast<float>(x)); });
+            return true;
+        case SpvOpQuantizeToF16:
+            FloatWise(r, i, [](float x) { return HalfToFloat(FloatToHalf(x)); });
+            return true;
+        case SpvOpAny:
+        case SpvOpAll: {
+            bool result = i.op == SpvOpAll;
+            for (uint32_t k = 0; k < i.aux; ++k) result = i.op == SpvOpAll ? result && r[i.a + k] : result || r[i.a + k];
+            r[i.result] = result ? 1 : 0;
+            return true;
+        }
+        case SpvOpIsNan:
+            ComponentWise(r, i, [](uint32_t x) { return AsFloat(x) != AsFloat(x) ? 1u : 0u; });
+            return true;
+        case SpvOpIsInf:
+            ComponentWise(r, i, [](uint32_t x) { return (x & 0x7FFFFFFFu) == 0x7F800000u ? 1u : 0u; });
+            return true;
+        case SpvOpLogicalEqual:
+        case SpvOpIEqual:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x == y ? 1u : 0u; });
+            return true;
+        case SpvOpLogicalNotEqual:
+        case SpvOpINotEqual:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x != y ? 1u : 0u; });
+            return true;
+        case SpvOpLogicalOr:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x | y; });
+            return true;
+        case SpvOpLogicalAnd:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x & y; });
+            return true;
+        case SpvOpLogicalNot:
+            ComponentWise(r, i, [](uint32_t x) { return x ^ 1u; });
+            return true;
+        case SpvOpSelect:
+            // aux is set when a scalar condition selects between vectors
+            for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = r[i.a + (i.aux ? 0 : k)] ? r[i.b + k] : r[i.c + k];
+            return true;
+        case SpvOpUGreaterThan:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x > y ? 1u : 0u; });
+            return true;
+        case SpvOpSGreaterThan:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return AsInt(x) > AsInt(y) ? 1u : 0u; });
+            return true;
+        case SpvOpUGreaterThanEqual:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x >= y ? 1u : 0u; });
+            return true;
+        case SpvOpSGreaterThanEqual:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return AsInt(x) >= AsInt(y) ? 1u : 0u; });
+            return true;
+        case SpvOpULessThan:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x < y ? 1u : 0u; });
+            return true;
+        case SpvOpSLessThan:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return AsInt(x) < AsInt(y) ? 1u : 0u; });
+            return true;
+        case SpvOpULessThanEqual:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x <= y ? 1u : 0u; });
+            return true;
+        case SpvOpSLessThanEqual:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return AsInt(x) <= AsInt(y) ? 1u : 0u; });
+            return true;
+        // Ordered comparisons are false and unordered ones true when either operand is NaN
+        case SpvOpFOrdEqual:
+            FloatCompare(r, i, [](float x, float y) { return x == y; });
+            return true;
+        case SpvOpFUnordEqual:
+            FloatCompare(r, i, [](float x, float y) { return !(x < y || x > y); });
+            return true;
+        case SpvOpFOrdNotEqual:
+            FloatCompare(r, i, [](float x, float y) { return x < y || x > y; });
+            return true;
+        case SpvOpFUnordNotEqual:
+            FloatCompare(r, i, [](float x, float y) { return x != y; });
+            return true;
+        case SpvOpFOrdLessThan:
+            FloatCompare(r, i, [](float x, float y) { return x < y; });
+            return true;
+        case SpvOpFUnordLessThan:
+            FloatCompare(r, i, [](float x, float y) { return !(x >= y); });
+            return true;
+        case SpvOpFOrdGreaterThan:
+            FloatCompare(r, i, [](float x, float y) { return x > y; });
+            return true;
+        case SpvOpFUnordGreaterThan:
+            FloatCompare(r, i, [](float x, float y) { return !(x <= y); });
+            return true;
+        case SpvOpFOrdLessThanEqual:
+            FloatCompare(r, i, [](float x, float y) { return x <= y; });
+            return true;
+        case SpvOpFUnordLessThanEqual:
+            FloatCompare(r, i, [](float x, float y) { return !(x > y); });
+            return true;
+        case SpvOpFOrdGreaterThanEqual:
+            FloatCompare(r, i, [](float x, float y) { return x >= y; });
+            return true;
+        case SpvOpFUnordGreaterThanEqual:
+            FloatCompare(r, i, [](float x, float y) { return !(x < y); });
+            return true;
+        // Shifts by 32 or more are undefined, so they shift by the low 5 bits like the hardware does
+        case SpvOpShiftRightLogical:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x >> (y & 31); });
+            return true;
+        case SpvOpShiftRightArithmetic:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return static_cast<uint32_t>(static_cast<int32_t>(x) >> (y & 31)); });
+            return true;
+        case SpvOpShiftLeftLogical:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x << (y & 31); });
+            return true;
+        case SpvOpBitwiseOr:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x | y; });
+            return true;
+        case SpvOpBitwiseXor:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x ^ y; });
+            return true;
+        case SpvOpBitwiseAnd:
+            ComponentWise2(r, i, [](uint32_t x, uint32_t y) { return x & y; });
+            return true;
+        case SpvOpNot:
+            ComponentWise(r, i, [](uint32_t x) { return ~x; });
+            return true;
+        case SpvOpBitFieldInsert: {
+            // c is the offset and data the count, both scalars
+            const uint32_t offset = r[i.c] & 31;
+            const uint32_t mask = BitFieldMask(r[i.data]) << offset;
+            for (uint32_t k = 0; k < i.count; ++k) r[i.result + k] = (r[i.a + k] & ~mask) | ((r[i.b + k] << offset) & mask);
+            return true;
+        }
+        case SpvOpBitFieldSExtract:
+        case SpvOpBitFieldUExtract: {
+            // b is the offset and c the count, both scalars
+            const uint32_t offset = r[i.b] & 31;
+            const uint32_t count = r[i.c];
+            for (uint32_t k = 0; k < i.count; ++k) {
+                uint32_t value = (r[i.a + k] >> offset) & BitFieldMask(count);
+                const bool sign_extend = i.op == SpvOpBitFieldSExtract && count && count < 32;
+                if (sign_extend && (value >> (count - 1)) & 1) value |= ~BitFieldMask(count);
+                r[i.result + k] = count ? value : 0;
+            }
+            return true;
+        }
+        case SpvOpBitReverse:
+            ComponentWise(r, i, [](uint32_t x) { return BitReverse(x); });
+            return true;
+        case SpvOpBitCount:
+            ComponentWise(r, i, [](uint32_t x) { return BitCount(x); });
+            return true;
+        case SpvOpExtInst:
+            ExecuteGlsl(r, i);
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Translates SPIR-V into a ComputeProgram. Anything the interpreter doesn't support fails the whole translation, so a
+// program either runs the shader as written or doesn't exist.
+class SpirvCompiler {
+  public:
+    SpirvCompiler(const uint32_t *code, size_t word_count, const char *entry_point, const VkSpecializationInfo *specialization)
+        : code_(code), word_count_(word_count), entry_point_(entry_point ? entry_point : "main"), specialization_(specialization) {}
+
+    std::shared_ptr<ComputeProgram> Compile(std::string *error) {
+        program_ = std::make_shared<ComputeProgram>();
+        if (!Parse()) {
+            *error = error_;
+            return nullptr;
+        }
+        return program_;
+    }
+
+  private:
+    struct Type {
+        uint32_t op = 0;  // The OpType* declaring it, or 0 for ids that aren't types
+        uint32_t element = 0;  // Component type of vectors, column type of matrices, element type of arrays, pointee of pointers
+        uint32_t length = 0;  // Components of vectors, columns of matrices, elements of arrays
+        uint32_t storage_class = 0;  // Pointers
+        uint32_t dim = 0;  // Images
+        uint32_t arrayed = 0;
+        uint32_t words = 0;  // Size of a value in registers
+        std::vector<uint32_t> members;  // Structs
+    };
+
+    struct Decoration {
+        uint32_t member;  // kNoOperand for decorations of the id itself
+        uint32_t decoration;
+        uint32_t value;
+    };
+
+    // How a type is laid out in memory: offsets for the explicit layouts of buffers and push constants, which come from
+    // decorations, or the tightly packed layout the interpreter gives other memory
+    struct Layout {
+        uint32_t type = 0;
+        uint32_t size = 0;  // Bytes, 0 for runtime arrays and structs ending with one
+        uint32_t stride = 0;  // Between array elements, vector components or matrix columns
+        bool descriptor_array = false;  // An array of descriptors, indexed by resource element rather than offset
+        std::vector<uint32_t> offsets;  // Structs: member offsets
+        std::vector<uint32_t> children;  // Structs: the layout of each member. Others: of their element.
+        uint32_t plan = kNoOperand;  // Where the segments to load and store it with start in data, once it has some
+    };
+
+    // A branch to a block, resolved once every block has an address. The target's phis become copies done by the branch.
+    struct Edge {
+        uint32_t data;  // Where the target's address and phi copies go
+        uint32_t from_label;
+        uint32_t to_label;
+    };
+
+    struct PendingCall {
+        uint32_t instruction;
+        uint32_t function;
+    };
+
+    struct Phi {
+        uint32_t result;
+        uint32_t words;
+        std::vector<std::pair<uint32_t, uint32_t>> incoming;  // (value id, parent label)
+    };
+
+    bool Fail(const std::string &message) {
+        if (error_.empty()) error_ = message;
+        return false;
+    }
+
+    bool Unsupported(const char *what, uint32_t value) { return Fail(std::string(what) + " " + std::to_string(value)); }
+
+    std::string ReadString(const uint32_t *words, uint32_t count, uint32_t *word_length) const {
+        std::string text;
+        for (uint32_t i = 0; i < count; ++i) {
+            for (uint32_t b = 0; b < 4; ++b) {
+                const char c = static_cast<char>((words[i] >> (8 * b)) & 0xFF);
+                if (!c) {
+                    *word_length = i + 1;
+                    return text;
+                }
+                text += c;
+            }
+        }
+        *word_length = count;
+        return text;
+    }
+
+    bool HasDecoration(uint32_t id, uint32_t decoration, uint32_t *value = nullptr, uint32_t member = kNoOperand) const {
+        auto found = decorations_.find(id);
+        if (found == decorations_.end()) return false;
+        for (const auto &entry : found->second) {
+            if (entry.decoration == decoration && entry.member == member) {
+                if (value) *value = entry.value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t AllocateRegisters(uint32_t id, uint32_t words) {
+        if (id >= registers_.size()) return 0;
+        registers_[id] = static_cast<uint32_t>(program_->registers.size());
+        program_->registers.resize(program_->registers.size() + words, 0);
+        return registers_[id];
+    }
+
+    uint32_t Reg(uint32_t id) const { return id < registers_.size() ? registers_[id] : 0; }
+
+    uint32_t Words(uint32_t type) const { return type < types_.size() ? types_[type].words : 0; }
+
+    bool IsType(uint32_t id, uint32_t op) const { return id < types_.size() && types_[id].op == op; }
+
+    // The scalar type of scalars and vectors
+    uint32_t ScalarType(uint32_t type) const { return IsType(type, SpvOpTypeVector) ? types_[type].element : type; }
+
+    bool IsIntegerOrBool(uint32_t type) const {
+        const uint32_t scalar = ScalarType(type);
+        return IsType(scalar, SpvOpTypeInt) || IsType(scalar, SpvOpTypeBool);
+    }
+
+    uint32_t Emit(uint32_t op, uint32_t result, uint32_t a, uint32_t b, uint32_t c, uint32_t count, uint32_t aux = 0,
+                  uint32_t data = 0) {
+        SpirvInstruction instruction = {op, result, a, b, c, count, aux, data};
+        code_out_->push_back(instruction);
+        return static_cast<uint32_t>(code_out_->size() - 1);
+    }
+
+    uint32_t DataSize() const { return static_cast<uint32_t>(program_->data.size()); }
+
+    // Constant values, for literal indices and array lengths. Specialization constants have their values by then.
+    bool ConstantValue(uint32_t id, uint32_t *value) const {
+        if (id >= constant_known_.size() || !constant_known_[id]) return false;
+        *value = program_->registers[registers_[id]];
+        return true;
+    }
+
+    bool Parse() {
+        if (word_count_ < 5 || code_[0] != kSpirvMagic) return Fail("not a SPIR-V module");
+        const uint32_t bound = code_[3];
+        if (bound > (1u << 22)) return Fail("too many ids");
+        types_.resize(bound);
+        registers_.assign(bound, 0);
+        constant_known_.assign(bound, false);
+        pointer_layouts_.assign(bound, kNoOperand);
+        labels_.assign(bound, kNoOperand);
+        function_entries_.assign(bound, kNoOperand);
+        AllocateRegisters(0, 1);  // Register 0 is a scratch zero for absent operands
+
+        // Decorations, entry points and execution modes come before anything they apply to, so gather them first
+        uint32_t entry_function = kNoOperand;
+        std::vector<uint32_t> local_size_ids;
+        for (size_t offset = 5; offset < word_count_;) {
+            const uint32_t length = code_[offset] >> 16;
+            const uint32_t opcode = code_[offset] & 0xFFFF;
+            if (!length || offset + length > word_count_) return Fail("truncated instruction");
+            const uint32_t *operands = code_ + offset + 1;
+            switch (opcode) {
+                case SpvOpEntryPoint: {
+                    uint32_t name_length = 0;
+                    const std::string name = ReadString(operands + 2, length - 3, &name_length);
+                    if (operands[0] == kSpvExecutionModelGLCompute && name == entry_point_) entry_function = operands[1];
+                    break;
+                }
+                case SpvOpExecutionMode:
+                case SpvOpExecutionModeId:
+                    execution_modes_.push_back(std::vector<uint32_t>(operands, operands + length - 1));
+                    break;
+                case SpvOpDecorate:
+                case SpvOpDecorateId:
+                    decorations_[operands[0]].push_back({kNoOperand, operands[1], length > 3 ? operands[2] : 0});
+                    break;
+                case SpvOpMemberDecorate:
+                    decorations_[operands[0]].push_back({operands[1], operands[2], length > 4 ? operands[3] : 0});
+                    break;
+                case SpvOpGroupDecorate:
+                    for (uint32_t i = 1; i + 1 < length; ++i) {
+                        const auto group = decorations_[operands[0]];
+                        auto &target = decorations_[operands[i]];
+                        target.insert(target.end(), group.begin(), group.end());
+                    }
+                    break;
+                case SpvOpGroupMemberDecorate:
+                    for (uint32_t i = 1; i + 2 < length; i += 2) {
+                        for (auto decoration : decorations_[operands[0]]) {
+                            decoration.member = operands[i + 1];
+                            decorations_[operands[i]].push_back(decoration);
+                        }
+                    }
+                    break;
+                case SpvOpExtInstImport: {
+                    uint32_t name_length = 0;
+                    if (ReadString(operands + 1, length - 2, &name_length) == "GLSL.std.450") glsl_import_ = operands[0];
+                    break;
+                }
+                default:
+                    break;
+            }
+            offset += length;
+        }
+        if (entry_function == kNoOperand) return Fail("no GLCompute entry point named " + entry_point_);
+
+        code_out_ = &program_->code;
+        for (size_t offset = 5; offset < word_count_;) {
+            const uint32_t length = code_[offset] >> 16;
+            const uint32_t opcode = code_[offset] & 0xFFFF;
+            if (!ParseInstruction(opcode, code_ + offset + 1, length - 1)) return false;
+            offset += length;
+        }
+        if (in_function_) return Fail("unterminated function");
+
+        // Local size, from the execution mode, or from a WorkgroupSize constant, which takes precedence
+        for (const auto &mode : execution_modes_) {
+            if (mode.size() < 5 || mode[0] != entry_function) continue;
+            for (uint32_t i = 0; i < 3; ++i) {
+                if (mode[1] == kSpvExecutionModeLocalSize) {
+                    program_->local_size[i] = mode[2 + i];
+                } else if (mode[1] == kSpvExecutionModeLocalSizeId) {
+                    program_->local_size[i] = program_->registers[Reg(mode[2 + i])];
+                }
+            }
+        }
+        if (workgroup_size_id_) {
+            for (uint32_t i = 0; i < 3; ++i) program_->local_size[i] = program_->registers[Reg(workgroup_size_id_) + i];
+        }
+        const uint64_t invocations = uint64_t(program_->local_size[0]) * program_->local_size[1] * program_->local_size[2];
+        if (!invocations || invocations > 4096) return Fail("unsupported workgroup size");
+
+        return ResolveBranches() && ResolveCalls(entry_function);
+    }
+
+    bool ParseInstruction(uint32_t opcode, const uint32_t *operands, uint32_t count) {
+        switch (opcode) {
+            case SpvOpNop:
+            case SpvOpSourceContinued:
+            case SpvOpSource:
+            case SpvOpSourceExtension:
+            case SpvOpName:
+            case SpvOpMemberName:
+            case SpvOpString:
+            case SpvOpLine:
+            case SpvOpNoLine:
+            case SpvOpExtension:
+            case SpvOpExtInstImport:
+            case SpvOpMemoryModel:
+            case SpvOpEntryPoint:
+            case SpvOpExecutionMode:
+            case SpvOpExecutionModeId:
+            case SpvOpCapability:
+            case SpvOpDecorate:
+            case SpvOpDecorateId:
+            case SpvOpDecorateString:
+            case SpvOpMemberDecorate:
+            case SpvOpMemberDecorateString:
+            case SpvOpDecorationGroup:
+            case SpvOpGroupDecorate:
+            case SpvOpGroupMemberDecorate:
+            case SpvOpModuleProcessed:
+            case SpvOpSelectionMerge:
+            case SpvOpLoopMerge:
+            case SpvOpLifetimeStart:
+            case SpvOpLifetimeStop:
+                return true;
+            case SpvOpTypeVoid:
+            case SpvOpTypeBool:
+            case SpvOpTypeInt:
+            case SpvOpTypeFloat:
+            case SpvOpTypeVector:
+            case SpvOpTypeMatrix:
+            case SpvOpTypeImage:
+            case SpvOpTypeSampler:
+            case SpvOpTypeSampledImage:
+            case SpvOpTypeArray:
+            case SpvOpTypeRuntimeArray:
+            case SpvOpTypeStruct:
+            case SpvOpTypePointer:
+            case SpvOpTypeFunction:
+                return ParseType(opcode, operands, count);
+            case SpvOpConstantTrue:
+            case SpvOpConstantFalse:
+            case SpvOpConstant:
+            case SpvOpConstantComposite:
+            case SpvOpConstantNull:
+            case SpvOpSpecConstantTrue:
+            case SpvOpSpecConstantFalse:
+            case SpvOpSpecConstant:
+            case SpvOpSpecConstantComposite:
+            case SpvOpSpecConstantOp:
+                return ParseConstant(opcode, operands, count);
+            case SpvOpUndef:
+                if (count < 2) return Fail("bad OpUndef");
+                AllocateRegisters(operands[1], Words(operands[0]));
+                value_types_[operands[1]] = operands[0];
+                return true;
+            case SpvOpVariable:
+                return ParseVariable(operands, count);
+            case SpvOpFunction:
+                if (in_function_ || count < 4) return Fail("bad OpFunction");
+                in_function_ = true;
+                function_ = operands[1];
+                function_entries_[function_] = static_cast<uint32_t>(program_->code.size());
+                AllocateRegisters(operands[1], Words(operands[0]));
+                return true;
+            case SpvOpFunctionParameter:
+                if (!in_function_ || count < 2) return Fail("bad OpFunctionParameter");
+                AllocateRegisters(operands[1], Words(operands[0]));
+                value_types_[operands[1]] = operands[0];
+                function_parameters_[function_].push_back(operands[1]);
+                if (IsType(operands[0], SpvOpTypePointer)) {
+                    const Type &pointer = types_[operands[0]];
+                    pointer_layouts_[operands[1]] = GetLayout(pointer.element, IsExplicitLayout(pointer.storage_class), 0, false);
+                    if (pointer_layouts_[operands[1]] == kNoOperand) return false;
+                }
+                return true;
+            case SpvOpFunctionEnd:
+                if (!in_function_) return Fail("bad OpFunctionEnd");
+                in_function_ = false;
+                return true;
+            case SpvOpLabel:
+                if (!in_function_ || count < 1) return Fail("bad OpLabel");
+                labels_[operands[0]] = static_cast<uint32_t>(program_->code.size());
+                label_ = operands[0];
+                return true;
+            case SpvOpPhi: {
+                if (count < 2) return Fail("bad OpPhi");
+                if (IsType(operands[0], SpvOpTypePointer)) return Fail("unsupported variable pointers");
+                Phi phi;
+                phi.result = AllocateRegisters(operands[1], Words(operands[0]));
+                phi.words = Words(operands[0]);
+                value_types_[operands[1]] = operands[0];
+                for (uint32_t i = 2; i + 1 < count; i += 2) phi.incoming.push_back(std::make_pair(operands[i], operands[i + 1]));
+                phis_[label_].push_back(phi);
+                return true;
+            }
+            default:
+                if (!in_function_) return Unsupported("unsupported global instruction", opcode);
+                return CompileInstruction(opcode, operands, count);
+        }
+    }
+
+    bool ParseType(uint32_t opcode, const uint32_t *operands, uint32_t count) {
+        if (!count || operands[0] >= types_.size()) return Fail("bad type");
+        Type &type = types_[operands[0]];
+        type.op = opcode;
+        switch (opcode) {
+            case SpvOpTypeVoid:
+            case SpvOpTypeFunction:
+                type.words = 0;
+                break;
+            case SpvOpTypeBool:
+            case SpvOpTypeImage:
+            case SpvOpTypeSampler:
+                type.words = 1;
+                if (opcode == SpvOpTypeImage) {
+                    if (count < 8) return Fail("bad OpTypeImage");
+                    type.element = operands[1];
+                    type.dim = operands[2];
+                    type.arrayed = operands[4];
+                    if (operands[5]) return Fail("unsupported multisampled image");
+                }
+                break;
+            case SpvOpTypeInt:
+            case SpvOpTypeFloat:
+                if (count < 2 || operands[1] != 32) return Unsupported("unsupported scalar width", count < 2 ? 0 : operands[1]);
+                type.words = 1;
+                break;
+            case SpvOpTypeSampledImage:
+                // The image's region and the sampler's, which are the same for combined image samplers
+                type.element = operands[1];
+                type.words = 2;
+                break;
+            case SpvOpTypeVector:
+            case SpvOpTypeMatrix:
+                if (count < 3 || operands[2] > 4) return Fail("bad vector or matrix");
+                type.element = operands[1];
+                type.length = operands[2];
+                type.words = type.length * Words(type.element);
+                break;
+            case SpvOpTypeArray:
+                if (count < 3 || !ConstantValue(operands[2], &type.length)) return Fail("bad array length");
+                type.element = operands[1];
+                type.words = type.length * Words(type.element);
+                break;
+            case SpvOpTypeRuntimeArray:
+                type.element = operands[1];
+                type.words = 0;
+                break;
+            case SpvOpTypeStruct:
+                type.members.assign(operands + 1, operands + count);
+                type.words = 0;
+                for (uint32_t member : type.members) type.words += Words(member);
+                break;
+            case SpvOpTypePointer:
+                if (count < 3) return Fail("bad pointer");
+                type.storage_class = operands[1];
+                type.element = operands[2];
+                type.words = 2;
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
+    // Reads the value a specialization constant is given, if it's given one
+    bool SpecializedValue(uint32_t id, uint32_t *value) const {
+        uint32_t spec_id = 0;
+        if (!specialization_ || !HasDecoration(id, SpvDecorationSpecId, &spec_id)) return false;
+        for (uint32_t i = 0; i < specialization_->mapEntryCount; ++i) {
+            const VkSpecializationMapEntry &entry = specialization_->pMapEntries[i];
+            if (entry.constantID != spec_id || entry.offset + entry.size > specialization_->dataSize) continue;
+            uint32_t word = 0;
+            const uint8_t *data = static_cast<const uint8_t *>(specialization_->pData);
+            memcpy(&word, data + entry.offset, (std::min)(entry.size, sizeof(word)));
+            *value = word;
+            return true;
+        }
+        return false;
+    }
+
+    bool ParseConstant(uint32_t opcode, const uint32_t *operands, uint32_t count) {
+        if (count < 2 || operands[1] >= registers_.size()) return Fail("bad constant");
+        const uint32_t type = operands[0];
+        const uint32_t id = operands[1];
+        const uint32_t words = Words(type);
+        const uint32_t reg = AllocateRegisters(id, words);
+        uint32_t *value = program_->registers.data() + reg;
+        switch (opcode) {
+            case SpvOpConstantTrue:
+            case SpvOpConstantFalse:
+                *value = opcode == SpvOpConstantTrue ? 1 : 0;
+                break;
+            case SpvOpSpecConstantTrue:
+            case SpvOpSpecConstantFalse: {
+                uint32_t specialized = opcode == SpvOpSpecConstantTrue ? 1 : 0;
+                SpecializedValue(id, &specialized);
+                *value = specialized ? 1 : 0;
+                break;
+            }
+            case SpvOpConstant:
+            case SpvOpSpecConstant:
+                if (count < 3) return Fail("bad constant");
+                *value = operands[2];
+                if (opcode == SpvOpSpecConstant) SpecializedValue(id, value);
+                break;
+            case SpvOpConstantComposite:
+            case SpvOpSpecConstantComposite: {
+                uint32_t offset = 0;
+                for (uint32_t i = 2; i < count; ++i) {
+                    // Constituents are earlier constants, so their registers already hold their values
+                    const uint32_t part_words = (std::min)(WordsOfId(operands[i]), words - offset);
+                    memcpy(program_->registers.data() + reg + offset, program_->registers.data() + Reg(operands[i]),
+                           part_words * sizeof(uint32_t));
+                    offset += part_words;
+                }
+                break;
+            }
+            case SpvOpConstantNull:
+                break;
+            case SpvOpSpecConstantOp: {
+                if (count < 3) return Fail("bad OpSpecConstantOp");
+                // Compiled like the instruction it names and run at once, since its operands are all constants already
+                std::vector<uint32_t> instruction(operands, operands + count);
+                instruction.erase(instruction.begin() + 2);
+                std::vector<SpirvInstruction> code;
+                std::vector<SpirvInstruction> *saved = code_out_;
+                code_out_ = &code;
+                const bool compiled = CompileInstruction(operands[2], instruction.data(), count - 1);
+                code_out_ = saved;
+                if (!compiled) return false;
+                for (const auto &compiled_instruction : code) {
+                    if (!ExecuteValueInstruction(program_->registers.data(), program_->data.data(), compiled_instruction)) {
+                        return Unsupported("unsupported OpSpecConstantOp", operands[2]);
+                    }
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        uint32_t builtin = 0;
+        if (HasDecoration(id, SpvDecorationBuiltIn, &builtin) && builtin == SpvBuiltInWorkgroupSize) workgroup_size_id_ = id;
+        value_types_[id] = type;
+        constant_known_[id] = true;
+        return true;
+    }
+
+    uint32_t WordsOfId(uint32_t id) const {
+        auto found = value_types_.find(id);
+        return found != value_types_.end() ? Words(found->second) : 0;
+    }
+
+    static bool IsExplicitLayout(uint32_t storage_class) {
+        return storage_class == SpvStorageClassUniform || storage_class == SpvStorageClassStorageBuffer ||
+               storage_class == SpvStorageClassPushConstant;
+    }
+
+    // Builds the layout of a type, explicit for buffers and push constants. matrix_stride and row_major come from the
+    // member decorations of the struct holding a matrix, or an array of them.
+    uint32_t GetLayout(uint32_t type_id, bool explicit_layout, uint32_t matrix_stride, bool row_major) {
+        if (type_id >= types_.size()) {
+            Fail("bad type");
+            return kNoOperand;
+        }
+        const uint64_t key =
+            uint64_t(type_id) << 32 | (explicit_layout ? 1u << 31 : 0) | (row_major ? 1u << 30 : 0) | matrix_stride;
+        auto cached = layout_cache_.find(key);
+        if (cached != layout_cache_.end()) return cached->second;
+
+        const Type &type = types_[type_id];
+        Layout layout;
+        layout.type = type_id;
+        switch (type.op) {
+            case SpvOpTypeBool:
+            case SpvOpTypeInt:
+            case SpvOpTypeFloat:
+                layout.size = 4;
+                break;
+            case SpvOpTypeImage:
+            case SpvOpTypeSampler:
+            case SpvOpTypeSampledImage:
+                break;
+            case SpvOpTypeVector: {
+                const uint32_t child = GetLayout(type.element, explicit_layout, 0, false);
+                if (child == kNoOperand) return kNoOperand;
+                layout.children.push_back(child);
+                layout.stride = 4;
+                layout.size = 4 * type.length;
+                break;
+            }
+            case SpvOpTypeMatrix: {
+                // A column of a row-major matrix has its components a matrix stride apart
+                const uint32_t rows = types_[type.element].length;
+                const uint32_t stride = explicit_layout && matrix_stride ? matrix_stride : 4 * rows;
+                Layout column;
+                column.type = type.element;
+                column.stride = row_major ? stride : 4;
+                column.size = row_major ? stride * (rows - 1) + 4 : 4 * rows;
+                const uint32_t scalar = GetLayout(types_[type.element].element, explicit_layout, 0, false);
+                if (scalar == kNoOperand) return kNoOperand;
+                column.children.push_back(scalar);
+                layouts_.push_back(column);
+                layout.children.push_back(static_cast<uint32_t>(layouts_.size() - 1));
+                layout.stride = row_major ? 4 : stride;
+                layout.size = row_major ? stride * rows : stride * type.length;
+                break;
+            }
+            case SpvOpTypeArray:
+            case SpvOpTypeRuntimeArray: {
+                const uint32_t child = GetLayout(type.element, explicit_layout, matrix_stride, row_major);
+                if (child == kNoOperand) return kNoOperand;
+                layout.children.push_back(child);
+                uint32_t stride = 0;
+                layout.stride = explicit_layout && HasDecoration(type_id, SpvDecorationArrayStride, &stride) ? stride
+                                                                                                             : layouts_[child].size;
+                layout.size = type.op == SpvOpTypeArray ? layout.stride * type.length : 0;
+                break;
+            }
+            case SpvOpTypeStruct: {
+                uint32_t offset = 0;
+                for (uint32_t m = 0; m < type.members.size(); ++m) {
+                    uint32_t member_stride = 0;
+                    HasDecoration(type_id, SpvDecorationMatrixStride, &member_stride, m);
+                    const bool member_row_major = HasDecoration(type_id, SpvDecorationRowMajor, nullptr, m);
+                    const uint32_t child = GetLayout(type.members[m], explicit_layout, member_stride, member_row_major);
+                    if (child == kNoOperand) return kNoOperand;
+                    uint32_t member_offset = offset;
+                    if (explicit_layout) HasDecoration(type_id, SpvDecorationOffset, &member_offset, m);
+                    layout.children.push_back(child);
+                    layout.offsets.push_back(member_offset);
+                    offset = member_offset + layouts_[child].size;
+                    layout.size = (std::max)(layout.size, offset);
+                }
+                break;
+            }
+            default:
+                Unsupported("unsupported type in memory", type.op);
+                return kNoOperand;
+        }
+        layouts_.push_back(layout);
+        const uint32_t index = static_cast<uint32_t>(layouts_.size() - 1);
+        layout_cache_[key] = index;
+        return index;
+    }
+
+    // Appends (memory offset, register offset, words) segments for every scalar of a layout, merging contiguous ones
+    void FlattenLayout(uint32_t layout_index, uint32_t memory_offset, uint32_t register_offset,
+                       std::vector<uint32_t> *segments) const {
+        const Layout &layout = layouts_[layout_index];
+        const Type &type = types_[layout.type];
+        switch (type.op) {
+            case SpvOpTypeBool:
+            case SpvOpTypeInt:
+            case SpvOpTypeFloat: {
+                const size_t n = segments->size();
+                if (n >= 3 && (*segments)[n - 3] + 4 * (*segments)[n - 1] == memory_offset &&
+                    (*segments)[n - 2] + (*segments)[n - 1] == register_offset) {
+                    ++(*segments)[n - 1];
+                } else {
+                    segments->push_back(memory_offset);
+                    segments->push_back(register_offset);
+                    segments->push_back(1);
+                }
+                break;
+            }
+            case SpvOpTypeVector:
+            case SpvOpTypeMatrix:
+            case SpvOpTypeArray: {
+                const uint32_t element_words = Words(type.element);
+                for (uint32_t i = 0; i < type.length; ++i) {
+                    FlattenLayout(layout.children[0], memory_offset + i * layout.stride, register_offset + i * element_words,
+                                  segments);
+                }
+                break;
+            }
+            case SpvOpTypeStruct: {
+                uint32_t member_register = register_offset;
+                for (uint32_t m = 0; m < type.members.size(); ++m) {
+                    FlattenLayout(layout.children[m], memory_offset + layout.offsets[m], member_register, segments);
+                    member_register += Words(type.members[m]);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // The segments loads and stores of a layout copy, as a count followed by the segments
+    uint32_t GetPlan(uint32_t layout_index) {
+        if (layouts_[layout_index].plan != kNoOperand) return layouts_[layout_index].plan;
+        std::vector<uint32_t> segments;
+        FlattenLayout(layout_index, 0, 0, &segments);
+        const uint32_t plan = DataSize();
+        program_->data.push_back(static_cast<uint32_t>(segments.size() / 3));
+        program_->data.insert(program_->data.end(), segments.begin(), segments.end());
+        layouts_[layout_index].plan = plan;
+        return plan;
+    }
+
+    bool ParseVariable(const uint32_t *operands, uint32_t count) {
+        if (count < 3 || !IsType(operands[0], SpvOpTypePointer)) return Fail("bad OpVariable");
+        const uint32_t id = operands[1];
+        const uint32_t storage_class = operands[2];
+        const uint32_t pointee = types_[operands[0]].element;
+        const uint32_t initializer = count > 3 ? operands[3] : 0;
+        const uint32_t reg = AllocateRegisters(id, 2);
+        uint32_t region = kNullRegion;
+        uint32_t offset = 0;
+        uint32_t layout = kNoOperand;
+        switch (storage_class) {
+            case SpvStorageClassUniform:
+            case SpvStorageClassStorageBuffer:
+            case SpvStorageClassUniformConstant: {
+                uint32_t set = 0;
+                uint32_t binding = 0;
+                HasDecoration(id, SpvDecorationDescriptorSet, &set);
+                HasDecoration(id, SpvDecorationBinding, &binding);
+                const Type &type = types_[pointee];
+                const bool is_array = type.op == SpvOpTypeArray || type.op == SpvOpTypeRuntimeArray;
+                const uint32_t element = is_array ? type.element : pointee;
+                if (program_->resources.size() >= (1u << (32 - kResourceElementBits)) - 1) return Fail("too many resources");
+                region = kFirstResourceRegion + (static_cast<uint32_t>(program_->resources.size()) << kResourceElementBits);
+                program_->resources.push_back({set, binding, type.op == SpvOpTypeArray ? type.length : (is_array ? 0u : 1u)});
+                layout = GetLayout(element, storage_class != SpvStorageClassUniformConstant, 0, false);
+                if (layout == kNoOperand) return false;
+                if (is_array) {
+                    Layout descriptors;
+                    descriptors.type = pointee;
+                    descriptors.descriptor_array = true;
+                    descriptors.children.push_back(layout);
+                    layouts_.push_back(descriptors);
+                    layout = static_cast<uint32_t>(layouts_.size() - 1);
+                }
+                break;
+            }
+            case SpvStorageClassPushConstant:
+                region = kPushConstantRegion;
+                layout = GetLayout(pointee, true, 0, false);
+                break;
+            case SpvStorageClassWorkgroup:
+                region = kWorkgroupRegion;
+                layout = GetLayout(pointee, false, 0, false);
+                if (layout == kNoOperand) return false;
+                offset = program_->workgroup_memory_size;
+                program_->workgroup_memory_size += (layouts_[layout].size + 15) & ~15u;
+                break;
+            case SpvStorageClassPrivate:
+            case SpvStorageClassFunction:
+            case SpvStorageClassInput: {
+                region = kInvocationRegion;
+                layout = GetLayout(pointee, false, 0, false);
+                if (layout == kNoOperand) return false;
+                offset = static_cast<uint32_t>(program_->invocation_memory.size());
+                program_->invocation_memory.resize(offset + ((layouts_[layout].size + 15) & ~15u), 0);
+                if (storage_class == SpvStorageClassInput) {
+                    uint32_t builtin = 0;
+                    if (!HasDecoration(id, SpvDecorationBuiltIn, &builtin)) return Fail("unsupported Input variable");
+                    if (builtin < SpvBuiltInNumWorkgroups || builtin > SpvBuiltInLocalInvocationIndex) {
+                        return Unsupported("unsupported BuiltIn", builtin);
+                    }
+                    program_->builtins.push_back({builtin, offset});
+                }
+                break;
+            }
+            default:
+                return Unsupported("unsupported storage class", storage_class);
+        }
+        if (layout == kNoOperand) return false;
+        program_->registers[reg] = region;
+        program_->registers[reg + 1] = offset;
+        pointer_layouts_[id] = layout;
+        if (initializer) {
+            if (storage_class == SpvStorageClassPrivate) {
+                // Initializers are constants, written into the memory every invocation starts with
+                const uint32_t plan = GetPlan(layout);
+                const uint32_t *value = program_->registers.data() + Reg(initializer);
+                for (uint32_t s = 0; s < program_->data[plan]; ++s) {
+                    const uint32_t *segment = &program_->data[plan + 1 + 3 * s];
+                    memcpy(&program_->invocation_memory[offset + segment[0]], value + segment[1], segment[2] * sizeof(uint32_t));
+                }
+            } else if (storage_class == SpvStorageClassFunction) {
+                Emit(SpvOpStore, 0, reg, Reg(initializer), 0, 0, 0, GetPlan(layout));
+            }
+        }
+        return true;
+    }
+
+    bool CompileAccessChain(const uint32_t *operands, uint32_t count) {
+        const uint32_t result = operands[1];
+        const uint32_t base = operands[2];
+        if (base >= pointer_layouts_.size() || pointer_layouts_[base] == kNoOperand) return Fail("bad access chain base");
+        uint32_t layout = pointer_layouts_[base];
+        uint32_t constant_offset = 0;
+        uint32_t region_register = kNoOperand;
+        uint32_t region_constant = 0;
+        std::vector<uint32_t> dynamic;
+        for (uint32_t i = 3; i < count; ++i) {
+            const Layout &current = layouts_[layout];
+            const Type &type = types_[current.type];
+            uint32_t index = 0;
+            const bool constant = ConstantValue(operands[i], &index);
+            if (current.descriptor_array) {
+                if (constant) {
+                    region_constant = index;
+                } else {
+                    region_register = Reg(operands[i]);
+                }
+                layout = current.children[0];
+            } else if (type.op == SpvOpTypeStruct) {
+                if (!constant || index >= current.offsets.size()) return Fail("bad struct index");
+                constant_offset += current.offsets[index];
+                layout = current.children[index];
+            } else if (type.op == SpvOpTypeVector || type.op == SpvOpTypeMatrix || type.op == SpvOpTypeArray ||
+                       type.op == SpvOpTypeRuntimeArray) {
+                if (constant) {
+                    constant_offset += index * current.stride;
+                } else {
+                    dynamic.push_back(Reg(operands[i]));
+                    dynamic.push_back(current.stride);
+                }
+                layout = current.children[0];
+            } else {
+                return Fail("bad access chain index");
+            }
+        }
+        const uint32_t data = DataSize();
+        program_->data.push_back(constant_offset);
+        program_->data.push_back(region_register);
+        program_->data.push_back(region_constant);
+        program_->data.push_back(static_cast<uint32_t>(dynamic.size() / 2));
+        program_->data.insert(program_->data.end(), dynamic.begin(), dynamic.end());
+        Emit(SpvOpAccessChain, AllocateRegisters(result, 2), Reg(base), 0, 0, 2, 0, data);
+        pointer_layouts_[result] = layout;
+        return true;
+    }
+
+    // Records a branch to label, whose address and phi copies are filled in by ResolveBranches()
+    void AddEdge(uint32_t label) {
+        edges_.push_back({DataSize(), label_, label});
+        program_->data.push_back(0);
+        program_->data.push_back(kNoOperand);
+    }
+
+    bool CompileInstruction(uint32_t opcode, const uint32_t *operands, uint32_t count) {
+        // Most instructions are result type, result id, then operands
+        const uint32_t result_type = count > 0 ? operands[0] : 0;
+        const uint32_t result_id = count > 1 ? operands[1] : 0;
+        const uint32_t words = Words(result_type);
+        auto operand = [&](uint32_t index) { return index < count ? Reg(operands[index]) : 0; };
+        auto allocate = [&]() {
+            value_types_[result_id] = result_type;
+            return AllocateRegisters(result_id, words);
+        };
+        switch (opcode) {
+            case SpvOpLoad: {
+                if (count < 3 || operands[2] >= pointer_layouts_.size() || pointer_layouts_[operands[2]] == kNoOperand) {
+                    return Fail("bad OpLoad");
+                }
+                const uint32_t type_op = types_[result_type].op;
+                if (type_op == SpvOpTypeImage || type_op == SpvOpTypeSampler || type_op == SpvOpTypeSampledImage) {
+                    Emit(kComputeOpLoadHandle, allocate(), operand(2), 0, 0, words);
+                    return true;
+                }
+                if (type_op == SpvOpTypePointer) return Fail("unsupported pointer load");
+                Emit(SpvOpLoad, allocate(), operand(2), 0, 0, words, 0, GetPlan(pointer_layouts_[operands[2]]));
+                return true;
+            }
+            case SpvOpStore:
+                if (count < 2 || operands[0] >= pointer_layouts_.size() || pointer_layouts_[operands[0]] == kNoOperand) {
+                    return Fail("bad OpStore");
+                }
+                Emit(SpvOpStore, 0, Reg(operands[0]), Reg(operands[1]), 0, 0, 0, GetPlan(pointer_layouts_[operands[0]]));
+                return true;
+            case SpvOpCopyMemory: {
+                if (count < 2 || operands[0] >= pointer_layouts_.size() || pointer_layouts_[operands[0]] == kNoOperand ||
+                    pointer_layouts_[operands[1]] == kNoOperand) {
+                    return Fail("bad OpCopyMemory");
+                }
+                // Loaded into scratch registers, then stored
+                const uint32_t target_layout = pointer_layouts_[operands[0]];
+                const uint32_t temp_words = Words(layouts_[target_layout].type);
+                const uint32_t temp = static_cast<uint32_t>(program_->registers.size());
+                program_->registers.resize(temp + temp_words, 0);
+                Emit(SpvOpLoad, temp, Reg(operands[1]), 0, 0, temp_words, 0, GetPlan(pointer_layouts_[operands[1]]));
+                Emit(SpvOpStore, 0, Reg(operands[0]), temp, 0, 0, 0, GetPlan(target_layout));
+                return true;
+            }
+            case SpvOpVariable:
+                return ParseVariable(operands, count);
+            case SpvOpAccessChain:
+            case SpvOpInBoundsAccessChain:
+                if (count < 3) return Fail("bad access chain");
+                return CompileAccessChain(operands, count);
+            case SpvOpArrayLength: {
+                if (count < 4 || pointer_layouts_[operands[2]] == kNoOperand) return Fail("bad OpArrayLength");
+                const Layout &block = layouts_[pointer_layouts_[operands[2]]];
+                if (operands[3] >= block.offsets.size()) return Fail("bad OpArrayLength");
+                const Layout &array = layouts_[block.children[operands[3]]];
+                Emit(SpvOpArrayLength, allocate(), operand(2), array.stride, 0, 1, block.offsets[operands[3]]);
+                return true;
+            }
+            case SpvOpCopyObject:
+            case SpvOpCopyLogical:
+            case SpvOpBitcast:
+            case SpvOpUConvert:
+            case SpvOpSConvert:
+            case SpvOpFConvert:
+                // Every type is 32 bits wide, so these only copy
+                if (count < 3) return Fail("bad copy");
+                if (IsType(result_type, SpvOpTypePointer)) {
+                    if (opcode != SpvOpCopyObject) return Fail("unsupported pointer cast");
+                    pointer_layouts_[result_id] = pointer_layouts_[operands[2]];
+                }
+                Emit(SpvOpCopyObject, allocate(), operand(2), 0, 0, words);
+                return true;
+            case SpvOpCompositeExtract: {
+                if (count < 3) return Fail("bad OpCompositeExtract");
+                uint32_t type = value_types_[operands[2]];
+                uint32_t offset = 0;
+                for (uint32_t i = 3; i < count; ++i) {
+                    if (!ComponentOffset(&type, operands[i], &offset)) return false;
+                }
+                Emit(SpvOpCopyObject, allocate(), operand(2) + offset, 0, 0, words);
+                return true;
+            }
+            case SpvOpCompositeInsert: {
+                if (count < 4) return Fail("bad OpCompositeInsert");
+                uint32_t type = result_type;
+                uint32_t offset = 0;
+                for (uint32_t i = 4; i < count; ++i) {
+                    if (!ComponentOffset(&type, operands[i], &offset)) return false;
+                }
+                const uint32_t data = DataSize();
+                for (uint32_t k = 0; k < words; ++k) {
+                    const bool inserted = k >= offset && k < offset + Words(type);
+                    program_->data.push_back(inserted ? operand(2) + k - offset : operand(3) + k);
+                }
+                Emit(kComputeOpGather, allocate(), 0, 0, 0, words, 0, data);
+                return true;
+            }
+            case SpvOpCompositeConstruct: {
+                // Composites are their constituents' words in order, whatever their types
+                const uint32_t data = DataSize();
+                for (uint32_t i = 2; i < count; ++i) {
+                    for (uint32_t k = 0; k < WordsOfId(operands[i]); ++k) program_->data.push_back(operand(i) + k);
+                }
+                program_->data.resize(data + words, kNoOperand);
+                Emit(kComputeOpGather, allocate(), 0, 0, 0, words, 0, data);
+                return true;
+            }
+            case SpvOpVectorShuffle: {
+                if (count < 4) return Fail("bad OpVectorShuffle");
+                const uint32_t first_length = WordsOfId(operands[2]);
+                const uint32_t data = DataSize();
+                for (uint32_t i = 4; i < count; ++i) {
+                    const uint32_t component = operands[i];
+                    if (component == 0xFFFFFFFF) {
+                        program_->data.push_back(kNoOperand);
+                    } else {
+                        program_->data.push_back(component < first_length ? operand(2) + component
+                                                                          : operand(3) + component - first_length);
+                    }
+                }
+                Emit(kComputeOpGather, allocate(), 0, 0, 0, words, 0, data);
+                return true;
+            }
+            case SpvOpVectorExtractDynamic:
+                Emit(opcode, allocate(), operand(2), operand(3), 0, words, WordsOfId(operands[2]));
+                return true;
+            case SpvOpVectorInsertDynamic:
+                Emit(opcode, allocate(), operand(2), operand(3), operand(4), words);
+                return true;
+            case SpvOpSNegate:
+            case SpvOpFNegate:
+            case SpvOpNot:
+            case SpvOpLogicalNot:
+            case SpvOpConvertFToU:
+            case SpvOpConvertFToS:
+            case SpvOpConvertSToF:
+            case SpvOpConvertUToF:
+            case SpvOpQuantizeToF16:
+            case SpvOpIsNan:
+            case SpvOpIsInf:
+            case SpvOpBitReverse:
+            case SpvOpBitCount:
+                Emit(opcode, allocate(), operand(2), 0, 0, words);
+                return true;
+            case SpvOpIAdd:
+            case SpvOpFAdd:
+            case SpvOpISub:
+            case SpvOpFSub:
+            case SpvOpIMul:
+            case SpvOpFMul:
+            case SpvOpUDiv:
+            case SpvOpSDiv:
+            case SpvOpFDiv:
+            case SpvOpUMod:
+            case SpvOpSRem:
+            case SpvOpSMod:
+            case SpvOpFRem:
+            case SpvOpFMod:
+            case SpvOpVectorTimesScalar:
+            case SpvOpMatrixTimesScalar:
+            case SpvOpLogicalEqual:
+            case SpvOpLogicalNotEqual:
+            case SpvOpLogicalOr:
+            case SpvOpLogicalAnd:
+            case SpvOpIEqual:
+            case SpvOpINotEqual:
+            case SpvOpUGreaterThan:
+            case SpvOpSGreaterThan:
+            case SpvOpUGreaterThanEqual:
+            case SpvOpSGreaterThanEqual:
+            case SpvOpULessThan:
+            case SpvOpSLessThan:
+            case SpvOpULessThanEqual:
+            case SpvOpSLessThanEqual:
+            case SpvOpFOrdEqual:
+            case SpvOpFUnordEqual:
+            case SpvOpFOrdNotEqual:
+            case SpvOpFUnordNotEqual:
+            case SpvOpFOrdLessThan:
+            case SpvOpFUnordLessThan:
+            case SpvOpFOrdGreaterThan:
+            case SpvOpFUnordGreaterThan:
+            case SpvOpFOrdLessThanEqual:
+            case SpvOpFUnordLessThanEqual:
+            case SpvOpFOrdGreaterThanEqual:
+            case SpvOpFUnordGreaterThanEqual:
+            case SpvOpShiftRightLogical:
+            case SpvOpShiftRightArithmetic:
+            case SpvOpShiftLeftLogical:
+            case SpvOpBitwiseOr:
+            case SpvOpBitwiseXor:
+            case SpvOpBitwiseAnd:
+                if (count < 4) return Fail("bad binary instruction");
+                Emit(opcode, allocate(), operand(2), operand(3), 0, words);
+                return true;
+            case SpvOpSelect:
+                if (count < 5) return Fail("bad OpSelect");
+                if (IsType(result_type, SpvOpTypePointer)) return Fail("unsupported variable pointers");
+                Emit(opcode, allocate(), operand(2), operand(3), operand(4), words, WordsOfId(operands[2]) == 1 && words > 1);
+                return true;
+            case SpvOpDot:
+                Emit(opcode, allocate(), operand(2), operand(3), 0, 1, WordsOfId(operands[2]));
+                return true;
+            case SpvOpAny:
+            case SpvOpAll:
+                Emit(opcode, allocate(), operand(2), 0, 0, 1, WordsOfId(operands[2]));
+                return true;
+            case SpvOpMatrixTimesVector:
+                Emit(opcode, allocate(), operand(2), operand(3), 0, words, types_[value_types_[operands[2]]].length);
+                return true;
+            case SpvOpVectorTimesMatrix:
+                Emit(opcode, allocate(), operand(2), operand(3), 0, words, WordsOfId(operands[2]));
+                return true;
+            case SpvOpMatrixTimesMatrix: {
+                const Type &left = types_[value_types_[operands[2]]];
+                Emit(opcode, allocate(), operand(2), operand(3), 0, words, left.length, Words(left.element));
+                return true;
+            }
+            case SpvOpOuterProduct:
+                Emit(opcode, allocate(), operand(2), operand(3), 0, words, WordsOfId(operands[2]));
+                return true;
+            case SpvOpTranspose: {
+                const Type &matrix = types_[value_types_[operands[2]]];
+                Emit(opcode, allocate(), operand(2), 0, 0, words, matrix.length, Words(matrix.element));
+                return true;
+            }
+            case SpvOpBitFieldInsert:
+                if (count < 6) return Fail("bad OpBitFieldInsert");
+                Emit(opcode, allocate(), operand(2), operand(3), operand(4), words, 0, operand(5));
+                return true;
+            case SpvOpBitFieldSExtract:
+            case SpvOpBitFieldUExtract:
+                if (count < 5) return Fail("bad bit field extract");
+                Emit(opcode, allocate(), operand(2), operand(3), operand(4), words);
+                return true;
+            case SpvOpExtInst: {
+                if (count < 4 || operands[2] != glsl_import_) return Fail("unsupported extended instruction set");
+                const uint32_t instruction = operands[3];
+                const uint32_t first_words = count > 4 ? WordsOfId(operands[4]) : 0;
+                switch (instruction) {
+                    case GLSLstd450Round:
+                    case GLSLstd450RoundEven:
+                    case GLSLstd450Trunc:
+                    case GLSLstd450FAbs:
+                    case GLSLstd450SAbs:
+                    case GLSLstd450FSign:
+                    case GLSLstd450SSign:
+                    case GLSLstd450Floor:
+                    case GLSLstd450Ceil:
+                    case GLSLstd450Fract:
+                    case GLSLstd450Radians:
+                    case GLSLstd450Degrees:
+                    case GLSLstd450Sin:
+                    case GLSLstd450Cos:
+                    case GLSLstd450Tan:
+                    case GLSLstd450Asin:
+                    case GLSLstd450Acos:
+                    case GLSLstd450Atan:
+                    case GLSLstd450Sinh:
+                    case GLSLstd450Cosh:
+                    case GLSLstd450Tanh:
+                    case GLSLstd450Asinh:
+                    case GLSLstd450Acosh:
+                    case GLSLstd450Atanh:
+                    case GLSLstd450Atan2:
+                    case GLSLstd450Pow:
+                    case GLSLstd450Exp:
+                    case GLSLstd450Log:
+                    case GLSLstd450Exp2:
+                    case GLSLstd450Log2:
+                    case GLSLstd450Sqrt:
+                    case GLSLstd450InverseSqrt:
+                    case GLSLstd450FMin:
+                    case GLSLstd450UMin:
+                    case GLSLstd450SMin:
+                    case GLSLstd450FMax:
+                    case GLSLstd450UMax:
+                    case GLSLstd450SMax:
+                    case GLSLstd450FClamp:
+                    case GLSLstd450UClamp:
+                    case GLSLstd450SClamp:
+                    case GLSLstd450FMix:
+                    case GLSLstd450Step:
+                    case GLSLstd450SmoothStep:
+                    case GLSLstd450Fma:
+                    case GLSLstd450Ldexp:
+                    case GLSLstd450PackSnorm4x8:
+                    case GLSLstd450PackUnorm4x8:
+                    case GLSLstd450PackSnorm2x16:
+                    case GLSLstd450PackUnorm2x16:
+                    case GLSLstd450PackHalf2x16:
+                    case GLSLstd450UnpackSnorm2x16:
+                    case GLSLstd450UnpackUnorm2x16:
+                    case GLSLstd450UnpackHalf2x16:
+                    case GLSLstd450UnpackSnorm4x8:
+                    case GLSLstd450UnpackUnorm4x8:
+                    case GLSLstd450Length:
+                    case GLSLstd450Distance:
+                    case GLSLstd450Cross:
+                    case GLSLstd450Normalize:
+                    case GLSLstd450FaceForward:
+                    case GLSLstd450Reflect:
+                    case GLSLstd450Refract:
+                    case GLSLstd450FindILsb:
+                    case GLSLstd450FindSMsb:
+                    case GLSLstd450FindUMsb:
+                    case GLSLstd450NMin:
+                    case GLSLstd450NMax:
+                    case GLSLstd450NClamp:
+                        break;
+                    default:
+                        return Unsupported("unsupported GLSL.std.450 instruction", instruction);
+                }
+                Emit(SpvOpExtInst, allocate(), operand(4), operand(5), operand(6), words, instruction, first_words);
+                return true;
+            }
+            case SpvOpAtomicLoad:
+            case SpvOpAtomicIIncrement:
+            case SpvOpAtomicIDecrement:
+                Emit(opcode, allocate(), operand(2), 0, 0, 1);
+                return true;
+            case SpvOpAtomicStore:
+                if (count < 4) return Fail("bad OpAtomicStore");
+                Emit(opcode, 0, Reg(operands[0]), Reg(operands[3]), 0, 0);
+                return true;
+            case SpvOpAtomicExchange:
+            case SpvOpAtomicIAdd:
+            case SpvOpAtomicISub:
+            case SpvOpAtomicSMin:
+            case SpvOpAtomicUMin:
+            case SpvOpAtomicSMax:
+            case SpvOpAtomicUMax:
+            case SpvOpAtomicAnd:
+            case SpvOpAtomicOr:
+            case SpvOpAtomicXor:
+                if (count < 6) return Fail("bad atomic");
+                Emit(opcode, allocate(), operand(2), operand(5), 0, 1);
+                return true;
+            case SpvOpAtomicCompareExchange:
+            case SpvOpAtomicCompareExchangeWeak:
+                if (count < 8) return Fail("bad atomic");
+                Emit(SpvOpAtomicCompareExchange, allocate(), operand(2), operand(6), operand(7), 1);
+                return true;
+            case SpvOpControlBarrier:
+            case SpvOpMemoryBarrier:
+                Emit(opcode, 0, 0, 0, 0, 0);
+                return true;
+            case SpvOpSampledImage:
+                // The image's region, then the sampler's
+                Emit(kComputeOpGather, allocate(), 0, 0, 0, 2, 0, DataSize());
+                program_->data.push_back(operand(2));
+                program_->data.push_back(operand(3));
+                return true;
+            case SpvOpImage:
+                Emit(SpvOpCopyObject, allocate(), operand(2), 0, 0, 1);
+                return true;
+            case SpvOpImageRead:
+            case SpvOpImageFetch:
+            case SpvOpImageSampleImplicitLod:
+            case SpvOpImageSampleExplicitLod: {
+                if (count < 4) return Fail("bad image instruction");
+                uint32_t image_type = value_types_[operands[2]];
+                if (IsType(image_type, SpvOpTypeSampledImage)) image_type = types_[image_type].element;
+                if (!IsType(image_type, SpvOpTypeImage)) return Fail("bad image operand");
+                const Type &image = types_[image_type];
+                const bool sample = opcode == SpvOpImageSampleImplicitLod || opcode == SpvOpImageSampleExplicitLod;
+                if (image.dim != SpvDim1D && image.dim != SpvDim2D && image.dim != SpvDim3D && image.dim != SpvDimRect &&
+                    (image.dim != SpvDimCube || sample)) {
+                    return Unsupported("unsupported image dimension", image.dim);
+                }
+                Emit(sample ? SpvOpImageSampleExplicitLod : SpvOpImageRead, allocate(), operand(2), operand(3), 0, words,
+                     image.dim | image.arrayed << 8, WordsOfId(operands[3]));
+                return true;
+            }
+            case SpvOpImageWrite: {
+                if (count < 3) return Fail("bad OpImageWrite");
+                const Type &image = types_[value_types_[operands[0]]];
+                if (image.dim != SpvDim1D && image.dim != SpvDim2D && image.dim != SpvDim3D && image.dim != SpvDimRect &&
+                    image.dim != SpvDimCube) {
+                    return Unsupported("unsupported image dimension", image.dim);
+                }
+                Emit(opcode, 0, Reg(operands[0]), Reg(operands[1]), Reg(operands[2]), WordsOfId(operands[2]),
+                     image.dim | image.arrayed << 8, WordsOfId(operands[1]));
+                return true;
+            }
+            case SpvOpImageQuerySize:
+            case SpvOpImageQuerySizeLod: {
+                uint32_t image_type = value_types_[operands[2]];
+                if (!IsType(image_type, SpvOpTypeImage)) return Fail("bad image operand");
+                const Type &image = types_[image_type];
+                Emit(SpvOpImageQuerySize, allocate(), operand(2), 0, 0, words, image.dim | image.arrayed << 8);
+                return true;
+            }
+            case SpvOpImageQueryLevels:
+            case SpvOpImageQuerySamples:
+                // Views have one mip level as far as the program is concerned, and images one sample
+                AllocateRegisters(result_id, 1);
+                program_->registers[Reg(result_id)] = 1;
+                value_types_[result_id] = result_type;
+                return true;
+            case SpvOpFunctionCall: {
+                if (count < 3) return Fail("bad OpFunctionCall");
+                const uint32_t data = DataSize();
+                program_->data.push_back(count - 3);
+                for (uint32_t i = 3; i < count; ++i) {
+                    program_->data.push_back(0);  // The parameter's register, once the function is known
+                    program_->data.push_back(Reg(operands[i]));
+                    program_->data.push_back(IsPointer(operands[i]) ? 2 : WordsOfId(operands[i]));
+                }
+                pending_calls_.push_back({Emit(SpvOpFunctionCall, allocate(), 0, 0, 0, words, 0, data), operands[2]});
+                return true;
+            }
+            case SpvOpBranch:
+                if (count < 1) return Fail("bad OpBranch");
+                Emit(SpvOpBranch, 0, 0, 0, 0, 0, 0, DataSize());
+                AddEdge(operands[0]);
+                return true;
+            case SpvOpBranchConditional:
+                if (count < 3) return Fail("bad OpBranchConditional");
+                Emit(SpvOpBranchConditional, 0, Reg(operands[0]), 0, 0, 0, 0, DataSize());
+                AddEdge(operands[1]);
+                AddEdge(operands[2]);
+                return true;
+            case SpvOpSwitch: {
+                if (count < 2 || WordsOfId(operands[0]) != 1) return Fail("bad OpSwitch");
+                const uint32_t data = DataSize();
+                program_->data.push_back((count - 2) / 2);
+                AddEdge(operands[1]);
+                for (uint32_t i = 2; i + 1 < count; i += 2) {
+                    program_->data.push_back(operands[i]);
+                    AddEdge(operands[i + 1]);
+                }
+                Emit(SpvOpSwitch, 0, Reg(operands[0]), 0, 0, 0, 0, data);
+                return true;
+            }
+            case SpvOpReturn:
+            case SpvOpKill:
+            case SpvOpTerminateInvocation:
+            case SpvOpUnreachable:
+                Emit(opcode == SpvOpReturn ? SpvOpReturn : SpvOpKill, 0, 0, 0, 0, 0);
+                return true;
+            case SpvOpReturnValue:
+                if (count < 1) return Fail("bad OpReturnValue");
+                Emit(opcode, 0, Reg(operands[0]), 0, 0, WordsOfId(operands[0]));
+                return true;
+            default:
+                return Unsupported("unsupported instruction", opcode);
+        }
+    }
+
+    bool IsPointer(uint32_t id) const { return id < pointer_layouts_.size() && pointer_layouts_[id] != kNoOperand; }
+
+    // Steps into a composite: the register offset of component index within type, which becomes the component's type
+    bool ComponentOffset(uint32_t *type_id, uint32_t index, uint32_t *offset) const {
+        if (*type_id >= types_.size()) return false;
+        const Type &type = types_[*type_id];
+        switch (type.op) {
+            case SpvOpTypeVector:
+            case SpvOpTypeMatrix:
+            case SpvOpTypeArray:
+                if (index >= type.length) return false;
+                *offset += index * Words(type.element);
+                *type_id = type.element;
+                return true;
+            case SpvOpTypeStruct:
+                if (index >= type.members.size()) return false;
+                for (uint32_t m = 0; m < index; ++m) *offset += Words(type.members[m]);
+                *type_id = type.members[index];
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // Fills in branch targets, and turns the phis of each target into copies the branch makes
+    bool ResolveBranches() {
+        for (const Edge &edge : edges_) {
+            if (edge.to_label >= labels_.size() || labels_[edge.to_label] == kNoOperand) return Fail("bad branch target");
+            program_->data[edge.data] = labels_[edge.to_label];
+            auto phis = phis_.find(edge.to_label);
+            if (phis == phis_.end()) continue;
+            std::vector<uint32_t> copies;
+            for (const Phi &phi : phis->second) {
+                for (const auto &incoming : phi.incoming) {
+                    if (incoming.second != edge.from_label) continue;
+                    copies.push_back(phi.result);
+                    copies.push_back(Reg(incoming.first));
+                    copies.push_back(phi.words);
+                }
+            }
+            if (copies.empty()) continue;
+            program_->data[edge.data + 1] = DataSize();
+            program_->data.push_back(static_cast<uint32_t>(copies.size() / 3));
+            program_->data.insert(program_->data.end(), copies.begin(), copies.end());
+        }
+        return true;
+    }
+
+    bool ResolveCalls(uint32_t entry_function) {
+        for (const PendingCall &call : pending_calls_) {
+            if (call.function >= function_entries_.size() || function_entries_[call.function] == kNoOperand) {
+                return Fail("bad function call");
+            }
+            SpirvInstruction &instruction = program_->code[call.instruction];
+            instruction.a = function_entries_[call.function];
+            const auto &parameters = function_parameters_[call.function];
+            if (program_->data[instruction.data] != parameters.size()) return Fail("bad function call arguments");
+            for (uint32_t i = 0; i < parameters.size(); ++i) program_->data[instruction.data + 1 + 3 * i] = Reg(parameters[i]);
+        }
+        program_->entry = function_entries_[entry_function];
+        return true;
+    }
+
+    const uint32_t *code_;
+    size_t word_count_;
+    std::string entry_point_;
+    const VkSpecializationInfo *specialization_;
+    std::shared_ptr<ComputeProgram> program_;
+    std::string error_;
+
+    std::vector<Type> types_;
+    std::vector<uint32_t> registers_;  // Register offset of each id
+    std::vector<bool> constant_known_;  // Ids that are constants
+    std::vector<uint32_t> pointer_layouts_;  // Layout of what each pointer id points to
+    std::vector<Layout> layouts_;
+    std::unordered_map<uint64_t, uint32_t> layout_cache_;
+    std::unordered_map<uint32_t, std::vector<Decoration>> decorations_;
+    std::unordered_map<uint32_t, uint32_t> value_types_;  // Type of each value id
+    std::vector<std::vector<uint32_t>> execution_modes_;
+    uint32_t glsl_import_ = kNoOperand;
+    uint32_t workgroup_size_id_ = 0;
+
+    std::vector<SpirvInstruction> *code_out_ = nullptr;
+    bool in_function_ = false;
+    uint32_t function_ = 0;
+    uint32_t label_ = 0;
+    std::vector<uint32_t> labels_;  // Address of each label's block
+    std::vector<uint32_t> function_entries_;  // Address of each function's first block
+    std::unordered_map<uint32_t, std::vector<uint32_t>> function_parameters_;
+    std::unordered_map<uint32_t, std::vector<Phi>> phis_;  // Phis at the start of each label's block
+    std::vector<Edge> edges_;
+    std::vector<PendingCall> pending_calls_;
+};
+
+// Compiles the GLCompute entry point of a shader module, or returns nullptr with the reason in error
+static std::shared_ptr<const ComputeProgram> CompileComputeProgram(const uint32_t *code, size_t word_count, const char *entry_point,
+                                                                   const VkSpecializationInfo *specialization, std::string *error) {
+    SpirvCompiler compiler(code, word_count, entry_point, specialization);
+    return compiler.Compile(error);
+}
+
+// Reads a texel of an integer format as RGBA words, with missing channels 0 and missing alpha 1
+static void DecodeIntegerTexel(const TexelFormat &format, const uint8_t *texel, uint32_t rgba[4]) {
+    for (uint32_t i = 0; i < 4; ++i) {
+        const uint32_t channel = format.swizzle[i];
+        if (channel == kNoChannel) {
+            rgba[i] = i == 3 ? 1 : 0;
+        } else if (format.type == TexelType::Uint8) {
+            rgba[i] = texel[channel];
+        } else if (format.type == TexelType::Sint8) {
+            rgba[i] = static_cast<uint32_t>(static_cast<int32_t>(static_cast<int8_t>(texel[channel])));
+        } else {
+            memcpy(&rgba[i], texel + 4 * channel, sizeof(uint32_t));
+        }
+    }
+}
+
+// Where an address mode puts texel i of an axis size texels long, or -1 for the border
+static int32_t AddressTexel(VkSamplerAddressMode mode, int32_t i, int32_t size) {
+    switch (mode) {
+        case VK_SAMPLER_ADDRESS_MODE_REPEAT:
+            return ((i % size) + size) % size;
+        case VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT: {
+            const int32_t t = ((i % (2 * size)) + 2 * size) % (2 * size);
+            return t < size ? t : 2 * size - 1 - t;
+        }
+        case VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER:
+            return i >= 0 && i < size ? i : -1;
+        case VK_SAMPLER_ADDRESS_MODE_MIRROR_CLAMP_TO_EDGE:
+            return (std::min)(i < 0 ? -1 - i : i, size - 1);
+        default:
+            return (std::min)((std::max)(i, 0), size - 1);
+    }
+}
+
+// Runs the workgroups of a dispatch. Each workgroup's invocations take turns on the calling thread: each runs until it
+// reaches a barrier or finishes, and once all of them have, the ones at the barrier carry on. An executor runs one
+// workgroup at a time, so each thread running a dispatch needs its own.
+class ComputeExecutor {
+  public:
+    explicit ComputeExecutor(const ComputeDispatch &dispatch)
+        : dispatch_(dispatch),
+          program_(*dispatch.program),
+          invocation_count_(program_.local_size[0] * program_.local_size[1] * program_.local_size[2]),
+          register_count_(static_cast<uint32_t>(program_.registers.size())),
+          memory_size_(program_.invocation_memory.size()),
+          registers_(size_t(invocation_count_) * register_count_),
+          memory_(invocation_count_ * memory_size_),
+          workgroup_memory_(program_.workgroup_memory_size),
+          invocations_(invocation_count_) {}
+
+    // Runs the workgroup with the given index in the dispatch, counted from its base group
+    void RunWorkgroup(uint32_t x, uint32_t y, uint32_t z) {
+        const uint32_t group[3] = {dispatch_.base_group[0] + x, dispatch_.base_group[1] + y, dispatch_.base_group[2] + z};
+        std::fill(workgroup_memory_.begin(), workgroup_memory_.end(), uint8_t(0));
+        const uint32_t *local_size = program_.local_size;
+        for (uint32_t index = 0; index < invocation_count_; ++index) {
+            memcpy(&registers_[size_t(index) * register_count_], program_.registers.data(), register_count_ * sizeof(uint32_t));
+            uint8_t *memory = &memory_[index * memory_size_];
+            if (memory_size_) memcpy(memory, program_.invocation_memory.data(), memory_size_);
+            const uint32_t local[3] = {index % local_size[0], index / local_size[0] % local_size[1],
+                                       index / (local_size[0] * local_size[1])};
+            for (const ComputeBuiltin &builtin : program_.builtins) {
+                uint32_t value[3] = {};
+                for (uint32_t i = 0; i < 3; ++i) {
+                    switch (builtin.builtin) {
+                        case SpvBuiltInNumWorkgroups:
+                            value[i] = dispatch_.group_count[i];
+                            break;
+                        case SpvBuiltInWorkgroupSize:
+                            value[i] = local_size[i];
+                            break;
+                        case SpvBuiltInWorkgroupId:
+                            value[i] = group[i];
+                            break;
+                        case SpvBuiltInLocalInvocationId:
+                            value[i] = local[i];
+                            break;
+                        case SpvBuiltInGlobalInvocationId:
+                            value[i] = group[i] * local_size[i] + local[i];
+                            break;
+                        case SpvBuiltInLocalInvocationIndex:
+                            value[i] = i == 0 ? index : 0;
+                            break;
+                    }
+                }
+                const size_t size = builtin.builtin == SpvBuiltInLocalInvocationIndex ? sizeof(uint32_t) : sizeof(value);
+                memcpy(memory + builtin.offset, value, (std::min)(size, memory_size_ - builtin.offset));
+            }
+            Invocation &invocation = invocations_[index];
+            invocation.pc = program_.entry;
+            invocation.done = false;
+            invocation.calls.clear();
+        }
+        for (bool running = true; running;) {
+            running = false;
+            for (uint32_t index = 0; index < invocation_count_; ++index) {
+                if (!invocations_[index].done) running |= Run(index);
+            }
+        }
+    }
+
+  private:
+    struct Invocation {
+        uint32_t pc;
+        bool done;
+        std::vector<uint32_t> calls;  // The OpFunctionCall each active function returns to
+    };
+
+    // The memory a pointer region refers to, or nullptr
+    uint8_t *Region(uint32_t index, uint32_t region, size_t *size) {
+        switch (region) {
+            case kNullRegion:
+                return nullptr;
+            case kPushConstantRegion:
+                *size = kMaxPushConstantSize;
+                return const_cast<uint8_t *>(dispatch_.push_constants);
+            case kWorkgroupRegion:
+                *size = workgroup_memory_.size();
+                return workgroup_memory_.data();
+            case kInvocationRegion:
+                *size = memory_size_;
+                return &memory_[index * memory_size_];
+            default: {
+                const ComputeBinding *binding = Binding(region);
+                if (!binding) return nullptr;
+                *size = binding->size;
+                return binding->data;
+            }
+        }
+    }
+
+    const ComputeBinding *Binding(uint32_t region) const {
+        if (region < kFirstResourceRegion) return nullptr;
+        const uint32_t resource = (region - kFirstResourceRegion) >> kResourceElementBits;
+        const uint32_t element = (region - kFirstResourceRegion) & ((1u << kResourceElementBits) - 1);
+        if (resource >= dispatch_.resources.size() || element >= dispatch_.resources[resource].size()) return nullptr;
+        return &dispatch_.resources[resource][element];
+    }
+
+    // size bytes at a pointer, or nullptr if any of them are out of bounds
+    uint8_t *Resolve(uint32_t index, const uint32_t *pointer, uint64_t offset, uint64_t size) {
+        size_t region_size = 0;
+        uint8_t *base = Region(index, pointer[0], &region_size);
+        offset += pointer[1];
+        if (!base || offset + size > region_size) return nullptr;
+        return base + offset;
+    }
+
+    std::atomic<uint32_t> *ResolveAtomic(uint32_t index, const uint32_t *pointer) {
+        uint8_t *address = Resolve(index, pointer, 0, sizeof(uint32_t));
+        if (!address || reinterpret_cast<uintptr_t>(address) & 3) return nullptr;
+        return reinterpret_cast<std::atomic<uint32_t> *>(address);
+    }
+
+    // Follows a branch edge: makes its phi copies, as one parallel copy, and returns where it goes
+    uint32_t TakeEdge(uint32_t *r, uint32_t edge) {
+        const uint32_t *data = program_.data.data();
+        const uint32_t copies = data[edge + 1];
+        if (copies != kNoOperand) {
+            const uint32_t count = data[copies];
+            scratch_.clear();
+            for (uint32_t k = 0; k < count; ++k) {
+                const uint32_t *copy = &data[copies + 1 + 3 * k];
+                scratch_.insert(scratch_.end(), &r[copy[1]], &r[copy[1]] + copy[2]);
+            }
+            const uint32_t *value = scratch_.data();
+            for (uint32_t k = 0; k < count; ++k) {
+                const uint32_t *copy = &data[copies + 1 + 3 * k];
+                memcpy(&r[copy[0]], value, copy[2] * sizeof(uint32_t));
+                value += copy[2];
+            }
+        }
+        return data[edge];
+    }
+
+    // The texel at integer coordinates, aux being the image's dimensionality and whether it's arrayed
+    uint8_t *Texel(const ComputeBinding *image, const uint32_t *coordinates, uint32_t coordinate_count, uint32_t aux) {
+        if (!image || !image->format || !image->data) return nullptr;
+        uint32_t position[3] = {};
+        for (uint32_t i = 0; i < coordinate_count && i < 3; ++i) position[i] = coordinates[i];
+        // 1D arrays have their layer second, and the layer or cube face of the others is third
+        if ((aux & 0xFF) == SpvDim1D && aux >> 8) std::swap(position[1], position[2]);
+        if (position[0] >= image->width || position[1] >= image->height || position[2] >= image->depth) return nullptr;
+        const size_t offset =
+            position[2] * image->slice_pitch + position[1] * image->row_pitch + size_t(position[0]) * image->format->size;
+        if (offset + image->format->size > image->size) return nullptr;
+        return image->data + offset;
+    }
+
+    static void ReadTexel(const ComputeBinding *image, const uint8_t *texel, uint32_t rgba[4]) {
+        if (!texel) {
+            memset(rgba, 0, 4 * sizeof(uint32_t));
+        } else if (image->format->Integer()) {
+            DecodeIntegerTexel(*image->format, texel, rgba);
+        } else {
+            float values[4];
+            DecodeTexel(*image->format, texel, values);
+            for (uint32_t i = 0; i < 4; ++i) rgba[i] = FloatWord(values[i]);
+        }
+    }
+
+    // Samples the base level of an image with a sampler's filter and address modes. Border texels are transparent black.
+    void Sample(const ComputeBinding *image, const ComputeBinding *sampler, const uint32_t *coordinates, uint32_t coordinate_count,
+                uint32_t aux, uint32_t rgba[4]) {
+        memset(rgba, 0, 4 * sizeof(uint32_t));
+        if (!image || !sampler || !image->format || !image->data || !image->width || !image->height || !image->depth) return;
+        const uint32_t dim = aux & 0xFF;
+        const bool arrayed = (aux >> 8) != 0;
+        const uint32_t axes = dim == SpvDim1D ? 1 : (dim == SpvDim3D ? 3 : 2);
+        const int32_t sizes[3] = {static_cast<int32_t>(image->width), static_cast<int32_t>(image->height),
+                                  static_cast<int32_t>(image->depth)};
+        int32_t i0[3] = {0, 0, 0};
+        int32_t i1[3] = {0, 0, 0};
+        float weight[3] = {0.0f, 0.0f, 0.0f};
+        const bool linear = sampler->linear_filter && !image->format->Integer();
+        for (uint32_t axis = 0; axis < axes && axis < coordinate_count; ++axis) {
+            float u = AsFloat(coordinates[axis]);
+            if (u != u) u = 0.0f;
+            if (!sampler->unnormalized_coordinates) u *= sizes[axis];
+            if (linear) u -= 0.5f;
+            const float base = floorf(u);
+            const int32_t texel = static_cast<int32_t>((std::max)((std::min)(base, 1e9f), -1e9f));
+            i0[axis] = AddressTexel(sampler->address_modes[axis], texel, sizes[axis]);
+            i1[axis] = linear ? AddressTexel(sampler->address_modes[axis], texel + 1, sizes[axis]) : i0[axis];
+            weight[axis] = linear ? u - base : 0.0f;
+        }
+        if (arrayed && axes < 3 && axes < coordinate_count) {
+            // The array layer is rounded and clamped rather than filtered
+            const int32_t layer = static_cast<int32_t>(roundf((std::max)((std::min)(AsFloat(coordinates[axes]), 1e9f), 0.0f)));
+            i0[2] = i1[2] = (std::min)(layer, sizes[2] - 1);
+        }
+        float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        const uint32_t corners = linear ? 1u << axes : 1u;
+        for (uint32_t corner = 0; corner < corners; ++corner) {
+            float corner_weight = 1.0f;
+            uint32_t position[3];
+            bool border = false;
+            for (uint32_t axis = 0; axis < 3; ++axis) {
+                const bool upper = (corner >> axis) & 1;
+                const int32_t i = upper ? i1[axis] : i0[axis];
+                border |= i < 0;
+                position[axis] = static_cast<uint32_t>(i);
+                if (linear && axis < axes) corner_weight *= upper ? weight[axis] : 1.0f - weight[axis];
+            }
+            if (border) continue;
+            const uint8_t *texel = image->data + position[2] * image->slice_pitch + position[1] * image->row_pitch +
+                                   size_t(position[0]) * image->format->size;
+            if (texel + image->format->size > image->data + image->size) continue;
+            if (!linear) {
+                ReadTexel(image, texel, rgba);
+                return;
+            }
+            float values[4];
+            DecodeTexel(*image->format, texel, values);
+            for (uint32_t c = 0; c < 4; ++c) sum[c] += corner_weight * values[c];
+        }
+        if (linear) {
+            for (uint32_t c = 0; c < 4; ++c) rgba[c] = FloatWord(sum[c]);
+        }
+    }
+
+    // Runs an invocation until it reaches a barrier, returning true, or finishes, returning false
+    bool Run(uint32_t index) {
+        Invocation &invocation = invocations_[index];
+        uint32_t *r = &registers_[size_t(index) * register_count_];
+        const SpirvInstruction *code = program_.code.data();
+        const uint32_t *data = program_.data.data();
+        uint32_t pc = invocation.pc;
+        while (true) {
+            const SpirvInstruction &i = code[pc++];
+            switch (i.op) {
+                case SpvOpLoad:
+                case SpvOpStore: {
+                    // Each segment is bounds checked on its own, so the parts of a struct that are in bounds still are
+                    const uint32_t *plan = &data[i.data];
+                    for (uint32_t s = 0; s < plan[0]; ++s) {
+                        const uint32_t *segment = &plan[1 + 3 * s];
+                        uint8_t *address = Resolve(index, &r[i.a], segment[0], segment[2] * sizeof(uint32_t));
+                        if (i.op == SpvOpLoad) {
+                            if (address) {
+                                memcpy(&r[i.result + segment[1]], address, segment[2] * sizeof(uint32_t));
+                            } else {
+                                memset(&r[i.result + segment[1]], 0, segment[2] * sizeof(uint32_t));
+                            }
+                        } else if (address) {
+                            memcpy(address, &r[i.b + segment[1]], segment[2] * sizeof(uint32_t));
+                        }
+                    }
+                    break;
+                }
+                case kComputeOpLoadHandle:
+                    // Combined image samplers are their own sampler
+                    r[i.result] = r[i.a];
+                    if (i.count > 1) r[i.result + 1] = r[i.a];
+                    break;
+                case SpvOpAccessChain: {
+                    const uint32_t *chain = &data[i.data];
+                    uint32_t region = r[i.a];
+                    uint32_t offset = r[i.a + 1] + chain[0];
+                    const uint32_t element = chain[2] + (chain[1] != kNoOperand ? r[chain[1]] : 0);
+                    if (element) {
+                        const uint32_t mask = (1u << kResourceElementBits) - 1;
+                        const bool valid = region >= kFirstResourceRegion && element <= mask &&
+                                           ((region - kFirstResourceRegion) & mask) + element <= mask;
+                        region = valid ? region + element : kNullRegion;
+                    }
+                    for (uint32_t k = 0; k < chain[3]; ++k) offset += r[chain[4 + 2 * k]] * chain[5 + 2 * k];
+                    r[i.result] = region;
+                    r[i.result + 1] = offset;
+                    break;
+                }
+                case SpvOpArrayLength: {
+                    size_t size = 0;
+                    const uint32_t offset = r[i.a + 1] + i.aux;
+                    Region(index, r[i.a], &size);
+                    r[i.result] = size > offset && i.b ? static_cast<uint32_t>((size - offset) / i.b) : 0;
+                    break;
+                }
+                case SpvOpAtomicLoad:
+                case SpvOpAtomicStore:
+                case SpvOpAtomicExchange:
+                case SpvOpAtomicCompareExchange:
+                case SpvOpAtomicIIncrement:
+                case SpvOpAtomicIDecrement:
+                case SpvOpAtomicIAdd:
+                case SpvOpAtomicISub:
+                case SpvOpAtomicSMin:
+                case SpvOpAtomicUMin:
+                case SpvOpAtomicSMax:
+                case SpvOpAtomicUMax:
+                case SpvOpAtomicAnd:
+                case SpvOpAtomicOr:
+                case SpvOpAtomicXor:
+                    ExecuteAtomic(index, r, i);
+                    break;
+                case SpvOpControlBarrier:
+                    invocation.pc = pc;
+                    return true;
+                case SpvOpMemoryBarrier:
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    break;
+                case SpvOpBranch:
+                    pc = TakeEdge(r, i.data);
+                    break;
+                case SpvOpBranchConditional:
+                    pc = TakeEdge(r, r[i.a] ? i.data : i.data + 2);
+                    break;
+                case SpvOpSwitch: {
+                    uint32_t edge = i.data + 1;
+                    for (uint32_t k = 0; k < data[i.data]; ++k) {
+                        if (data[i.data + 3 + 3 * k] == r[i.a]) {
+                            edge = i.data + 4 + 3 * k;
+                            break;
+                        }
+                    }
+                    pc = TakeEdge(r, edge);
+                    break;
+                }
+                case SpvOpFunctionCall: {
+                    const uint32_t *arguments = &data[i.data];
+                    for (uint32_t k = 0; k < arguments[0]; ++k) {
+                        const uint32_t *argument = &arguments[1 + 3 * k];
+                        memmove(&r[argument[0]], &r[argument[1]], argument[2] * sizeof(uint32_t));
+                    }
+                    invocation.calls.push_back(pc - 1);
+                    pc = i.a;
+                    break;
+                }
+                case SpvOpReturn:
+                case SpvOpReturnValue:
+                    if (invocation.calls.empty()) {
+                        invocation.done = true;
+                        return false;
+                    }
+                    pc = invocation.calls.back();
+                    invocation.calls.pop_back();
+                    if (i.op == SpvOpReturnValue) memmove(&r[code[pc].result], &r[i.a], i.count * sizeof(uint32_t));
+                    ++pc;
+                    break;
+                case SpvOpKill:
+                    invocation.done = true;
+                    return false;
+                case SpvOpImageRead: {
+                    uint32_t rgba[4];
+                    const ComputeBinding *image = Binding(r[i.a]);
+                    ReadTexel(image, Texel(image, &r[i.b], i.data, i.aux), rgba);
+                    memcpy(&r[i.result], rgba, (std::min)(i.count, 4u) * sizeof(uint32_t));
+                    break;
+                }
+                case SpvOpImageWrite: {
+                    const ComputeBinding *image = Binding(r[i.a]);
+                    uint8_t *texel = Texel(image, &r[i.b], i.data, i.aux);
+                    if (texel) {
+                        VkClearColorValue color = {};
+                        memcpy(color.uint32, &r[i.c], (std::min)(i.count, 4u) * sizeof(uint32_t));
+                        PackClearColor(*image->format, color, texel);
+                    }
+                    break;
+                }
+                case SpvOpImageSampleExplicitLod: {
+                    uint32_t rgba[4];
+                    Sample(Binding(r[i.a]), Binding(r[i.a + 1]), &r[i.b], i.data, i.aux, rgba);
+                    memcpy(&r[i.result], rgba, (std::min)(i.count, 4u) * sizeof(uint32_t));
+                    break;
+                }
+                case SpvOpImageQuerySize: {
+                    const ComputeBinding *image = Binding(r[i.a]);
+                    const uint32_t dim = i.aux & 0xFF;
+                    uint32_t size[4] = {};
+                    if (image) {
+                        const uint32_t axes = dim == SpvDim1D ? 1 : (dim == SpvDim3D ? 3 : 2);
+                        const uint32_t extent[3] = {image->width, image->height, image->depth};
+                        memcpy(size, extent, axes * sizeof(uint32_t));
+                        if (i.aux >> 8) size[axes] = dim == SpvDimCube ? image->depth / 6 : image->depth;
+                    }
+                    memcpy(&r[i.result], size, (std::min)(i.count, 4u) * sizeof(uint32_t));
+                    break;
+                }
+                default:
+                    ExecuteValueInstruction(r, data, i);
+                    break;
+            }
+        }
+    }
+
+    void ExecuteAtomic(uint32_t index, uint32_t *r, const SpirvInstruction &i) {
+        std::atomic<uint32_t> *target = ResolveAtomic(index, &r[i.a]);
+        if (!target) {
+            // Atomics out of bounds do nothing, and return 0
+            if (i.op != SpvOpAtomicStore) r[i.result] = 0;
+            return;
+        }
+        const uint32_t value = r[i.b];
+        uint32_t previous = 0;
+        switch (i.op) {
+            case SpvOpAtomicLoad:
+                previous = target->load();
+                break;
+            case SpvOpAtomicStore:
+                target->store(value);
+                return;
+            case SpvOpAtomicExchange:
+                previous = target->exchange(value);
+                break;
+            case SpvOpAtomicCompareExchange:
+                // b is the value to write and c what to compare with
+                previous = r[i.c];
+                target->compare_exchange_strong(previous, value);
+                break;
+            case SpvOpAtomicIIncrement:
+                previous = target->fetch_add(1);
+                break;
+            case SpvOpAtomicIDecrement:
+                previous = target->fetch_sub(1);
+                break;
+            case SpvOpAtomicIAdd:
+                previous = target->fetch_add(value);
+                break;
+            case SpvOpAtomicISub:
+                previous = target->fetch_sub(value);
+                break;
+            case SpvOpAtomicAnd:
+                previous = target->fetch_and(value);
+                break;
+            case SpvOpAtomicOr:
+                previous = target->fetch_or(value);
+                break;
+            case SpvOpAtomicXor:
+                previous = target->fetch_xor(value);
+                break;
+            default: {
+                // Minimum and maximum have no fetch operation of their own
+                previous = target->load();
+                while (true) {
+                    uint32_t desired = previous;
+                    if (i.op == SpvOpAtomicUMin) desired = (std::min)(previous, value);
+                    if (i.op == SpvOpAtomicUMax) desired = (std::max)(previous, value);
+                    if (i.op == SpvOpAtomicSMin || i.op == SpvOpAtomicSMax) {
+                        const int32_t a = static_cast<int32_t>(previous);
+                        const int32_t b = static_cast<int32_t>(value);
+                        desired = static_cast<uint32_t>(i.op == SpvOpAtomicSMin ? (std::min)(a, b) : (std::max)(a, b));
+                    }
+                    if (desired == previous || target->compare_exchange_weak(previous, desired)) break;
+                }
+                break;
+            }
+        }
+        r[i.result] = previous;
+    }
+
+    const ComputeDispatch &dispatch_;
+    const ComputeProgram &program_;
+    const uint32_t invocation_count_;
+    const uint32_t register_count_;
+    const size_t memory_size_;
+    std::vector<uint32_t> registers_;  // Each invocation's registers, one after another
+    std::vector<uint8_t> memory_;  // Each invocation's memory, one after another
+    std::vector<uint8_t> workgroup_memory_;
+    std::vector<Invocation> invocations_;
+    std::vector<uint32_t> scratch_;
+};
+
+}  // namespace vkmock
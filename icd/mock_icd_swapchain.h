@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+namespace vkmock {
+
+// Simulates the presentation engine behind a swapchain. A presented image stays on screen until a later one replaces it,
+// and only then can the app acquire it again. FIFO and FIFO_RELAXED show the oldest queued image at each refresh and MAILBOX
+// the newest, which is done on a thread per swapchain. IMMEDIATE, like the shared present modes, shows images as soon as
+// they're presented.
+class Swapchain {
+  public:
+    // A refresh rate of 0 shows queued images as fast as they're presented, without waiting for a refresh
+    Swapchain(const std::vector<VkImage> &images, VkPresentModeKHR present_mode, double refresh_rate_hz)
+        : images_(images), epoch_(Clock::now()) {
+        for (uint32_t i = 0; i < images_.size(); ++i) available_.push_back(i);
+        if (refresh_rate_hz > 0) {
+            refresh_period_ = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / refresh_rate_hz));
+        }
+        switch (present_mode) {
+            case VK_PRESENT_MODE_FIFO_KHR:
+                mode_ = Mode::kFifo;
+                break;
+            case VK_PRESENT_MODE_FIFO_RELAXED_KHR:
+                mode_ = Mode::kFifoRelaxed;
+                break;
+            case VK_PRESENT_MODE_MAILBOX_KHR:
+                mode_ = Mode::kMailbox;
+                break;
+            default:
+                mode_ = Mode::kImmediate;
+                break;
+        }
+        if (mode_ != Mode::kImmediate) thread_ = std::thread(&Swapchain::Run, this);
+    }
+    Swapchain(const Swapchain &) = delete;
+    Swapchain &operator=(const Swapchain &) = delete;
+    ~Swapchain() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        if (thread_.joinable()) thread_.join();
+    }
+
+    const std::vector<VkImage> &Images() const { return images_; }
+
+    // Waits up to timeout_ns for an image the presentation engine has released, returning VK_NOT_READY or VK_TIMEOUT if there
+    // isn't one in time. Once the swapchain is retired, returns VK_ERROR_OUT_OF_DATE_KHR.
+    VkResult Acquire(uint64_t timeout_ns, uint32_t *image_index) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto ready = [this]() { return !available_.empty() || retired_ || stop_; };
+        if (!ready()) {
+            if (timeout_ns == 0) return VK_NOT_READY;
+            if (timeout_ns >= kInfiniteTimeout) {
+                cv_.wait(lock, ready);
+            } else if (!cv_.wait_for(lock, std::chrono::nanoseconds(timeout_ns), ready)) {
+                return VK_TIMEOUT;
+            }
+        }
+        if (retired_ || stop_) return VK_ERROR_OUT_OF_DATE_KHR;
+        *image_index = available_.front();
+        available_.pop_front();
+        return VK_SUCCESS;
+    }
+
+    // Hands an acquired image to the presentation engine
+    void Present(uint32_t image_index) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (mode_ == Mode::kImmediate) {
+                Show(image_index);
+            } else {
+                if (mode_ == Mode::kMailbox) {
+                    // The new image replaces any still waiting for a refresh, which go straight back to the app
+                    available_.insert(available_.end(), queued_.begin(), queued_.end());
+                    queued_.clear();
+                }
+                queued_.push_back(image_index);
+            }
+        }
+        cv_.notify_all();
+    }
+
+    // Called when the swapchain is passed as oldSwapchain. Acquired images can still be presented, but no more can be acquired.
+    void Retire() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            retired_ = true;
+        }
+        cv_.notify_all();
+    }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+    enum class Mode { kImmediate, kFifo, kFifoRelaxed, kMailbox };
+
+    static constexpr uint32_t kNoImage = UINT32_MAX;
+    // Like Vulkan timeouts, UINT64_MAX (and anything close to it) waits forever. Longer timeouts would overflow the clock.
+    static constexpr uint64_t kInfiniteTimeout = 1ull << 62;
+
+    // Puts an image on screen, releasing the one it replaces. With a single image, as shared present modes have, the app
+    // draws to the image on screen. Call with mutex_ held.
+    void Show(uint32_t image_index) {
+        if (displayed_ != kNoImage) available_.push_back(displayed_);
+        displayed_ = image_index;
+        if (images_.size() == 1) {
+            available_.push_back(displayed_);
+            displayed_ = kNoImage;
+        }
+    }
+
+    // When the next queued image goes on screen: at the next refresh, or for FIFO_RELAXED right away if the image missed the
+    // last refresh
+    Clock::time_point NextFlipTime(Clock::time_point now) const {
+        if (refresh_period_ == Clock::duration::zero()) return now;
+        const auto last_refresh = epoch_ + ((now - epoch_) / refresh_period_) * refresh_period_;
+        if (mode_ == Mode::kFifoRelaxed && last_flip_ < last_refresh) return now;
+        return last_refresh + refresh_period_;
+    }
+
+    // Shows queued images as refreshes come around
+    void Run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stop_) {
+            if (queued_.empty()) {
+                cv_.wait(lock);
+                continue;
+            }
+            const auto flip_time = NextFlipTime(Clock::now());
+            cv_.wait_until(lock, flip_time, [this]() { return stop_; });
+            if (stop_) break;
+            // MAILBOX only ever has one image queued
+            Show(queued_.front());
+            queued_.pop_front();
+            last_flip_ = flip_time;
+            lock.unlock();
+            cv_.notify_all();
+            lock.lock();
+        }
+    }
+
+    const std::vector<VkImage> images_;
+    Mode mode_;
+    Clock::duration refresh_period_ = Clock::duration::zero();
+    const Clock::time_point epoch_;  // Refreshes happen at whole refresh periods from here
+    Clock::time_point last_flip_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;  // Signals acquirers when images are released and the thread when images are queued
+    std::deque<uint32_t> available_;  // Released images, longest released first
+    std::deque<uint32_t> queued_;     // Presented images waiting to go on screen
+    uint32_t displayed_ = kNoImage;
+    bool retired_ = false;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+}  // namespace vkmock
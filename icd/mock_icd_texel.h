@@ -0,0 +1,491 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+#include "mock_icd_transfer.h"
+
+namespace vkmock {
+
+// How a format stores each of its channels
+enum class TexelType : uint8_t {
+    Unorm8,
+    Srgb8,  // Unorm8 with the sRGB transfer function on R, G and B
+    Unorm16,
+    Float16,
+    Float32,
+    Unorm2101010,  // A2B10G10R10_UNORM_PACK32: 10 bits each of R, G and B from bit 0, then 2 bits of A
+    Uint8,
+    Sint8,
+    Uint32,
+    Sint32,
+};
+
+// A color format the mock ICD can convert texels of, for clears and blits
+struct TexelFormat {
+    VkFormat format;
+    uint8_t size;  // Bytes per texel
+    TexelType type;
+    uint8_t channel_count;
+    uint8_t swizzle[4];  // The stored channel each of R, G, B and A is, or kNoChannel
+
+    bool Integer() const { return type >= TexelType::Uint8; }
+};
+
+static constexpr uint8_t kNoChannel = 0xFF;
+
+// Formats other than these are still copied, since copies only move texel blocks, but aren't cleared or blitted
+static const TexelFormat kTexelFormats[] = {
+    {VK_FORMAT_R8_UNORM, 1, TexelType::Unorm8, 1, {0, kNoChannel, kNoChannel, kNoChannel}},
+    {VK_FORMAT_R8G8_UNORM, 2, TexelType::Unorm8, 2, {0, 1, kNoChannel, kNoChannel}},
+    {VK_FORMAT_R8G8B8A8_UNORM, 4, TexelType::Unorm8, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_R8G8B8A8_SRGB, 4, TexelType::Srgb8, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_B8G8R8A8_UNORM, 4, TexelType::Unorm8, 4, {2, 1, 0, 3}},
+    {VK_FORMAT_B8G8R8A8_SRGB, 4, TexelType::Srgb8, 4, {2, 1, 0, 3}},
+    {VK_FORMAT_A8B8G8R8_UNORM_PACK32, 4, TexelType::Unorm8, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_A8B8G8R8_SRGB_PACK32, 4, TexelType::Srgb8, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_A2B10G10R10_UNORM_PACK32, 4, TexelType::Unorm2101010, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_R16G16B16A16_UNORM, 8, TexelType::Unorm16, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_R16_SFLOAT, 2, TexelType::Float16, 1, {0, kNoChannel, kNoChannel, kNoChannel}},
+    {VK_FORMAT_R16G16_SFLOAT, 4, TexelType::Float16, 2, {0, 1, kNoChannel, kNoChannel}},
+    {VK_FORMAT_R16G16B16A16_SFLOAT, 8, TexelType::Float16, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_R32_SFLOAT, 4, TexelType::Float32, 1, {0, kNoChannel, kNoChannel, kNoChannel}},
+    {VK_FORMAT_R32G32_SFLOAT, 8, TexelType::Float32, 2, {0, 1, kNoChannel, kNoChannel}},
+    {VK_FORMAT_R32G32B32A32_SFLOAT, 16, TexelType::Float32, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_R8G8B8A8_UINT, 4, TexelType::Uint8, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_R8G8B8A8_SINT, 4, TexelType::Sint8, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_R32_UINT, 4, TexelType::Uint32, 1, {0, kNoChannel, kNoChannel, kNoChannel}},
+    {VK_FORMAT_R32_SINT, 4, TexelType::Sint32, 1, {0, kNoChannel, kNoChannel, kNoChannel}},
+    {VK_FORMAT_R32G32B32A32_UINT, 16, TexelType::Uint32, 4, {0, 1, 2, 3}},
+    {VK_FORMAT_R32G32B32A32_SINT, 16, TexelType::Sint32, 4, {0, 1, 2, 3}},
+};
+
+// Returns nullptr for formats texels can't be converted to or from
+static const TexelFormat *GetTexelFormat(VkFormat format) {
+    for (const auto &texel_format : kTexelFormats) {
+        if (texel_format.format == format) return &texel_format;
+    }
+    return nullptr;
+}
+
+static float HalfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1F;
+    const uint32_t mantissa = half & 0x3FF;
+    if (exponent == 0) {
+        const float value = mantissa * (1.0f / 16777216.0f);
+        return sign ? -value : value;
+    }
+    const uint32_t bits = sign | (exponent == 31 ? 0x7F800000 | (mantissa << 13) : ((exponent + 112) << 23) | (mantissa << 13));
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Rounds to nearest even, as GPUs do when writing half floats
+static uint16_t FloatToHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const uint32_t magnitude = bits & 0x7FFFFFFF;
+    if (magnitude > 0x7F800000) return static_cast<uint16_t>(sign | 0x7E00);  // NaN
+    // 65520 and up round to infinity
+    if (magnitude >= 0x477FF000) return static_cast<uint16_t>(sign | 0x7C00);
+    uint32_t half;
+    uint32_t remainder;
+    uint32_t halfway;
+    if (magnitude < 0x38800000) {
+        // Denormal in half precision
+        const uint32_t shift = 126 - (magnitude >> 23);
+        if (shift > 24) return static_cast<uint16_t>(sign);
+        const uint32_t mantissa = (magnitude & 0x7FFFFF) | 0x800000;
+        half = mantissa >> shift;
+        remainder = mantissa & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    } else {
+        half = (magnitude - 0x38000000) >> 13;
+        remainder = magnitude & 0x1FFF;
+        halfway = 0x1000;
+    }
+    // A carry out of the mantissa correctly bumps the exponent
+    if (remainder > halfway || (remainder == halfway && (half & 1))) ++half;
+    return static_cast<uint16_t>(sign | half);
+}
+
+static float SrgbToLinear(uint8_t value) {
+    static const std::vector<float> table = []() {
+        std::vector<float> values(256);
+        for (int i = 0; i < 256; ++i) {
+            const float c = i / 255.0f;
+            values[i] = c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table[value];
+}
+
+static float LinearToSrgb(float value) {
+    return value <= 0.0031308f ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+}
+
+static uint32_t EncodeUnorm(float value, uint32_t max) {
+    // Also sends NaN to 0
+    const float clamped = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+    return static_cast<uint32_t>(clamped * max + 0.5f);
+}
+
+// Reads a texel of a non-integer format as RGBA. Missing channels read as 0, and missing alpha as 1.
+static void DecodeTexel(const TexelFormat &format, const uint8_t *texel, float rgba[4]) {
+    float channels[4];
+    switch (format.type) {
+        case TexelType::Unorm8:
+            for (uint32_t i = 0; i < format.channel_count; ++i) channels[i] = texel[i] * (1.0f / 255.0f);
+            break;
+        case TexelType::Srgb8:
+            for (uint32_t i = 0; i < format.channel_count; ++i) channels[i] = SrgbToLinear(texel[i]);
+            // Alpha is always linear
+            channels[format.swizzle[3]] = texel[format.swizzle[3]] * (1.0f / 255.0f);
+            break;
+        case TexelType::Unorm16:
+            for (uint32_t i = 0; i < format.channel_count; ++i) {
+                uint16_t value;
+                memcpy(&value, texel + 2 * i, sizeof(value));
+                channels[i] = value * (1.0f / 65535.0f);
+            }
+            break;
+        case TexelType::Float16:
+            for (uint32_t i = 0; i < format.channel_count; ++i) {
+                uint16_t value;
+                memcpy(&value, texel + 2 * i, sizeof(value));
+                channels[i] = HalfToFloat(value);
+            }
+            break;
+        case TexelType::Float32:
+            memcpy(channels, texel, 4 * format.channel_count);
+            break;
+        case TexelType::Unorm2101010: {
+            uint32_t value;
+            memcpy(&value, texel, sizeof(value));
+            for (uint32_t i = 0; i < 3; ++i) channels[i] = ((value >> (10 * i)) & 0x3FF) * (1.0f / 1023.0f);
+            channels[3] = (value >> 30) * (1.0f / 3.0f);
+            break;
+        }
+        default:
+            for (uint32_t i = 0; i < format.channel_count; ++i) channels[i] = 0.0f;
+            break;
+    }
+    for (uint32_t i = 0; i < 4; ++i) rgba[i] = format.swizzle[i] != kNoChannel ? channels[format.swizzle[i]] : (i == 3 ? 1.0f : 0.0f);
+}
+
+// Writes RGBA as a texel of a non-integer format
+static void EncodeTexel(const TexelFormat &format, const float rgba[4], uint8_t *texel) {
+    float channels[4];
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (format.swizzle[i] != kNoChannel) channels[format.swizzle[i]] = rgba[i];
+    }
+    switch (format.type) {
+        case TexelType::Unorm8:
+            for (uint32_t i = 0; i < format.channel_count; ++i) texel[i] = static_cast<uint8_t>(EncodeUnorm(channels[i], 255));
+            break;
+        case TexelType::Srgb8:
+            for (uint32_t i = 0; i < format.channel_count; ++i) {
+                const bool alpha = i == format.swizzle[3];
+                texel[i] = static_cast<uint8_t>(EncodeUnorm(alpha ? channels[i] : LinearToSrgb(channels[i]), 255));
+            }
+            break;
+        case TexelType::Unorm16:
+            for (uint32_t i = 0; i < format.channel_count; ++i) {
+                const uint16_t value = static_cast<uint16_t>(EncodeUnorm(channels[i], 65535));
+                memcpy(texel + 2 * i, &value, sizeof(value));
+            }
+            break;
+        case TexelType::Float16:
+            for (uint32_t i = 0; i < format.channel_count; ++i) {
+                const uint16_t value = FloatToHalf(channels[i]);
+                memcpy(texel + 2 * i, &value, sizeof(value));
+            }
+            break;
+        case TexelType::Float32:
+            memcpy(texel, channels, 4 * format.channel_count);
+            break;
+        case TexelType::Unorm2101010: {
+            uint32_t value = EncodeUnorm(channels[3], 3) << 30;
+            for (uint32_t i = 0; i < 3; ++i) value |= EncodeUnorm(channels[i], 1023) << (10 * i);
+            memcpy(texel, &value, sizeof(value));
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// Packs a vkCmdClearColorImage color as a texel. Integer formats take the color's integer values, truncated to their
+// channels, and other formats its float values.
+static void PackClearColor(const TexelFormat &format, const VkClearColorValue &color, uint8_t *texel) {
+    if (!format.Integer()) {
+        EncodeTexel(format, color.float32, texel);
+        return;
+    }
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (format.swizzle[i] == kNoChannel) continue;
+        const uint32_t channel = format.swizzle[i];
+        if (format.type == TexelType::Uint8 || format.type == TexelType::Sint8) {
+            texel[channel] = static_cast<uint8_t>(color.uint32[i]);
+        } else {
+            memcpy(texel + 4 * channel, &color.uint32[i], sizeof(uint32_t));
+        }
+    }
+}
+
+// Writes count copies of a texel of texel_size bytes
+static void FillTexels(uint8_t *dst, const uint8_t *texel, uint32_t texel_size, size_t count) {
+    const size_t size = count * texel_size;
+    if (texel_size <= 4 && 4 % texel_size == 0) {
+        uint8_t pattern[4];
+        for (uint32_t i = 0; i < 4; ++i) pattern[i] = texel[i % texel_size];
+        uint32_t value;
+        memcpy(&value, pattern, sizeof(value));
+        FillMemory(dst, value, size);
+        return;
+    }
+    if (!count) return;
+    // Double up what's written so far until it's all filled
+    memcpy(dst, texel, texel_size);
+    for (size_t written = texel_size; written < size;) {
+        const size_t copy_size = (std::min)(written, size - written);
+        memcpy(dst + written, dst, copy_size);
+        written += copy_size;
+    }
+}
+
+// Where one texel along an axis of a blit's destination samples its source: texels i0 and i1, with weight on i1
+struct BlitSample {
+    uint32_t i0;
+    uint32_t i1;
+    float weight;
+};
+
+// Sampling along one axis of a vkCmdBlitImage region, for each destination texel from the lower of dst0 and dst1 on. Source
+// coordinates are clamped to the source mip level, as with VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE.
+static std::vector<BlitSample> GetBlitSamples(int32_t src0, int32_t src1, int32_t dst0, int32_t dst1, uint32_t src_size,
+                                              bool linear) {
+    std::vector<BlitSample> samples;
+    if (dst0 == dst1 || !src_size) return samples;
+    const double scale = static_cast<double>(src1 - src0) / (dst1 - dst0);
+    const int32_t max_index = static_cast<int32_t>(src_size) - 1;
+    for (int32_t dst = (std::min)(dst0, dst1); dst < (std::max)(dst0, dst1); ++dst) {
+        const double coordinate = src0 + (dst + 0.5 - dst0) * scale;
+        BlitSample sample = {};
+        if (linear) {
+            const double texel = coordinate - 0.5;
+            const double base = floor(texel);
+            const int32_t i0 = static_cast<int32_t>(base);
+            sample.i0 = static_cast<uint32_t>((std::max)(0, (std::min)(i0, max_index)));
+            sample.i1 = static_cast<uint32_t>((std::max)(0, (std::min)(i0 + 1, max_index)));
+            sample.weight = static_cast<float>(texel - base);
+        } else {
+            const int32_t i0 = static_cast<int32_t>(floor(coordinate));
+            sample.i0 = sample.i1 = static_cast<uint32_t>((std::max)(0, (std::min)(i0, max_index)));
+        }
+        samples.push_back(sample);
+    }
+    return samples;
+}
+
+// Every destination texel takes the source texel one along from the last, as when a blit doesn't scale or flip
+static bool IsUnitStep(const std::vector<BlitSample> &samples) {
+    for (size_t i = 0; i < samples.size(); ++i) {
+        if (samples[i].i0 != samples[0].i0 + i || samples[i].weight != 0.0f) return false;
+    }
+    return true;
+}
+
+// Every destination texel averages the next two source texels, as in a linear blit to the next mip level
+static bool IsHalvingStep(const std::vector<BlitSample> &samples) {
+    for (size_t i = 0; i < samples.size(); ++i) {
+        if (samples[i].i0 != samples[0].i0 + 2 * i || samples[i].i1 != samples[i].i0 + 1 || samples[i].weight != 0.5f) return false;
+    }
+    return true;
+}
+
+// Box filters two rows of 4 byte texels with 8 bit unorm channels down to one half as wide, rounding to nearest
+static void DownsampleRowUnorm8x4(const uint8_t *row0, const uint8_t *row1, uint8_t *dst, uint32_t width) {
+    uint32_t x = 0;
+#if defined(VKMOCK_TRANSFER_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(2);
+    for (; x + 4 <= width; x += 4, row0 += 32, row1 += 32, dst += 16) {
+        const __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0));
+        const __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + 16));
+        const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1));
+        const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + 16));
+        // Sums of the two rows, two texels of 16 bit channels to a register
+        const __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+        const __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+        const __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+        const __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+        // Then the sums of neighboring texels
+        __m128i d0 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+        __m128i d1 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+        d0 = _mm_srli_epi16(_mm_add_epi16(d0, round), 2);
+        d1 = _mm_srli_epi16(_mm_add_epi16(d1, round), 2);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(d0, d1));
+    }
+#endif
+    for (; x < width; ++x, row0 += 8, row1 += 8, dst += 4) {
+        for (uint32_t c = 0; c < 4; ++c) dst[c] = static_cast<uint8_t>((row0[c] + row0[c + 4] + row1[c] + row1[c + 4] + 2) >> 2);
+    }
+}
+
+// Box filters two rows of 32 bit floats down to one half as wide
+static void DownsampleRowFloat32(const uint8_t *row0, const uint8_t *row1, uint8_t *dst, uint32_t width) {
+    uint32_t x = 0;
+#if defined(VKMOCK_TRANSFER_SSE2)
+    const __m128 quarter = _mm_set1_ps(0.25f);
+    for (; x + 4 <= width; x += 4, row0 += 32, row1 += 32, dst += 16) {
+        const __m128 s0 = _mm_add_ps(_mm_loadu_ps(reinterpret_cast<const float *>(row0)),
+                                     _mm_loadu_ps(reinterpret_cast<const float *>(row1)));
+        const __m128 s1 = _mm_add_ps(_mm_loadu_ps(reinterpret_cast<const float *>(row0 + 16)),
+                                     _mm_loadu_ps(reinterpret_cast<const float *>(row1 + 16)));
+        const __m128 even = _mm_shuffle_ps(s0, s1, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 odd = _mm_shuffle_ps(s0, s1, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm_storeu_ps(reinterpret_cast<float *>(dst), _mm_mul_ps(_mm_add_ps(even, odd), quarter));
+    }
+#endif
+    for (; x < width; ++x, row0 += 8, row1 += 8, dst += 4) {
+        float a[2], b[2];
+        memcpy(a, row0, sizeof(a));
+        memcpy(b, row1, sizeof(b));
+        // Same order of operations as the vector loop
+        const float value = ((a[0] + b[0]) + (a[1] + b[1])) * 0.25f;
+        memcpy(dst, &value, sizeof(value));
+    }
+}
+
+// Copies a row of 4 byte texels with 8 bit channels, swapping the first and third channels, as between RGBA8 and BGRA8
+static void SwapRedBlueRow(const uint8_t *src, uint8_t *dst, uint32_t width) {
+    uint32_t x = 0;
+#if defined(VKMOCK_TRANSFER_SSE2)
+    const __m128i green_alpha = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+    for (; x + 4 <= width; x += 4, src += 16, dst += 16) {
+        const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i red_blue = _mm_andnot_si128(green_alpha, texels);
+        const __m128i swapped = _mm_or_si128(_mm_slli_epi32(red_blue, 16), _mm_srli_epi32(red_blue, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_or_si128(_mm_and_si128(texels, green_alpha), swapped));
+    }
+#endif
+    for (; x < width; ++x, src += 4, dst += 4) {
+        const uint8_t texel[4] = {src[2], src[1], src[0], src[3]};
+        memcpy(dst, texel, sizeof(texel));
+    }
+}
+
+// 8 bit unorm formats whose texels only differ in the order of R and B
+static bool IsRedBlueSwap(const TexelFormat &src, const TexelFormat &dst) {
+    if (src.size != 4 || dst.size != 4 || src.type != dst.type) return false;
+    if (src.type != TexelType::Unorm8 && src.type != TexelType::Srgb8) return false;
+    return src.swizzle[0] == dst.swizzle[2] && src.swizzle[2] == dst.swizzle[0] && src.swizzle[1] == dst.swizzle[1] &&
+           src.swizzle[3] == dst.swizzle[3];
+}
+
+// One depth slice of a vkCmdBlitImage source: its texels and row pitch
+struct BlitSource {
+    const uint8_t *data;
+    size_t row_pitch;
+};
+
+// Writes one depth slice of a blit's destination region, row by row, from the one or two source slices z_weight blends.
+// dst is the first texel of the region in the slice. Integer formats are only ever blitted to the same format, with
+// nearest filtering, which copies texels as they are.
+static void BlitSlice(TransferThreadPool *pool, const TexelFormat &src_format, const BlitSource src[2], float z_weight,
+                      const TexelFormat &dst_format, uint8_t *dst, size_t dst_row_pitch, const std::vector<BlitSample> &x_samples,
+                      const std::vector<BlitSample> &y_samples, bool linear) {
+    const uint32_t width = static_cast<uint32_t>(x_samples.size());
+    const uint32_t src_size = src_format.size;
+    const uint32_t dst_size = dst_format.size;
+    const bool same_format = src_format.format == dst_format.format;
+    const bool unit_step = z_weight == 0.0f && IsUnitStep(x_samples) && IsUnitStep(y_samples);
+    const bool halving = linear && z_weight == 0.0f && same_format && IsHalvingStep(x_samples) && IsHalvingStep(y_samples);
+    ParallelRows(pool, y_samples.size(), width * dst_size, [&](size_t y) {
+        const BlitSample &y_sample = y_samples[y];
+        uint8_t *dst_row = dst + y * dst_row_pitch;
+        const uint8_t *rows[2][2] = {{src[0].data + y_sample.i0 * src[0].row_pitch, src[0].data + y_sample.i1 * src[0].row_pitch},
+                                     {src[1].data + y_sample.i0 * src[1].row_pitch, src[1].data + y_sample.i1 * src[1].row_pitch}};
+        if (unit_step && same_format) {
+            memcpy(dst_row, rows[0][0] + x_samples[0].i0 * src_size, width * dst_size);
+            return;
+        }
+        if (unit_step && IsRedBlueSwap(src_format, dst_format)) {
+            SwapRedBlueRow(rows[0][0] + x_samples[0].i0 * src_size, dst_row, width);
+            return;
+        }
+        if (halving && src_size == 4 && src_format.type == TexelType::Unorm8) {
+            DownsampleRowUnorm8x4(rows[0][0] + x_samples[0].i0 * 4, rows[0][1] + x_samples[0].i0 * 4, dst_row, width);
+            return;
+        }
+        if (halving && src_format.format == VK_FORMAT_R32_SFLOAT) {
+            DownsampleRowFloat32(rows[0][0] + x_samples[0].i0 * 4, rows[0][1] + x_samples[0].i0 * 4, dst_row, width);
+            return;
+        }
+        if (!linear || src_format.Integer()) {
+            // Nearest filtering picks the source slice, so it's always the first
+            const uint8_t *row = rows[0][0];
+            for (uint32_t x = 0; x < width; ++x) {
+                const uint8_t *texel = row + x_samples[x].i0 * src_size;
+                if (same_format) {
+                    memcpy(dst_row + x * dst_size, texel, dst_size);
+                } else {
+                    float rgba[4];
+                    DecodeTexel(src_format, texel, rgba);
+                    EncodeTexel(dst_format, rgba, dst_row + x * dst_size);
+                }
+            }
+            return;
+        }
+        const float z_weights[2] = {1.0f - z_weight, z_weight};
+        const float y_weights[2] = {1.0f - y_sample.weight, y_sample.weight};
+        for (uint32_t x = 0; x < width; ++x) {
+            const BlitSample &x_sample = x_samples[x];
+            const float x_weights[2] = {1.0f - x_sample.weight, x_sample.weight};
+            const uint32_t columns[2] = {x_sample.i0 * src_size, x_sample.i1 * src_size};
+            float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (uint32_t z = 0; z < 2; ++z) {
+                for (uint32_t row = 0; row < 2; ++row) {
+                    for (uint32_t column = 0; column < 2; ++column) {
+                        const float weight = z_weights[z] * y_weights[row] * x_weights[column];
+                        if (weight == 0.0f) continue;
+                        float rgba[4];
+                        DecodeTexel(src_format, rows[z][row] + columns[column], rgba);
+                        for (uint32_t c = 0; c < 4; ++c) sum[c] += weight * rgba[c];
+                    }
+                }
+            }
+            EncodeTexel(dst_format, sum, dst_row + x * dst_size);
+        }
+    });
+}
+
+}  // namespace vkmock
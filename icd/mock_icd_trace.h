@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "vulkan/vulkan.h"
+#include "mock_icd_config.h"
+#include "mock_icd_proc_table.h"
+
+namespace vkmock {
+
+// With VKMOCK_TRACE set, every call the app makes into the mock ICD is recorded in a binary trace file, which stays mapped
+// into memory for the life of the process. The file is a ring of fixed-size slots. Each thread appends records to a chunk
+// of its own without taking any lock, and takes the next chunk when it fills, so once the ring wraps around the oldest
+// chunks are overwritten and the file holds the most recent calls. A chunk is one slot, or a run of slots sized to fit a
+// record too big for one, such as a large SPIR-V module. mock_icd_generator.py generates an entry point for each API that
+// makes the call and records it, see TracedCreateInstance() etc. at the end of mock_icd.cpp. vktracereplay makes the calls
+// again from the file.
+
+static constexpr uint64_t kTraceMagic = 0x52544b434f4d4b56ull;  // "VKMOCKTR"
+static constexpr uint32_t kTraceVersion = 3;
+static constexpr uint32_t kTraceChunkSize = 64 * 1024;
+static constexpr uint64_t kDefaultTraceSize = 64 * 1024 * 1024;
+// Most slots a chunk can take, so the bytes it holds fit TraceChunkHeader::used
+static constexpr uint32_t kTraceMaxChunkSlots = 65536;
+// Count or length standing for a null pointer
+static constexpr uint32_t kTraceNull = UINT32_MAX;
+
+// Start of the file
+struct TraceFileHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t chunk_size;  // Bytes per slot, including the TraceChunkHeader of a chunk starting there
+    uint64_t chunks_offset;
+    uint32_t chunk_count;  // Slots in the ring
+    uint32_t entry_point_count;
+    uint64_t entry_points_offset;       // Names of the entry points a record can be of, each null-terminated, in id order
+    std::atomic<uint64_t> next_chunk;   // How many slots have been taken. The nth one taken is slot n % chunk_count.
+    std::atomic<uint64_t> next_thread;  // How many threads have recorded calls
+    std::atomic<uint64_t> dropped_records;  // Records lost because every chunk was in use
+};
+
+struct TraceChunkHeader {
+    uint64_t sequence;   // Which slot taken the chunk starts at, so readers can put chunks in order
+    uint64_t thread_id;  // Thread the records are from, counting from 1
+    std::atomic<uint32_t> used;  // Bytes of complete records after the header
+    uint32_t slots;              // Slots the chunk takes. Readers skip the ones after the first, which hold its records.
+};
+
+// Records follow each other in a chunk without padding, so readers must copy fields out rather than cast
+struct TraceRecordHeader {
+    uint32_t size;  // Including the header
+    uint16_t entry_point;
+    uint16_t flags;
+    uint64_t timestamp_ns;  // When the call was made, by the steady clock
+};
+
+// The record's arguments were left out because they don't fit in the ring, or no run of slots they'd fit in was free
+static constexpr uint16_t kTraceRecordTruncated = 0x1;
+
+// A record's header is followed by the call's arguments in order, then its return value if it has one. Each starts with a
+// byte giving how it's encoded. Outputs are recorded as the call left them. Structs are recorded as their bytes, and for the
+// structs TraceMembers knows, so is what their pointers point to, so pointers inside other structs are addresses the trace
+// doesn't follow.
+enum class TraceArg : uint8_t {
+    Value,        // uint32_t size, then the value's bytes
+    Handle,       // uint64_t handle
+    String,       // uint32_t length or kTraceNull, then the characters without the terminating null
+    Array,        // uint32_t count or kTraceNull, uint32_t element size, then the elements
+    StructArray,  // As Array, followed for each element by its pNext chain: a uint32_t count of the structs in it, then for
+                  // each a uint32_t sType, uint32_t size and the struct's bytes, where the size is 0 for sTypes the mock ICD
+                  // doesn't know. Then a uint32_t count of arguments recording the element's members, and those arguments.
+    HandleArray,  // uint32_t count or kTraceNull, then a uint64_t for each handle
+    Bytes,        // uint32_t size or kTraceNull, then the bytes
+    Address,      // uint64_t pointer, for data the trace can't know the size of
+    StringArray,  // uint32_t count or kTraceNull, then each string as String encodes it, without the leading byte
+};
+
+// Size of the struct with the given sType, or 0 if it's not one the mock ICD knows. Generated at the end of mock_icd.cpp.
+static uint32_t TraceStructSize(VkStructureType sType);
+
+static uint64_t TraceTimestamp() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+class TraceFile {
+  public:
+    // Creates the file VKMOCK_TRACE names, of about VKMOCK_TRACE_SIZE bytes, for records of the given entry points. Returns
+    // nullptr if tracing is off or the file can't be created.
+    static TraceFile *Open(const ProcEntry *entry_points, size_t entry_point_count) {
+        const char *path = GetConfigString("VKMOCK_TRACE");
+        if (!path) return nullptr;
+        uint64_t size = kDefaultTraceSize;
+        const char *size_text = GetConfigString("VKMOCK_TRACE_SIZE");
+        if (size_text && !ParseConfigSize(size_text, &size)) {
+            fprintf(stderr, "vkmock: VKMOCK_TRACE_SIZE: bad size \"%s\"\n", size_text);
+            size = kDefaultTraceSize;
+        }
+
+        size_t names_size = 0;
+        for (size_t i = 0; i < entry_point_count; ++i) names_size += strlen(entry_points[i].name) + 1;
+        const uint64_t header_size = sizeof(TraceFileHeader) + names_size;
+        const uint64_t chunks_offset = (header_size + kTraceChunkSize - 1) / kTraceChunkSize * kTraceChunkSize;
+        const uint64_t chunk_count = size > chunks_offset + kTraceChunkSize ? (size - chunks_offset) / kTraceChunkSize : 1;
+        if (chunk_count > UINT32_MAX || chunks_offset + chunk_count * kTraceChunkSize > SIZE_MAX) {
+            fprintf(stderr, "vkmock: VKMOCK_TRACE_SIZE: %s is too big\n", size_text);
+            return nullptr;
+        }
+        size = chunks_offset + chunk_count * kTraceChunkSize;
+        void *mapping = MapFile(path, size);
+        if (!mapping) {
+            fprintf(stderr, "vkmock: VKMOCK_TRACE: can't create trace file \"%s\"\n", path);
+            return nullptr;
+        }
+
+        // The mapping starts out zeroed, so only the header needs setting
+        TraceFileHeader *header = new (mapping) TraceFileHeader();
+        header->magic = kTraceMagic;
+        header->version = kTraceVersion;
+        header->chunk_size = kTraceChunkSize;
+        header->chunks_offset = chunks_offset;
+        header->chunk_count = static_cast<uint32_t>(chunk_count);
+        header->entry_point_count = static_cast<uint32_t>(entry_point_count);
+        header->entry_points_offset = sizeof(TraceFileHeader);
+        char *names = static_cast<char *>(mapping) + header->entry_points_offset;
+        for (size_t i = 0; i < entry_point_count; ++i) {
+            const size_t length = strlen(entry_points[i].name) + 1;
+            memcpy(names, entry_points[i].name, length);
+            names += length;
+        }
+        uint8_t *chunks = static_cast<uint8_t *>(mapping) + chunks_offset;
+        for (uint64_t i = 0; i < chunk_count; ++i) new (chunks + i * kTraceChunkSize) TraceChunkHeader();
+        return new TraceFile(header, chunks);
+    }
+
+    uint64_t NewThreadId() { return header_->next_thread.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+    // Takes the next run of slots in the ring that no other thread is appending to, as one chunk. Returns nullptr if every
+    // such run is in use, or the ring is too small for it.
+    TraceChunkHeader *TakeChunk(uint64_t thread_id, uint32_t slots = 1) {
+        const uint32_t slot_count = header_->chunk_count;
+        if (slots > slot_count) return nullptr;
+        for (uint32_t attempt = 0; attempt < slot_count; ++attempt) {
+            const uint64_t sequence = header_->next_chunk.fetch_add(slots, std::memory_order_relaxed);
+            const uint32_t first = static_cast<uint32_t>(sequence % slot_count);
+            // A chunk's slots are contiguous, so a run that would wrap around the end of the ring is skipped
+            if (first + slots > slot_count) continue;
+            uint32_t taken = 0;
+            while (taken < slots && !writing_[first + taken].exchange(1, std::memory_order_acquire)) ++taken;
+            if (taken < slots) {
+                for (uint32_t i = 0; i < taken; ++i) writing_[first + i].store(0, std::memory_order_release);
+                continue;
+            }
+            TraceChunkHeader *chunk = reinterpret_cast<TraceChunkHeader *>(chunks_ + uint64_t(first) * kTraceChunkSize);
+            chunk->used.store(0, std::memory_order_relaxed);
+            chunk->sequence = sequence;
+            chunk->thread_id = thread_id;
+            chunk->slots = slots;
+            return chunk;
+        }
+        return nullptr;
+    }
+
+    void ReleaseChunk(TraceChunkHeader *chunk) {
+        const uint64_t first = static_cast<uint64_t>(reinterpret_cast<uint8_t *>(chunk) - chunks_) / kTraceChunkSize;
+        for (uint32_t i = 0; i < chunk->slots; ++i) writing_[first + i].store(0, std::memory_order_release);
+    }
+
+    static uint8_t *ChunkData(TraceChunkHeader *chunk) { return reinterpret_cast<uint8_t *>(chunk + 1); }
+
+    // Bytes of records a chunk of the given number of slots holds
+    static uint64_t ChunkDataSize(uint32_t slots) { return uint64_t(slots) * kTraceChunkSize - sizeof(TraceChunkHeader); }
+
+    // Slots a chunk needs to hold size bytes of records
+    static uint64_t SlotsFor(uint64_t size) { return (size + sizeof(TraceChunkHeader) + kTraceChunkSize - 1) / kTraceChunkSize; }
+
+    uint32_t SlotCount() const { return header_->chunk_count; }
+
+    void DropRecord() { header_->dropped_records.fetch_add(1, std::memory_order_relaxed); }
+
+  private:
+    TraceFile(TraceFileHeader *header, uint8_t *chunks)
+        : header_(header), chunks_(chunks), writing_(new std::atomic<uint8_t>[header->chunk_count]()) {}
+
+    // Returns a shared, writable mapping of a new file of the given size, or nullptr
+    static void *MapFile(const char *path, uint64_t size) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return nullptr;
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(size >> 32),
+                                            static_cast<DWORD>(size), nullptr);
+        CloseHandle(file);
+        if (!mapping) return nullptr;
+        void *data = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(size));
+        CloseHandle(mapping);
+        return data;
+#else
+        const int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return nullptr;
+        void *data = MAP_FAILED;
+        if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+            data = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        return data == MAP_FAILED ? nullptr : data;
+#endif
+    }
+
+    TraceFileHeader *header_;
+    uint8_t *chunks_;
+    std::unique_ptr<std::atomic<uint8_t>[]> writing_;  // Set for each slot while a thread appends to the chunk holding it
+};
+
+// The chunk a thread is appending records to
+struct TraceThread {
+    TraceFile *file = nullptr;
+    uint64_t id = 0;
+    TraceChunkHeader *chunk = nullptr;
+
+    ~TraceThread() {
+        if (chunk) file->ReleaseChunk(chunk);
+    }
+};
+
+static TraceThread &GetTraceThread(TraceFile *file) {
+    static thread_local TraceThread thread;
+    if (!thread.file) {
+        thread.file = file;
+        thread.id = file->NewThreadId();
+    }
+    return thread;
+}
+
+template <typename T, typename = void>
+struct TraceHasPNext : std::false_type {};
+template <typename T>
+struct TraceHasPNext<T, decltype(void(std::declval<T>().pNext))> : std::true_type {};
+
+class TraceRecord;
+
+// The arguments after each element of a StructArray, recording the handles the struct holds and what its pointers point to,
+// in member order. Specialized by mock_icd_generator.py for the structs in TRACE_FOLLOWED_STRUCTS.
+template <typename T>
+struct TraceMembers {
+    static constexpr uint32_t kCount = 0;
+    static void Record(TraceRecord &, const T &) {}
+};
+
+// Whether a VkWriteDescriptorSet or VkDescriptorSetLayoutBinding of the descriptor type uses each of its arrays. The app can
+// leave the others dangling.
+static inline bool TraceUsesImageInfo(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_SAMPLER || type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER ||
+           type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE || type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE ||
+           type == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+}
+static inline bool TraceUsesBufferInfo(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
+           type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+}
+static inline bool TraceUsesTexelBufferView(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+}
+static inline bool TraceUsesImmutableSamplers(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_SAMPLER || type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+}
+
+static inline uint64_t TraceHandleValue(uint64_t handle) { return handle; }
+template <typename T>
+static inline uint64_t TraceHandleValue(T *handle) {
+    return reinterpret_cast<uintptr_t>(handle);
+}
+
+// Appends one record to the end of the thread's chunk, moving what it has written so far to a new chunk if it runs out of
+// room. Readers only see the record once it's complete, when the TraceRecord is destroyed.
+class TraceRecord {
+  public:
+    TraceRecord(TraceFile *file, uint16_t entry_point, uint64_t timestamp_ns) : thread_(GetTraceThread(file)) {
+        header_.size = 0;
+        header_.entry_point = entry_point;
+        header_.flags = 0;
+        header_.timestamp_ns = timestamp_ns;
+        if (!thread_.chunk) thread_.chunk = file->TakeChunk(thread_.id);
+        if (thread_.chunk) start_ = TraceFile::ChunkData(thread_.chunk) + thread_.chunk->used.load(std::memory_order_relaxed);
+        Reserve(sizeof(TraceRecordHeader));
+    }
+    TraceRecord(const TraceRecord &) = delete;
+    TraceRecord &operator=(const TraceRecord &) = delete;
+
+    ~TraceRecord() {
+        if (!start_) {
+            thread_.file->DropRecord();
+            return;
+        }
+        if (truncated_) {
+            size_ = sizeof(TraceRecordHeader);
+            header_.flags |= kTraceRecordTruncated;
+        }
+        header_.size = size_;
+        memcpy(start_, &header_, sizeof(header_));
+        const uint8_t *data = TraceFile::ChunkData(thread_.chunk);
+        thread_.chunk->used.store(static_cast<uint32_t>(start_ - data) + size_, std::memory_order_release);
+    }
+
+    template <typename T>
+    void Value(const T &value) {
+        uint8_t *bytes = Begin(TraceArg::Value, sizeof(uint32_t) + sizeof(T));
+        if (!bytes) return;
+        bytes = PutUint32(bytes, sizeof(T));
+        memcpy(bytes, &value, sizeof(T));
+    }
+
+    template <typename T>
+    void Handle(T handle) {
+        uint8_t *bytes = Begin(TraceArg::Handle, sizeof(uint64_t));
+        if (bytes) PutUint64(bytes, TraceHandleValue(handle));
+    }
+
+    void String(const char *string) {
+        if (Begin(TraceArg::String, 0)) PutString(string);
+    }
+
+    void Strings(const char *const *strings, uint64_t count) {
+        uint8_t *bytes = Begin(TraceArg::StringArray, sizeof(uint32_t));
+        if (!bytes) return;
+        PutUint32(bytes, strings ? static_cast<uint32_t>(count) : kTraceNull);
+        for (uint64_t i = 0; strings && i < count; ++i) PutString(strings[i]);
+    }
+
+    template <typename T>
+    void Array(const T *elements, uint64_t count) {
+        const uint64_t size = elements ? count * sizeof(T) : 0;
+        const bool structs = TraceHasPNext<T>::value || TraceMembers<T>::kCount > 0;
+        uint8_t *bytes = Begin(structs ? TraceArg::StructArray : TraceArg::Array, 2 * sizeof(uint32_t) + size);
+        if (!bytes) return;
+        bytes = PutUint32(bytes, elements ? static_cast<uint32_t>(count) : kTraceNull);
+        bytes = PutUint32(bytes, sizeof(T));
+        if (!elements) return;
+        memcpy(bytes, elements, static_cast<size_t>(size));
+        for (uint64_t i = 0; structs && i < count; ++i) {
+            Chain(NextOf(elements[i], TraceHasPNext<T>()));
+            bytes = Reserve(sizeof(uint32_t));
+            if (!bytes) return;
+            PutUint32(bytes, TraceMembers<T>::kCount);
+            TraceMembers<T>::Record(*this, elements[i]);
+        }
+    }
+
+    template <typename T>
+    void Handles(const T *handles, uint64_t count) {
+        uint8_t *bytes = Begin(TraceArg::HandleArray, sizeof(uint32_t) + (handles ? count * sizeof(uint64_t) : 0));
+        if (!bytes) return;
+        bytes = PutUint32(bytes, handles ? static_cast<uint32_t>(count) : kTraceNull);
+        for (uint64_t i = 0; handles && i < count; ++i) bytes = PutUint64(bytes, TraceHandleValue(handles[i]));
+    }
+
+    void Bytes(const void *data, uint64_t size) {
+        if (!data) size = 0;
+        uint8_t *bytes = Begin(TraceArg::Bytes, sizeof(uint32_t) + size);
+        if (!bytes) return;
+        bytes = PutUint32(bytes, data ? static_cast<uint32_t>(size) : kTraceNull);
+        if (size) memcpy(bytes, data, static_cast<size_t>(size));
+    }
+
+    void Address(const void *pointer) {
+        uint8_t *bytes = Begin(TraceArg::Address, sizeof(uint64_t));
+        if (bytes) PutUint64(bytes, reinterpret_cast<uintptr_t>(pointer));
+    }
+
+  private:
+    static uint8_t *PutUint32(uint8_t *bytes, uint32_t value) {
+        memcpy(bytes, &value, sizeof(value));
+        return bytes + sizeof(value);
+    }
+
+    static uint8_t *PutUint64(uint8_t *bytes, uint64_t value) {
+        memcpy(bytes, &value, sizeof(value));
+        return bytes + sizeof(value);
+    }
+
+    // Returns where to write size bytes, or nullptr if the record is truncated or has nowhere to go. The bytes must be
+    // written before the next call, which may move the record.
+    uint8_t *Reserve(uint64_t size) {
+        if (!start_ || truncated_) return nullptr;
+        uint8_t *data = TraceFile::ChunkData(thread_.chunk);
+        const uint32_t slots = thread_.chunk->slots;
+        if (static_cast<uint64_t>(start_ - data) + size_ + size > TraceFile::ChunkDataSize(slots)) {
+            // A record too big for one slot moves to a chunk of its own, of at least twice the slots of the one it outgrew
+            // so a growing record is copied only a few times
+            const uint64_t needed = TraceFile::SlotsFor(size_ + size);
+            uint64_t take = needed > 1 && needed < 2ull * slots ? 2ull * slots : needed;
+            if (take > kTraceMaxChunkSlots) take = kTraceMaxChunkSlots;
+            if (take > thread_.file->SlotCount()) take = thread_.file->SlotCount();
+            TraceChunkHeader *next = take < needed ? nullptr : thread_.file->TakeChunk(thread_.id, static_cast<uint32_t>(take));
+            if (!next && needed > 1) {
+                // Keep the record's header where it is and leave out its arguments
+                truncated_ = true;
+                return nullptr;
+            }
+            if (next) memcpy(TraceFile::ChunkData(next), start_, size_);
+            thread_.file->ReleaseChunk(thread_.chunk);
+            thread_.chunk = next;
+            start_ = next ? TraceFile::ChunkData(next) : nullptr;
+            if (!start_) return nullptr;
+        }
+        uint8_t *bytes = start_ + size_;
+        size_ += static_cast<uint32_t>(size);
+        return bytes;
+    }
+
+    uint8_t *Begin(TraceArg kind, uint64_t size) {
+        uint8_t *bytes = Reserve(1 + size);
+        if (bytes) *bytes++ = static_cast<uint8_t>(kind);
+        return bytes;
+    }
+
+    void PutString(const char *string) {
+        const size_t length = string ? strlen(string) : 0;
+        uint8_t *bytes = Reserve(sizeof(uint32_t) + length);
+        if (!bytes) return;
+        bytes = PutUint32(bytes, string ? static_cast<uint32_t>(length) : kTraceNull);
+        if (length) memcpy(bytes, string, length);
+    }
+
+    template <typename T>
+    static const void *NextOf(const T &, std::false_type) {
+        return nullptr;
+    }
+
+    template <typename T>
+    static const void *NextOf(const T &element, std::true_type) {
+        return element.pNext;
+    }
+
+    void Chain(const void *next) {
+        uint32_t count = 0;
+        for (auto link = static_cast<const VkBaseInStructure *>(next); link; link = link->pNext) ++count;
+        uint8_t *bytes = Reserve(sizeof(uint32_t));
+        if (!bytes) return;
+        PutUint32(bytes, count);
+        for (auto link = static_cast<const VkBaseInStructure *>(next); link; link = link->pNext) {
+            const uint32_t size = TraceStructSize(link->sType);
+            bytes = Reserve(2 * sizeof(uint32_t) + size);
+            if (!bytes) return;
+            bytes = PutUint32(bytes, static_cast<uint32_t>(link->sType));
+            bytes = PutUint32(bytes, size);
+            memcpy(bytes, link, size);
+        }
+    }
+
+    TraceThread &thread_;
+    TraceRecordHeader header_;
+    uint8_t *start_ = nullptr;  // Where the record starts in the thread's chunk
+    uint32_t size_ = 0;
+    bool truncated_ = false;
+};
+
+}  // namespace vkmock
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VKMOCK_TRANSFER_SSE2 1
+#endif
+
+namespace vkmock {
+
+// Transfers this big are written with non-temporal stores, which skip the cache: the destination won't fit in it anyway, and
+// reading it in first only to evict it again would halve the bandwidth
+static constexpr size_t kStreamingStoreThreshold = 1024 * 1024;
+// Transfers this big are split across a TransferThreadPool, in chunks of at least kMinTransferChunk
+static constexpr size_t kParallelTransferThreshold = 4 * 1024 * 1024;
+static constexpr size_t kMinTransferChunk = 1024 * 1024;
+
+// Copies size bytes, like memmove. Large copies between regions that don't overlap use non-temporal stores.
+static void CopyMemory(void *dst, const void *src, size_t size) {
+    uint8_t *d = static_cast<uint8_t *>(dst);
+    const uint8_t *s = static_cast<const uint8_t *>(src);
+#if defined(VKMOCK_TRANSFER_SSE2)
+    if (size >= kStreamingStoreThreshold && (d + size <= s || s + size <= d)) {
+        // Stream stores need an aligned destination, while loads can be unaligned
+        const size_t head = (16 - (reinterpret_cast<uintptr_t>(d) & 15)) & 15;
+        memcpy(d, s, head);
+        d += head;
+        s += head;
+        size -= head;
+        for (; size >= 64; size -= 64, d += 64, s += 64) {
+            const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+            const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16));
+            const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 32));
+            const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 48));
+            _mm_stream_si128(reinterpret_cast<__m128i *>(d), v0);
+            _mm_stream_si128(reinterpret_cast<__m128i *>(d + 16), v1);
+            _mm_stream_si128(reinterpret_cast<__m128i *>(d + 32), v2);
+            _mm_stream_si128(reinterpret_cast<__m128i *>(d + 48), v3);
+        }
+        // Orders the streamed stores before whatever signals the copy as done
+        _mm_sfence();
+        memcpy(d, s, size);
+        return;
+    }
+#endif
+    memmove(d, s, size);
+}
+
+// Repeats the 4 bytes of pattern over size bytes, as vkCmdFillBuffer does. dst needn't be aligned, and size needn't be a
+// multiple of 4, but the pattern always starts at dst.
+static void FillMemory(void *dst, uint32_t pattern, size_t size) {
+    uint8_t *d = static_cast<uint8_t *>(dst);
+    uint8_t bytes[4];
+    memcpy(bytes, &pattern, sizeof(bytes));
+    size_t i = 0;
+#if defined(VKMOCK_TRANSFER_SSE2)
+    if (size >= 64) {
+        const size_t head = (16 - (reinterpret_cast<uintptr_t>(d) & 15)) & 15;
+        for (; i < head; ++i) d[i] = bytes[i & 3];
+        // The aligned part starts head bytes into the pattern
+        uint32_t rotated;
+        const uint8_t rotated_bytes[4] = {bytes[head & 3], bytes[(head + 1) & 3], bytes[(head + 2) & 3], bytes[(head + 3) & 3]};
+        memcpy(&rotated, rotated_bytes, sizeof(rotated));
+        const __m128i v = _mm_set1_epi32(static_cast<int>(rotated));
+        const size_t end = head + ((size - head) & ~size_t(63));
+        if (size >= kStreamingStoreThreshold) {
+            for (; i < end; i += 64) {
+                _mm_stream_si128(reinterpret_cast<__m128i *>(d + i), v);
+                _mm_stream_si128(reinterpret_cast<__m128i *>(d + i + 16), v);
+                _mm_stream_si128(reinterpret_cast<__m128i *>(d + i + 32), v);
+                _mm_stream_si128(reinterpret_cast<__m128i *>(d + i + 48), v);
+            }
+            _mm_sfence();
+        } else {
+            for (; i < end; i += 64) {
+                _mm_store_si128(reinterpret_cast<__m128i *>(d + i), v);
+                _mm_store_si128(reinterpret_cast<__m128i *>(d + i + 16), v);
+                _mm_store_si128(reinterpret_cast<__m128i *>(d + i + 32), v);
+                _mm_store_si128(reinterpret_cast<__m128i *>(d + i + 48), v);
+            }
+        }
+    }
+#endif
+    if (bytes[0] == bytes[1] && bytes[0] == bytes[2] && bytes[0] == bytes[3]) {
+        memset(d + i, bytes[0], size - i);
+        return;
+    }
+    for (; i < size; ++i) d[i] = bytes[i & 3];
+}
+
+// Helper threads that split big transfers with the queue thread executing them. Threads are only started for the first
+// transfer big enough to need them. Only one transfer uses the pool at a time: a queue thread that finds it busy does its
+// transfer alone rather than wait.
+class TransferThreadPool {
+  public:
+    // thread_count includes the thread calling ParallelFor, so 1 or less never starts any
+    explicit TransferThreadPool(uint32_t thread_count) : helper_count_(thread_count > 1 ? thread_count - 1 : 0) {}
+    TransferThreadPool(const TransferThreadPool &) = delete;
+    TransferThreadPool &operator=(const TransferThreadPool &) = delete;
+    ~TransferThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto &thread : threads_) thread.join();
+    }
+
+    // How many chunks a transfer of size bytes should be split into
+    size_t ChunkCount(size_t size) const {
+        if (size < kParallelTransferThreshold) return 1;
+        return (std::min)(static_cast<size_t>(helper_count_) + 1, size / kMinTransferChunk);
+    }
+
+    // Calls func(i) for every i below count, spread across the pool and the calling thread, and returns once they're done
+    void ParallelFor(size_t count, const std::function<void(size_t)> &func) {
+        std::unique_lock<std::mutex> busy(busy_mutex_, std::try_to_lock);
+        if (count < 2 || !helper_count_ || !busy.owns_lock()) {
+            for (size_t i = 0; i < count; ++i) func(i);
+            return;
+        }
+        if (threads_.empty()) {
+            for (uint32_t i = 0; i < helper_count_; ++i) threads_.emplace_back(&TransferThreadPool::Run, this);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            func_ = &func;
+            count_ = count;
+            next_ = 0;
+            ++generation_;
+        }
+        work_cv_.notify_all();
+        RunChunks(func, count);
+        // Helpers that took a chunk are still counted as active until they finish it
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&]() { return active_ == 0; });
+        func_ = nullptr;
+    }
+
+  private:
+    void RunChunks(const std::function<void(size_t)> &func, size_t count) {
+        for (size_t i = next_.fetch_add(1); i < count; i = next_.fetch_add(1)) func(i);
+    }
+
+    void Run() {
+        uint64_t seen_generation = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            work_cv_.wait(lock, [&]() { return stop_ || generation_ != seen_generation; });
+            if (stop_) return;
+            seen_generation = generation_;
+            // A helper waking after the transfer finished has nothing left to do
+            if (!func_) continue;
+            const std::function<void(size_t)> *func = func_;
+            const size_t count = count_;
+            ++active_;
+            lock.unlock();
+            RunChunks(*func, count);
+            lock.lock();
+            if (--active_ == 0) done_cv_.notify_all();
+        }
+    }
+
+    const uint32_t helper_count_;
+    std::vector<std::thread> threads_;
+    std::mutex busy_mutex_;  // Held by the thread whose transfer is using the pool
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    const std::function<void(size_t)> *func_ = nullptr;
+    size_t count_ = 0;
+    std::atomic<size_t> next_{0};
+    uint32_t active_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+};
+
+// Copies or fills size bytes as chunks spread across pool, each chunk a multiple of 64 bytes so fills keep their pattern
+template <typename Transfer>
+static void ParallelTransfer(TransferThreadPool *pool, size_t size, Transfer transfer) {
+    const size_t chunk_count = pool->ChunkCount(size);
+    if (chunk_count < 2) {
+        transfer(0, size);
+        return;
+    }
+    const size_t chunk_size = ((size + chunk_count - 1) / chunk_count + 63) & ~size_t(63);
+    pool->ParallelFor(chunk_count, [&](size_t i) {
+        const size_t offset = i * chunk_size;
+        if (offset < size) transfer(offset, (std::min)(chunk_size, size - offset));
+    });
+}
+
+// Calls transfer(row) for each of row_count rows of row_size bytes, spreading them across pool when there's enough to copy
+template <typename Transfer>
+static void ParallelRows(TransferThreadPool *pool, size_t row_count, size_t row_size, Transfer transfer) {
+    const size_t chunk_count = (std::min)(pool->ChunkCount(row_count * row_size), row_count);
+    if (chunk_count < 2) {
+        for (size_t row = 0; row < row_count; ++row) transfer(row);
+        return;
+    }
+    const size_t rows_per_chunk = (row_count + chunk_count - 1) / chunk_count;
+    pool->ParallelFor(chunk_count, [&](size_t i) {
+        const size_t end = (std::min)(row_count, (i + 1) * rows_per_chunk);
+        for (size_t row = i * rows_per_chunk; row < end; ++row) transfer(row);
+    });
+}
+
+// Copies slice_count slices of row_count rows of row_size bytes between two pitched layouts, such as an image subresource
+// and a buffer. Layouts without padding are copied in one go.
+static void CopyRows(TransferThreadPool *pool, uint8_t *dst, size_t dst_row_pitch, size_t dst_slice_pitch, const uint8_t *src,
+                     size_t src_row_pitch, size_t src_slice_pitch, size_t row_size, size_t row_count, size_t slice_count) {
+    const size_t slice_size = row_size * row_count;
+    if (dst_row_pitch == row_size && src_row_pitch == row_size && (slice_count == 1 ||
+        (dst_slice_pitch == slice_size && src_slice_pitch == slice_size))) {
+        ParallelTransfer(pool, slice_size * slice_count,
+                         [=](size_t offset, size_t size) { CopyMemory(dst + offset, src + offset, size); });
+        return;
+    }
+    ParallelRows(pool, row_count * slice_count, row_size, [=](size_t i) {
+        const size_t slice = i / row_count;
+        const size_t row = i % row_count;
+        CopyMemory(dst + slice * dst_slice_pitch + row * dst_row_pitch, src + slice * src_slice_pitch + row * src_row_pitch,
+                   row_size);
+    });
+}
+
+}  // namespace vkmock
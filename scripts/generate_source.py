@@ -43,6 +43,7 @@ def main(argv):
     files_to_gen = {str(os.path.join('icd','generated')) : ['vk_typemap_helper.h',
                                             'mock_icd.h',
                                             'mock_icd.cpp'],
+                    str(os.path.join('tracereplay','generated')): ['tracereplay.hpp'],
                     str(os.path.join('vulkaninfo','generated')): ['vulkaninfo.hpp']}
 
     #base directory for the source repository
@@ -207,6 +207,32 @@ def makeGenOpts(args):
             helper_file_type='mock_icd_source')
     ]
 
+    # Options for vktracereplay's table of entry points
+    genOpts['tracereplay.hpp'] = [
+        MockICDOutputGenerator,
+        MockICDGeneratorOptions(
+            conventions=conventions,
+            filename='tracereplay.hpp',
+            directory=directory,
+            genpath=None,
+            apiname='vulkan',
+            profile=None,
+            versions=featuresPat,
+            emitversions=featuresPat,
+            defaultExtensions='vulkan',
+            addExtensions=addExtensionsPat,
+            removeExtensions=removeExtensionsPat,
+            emitExtensions=emitExtensionsPat,
+            prefixText=prefixStrings + vkPrefixStrings,
+            protectFeature=False,
+            apicall='VKAPI_ATTR ',
+            apientry='VKAPI_CALL ',
+            apientryp='VKAPI_PTR *',
+            alignFuncParam=48,
+            expandEnumerants=False,
+            helper_file_type='trace_replay')
+    ]
+
     # Options for vulkaninfo.hpp
     genOpts['vulkaninfo.hpp'] = [
         VulkanInfoGenerator,
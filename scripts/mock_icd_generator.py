@@ -28,6 +28,22 @@ import os,re,sys
 from generator import *
 from common_codegen import *
 
+# Hash functions for the table of entry points, which must match ProcNameHash() and MixProcHash() in mock_icd_proc_table.h
+def ProcNameHash(name):
+    data = name.encode()
+    hash = len(data)
+    for i in range(0, len(data) // 8 * 8 + 1, 8):
+        hash = ((hash ^ int.from_bytes(data[i:i + 8], 'little')) * 0x9e3779b97f4a7c15) & 0xFFFFFFFFFFFFFFFF
+    return hash
+
+def MixProcHash(hash):
+    hash ^= hash >> 33
+    hash = (hash * 0xff51afd7ed558ccd) & 0xFFFFFFFFFFFFFFFF
+    hash ^= hash >> 33
+    hash = (hash * 0xc4ceb9fe1a85ec53) & 0xFFFFFFFFFFFFFFFF
+    hash ^= hash >> 33
+    return hash
+
 
 # Mock header code
 HEADER_C_CODE = '''
@@ -36,10 +52,24 @@ using lock_guard_t = std::lock_guard<mutex_t>;
 using unique_lock_t = std::unique_lock<mutex_t>;
 
 static mutex_t global_lock;
-static uint64_t global_unique_handle = 1;
+// Next block of non-dispatchable handle values to hand out. Handle value 0 is VK_NULL_HANDLE so start at 1.
+static std::atomic<uint64_t> global_unique_handle{1};
+// Number of handle values a thread reserves at a time from global_unique_handle
+static constexpr uint64_t kHandleBlockSize = 4096;
 static const uint32_t SUPPORTED_LOADER_ICD_INTERFACE_VERSION = 5;
 static uint32_t loader_interface_version = 0;
 static bool negotiate_loader_icd_interface_called = false;
+// Each thread reserves a block of handle values with a single atomic add and then hands them out without any
+//  synchronization, so non-dispatchable object creation doesn't contend on global_lock.
+static uint64_t AllocateNonDispHandle() {
+    thread_local uint64_t next_handle = 0;
+    thread_local uint64_t block_end = 0;
+    if (next_handle == block_end) {
+        next_handle = global_unique_handle.fetch_add(kHandleBlockSize, std::memory_order_relaxed);
+        block_end = next_handle + kHandleBlockSize;
+    }
+    return next_handle++;
+}
 static void* CreateDispObjHandle() {
     auto handle = new VK_LOADER_DATA;
     set_loader_magic_value(handle);
@@ -54,22 +84,1266 @@ static void DestroyDispObjHandle(void* handle) {
 SOURCE_CPP_PREFIX = '''
 using std::unordered_map;
 
-static constexpr uint32_t icd_physical_device_count = 1;
 static constexpr uint32_t kSupportedVulkanAPIVersion = VK_API_VERSION_1_1;
-static unordered_map<VkInstance, std::array<VkPhysicalDevice, icd_physical_device_count>> physical_device_map;
+// Nanoseconds per timestamp tick, reported as limits.timestampPeriod
+static constexpr float kTimestampPeriod = 1.0f;
+static unordered_map<VkInstance, std::vector<VkPhysicalDevice>> physical_device_map;
+
+struct DeviceMemoryState {
+    void* data; // Host backing for the whole allocation, see AllocateBackingMemory()
+    VkDeviceSize size;
+    bool imported; // data belongs to the app (VK_EXT_external_memory_host) and isn't freed with the allocation
+    uint32_t heap_index; // The heap whose usage the allocation counts towards, or kNoHeap for an invalid memory type
+};
+
+static constexpr uint32_t kNoHeap = UINT32_MAX;
+
+struct BufferState {
+    VkDeviceSize size;
+    VkDeviceMemory memory; // VK_NULL_HANDLE until the buffer is bound
+    VkDeviceSize memory_offset;
+};
+
+// A VkCommandBuffer handle is the address of one of these. As with DeviceObject, loader_data must stay the first member.
+struct CommandBufferObject {
+    VK_LOADER_DATA loader_data;
+    CommandStream commands;
+};
+
+// Command pools and the command buffers allocated from them are externally synchronized, so this needs no locking.
+// Destroying the pool releases its command buffers and their recordings all at once.
+struct CommandPoolState {
+    CommandArena arena;
+    ObjectSlab<CommandBufferObject> command_buffers;
+};
+
+// Set VKMOCK_ASYNC_QUEUE=1 to execute submissions on a worker thread per queue, which signals semaphores and fences as each
+// batch completes. By default submissions execute as they're submitted, unless they wait for a timeline semaphore value
+// that isn't reached yet, and fences always read as signaled.
+static bool AsyncQueuesEnabled() {
+    static const bool enabled = GetConfigBool("VKMOCK_ASYNC_QUEUE", false);
+    return enabled;
+}
+
+// Set VKMOCK_TRANSFER_THREADS to how many threads share a multi-megabyte transfer command, by default one per CPU up to 8
+static uint32_t GetTransferThreadCount() {
+    static const uint32_t thread_count = static_cast<uint32_t>(
+        GetConfigUint("VKMOCK_TRANSFER_THREADS", (std::min)(std::thread::hardware_concurrency(), 8u)));
+    return thread_count;
+}
+
+// Set VKMOCK_COMPUTE=1 to execute compute dispatches with a SPIR-V interpreter, which needs shader modules, pipelines and
+// descriptor sets tracked. By default dispatches only advance the simulated GPU clock.
+static bool ComputeEnabled() {
+    static const bool enabled = GetConfigBool("VKMOCK_COMPUTE", false);
+    return enabled;
+}
+
+// Set VKMOCK_COMPUTE_THREADS to how many threads share the workgroups of a dispatch, by default one per CPU
+static uint32_t GetComputeThreadCount() {
+    static const uint32_t thread_count =
+        static_cast<uint32_t>(GetConfigUint("VKMOCK_COMPUTE_THREADS", std::thread::hardware_concurrency()));
+    return thread_count;
+}
+
+// Set VKMOCK_PIPELINE_CACHE_STATS=1 to print each pipeline cache's hits and misses to stderr when it's destroyed
+static bool PipelineCacheStatsEnabled() {
+    static const bool enabled = GetConfigBool("VKMOCK_PIPELINE_CACHE_STATS", false);
+    return enabled;
+}
+
+static const CostModel& GetCostModel() {
+    static const CostModel cost_model = LoadCostModel();
+    return cost_model;
+}
+
+// The physical devices and device groups VKMOCK_PHYSICAL_DEVICE_COUNT, VKMOCK_PROFILE and VKMOCK_DEVICE_GROUPS describe
+static const PhysicalDeviceConfig& GetPhysicalDeviceConfig() {
+    static const DeviceProfileSchema schema = {MakeProfileFieldList(kPhysicalDeviceLimitsFields),
+                                               MakeProfileFieldList(kPhysicalDeviceSparsePropertiesFields),
+                                               MakeProfileFieldList(kPhysicalDeviceFeaturesFields)};
+    static const PhysicalDeviceConfig config = LoadPhysicalDeviceConfig(schema);
+    return config;
+}
+
+// A VkPhysicalDevice handle is the address of one of these. As with DeviceObject, loader_data must stay the first member.
+struct PhysicalDeviceObject {
+    VK_LOADER_DATA loader_data;
+    uint32_t index; // Position in vkEnumeratePhysicalDevices
+    HeapUsage heap_usage;
+};
+
+// The profile physicalDevice reports, or nullptr to report the mock ICD's own device
+static const DeviceProfile* GetDeviceProfile(VkPhysicalDevice physicalDevice) {
+    return GetPhysicalDeviceConfig().device_profiles[reinterpret_cast<PhysicalDeviceObject*>(physicalDevice)->index];
+}
+
+// Heap sizes VKMOCK_HEAP_SIZE overrides, by heap index, with 0 for the ones it doesn't
+static const std::vector<uint64_t>& GetHeapSizes() {
+    static const std::vector<uint64_t> heap_sizes = LoadHeapSizes();
+    return heap_sizes;
+}
+
+// Set VKMOCK_ENFORCE_HEAP_SIZE=1 to fail allocations that would take a heap's usage past its size
+static bool HeapSizeEnforced() {
+    static const bool enforced = GetConfigBool("VKMOCK_ENFORCE_HEAP_SIZE", false);
+    return enforced;
+}
+
+// Nanoseconds per timestamp tick
+static double GetTimestampPeriod(const DeviceProfile* profile) {
+    if (profile && profile->Has(kProfileProperties) && profile->Properties().limits.timestampPeriod > 0) {
+        return profile->Properties().limits.timestampPeriod;
+    }
+    return kTimestampPeriod;
+}
+
+// Memory types buffers and images can use: all of them
+static uint32_t GetAllMemoryTypeBits(const DeviceProfile* profile) {
+    if (profile && profile->Has(kProfileMemoryProperties)) {
+        return static_cast<uint32_t>((1ull << profile->MemoryProperties().memoryTypeCount) - 1);
+    }
+    return 0xFFFF;
+}
+
+struct ExtensionList {
+    const VkExtensionProperties* properties;
+    uint32_t count;
+};
+
+// The extensions a physical device reports: all the ones the mock ICD implements, or with a profile, the ones its device has
+static ExtensionList GetDeviceExtensions(VkPhysicalDevice physicalDevice) {
+    // Narrowed down once per profile, keeping kDeviceExtensions' order
+    static const std::unordered_map<const DeviceProfile*, std::vector<VkExtensionProperties>> profile_extensions = []() {
+        std::unordered_map<const DeviceProfile*, std::vector<VkExtensionProperties>> lists;
+        for (const auto& profile : GetPhysicalDeviceConfig().profiles) {
+            if (!profile || !profile->Has(kProfileExtensions)) continue;
+            auto& list = lists[profile.get()];
+            for (const auto& extension : kDeviceExtensions) {
+                if (profile->FindExtension(extension.extensionName)) list.push_back(extension);
+            }
+        }
+        return lists;
+    }();
+    const auto it = profile_extensions.find(GetDeviceProfile(physicalDevice));
+    if (it == profile_extensions.end()) return {kDeviceExtensions, sizeof(kDeviceExtensions) / sizeof(kDeviceExtensions[0])};
+    return {it->second.data(), static_cast<uint32_t>(it->second.size())};
+}
+
+// Fills in the results of a vkEnumerate*ExtensionProperties call from a list of extensions
+static VkResult CopyExtensionProperties(const VkExtensionProperties* extensions, uint32_t count, uint32_t* pPropertyCount,
+                                        VkExtensionProperties* pProperties) {
+    if (!pProperties) {
+        *pPropertyCount = count;
+        return VK_SUCCESS;
+    }
+    const uint32_t copy_count = (std::min)(*pPropertyCount, count);
+    if (copy_count) memcpy(pProperties, extensions, copy_count * sizeof(VkExtensionProperties));
+    *pPropertyCount = copy_count;
+    return copy_count < count ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+// The file VKMOCK_TRACE records calls to, or nullptr when they aren't being traced
+static TraceFile* GetTraceFile() {
+    static TraceFile* const trace_file = TraceFile::Open(kProcTable, sizeof(kProcTable) / sizeof(kProcTable[0]));
+    return trace_file;
+}
+
+// The call counts and latencies VKMOCK_CALL_STATS writes out, or nullptr when calls aren't being counted
+static CallStats* GetCallStats() {
+    static CallStats* const call_stats = CallStats::Open(kProcTable, sizeof(kProcTable) / sizeof(kProcTable[0]));
+    return call_stats;
+}
+
+// The entry point in a kProcTable slot that records each call to the trace. Generated at the end of the file.
+static void* GetTracedProc(size_t slot);
+
+// The entry point in a kProcTable slot that counts and times each call. Generated at the end of the file.
+static void* GetCountedProc(size_t slot);
+
+// Finds the entry point GetInstanceProcAddr returns for a name, which while counting calls is the one that counts each
+// call, and while tracing the one that records each call
+static PFN_vkVoidFunction LookupEntryPoint(const char* name) {
+    const size_t slot = FindProcSlot(kProcDisplacements, kProcTable, name);
+    // Mock should intercept all functions so anything not in the table gets null
+    if (slot == kProcNotFound || !kProcTable[slot].func) return nullptr;
+    if (GetCallStats()) return reinterpret_cast<PFN_vkVoidFunction>(GetCountedProc(slot));
+    return reinterpret_cast<PFN_vkVoidFunction>(GetTraceFile() ? GetTracedProc(slot) : kProcTable[slot].func);
+}
+
+struct DeviceState;
+
+// A VkQueue handle is the address of one of these. As with DeviceObject, loader_data must stay the first member.
+struct QueueObject {
+    VK_LOADER_DATA loader_data;
+    DeviceState* device_state;
+    QueueWorker worker; // Only running with AsyncQueuesEnabled()
+    double gpu_time_ns; // Simulated GPU clock, only touched by whichever thread executes the queue's submissions
+    // Without a worker, batches held back until the timeline values they wait for are reached, in submission order. Guarded
+    // by the device's held_batch_lock, while the count is only lowered once a released batch has executed.
+    std::deque<QueueSubmission*> held_batches;
+    std::atomic<uint32_t> held_batch_count{0};
+};
+
+struct QueryState {
+    std::atomic<uint64_t> value{0};
+    std::atomic<bool> available{false};
+};
+
+struct QueryPoolState {
+    explicit QueryPoolState(uint32_t query_count) : queries(query_count) {}
+    uint32_t values_per_query = 1; // Results vkGetQueryPoolResults writes for each query, all of them value
+    std::vector<QueryState> queries;
+};
+
+// Object state owned by a device. The tables can be read concurrently from any thread without taking global_lock.
+struct DeviceState {
+    HandleTable<uint64_t, QueueObject*> queue_map; // Keyed by QueueKey()
+    HandleTable<VkDeviceMemory, DeviceMemoryState> memory_map;
+    HandleTable<VkBuffer, BufferState> buffer_map;
+    HandleTable<VkImage, ImageState*> image_map;
+    HandleTable<VkCommandPool, CommandPoolState*> command_pool_map;
+    HandleTable<VkQueryPool, QueryPoolState*> query_pool_map;
+    // Fence and binary semaphore state only exists with AsyncQueuesEnabled(), while timeline semaphores always have their
+    // counters, since the host can signal and wait on them without any queue
+    HandleTable<VkFence, FenceState*> fence_map;
+    HandleTable<VkSemaphore, SemaphoreState*> semaphore_map;
+    HandleTable<VkSemaphore, TimelineSemaphore*> timeline_semaphore_map;
+    HandleTable<VkEvent, EventState*> event_map;
+    HandleTable<VkSwapchainKHR, Swapchain*> swapchain_map;
+    // Shader, pipeline and descriptor state only exists with ComputeEnabled()
+    HandleTable<VkShaderModule, std::shared_ptr<const std::vector<uint32_t>>> shader_module_map;
+    HandleTable<VkPipeline, std::shared_ptr<const ComputeProgram>> compute_pipeline_map;
+    HandleTable<VkImageView, ImageViewState> image_view_map;
+    HandleTable<VkSampler, SamplerState> sampler_map;
+    HandleTable<VkDescriptorSetLayout, std::shared_ptr<const DescriptorSetLayoutState>> descriptor_set_layout_map;
+    HandleTable<VkDescriptorPool, std::shared_ptr<DescriptorPoolState>> descriptor_pool_map;
+    HandleTable<VkDescriptorSet, std::shared_ptr<DescriptorSetState>> descriptor_set_map;
+    HandleTable<VkDescriptorUpdateTemplate, std::shared_ptr<const DescriptorUpdateTemplateState>> descriptor_update_template_map;
+    HandleTable<VkPipelineCache, PipelineCache*> pipeline_cache_map;
+    HandleTable<VkDeferredOperationKHR, DeferredOperation*> deferred_operation_map;
+    ObjectKeyTable object_key_map; // Content keys of the objects pipeline create infos refer to, for pipeline cache keys
+    SyncNotifier sync_notifier;
+    Futex timeline_futex; // Bumped by every timeline semaphore signal
+    // Batches held back on any of the device's queues without workers, see ReleaseHeldBatches()
+    std::mutex held_batch_lock;
+    std::atomic<uint32_t> held_batch_count{0};
+    // The physical device the device was created from
+    const DeviceProfile* profile = nullptr;
+    HeapUsage* heap_usage = nullptr;
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    VkPipelineCacheHeaderVersionOne pipeline_cache_header; // Identifies the device in vkGetPipelineCacheData's data
+    TransferThreadPool transfer_pool{GetTransferThreadCount()};
+    ComputeThreadPool compute_pool{GetComputeThreadCount()};
+};
+
+// A VkDevice handle is the address of one of these, so finding a device's state doesn't need a map lookup.
+// The loader overwrites loader_data with its dispatch table pointer, so it must stay the first member.
+struct DeviceObject {
+    VK_LOADER_DATA loader_data;
+    DeviceState state;
+};
+
+static DeviceState* GetDeviceState(VkDevice device) {
+    return &reinterpret_cast<DeviceObject*>(device)->state;
+}
+
+static uint64_t QueueKey(uint32_t queue_family_index, uint32_t queue_index) {
+    // Offset the family index so the key is never 0, which HandleTable reserves for empty slots
+    return ((uint64_t)queue_family_index + 1) << 32 | queue_index;
+}
+
+static CommandBufferObject* GetCommandBufferObject(VkCommandBuffer commandBuffer) {
+    return reinterpret_cast<CommandBufferObject*>(commandBuffer);
+}
+
+static void RecordCommand(VkCommandBuffer commandBuffer, CmdOpcode opcode) {
+    GetCommandBufferObject(commandBuffer)->commands.Record(static_cast<uint32_t>(opcode), 0);
+}
+
+// Appends a command to commandBuffer and returns its argument struct, which is followed by payload_size bytes for a
+// CommandPayload to copy the arrays the arguments point to into
+template <typename Args>
+static Args* RecordCommand(VkCommandBuffer commandBuffer, CmdOpcode opcode, size_t payload_size) {
+    void* args = GetCommandBufferObject(commandBuffer)->commands.Record(static_cast<uint32_t>(opcode),
+                                                                        AlignCommandSize(sizeof(Args)) + payload_size);
+    return static_cast<Args*>(args);
+}
+
+static QueueObject* GetQueueObject(VkQueue queue) {
+    return reinterpret_cast<QueueObject*>(queue);
+}
+
+static FenceState* GetFenceState(DeviceState* device_state, VkFence fence) {
+    FenceState* fence_state = nullptr;
+    if (fence) device_state->fence_map.Find(fence, &fence_state);
+    return fence_state;
+}
+
+static EventState* GetEventState(DeviceState* device_state, VkEvent event) {
+    EventState* event_state = nullptr;
+    if (event) device_state->event_map.Find(event, &event_state);
+    return event_state;
+}
+
+// Host work the cost model charges for takes its cost in real time on the thread doing it
+static void SpendHostTime(double ns) {
+    if (ns > 0) std::this_thread::sleep_for(std::chrono::nanoseconds(static_cast<uint64_t>(ns)));
+}
+
+// Makes task(0) to task(task_count - 1) and then finish() the work of deferred_operation, for the threads joining it to do,
+// and returns VK_OPERATION_DEFERRED_KHR. Without a deferred operation, does the work on the calling thread and returns
+// finish()'s result. The tasks can run after the command deferring them returns, so they mustn't capture its locals by
+// reference, but Vulkan keeps the command's parameters valid until the operation is complete.
+// Work without tasks is never deferred: finish() runs on the calling thread, and a successful command given a deferred
+// operation returns VK_OPERATION_NOT_DEFERRED_KHR, leaving the operation as it was.
+static VkResult DeferOrRun(DeviceState* device_state, VkDeferredOperationKHR deferred_operation, uint32_t task_count,
+                           std::function<void(uint32_t)> task, std::function<VkResult()> finish) {
+    DeferredOperation* operation = nullptr;
+    if (deferred_operation && device_state->deferred_operation_map.Find(deferred_operation, &operation)) {
+        if (task_count == 0) {
+            const VkResult result = finish();
+            return result == VK_SUCCESS ? VK_OPERATION_NOT_DEFERRED_KHR : result;
+        }
+        operation->Defer(task_count, std::move(task), std::move(finish));
+        return VK_OPERATION_DEFERRED_KHR;
+    }
+    DeferredOperation local_operation;
+    local_operation.Defer(task_count, std::move(task), std::move(finish));
+    local_operation.Join();
+    return local_operation.Result();
+}
+
+// Creating a pipeline compiles it unless pipeline_cache has it. Compiling takes the cost model's compile_ns on the calling
+// thread and adds the pipeline to the cache, or with VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT_EXT fails
+// instead. key_func() gives the pipeline's PipelineKey, and creation feedback in next reports whether the cache had it.
+template <typename KeyFunc>
+static VkResult CompilePipeline(DeviceState* device_state, VkPipelineCache pipeline_cache, VkPipelineCreateFlags flags,
+                                const void* next, KeyFunc key_func) {
+    const auto start = std::chrono::steady_clock::now();
+    PipelineCache* cache = nullptr;
+    PipelineKey key = {0, 0};
+    bool hit = false;
+    if (pipeline_cache && device_state->pipeline_cache_map.Find(pipeline_cache, &cache)) {
+        key = key_func();
+        hit = cache->Find(key);
+    }
+    if (!hit) {
+        if (flags & VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT_EXT) return VK_PIPELINE_COMPILE_REQUIRED_EXT;
+        SpendHostTime(GetCostModel().compile_ns);
+        if (cache) cache->Add(key);
+    }
+    auto feedback = lvl_find_in_chain<VkPipelineCreationFeedbackCreateInfoEXT>(next);
+    if (feedback) {
+        VkPipelineCreationFeedbackFlagsEXT feedback_flags = VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT;
+        if (hit) feedback_flags |= VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT;
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        if (feedback->pPipelineCreationFeedback) {
+            *feedback->pPipelineCreationFeedback = {feedback_flags, static_cast<uint64_t>(duration.count())};
+        }
+        for (uint32_t i = 0; i < feedback->pipelineStageCreationFeedbackCount; ++i) {
+            feedback->pPipelineStageCreationFeedbacks[i] = {feedback_flags, 0};
+        }
+    }
+    return VK_SUCCESS;
+}
+
+// Calls create(create_info, &pipeline) for each pipeline, which returns VK_SUCCESS or why it didn't create the pipeline,
+// as a task of deferred_operation if there is one, so joining threads compile pipelines in parallel. As Vulkan requires,
+// pipelines that weren't created are VK_NULL_HANDLE, as are the ones after a failure with
+// VK_PIPELINE_CREATE_EARLY_RETURN_ON_FAILURE_BIT_EXT. Those aren't created, unless another thread got to them first, in
+// which case they're destroyed again.
+template <typename CreateInfo, typename Create>
+static VkResult CreatePipelines(VkDevice device, VkDeferredOperationKHR deferred_operation, uint32_t create_info_count,
+                                const CreateInfo* create_infos, VkPipeline* pipelines, Create create) {
+    struct Results {
+        explicit Results(uint32_t count) : results(count, VK_SUCCESS) {}
+        std::vector<VkResult> results;
+        std::atomic<uint32_t> early_return{UINT32_MAX}; // Lowest index that failed with EARLY_RETURN_ON_FAILURE
+    };
+    auto state = std::make_shared<Results>(create_info_count);
+    auto task = [=](uint32_t i) {
+        if (i > state->early_return.load(std::memory_order_relaxed)) {
+            pipelines[i] = VK_NULL_HANDLE;
+            return;
+        }
+        state->results[i] = create(create_infos[i], &pipelines[i]);
+        if (state->results[i] == VK_SUCCESS) return;
+        pipelines[i] = VK_NULL_HANDLE;
+        if (create_infos[i].flags & VK_PIPELINE_CREATE_EARLY_RETURN_ON_FAILURE_BIT_EXT) {
+            uint32_t lowest = state->early_return.load(std::memory_order_relaxed);
+            while (i < lowest && !state->early_return.compare_exchange_weak(lowest, i, std::memory_order_relaxed)) {
+            }
+        }
+    };
+    auto finish = [=]() {
+        const uint32_t early_return = state->early_return.load(std::memory_order_relaxed);
+        VkResult result = VK_SUCCESS;
+        for (uint32_t i = 0; i < create_info_count; ++i) {
+            if (i <= early_return) {
+                if (state->results[i] != VK_SUCCESS) result = state->results[i];
+            } else if (pipelines[i]) {
+                DestroyPipeline(device, pipelines[i], nullptr);
+                pipelines[i] = VK_NULL_HANDLE;
+            }
+        }
+        return result;
+    };
+    return DeferOrRun(GetDeviceState(device), deferred_operation, create_info_count, task, finish);
+}
+
+static void AddSemaphoreState(DeviceState* device_state, VkSemaphore semaphore, std::vector<SemaphoreState*>* semaphore_states) {
+    SemaphoreState* semaphore_state = nullptr;
+    if (semaphore && device_state->semaphore_map.Find(semaphore, &semaphore_state)) semaphore_states->push_back(semaphore_state);
+}
+
+// For batches that can use either kind of semaphore: value is what a timeline semaphore waits for or is signaled to
+static void AddSemaphoreState(DeviceState* device_state, VkSemaphore semaphore, uint64_t value,
+                              std::vector<SemaphoreState*>* semaphore_states, std::vector<TimelinePoint>* timeline_points) {
+    TimelineSemaphore* timeline = nullptr;
+    if (semaphore && device_state->timeline_semaphore_map.Find(semaphore, &timeline)) {
+        timeline_points->push_back({timeline, value});
+    } else {
+        AddSemaphoreState(device_state, semaphore, semaphore_states);
+    }
+}
+
+// The index-th value of a VkTimelineSemaphoreSubmitInfo's wait or signal values, which binary semaphores don't need
+static uint64_t GetTimelineValue(const uint64_t* values, uint32_t value_count, uint32_t index) {
+    return values && index < value_count ? values[index] : 0;
+}
+
+static uint64_t GpuTimeToTicks(const DeviceState* device_state, double gpu_time_ns) {
+    return static_cast<uint64_t>(gpu_time_ns / GetTimestampPeriod(device_state->profile));
+}
+
+static void WriteQuery(DeviceState* device_state, VkQueryPool query_pool, uint32_t query, uint64_t value) {
+    QueryPoolState* pool_state = nullptr;
+    if (!device_state->query_pool_map.Find(query_pool, &pool_state) || query >= pool_state->queries.size()) return;
+    pool_state->queries[query].value = value;
+    pool_state->queries[query].available = true;
+}
+
+static void ResetQueries(DeviceState* device_state, VkQueryPool query_pool, uint32_t first_query, uint32_t query_count) {
+    QueryPoolState* pool_state = nullptr;
+    if (!device_state->query_pool_map.Find(query_pool, &pool_state)) return;
+    for (uint32_t i = first_query; i < first_query + query_count && i < pool_state->queries.size(); ++i) {
+        pool_state->queries[i].available = false;
+    }
+}
+
+static void WriteQueryResult(void* data, uint32_t index, uint64_t value, VkQueryResultFlags flags) {
+    if (flags & VK_QUERY_RESULT_64_BIT) {
+        static_cast<uint64_t*>(data)[index] = value;
+    } else {
+        static_cast<uint32_t*>(data)[index] = static_cast<uint32_t>(value);
+    }
+}
+
+// The host memory backing size bytes of buffer from offset, or nullptr if the buffer isn't bound to memory or the range
+// doesn't fit in the buffer or its memory
+static uint8_t* GetBufferData(DeviceState* device_state, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size) {
+    BufferState buffer_state;
+    DeviceMemoryState memory_state;
+    if (!device_state->buffer_map.Find(buffer, &buffer_state) || !buffer_state.memory) return nullptr;
+    if (!device_state->memory_map.Find(buffer_state.memory, &memory_state) || !memory_state.data) return nullptr;
+    if (offset > buffer_state.size || size > buffer_state.size - offset) return nullptr;
+    if (buffer_state.memory_offset > memory_state.size || offset + size > memory_state.size - buffer_state.memory_offset) {
+        return nullptr;
+    }
+    return static_cast<uint8_t*>(memory_state.data) + buffer_state.memory_offset + offset;
+}
+
+// The bytes vkCmdFillBuffer writes, with VK_WHOLE_SIZE resolved to the rest of the buffer rounded down to a multiple of 4
+static VkDeviceSize GetFillSize(DeviceState* device_state, const CmdFillBufferArgs& args) {
+    if (args.size != VK_WHOLE_SIZE) return args.size;
+    BufferState buffer_state = {};
+    device_state->buffer_map.Find(args.dstBuffer, &buffer_state);
+    return buffer_state.size > args.dstOffset ? (buffer_state.size - args.dstOffset) & ~VkDeviceSize(3) : 0;
+}
+
+// Buffer transfers write the memory the buffers are bound to, on the thread executing the queue's submissions, so data
+// uploaded or read back through them can be checked. Regions that aren't bound to memory or don't fit in it are skipped.
+static void ExecuteCopyBuffer(DeviceState* device_state, const CmdCopyBufferArgs& args) {
+    for (uint32_t i = 0; i < args.regionCount; ++i) {
+        const VkBufferCopy& region = args.pRegions[i];
+        const uint8_t* src = GetBufferData(device_state, args.srcBuffer, region.srcOffset, region.size);
+        uint8_t* dst = GetBufferData(device_state, args.dstBuffer, region.dstOffset, region.size);
+        if (!src || !dst) continue;
+        const size_t size = static_cast<size_t>(region.size);
+        // Overlapping regions aren't valid, but copying them as one memmove at least doesn't race
+        if (dst < src + size && src < dst + size) {
+            memmove(dst, src, size);
+            continue;
+        }
+        ParallelTransfer(&device_state->transfer_pool, size,
+                         [=](size_t offset, size_t chunk_size) { CopyMemory(dst + offset, src + offset, chunk_size); });
+    }
+}
 
-// Map device memory handle to any mapped allocations that we'll need to free on unmap
-static unordered_map<VkDeviceMemory, std::vector<void*>> mapped_memory_map;
+static void ExecuteUpdateBuffer(DeviceState* device_state, const CmdUpdateBufferArgs& args) {
+    uint8_t* dst = GetBufferData(device_state, args.dstBuffer, args.dstOffset, args.dataSize);
+    // At most 65536 bytes, which isn't worth splitting
+    if (dst) memcpy(dst, args.pData, static_cast<size_t>(args.dataSize));
+}
 
-// Map device memory allocation handle to the size
-static unordered_map<VkDeviceMemory, VkDeviceSize> allocated_memory_size_map;
+static void ExecuteFillBuffer(DeviceState* device_state, const CmdFillBufferArgs& args) {
+    const VkDeviceSize size = GetFillSize(device_state, args);
+    uint8_t* dst = GetBufferData(device_state, args.dstBuffer, args.dstOffset, size);
+    if (!dst) return;
+    const uint32_t data = args.data;
+    ParallelTransfer(&device_state->transfer_pool, static_cast<size_t>(size),
+                     [=](size_t offset, size_t chunk_size) { FillMemory(dst + offset, data, chunk_size); });
+}
 
-static unordered_map<VkDevice, unordered_map<uint32_t, unordered_map<uint32_t, VkQueue>>> queue_map;
-static unordered_map<VkDevice, unordered_map<VkBuffer, VkBufferCreateInfo>> buffer_map;
-static unordered_map<VkDevice, unordered_map<VkImage, VkDeviceSize>> image_memory_size_map;
+// The texel blocks of one image subresource, in the memory the image is bound to
+struct ImageSubresourceData {
+    uint8_t* data;
+    VkDeviceSize row_pitch;
+    VkDeviceSize depth_pitch;
+    MipLevelBlocks blocks;
+};
 
-static constexpr uint32_t icd_swapchain_image_count = 1;
-static unordered_map<VkSwapchainKHR, VkImage[icd_swapchain_image_count]> swapchain_image_map;
+// Combined depth/stencil formats interleave their aspects in each texel, while copies to buffers pack each aspect on its own,
+// so they aren't copied
+static bool IsDepthStencilFormat(VkFormat format) {
+    return format == VK_FORMAT_D16_UNORM_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT || format == VK_FORMAT_D32_SFLOAT_S8_UINT;
+}
+
+// False if the subresource doesn't exist, or the image isn't bound to memory big enough for it
+static bool GetImageSubresourceData(DeviceState* device_state, const ImageState* image_state, VkImageAspectFlags aspect,
+                                    uint32_t mip_level, uint32_t array_layer, ImageSubresourceData* subresource) {
+    if (IsDepthStencilFormat(image_state->format)) return false;
+    const uint32_t plane = GetAspectPlane(aspect);
+    const VkSubresourceLayout layout = image_state->layout.Subresource(plane, mip_level, array_layer);
+    DeviceMemoryState memory_state;
+    if (!layout.size || !image_state->memory[plane]) return false;
+    if (!device_state->memory_map.Find(image_state->memory[plane], &memory_state) || !memory_state.data) return false;
+    const VkDeviceSize offset = image_state->memory_offset[plane] + layout.offset;
+    if (offset > memory_state.size || layout.size > memory_state.size - offset) return false;
+    subresource->data = static_cast<uint8_t*>(memory_state.data) + offset;
+    subresource->row_pitch = layout.rowPitch;
+    subresource->depth_pitch = layout.depthPitch;
+    subresource->blocks = GetMipLevelBlocks(image_state->format_info, plane, image_state->extent, mip_level);
+    return true;
+}
+
+// Part of one depth slice of an image subresource, in texel blocks
+struct BlockRegion {
+    uint32_t x;
+    uint32_t y;
+    uint32_t z;
+    uint32_t width;
+    uint32_t height;
+};
+
+static BlockRegion GetBlockRegion(const MipLevelBlocks& blocks, const VkOffset3D& offset, uint32_t width, uint32_t height) {
+    // Negative offsets wrap around to offsets that don't fit
+    return {static_cast<uint32_t>(offset.x) / blocks.block_width, static_cast<uint32_t>(offset.y) / blocks.block_height,
+            static_cast<uint32_t>(offset.z) / blocks.block_depth, DivideRoundingUp(width, blocks.block_width),
+            DivideRoundingUp(height, blocks.block_height)};
+}
+
+static bool FitsSubresource(const ImageSubresourceData& subresource, const BlockRegion& region) {
+    return region.width && region.height && (uint64_t)region.x + region.width <= subresource.blocks.width &&
+           (uint64_t)region.y + region.height <= subresource.blocks.height && region.z < subresource.blocks.depth;
+}
+
+static uint8_t* GetBlockAddress(const ImageSubresourceData& subresource, const BlockRegion& region) {
+    return subresource.data + region.z * subresource.depth_pitch + region.y * subresource.row_pitch +
+           (VkDeviceSize)region.x * subresource.blocks.block_size;
+}
+
+// Image transfers, like buffer transfers, write the memory the image is bound to as the queue executes them. Copies move
+// texel blocks as they are, so work with any format but combined depth/stencil ones, while clears and blits convert texels
+// and only work with the formats in kTexelFormats. Regions that don't fit are skipped.
+static void ExecuteBufferImageCopy(DeviceState* device_state, VkBuffer buffer, VkImage image, uint32_t region_count,
+                                   const VkBufferImageCopy* regions, bool to_image) {
+    ImageState* image_state = nullptr;
+    if (!device_state->image_map.Find(image, &image_state)) return;
+    for (uint32_t i = 0; i < region_count; ++i) {
+        const VkBufferImageCopy& region = regions[i];
+        const VkImageSubresourceLayers& subresource_layers = region.imageSubresource;
+        for (uint32_t layer = 0; layer < subresource_layers.layerCount; ++layer) {
+            ImageSubresourceData subresource;
+            if (!GetImageSubresourceData(device_state, image_state, subresource_layers.aspectMask, subresource_layers.mipLevel,
+                                         subresource_layers.baseArrayLayer + layer, &subresource)) {
+                break;
+            }
+            const MipLevelBlocks& blocks = subresource.blocks;
+            const BlockRegion image_region = GetBlockRegion(blocks, region.imageOffset, region.imageExtent.width,
+                                                            region.imageExtent.height);
+            const uint32_t depth = DivideRoundingUp(region.imageExtent.depth, blocks.block_depth);
+            if (!depth || !FitsSubresource(subresource, image_region) || image_region.z + depth > blocks.depth) break;
+            // The buffer is tightly packed unless bufferRowLength and bufferImageHeight say otherwise
+            const uint32_t row_length = region.bufferRowLength ? region.bufferRowLength : region.imageExtent.width;
+            const uint32_t image_height = region.bufferImageHeight ? region.bufferImageHeight : region.imageExtent.height;
+            const VkDeviceSize row_size = (VkDeviceSize)image_region.width * blocks.block_size;
+            const VkDeviceSize buffer_row_pitch = (VkDeviceSize)DivideRoundingUp(row_length, blocks.block_width) * blocks.block_size;
+            const VkDeviceSize buffer_slice_pitch = DivideRoundingUp(image_height, blocks.block_height) * buffer_row_pitch;
+            const VkDeviceSize buffer_size = (depth - 1) * buffer_slice_pitch + (image_region.height - 1) * buffer_row_pitch + row_size;
+            const VkDeviceSize buffer_offset = region.bufferOffset + layer * depth * buffer_slice_pitch;
+            uint8_t* buffer_data = GetBufferData(device_state, buffer, buffer_offset, buffer_size);
+            if (!buffer_data) break;
+            uint8_t* image_data = GetBlockAddress(subresource, image_region);
+            if (to_image) {
+                CopyRows(&device_state->transfer_pool, image_data, (size_t)subresource.row_pitch, (size_t)subresource.depth_pitch,
+                         buffer_data, (size_t)buffer_row_pitch, (size_t)buffer_slice_pitch, (size_t)row_size, image_region.height,
+                         depth);
+            } else {
+                CopyRows(&device_state->transfer_pool, buffer_data, (size_t)buffer_row_pitch, (size_t)buffer_slice_pitch,
+                         image_data, (size_t)subresource.row_pitch, (size_t)subresource.depth_pitch, (size_t)row_size,
+                         image_region.height, depth);
+            }
+        }
+    }
+}
+
+static void ExecuteCopyImage(DeviceState* device_state, const CmdCopyImageArgs& args) {
+    ImageState* src_state = nullptr;
+    ImageState* dst_state = nullptr;
+    if (!device_state->image_map.Find(args.srcImage, &src_state) || !device_state->image_map.Find(args.dstImage, &dst_state)) {
+        return;
+    }
+    const bool src_3d = src_state->type == VK_IMAGE_TYPE_3D;
+    const bool dst_3d = dst_state->type == VK_IMAGE_TYPE_3D;
+    for (uint32_t i = 0; i < args.regionCount; ++i) {
+        const VkImageCopy& region = args.pRegions[i];
+        // Copied a depth slice or array layer at a time. Copies between 3D and 2D images match the 3D image's depth slices up
+        // with the other's array layers.
+        const uint32_t slice_count = src_3d || dst_3d ? region.extent.depth : region.srcSubresource.layerCount;
+        for (uint32_t slice = 0; slice < slice_count; ++slice) {
+            ImageSubresourceData src;
+            ImageSubresourceData dst;
+            if (!GetImageSubresourceData(device_state, src_state, region.srcSubresource.aspectMask, region.srcSubresource.mipLevel,
+                                         region.srcSubresource.baseArrayLayer + (src_3d ? 0 : slice), &src) ||
+                !GetImageSubresourceData(device_state, dst_state, region.dstSubresource.aspectMask, region.dstSubresource.mipLevel,
+                                         region.dstSubresource.baseArrayLayer + (dst_3d ? 0 : slice), &dst) ||
+                src.blocks.block_size != dst.blocks.block_size) {
+                break;
+            }
+            const VkOffset3D src_offset = {region.srcOffset.x, region.srcOffset.y, region.srcOffset.z + (src_3d ? (int32_t)slice : 0)};
+            const VkOffset3D dst_offset = {region.dstOffset.x, region.dstOffset.y, region.dstOffset.z + (dst_3d ? (int32_t)slice : 0)};
+            const BlockRegion src_region = GetBlockRegion(src.blocks, src_offset, region.extent.width, region.extent.height);
+            // The extent is in source texels, which may be compressed blocks of the destination's texels or the other way round
+            BlockRegion dst_region = GetBlockRegion(dst.blocks, dst_offset, 0, 0);
+            dst_region.width = src_region.width;
+            dst_region.height = src_region.height;
+            if (!FitsSubresource(src, src_region) || !FitsSubresource(dst, dst_region)) break;
+            CopyRows(&device_state->transfer_pool, GetBlockAddress(dst, dst_region), (size_t)dst.row_pitch, (size_t)dst.depth_pitch,
+                     GetBlockAddress(src, src_region), (size_t)src.row_pitch, (size_t)src.depth_pitch,
+                     (size_t)src_region.width * src.blocks.block_size, src_region.height, 1);
+        }
+    }
+}
+
+static void ExecuteClearColorImage(DeviceState* device_state, const CmdClearColorImageArgs& args) {
+    ImageState* image_state = nullptr;
+    if (!device_state->image_map.Find(args.image, &image_state)) return;
+    const TexelFormat* format = GetTexelFormat(image_state->format);
+    if (!format) return;
+    uint8_t texel[16] = {};
+    PackClearColor(*format, *args.pColor, texel);
+    for (uint32_t i = 0; i < args.rangeCount; ++i) {
+        const VkImageSubresourceRange& range = args.pRanges[i];
+        const uint32_t level_end = range.levelCount == VK_REMAINING_MIP_LEVELS ? image_state->mip_levels
+                                                                                : range.baseMipLevel + range.levelCount;
+        const uint32_t layer_end = range.layerCount == VK_REMAINING_ARRAY_LAYERS ? image_state->array_layers
+                                                                                  : range.baseArrayLayer + range.layerCount;
+        for (uint32_t level = range.baseMipLevel; level < level_end; ++level) {
+            for (uint32_t layer = range.baseArrayLayer; layer < layer_end; ++layer) {
+                ImageSubresourceData subresource;
+                if (!GetImageSubresourceData(device_state, image_state, range.aspectMask, level, layer, &subresource)) continue;
+                const MipLevelBlocks& blocks = subresource.blocks;
+                const size_t row_size = (size_t)blocks.width * format->size;
+                const size_t row_pitch = (size_t)subresource.row_pitch;
+                uint8_t* data = subresource.data;
+                if (row_pitch == row_size && (blocks.depth == 1 || subresource.depth_pitch == row_size * blocks.height)) {
+                    // Chunks are multiples of 64 bytes, so whole texels
+                    ParallelTransfer(&device_state->transfer_pool, row_size * blocks.height * blocks.depth,
+                                     [&](size_t offset, size_t size) {
+                                         FillTexels(data + offset, texel, format->size, size / format->size);
+                                     });
+                    continue;
+                }
+                const size_t depth_pitch = (size_t)subresource.depth_pitch;
+                const uint32_t height = blocks.height;
+                const uint32_t width = blocks.width;
+                ParallelRows(&device_state->transfer_pool, (size_t)height * blocks.depth, row_size, [&](size_t row) {
+                    FillTexels(data + (row / height) * depth_pitch + (row % height) * row_pitch, texel, format->size, width);
+                });
+            }
+        }
+    }
+}
+
+static void ExecuteBlitImage(DeviceState* device_state, const CmdBlitImageArgs& args) {
+    ImageState* src_state = nullptr;
+    ImageState* dst_state = nullptr;
+    if (!device_state->image_map.Find(args.srcImage, &src_state) || !device_state->image_map.Find(args.dstImage, &dst_state)) {
+        return;
+    }
+    const TexelFormat* src_format = GetTexelFormat(src_state->format);
+    const TexelFormat* dst_format = GetTexelFormat(dst_state->format);
+    if (!src_format || !dst_format || src_format->Integer() != dst_format->Integer()) return;
+    if (src_format->Integer() && src_format->format != dst_format->format) return;
+    const bool linear = args.filter == VK_FILTER_LINEAR && !src_format->Integer();
+    for (uint32_t i = 0; i < args.regionCount; ++i) {
+        const VkImageBlit& region = args.pRegions[i];
+        const VkOffset3D* src_offsets = region.srcOffsets;
+        const VkOffset3D* dst_offsets = region.dstOffsets;
+        const MipLevelBlocks src_blocks = GetMipLevelBlocks(src_state->format_info, 0, src_state->extent, region.srcSubresource.mipLevel);
+        const MipLevelBlocks dst_blocks = GetMipLevelBlocks(dst_state->format_info, 0, dst_state->extent, region.dstSubresource.mipLevel);
+        const VkOffset3D dst_min = {(std::min)(dst_offsets[0].x, dst_offsets[1].x), (std::min)(dst_offsets[0].y, dst_offsets[1].y),
+                                    (std::min)(dst_offsets[0].z, dst_offsets[1].z)};
+        const VkOffset3D dst_max = {(std::max)(dst_offsets[0].x, dst_offsets[1].x), (std::max)(dst_offsets[0].y, dst_offsets[1].y),
+                                    (std::max)(dst_offsets[0].z, dst_offsets[1].z)};
+        if (dst_min.x < 0 || dst_min.y < 0 || dst_min.z < 0 || (uint32_t)dst_max.x > dst_blocks.width ||
+            (uint32_t)dst_max.y > dst_blocks.height || (uint32_t)dst_max.z > dst_blocks.depth) {
+            continue;
+        }
+        const auto x_samples = GetBlitSamples(src_offsets[0].x, src_offsets[1].x, dst_offsets[0].x, dst_offsets[1].x,
+                                              src_blocks.width, linear);
+        const auto y_samples = GetBlitSamples(src_offsets[0].y, src_offsets[1].y, dst_offsets[0].y, dst_offsets[1].y,
+                                              src_blocks.height, linear);
+        const auto z_samples = GetBlitSamples(src_offsets[0].z, src_offsets[1].z, dst_offsets[0].z, dst_offsets[1].z,
+                                              src_blocks.depth, linear);
+        if (x_samples.empty() || y_samples.empty()) continue;
+        for (uint32_t layer = 0; layer < region.srcSubresource.layerCount; ++layer) {
+            ImageSubresourceData src;
+            ImageSubresourceData dst;
+            if (!GetImageSubresourceData(device_state, src_state, region.srcSubresource.aspectMask, region.srcSubresource.mipLevel,
+                                         region.srcSubresource.baseArrayLayer + layer, &src) ||
+                !GetImageSubresourceData(device_state, dst_state, region.dstSubresource.aspectMask, region.dstSubresource.mipLevel,
+                                         region.dstSubresource.baseArrayLayer + layer, &dst)) {
+                break;
+            }
+            for (size_t z = 0; z < z_samples.size(); ++z) {
+                const BlitSource sources[2] = {{src.data + z_samples[z].i0 * src.depth_pitch, (size_t)src.row_pitch},
+                                               {src.data + z_samples[z].i1 * src.depth_pitch, (size_t)src.row_pitch}};
+                uint8_t* dst_data = dst.data + (dst_min.z + z) * dst.depth_pitch + dst_min.y * dst.row_pitch +
+                                    (VkDeviceSize)dst_min.x * dst_format->size;
+                BlitSlice(&device_state->transfer_pool, *src_format, sources, z_samples[z].weight, *dst_format, dst_data,
+                          (size_t)dst.row_pitch, x_samples, y_samples, linear);
+            }
+        }
+    }
+}
+
+static constexpr uint32_t kMaxBoundDescriptorSets = 32;
+
+// The compute pipeline, descriptor sets and push constants a command buffer has bound so far while it executes.
+// Secondary command buffers start with nothing bound, as they don't inherit any of it.
+struct BoundComputeState {
+    std::shared_ptr<const ComputeProgram> program;  // nullptr if the pipeline can't be executed
+    std::shared_ptr<DescriptorSetState> sets[kMaxBoundDescriptorSets];
+    std::vector<uint32_t> dynamic_offsets[kMaxBoundDescriptorSets];
+    uint8_t push_constants[kMaxPushConstantSize] = {};
+};
+
+static void BindComputeDescriptorSets(DeviceState* device_state, const CmdBindDescriptorSetsArgs& args, BoundComputeState* bound) {
+    // Each set takes as many of the dynamic offsets as its layout has dynamic descriptors
+    uint32_t dynamic_offset = 0;
+    for (uint32_t i = 0; i < args.descriptorSetCount; ++i) {
+        std::shared_ptr<DescriptorSetState> set_state;
+        device_state->descriptor_set_map.Find(args.pDescriptorSets[i], &set_state);
+        const uint32_t dynamic_count =
+            set_state ? (std::min)(set_state->layout->dynamic_count, args.dynamicOffsetCount - dynamic_offset) : 0;
+        const uint32_t set = args.firstSet + i;
+        if (set < kMaxBoundDescriptorSets) {
+            bound->sets[set] = set_state;
+            bound->dynamic_offsets[set].assign(args.pDynamicOffsets + dynamic_offset,
+                                               args.pDynamicOffsets + dynamic_offset + dynamic_count);
+        }
+        dynamic_offset += dynamic_count;
+    }
+}
+
+// A buffer descriptor's range, or an empty binding if the buffer isn't bound to memory that holds all of it
+static ComputeBinding GetBufferBinding(DeviceState* device_state, const DescriptorState& descriptor, VkDeviceSize dynamic_offset) {
+    ComputeBinding binding;
+    BufferState buffer_state;
+    if (!descriptor.buffer || !device_state->buffer_map.Find(descriptor.buffer, &buffer_state)) return binding;
+    const VkDeviceSize offset = descriptor.offset + dynamic_offset;
+    if (offset > buffer_state.size) return binding;
+    const VkDeviceSize range = descriptor.range == VK_WHOLE_SIZE ? buffer_state.size - offset : descriptor.range;
+    binding.data = GetBufferData(device_state, descriptor.buffer, offset, range);
+    // Shaders address buffers with 32-bit offsets
+    if (binding.data) binding.size = static_cast<uint32_t>((std::min)(range, VkDeviceSize(UINT32_MAX)));
+    return binding;
+}
+
+// The base mip level of an image descriptor's view, from its base array layer, and the sampler's filtering and addressing.
+// Images of formats that can't be converted, and images that aren't bound to memory, read as zeros and ignore writes.
+static ComputeBinding GetImageBinding(DeviceState* device_state, const DescriptorState& descriptor) {
+    ComputeBinding binding;
+    SamplerState sampler_state;
+    if (descriptor.sampler && device_state->sampler_map.Find(descriptor.sampler, &sampler_state)) {
+        binding.linear_filter = sampler_state.linear_filter;
+        binding.unnormalized_coordinates = sampler_state.unnormalized_coordinates;
+        std::copy(sampler_state.address_modes, sampler_state.address_modes + 3, binding.address_modes);
+    }
+    ImageViewState view_state;
+    ImageState* image_state = nullptr;
+    if (!descriptor.image_view || !device_state->image_view_map.Find(descriptor.image_view, &view_state) ||
+        !device_state->image_map.Find(view_state.image, &image_state)) {
+        return binding;
+    }
+    const VkImageSubresourceRange& range = view_state.subresource_range;
+    ImageSubresourceData subresource;
+    if (!GetImageSubresourceData(device_state, image_state, range.aspectMask, range.baseMipLevel, range.baseArrayLayer,
+                                 &subresource)) {
+        return binding;
+    }
+    const MipLevelBlocks& blocks = subresource.blocks;
+    const TexelFormat* format = GetTexelFormat(view_state.format);
+    if (!format || format->size != blocks.block_size || blocks.block_width != 1 || blocks.block_height != 1) return binding;
+    const VkSubresourceLayout layout =
+        image_state->layout.Subresource(GetAspectPlane(range.aspectMask), range.baseMipLevel, range.baseArrayLayer);
+    uint32_t layer_count = range.layerCount == VK_REMAINING_ARRAY_LAYERS ? image_state->array_layers - range.baseArrayLayer
+                                                                          : range.layerCount;
+    // Layers past the end of the memory the image is bound to aren't accessible
+    ImageSubresourceData last_layer;
+    if (layer_count > 1 && !GetImageSubresourceData(device_state, image_state, range.aspectMask, range.baseMipLevel,
+                                                    range.baseArrayLayer + layer_count - 1, &last_layer)) {
+        layer_count = 1;
+    }
+    const bool is_3d = image_state->type == VK_IMAGE_TYPE_3D;
+    binding.data = subresource.data;
+    binding.format = format;
+    binding.width = blocks.width;
+    binding.height = blocks.height;
+    binding.depth = is_3d ? blocks.depth : layer_count;
+    binding.row_pitch = static_cast<size_t>(subresource.row_pitch);
+    binding.slice_pitch = static_cast<size_t>(is_3d ? subresource.depth_pitch : layout.arrayPitch);
+    const VkDeviceSize size = is_3d ? layout.size : layout.arrayPitch * (layer_count - 1) + layout.size;
+    binding.size = static_cast<uint32_t>((std::min)(size, VkDeviceSize(UINT32_MAX)));
+    return binding;
+}
+
+// Runs a dispatch of the bound compute pipeline, with the descriptors of the bound sets as they are when it executes
+static void ExecuteDispatch(DeviceState* device_state, const BoundComputeState& bound, const uint32_t base_group[3],
+                            const uint32_t group_count[3]) {
+    if (!bound.program) return;
+    ComputeDispatch dispatch;
+    dispatch.program = bound.program.get();
+    memcpy(dispatch.push_constants, bound.push_constants, sizeof(dispatch.push_constants));
+    std::copy(base_group, base_group + 3, dispatch.base_group);
+    std::copy(group_count, group_count + 3, dispatch.group_count);
+    const std::vector<ComputeResource>& resources = bound.program->resources;
+    dispatch.resources.resize(resources.size());
+    for (size_t i = 0; i < resources.size(); ++i) {
+        const ComputeResource& resource = resources[i];
+        if (resource.set >= kMaxBoundDescriptorSets || !bound.sets[resource.set]) continue;
+        DescriptorSetState* set_state = bound.sets[resource.set].get();
+        const std::vector<uint32_t>& dynamic_offsets = bound.dynamic_offsets[resource.set];
+        const size_t index = set_state->layout->Find(resource.binding);
+        if (index == set_state->layout->bindings.size()) continue;
+        const DescriptorSetLayoutBinding& binding = set_state->layout->bindings[index];
+        const uint32_t count = resource.count ? (std::min)(resource.count, binding.count) : binding.count;
+        std::lock_guard<std::mutex> lock(set_state->mutex);
+        for (uint32_t element = 0; element < count; ++element) {
+            const DescriptorState& descriptor = set_state->descriptors[binding.first + element];
+            if (IsBufferDescriptor(binding.type)) {
+                const uint32_t dynamic_index = binding.dynamic_first + element;
+                const bool dynamic = IsDynamicDescriptor(binding.type) && dynamic_index < dynamic_offsets.size();
+                const VkDeviceSize dynamic_offset = dynamic ? dynamic_offsets[dynamic_index] : 0;
+                dispatch.resources[i].push_back(GetBufferBinding(device_state, descriptor, dynamic_offset));
+            } else {
+                dispatch.resources[i].push_back(GetImageBinding(device_state, descriptor));
+            }
+        }
+    }
+    RunComputeDispatch(&device_state->compute_pool, dispatch);
+}
+
+// The bytes an image copy moves: the texel blocks the region covers at the image format's block size. Copies of one plane
+// of a multi-planar image are in that plane's texels.
+static double ImageCopyBytes(DeviceState* device_state, VkImage image, const VkImageSubresourceLayers& subresource,
+                             const VkExtent3D& extent) {
+    ImageState* image_state = nullptr;
+    if (!device_state->image_map.Find(image, &image_state)) return 0.0;
+    const FormatInfo& format = image_state->format_info;
+    const double layer_count = subresource.layerCount;
+    if (format.plane_count) {
+        const FormatPlane& plane = format.planes[GetAspectPlane(subresource.aspectMask)];
+        return layer_count * plane.block_size * extent.width * extent.height * extent.depth;
+    }
+    const MipLevelBlocks blocks = GetMipLevelBlocks(format, 0, extent, 0);
+    return layer_count * blocks.block_size * blocks.width * blocks.height * blocks.depth;
+}
+
+// vkCmdSetEvent and vkCmdResetEvent, which stamp a set event with the queue's clock for waits to catch up to
+static void SetEventFromQueue(QueueObject* queue_object, VkEvent event, bool set) {
+    EventState* event_state = GetEventState(queue_object->device_state, event);
+    if (!event_state) return;
+    if (set) event_state->gpu_time_ns = queue_object->gpu_time_ns;
+    event_state->set = set;
+    if (set) queue_object->device_state->sync_notifier.Notify();
+}
+
+// vkCmdWaitEvents. A queue worker blocks until every event is set, by the host or another queue, and the queue's clock then
+// moves on to the latest time a queue set one of them. Without a worker, waiting would block the submitting thread, which
+// is typically the one to set the events, so execution carries on as though they were set.
+static void WaitForEvents(QueueObject* queue_object, uint32_t event_count, const VkEvent* events) {
+    std::vector<EventState*> event_states;
+    for (uint32_t i = 0; i < event_count; ++i) {
+        EventState* event_state = GetEventState(queue_object->device_state, events[i]);
+        if (event_state) event_states.push_back(event_state);
+    }
+    if (event_states.empty()) return;
+    if (queue_object->worker.Running()) {
+        queue_object->worker.WaitFromExecute([&]() {
+            for (auto event_state : event_states) {
+                if (!event_state->set) return false;
+            }
+            return true;
+        });
+    }
+    for (auto event_state : event_states) {
+        queue_object->gpu_time_ns = (std::max)(queue_object->gpu_time_ns, event_state->gpu_time_ns.load());
+    }
+}
+
+// Executes a command buffer on the simulated GPU: advances the queue's clock by the cost of each command, performs buffer
+// and image transfers and compute dispatches, and writes the queries the commands produce
+static void SimulateCommands(QueueObject* queue_object, const CommandStream& commands) {
+    const CostModel& cost = GetCostModel();
+    DeviceState* device_state = queue_object->device_state;
+    BoundComputeState bound;
+    commands.ForEachCommand([&](const CommandHeader& command) {
+        double cost_ns = cost.command_ns;
+        switch (static_cast<CmdOpcode>(command.opcode)) {
+            case CmdOpcode::Draw: {
+                auto args = command.GetArgs<CmdDrawArgs>();
+                cost_ns += cost.draw_ns + cost.vertex_ns * args->vertexCount * args->instanceCount;
+                break;
+            }
+            case CmdOpcode::DrawIndexed: {
+                auto args = command.GetArgs<CmdDrawIndexedArgs>();
+                cost_ns += cost.draw_ns + cost.vertex_ns * args->indexCount * args->instanceCount;
+                break;
+            }
+            // The vertex counts of indirect draws are in GPU memory, so only the draws themselves are costed
+            case CmdOpcode::DrawIndirect:
+                cost_ns += cost.draw_ns * command.GetArgs<CmdDrawIndirectArgs>()->drawCount;
+                break;
+            case CmdOpcode::DrawIndexedIndirect:
+                cost_ns += cost.draw_ns * command.GetArgs<CmdDrawIndexedIndirectArgs>()->drawCount;
+                break;
+            case CmdOpcode::DrawIndirectCount:
+                cost_ns += cost.draw_ns * command.GetArgs<CmdDrawIndirectCountArgs>()->maxDrawCount;
+                break;
+            case CmdOpcode::DrawIndexedIndirectCount:
+                cost_ns += cost.draw_ns * command.GetArgs<CmdDrawIndexedIndirectCountArgs>()->maxDrawCount;
+                break;
+            case CmdOpcode::BindPipeline: {
+                auto args = command.GetArgs<CmdBindPipelineArgs>();
+                if (!ComputeEnabled() || args->pipelineBindPoint != VK_PIPELINE_BIND_POINT_COMPUTE) break;
+                bound.program.reset();
+                device_state->compute_pipeline_map.Find(args->pipeline, &bound.program);
+                break;
+            }
+            case CmdOpcode::BindDescriptorSets: {
+                auto args = command.GetArgs<CmdBindDescriptorSetsArgs>();
+                if (!ComputeEnabled() || args->pipelineBindPoint != VK_PIPELINE_BIND_POINT_COMPUTE) break;
+                BindComputeDescriptorSets(device_state, *args, &bound);
+                break;
+            }
+            case CmdOpcode::PushConstants: {
+                auto args = command.GetArgs<CmdPushConstantsArgs>();
+                if (!ComputeEnabled() || !(args->stageFlags & VK_SHADER_STAGE_COMPUTE_BIT)) break;
+                if (args->offset >= kMaxPushConstantSize) break;
+                const uint32_t size = (std::min)(args->size, kMaxPushConstantSize - args->offset);
+                memcpy(bound.push_constants + args->offset, args->pValues, size);
+                break;
+            }
+            case CmdOpcode::Dispatch: {
+                auto args = command.GetArgs<CmdDispatchArgs>();
+                cost_ns += cost.dispatch_ns + cost.workgroup_ns * args->groupCountX * args->groupCountY * args->groupCountZ;
+                const uint32_t base_group[3] = {0, 0, 0};
+                const uint32_t group_count[3] = {args->groupCountX, args->groupCountY, args->groupCountZ};
+                if (ComputeEnabled()) ExecuteDispatch(device_state, bound, base_group, group_count);
+                break;
+            }
+            case CmdOpcode::DispatchBase: {
+                auto args = command.GetArgs<CmdDispatchBaseArgs>();
+                cost_ns += cost.dispatch_ns + cost.workgroup_ns * args->groupCountX * args->groupCountY * args->groupCountZ;
+                const uint32_t base_group[3] = {args->baseGroupX, args->baseGroupY, args->baseGroupZ};
+                const uint32_t group_count[3] = {args->groupCountX, args->groupCountY, args->groupCountZ};
+                if (ComputeEnabled()) ExecuteDispatch(device_state, bound, base_group, group_count);
+                break;
+            }
+            // The workgroup counts of indirect dispatches are in GPU memory, which only holds them if it's bound
+            case CmdOpcode::DispatchIndirect: {
+                auto args = command.GetArgs<CmdDispatchIndirectArgs>();
+                cost_ns += cost.dispatch_ns;
+                const uint8_t* data = GetBufferData(device_state, args->buffer, args->offset, sizeof(VkDispatchIndirectCommand));
+                if (!data) break;
+                VkDispatchIndirectCommand indirect;
+                memcpy(&indirect, data, sizeof(indirect));
+                cost_ns += cost.workgroup_ns * indirect.x * indirect.y * indirect.z;
+                const uint32_t base_group[3] = {0, 0, 0};
+                const uint32_t group_count[3] = {indirect.x, indirect.y, indirect.z};
+                if (ComputeEnabled()) ExecuteDispatch(device_state, bound, base_group, group_count);
+                break;
+            }
+            case CmdOpcode::CopyBuffer: {
+                auto args = command.GetArgs<CmdCopyBufferArgs>();
+                for (uint32_t i = 0; i < args->regionCount; ++i) cost_ns += cost.copy_byte_ns * args->pRegions[i].size;
+                ExecuteCopyBuffer(device_state, *args);
+                break;
+            }
+            case CmdOpcode::UpdateBuffer: {
+                auto args = command.GetArgs<CmdUpdateBufferArgs>();
+                cost_ns += cost.copy_byte_ns * args->dataSize;
+                ExecuteUpdateBuffer(device_state, *args);
+                break;
+            }
+            case CmdOpcode::FillBuffer: {
+                auto args = command.GetArgs<CmdFillBufferArgs>();
+                cost_ns += cost.copy_byte_ns * GetFillSize(device_state, *args);
+                ExecuteFillBuffer(device_state, *args);
+                break;
+            }
+            case CmdOpcode::CopyImage: {
+                auto args = command.GetArgs<CmdCopyImageArgs>();
+                for (uint32_t i = 0; i < args->regionCount; ++i) {
+                    const VkImageCopy& region = args->pRegions[i];
+                    cost_ns += cost.copy_byte_ns *
+                               ImageCopyBytes(device_state, args->srcImage, region.srcSubresource, region.extent);
+                }
+                ExecuteCopyImage(device_state, *args);
+                break;
+            }
+            case CmdOpcode::CopyBufferToImage: {
+                auto args = command.GetArgs<CmdCopyBufferToImageArgs>();
+                for (uint32_t i = 0; i < args->regionCount; ++i) {
+                    const VkBufferImageCopy& region = args->pRegions[i];
+                    cost_ns += cost.copy_byte_ns *
+                               ImageCopyBytes(device_state, args->dstImage, region.imageSubresource, region.imageExtent);
+                }
+                ExecuteBufferImageCopy(device_state, args->srcBuffer, args->dstImage, args->regionCount, args->pRegions, true);
+                break;
+            }
+            case CmdOpcode::CopyImageToBuffer: {
+                auto args = command.GetArgs<CmdCopyImageToBufferArgs>();
+                for (uint32_t i = 0; i < args->regionCount; ++i) {
+                    const VkBufferImageCopy& region = args->pRegions[i];
+                    cost_ns += cost.copy_byte_ns *
+                               ImageCopyBytes(device_state, args->srcImage, region.imageSubresource, region.imageExtent);
+                }
+                ExecuteBufferImageCopy(device_state, args->dstBuffer, args->srcImage, args->regionCount, args->pRegions, false);
+                break;
+            }
+            case CmdOpcode::BlitImage: {
+                auto args = command.GetArgs<CmdBlitImageArgs>();
+                for (uint32_t i = 0; i < args->regionCount; ++i) {
+                    const VkImageBlit& region = args->pRegions[i];
+                    const VkExtent3D extent = {static_cast<uint32_t>(abs(region.dstOffsets[1].x - region.dstOffsets[0].x)),
+                                               static_cast<uint32_t>(abs(region.dstOffsets[1].y - region.dstOffsets[0].y)),
+                                               static_cast<uint32_t>(abs(region.dstOffsets[1].z - region.dstOffsets[0].z))};
+                    cost_ns += cost.copy_byte_ns * ImageCopyBytes(device_state, args->dstImage, region.dstSubresource, extent);
+                }
+                ExecuteBlitImage(device_state, *args);
+                break;
+            }
+            case CmdOpcode::ClearColorImage:
+                ExecuteClearColorImage(device_state, *command.GetArgs<CmdClearColorImageArgs>());
+                break;
+            case CmdOpcode::ResolveImage: {
+                auto args = command.GetArgs<CmdResolveImageArgs>();
+                for (uint32_t i = 0; i < args->regionCount; ++i) {
+                    const VkImageResolve& region = args->pRegions[i];
+                    cost_ns += cost.copy_byte_ns *
+                               ImageCopyBytes(device_state, args->dstImage, region.dstSubresource, region.extent);
+                }
+                break;
+            }
+            case CmdOpcode::ExecuteCommands: {
+                auto args = command.GetArgs<CmdExecuteCommandsArgs>();
+                for (uint32_t i = 0; i < args->commandBufferCount; ++i) {
+                    SimulateCommands(queue_object, GetCommandBufferObject(args->pCommandBuffers[i])->commands);
+                }
+                break;
+            }
+            case CmdOpcode::WriteTimestamp: {
+                auto args = command.GetArgs<CmdWriteTimestampArgs>();
+                WriteQuery(device_state, args->queryPool, args->query, GpuTimeToTicks(device_state, queue_object->gpu_time_ns));
+                break;
+            }
+            case CmdOpcode::WriteTimestamp2KHR: {
+                auto args = command.GetArgs<CmdWriteTimestamp2KHRArgs>();
+                WriteQuery(device_state, args->queryPool, args->query, GpuTimeToTicks(device_state, queue_object->gpu_time_ns));
+                break;
+            }
+            // Other queries have no meaningful results, so they complete with 0
+            case CmdOpcode::EndQuery: {
+                auto args = command.GetArgs<CmdEndQueryArgs>();
+                WriteQuery(device_state, args->queryPool, args->query, 0);
+                break;
+            }
+            case CmdOpcode::EndQueryIndexedEXT: {
+                auto args = command.GetArgs<CmdEndQueryIndexedEXTArgs>();
+                WriteQuery(device_state, args->queryPool, args->query, 0);
+                break;
+            }
+            case CmdOpcode::ResetQueryPool: {
+                auto args = command.GetArgs<CmdResetQueryPoolArgs>();
+                ResetQueries(device_state, args->queryPool, args->firstQuery, args->queryCount);
+                break;
+            }
+            case CmdOpcode::SetEvent:
+                SetEventFromQueue(queue_object, command.GetArgs<CmdSetEventArgs>()->event, true);
+                break;
+            case CmdOpcode::SetEvent2KHR:
+                SetEventFromQueue(queue_object, command.GetArgs<CmdSetEvent2KHRArgs>()->event, true);
+                break;
+            case CmdOpcode::ResetEvent:
+                SetEventFromQueue(queue_object, command.GetArgs<CmdResetEventArgs>()->event, false);
+                break;
+            case CmdOpcode::ResetEvent2KHR:
+                SetEventFromQueue(queue_object, command.GetArgs<CmdResetEvent2KHRArgs>()->event, false);
+                break;
+            case CmdOpcode::WaitEvents: {
+                auto args = command.GetArgs<CmdWaitEventsArgs>();
+                WaitForEvents(queue_object, args->eventCount, args->pEvents);
+                break;
+            }
+            case CmdOpcode::WaitEvents2KHR: {
+                auto args = command.GetArgs<CmdWaitEvents2KHRArgs>();
+                WaitForEvents(queue_object, args->eventCount, args->pEvents);
+                break;
+            }
+            default:
+                break;
+        }
+        queue_object->gpu_time_ns += cost_ns;
+    });
+}
+
+// Executes a batch on the simulated GPU and returns how long it took in nanoseconds
+static uint64_t SimulateSubmission(QueueObject* queue_object, const QueueSubmission& submission) {
+    // Work can't start before the semaphores it waits on were signaled
+    for (auto semaphore : submission.wait_semaphores) {
+        queue_object->gpu_time_ns = (std::max)(queue_object->gpu_time_ns, semaphore->gpu_time_ns);
+    }
+    for (const auto& wait : submission.timeline_waits) {
+        queue_object->gpu_time_ns = (std::max)(queue_object->gpu_time_ns, wait.semaphore->gpu_time_ns.load());
+    }
+    const double start_ns = queue_object->gpu_time_ns;
+    queue_object->gpu_time_ns += GetCostModel().submit_ns;
+    for (auto commands : submission.command_streams) SimulateCommands(queue_object, *commands);
+    for (auto semaphore : submission.signal_semaphores) semaphore->gpu_time_ns = queue_object->gpu_time_ns;
+    for (const auto& signal : submission.timeline_signals) signal.semaphore->gpu_time_ns = queue_object->gpu_time_ns;
+    return static_cast<uint64_t>(queue_object->gpu_time_ns - start_ns);
+}
+
+static bool TimelineWaitsReached(const QueueSubmission& submission) {
+    for (const auto& wait : submission.timeline_waits) {
+        if (wait.semaphore->Value() < wait.value) return false;
+    }
+    return true;
+}
+
+// Without a worker, batches execute on the thread that submits them, or on the one whose signal releases them
+static void ExecuteBatch(QueueObject* queue_object, QueueSubmission* submission) {
+    SimulateSubmission(queue_object, *submission);
+    if (submission->on_executed) submission->on_executed();
+    for (const auto& signal : submission->timeline_signals) signal.semaphore->Signal(signal.value);
+    delete submission;
+}
+
+// Without workers, a batch waiting for a timeline value that isn't reached yet is held back, along with the batches
+// submitted to its queue after it, until the host or another queue's batch signals the value. Call after signaling timeline
+// semaphores, to execute the batches the signals release.
+static void ReleaseHeldBatches(DeviceState* device_state) {
+    // Pairs with the same fence on a thread holding a batch back: either this sees the held batch, or that sees the signal
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (device_state->held_batch_count.load(std::memory_order_relaxed) == 0) return;
+    // Gather the queues first rather than executing inside ForEach with the table locked
+    std::vector<QueueObject*> queue_objects;
+    device_state->queue_map.ForEach([&](uint64_t, QueueObject* queue_object) { queue_objects.push_back(queue_object); });
+    bool released = false;
+    {
+        std::lock_guard<std::mutex> lock(device_state->held_batch_lock);
+        // A released batch's signals can release batches on queues already looked at
+        for (bool progress = true; progress;) {
+            progress = false;
+            for (auto queue_object : queue_objects) {
+                auto& held_batches = queue_object->held_batches;
+                while (!held_batches.empty() && TimelineWaitsReached(*held_batches.front())) {
+                    QueueSubmission* submission = held_batches.front();
+                    held_batches.pop_front();
+                    ExecuteBatch(queue_object, submission);
+                    // Only once it has executed, so the queue's next submission doesn't overtake it
+                    queue_object->held_batch_count.fetch_sub(1);
+                    device_state->held_batch_count.fetch_sub(1);
+                    progress = true;
+                }
+            }
+            released = released || progress;
+        }
+    }
+    // Wakes vkQueueWaitIdle and vkDeviceWaitIdle
+    if (released) device_state->sync_notifier.Notify();
+}
+
+// Without a worker, blocks until another thread's signals release every batch the queue holds back
+static void WaitForHeldBatches(QueueObject* queue_object) {
+    if (queue_object->held_batch_count.load() == 0) return;
+    queue_object->device_state->sync_notifier.Wait([&]() { return queue_object->held_batch_count.load() == 0; });
+}
+
+// Hands a queue operation's batches to the queue worker. The fence covers all of them and batches complete in order, so it
+// goes with the last one, or with an empty batch if there are none.
+static void SubmitBatches(QueueObject* queue_object, std::vector<QueueSubmission*>& submissions, VkFence fence) {
+    if (!queue_object->worker.Running()) {
+        // Without a worker, batches execute as they're submitted, and so advance timeline semaphores in submission order,
+        // until one waits for a value that isn't reached yet. It and the rest are then held back, see ReleaseHeldBatches().
+        DeviceState* device_state = queue_object->device_state;
+        size_t executed = 0;
+        bool signaled = false;
+        if (queue_object->held_batch_count.load() == 0) {
+            for (; executed < submissions.size() && TimelineWaitsReached(*submissions[executed]); ++executed) {
+                signaled = signaled || !submissions[executed]->timeline_signals.empty();
+                ExecuteBatch(queue_object, submissions[executed]);
+            }
+        }
+        if (executed < submissions.size()) {
+            std::lock_guard<std::mutex> lock(device_state->held_batch_lock);
+            const uint32_t held_count = static_cast<uint32_t>(submissions.size() - executed);
+            queue_object->held_batches.insert(queue_object->held_batches.end(), submissions.begin() + executed, submissions.end());
+            queue_object->held_batch_count.fetch_add(held_count);
+            device_state->held_batch_count.fetch_add(held_count);
+        }
+        // Signals from the batches that executed can release batches held on other queues, and the batches just held back
+        // may have been signaled since they were looked at
+        if (signaled || executed < submissions.size()) ReleaseHeldBatches(device_state);
+        return;
+    }
+    if (submissions.empty()) submissions.push_back(new QueueSubmission());
+    submissions.back()->fence = GetFenceState(queue_object->device_state, fence);
+    for (auto submission : submissions) queue_object->worker.Submit(submission);
+}
+
+// For operations that complete as soon as they're requested, such as acquiring a swapchain image
+static void SignalImmediately(DeviceState* device_state, VkSemaphore semaphore, VkFence fence) {
+    if (!AsyncQueuesEnabled()) return;
+    std::vector<SemaphoreState*> semaphore_states;
+    AddSemaphoreState(device_state, semaphore, &semaphore_states);
+    for (auto semaphore_state : semaphore_states) semaphore_state->signaled = true;
+    FenceState* fence_state = GetFenceState(device_state, fence);
+    if (fence_state) fence_state->signaled = true;
+    device_state->sync_notifier.Notify();
+}
+
+// Set VKMOCK_REFRESH_RATE to the refresh rate, in Hz, of the display swapchains present to. At the default of 0 presents
+// aren't paced.
+static double GetRefreshRate() {
+    static const double refresh_rate = GetConfigDouble("VKMOCK_REFRESH_RATE", 0.0);
+    return refresh_rate;
+}
 
 // TODO: Would like to codegen this but limits aren't in XML
 static VkPhysicalDeviceLimits SetLimits(VkPhysicalDeviceLimits *limits) {
@@ -171,7 +1445,7 @@ static VkPhysicalDeviceLimits SetLimits(VkPhysicalDeviceLimits *limits) {
     limits->storageImageSampleCounts = 0x7F;
     limits->maxSampleMaskWords = 1;
     limits->timestampComputeAndGraphics = VK_TRUE;
-    limits->timestampPeriod = 1;
+    limits->timestampPeriod = kTimestampPeriod;
     limits->maxClipDistances = 8;
     limits->maxCullDistances = 8;
     limits->maxCombinedClipAndCullDistances = 8;
@@ -204,12 +1478,7 @@ SOURCE_CPP_POSTFIX = '''
 
 static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char *funcName) {
     // TODO: This function should only care about physical device functions and return nullptr for other functions
-    const auto &item = name_to_funcptr_map.find(funcName);
-    if (item != name_to_funcptr_map.end()) {
-        return reinterpret_cast<PFN_vkVoidFunction>(item->second);
-    }
-    // Mock should intercept all functions so if we get here just return null
-    return nullptr;
+    return LookupEntryPoint(funcName);
 }
 
 } // namespace vkmock
@@ -431,62 +1700,131 @@ CUSTOM_C_INTERCEPTS = {
         return VK_ERROR_INCOMPATIBLE_DRIVER;
     }
     *pInstance = (VkInstance)CreateDispObjHandle();
-    for (auto& physical_device : physical_device_map[*pInstance])
-        physical_device = (VkPhysicalDevice)CreateDispObjHandle();
-    // TODO: If emulating specific device caps, will need to add intelligence here
+    // Loads the device profiles, if any, up front rather than in whichever query comes first
+    const uint32_t physical_device_count = GetPhysicalDeviceConfig().DeviceCount();
+    auto& physical_devices = physical_device_map[*pInstance];
+    for (uint32_t i = 0; i < physical_device_count; ++i) {
+        auto physical_device_object = new PhysicalDeviceObject();
+        set_loader_magic_value(&physical_device_object->loader_data);
+        physical_device_object->index = i;
+        physical_devices.push_back(reinterpret_cast<VkPhysicalDevice>(physical_device_object));
+    }
     return VK_SUCCESS;
 ''',
 'vkDestroyInstance': '''
     if (instance) {
         for (const auto physical_device : physical_device_map.at(instance))
-            DestroyDispObjHandle((void*)physical_device);
+            delete reinterpret_cast<PhysicalDeviceObject*>(physical_device);
         physical_device_map.erase(instance);
         DestroyDispObjHandle((void*)instance);
     }
+    // Counts so far, which leaves out this call
+    if (GetCallStats()) GetCallStats()->Dump();
 ''',
 'vkEnumeratePhysicalDevices': '''
     VkResult result_code = VK_SUCCESS;
+    const auto& physical_devices = physical_device_map.at(instance);
+    const auto physical_device_count = static_cast<uint32_t>(physical_devices.size());
     if (pPhysicalDevices) {
-        const auto return_count = (std::min)(*pPhysicalDeviceCount, icd_physical_device_count);
-        for (uint32_t i = 0; i < return_count; ++i) pPhysicalDevices[i] = physical_device_map.at(instance)[i];
-        if (return_count < icd_physical_device_count) result_code = VK_INCOMPLETE;
+        const auto return_count = (std::min)(*pPhysicalDeviceCount, physical_device_count);
+        for (uint32_t i = 0; i < return_count; ++i) pPhysicalDevices[i] = physical_devices[i];
+        if (return_count < physical_device_count) result_code = VK_INCOMPLETE;
         *pPhysicalDeviceCount = return_count;
     } else {
-        *pPhysicalDeviceCount = icd_physical_device_count;
+        *pPhysicalDeviceCount = physical_device_count;
     }
     return result_code;
 ''',
+'vkEnumeratePhysicalDeviceGroupsKHR': '''
+    const PhysicalDeviceConfig& config = GetPhysicalDeviceConfig();
+    const auto group_count = static_cast<uint32_t>(config.group_sizes.size());
+    if (!pPhysicalDeviceGroupProperties) {
+        *pPhysicalDeviceGroupCount = group_count;
+        return VK_SUCCESS;
+    }
+    const auto& physical_devices = physical_device_map.at(instance);
+    const auto return_count = (std::min)(*pPhysicalDeviceGroupCount, group_count);
+    uint32_t first_device = 0;
+    for (uint32_t i = 0; i < return_count; ++i) {
+        VkPhysicalDeviceGroupProperties& group = pPhysicalDeviceGroupProperties[i];
+        group.physicalDeviceCount = config.group_sizes[i];
+        std::fill(std::begin(group.physicalDevices), std::end(group.physicalDevices), VK_NULL_HANDLE);
+        std::copy_n(physical_devices.begin() + first_device, group.physicalDeviceCount, group.physicalDevices);
+        // Memory is host memory, so an allocation can be made on any subset of the group's devices
+        group.subsetAllocation = group.physicalDeviceCount > 1 ? VK_TRUE : VK_FALSE;
+        first_device += group.physicalDeviceCount;
+    }
+    *pPhysicalDeviceGroupCount = return_count;
+    return return_count < group_count ? VK_INCOMPLETE : VK_SUCCESS;
+''',
+'vkGetDeviceGroupPeerMemoryFeaturesKHR': '''
+    *pPeerMemoryFeatures = GetPhysicalDeviceConfig().peer_memory_features;
+''',
 'vkCreateDevice': '''
-    *pDevice = (VkDevice)CreateDispObjHandle();
+    auto device_object = new DeviceObject();
+    set_loader_magic_value(&device_object->loader_data);
+    // A device made from a device group acts like physicalDevice, which the group's other devices should match anyway
+    device_object->state.profile = GetDeviceProfile(physicalDevice);
+    device_object->state.heap_usage = &reinterpret_cast<PhysicalDeviceObject*>(physicalDevice)->heap_usage;
+    GetPhysicalDeviceMemoryProperties(physicalDevice, &device_object->state.memory_properties);
+    VkPhysicalDeviceProperties properties;
+    GetPhysicalDeviceProperties(physicalDevice, &properties);
+    VkPipelineCacheHeaderVersionOne& header = device_object->state.pipeline_cache_header;
+    header.headerSize = sizeof(header);
+    header.headerVersion = VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+    header.vendorID = properties.vendorID;
+    header.deviceID = properties.deviceID;
+    memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+    *pDevice = reinterpret_cast<VkDevice>(device_object);
     // TODO: If emulating specific device caps, will need to add intelligence here
     return VK_SUCCESS;
 ''',
 'vkDestroyDevice': '''
-    unique_lock_t lock(global_lock);
+    if (!device) return;
+    auto device_object = reinterpret_cast<DeviceObject*>(device);
     // First destroy sub-device objects
-    // Destroy Queues
-    for (auto dev_queue_map_pair : queue_map) {
-        for (auto queue_family_map_pair : queue_map[dev_queue_map_pair.first]) {
-            for (auto index_queue_pair : queue_map[dev_queue_map_pair.first][queue_family_map_pair.first]) {
-                DestroyDispObjHandle((void*)index_queue_pair.second);
-            }
-        }
-    }
-    queue_map.clear();
-    buffer_map.erase(device);
-    image_memory_size_map.erase(device);
-    // Now destroy device
-    DestroyDispObjHandle((void*)device);
+    // Destroy Queues, which stops their workers before the sync objects they use go away, along with the batches held back
+    // on queues without workers
+    device_object->state.queue_map.ForEach([](uint64_t, QueueObject* queue_object) {
+        for (auto submission : queue_object->held_batches) delete submission;
+        delete queue_object;
+    });
+    device_object->state.fence_map.ForEach([](uint64_t, FenceState* fence_state) { delete fence_state; });
+    device_object->state.query_pool_map.ForEach([](uint64_t, QueryPoolState* pool_state) { delete pool_state; });
+    device_object->state.semaphore_map.ForEach([](uint64_t, SemaphoreState* semaphore_state) { delete semaphore_state; });
+    device_object->state.timeline_semaphore_map.ForEach([](uint64_t, TimelineSemaphore* timeline) { delete timeline; });
+    device_object->state.event_map.ForEach([](uint64_t, EventState* event_state) { delete event_state; });
+    device_object->state.pipeline_cache_map.ForEach([](uint64_t, PipelineCache* cache) { delete cache; });
+    device_object->state.deferred_operation_map.ForEach([](uint64_t, DeferredOperation* operation) { delete operation; });
+    device_object->state.swapchain_map.ForEach([](uint64_t, Swapchain* swapchain_state) { delete swapchain_state; });
+    device_object->state.image_map.ForEach([](uint64_t, ImageState* image_state) { delete image_state; });
+    // Destroy command pools the app didn't, along with their command buffers
+    device_object->state.command_pool_map.ForEach([](uint64_t, CommandPoolState* pool_state) { delete pool_state; });
+    // Release the backing of any allocations the app didn't free
+    HeapUsage* heap_usage = device_object->state.heap_usage;
+    device_object->state.memory_map.ForEach([heap_usage](uint64_t, const DeviceMemoryState& memory_state) {
+        if (memory_state.heap_index != kNoHeap) heap_usage->Remove(memory_state.heap_index, memory_state.size);
+        if (!memory_state.imported) FreeBackingMemory(memory_state.data, (size_t)memory_state.size);
+    });
+    // Now destroy device, which also releases the per-device object tables
+    delete device_object;
     // TODO: If emulating specific device caps, will need to add intelligence here
 ''',
 'vkGetDeviceQueue': '''
-    unique_lock_t lock(global_lock);
-    auto queue = queue_map[device][queueFamilyIndex][queueIndex];
-    if (queue) {
-        *pQueue = queue;
-    } else {
-        *pQueue = queue_map[device][queueFamilyIndex][queueIndex] = (VkQueue)CreateDispObjHandle();
-    }
+    auto device_state = GetDeviceState(device);
+    auto queue_object = device_state->queue_map.FindOrInsert(QueueKey(queueFamilyIndex, queueIndex), [device_state]() {
+        auto queue_object = new QueueObject();
+        set_loader_magic_value(&queue_object->loader_data);
+        queue_object->device_state = device_state;
+        if (AsyncQueuesEnabled()) {
+            queue_object->worker.Start(&device_state->sync_notifier, &device_state->timeline_futex,
+                                       [queue_object](const QueueSubmission& submission) {
+                                           return SimulateSubmission(queue_object, submission);
+                                       });
+        }
+        return queue_object;
+    });
+    *pQueue = reinterpret_cast<VkQueue>(queue_object);
     // TODO: If emulating specific device caps, will need to add intelligence here
     return;
 ''',
@@ -495,6 +1833,8 @@ CUSTOM_C_INTERCEPTS = {
     // TODO: Add further support for GetDeviceQueue2 features
 ''',
 'vkEnumerateInstanceLayerProperties': '''
+    // The mock ICD has no layers
+    *pPropertyCount = 0;
     return VK_SUCCESS;
 ''',
 'vkEnumerateInstanceVersion': '''
@@ -502,55 +1842,19 @@ CUSTOM_C_INTERCEPTS = {
     return VK_SUCCESS;
 ''',
 'vkEnumerateDeviceLayerProperties': '''
+    *pPropertyCount = 0;
     return VK_SUCCESS;
 ''',
 'vkEnumerateInstanceExtensionProperties': '''
-    // If requesting number of extensions, return that
-    if (!pLayerName) {
-        if (!pProperties) {
-            *pPropertyCount = (uint32_t)instance_extension_map.size();
-        } else {
-            uint32_t i = 0;
-            for (const auto &name_ver_pair : instance_extension_map) {
-                if (i == *pPropertyCount) {
-                    break;
-                }
-                std::strncpy(pProperties[i].extensionName, name_ver_pair.first.c_str(), sizeof(pProperties[i].extensionName));
-                pProperties[i].extensionName[sizeof(pProperties[i].extensionName) - 1] = 0;
-                pProperties[i].specVersion = name_ver_pair.second;
-                ++i;
-            }
-            if (i != instance_extension_map.size()) {
-                return VK_INCOMPLETE;
-            }
-        }
-    }
-    // If requesting extension properties, fill in data struct for number of extensions
-    return VK_SUCCESS;
+    // The mock ICD has no layers, so there are no layer extensions either
+    if (pLayerName) return VK_ERROR_LAYER_NOT_PRESENT;
+    const uint32_t count = sizeof(kInstanceExtensions) / sizeof(kInstanceExtensions[0]);
+    return CopyExtensionProperties(kInstanceExtensions, count, pPropertyCount, pProperties);
 ''',
 'vkEnumerateDeviceExtensionProperties': '''
-    // If requesting number of extensions, return that
-    if (!pLayerName) {
-        if (!pProperties) {
-            *pPropertyCount = (uint32_t)device_extension_map.size();
-        } else {
-            uint32_t i = 0;
-            for (const auto &name_ver_pair : device_extension_map) {
-                if (i == *pPropertyCount) {
-                    break;
-                }
-                std::strncpy(pProperties[i].extensionName, name_ver_pair.first.c_str(), sizeof(pProperties[i].extensionName));
-                pProperties[i].extensionName[sizeof(pProperties[i].extensionName) - 1] = 0;
-                pProperties[i].specVersion = name_ver_pair.second;
-                ++i;
-            }
-            if (i != device_extension_map.size()) {
-                return VK_INCOMPLETE;
-            }
-        }
-    }
-    // If requesting extension properties, fill in data struct for number of extensions
-    return VK_SUCCESS;
+    if (pLayerName) return VK_ERROR_LAYER_NOT_PRESENT;
+    const ExtensionList extensions = GetDeviceExtensions(physicalDevice);
+    return CopyExtensionProperties(extensions.properties, extensions.count, pPropertyCount, pProperties);
 ''',
 'vkGetPhysicalDeviceSurfacePresentModesKHR': '''
     // Currently always say that all present modes are supported
@@ -628,7 +1932,8 @@ CUSTOM_C_INTERCEPTS = {
 ''',
 'vkGetPhysicalDeviceSurfaceCapabilitiesKHR': '''
     // In general just say max supported is available for requested surface
-    pSurfaceCapabilities->minImageCount = 1;
+    // One image is always on screen, so a swapchain needs a second one for the app to render to
+    pSurfaceCapabilities->minImageCount = 2;
     pSurfaceCapabilities->maxImageCount = 0;
     pSurfaceCapabilities->currentExtent.width = 0xFFFFFFFF;
     pSurfaceCapabilities->currentExtent.height = 0xFFFFFFFF;
@@ -669,51 +1974,86 @@ CUSTOM_C_INTERCEPTS = {
     if (!negotiate_loader_icd_interface_called) {
         loader_interface_version = 0;
     }
-    const auto &item = name_to_funcptr_map.find(pName);
-    if (item != name_to_funcptr_map.end()) {
-        return reinterpret_cast<PFN_vkVoidFunction>(item->second);
-    }
-    // Mock should intercept all functions so if we get here just return null
-    return nullptr;
+    return LookupEntryPoint(pName);
 ''',
 'vkGetDeviceProcAddr': '''
     return GetInstanceProcAddr(nullptr, pName);
 ''',
 'vkGetPhysicalDeviceMemoryProperties': '''
-    pMemoryProperties->memoryTypeCount = 2;
-    pMemoryProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    pMemoryProperties->memoryTypes[0].heapIndex = 0;
-    pMemoryProperties->memoryTypes[1].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    pMemoryProperties->memoryTypes[1].heapIndex = 1;
-    pMemoryProperties->memoryHeapCount = 2;
-    pMemoryProperties->memoryHeaps[0].flags = 0;
-    pMemoryProperties->memoryHeaps[0].size = 8000000000;
-    pMemoryProperties->memoryHeaps[1].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
-    pMemoryProperties->memoryHeaps[1].size = 8000000000;
+    const DeviceProfile* profile = GetDeviceProfile(physicalDevice);
+    if (profile && profile->Has(kProfileMemoryProperties)) {
+        *pMemoryProperties = profile->MemoryProperties();
+    } else {
+        pMemoryProperties->memoryTypeCount = 2;
+        pMemoryProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        pMemoryProperties->memoryTypes[0].heapIndex = 0;
+        pMemoryProperties->memoryTypes[1].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        pMemoryProperties->memoryTypes[1].heapIndex = 1;
+        pMemoryProperties->memoryHeapCount = 2;
+        pMemoryProperties->memoryHeaps[0].flags = 0;
+        pMemoryProperties->memoryHeaps[0].size = 8000000000;
+        pMemoryProperties->memoryHeaps[1].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+        pMemoryProperties->memoryHeaps[1].size = 8000000000;
+    }
+    const auto& heap_sizes = GetHeapSizes();
+    for (uint32_t i = 0; i < pMemoryProperties->memoryHeapCount && i < heap_sizes.size(); ++i) {
+        if (heap_sizes[i]) pMemoryProperties->memoryHeaps[i].size = heap_sizes[i];
+    }
 ''',
 'vkGetPhysicalDeviceMemoryProperties2KHR': '''
     GetPhysicalDeviceMemoryProperties(physicalDevice, &pMemoryProperties->memoryProperties);
+    const auto *budget_props = lvl_find_in_chain<VkPhysicalDeviceMemoryBudgetPropertiesEXT>(pMemoryProperties->pNext);
+    if (budget_props) {
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT* write_props = (VkPhysicalDeviceMemoryBudgetPropertiesEXT*)budget_props;
+        // Nothing else shares the heaps, so all of each one is the budget
+        const VkPhysicalDeviceMemoryProperties& memory_properties = pMemoryProperties->memoryProperties;
+        const HeapUsage& heap_usage = reinterpret_cast<PhysicalDeviceObject*>(physicalDevice)->heap_usage;
+        for (uint32_t i = 0; i < VK_MAX_MEMORY_HEAPS; ++i) {
+            const bool valid_heap = i < memory_properties.memoryHeapCount;
+            write_props->heapBudget[i] = valid_heap ? memory_properties.memoryHeaps[i].size : 0;
+            write_props->heapUsage[i] = valid_heap ? heap_usage.Get(i) : 0;
+        }
+    }
 ''',
 'vkGetPhysicalDeviceQueueFamilyProperties': '''
+    const DeviceProfile* profile = GetDeviceProfile(physicalDevice);
+    if (profile && profile->Has(kProfileQueueFamilies)) {
+        if (!pQueueFamilyProperties) {
+            *pQueueFamilyPropertyCount = profile->QueueFamilyCount();
+        } else {
+            *pQueueFamilyPropertyCount = (std::min)(*pQueueFamilyPropertyCount, profile->QueueFamilyCount());
+            std::copy(profile->QueueFamilies(), profile->QueueFamilies() + *pQueueFamilyPropertyCount, pQueueFamilyProperties);
+        }
+        return;
+    }
     if (!pQueueFamilyProperties) {
         *pQueueFamilyPropertyCount = 1;
     } else {
         if (*pQueueFamilyPropertyCount) {
             pQueueFamilyProperties[0].queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT | VK_QUEUE_SPARSE_BINDING_BIT;
             pQueueFamilyProperties[0].queueCount = 1;
-            pQueueFamilyProperties[0].timestampValidBits = 0;
+            pQueueFamilyProperties[0].timestampValidBits = 64;
             pQueueFamilyProperties[0].minImageTransferGranularity = {1,1,1};
+            *pQueueFamilyPropertyCount = 1;
         }
     }
 ''',
 'vkGetPhysicalDeviceQueueFamilyProperties2KHR': '''
-    if (pQueueFamilyPropertyCount && pQueueFamilyProperties) {
-        GetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, &pQueueFamilyProperties->queueFamilyProperties);
-    } else {
+    if (!pQueueFamilyProperties) {
         GetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, nullptr);
+        return;
     }
+    // The VkQueueFamilyProperties are spaced out by the pNext chains around them, so gather them and copy them over
+    std::vector<VkQueueFamilyProperties> properties(*pQueueFamilyPropertyCount);
+    if (!properties.empty()) GetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, properties.data());
+    for (uint32_t i = 0; i < *pQueueFamilyPropertyCount; ++i) pQueueFamilyProperties[i].queueFamilyProperties = properties[i];
 ''',
 'vkGetPhysicalDeviceFeatures': '''
+    const DeviceProfile* profile = GetDeviceProfile(physicalDevice);
+    if (profile && profile->Has(kProfileFeatures)) {
+        *pFeatures = profile->Features();
+        return;
+    }
     uint32_t num_bools = sizeof(VkPhysicalDeviceFeatures) / sizeof(VkBool32);
     VkBool32 *bool_array = &pFeatures->robustBufferAccess;
     SetBoolArrayTrue(bool_array, num_bools);
@@ -736,8 +2076,17 @@ CUSTOM_C_INTERCEPTS = {
         feat_bools = (VkBool32*)&blendop_features->advancedBlendCoherentOperations;
         SetBoolArrayTrue(feat_bools, num_bools);
     }
+    const auto *timeline_features = lvl_find_in_chain<VkPhysicalDeviceTimelineSemaphoreFeaturesKHR>(pFeatures->pNext);
+    if (timeline_features) {
+        ((VkPhysicalDeviceTimelineSemaphoreFeaturesKHR*)timeline_features)->timelineSemaphore = VK_TRUE;
+    }
 ''',
 'vkGetPhysicalDeviceFormatProperties': '''
+    const DeviceProfile* profile = GetDeviceProfile(physicalDevice);
+    if (profile && profile->Has(kProfileFormats)) {
+        *pFormatProperties = profile->GetFormatProperties(format);
+        return;
+    }
     if (VK_FORMAT_UNDEFINED == format) {
         *pFormatProperties = { 0x0, 0x0, 0x0 };
     } else {
@@ -763,8 +2112,14 @@ CUSTOM_C_INTERCEPTS = {
     GetPhysicalDeviceFormatProperties(physicalDevice, format, &pFormatProperties->formatProperties);
 ''',
 'vkGetPhysicalDeviceImageFormatProperties': '''
-    // A hardcoded unsupported format
-    if (format == VK_FORMAT_E5B9G9R9_UFLOAT_PACK32) {
+    const DeviceProfile* profile = GetDeviceProfile(physicalDevice);
+    if (profile && profile->Has(kProfileFormats)) {
+        const VkFormatProperties format_properties = profile->GetFormatProperties(format);
+        if (!(tiling == VK_IMAGE_TILING_LINEAR ? format_properties.linearTilingFeatures : format_properties.optimalTilingFeatures)) {
+            return VK_ERROR_FORMAT_NOT_SUPPORTED;
+        }
+    } else if (format == VK_FORMAT_E5B9G9R9_UFLOAT_PACK32) {
+        // A hardcoded unsupported format
         return VK_ERROR_FORMAT_NOT_SUPPORTED;
     }
 
@@ -776,6 +2131,23 @@ CUSTOM_C_INTERCEPTS = {
         // We hard-code support for all sample counts except 64 bits.
         *pImageFormatProperties = { { 4096, 4096, 256 }, 12, 256, 0x7F & ~VK_SAMPLE_COUNT_64_BIT, 4294967296 };
     }
+    if (profile && profile->Has(kProfileProperties)) {
+        // Size images by the profile's limits instead
+        const VkPhysicalDeviceLimits& limits = profile->Properties().limits;
+        VkExtent3D& max_extent = pImageFormatProperties->maxExtent;
+        if (type == VK_IMAGE_TYPE_1D) {
+            max_extent = {limits.maxImageDimension1D, 1, 1};
+        } else if (type == VK_IMAGE_TYPE_2D) {
+            max_extent = {limits.maxImageDimension2D, limits.maxImageDimension2D, 1};
+        } else {
+            max_extent = {limits.maxImageDimension3D, limits.maxImageDimension3D, limits.maxImageDimension3D};
+        }
+        if (VK_IMAGE_TILING_LINEAR != tiling) {
+            pImageFormatProperties->maxMipLevels = 1;
+            for (uint32_t size = max_extent.width; size > 1; size >>= 1) ++pImageFormatProperties->maxMipLevels;
+            pImageFormatProperties->maxArrayLayers = (type == VK_IMAGE_TYPE_3D) ? 1 : limits.maxImageArrayLayers;
+        }
+    }
     return VK_SUCCESS;
 ''',
 'vkGetPhysicalDeviceImageFormatProperties2KHR': '''
@@ -783,6 +2155,13 @@ CUSTOM_C_INTERCEPTS = {
     return VK_SUCCESS;
 ''',
 'vkGetPhysicalDeviceProperties': '''
+    const DeviceProfile* profile = GetDeviceProfile(physicalDevice);
+    if (profile && profile->Has(kProfileProperties)) {
+        *pProperties = profile->Properties();
+        // Whatever the profiled device supports, only the core versions the mock ICD implements are available
+        pProperties->apiVersion = (std::min)(pProperties->apiVersion, kSupportedVulkanAPIVersion);
+        return;
+    }
     // TODO: Just hard-coding some values for now
     pProperties->apiVersion = kSupportedVulkanAPIVersion;
     pProperties->driverVersion = 1;
@@ -825,6 +2204,12 @@ CUSTOM_C_INTERCEPTS = {
         write_props->maxDescriptorSetUpdateAfterBindInputAttachments = 500000;
     }
 
+    const auto *timeline_props = lvl_find_in_chain<VkPhysicalDeviceTimelineSemaphorePropertiesKHR>(pProperties->pNext);
+    if (timeline_props) {
+        // Counters are full 64-bit values
+        ((VkPhysicalDeviceTimelineSemaphorePropertiesKHR*)timeline_props)->maxTimelineSemaphoreValueDifference = UINT64_MAX;
+    }
+
     const auto *push_descriptor_props = lvl_find_in_chain<VkPhysicalDevicePushDescriptorPropertiesKHR>(pProperties->pNext);
     if (push_descriptor_props) {
         VkPhysicalDevicePushDescriptorPropertiesKHR* write_props = (VkPhysicalDevicePushDescriptorPropertiesKHR*)push_descriptor_props;
@@ -862,21 +2247,60 @@ CUSTOM_C_INTERCEPTS = {
     pExternalBufferProperties->externalMemoryProperties.exportFromImportedHandleTypes = 0x1FF;
     pExternalBufferProperties->externalMemoryProperties.compatibleHandleTypes = 0x1FF;
 ''',
-'vkGetPhysicalDeviceExternalBufferPropertiesKHR':'''
-    GetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+'vkGetPhysicalDeviceExternalBufferPropertiesKHR':'''
+    GetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+''',
+'vkBindBufferMemory': '''
+    // Transfers look the memory up when they execute, so freeing it first only makes them skip the buffer
+    auto device_state = GetDeviceState(device);
+    BufferState buffer_state;
+    if (!device_state->buffer_map.Find(buffer, &buffer_state)) return VK_SUCCESS;
+    buffer_state.memory = memory;
+    buffer_state.memory_offset = memoryOffset;
+    device_state->buffer_map.Insert(buffer, buffer_state);
+    return VK_SUCCESS;
+''',
+'vkBindBufferMemory2KHR': '''
+    for (uint32_t i = 0; i < bindInfoCount; ++i) {
+        BindBufferMemory(device, pBindInfos[i].buffer, pBindInfos[i].memory, pBindInfos[i].memoryOffset);
+    }
+    return VK_SUCCESS;
+''',
+'vkBindImageMemory': '''
+    ImageState* image_state = nullptr;
+    if (!GetDeviceState(device)->image_map.Find(image, &image_state)) return VK_SUCCESS;
+    // Bound as a whole, every plane's offset counts from the start of the image
+    for (uint32_t plane = 0; plane < 3; ++plane) {
+        image_state->memory[plane] = memory;
+        image_state->memory_offset[plane] = memoryOffset;
+    }
+    return VK_SUCCESS;
+''',
+'vkBindImageMemory2KHR': '''
+    for (uint32_t i = 0; i < bindInfoCount; ++i) {
+        const VkBindImageMemoryInfo& bind_info = pBindInfos[i];
+        // Each plane of a disjoint image is bound on its own
+        const auto *plane_info = lvl_find_in_chain<VkBindImagePlaneMemoryInfo>(bind_info.pNext);
+        ImageState* image_state = nullptr;
+        if (plane_info && GetDeviceState(device)->image_map.Find(bind_info.image, &image_state)) {
+            const uint32_t plane = GetAspectPlane(plane_info->planeAspect);
+            image_state->memory[plane] = bind_info.memory;
+            image_state->memory_offset[plane] = bind_info.memoryOffset;
+        } else {
+            BindImageMemory(device, bind_info.image, bind_info.memory, bind_info.memoryOffset);
+        }
+    }
+    return VK_SUCCESS;
 ''',
 'vkGetBufferMemoryRequirements': '''
     // TODO: Just hard-coding reqs for now
     pMemoryRequirements->size = 4096;
     pMemoryRequirements->alignment = 1;
-    pMemoryRequirements->memoryTypeBits = 0xFFFF;
+    pMemoryRequirements->memoryTypeBits = GetAllMemoryTypeBits(GetDeviceState(device)->profile);
     // Return a better size based on the buffer size from the create info.
-    auto d_iter = buffer_map.find(device);
-    if (d_iter != buffer_map.end()) {
-        auto iter = d_iter->second.find(buffer);
-        if (iter != d_iter->second.end()) {
-            pMemoryRequirements->size = ((iter->second.size + 4095) / 4096) * 4096;
-        }
+    BufferState buffer_state;
+    if (GetDeviceState(device)->buffer_map.Find(buffer, &buffer_state)) {
+        pMemoryRequirements->size = ((buffer_state.size + 4095) / 4096) * 4096;
     }
 ''',
 'vkGetBufferMemoryRequirements2KHR': '''
@@ -884,130 +2308,870 @@ CUSTOM_C_INTERCEPTS = {
 ''',
 'vkGetImageMemoryRequirements': '''
     pMemoryRequirements->size = 0;
-    pMemoryRequirements->alignment = 1;
-
-    auto d_iter = image_memory_size_map.find(device);
-    if(d_iter != image_memory_size_map.end()){
-        auto iter = d_iter->second.find(image);
-        if (iter != d_iter->second.end()) {
-            pMemoryRequirements->size = iter->second;
-        }
-    }
+    pMemoryRequirements->alignment = kImageLayoutAlignment;
+    ImageState* image_state = nullptr;
+    if (GetDeviceState(device)->image_map.Find(image, &image_state)) pMemoryRequirements->size = image_state->layout.Size();
     // Here we hard-code that the memory type at index 3 doesn't support this image.
-    pMemoryRequirements->memoryTypeBits = 0xFFFF & ~(0x1 << 3);
+    pMemoryRequirements->memoryTypeBits = GetAllMemoryTypeBits(GetDeviceState(device)->profile) & ~(0x1 << 3);
 ''',
 'vkGetImageMemoryRequirements2KHR': '''
     GetImageMemoryRequirements(device, pInfo->image, &pMemoryRequirements->memoryRequirements);
+    // Each plane of a disjoint image is bound on its own
+    const auto *plane_info = lvl_find_in_chain<VkImagePlaneMemoryRequirementsInfo>(pInfo->pNext);
+    ImageState* image_state = nullptr;
+    if (plane_info && GetDeviceState(device)->image_map.Find(pInfo->image, &image_state)) {
+        pMemoryRequirements->memoryRequirements.size = image_state->layout.PlaneSize(GetAspectPlane(plane_info->planeAspect));
+    }
+''',
+'vkAllocateMemory': '''
+    auto device_state = GetDeviceState(device);
+    const VkPhysicalDeviceMemoryProperties& memory_properties = device_state->memory_properties;
+    DeviceMemoryState memory_state = {nullptr, pAllocateInfo->allocationSize, false, kNoHeap};
+    if (pAllocateInfo->memoryTypeIndex < memory_properties.memoryTypeCount) {
+        const uint32_t heap_index = memory_properties.memoryTypes[pAllocateInfo->memoryTypeIndex].heapIndex;
+        const VkDeviceSize limit = HeapSizeEnforced() ? memory_properties.memoryHeaps[heap_index].size : 0;
+        if (!device_state->heap_usage->Add(heap_index, memory_state.size, limit)) return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+        memory_state.heap_index = heap_index;
+    }
+    const auto *host_pointer_info = lvl_find_in_chain<VkImportMemoryHostPointerInfoEXT>(pAllocateInfo->pNext);
+    if (host_pointer_info && host_pointer_info->handleType) {
+        // Imported host memory is already the backing store
+        memory_state.data = host_pointer_info->pHostPointer;
+        memory_state.imported = true;
+    } else if (pAllocateInfo->allocationSize <= SIZE_MAX) {
+        memory_state.data = AllocateBackingMemory((size_t)pAllocateInfo->allocationSize);
+    }
+    if (!memory_state.data) {
+        if (memory_state.heap_index != kNoHeap) device_state->heap_usage->Remove(memory_state.heap_index, memory_state.size);
+        return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    *pMemory = (VkDeviceMemory)AllocateNonDispHandle();
+    device_state->memory_map.Insert(*pMemory, memory_state);
+    return VK_SUCCESS;
+''',
+'vkFreeMemory': '''
+    if (!memory) return;
+    auto device_state = GetDeviceState(device);
+    DeviceMemoryState memory_state;
+    if (!device_state->memory_map.Erase(memory, &memory_state)) return;
+    if (memory_state.heap_index != kNoHeap) device_state->heap_usage->Remove(memory_state.heap_index, memory_state.size);
+    if (!memory_state.imported) FreeBackingMemory(memory_state.data, (size_t)memory_state.size);
 ''',
 'vkMapMemory': '''
-    unique_lock_t lock(global_lock);
-    if (VK_WHOLE_SIZE == size) {
-        if (allocated_memory_size_map.count(memory) != 0)
-            size = allocated_memory_size_map[memory] - offset;
-        else
-            size = 0x10000;
-    }
-    void* map_addr = malloc((size_t)size);
-    mapped_memory_map[memory].push_back(map_addr);
-    *ppData = map_addr;
+    // Every mapping aliases the allocation's backing store, so writes persist and nothing is copied or allocated here
+    DeviceMemoryState memory_state;
+    if (!GetDeviceState(device)->memory_map.Find(memory, &memory_state)) return VK_ERROR_MEMORY_MAP_FAILED;
+    *ppData = static_cast<uint8_t*>(memory_state.data) + offset;
     return VK_SUCCESS;
 ''',
 'vkUnmapMemory': '''
-    unique_lock_t lock(global_lock);
-    for (auto map_addr : mapped_memory_map[memory]) {
-        free(map_addr);
-    }
-    mapped_memory_map.erase(memory);
+    // The backing store lives until FreeMemory, so there is nothing to release here
 ''',
 'vkGetImageSubresourceLayout': '''
     // Need safe values. Callers are computing memory offsets from pLayout, with no return code to flag failure.
     *pLayout = VkSubresourceLayout(); // Default constructor zero values.
+    ImageState* image_state = nullptr;
+    if (GetDeviceState(device)->image_map.Find(image, &image_state)) {
+        *pLayout = image_state->layout.Subresource(GetAspectPlane(pSubresource->aspectMask), pSubresource->mipLevel, pSubresource->arrayLayer);
+    }
 ''',
 'vkCreateSwapchainKHR': '''
-    unique_lock_t lock(global_lock);
-    *pSwapchain = (VkSwapchainKHR)global_unique_handle++;
-    for(uint32_t i = 0; i < icd_swapchain_image_count; ++i){
-        swapchain_image_map[*pSwapchain][i] = (VkImage)global_unique_handle++;
+    auto device_state = GetDeviceState(device);
+    // As many images as the app asks for. Once presenting starts one is always on screen, so the app can hold all but one.
+    std::vector<VkImage> images((std::max)(pCreateInfo->minImageCount, 1u));
+    for (auto& image : images) image = (VkImage)AllocateNonDispHandle();
+    Swapchain* old_swapchain_state = nullptr;
+    if (pCreateInfo->oldSwapchain && device_state->swapchain_map.Find(pCreateInfo->oldSwapchain, &old_swapchain_state)) {
+        old_swapchain_state->Retire();
+    }
+    *pSwapchain = (VkSwapchainKHR)AllocateNonDispHandle();
+    device_state->swapchain_map.Insert(*pSwapchain, new Swapchain(images, pCreateInfo->presentMode, GetRefreshRate()));
+    return VK_SUCCESS;
+''',
+'vkCreateSharedSwapchainsKHR': '''
+    for (uint32_t i = 0; i < swapchainCount; ++i) {
+        CreateSwapchainKHR(device, &pCreateInfos[i], pAllocator, &pSwapchains[i]);
     }
     return VK_SUCCESS;
 ''',
 'vkDestroySwapchainKHR': '''
-    unique_lock_t lock(global_lock);
-    swapchain_image_map.clear();
+    Swapchain* swapchain_state = nullptr;
+    if (swapchain && GetDeviceState(device)->swapchain_map.Erase(swapchain, &swapchain_state)) delete swapchain_state;
 ''',
 'vkGetSwapchainImagesKHR': '''
+    Swapchain* swapchain_state = nullptr;
+    if (!GetDeviceState(device)->swapchain_map.Find(swapchain, &swapchain_state)) return VK_ERROR_SURFACE_LOST_KHR;
+    const auto& images = swapchain_state->Images();
+    const auto image_count = static_cast<uint32_t>(images.size());
     if (!pSwapchainImages) {
-        *pSwapchainImageCount = icd_swapchain_image_count;
+        *pSwapchainImageCount = image_count;
+        return VK_SUCCESS;
+    }
+    const auto return_count = (std::min)(*pSwapchainImageCount, image_count);
+    std::copy_n(images.begin(), return_count, pSwapchainImages);
+    *pSwapchainImageCount = return_count;
+    return return_count < image_count ? VK_INCOMPLETE : VK_SUCCESS;
+''',
+'vkAcquireNextImageKHR': '''
+    auto device_state = GetDeviceState(device);
+    Swapchain* swapchain_state = nullptr;
+    if (!device_state->swapchain_map.Find(swapchain, &swapchain_state)) return VK_ERROR_SURFACE_LOST_KHR;
+    // Blocks until the presentation engine releases an image, so the image is ready as soon as it's acquired
+    const VkResult result = swapchain_state->Acquire(timeout, pImageIndex);
+    if (result == VK_SUCCESS) SignalImmediately(device_state, semaphore, fence);
+    return result;
+''',
+'vkAcquireNextImage2KHR': '''
+    return AcquireNextImageKHR(device, pAcquireInfo->swapchain, pAcquireInfo->timeout, pAcquireInfo->semaphore,
+                               pAcquireInfo->fence, pImageIndex);
+''',
+'vkQueuePresentKHR': '''
+    auto queue_object = GetQueueObject(queue);
+    auto device_state = queue_object->device_state;
+    std::vector<std::pair<Swapchain*, uint32_t>> presents;
+    for (uint32_t i = 0; i < pPresentInfo->swapchainCount; ++i) {
+        Swapchain* swapchain_state = nullptr;
+        const bool found = device_state->swapchain_map.Find(pPresentInfo->pSwapchains[i], &swapchain_state);
+        if (found) presents.emplace_back(swapchain_state, pPresentInfo->pImageIndices[i]);
+        if (pPresentInfo->pResults) pPresentInfo->pResults[i] = found ? VK_SUCCESS : VK_ERROR_SURFACE_LOST_KHR;
+    }
+    const auto present = [presents]() {
+        for (const auto& swapchain_image : presents) swapchain_image.first->Present(swapchain_image.second);
+    };
+    if (queue_object->worker.Running() || queue_object->held_batch_count.load()) {
+        // Presenting consumes the wait semaphores once earlier work on the queue has signaled them, and the images go to
+        // the presentation engine after that. Without a worker, that's once the batches the queue holds back execute.
+        std::vector<QueueSubmission*> submissions(1, new QueueSubmission());
+        for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
+            AddSemaphoreState(device_state, pPresentInfo->pWaitSemaphores[i], &submissions[0]->wait_semaphores);
+        }
+        submissions[0]->on_executed = present;
+        SubmitBatches(queue_object, submissions, VK_NULL_HANDLE);
     } else {
-        unique_lock_t lock(global_lock);
-        for (uint32_t img_i = 0; img_i < (std::min)(*pSwapchainImageCount, icd_swapchain_image_count); ++img_i){
-            pSwapchainImages[img_i] = swapchain_image_map.at(swapchain)[img_i];
+        present();
+    }
+    return VK_SUCCESS;
+''',
+'vkQueueSubmit': '''
+    auto queue_object = GetQueueObject(queue);
+    auto device_state = queue_object->device_state;
+    std::vector<QueueSubmission*> submissions;
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        const VkSubmitInfo& submit = pSubmits[i];
+        auto submission = new QueueSubmission();
+        VkTimelineSemaphoreSubmitInfo values = {};
+        auto timeline_info = lvl_find_in_chain<VkTimelineSemaphoreSubmitInfo>(submit.pNext);
+        if (timeline_info) values = *timeline_info;
+        for (uint32_t j = 0; j < submit.waitSemaphoreCount; ++j) {
+            const uint64_t value = GetTimelineValue(values.pWaitSemaphoreValues, values.waitSemaphoreValueCount, j);
+            AddSemaphoreState(device_state, submit.pWaitSemaphores[j], value, &submission->wait_semaphores,
+                              &submission->timeline_waits);
         }
-
-        if (*pSwapchainImageCount < icd_swapchain_image_count) return VK_INCOMPLETE;
-        else if (*pSwapchainImageCount > icd_swapchain_image_count) *pSwapchainImageCount = icd_swapchain_image_count;
+        for (uint32_t j = 0; j < submit.commandBufferCount; ++j) {
+            submission->command_streams.push_back(&GetCommandBufferObject(submit.pCommandBuffers[j])->commands);
+        }
+        for (uint32_t j = 0; j < submit.signalSemaphoreCount; ++j) {
+            const uint64_t value = GetTimelineValue(values.pSignalSemaphoreValues, values.signalSemaphoreValueCount, j);
+            AddSemaphoreState(device_state, submit.pSignalSemaphores[j], value, &submission->signal_semaphores,
+                              &submission->timeline_signals);
+        }
+        submissions.push_back(submission);
     }
+    SubmitBatches(queue_object, submissions, fence);
     return VK_SUCCESS;
 ''',
-'vkAcquireNextImageKHR': '''
-    *pImageIndex = 0;
+'vkQueueSubmit2KHR': '''
+    auto queue_object = GetQueueObject(queue);
+    auto device_state = queue_object->device_state;
+    std::vector<QueueSubmission*> submissions;
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        const VkSubmitInfo2KHR& submit = pSubmits[i];
+        auto submission = new QueueSubmission();
+        for (uint32_t j = 0; j < submit.waitSemaphoreInfoCount; ++j) {
+            const VkSemaphoreSubmitInfoKHR& wait = submit.pWaitSemaphoreInfos[j];
+            AddSemaphoreState(device_state, wait.semaphore, wait.value, &submission->wait_semaphores, &submission->timeline_waits);
+        }
+        for (uint32_t j = 0; j < submit.commandBufferInfoCount; ++j) {
+            submission->command_streams.push_back(&GetCommandBufferObject(submit.pCommandBufferInfos[j].commandBuffer)->commands);
+        }
+        for (uint32_t j = 0; j < submit.signalSemaphoreInfoCount; ++j) {
+            const VkSemaphoreSubmitInfoKHR& signal = submit.pSignalSemaphoreInfos[j];
+            AddSemaphoreState(device_state, signal.semaphore, signal.value, &submission->signal_semaphores,
+                              &submission->timeline_signals);
+        }
+        submissions.push_back(submission);
+    }
+    SubmitBatches(queue_object, submissions, fence);
     return VK_SUCCESS;
 ''',
-'vkAcquireNextImage2KHR': '''
-    *pImageIndex = 0;
+'vkQueueBindSparse': '''
+    auto queue_object = GetQueueObject(queue);
+    auto device_state = queue_object->device_state;
+    std::vector<QueueSubmission*> submissions;
+    for (uint32_t i = 0; i < bindInfoCount; ++i) {
+        const VkBindSparseInfo& bind_info = pBindInfo[i];
+        auto submission = new QueueSubmission();
+        VkTimelineSemaphoreSubmitInfo values = {};
+        auto timeline_info = lvl_find_in_chain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
+        if (timeline_info) values = *timeline_info;
+        for (uint32_t j = 0; j < bind_info.waitSemaphoreCount; ++j) {
+            const uint64_t value = GetTimelineValue(values.pWaitSemaphoreValues, values.waitSemaphoreValueCount, j);
+            AddSemaphoreState(device_state, bind_info.pWaitSemaphores[j], value, &submission->wait_semaphores,
+                              &submission->timeline_waits);
+        }
+        for (uint32_t j = 0; j < bind_info.signalSemaphoreCount; ++j) {
+            const uint64_t value = GetTimelineValue(values.pSignalSemaphoreValues, values.signalSemaphoreValueCount, j);
+            AddSemaphoreState(device_state, bind_info.pSignalSemaphores[j], value, &submission->signal_semaphores,
+                              &submission->timeline_signals);
+        }
+        submissions.push_back(submission);
+    }
+    SubmitBatches(queue_object, submissions, fence);
+    return VK_SUCCESS;
+''',
+'vkQueueWaitIdle': '''
+    auto queue_object = GetQueueObject(queue);
+    if (queue_object->worker.Running()) {
+        queue_object->worker.WaitIdle();
+    } else {
+        WaitForHeldBatches(queue_object);
+    }
+    return VK_SUCCESS;
+''',
+'vkDeviceWaitIdle': '''
+    // Gather the queues first rather than blocking inside ForEach with the table locked
+    std::vector<QueueObject*> queue_objects;
+    GetDeviceState(device)->queue_map.ForEach([&](uint64_t, QueueObject* queue_object) { queue_objects.push_back(queue_object); });
+    for (auto queue_object : queue_objects) {
+        if (queue_object->worker.Running()) {
+            queue_object->worker.WaitIdle();
+        } else {
+            WaitForHeldBatches(queue_object);
+        }
+    }
+    return VK_SUCCESS;
+''',
+'vkCreateFence': '''
+    *pFence = (VkFence)AllocateNonDispHandle();
+    if (AsyncQueuesEnabled()) {
+        auto fence_state = new FenceState();
+        fence_state->signaled = (pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT) != 0;
+        GetDeviceState(device)->fence_map.Insert(*pFence, fence_state);
+    }
+    return VK_SUCCESS;
+''',
+'vkDestroyFence': '''
+    FenceState* fence_state = nullptr;
+    if (fence && GetDeviceState(device)->fence_map.Erase(fence, &fence_state)) delete fence_state;
+''',
+'vkResetFences': '''
+    auto device_state = GetDeviceState(device);
+    for (uint32_t i = 0; i < fenceCount; ++i) {
+        FenceState* fence_state = GetFenceState(device_state, pFences[i]);
+        if (fence_state) fence_state->signaled = false;
+    }
+    return VK_SUCCESS;
+''',
+'vkCreateEvent': '''
+    *pEvent = (VkEvent)AllocateNonDispHandle();
+    GetDeviceState(device)->event_map.Insert(*pEvent, new EventState());
+    return VK_SUCCESS;
+''',
+'vkDestroyEvent': '''
+    EventState* event_state = nullptr;
+    if (event && GetDeviceState(device)->event_map.Erase(event, &event_state)) delete event_state;
+''',
+'vkGetEventStatus': '''
+    EventState* event_state = GetEventState(GetDeviceState(device), event);
+    return (!event_state || event_state->set) ? VK_EVENT_SET : VK_EVENT_RESET;
+''',
+'vkSetEvent': '''
+    auto device_state = GetDeviceState(device);
+    EventState* event_state = GetEventState(device_state, event);
+    if (event_state) {
+        event_state->set = true;
+        device_state->sync_notifier.Notify();
+    }
+    return VK_SUCCESS;
+''',
+'vkResetEvent': '''
+    EventState* event_state = GetEventState(GetDeviceState(device), event);
+    if (event_state) event_state->set = false;
+    return VK_SUCCESS;
+''',
+'vkGetFenceStatus': '''
+    FenceState* fence_state = GetFenceState(GetDeviceState(device), fence);
+    return (!fence_state || fence_state->signaled) ? VK_SUCCESS : VK_NOT_READY;
+''',
+'vkWaitForFences': '''
+    auto device_state = GetDeviceState(device);
+    std::vector<FenceState*> fence_states;
+    for (uint32_t i = 0; i < fenceCount; ++i) {
+        FenceState* fence_state = GetFenceState(device_state, pFences[i]);
+        if (fence_state) fence_states.push_back(fence_state);
+    }
+    if (fence_states.empty()) return VK_SUCCESS;
+    auto fences_done = [&]() {
+        for (auto fence_state : fence_states) {
+            const bool signaled = fence_state->signaled;
+            if (waitAll && !signaled) return false;
+            if (!waitAll && signaled) return true;
+        }
+        return waitAll == VK_TRUE;
+    };
+    return device_state->sync_notifier.WaitFor(timeout, fences_done) ? VK_SUCCESS : VK_TIMEOUT;
+''',
+'vkCreateSemaphore': '''
+    *pSemaphore = (VkSemaphore)AllocateNonDispHandle();
+    auto device_state = GetDeviceState(device);
+    auto type_info = lvl_find_in_chain<VkSemaphoreTypeCreateInfo>(pCreateInfo->pNext);
+    if (type_info && type_info->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE) {
+        device_state->timeline_semaphore_map.Insert(*pSemaphore,
+                                                    new TimelineSemaphore(type_info->initialValue, &device_state->timeline_futex));
+    } else if (AsyncQueuesEnabled()) {
+        device_state->semaphore_map.Insert(*pSemaphore, new SemaphoreState());
+    }
+    return VK_SUCCESS;
+''',
+'vkDestroySemaphore': '''
+    if (!semaphore) return;
+    auto device_state = GetDeviceState(device);
+    SemaphoreState* semaphore_state = nullptr;
+    TimelineSemaphore* timeline = nullptr;
+    if (device_state->semaphore_map.Erase(semaphore, &semaphore_state)) delete semaphore_state;
+    if (device_state->timeline_semaphore_map.Erase(semaphore, &timeline)) delete timeline;
+''',
+'vkGetSemaphoreCounterValueKHR': '''
+    TimelineSemaphore* timeline = nullptr;
+    *pValue = GetDeviceState(device)->timeline_semaphore_map.Find(semaphore, &timeline) ? timeline->Value() : 0;
+    return VK_SUCCESS;
+''',
+'vkSignalSemaphoreKHR': '''
+    auto device_state = GetDeviceState(device);
+    TimelineSemaphore* timeline = nullptr;
+    if (device_state->timeline_semaphore_map.Find(pSignalInfo->semaphore, &timeline)) {
+        timeline->Signal(pSignalInfo->value);
+        ReleaseHeldBatches(device_state);
+    }
+    return VK_SUCCESS;
+''',
+'vkWaitSemaphoresKHR': '''
+    const Futex::Deadline deadline = TimeoutDeadline(timeout);
+    auto device_state = GetDeviceState(device);
+    std::vector<TimelinePoint> points;
+    for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; ++i) {
+        TimelineSemaphore* timeline = nullptr;
+        if (device_state->timeline_semaphore_map.Find(pWaitInfo->pSemaphores[i], &timeline)) {
+            points.push_back({timeline, pWaitInfo->pValues[i]});
+        }
+    }
+    if (points.empty()) return VK_SUCCESS;
+    const bool wait_any = (pWaitInfo->flags & VK_SEMAPHORE_WAIT_ANY_BIT) != 0;
+    return WaitForTimelinePoints(&device_state->timeline_futex, points, wait_any, deadline) ? VK_SUCCESS : VK_TIMEOUT;
+''',
+'vkCreateShaderModule': '''
+    *pShaderModule = (VkShaderModule)AllocateNonDispHandle();
+    auto device_state = GetDeviceState(device);
+    device_state->object_key_map.Insert((uint64_t)*pShaderModule, ShaderModuleKey(*pCreateInfo));
+    // Kept for compute pipelines to compile
+    if (ComputeEnabled()) {
+        const uint32_t* code = pCreateInfo->pCode;
+        device_state->shader_module_map.Insert(
+            *pShaderModule, std::make_shared<const std::vector<uint32_t>>(code, code + pCreateInfo->codeSize / sizeof(uint32_t)));
+    }
+    return VK_SUCCESS;
+''',
+'vkDestroyShaderModule': '''
+    if (!shaderModule) return;
+    auto device_state = GetDeviceState(device);
+    device_state->object_key_map.Erase((uint64_t)shaderModule);
+    if (ComputeEnabled()) device_state->shader_module_map.Erase(shaderModule);
+''',
+'vkCreatePipelineCache': '''
+    *pPipelineCache = (VkPipelineCache)AllocateNonDispHandle();
+    auto device_state = GetDeviceState(device);
+    auto cache = new PipelineCache(device_state->pipeline_cache_header);
+    if (pCreateInfo->initialDataSize) cache->Load(pCreateInfo->pInitialData, pCreateInfo->initialDataSize);
+    device_state->pipeline_cache_map.Insert(*pPipelineCache, cache);
+    return VK_SUCCESS;
+''',
+'vkDestroyPipelineCache': '''
+    PipelineCache* cache = nullptr;
+    if (!pipelineCache || !GetDeviceState(device)->pipeline_cache_map.Erase(pipelineCache, &cache)) return;
+    if (PipelineCacheStatsEnabled()) {
+        fprintf(stderr, "vkmock: pipeline cache 0x%llx: %llu hits, %llu misses, %llu pipelines\\n",
+                (unsigned long long)pipelineCache, (unsigned long long)cache->Hits(), (unsigned long long)cache->Misses(),
+                (unsigned long long)cache->Size());
+    }
+    delete cache;
+''',
+'vkGetPipelineCacheData': '''
+    PipelineCache* cache = nullptr;
+    if (!GetDeviceState(device)->pipeline_cache_map.Find(pipelineCache, &cache)) {
+        *pDataSize = 0;
+        return VK_SUCCESS;
+    }
+    return cache->GetData(pDataSize, pData);
+''',
+'vkMergePipelineCaches': '''
+    auto device_state = GetDeviceState(device);
+    PipelineCache* dst = nullptr;
+    if (!device_state->pipeline_cache_map.Find(dstCache, &dst)) return VK_SUCCESS;
+    for (uint32_t i = 0; i < srcCacheCount; ++i) {
+        PipelineCache* src = nullptr;
+        if (device_state->pipeline_cache_map.Find(pSrcCaches[i], &src)) dst->Merge(*src);
+    }
+    return VK_SUCCESS;
+''',
+'vkCreateGraphicsPipelines': '''
+    auto device_state = GetDeviceState(device);
+    auto create = [=](const VkGraphicsPipelineCreateInfo& create_info, VkPipeline* pipeline) -> VkResult {
+        auto key = [&]() { return GraphicsPipelineKey(device_state->object_key_map, create_info); };
+        const VkResult result = CompilePipeline(device_state, pipelineCache, create_info.flags, create_info.pNext, key);
+        if (result == VK_SUCCESS) *pipeline = (VkPipeline)AllocateNonDispHandle();
+        return result;
+    };
+    return CreatePipelines(device, VK_NULL_HANDLE, createInfoCount, pCreateInfos, pPipelines, create);
+''',
+'vkCreateComputePipelines': '''
+    auto device_state = GetDeviceState(device);
+    auto create = [=](const VkComputePipelineCreateInfo& create_info, VkPipeline* pipeline) -> VkResult {
+        auto key = [&]() { return ComputePipelineKey(device_state->object_key_map, create_info); };
+        const VkResult result = CompilePipeline(device_state, pipelineCache, create_info.flags, create_info.pNext, key);
+        if (result != VK_SUCCESS) return result;
+        *pipeline = (VkPipeline)AllocateNonDispHandle();
+        std::shared_ptr<const std::vector<uint32_t>> code;
+        const VkPipelineShaderStageCreateInfo& stage = create_info.stage;
+        if (!ComputeEnabled() || !device_state->shader_module_map.Find(stage.module, &code)) return result;
+        // Dispatches of pipelines the interpreter can't execute are only costed
+        std::string error;
+        auto program = CompileComputeProgram(code->data(), code->size(), stage.pName, stage.pSpecializationInfo, &error);
+        if (program) {
+            device_state->compute_pipeline_map.Insert(*pipeline, program);
+        } else {
+            fprintf(stderr, "vkmock: compute pipeline won't be executed: %s\\n", error.c_str());
+        }
+        return result;
+    };
+    return CreatePipelines(device, VK_NULL_HANDLE, createInfoCount, pCreateInfos, pPipelines, create);
+''',
+'vkCreatePipelineLayout': '''
+    *pPipelineLayout = (VkPipelineLayout)AllocateNonDispHandle();
+    auto device_state = GetDeviceState(device);
+    device_state->object_key_map.Insert((uint64_t)*pPipelineLayout, PipelineLayoutKey(device_state->object_key_map, *pCreateInfo));
+    return VK_SUCCESS;
+''',
+'vkDestroyPipelineLayout': '''
+    if (pipelineLayout) GetDeviceState(device)->object_key_map.Erase((uint64_t)pipelineLayout);
+''',
+'vkCreateRenderPass': '''
+    *pRenderPass = (VkRenderPass)AllocateNonDispHandle();
+    GetDeviceState(device)->object_key_map.Insert((uint64_t)*pRenderPass, RenderPassKey(*pCreateInfo));
+    return VK_SUCCESS;
+''',
+'vkCreateRenderPass2KHR': '''
+    *pRenderPass = (VkRenderPass)AllocateNonDispHandle();
+    GetDeviceState(device)->object_key_map.Insert((uint64_t)*pRenderPass, RenderPass2Key(*pCreateInfo));
+    return VK_SUCCESS;
+''',
+'vkDestroyRenderPass': '''
+    if (renderPass) GetDeviceState(device)->object_key_map.Erase((uint64_t)renderPass);
+''',
+'vkDestroyPipeline': '''
+    if (!pipeline) return;
+    auto device_state = GetDeviceState(device);
+    device_state->object_key_map.Erase((uint64_t)pipeline);
+    if (ComputeEnabled()) device_state->compute_pipeline_map.Erase(pipeline);
+''',
+'vkCreateRayTracingPipelinesKHR': '''
+    auto device_state = GetDeviceState(device);
+    auto create = [=](const VkRayTracingPipelineCreateInfoKHR& create_info, VkPipeline* pipeline) -> VkResult {
+        const PipelineKey key = RayTracingPipelineKey(device_state->object_key_map, create_info);
+        auto key_func = [&]() { return key; };
+        const VkResult result = CompilePipeline(device_state, pipelineCache, create_info.flags, create_info.pNext, key_func);
+        if (result != VK_SUCCESS) return result;
+        *pipeline = (VkPipeline)AllocateNonDispHandle();
+        // Kept for the pipelines linking the library to include in their keys
+        if (create_info.flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) device_state->object_key_map.Insert((uint64_t)*pipeline, key);
+        return result;
+    };
+    return CreatePipelines(device, deferredOperation, createInfoCount, pCreateInfos, pPipelines, create);
+''',
+'vkCreateDeferredOperationKHR': '''
+    *pDeferredOperation = (VkDeferredOperationKHR)AllocateNonDispHandle();
+    GetDeviceState(device)->deferred_operation_map.Insert(*pDeferredOperation, new DeferredOperation);
+    return VK_SUCCESS;
+''',
+'vkDestroyDeferredOperationKHR': '''
+    DeferredOperation* deferred_operation = nullptr;
+    if (operation && GetDeviceState(device)->deferred_operation_map.Erase(operation, &deferred_operation)) {
+        delete deferred_operation;
+    }
+''',
+'vkGetDeferredOperationMaxConcurrencyKHR': '''
+    DeferredOperation* deferred_operation = nullptr;
+    if (!GetDeviceState(device)->deferred_operation_map.Find(operation, &deferred_operation)) return 0;
+    return deferred_operation->MaxConcurrency();
+''',
+'vkGetDeferredOperationResultKHR': '''
+    DeferredOperation* deferred_operation = nullptr;
+    if (!GetDeviceState(device)->deferred_operation_map.Find(operation, &deferred_operation)) return VK_SUCCESS;
+    return deferred_operation->Result();
+''',
+'vkDeferredOperationJoinKHR': '''
+    DeferredOperation* deferred_operation = nullptr;
+    if (!GetDeviceState(device)->deferred_operation_map.Find(operation, &deferred_operation)) return VK_SUCCESS;
+    return deferred_operation->Join();
+''',
+'vkBuildAccelerationStructuresKHR': '''
+    // Host builds don't write anything, but each takes the cost model's time for its primitives
+    const double build_primitive_ns = GetCostModel().build_primitive_ns;
+    auto build = [=](uint32_t i) {
+        uint64_t primitive_count = 0;
+        for (uint32_t j = 0; j < pInfos[i].geometryCount; ++j) primitive_count += ppBuildRangeInfos[i][j].primitiveCount;
+        SpendHostTime(build_primitive_ns * primitive_count);
+    };
+    return DeferOrRun(GetDeviceState(device), deferredOperation, infoCount, build, []() { return VK_SUCCESS; });
+''',
+'vkCopyAccelerationStructureKHR': '''
+    return DeferOrRun(GetDeviceState(device), deferredOperation, 0, nullptr, []() { return VK_SUCCESS; });
+''',
+'vkCopyAccelerationStructureToMemoryKHR': '''
+    return DeferOrRun(GetDeviceState(device), deferredOperation, 0, nullptr, []() { return VK_SUCCESS; });
+''',
+'vkCopyMemoryToAccelerationStructureKHR': '''
+    return DeferOrRun(GetDeviceState(device), deferredOperation, 0, nullptr, []() { return VK_SUCCESS; });
+''',
+'vkCreateImageView': '''
+    *pView = (VkImageView)AllocateNonDispHandle();
+    if (ComputeEnabled()) {
+        GetDeviceState(device)->image_view_map.Insert(
+            *pView, {pCreateInfo->image, pCreateInfo->format, pCreateInfo->viewType, pCreateInfo->subresourceRange});
+    }
+    return VK_SUCCESS;
+''',
+'vkDestroyImageView': '''
+    if (imageView && ComputeEnabled()) GetDeviceState(device)->image_view_map.Erase(imageView);
+''',
+'vkCreateSampler': '''
+    *pSampler = (VkSampler)AllocateNonDispHandle();
+    auto device_state = GetDeviceState(device);
+    device_state->object_key_map.Insert((uint64_t)*pSampler, SamplerKey(*pCreateInfo));
+    // Shaders only sample base levels, so magnification decides the filter
+    if (ComputeEnabled()) {
+        device_state->sampler_map.Insert(
+            *pSampler, {pCreateInfo->magFilter == VK_FILTER_LINEAR, pCreateInfo->unnormalizedCoordinates == VK_TRUE,
+                        {pCreateInfo->addressModeU, pCreateInfo->addressModeV, pCreateInfo->addressModeW}});
+    }
+    return VK_SUCCESS;
+''',
+'vkDestroySampler': '''
+    if (!sampler) return;
+    auto device_state = GetDeviceState(device);
+    device_state->object_key_map.Erase((uint64_t)sampler);
+    if (ComputeEnabled()) device_state->sampler_map.Erase(sampler);
+''',
+'vkCreateDescriptorSetLayout': '''
+    *pSetLayout = (VkDescriptorSetLayout)AllocateNonDispHandle();
+    auto device_state = GetDeviceState(device);
+    device_state->object_key_map.Insert((uint64_t)*pSetLayout, DescriptorSetLayoutKey(device_state->object_key_map, *pCreateInfo));
+    if (ComputeEnabled()) {
+        device_state->descriptor_set_layout_map.Insert(*pSetLayout, std::make_shared<const DescriptorSetLayoutState>(*pCreateInfo));
+    }
+    return VK_SUCCESS;
+''',
+'vkDestroyDescriptorSetLayout': '''
+    if (!descriptorSetLayout) return;
+    auto device_state = GetDeviceState(device);
+    device_state->object_key_map.Erase((uint64_t)descriptorSetLayout);
+    // Sets allocated with the layout keep their own reference to it
+    if (ComputeEnabled()) device_state->descriptor_set_layout_map.Erase(descriptorSetLayout);
+''',
+'vkCreateDescriptorPool': '''
+    *pDescriptorPool = (VkDescriptorPool)AllocateNonDispHandle();
+    if (ComputeEnabled()) {
+        GetDeviceState(device)->descriptor_pool_map.Insert(*pDescriptorPool, std::make_shared<DescriptorPoolState>());
+    }
+    return VK_SUCCESS;
+''',
+'vkDestroyDescriptorPool': '''
+    auto device_state = GetDeviceState(device);
+    std::shared_ptr<DescriptorPoolState> pool_state;
+    if (!descriptorPool || !ComputeEnabled() || !device_state->descriptor_pool_map.Erase(descriptorPool, &pool_state)) return;
+    // Frees the sets allocated from the pool
+    std::lock_guard<std::mutex> lock(pool_state->mutex);
+    for (auto set : pool_state->sets) device_state->descriptor_set_map.Erase(set);
+''',
+'vkResetDescriptorPool': '''
+    auto device_state = GetDeviceState(device);
+    std::shared_ptr<DescriptorPoolState> pool_state;
+    if (!ComputeEnabled() || !device_state->descriptor_pool_map.Find(descriptorPool, &pool_state)) return VK_SUCCESS;
+    std::lock_guard<std::mutex> lock(pool_state->mutex);
+    for (auto set : pool_state->sets) device_state->descriptor_set_map.Erase(set);
+    pool_state->sets.clear();
+    return VK_SUCCESS;
+''',
+'vkAllocateDescriptorSets': '''
+    auto device_state = GetDeviceState(device);
+    std::shared_ptr<DescriptorPoolState> pool_state;
+    if (ComputeEnabled()) device_state->descriptor_pool_map.Find(pAllocateInfo->descriptorPool, &pool_state);
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
+        pDescriptorSets[i] = (VkDescriptorSet)AllocateNonDispHandle();
+        std::shared_ptr<const DescriptorSetLayoutState> layout;
+        if (!pool_state || !device_state->descriptor_set_layout_map.Find(pAllocateInfo->pSetLayouts[i], &layout)) continue;
+        device_state->descriptor_set_map.Insert(pDescriptorSets[i],
+                                                std::make_shared<DescriptorSetState>(layout, pAllocateInfo->descriptorPool));
+        std::lock_guard<std::mutex> lock(pool_state->mutex);
+        pool_state->sets.insert(pDescriptorSets[i]);
+    }
+    return VK_SUCCESS;
+''',
+'vkFreeDescriptorSets': '''
+    auto device_state = GetDeviceState(device);
+    std::shared_ptr<DescriptorPoolState> pool_state;
+    if (!ComputeEnabled() || !device_state->descriptor_pool_map.Find(descriptorPool, &pool_state)) return VK_SUCCESS;
+    std::lock_guard<std::mutex> lock(pool_state->mutex);
+    for (uint32_t i = 0; i < descriptorSetCount; ++i) {
+        if (pDescriptorSets[i] && device_state->descriptor_set_map.Erase(pDescriptorSets[i])) {
+            pool_state->sets.erase(pDescriptorSets[i]);
+        }
+    }
+    return VK_SUCCESS;
+''',
+'vkUpdateDescriptorSets': '''
+    if (!ComputeEnabled()) return;
+    auto device_state = GetDeviceState(device);
+    for (uint32_t i = 0; i < descriptorWriteCount; ++i) {
+        std::shared_ptr<DescriptorSetState> set_state;
+        if (device_state->descriptor_set_map.Find(pDescriptorWrites[i].dstSet, &set_state)) {
+            ApplyDescriptorWrite(set_state.get(), pDescriptorWrites[i]);
+        }
+    }
+    for (uint32_t i = 0; i < descriptorCopyCount; ++i) {
+        std::shared_ptr<DescriptorSetState> src_state;
+        std::shared_ptr<DescriptorSetState> dst_state;
+        if (device_state->descriptor_set_map.Find(pDescriptorCopies[i].srcSet, &src_state) &&
+            device_state->descriptor_set_map.Find(pDescriptorCopies[i].dstSet, &dst_state)) {
+            ApplyDescriptorCopy(src_state.get(), dst_state.get(), pDescriptorCopies[i]);
+        }
+    }
+''',
+'vkCreateDescriptorUpdateTemplateKHR': '''
+    *pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate)AllocateNonDispHandle();
+    if (ComputeEnabled()) {
+        GetDeviceState(device)->descriptor_update_template_map.Insert(
+            *pDescriptorUpdateTemplate, std::make_shared<const DescriptorUpdateTemplateState>(*pCreateInfo));
+    }
     return VK_SUCCESS;
 ''',
+'vkDestroyDescriptorUpdateTemplateKHR': '''
+    if (descriptorUpdateTemplate && ComputeEnabled()) {
+        GetDeviceState(device)->descriptor_update_template_map.Erase(descriptorUpdateTemplate);
+    }
+''',
+'vkUpdateDescriptorSetWithTemplateKHR': '''
+    if (!ComputeEnabled()) return;
+    auto device_state = GetDeviceState(device);
+    std::shared_ptr<DescriptorSetState> set_state;
+    std::shared_ptr<const DescriptorUpdateTemplateState> template_state;
+    if (device_state->descriptor_set_map.Find(descriptorSet, &set_state) &&
+        device_state->descriptor_update_template_map.Find(descriptorUpdateTemplate, &template_state)) {
+        ApplyDescriptorUpdateTemplate(set_state.get(), *template_state, pData);
+    }
+''',
 'vkCreateBuffer': '''
-    unique_lock_t lock(global_lock);
-    *pBuffer = (VkBuffer)global_unique_handle++;
-    buffer_map[device][*pBuffer] = *pCreateInfo;
+    *pBuffer = (VkBuffer)AllocateNonDispHandle();
+    GetDeviceState(device)->buffer_map.Insert(*pBuffer, {pCreateInfo->size, VK_NULL_HANDLE, 0});
     return VK_SUCCESS;
 ''',
 'vkDestroyBuffer': '''
-    unique_lock_t lock(global_lock);
-    buffer_map[device].erase(buffer);
+    if (buffer) GetDeviceState(device)->buffer_map.Erase(buffer);
 ''',
 'vkCreateImage': '''
-    unique_lock_t lock(global_lock);
-    *pImage = (VkImage)global_unique_handle++;
-    // TODO: A pixel size is 32 bytes. This accounts for the largest possible pixel size of any format. It could be changed to more accurate size if need be.
-    image_memory_size_map[device][*pImage] = pCreateInfo->extent.width * pCreateInfo->extent.height * pCreateInfo->extent.depth *
-                                             32 * pCreateInfo->arrayLayers * (pCreateInfo->mipLevels > 1 ? 2 : 1);
-    // plane count
-    switch (pCreateInfo->format) {
-        case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM:
-        case VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16:
-        case VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM:
-        case VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM:
-            image_memory_size_map[device][*pImage] *= 3;
-            break;
-        case VK_FORMAT_G8_B8R8_2PLANE_420_UNORM:
-        case VK_FORMAT_G8_B8R8_2PLANE_422_UNORM:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16:
-        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16:
-        case VK_FORMAT_G16_B16R16_2PLANE_420_UNORM:
-        case VK_FORMAT_G16_B16R16_2PLANE_422_UNORM:
-            image_memory_size_map[device][*pImage] *= 2;
-            break;
-        default:
-            break;
-    }
+    *pImage = (VkImage)AllocateNonDispHandle();
+    GetDeviceState(device)->image_map.Insert(*pImage, new ImageState(GetFormatInfo(pCreateInfo->format), *pCreateInfo));
     return VK_SUCCESS;
 ''',
 'vkDestroyImage': '''
-    unique_lock_t lock(global_lock);
-    image_memory_size_map[device].erase(image);
+    ImageState* image_state = nullptr;
+    if (image && GetDeviceState(device)->image_map.Erase(image, &image_state)) delete image_state;
+''',
+'vkCreateCommandPool': '''
+    *pCommandPool = (VkCommandPool)AllocateNonDispHandle();
+    GetDeviceState(device)->command_pool_map.Insert(*pCommandPool, new CommandPoolState());
+    return VK_SUCCESS;
+''',
+'vkDestroyCommandPool': '''
+    CommandPoolState* pool_state = nullptr;
+    if (commandPool && GetDeviceState(device)->command_pool_map.Erase(commandPool, &pool_state)) delete pool_state;
+''',
+'vkResetCommandPool': '''
+    CommandPoolState* pool_state = nullptr;
+    if (GetDeviceState(device)->command_pool_map.Find(commandPool, &pool_state)) {
+        // Invalidates the recording of every command buffer in the pool at once
+        pool_state->arena.Reset();
+        if (flags & VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT) pool_state->arena.Trim();
+    }
+    return VK_SUCCESS;
+''',
+'vkTrimCommandPoolKHR': '''
+    CommandPoolState* pool_state = nullptr;
+    if (GetDeviceState(device)->command_pool_map.Find(commandPool, &pool_state)) pool_state->arena.Trim();
+''',
+'vkAllocateCommandBuffers': '''
+    CommandPoolState* pool_state = nullptr;
+    GetDeviceState(device)->command_pool_map.Find(pAllocateInfo->commandPool, &pool_state);
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+        auto command_buffer = pool_state->command_buffers.Allocate();
+        set_loader_magic_value(&command_buffer->loader_data);
+        command_buffer->commands.SetArena(&pool_state->arena);
+        pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(command_buffer);
+    }
+    return VK_SUCCESS;
+''',
+'vkFreeCommandBuffers': '''
+    CommandPoolState* pool_state = nullptr;
+    GetDeviceState(device)->command_pool_map.Find(commandPool, &pool_state);
+    for (uint32_t i = 0; i < commandBufferCount; ++i) {
+        if (!pCommandBuffers[i]) continue;
+        auto command_buffer = GetCommandBufferObject(pCommandBuffers[i]);
+        // Hands the recording's blocks back to the pool's arena
+        command_buffer->commands.Reset();
+        pool_state->command_buffers.Free(command_buffer);
+    }
+''',
+'vkBeginCommandBuffer': '''
+    // Beginning a command buffer implicitly resets it
+    GetCommandBufferObject(commandBuffer)->commands.Reset();
+    return VK_SUCCESS;
+''',
+'vkResetCommandBuffer': '''
+    GetCommandBufferObject(commandBuffer)->commands.Reset();
+    return VK_SUCCESS;
+''',
+'vkCreateQueryPool': '''
+    *pQueryPool = (VkQueryPool)AllocateNonDispHandle();
+    auto pool_state = new QueryPoolState(pCreateInfo->queryCount);
+    if (pCreateInfo->queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS) {
+        pool_state->values_per_query = 0;
+        for (VkQueryPipelineStatisticFlags bits = pCreateInfo->pipelineStatistics; bits; bits &= bits - 1) {
+            ++pool_state->values_per_query;
+        }
+    } else if (pCreateInfo->queryType == VK_QUERY_TYPE_TRANSFORM_FEEDBACK_STREAM_EXT) {
+        pool_state->values_per_query = 2;
+    }
+    GetDeviceState(device)->query_pool_map.Insert(*pQueryPool, pool_state);
+    return VK_SUCCESS;
+''',
+'vkDestroyQueryPool': '''
+    QueryPoolState* pool_state = nullptr;
+    if (queryPool && GetDeviceState(device)->query_pool_map.Erase(queryPool, &pool_state)) delete pool_state;
+''',
+'vkResetQueryPool': '''
+    ResetQueries(GetDeviceState(device), queryPool, firstQuery, queryCount);
+''',
+'vkResetQueryPoolEXT': '''
+    ResetQueryPool(device, queryPool, firstQuery, queryCount);
 ''',
+'vkGetQueryPoolResults': '''
+    auto device_state = GetDeviceState(device);
+    QueryPoolState* pool_state = nullptr;
+    if (!device_state->query_pool_map.Find(queryPool, &pool_state)) return VK_SUCCESS;
+    VkResult result = VK_SUCCESS;
+    for (uint32_t i = 0; i < queryCount && firstQuery + i < pool_state->queries.size(); ++i) {
+        const QueryState& query = pool_state->queries[firstQuery + i];
+        if ((flags & VK_QUERY_RESULT_WAIT_BIT) && AsyncQueuesEnabled()) {
+            device_state->sync_notifier.Wait([&]() { return query.available.load(); });
+        }
+        // Without queue workers all submitted work has already executed, so queries nothing wrote just read as 0
+        const bool available = query.available || !AsyncQueuesEnabled();
+        void* query_data = static_cast<uint8_t*>(pData) + i * stride;
+        if (available || (flags & VK_QUERY_RESULT_PARTIAL_BIT)) {
+            for (uint32_t j = 0; j < pool_state->values_per_query; ++j) WriteQueryResult(query_data, j, query.value, flags);
+        }
+        if (flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT) {
+            WriteQueryResult(query_data, pool_state->values_per_query, available ? 1 : 0, flags);
+        }
+        if (!available) result = VK_NOT_READY;
+    }
+    return result;
+''',
+}
+
+# Structs the trace records the handles and pointed-to data of, in TraceMembers<> specializations, so that calls taking them
+# can be replayed. Pointers in other structs are recorded as addresses.
+TRACE_FOLLOWED_STRUCTS = [
+    'VkApplicationInfo', 'VkInstanceCreateInfo', 'VkDeviceQueueCreateInfo', 'VkDeviceCreateInfo', 'VkBufferCreateInfo',
+    'VkImageCreateInfo', 'VkSwapchainCreateInfoKHR', 'VkImageViewCreateInfo', 'VkBufferViewCreateInfo',
+    'VkShaderModuleCreateInfo', 'VkPipelineCacheCreateInfo', 'VkSpecializationInfo', 'VkPipelineShaderStageCreateInfo',
+    'VkPipelineVertexInputStateCreateInfo', 'VkPipelineViewportStateCreateInfo', 'VkPipelineMultisampleStateCreateInfo',
+    'VkPipelineColorBlendStateCreateInfo', 'VkPipelineDynamicStateCreateInfo', 'VkGraphicsPipelineCreateInfo',
+    'VkComputePipelineCreateInfo', 'VkDescriptorSetLayoutBinding', 'VkDescriptorSetLayoutCreateInfo',
+    'VkPipelineLayoutCreateInfo', 'VkDescriptorPoolCreateInfo', 'VkDescriptorSetAllocateInfo', 'VkDescriptorImageInfo',
+    'VkDescriptorBufferInfo', 'VkWriteDescriptorSet', 'VkCopyDescriptorSet', 'VkSubpassDescription', 'VkRenderPassCreateInfo',
+    'VkSubpassDescription2', 'VkRenderPassCreateInfo2', 'VkFramebufferCreateInfo', 'VkRenderPassBeginInfo',
+    'VkCommandBufferAllocateInfo', 'VkCommandBufferInheritanceInfo', 'VkCommandBufferBeginInfo', 'VkSubmitInfo',
+    'VkSemaphoreSubmitInfoKHR', 'VkCommandBufferSubmitInfoKHR', 'VkSubmitInfo2KHR', 'VkPresentInfoKHR',
+    'VkAcquireNextImageInfoKHR', 'VkMappedMemoryRange', 'VkBufferMemoryBarrier', 'VkImageMemoryBarrier',
+    'VkBufferMemoryBarrier2KHR', 'VkImageMemoryBarrier2KHR', 'VkDependencyInfoKHR', 'VkBindBufferMemoryInfo',
+    'VkBindImageMemoryInfo', 'VkBufferMemoryRequirementsInfo2', 'VkImageMemoryRequirementsInfo2',
+    'VkImageSparseMemoryRequirementsInfo2', 'VkBufferDeviceAddressInfo', 'VkDeviceMemoryOpaqueCaptureAddressInfo',
+    'VkSemaphoreWaitInfo', 'VkSemaphoreSignalInfo', 'VkCopyBufferInfo2KHR', 'VkCopyImageInfo2KHR',
+    'VkCopyBufferToImageInfo2KHR', 'VkCopyImageToBufferInfo2KHR', 'VkBlitImageInfo2KHR', 'VkResolveImageInfo2KHR',
+    'VkDebugUtilsLabelEXT', 'VkDebugMarkerMarkerInfoEXT', 'VkDescriptorUpdateTemplateCreateInfo',
+    'VkConditionalRenderingBeginInfoEXT', 'VkFenceGetFdInfoKHR', 'VkSemaphoreGetFdInfoKHR', 'VkMemoryGetFdInfoKHR',
+    'VkPhysicalDeviceSurfaceInfo2KHR', 'VkDisplayPlaneInfo2KHR', 'VkDisplaySurfaceCreateInfoKHR', 'VkPipelineInfoKHR',
+    'VkPipelineExecutableInfoKHR',
+]
+
+# Pointers in followed structs that only point to anything under a condition on the struct, s. Vulkan lets the app leave them
+# dangling otherwise.
+TRACE_MEMBER_CONDITIONS = {
+    ('VkBufferCreateInfo', 'pQueueFamilyIndices'): 's.sharingMode == VK_SHARING_MODE_CONCURRENT',
+    ('VkImageCreateInfo', 'pQueueFamilyIndices'): 's.sharingMode == VK_SHARING_MODE_CONCURRENT',
+    ('VkSwapchainCreateInfoKHR', 'pQueueFamilyIndices'): 's.imageSharingMode == VK_SHARING_MODE_CONCURRENT',
+    ('VkDescriptorSetLayoutBinding', 'pImmutableSamplers'): 'TraceUsesImmutableSamplers(s.descriptorType)',
+    ('VkWriteDescriptorSet', 'pImageInfo'): 'TraceUsesImageInfo(s.descriptorType)',
+    ('VkWriteDescriptorSet', 'pBufferInfo'): 'TraceUsesBufferInfo(s.descriptorType)',
+    ('VkWriteDescriptorSet', 'pTexelBufferView'): 'TraceUsesTexelBufferView(s.descriptorType)',
+    ('VkFramebufferCreateInfo', 'pAttachments'): '!(s.flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)',
+}
+
+# Structs recorded commands copy what they point to along with, in CommandDeepCopy<> specializations, including the ones
+# that can be in their pNext chains. Commands must be able to run after the app has freed what it passed in. Structs in a
+# recorded pNext chain that aren't listed here are left out of the copy, and pointers to memory the mock can't know the size
+# of (e.g. the pParams of VkCuLaunchInfoNVX) are recorded as null. Unions of a device address and a host pointer keep their
+# bytes, commands only use the device address.
+RECORD_FOLLOWED_STRUCTS = [
+    'VkRenderPassBeginInfo', 'VkDeviceGroupRenderPassBeginInfo', 'VkRenderPassAttachmentBeginInfo',
+    'VkRenderPassSampleLocationsBeginInfoEXT', 'VkAttachmentSampleLocationsEXT', 'VkSubpassSampleLocationsEXT',
+    'VkSampleLocationsInfoEXT', 'VkRenderPassTransformBeginInfoQCOM', 'VkSubpassBeginInfo', 'VkSubpassEndInfo',
+    'VkMemoryBarrier', 'VkBufferMemoryBarrier', 'VkImageMemoryBarrier', 'VkDependencyInfoKHR', 'VkMemoryBarrier2KHR',
+    'VkBufferMemoryBarrier2KHR', 'VkImageMemoryBarrier2KHR', 'VkCopyBufferInfo2KHR', 'VkBufferCopy2KHR',
+    'VkCopyImageInfo2KHR', 'VkImageCopy2KHR', 'VkCopyBufferToImageInfo2KHR', 'VkCopyImageToBufferInfo2KHR',
+    'VkBufferImageCopy2KHR', 'VkBlitImageInfo2KHR', 'VkImageBlit2KHR', 'VkResolveImageInfo2KHR', 'VkImageResolve2KHR',
+    'VkCopyCommandTransformInfoQCOM', 'VkWriteDescriptorSet', 'VkWriteDescriptorSetInlineUniformBlockEXT',
+    'VkWriteDescriptorSetAccelerationStructureKHR', 'VkWriteDescriptorSetAccelerationStructureNV',
+    'VkDebugMarkerMarkerInfoEXT', 'VkDebugUtilsLabelEXT', 'VkConditionalRenderingBeginInfoEXT', 'VkShadingRatePaletteNV',
+    'VkCoarseSampleOrderCustomNV', 'VkVertexInputBindingDescription2EXT', 'VkVertexInputAttributeDescription2EXT',
+    'VkGeneratedCommandsInfoNV', 'VkPerformanceMarkerInfoINTEL', 'VkPerformanceStreamMarkerInfoINTEL',
+    'VkPerformanceOverrideInfoINTEL', 'VkCopyAccelerationStructureInfoKHR', 'VkCopyAccelerationStructureToMemoryInfoKHR',
+    'VkCopyMemoryToAccelerationStructureInfoKHR', 'VkAccelerationStructureBuildGeometryInfoKHR',
+    'VkAccelerationStructureGeometryKHR', 'VkAccelerationStructureGeometryTrianglesDataKHR',
+    'VkAccelerationStructureGeometryAabbsDataKHR', 'VkAccelerationStructureGeometryInstancesDataKHR',
+    'VkAccelerationStructureInfoNV', 'VkGeometryNV', 'VkGeometryDataNV', 'VkGeometryTrianglesNV', 'VkGeometryAABBNV',
+    'VkCuLaunchInfoNVX',
+]
+
+# Pointers in RECORD_FOLLOWED_STRUCTS that only point to anything under a condition on the struct, s, like
+# TRACE_MEMBER_CONDITIONS, and the alternatives of unions they hold that are in use, by union.alternative
+RECORD_MEMBER_CONDITIONS = {
+    ('VkWriteDescriptorSet', 'pImageInfo'): 'IsImageDescriptor(s.descriptorType)',
+    ('VkWriteDescriptorSet', 'pBufferInfo'): 'IsBufferDescriptor(s.descriptorType)',
+    ('VkWriteDescriptorSet', 'pTexelBufferView'): 'IsTexelBufferDescriptor(s.descriptorType)',
+    ('VkAccelerationStructureGeometryKHR', 'geometry.triangles'): 's.geometryType == VK_GEOMETRY_TYPE_TRIANGLES_KHR',
+    ('VkAccelerationStructureGeometryKHR', 'geometry.aabbs'): 's.geometryType == VK_GEOMETRY_TYPE_AABBS_KHR',
+    ('VkAccelerationStructureGeometryKHR', 'geometry.instances'): 's.geometryType == VK_GEOMETRY_TYPE_INSTANCES_KHR',
 }
 
 # MockICDGeneratorOptions - subclass of GeneratorOptions.
@@ -1098,6 +3262,7 @@ class MockICDGeneratorOptions(GeneratorOptions):
         self.indentFuncProto = indentFuncProto
         self.indentFuncPointer = indentFuncPointer
         self.alignFuncParam  = alignFuncParam
+        self.helper_file_type = helper_file_type
 
 # MockICDOutputGenerator - subclass of OutputGenerator.
 # Generates a mock vulkan ICD.
@@ -1131,6 +3296,10 @@ class MockICDOutputGenerator(OutputGenerator):
         # Internal state - accumulators for different inner block text
         self.sections = dict([(section, []) for section in self.ALL_SECTIONS])
         self.intercepts = []
+        self.cmd_opcodes = []
+        self.cmd_arg_structs = []
+        self.traced_cmds = []
+        self.struct_types = []
 
     # Check if the parameter passed in is a pointer to an array
     def paramIsArray(self, param):
@@ -1166,6 +3335,7 @@ class MockICDOutputGenerator(OutputGenerator):
         #
         # Multiple inclusion protection & C++ namespace.
         self.header = False
+        self.replay = genOpts.helper_file_type == 'trace_replay'
         if (genOpts.protectFile and self.genOpts.filename and 'h' == self.genOpts.filename[-1]):
             self.header = True
             headerSym = '__' + re.sub(r'\.h', '_h_', os.path.basename(self.genOpts.filename))
@@ -1177,19 +3347,46 @@ class MockICDOutputGenerator(OutputGenerator):
         if (genOpts.prefixText):
             for s in genOpts.prefixText:
                 write(s, file=self.outFile)
+        if self.replay:
+            # Only what vktracereplay needs, see genReplayEntryPoints()
+            write('#include "tracereplay.h"', file=self.outFile)
+            return
         if self.header:
             write('#include <unordered_map>', file=self.outFile)
+            write('#include <atomic>', file=self.outFile)
             write('#include <mutex>', file=self.outFile)
             write('#include <string>', file=self.outFile)
             write('#include <cstring>', file=self.outFile)
             write('#include "vulkan/vk_icd.h"', file=self.outFile)
+            write('#include "mock_icd_proc_table.h"', file=self.outFile)
+            write('#include "mock_icd_image.h"', file=self.outFile)
         else:
             write('#include "mock_icd.h"', file=self.outFile)
             write('#include <stdlib.h>', file=self.outFile)
             write('#include <algorithm>', file=self.outFile)
             write('#include <array>', file=self.outFile)
+            write('#include <deque>', file=self.outFile)
             write('#include <vector>', file=self.outFile)
             write('#include "vk_typemap_helper.h"', file=self.outFile)
+            write('#include "mock_icd_handle_table.h"', file=self.outFile)
+            write('#include "mock_icd_memory.h"', file=self.outFile)
+            write('#include "mock_icd_memory_budget.h"', file=self.outFile)
+            write('#include "mock_icd_command_buffer.h"', file=self.outFile)
+            write('#include "mock_icd_object_slab.h"', file=self.outFile)
+            write('#include "mock_icd_config.h"', file=self.outFile)
+            write('#include "mock_icd_queue.h"', file=self.outFile)
+            write('#include "mock_icd_cost_model.h"', file=self.outFile)
+            write('#include "mock_icd_profile.h"', file=self.outFile)
+            write('#include "mock_icd_physical_device.h"', file=self.outFile)
+            write('#include "mock_icd_swapchain.h"', file=self.outFile)
+            write('#include "mock_icd_trace.h"', file=self.outFile)
+            write('#include "mock_icd_transfer.h"', file=self.outFile)
+            write('#include "mock_icd_texel.h"', file=self.outFile)
+            write('#include "mock_icd_descriptor.h"', file=self.outFile)
+            write('#include "mock_icd_compute.h"', file=self.outFile)
+            write('#include "mock_icd_pipeline_cache.h"', file=self.outFile)
+            write('#include "mock_icd_deferred.h"', file=self.outFile)
+            write('#include "mock_icd_call_stats.h"', file=self.outFile)
 
         write('namespace vkmock {', file=self.outFile)
         if self.header:
@@ -1205,37 +3402,120 @@ class MockICDOutputGenerator(OutputGenerator):
                     if (ext.attrib['name'] in ignore_exts):
                         pass
                     elif (ext.attrib.get('type') and 'instance' == ext.attrib['type']):
-                        instance_exts.append('    {"%s", %s},' % (ext.attrib['name'], ext[0][0].attrib['value']))
+                        instance_exts.append((ext.attrib['name'], ext[0][0].attrib['value']))
                     else:
-                        device_exts.append('    {"%s", %s},' % (ext.attrib['name'], ext[0][0].attrib['value']))
-            write('// Map of instance extension name to version', file=self.outFile)
-            write('static const std::unordered_map<std::string, uint32_t> instance_extension_map = {', file=self.outFile)
-            write('\n'.join(instance_exts), file=self.outFile)
+                        device_exts.append((ext.attrib['name'], ext[0][0].attrib['value']))
+            # Sorted by name, so apps see them in the same order from build to build
+            write('// Instance extensions the mock ICD implements, sorted by name', file=self.outFile)
+            write('static const VkExtensionProperties kInstanceExtensions[] = {', file=self.outFile)
+            write('\n'.join('    {"%s", %s},' % ext for ext in sorted(instance_exts)), file=self.outFile)
             write('};', file=self.outFile)
-            write('// Map of device extension name to version', file=self.outFile)
-            write('static const std::unordered_map<std::string, uint32_t> device_extension_map = {', file=self.outFile)
-            write('\n'.join(device_exts), file=self.outFile)
+            write('// Device extensions the mock ICD implements, sorted by name', file=self.outFile)
+            write('static const VkExtensionProperties kDeviceExtensions[] = {', file=self.outFile)
+            write('\n'.join('    {"%s", %s},' % ext for ext in sorted(device_exts)), file=self.outFile)
             write('};', file=self.outFile)
+            write(self.genFormatInfo(), file=self.outFile)
 
         else:
             self.newline()
+            write(self.genProfileFieldTables(), file=self.outFile)
+            write(self.genCommandDeepCopies(), file=self.outFile)
             write(SOURCE_CPP_PREFIX, file=self.outFile)
 
+    #
+    # GetFormatInfo(), from the texel block layouts in the registry's formats section
+    def genFormatInfo(self):
+        formats = self.registry.tree.findall('formats/format')
+        block_sizes = {format.attrib['name']: int(format.attrib['blockSize']) for format in formats}
+        lines = ['// Texel block layout of every format in the registry']
+        lines += ['static FormatInfo GetFormatInfo(VkFormat format) {']
+        lines += ['    switch (format) {']
+        for format in formats:
+            block_extent = format.attrib.get('blockExtent', '1,1,1').split(',')
+            planes = format.findall('plane')
+            plane_infos = ', '.join('{%s, %s, %d}' % (plane.attrib['widthDivisor'], plane.attrib['heightDivisor'],
+                                                      block_sizes[plane.attrib['compatible']]) for plane in planes)
+            lines += ['        case %s: return {%s, %s, %d, {%s}};' % (format.attrib['name'], format.attrib['blockSize'],
+                                                                       ', '.join(block_extent), len(planes), plane_infos)]
+        lines += ['        default: return {};']
+        lines += ['    }']
+        lines += ['}']
+        return '\n'.join(lines)
+
+    #
+    # The table GetInstanceProcAddr looks names up in, laid out by a minimal perfect hash: see FindProcSlot() in
+    # mock_icd_proc_table.h. Names go in buckets by their hash's high bits, and starting with the biggest bucket, each gets the
+    # smallest displacement that moves all its names to free slots. Returns the (name, protect) in each slot and each bucket's
+    # displacement. The header and source are generated separately, so both lay the table out from the same intercepts.
+    def layoutProcTable(self):
+        slot_count = len(self.intercepts)
+        bucket_count = (slot_count + 3) // 4
+        hashes = [ProcNameHash(name) for name, protect in self.intercepts]
+        buckets = [[] for i in range(bucket_count)]
+        for i, hash in enumerate(hashes):
+            buckets[(hash >> 32) % bucket_count].append(i)
+        slots = [None] * slot_count
+        displacements = [0] * bucket_count
+        for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+            for displacement in range(0x10000):
+                bucket_slots = [MixProcHash((hashes[i] + displacement) & 0xFFFFFFFFFFFFFFFF) % slot_count for i in buckets[bucket]]
+                if len(set(bucket_slots)) == len(bucket_slots) and all(slots[slot] is None for slot in bucket_slots):
+                    break
+            else:
+                raise Exception('No perfect hash for the entry point table')
+            displacements[bucket] = displacement
+            for i, slot in zip(buckets[bucket], bucket_slots):
+                slots[slot] = self.intercepts[i]
+        return slots, displacements
+    def genProcTable(self):
+        slots, displacements = self.layoutProcTable()
+        slot_count = len(slots)
+        bucket_count = len(displacements)
+        lines = ['// Every API the mock ICD intercepts, placed by a minimal perfect hash of its name. Functions of platforms that']
+        lines += ['// aren\'t being built for stay in as nullptr, so the layout is the same on every platform.']
+        lines += ['static const ProcEntry kProcTable[%d] = {' % slot_count]
+        for name, protect in slots:
+            if protect is None:
+                lines += ['    {"%s", (void*)%s},' % (name, name[2:])]
+            else:
+                lines += ['#ifdef %s' % protect]
+                lines += ['    {"%s", (void*)%s},' % (name, name[2:])]
+                lines += ['#else']
+                lines += ['    {"%s", nullptr},' % name]
+                lines += ['#endif']
+        lines += ['};']
+        lines += ['// Displacement of each bucket of names in kProcTable']
+        lines += ['static const uint16_t kProcDisplacements[%d] = {' % bucket_count]
+        for i in range(0, bucket_count, 16):
+            lines += ['    ' + ' '.join('%d,' % d for d in displacements[i:i + 16])]
+        lines += ['};']
+        return '\n'.join(lines)
     def endFile(self):
         # C-specific
         # Finish C++ namespace and multiple inclusion protection
         self.newline()
-        if self.header:
-            # record intercepted procedures
-            write('// Map of all APIs to be intercepted by this layer', file=self.outFile)
-            write('static const std::unordered_map<std::string, void*> name_to_funcptr_map = {', file=self.outFile)
-            write('\n'.join(self.intercepts), file=self.outFile)
+        if self.replay:
+            write(self.genReplayEntryPoints(), file=self.outFile)
+        elif self.header:
+            # commands recorded into command buffers
+            write('// Opcode of each command recorded into a command buffer, see RecordCommand()', file=self.outFile)
+            write('enum class CmdOpcode : uint32_t {', file=self.outFile)
+            write('\n'.join(self.cmd_opcodes), file=self.outFile)
             write('};\n', file=self.outFile)
+            write('// Arguments of each recorded command, stored right after its CommandHeader. What the arguments point to is copied in', file=self.outFile)
+            write('// after the struct, see RECORD_FOLLOWED_STRUCTS in the generator. Pointers to structs that aren\'t followed are', file=self.outFile)
+            write('// recorded as null, and opaque pointers the mock can\'t know the size of (e.g. pCheckpointMarker) as they are.', file=self.outFile)
+            write('\n\n'.join(self.cmd_arg_structs), file=self.outFile)
+            self.newline()
+            # record intercepted procedures
+            write(self.genProcTable(), file=self.outFile)
             self.newline()
             write('} // namespace vkmock', file=self.outFile)
             self.newline()
             write('#endif', file=self.outFile)
         else: # Loader-layer-interface, need to implement global interface functions
+            write(self.genTracedEntryPoints(), file=self.outFile)
+            write(self.genCountedEntryPoints(), file=self.outFile)
             write(SOURCE_CPP_POSTFIX, file=self.outFile)
         # Finish processing in superclass
         OutputGenerator.endFile(self)
@@ -1254,7 +3534,7 @@ class MockICDOutputGenerator(OutputGenerator):
         # C-specific
         # Actually write the interface to the output file.
         #write('// starting endFeature', file=self.outFile)
-        if (self.emit):
+        if (self.emit and not self.replay):
             self.newline()
             if (self.genOpts.protectFeature):
                 write('#ifndef', self.featureName, file=self.outFile)
@@ -1290,7 +3570,11 @@ class MockICDOutputGenerator(OutputGenerator):
     #
     # Type generation
     def genType(self, typeinfo, name, alias):
-        pass
+        # Structs that can be in a pNext chain, for TraceStructSize()
+        if alias is None and typeinfo.elem.get('category') in ['struct', 'union']:
+            for member in typeinfo.elem.findall('member'):
+                if member.find('name').text == 'sType' and member.get('values') is not None:
+                    self.struct_types += [ (member.get('values'), name, self.featureExtraProtect) ]
     #
     # Struct (e.g. C "struct" type) generation.
     # This is a special case of the <type> tag where the contents are
@@ -1325,13 +3609,15 @@ class MockICDOutputGenerator(OutputGenerator):
         if self.header: # In the header declare all intercepts
             self.appendSection('command', '')
             self.appendSection('command', 'static %s' % (decls[0]))
-            if (self.featureExtraProtect != None):
-                self.intercepts += [ '#ifdef %s' % self.featureExtraProtect ]
-            self.intercepts += [ '    {"%s", (void*)%s},' % (name,name[2:]) ]
-            if (self.featureExtraProtect != None):
-                self.intercepts += [ '#endif' ]
+            self.intercepts += [ (name, self.featureExtraProtect) ]
+            # Aliases record themselves as the command they alias
+            if name.startswith('vkCmd') and alias is None:
+                self.genRecordedCommandTypes(cmdinfo, name)
             return
 
+        self.traced_cmds += [ (name, self.featureExtraProtect, cmdinfo, decls[0]) ]
+        if self.replay:
+            return
         manual_functions = [
             # Include functions here to be intercepted w/ manually implemented function bodies
             'vkGetDeviceProcAddr',
@@ -1357,14 +3643,10 @@ class MockICDOutputGenerator(OutputGenerator):
             else:
                 self.appendSection('command', 'static %s' % (decls[0][:-1]))
                 self.appendSection('command', '{\n%s}' % (CUSTOM_C_INTERCEPTS[name]))
-            self.intercepts += [ '    {"%s", (void*)%s},' % (name,name[2:]) ]
+            self.intercepts += [ (name, None) ]
             return
         # record that the function will be intercepted
-        if (self.featureExtraProtect != None):
-            self.intercepts += [ '#ifdef %s' % self.featureExtraProtect ]
-        self.intercepts += [ '    {"%s", (void*)%s},' % (name,name[2:]) ]
-        if (self.featureExtraProtect != None):
-            self.intercepts += [ '#endif' ]
+        self.intercepts += [ (name, self.featureExtraProtect) ]
 
         OutputGenerator.genCmd(self, cmdinfo, name, alias)
         #
@@ -1391,6 +3673,9 @@ class MockICDOutputGenerator(OutputGenerator):
                 param_names.append(param.text)
             self.appendSection('command', '{\n    %s%s(%s);\n}' % (return_string, khr_name[2:], ", ".join(param_names)))
             return
+        if name.startswith('vkCmd'):
+            self.appendSection('command', self.genRecordCommand(cmdinfo, name, alias))
+            return
         self.appendSection('command', '{')
 
         api_function_name = cmdinfo.elem.attrib.get('name')
@@ -1408,9 +3693,8 @@ class MockICDOutputGenerator(OutputGenerator):
             allocator_txt = 'CreateDispObjHandle()';
             if (self.isHandleTypeNonDispatchable(lp_type)):
                 handle_type = 'non-' + handle_type
-                allocator_txt = 'global_unique_handle++';
-            # Need to lock in both cases
-            self.appendSection('command', '    unique_lock_t lock(global_lock);')
+                allocator_txt = 'AllocateNonDispHandle()';
+            # Neither allocator needs global_lock, only the shared allocation size map does
             if (lp_len != None):
                 #print("%s last params (%s) has len %s" % (handle_type, lp_txt, lp_len))
                 self.appendSection('command', '    for (uint32_t i = 0; i < %s; ++i) {' % (lp_len))
@@ -1418,26 +3702,634 @@ class MockICDOutputGenerator(OutputGenerator):
                 self.appendSection('command', '    }')
             else:
                 #print("Single %s last param is '%s' w/ type '%s'" % (handle_type, lp_txt, lp_type))
-                if 'AllocateMemory' in api_function_name:
-                    # Store allocation size in case it's mapped
-                    self.appendSection('command', '    allocated_memory_size_map[(VkDeviceMemory)global_unique_handle] = pAllocateInfo->allocationSize;')
                 self.appendSection('command', '    *%s = (%s)%s;' % (lp_txt, lp_type, allocator_txt))
         elif True in [ftxt in api_function_name for ftxt in ['Destroy', 'Free']]:
             self.appendSection('command', '//Destroy object')
-            if 'FreeMemory' in api_function_name:
-                # Remove from allocation map
-                self.appendSection('command', '    allocated_memory_size_map.erase(memory);')
         else:
             self.appendSection('command', '//Not a CREATE or DESTROY function')
 
         # Return result variable, if any.
         if (resulttype != None):
-            if api_function_name == 'vkGetEventStatus':
-                self.appendSection('command', '    return VK_EVENT_SET;')
-            else:
-                self.appendSection('command', '    return VK_SUCCESS;')
+            self.appendSection('command', '    return VK_SUCCESS;')
         self.appendSection('command', '}')
     #
+    # Tables of where a device profile's values go in the property and feature structs too big to list by hand. vulkaninfo
+    # --json names each value after its struct member.
+    def genProfileFieldTables(self):
+        field_types = {'uint32_t': 'Uint32', 'int32_t': 'Int32', 'VkDeviceSize': 'Uint64', 'size_t': 'Size',
+                       'float': 'Float', 'VkBool32': 'Bool32'}
+        tables = []
+        for struct_name in ['VkPhysicalDeviceLimits', 'VkPhysicalDeviceSparseProperties', 'VkPhysicalDeviceFeatures']:
+            struct = self.registry.tree.find("types/type/[@name='%s']" % struct_name)
+            fields = []
+            for member in struct.findall('member'):
+                member_type = member.find('type').text
+                member_name = member.find('name').text
+                field_type = 'Uint32' if member_type.endswith('Flags') else field_types[member_type]
+                count = re.search(r'\[(\d+)\]', member.find('name').tail or '')
+                fields.append('    {"%s", offsetof(%s, %s), ProfileFieldType::%s, %s},' %
+                              (member_name, struct_name, member_name, field_type, count.group(1) if count else '1'))
+            tables.append('static const ProfileField k%sFields[] = {\n%s\n};' % (struct_name[2:], '\n'.join(fields)))
+        return '// Where each value of a device profile goes, see mock_icd_profile.h\n' + '\n\n'.join(tables) + '\n'
+    #
+    # Fixed size array parameters, e.g. blendConstants[4]
+    def paramIsFixedArray(self, param):
+        return '[' in self.makeCParamDecl(param, 0)
+    #
+    # Declare the CmdOpcode and argument struct a vkCmd* function records
+    def genRecordedCommandTypes(self, cmdinfo, name):
+        members = []
+        for param in cmdinfo.elem.findall('param')[1:]:
+            member = self.makeCParamDecl(param, self.genOpts.alignFuncParam)
+            if self.paramIsFixedArray(param):
+                # Drop the const so the array can be copied into, keeping the name aligned
+                member = re.sub(r'^(\s*)const (\S+)', r'\1\2      ', member)
+            members.append(member + ';')
+        if (self.featureExtraProtect != None):
+            self.cmd_opcodes += [ '#ifdef %s' % self.featureExtraProtect ]
+        self.cmd_opcodes += [ '    %s,' % name[5:] ]
+        if (self.featureExtraProtect != None):
+            self.cmd_opcodes += [ '#endif' ]
+        if members:
+            struct = 'struct %sArgs {\n%s\n};' % (name[2:], '\n'.join(members))
+            if (self.featureExtraProtect != None):
+                struct = '#ifdef %s\n%s\n#endif' % (self.featureExtraProtect, struct)
+            self.cmd_arg_structs += [ struct ]
+    #
+    # Body of a vkCmd* function, which appends the call and copies of what it points to to the command buffer
+    def genRecordCommand(self, cmdinfo, name, alias):
+        params = cmdinfo.elem.findall('param')
+        param_names = [param.find('name').text for param in params]
+        has_result = cmdinfo.elem.find('proto/type').text != 'void'
+        if alias is not None:
+            return '{\n    %s%s(%s);\n}' % ('return ' if has_result else '', alias[2:], ", ".join(param_names))
+        opcode = 'CmdOpcode::%s' % name[5:]
+        return_txt = '\n    return VK_SUCCESS;' if has_result else ''
+        if len(params) == 1:
+            return '{\n    RecordCommand(commandBuffer, %s);%s\n}' % (opcode, return_txt)
+        payload_sizes = []
+        copies = []
+        for param in params[1:]:
+            param_name = param.find('name').text
+            param_type = param.find('type').text
+            depth = self.makeCParamDecl(param, 0).count('*')
+            lengths = param.attrib.get('len', '').split(',')
+            length = lengths[0] if lengths[0] in param_names else None
+            if self.paramIsFixedArray(param):
+                copies.append('    memcpy(args->%s, %s, sizeof(args->%s));' % (param_name, param_name, param_name))
+            elif depth == 0 or (param_type == 'void' and length is None):
+                # Values, and opaque pointers the mock can't know the size of
+                copies.append('    args->%s = %s;' % (param_name, param_name))
+            elif param_type == 'void' and depth == 1:
+                payload_sizes.append('PayloadBytes(%s, %s)' % (param_name, length))
+                copies.append('    args->%s = payload.CopyBytes(%s, %s);' % (param_name, param_name, length))
+            elif param_type == 'char' and depth == 1:
+                payload_sizes.append('PayloadString(%s)' % param_name)
+                copies.append('    args->%s = payload.CopyString(%s);' % (param_name, param_name))
+            elif not self.recordIsFollowed(param_type) or (depth > 1 and self.recordInnerCount(lengths) is None):
+                copies.append('    args->%s = nullptr;' % param_name)
+            elif depth > 1:
+                inner_count = self.recordInnerCount(lengths)
+                payload_sizes.append('PayloadSize(%s, %s, %s)' % (param_name, length, inner_count))
+                copies.append('    args->%s = payload.CopyArrays(%s, %s, %s);' % (param_name, param_name, length, inner_count))
+            else:
+                count = length if length is not None else '1'
+                payload_sizes.append('PayloadSize(%s, %s)' % (param_name, count))
+                copies.append('    args->%s = payload.CopyArray(%s, %s);' % (param_name, param_name, count))
+        body = '{\n'
+        body += '    auto args = RecordCommand<%sArgs>(commandBuffer, %s, %s);\n' % (name[2:], opcode, ' + '.join(payload_sizes) if payload_sizes else '0')
+        if payload_sizes:
+            body += '    CommandPayload payload(args);\n'
+        body += '\n'.join(copies)
+        body += return_txt
+        body += '\n}'
+        return body
+    #
+    # Whether recording a type's bytes copies all of it: it holds no pointers, not even pNext, in itself or in the structs it
+    # holds by value
+    def recordIsPlain(self, type):
+        if self.traceIsHandle(type):
+            return True
+        if self.traceIsOpaque(type):
+            return False
+        if not self.traceIsStruct(type):
+            return True
+        for member in self.traceTypeElem(type).findall('member'):
+            if '*' in self.makeCParamDecl(member, 0) or not self.recordIsPlain(member.find('type').text):
+                return False
+        return True
+    def recordIsFollowed(self, type):
+        return type in RECORD_FOLLOWED_STRUCTS or self.recordIsPlain(type)
+    # The counts of the inner arrays of an array of arrays, as a function of the index in the outer array, from the len of
+    # the pointer to it, e.g. infoCount,pInfos[].geometryCount. None if they aren't known.
+    def recordInnerCount(self, lengths):
+        if len(lengths) != 2:
+            return None
+        if lengths[1] == '1':
+            return '[](size_t) { return 1; }'
+        if re.match(r'^[\w.]+\[\]\.\w+$', lengths[1]):
+            return '[&](size_t i) { return %s; }' % lengths[1].replace('[]', '[i]')
+        return None
+    #
+    # What CommandDeepCopy copies for a followed struct, in member order: (method, member, type, count, inner count) for the
+    # pNext chain, each followed struct held by value or in a union alternative in RECORD_MEMBER_CONDITIONS, and each pointer
+    def recordStructMembers(self, struct_name):
+        members = self.traceTypeElem(struct_name).findall('member')
+        member_names = [member.find('name').text for member in members]
+        records = []
+        for member in members:
+            name = member.find('name').text
+            type = member.find('type').text
+            decl = self.makeCParamDecl(member, 0)
+            depth = decl.count('*')
+            lengths = member.get('altlen', member.get('len', '1')).split(',')
+            lengths = [re.sub(r'\b(%s)\b' % '|'.join(member_names), r's.\1', length) for length in lengths]
+            if '[' in decl:
+                continue
+            if name == 'pNext':
+                records.append(('Chain', name, type, None, None))
+            elif depth == 0:
+                if type in RECORD_FOLLOWED_STRUCTS:
+                    records.append(('Members', name, type, None, None))
+                elif self.traceIsStruct(type):
+                    for alternative in self.traceTypeElem(type).findall('member'):
+                        path = '%s.%s' % (name, alternative.find('name').text)
+                        if (struct_name, path) in RECORD_MEMBER_CONDITIONS:
+                            records.append(('Members', path, alternative.find('type').text, None, None))
+            elif type == 'char' and depth == 1:
+                records.append(('String', name, type, None, None))
+            elif type == 'void' and depth == 1 and member.get('len') is not None:
+                records.append(('Bytes', name, type, lengths[0], None))
+            elif type == 'void' or not self.recordIsFollowed(type):
+                records.append(('Null', name, type, None, None))
+            elif depth > 1:
+                inner_count = self.recordInnerCount(lengths)
+                records.append(('Arrays' if inner_count else 'Null', name, type, lengths[0], inner_count))
+            else:
+                records.append(('Array', name, type, lengths[0], None))
+        return records
+    # The followed structs, each after the ones it holds or points to, so CommandDeepCopy is specialized before it's used
+    def recordFollowedStructOrder(self):
+        order = []
+        def visit(struct_name):
+            if struct_name in order:
+                return
+            for method, name, type, count, inner_count in self.recordStructMembers(struct_name):
+                if type in RECORD_FOLLOWED_STRUCTS and type != struct_name:
+                    visit(type)
+            order.append(struct_name)
+        for struct_name in RECORD_FOLLOWED_STRUCTS:
+            visit(struct_name)
+        return order
+    #
+    # CommandDeepCopy specializations, which size and copy what followed structs point to, and the functions that do the
+    # same for pNext chains
+    def genCommandDeepCopies(self):
+        lines = ['// What each struct in RECORD_FOLLOWED_STRUCTS points to, for recorded commands to copy along with it']
+        lines += ['static size_t CommandChainSize(const void* next);']
+        lines += ['static void* CopyCommandChain(CommandPayload& payload, const void* next);']
+        lines += ['']
+        chained = []
+        for struct_name in self.recordFollowedStructOrder():
+            sizes = []
+            copies = []
+            for method, name, type, count, inner_count in self.recordStructMembers(struct_name):
+                member = 's.%s' % name
+                condition = RECORD_MEMBER_CONDITIONS.get((struct_name, name))
+                if method == 'Chain':
+                    size = 'CommandChainSize(%s)' % member
+                    copy = 'CopyCommandChain(payload, %s)' % member
+                elif method == 'Members':
+                    size = 'CommandDeepCopy<%s>::Size(%s)' % (type, member)
+                    copy = 'CommandDeepCopy<%s>::Copy(payload, %s);' % (type, member)
+                elif method == 'String':
+                    size = 'PayloadString(%s)' % member
+                    copy = 'payload.CopyString(%s)' % member
+                elif method == 'Bytes':
+                    size = 'PayloadBytes(%s, %s)' % (member, count)
+                    copy = 'payload.CopyBytes(%s, %s)' % (member, count)
+                elif method == 'Array':
+                    size = 'PayloadSize(%s, %s)' % (member, count)
+                    copy = 'payload.CopyArray(%s, %s)' % (member, count)
+                elif method == 'Arrays':
+                    size = 'PayloadSize(%s, %s, %s)' % (member, count, inner_count)
+                    copy = 'payload.CopyArrays(%s, %s, %s)' % (member, count, inner_count)
+                else:
+                    size = None
+                    copy = 'nullptr'
+                if size is not None:
+                    sizes.append('if (%s) size += %s;' % (condition, size) if condition else 'size += %s;' % size)
+                if method == 'Members':
+                    copies.append('if (%s) %s' % (condition, copy) if condition else copy)
+                else:
+                    copies.append('%s = %s ? %s : nullptr;' % (member, condition, copy) if condition else '%s = %s;' % (member, copy))
+            stype = self.traceTypeElem(struct_name).find("member/[name='sType']")
+            if stype is not None and stype.get('values') is not None:
+                chained.append((stype.get('values'), struct_name))
+            lines += ['template <>']
+            lines += ['struct CommandDeepCopy<%s> {' % struct_name]
+            lines += ['    static constexpr bool kDeep = true;']
+            lines += ['    static size_t Size(const %s& s) {' % struct_name]
+            if len(sizes) == 1 and not sizes[0].startswith('if'):
+                lines += ['        return %s' % sizes[0][len('size += '):]]
+            else:
+                lines += ['        size_t size = 0;']
+                lines += ['        %s' % size for size in sizes]
+                lines += ['        return size;']
+            lines += ['    }']
+            lines += ['    static void Copy(CommandPayload& payload, %s& s) {' % struct_name]
+            lines += ['        %s' % copy for copy in copies]
+            lines += ['    }']
+            lines += ['};']
+            lines += ['']
+        lines += ['// Bytes needed to copy the structs of a pNext chain that are in RECORD_FOLLOWED_STRUCTS, with what they point to']
+        lines += ['static size_t CommandChainSize(const void* next) {']
+        lines += ['    for (auto s = static_cast<const VkBaseInStructure*>(next); s; s = s->pNext) {']
+        lines += ['        switch (s->sType) {']
+        for stype, struct_name in chained:
+            lines += ['            case %s:' % stype]
+            lines += ['                return PayloadSize(reinterpret_cast<const %s*>(s), 1);' % struct_name]
+        lines += ['            default:']
+        lines += ['                break;']
+        lines += ['        }']
+        lines += ['    }']
+        lines += ['    return 0;']
+        lines += ['}']
+        lines += ['']
+        lines += ['// Copies a pNext chain into a command\'s payload, leaving out the structs that aren\'t in RECORD_FOLLOWED_STRUCTS']
+        lines += ['static void* CopyCommandChain(CommandPayload& payload, const void* next) {']
+        lines += ['    for (auto s = static_cast<const VkBaseInStructure*>(next); s; s = s->pNext) {']
+        lines += ['        switch (s->sType) {']
+        for stype, struct_name in chained:
+            lines += ['            case %s:' % stype]
+            lines += ['                return const_cast<%s*>(payload.CopyArray(reinterpret_cast<const %s*>(s), 1));' % (struct_name, struct_name)]
+        lines += ['            default:']
+        lines += ['                break;']
+        lines += ['        }']
+        lines += ['    }']
+        lines += ['    return nullptr;']
+        lines += ['}']
+        return '\n'.join(lines)
+    #
+    # The registry's entry for a type, following aliases. Structs and platform types are named by attribute, handles and
+    # base types by a name element.
+    def traceTypeElem(self, type):
+        type_elem = self.registry.tree.find("types/type/[@name='%s']" % type)
+        if type_elem is None:
+            type_elem = self.registry.tree.find("types/type/[name='%s']" % type)
+        if type_elem is not None and type_elem.get('alias') is not None:
+            return self.traceTypeElem(type_elem.get('alias'))
+        return type_elem
+    def traceIsHandle(self, type):
+        type_elem = self.traceTypeElem(type)
+        return type_elem is not None and type_elem.get('category') == 'handle'
+    def traceIsStruct(self, type):
+        type_elem = self.traceTypeElem(type)
+        return type_elem is not None and type_elem.get('category') in ['struct', 'union']
+    # Platform types the mock ICD can only know the address of, e.g. AHardwareBuffer
+    def traceIsOpaque(self, type):
+        type_elem = self.traceTypeElem(type)
+        if type_elem is None:
+            return False
+        category = type_elem.get('category')
+        return ((category == 'struct' and type_elem.find('member') is None) or
+                (category is None and type_elem.get('requires') not in [None, 'vk_platform']))
+    # Whether a type's bytes are all there is to it: it holds no pointers other than pNext, handles, function pointers or
+    # platform types, not even in the structs it holds by value
+    def traceIsPlain(self, type):
+        if self.traceIsHandle(type) or self.traceIsOpaque(type):
+            return False
+        type_elem = self.traceTypeElem(type)
+        if type_elem is None or not self.traceIsStruct(type):
+            return type_elem is None or type_elem.get('category') != 'funcpointer'
+        for member in type_elem.findall('member'):
+            if member.find('name').text == 'pNext':
+                continue
+            if '*' in self.makeCParamDecl(member, 0) or not self.traceIsPlain(member.find('type').text):
+                return False
+        return True
+    #
+    # What TraceMembers records for a followed struct, in member order: (method, member, type, count) for each handle,
+    # followed struct held by value and pointer other than pNext. Structs held by value record their own members, by the
+    # 'Members' method.
+    def traceStructMembers(self, struct_name):
+        members = self.traceTypeElem(struct_name).findall('member')
+        member_names = [member.find('name').text for member in members]
+        records = []
+        for member in members:
+            name = member.find('name').text
+            type = member.find('type').text
+            decl = self.makeCParamDecl(member, 0)
+            depth = decl.count('*')
+            count = member.get('altlen', member.get('len', '1')).split(',')[0]
+            count = re.sub(r'\b(%s)\b' % '|'.join(member_names), r's.\1', count)
+            if name == 'pNext' or '[' in decl:
+                continue
+            if depth == 0:
+                if self.traceIsHandle(type):
+                    records.append(('Handle', name, type, None))
+                elif type in TRACE_FOLLOWED_STRUCTS:
+                    records.append(('Members', name, type, None))
+            elif depth > 1:
+                records.append(('Strings' if type == 'char' else 'Address', name, type, count))
+            elif type == 'char':
+                records.append(('String', name, type, None))
+            elif self.traceIsHandle(type):
+                records.append(('Handles', name, type, count))
+            elif type == 'void':
+                records.append(('Bytes' if member.get('len') is not None else 'Address', name, type, count))
+            elif type in TRACE_FOLLOWED_STRUCTS or self.traceIsPlain(type):
+                records.append(('Array', name, type, count))
+            else:
+                records.append(('Address', name, type, None))
+        return records
+    # How many arguments TraceMembers records for a followed struct
+    def traceStructMemberCount(self, struct_name):
+        count = 0
+        for method, name, type, length in self.traceStructMembers(struct_name):
+            count += self.traceStructMemberCount(type) if method == 'Members' else 1
+        return count
+    # The followed structs, each after the ones it holds or points to, so TraceMembers and ReplayMembers are specialized
+    # before they're used
+    def traceFollowedStructOrder(self):
+        order = []
+        def visit(struct_name):
+            if struct_name in order:
+                return
+            for method, name, type, length in self.traceStructMembers(struct_name):
+                if type in TRACE_FOLLOWED_STRUCTS and type != struct_name:
+                    visit(type)
+            order.append(struct_name)
+        for struct_name in TRACE_FOLLOWED_STRUCTS:
+            visit(struct_name)
+        return order
+    #
+    # TraceMembers specializations, which record what followed structs hold beyond their bytes
+    def genTraceMembers(self):
+        lines = ['// The handles held by each struct in TRACE_FOLLOWED_STRUCTS, and what its pointers point to']
+        for struct_name in self.traceFollowedStructOrder():
+            lines += ['template <>']
+            lines += ['struct TraceMembers<%s> {' % struct_name]
+            lines += ['    static constexpr uint32_t kCount = %d;' % self.traceStructMemberCount(struct_name)]
+            lines += ['    static void Record(TraceRecord &trace, const %s &s) {' % struct_name]
+            for method, name, type, count in self.traceStructMembers(struct_name):
+                member = 's.%s' % name
+                condition = TRACE_MEMBER_CONDITIONS.get((struct_name, name))
+                if condition is not None:
+                    member = '%s ? %s : nullptr' % (condition, member)
+                if method == 'Members':
+                    lines += ['        TraceMembers<%s>::Record(trace, %s);' % (type, member)]
+                elif method in ['Handle', 'String', 'Address']:
+                    lines += ['        trace.%s(%s);' % (method, member)]
+                else:
+                    lines += ['        trace.%s(%s, %s);' % (method, member, count)]
+            lines += ['    }']
+            lines += ['};']
+            lines += ['']
+        return '\n'.join(lines)
+    #
+    # How the trace records a parameter: the TraceRecord method, and the count of the arrays it takes. Outputs are recorded
+    # as the call left them, counted by another output if need be.
+    def traceParam(self, param, params):
+        param_names = [p.find('name').text for p in params]
+        name = param.find('name').text
+        type = param.find('type').text
+        decl = self.makeCParamDecl(param, 0)
+        depth = decl.count('*')
+        length = param.attrib.get('len', '').split(',')[0].replace('::', '->')
+        if length.split('->')[0] not in param_names:
+            length = None
+        fixed_array = re.search(r'\[(\w+)\]', decl)
+        if fixed_array:
+            return ('Array', fixed_array.group(1))
+        if depth == 0:
+            return ('Handle' if self.traceIsHandle(type) else 'Value', None)
+        if depth > 1 or self.traceIsOpaque(type):
+            return ('Address', None)
+        count = length if length is not None else '1'
+        if (not decl.lstrip().startswith('const') and length in param_names and
+                '*' in self.makeCParamDecl(params[param_names.index(length)], 0)):
+            count = '%s ? *%s : 0' % (name, length)
+        if type == 'char':
+            return ('String', None)
+        if type == 'void':
+            return ('Bytes', count) if length is not None else ('Address', None)
+        return ('Handles' if self.traceIsHandle(type) else 'Array', count)
+    #
+    # How a traced entry point records one of its parameters, see TraceRecord in mock_icd_trace.h. Outputs of calls that
+    # failed are recorded as null, as are those of deferred calls, which joining threads write later.
+    def genTraceParam(self, param, params, result_type):
+        name = param.find('name').text
+        method, count = self.traceParam(param, params)
+        if method in ['Value', 'Handle', 'String', 'Address']:
+            return 'trace.%s(%s);' % (method, name)
+        if result_type == 'VkResult' and not self.makeCParamDecl(param, 0).lstrip().startswith('const'):
+            deferrable = any(other.find('type').text == 'VkDeferredOperationKHR' for other in params)
+            condition = 'result >= 0 && result != VK_OPERATION_DEFERRED_KHR' if deferrable else 'result >= 0'
+            name = '%s ? %s : nullptr' % (condition, name)
+        return 'trace.%s(%s, %s);' % (method, name, count)
+    #
+    # The entry points GetInstanceProcAddr returns while tracing, which make each call and then record it, and the functions
+    # that find them and size pNext chains
+    def genTracedEntryPoints(self):
+        slots, displacements = self.layoutProcTable()
+        slot_indices = dict((name, i) for i, (name, protect) in enumerate(slots))
+        lines = [self.genTraceMembers()]
+        lines += ['// Entry points GetInstanceProcAddr returns while tracing, which make each call and then record it, see']
+        lines += ['// mock_icd_trace.h. A record gives its entry point by the entry point\'s slot in kProcTable.']
+        for name, protect, cmdinfo, decl in self.traced_cmds:
+            params = cmdinfo.elem.findall('param')
+            param_names = [param.find('name').text for param in params]
+            result_type = cmdinfo.elem.find('proto/type').text
+            call = '%s(%s)' % (name[2:], ', '.join(param_names))
+            lines += ['']
+            if protect is not None:
+                lines += ['#ifdef %s' % protect]
+            lines += ['static %s' % decl[:-1].replace('VKAPI_CALL %s(' % name[2:], 'VKAPI_CALL Traced%s(' % name[2:], 1)]
+            lines += ['{']
+            lines += ['    const uint64_t timestamp = TraceTimestamp();']
+            if result_type == 'void':
+                lines += ['    %s;' % call]
+            else:
+                lines += ['    const %s result = %s;' % (result_type, call)]
+            lines += ['    TraceRecord trace(GetTraceFile(), %d, timestamp);' % slot_indices[name]]
+            lines += ['    ' + self.genTraceParam(param, params, result_type) for param in params]
+            if result_type != 'void':
+                lines += ['    trace.Value(result);']
+                lines += ['    return result;']
+            lines += ['}']
+            if protect is not None:
+                lines += ['#endif']
+        lines += ['']
+        lines += ['// The traced entry point in each slot of kProcTable']
+        lines += ['static void* const kTracedProcTable[%d] = {' % len(slots)]
+        for name, protect in slots:
+            if protect is None:
+                lines += ['    (void*)Traced%s,' % name[2:]]
+            else:
+                lines += ['#ifdef %s' % protect]
+                lines += ['    (void*)Traced%s,' % name[2:]]
+                lines += ['#else']
+                lines += ['    nullptr,']
+                lines += ['#endif']
+        lines += ['};']
+        lines += ['']
+        lines += ['static void* GetTracedProc(size_t slot) { return kTracedProcTable[slot]; }']
+        lines += ['']
+        lines += ['static uint32_t TraceStructSize(VkStructureType sType) {']
+        lines += ['    switch (sType) {']
+        current_protect = None
+        for stype, struct_name, protect in self.struct_types:
+            if protect != current_protect:
+                if current_protect is not None:
+                    lines += ['#endif']
+                if protect is not None:
+                    lines += ['#ifdef %s' % protect]
+                current_protect = protect
+            lines += ['        case %s: return sizeof(%s);' % (stype, struct_name)]
+        if current_protect is not None:
+            lines += ['#endif']
+        lines += ['        default: return 0;']
+        lines += ['    }']
+        lines += ['}']
+        return '\n'.join(lines)
+    #
+    # The entry points GetInstanceProcAddr returns while counting calls, which time each call of the entry point it would
+    # otherwise return
+    def genCountedEntryPoints(self):
+        slots, displacements = self.layoutProcTable()
+        slot_indices = dict((name, i) for i, (name, protect) in enumerate(slots))
+        lines = ['// Entry points GetInstanceProcAddr returns while counting calls, which time each call of the one it would']
+        lines += ['// otherwise return, see mock_icd_call_stats.h. Calls are counted by their entry point\'s slot in kProcTable.']
+        for name, protect, cmdinfo, decl in self.traced_cmds:
+            param_names = [param.find('name').text for param in cmdinfo.elem.findall('param')]
+            lines += ['']
+            if protect is not None:
+                lines += ['#ifdef %s' % protect]
+            lines += ['static %s' % decl[:-1].replace('VKAPI_CALL %s(' % name[2:], 'VKAPI_CALL Counted%s(' % name[2:], 1)]
+            lines += ['{']
+            lines += ['    const CallTimer timer(GetCallStats(), %d);' % slot_indices[name]]
+            lines += ['    return (GetTraceFile() ? Traced%s : %s)(%s);' % (name[2:], name[2:], ', '.join(param_names))]
+            lines += ['}']
+            if protect is not None:
+                lines += ['#endif']
+        lines += ['']
+        lines += ['// The counted entry point in each slot of kProcTable']
+        lines += ['static void* const kCountedProcTable[%d] = {' % len(slots)]
+        for name, protect in slots:
+            if protect is None:
+                lines += ['    (void*)Counted%s,' % name[2:]]
+            else:
+                lines += ['#ifdef %s' % protect]
+                lines += ['    (void*)Counted%s,' % name[2:]]
+                lines += ['#else']
+                lines += ['    nullptr,']
+                lines += ['#endif']
+        lines += ['};']
+        lines += ['']
+        lines += ['static void* GetCountedProc(size_t slot) { return kCountedProcTable[slot]; }']
+        return '\n'.join(lines)
+    #
+    # Whether vktracereplay can make a call from its record: every struct it takes must either hold nothing but its bytes
+    # or be one the trace follows, except for the allocator, which replay leaves out
+    def traceReplayable(self, params):
+        for param in params:
+            type = param.find('type').text
+            decl = self.makeCParamDecl(param, 0)
+            if decl.count('*') != 1 or not self.traceIsStruct(type) or type == 'VkAllocationCallbacks':
+                continue
+            if decl.lstrip().startswith('const') and type in TRACE_FOLLOWED_STRUCTS:
+                continue
+            if not self.traceIsPlain(type):
+                return False
+        return True
+    #
+    # The ReplayPrep method that reads a parameter's argument back, see tracereplay.h
+    def replayParamMethod(self, param, params):
+        type = param.find('type').text
+        decl = self.makeCParamDecl(param, 0)
+        output = '*' in decl and not decl.lstrip().startswith('const')
+        method, count = self.traceParam(param, params)
+        if type == 'VkAllocationCallbacks':
+            return 'Allocator'
+        if method == 'Address' and output and decl.count('*') > 1:
+            return 'Scratch'
+        if method == 'Handles' and output:
+            return 'NewHandles'
+        return method
+    #
+    # ReplayMembers specializations, which read back what TraceMembers recorded
+    def genReplayMembers(self):
+        lines = ['// Reads back the handles held by each struct in TRACE_FOLLOWED_STRUCTS, and what its pointers point to']
+        for struct_name in self.traceFollowedStructOrder():
+            reads = ['prep.%s(s.%s)' % (method, name) for method, name, type, count in self.traceStructMembers(struct_name)]
+            lines += ['template <>']
+            lines += ['struct ReplayMembers<%s> {' % struct_name]
+            lines += ['    static constexpr uint32_t kCount = %d;' % self.traceStructMemberCount(struct_name)]
+            lines += ['    static bool Prepare(ReplayPrep &prep, %s &s) {' % struct_name]
+            lines += ['        return %s;' % ' &&\n               '.join(reads)]
+            lines += ['    }']
+            lines += ['};']
+            lines += ['']
+        return '\n'.join(lines)
+    #
+    # For each entry point vktracereplay can make calls to, a struct of the call's arguments, a function that prepares one
+    # from a record in the trace and one that makes the call with it, then the table of them all
+    def genReplayEntryPoints(self):
+        lines = [self.genReplayMembers()]
+        entry_points = []
+        for name, protect, cmdinfo, decl in self.traced_cmds:
+            params = cmdinfo.elem.findall('param')
+            if not self.traceReplayable(params):
+                continue
+            param_names = [param.find('name').text for param in params]
+            result_type = cmdinfo.elem.find('proto/type').text
+            members = []
+            for param in params:
+                member = self.makeCParamDecl(param, self.genOpts.alignFuncParam)
+                # Fixed size arrays are prepared like any other
+                member = re.sub(r'(\S)(\s+)(\w+)\[\w+\]$', lambda m: m.group(1) + '*' + m.group(2)[1:] + m.group(3), member)
+                members.append(member + ';')
+            reads = ['prep.%s(args.%s)' % (self.replayParamMethod(param, params), param.find('name').text) for param in params]
+            if result_type == 'VkResult':
+                reads += ['prep.Result()']
+            elif result_type != 'void':
+                reads += ['prep.Skip()']
+            call = 'reinterpret_cast<PFN_%s>(proc)(%s)' % (name, ', '.join('args.%s' % n for n in param_names))
+            if protect is not None:
+                lines += ['#ifdef %s' % protect]
+            lines += ['struct %sArgs {' % name[2:]]
+            lines += members
+            lines += ['};']
+            lines += ['']
+            lines += ['static bool Prepare%s(ReplayPrep &prep) {' % name[2:]]
+            lines += ['    %sArgs &args = prep.NewArgs<%sArgs>();' % (name[2:], name[2:])]
+            lines += ['    return %s;' % ' &&\n           '.join(reads)]
+            lines += ['}']
+            lines += ['']
+            lines += ['static VkResult Invoke%s(PFN_vkVoidFunction proc, void *data) {' % name[2:]]
+            lines += ['    const %sArgs &args = *static_cast<const %sArgs *>(data);' % (name[2:], name[2:])]
+            if result_type == 'VkResult':
+                lines += ['    return %s;' % call]
+            else:
+                lines += ['    %s;' % call]
+                lines += ['    return VK_SUCCESS;']
+            lines += ['}']
+            if protect is not None:
+                lines += ['#endif']
+            lines += ['']
+            entry_points += [ (name, protect) ]
+        lines += ['// Entry points vktracereplay can make calls to, sorted by name']
+        lines += ['static const ReplayEntryPoint kReplayEntryPoints[] = {']
+        for name, protect in sorted(entry_points):
+            if protect is not None:
+                lines += ['#ifdef %s' % protect]
+            lines += ['    {"%s", Prepare%s, Invoke%s},' % (name, name[2:], name[2:])]
+            if protect is not None:
+                lines += ['#endif']
+        lines += ['};']
+        return '\n'.join(lines)
+    #
     # override makeProtoName to drop the "vk" prefix
     def makeProtoName(self, name, tail):
         return self.genOpts.apientry + name[2:] + tail
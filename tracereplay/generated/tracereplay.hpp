@@ -0,0 +1,9309 @@
+/*
+** Copyright (c) 2015-2018 The Khronos Group Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+/*
+** This header is generated from the Khronos Vulkan XML API Registry.
+**
+*/
+
+#include "tracereplay.h"
+
+// Reads back the handles held by each struct in TRACE_FOLLOWED_STRUCTS, and what its pointers point to
+template <>
+struct ReplayMembers<VkApplicationInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkApplicationInfo &s) {
+        return prep.String(s.pApplicationName) &&
+               prep.String(s.pEngineName);
+    }
+};
+
+template <>
+struct ReplayMembers<VkInstanceCreateInfo> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkInstanceCreateInfo &s) {
+        return prep.Array(s.pApplicationInfo) &&
+               prep.Strings(s.ppEnabledLayerNames) &&
+               prep.Strings(s.ppEnabledExtensionNames);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDeviceQueueCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDeviceQueueCreateInfo &s) {
+        return prep.Array(s.pQueuePriorities);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDeviceCreateInfo> {
+    static constexpr uint32_t kCount = 4;
+    static bool Prepare(ReplayPrep &prep, VkDeviceCreateInfo &s) {
+        return prep.Array(s.pQueueCreateInfos) &&
+               prep.Strings(s.ppEnabledLayerNames) &&
+               prep.Strings(s.ppEnabledExtensionNames) &&
+               prep.Array(s.pEnabledFeatures);
+    }
+};
+
+template <>
+struct ReplayMembers<VkBufferCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkBufferCreateInfo &s) {
+        return prep.Array(s.pQueueFamilyIndices);
+    }
+};
+
+template <>
+struct ReplayMembers<VkImageCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkImageCreateInfo &s) {
+        return prep.Array(s.pQueueFamilyIndices);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSwapchainCreateInfoKHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkSwapchainCreateInfoKHR &s) {
+        return prep.Handle(s.surface) &&
+               prep.Array(s.pQueueFamilyIndices) &&
+               prep.Handle(s.oldSwapchain);
+    }
+};
+
+template <>
+struct ReplayMembers<VkImageViewCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkImageViewCreateInfo &s) {
+        return prep.Handle(s.image);
+    }
+};
+
+template <>
+struct ReplayMembers<VkBufferViewCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkBufferViewCreateInfo &s) {
+        return prep.Handle(s.buffer);
+    }
+};
+
+template <>
+struct ReplayMembers<VkShaderModuleCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkShaderModuleCreateInfo &s) {
+        return prep.Array(s.pCode);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineCacheCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkPipelineCacheCreateInfo &s) {
+        return prep.Bytes(s.pInitialData);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSpecializationInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkSpecializationInfo &s) {
+        return prep.Array(s.pMapEntries) &&
+               prep.Bytes(s.pData);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineShaderStageCreateInfo> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkPipelineShaderStageCreateInfo &s) {
+        return prep.Handle(s.module) &&
+               prep.String(s.pName) &&
+               prep.Array(s.pSpecializationInfo);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineVertexInputStateCreateInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkPipelineVertexInputStateCreateInfo &s) {
+        return prep.Array(s.pVertexBindingDescriptions) &&
+               prep.Array(s.pVertexAttributeDescriptions);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineViewportStateCreateInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkPipelineViewportStateCreateInfo &s) {
+        return prep.Array(s.pViewports) &&
+               prep.Array(s.pScissors);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineMultisampleStateCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkPipelineMultisampleStateCreateInfo &s) {
+        return prep.Array(s.pSampleMask);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineColorBlendStateCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkPipelineColorBlendStateCreateInfo &s) {
+        return prep.Array(s.pAttachments);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineDynamicStateCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkPipelineDynamicStateCreateInfo &s) {
+        return prep.Array(s.pDynamicStates);
+    }
+};
+
+template <>
+struct ReplayMembers<VkGraphicsPipelineCreateInfo> {
+    static constexpr uint32_t kCount = 13;
+    static bool Prepare(ReplayPrep &prep, VkGraphicsPipelineCreateInfo &s) {
+        return prep.Array(s.pStages) &&
+               prep.Array(s.pVertexInputState) &&
+               prep.Array(s.pInputAssemblyState) &&
+               prep.Array(s.pTessellationState) &&
+               prep.Array(s.pViewportState) &&
+               prep.Array(s.pRasterizationState) &&
+               prep.Array(s.pMultisampleState) &&
+               prep.Array(s.pDepthStencilState) &&
+               prep.Array(s.pColorBlendState) &&
+               prep.Array(s.pDynamicState) &&
+               prep.Handle(s.layout) &&
+               prep.Handle(s.renderPass) &&
+               prep.Handle(s.basePipelineHandle);
+    }
+};
+
+template <>
+struct ReplayMembers<VkComputePipelineCreateInfo> {
+    static constexpr uint32_t kCount = 5;
+    static bool Prepare(ReplayPrep &prep, VkComputePipelineCreateInfo &s) {
+        return prep.Members(s.stage) &&
+               prep.Handle(s.layout) &&
+               prep.Handle(s.basePipelineHandle);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDescriptorSetLayoutBinding> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDescriptorSetLayoutBinding &s) {
+        return prep.Handles(s.pImmutableSamplers);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDescriptorSetLayoutCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDescriptorSetLayoutCreateInfo &s) {
+        return prep.Array(s.pBindings);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineLayoutCreateInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkPipelineLayoutCreateInfo &s) {
+        return prep.Handles(s.pSetLayouts) &&
+               prep.Array(s.pPushConstantRanges);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDescriptorPoolCreateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDescriptorPoolCreateInfo &s) {
+        return prep.Array(s.pPoolSizes);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDescriptorSetAllocateInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkDescriptorSetAllocateInfo &s) {
+        return prep.Handle(s.descriptorPool) &&
+               prep.Handles(s.pSetLayouts);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDescriptorImageInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkDescriptorImageInfo &s) {
+        return prep.Handle(s.sampler) &&
+               prep.Handle(s.imageView);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDescriptorBufferInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDescriptorBufferInfo &s) {
+        return prep.Handle(s.buffer);
+    }
+};
+
+template <>
+struct ReplayMembers<VkWriteDescriptorSet> {
+    static constexpr uint32_t kCount = 4;
+    static bool Prepare(ReplayPrep &prep, VkWriteDescriptorSet &s) {
+        return prep.Handle(s.dstSet) &&
+               prep.Array(s.pImageInfo) &&
+               prep.Array(s.pBufferInfo) &&
+               prep.Handles(s.pTexelBufferView);
+    }
+};
+
+template <>
+struct ReplayMembers<VkCopyDescriptorSet> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkCopyDescriptorSet &s) {
+        return prep.Handle(s.srcSet) &&
+               prep.Handle(s.dstSet);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSubpassDescription> {
+    static constexpr uint32_t kCount = 5;
+    static bool Prepare(ReplayPrep &prep, VkSubpassDescription &s) {
+        return prep.Array(s.pInputAttachments) &&
+               prep.Array(s.pColorAttachments) &&
+               prep.Array(s.pResolveAttachments) &&
+               prep.Array(s.pDepthStencilAttachment) &&
+               prep.Array(s.pPreserveAttachments);
+    }
+};
+
+template <>
+struct ReplayMembers<VkRenderPassCreateInfo> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkRenderPassCreateInfo &s) {
+        return prep.Array(s.pAttachments) &&
+               prep.Array(s.pSubpasses) &&
+               prep.Array(s.pDependencies);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSubpassDescription2> {
+    static constexpr uint32_t kCount = 5;
+    static bool Prepare(ReplayPrep &prep, VkSubpassDescription2 &s) {
+        return prep.Array(s.pInputAttachments) &&
+               prep.Array(s.pColorAttachments) &&
+               prep.Array(s.pResolveAttachments) &&
+               prep.Array(s.pDepthStencilAttachment) &&
+               prep.Array(s.pPreserveAttachments);
+    }
+};
+
+template <>
+struct ReplayMembers<VkRenderPassCreateInfo2> {
+    static constexpr uint32_t kCount = 4;
+    static bool Prepare(ReplayPrep &prep, VkRenderPassCreateInfo2 &s) {
+        return prep.Array(s.pAttachments) &&
+               prep.Array(s.pSubpasses) &&
+               prep.Array(s.pDependencies) &&
+               prep.Array(s.pCorrelatedViewMasks);
+    }
+};
+
+template <>
+struct ReplayMembers<VkFramebufferCreateInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkFramebufferCreateInfo &s) {
+        return prep.Handle(s.renderPass) &&
+               prep.Handles(s.pAttachments);
+    }
+};
+
+template <>
+struct ReplayMembers<VkRenderPassBeginInfo> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkRenderPassBeginInfo &s) {
+        return prep.Handle(s.renderPass) &&
+               prep.Handle(s.framebuffer) &&
+               prep.Array(s.pClearValues);
+    }
+};
+
+template <>
+struct ReplayMembers<VkCommandBufferAllocateInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkCommandBufferAllocateInfo &s) {
+        return prep.Handle(s.commandPool);
+    }
+};
+
+template <>
+struct ReplayMembers<VkCommandBufferInheritanceInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkCommandBufferInheritanceInfo &s) {
+        return prep.Handle(s.renderPass) &&
+               prep.Handle(s.framebuffer);
+    }
+};
+
+template <>
+struct ReplayMembers<VkCommandBufferBeginInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkCommandBufferBeginInfo &s) {
+        return prep.Array(s.pInheritanceInfo);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSubmitInfo> {
+    static constexpr uint32_t kCount = 4;
+    static bool Prepare(ReplayPrep &prep, VkSubmitInfo &s) {
+        return prep.Handles(s.pWaitSemaphores) &&
+               prep.Array(s.pWaitDstStageMask) &&
+               prep.Handles(s.pCommandBuffers) &&
+               prep.Handles(s.pSignalSemaphores);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSemaphoreSubmitInfoKHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkSemaphoreSubmitInfoKHR &s) {
+        return prep.Handle(s.semaphore);
+    }
+};
+
+template <>
+struct ReplayMembers<VkCommandBufferSubmitInfoKHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkCommandBufferSubmitInfoKHR &s) {
+        return prep.Handle(s.commandBuffer);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSubmitInfo2KHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkSubmitInfo2KHR &s) {
+        return prep.Array(s.pWaitSemaphoreInfos) &&
+               prep.Array(s.pCommandBufferInfos) &&
+               prep.Array(s.pSignalSemaphoreInfos);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPresentInfoKHR> {
+    static constexpr uint32_t kCount = 4;
+    static bool Prepare(ReplayPrep &prep, VkPresentInfoKHR &s) {
+        return prep.Handles(s.pWaitSemaphores) &&
+               prep.Handles(s.pSwapchains) &&
+               prep.Array(s.pImageIndices) &&
+               prep.Array(s.pResults);
+    }
+};
+
+template <>
+struct ReplayMembers<VkAcquireNextImageInfoKHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkAcquireNextImageInfoKHR &s) {
+        return prep.Handle(s.swapchain) &&
+               prep.Handle(s.semaphore) &&
+               prep.Handle(s.fence);
+    }
+};
+
+template <>
+struct ReplayMembers<VkMappedMemoryRange> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkMappedMemoryRange &s) {
+        return prep.Handle(s.memory);
+    }
+};
+
+template <>
+struct ReplayMembers<VkBufferMemoryBarrier> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkBufferMemoryBarrier &s) {
+        return prep.Handle(s.buffer);
+    }
+};
+
+template <>
+struct ReplayMembers<VkImageMemoryBarrier> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkImageMemoryBarrier &s) {
+        return prep.Handle(s.image);
+    }
+};
+
+template <>
+struct ReplayMembers<VkBufferMemoryBarrier2KHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkBufferMemoryBarrier2KHR &s) {
+        return prep.Handle(s.buffer);
+    }
+};
+
+template <>
+struct ReplayMembers<VkImageMemoryBarrier2KHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkImageMemoryBarrier2KHR &s) {
+        return prep.Handle(s.image);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDependencyInfoKHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkDependencyInfoKHR &s) {
+        return prep.Array(s.pMemoryBarriers) &&
+               prep.Array(s.pBufferMemoryBarriers) &&
+               prep.Array(s.pImageMemoryBarriers);
+    }
+};
+
+template <>
+struct ReplayMembers<VkBindBufferMemoryInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkBindBufferMemoryInfo &s) {
+        return prep.Handle(s.buffer) &&
+               prep.Handle(s.memory);
+    }
+};
+
+template <>
+struct ReplayMembers<VkBindImageMemoryInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkBindImageMemoryInfo &s) {
+        return prep.Handle(s.image) &&
+               prep.Handle(s.memory);
+    }
+};
+
+template <>
+struct ReplayMembers<VkBufferMemoryRequirementsInfo2> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkBufferMemoryRequirementsInfo2 &s) {
+        return prep.Handle(s.buffer);
+    }
+};
+
+template <>
+struct ReplayMembers<VkImageMemoryRequirementsInfo2> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkImageMemoryRequirementsInfo2 &s) {
+        return prep.Handle(s.image);
+    }
+};
+
+template <>
+struct ReplayMembers<VkImageSparseMemoryRequirementsInfo2> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkImageSparseMemoryRequirementsInfo2 &s) {
+        return prep.Handle(s.image);
+    }
+};
+
+template <>
+struct ReplayMembers<VkBufferDeviceAddressInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkBufferDeviceAddressInfo &s) {
+        return prep.Handle(s.buffer);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDeviceMemoryOpaqueCaptureAddressInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDeviceMemoryOpaqueCaptureAddressInfo &s) {
+        return prep.Handle(s.memory);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSemaphoreWaitInfo> {
+    static constexpr uint32_t kCount = 2;
+    static bool Prepare(ReplayPrep &prep, VkSemaphoreWaitInfo &s) {
+        return prep.Handles(s.pSemaphores) &&
+               prep.Array(s.pValues);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSemaphoreSignalInfo> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkSemaphoreSignalInfo &s) {
+        return prep.Handle(s.semaphore);
+    }
+};
+
+template <>
+struct ReplayMembers<VkCopyBufferInfo2KHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkCopyBufferInfo2KHR &s) {
+        return prep.Handle(s.srcBuffer) &&
+               prep.Handle(s.dstBuffer) &&
+               prep.Array(s.pRegions);
+    }
+};
+
+template <>
+struct ReplayMembers<VkCopyImageInfo2KHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkCopyImageInfo2KHR &s) {
+        return prep.Handle(s.srcImage) &&
+               prep.Handle(s.dstImage) &&
+               prep.Array(s.pRegions);
+    }
+};
+
+template <>
+struct ReplayMembers<VkCopyBufferToImageInfo2KHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkCopyBufferToImageInfo2KHR &s) {
+        return prep.Handle(s.srcBuffer) &&
+               prep.Handle(s.dstImage) &&
+               prep.Array(s.pRegions);
+    }
+};
+
+template <>
+struct ReplayMembers<VkCopyImageToBufferInfo2KHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkCopyImageToBufferInfo2KHR &s) {
+        return prep.Handle(s.srcImage) &&
+               prep.Handle(s.dstBuffer) &&
+               prep.Array(s.pRegions);
+    }
+};
+
+template <>
+struct ReplayMembers<VkBlitImageInfo2KHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkBlitImageInfo2KHR &s) {
+        return prep.Handle(s.srcImage) &&
+               prep.Handle(s.dstImage) &&
+               prep.Array(s.pRegions);
+    }
+};
+
+template <>
+struct ReplayMembers<VkResolveImageInfo2KHR> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkResolveImageInfo2KHR &s) {
+        return prep.Handle(s.srcImage) &&
+               prep.Handle(s.dstImage) &&
+               prep.Array(s.pRegions);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDebugUtilsLabelEXT> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDebugUtilsLabelEXT &s) {
+        return prep.String(s.pLabelName);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDebugMarkerMarkerInfoEXT> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDebugMarkerMarkerInfoEXT &s) {
+        return prep.String(s.pMarkerName);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDescriptorUpdateTemplateCreateInfo> {
+    static constexpr uint32_t kCount = 3;
+    static bool Prepare(ReplayPrep &prep, VkDescriptorUpdateTemplateCreateInfo &s) {
+        return prep.Array(s.pDescriptorUpdateEntries) &&
+               prep.Handle(s.descriptorSetLayout) &&
+               prep.Handle(s.pipelineLayout);
+    }
+};
+
+template <>
+struct ReplayMembers<VkConditionalRenderingBeginInfoEXT> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkConditionalRenderingBeginInfoEXT &s) {
+        return prep.Handle(s.buffer);
+    }
+};
+
+template <>
+struct ReplayMembers<VkFenceGetFdInfoKHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkFenceGetFdInfoKHR &s) {
+        return prep.Handle(s.fence);
+    }
+};
+
+template <>
+struct ReplayMembers<VkSemaphoreGetFdInfoKHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkSemaphoreGetFdInfoKHR &s) {
+        return prep.Handle(s.semaphore);
+    }
+};
+
+template <>
+struct ReplayMembers<VkMemoryGetFdInfoKHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkMemoryGetFdInfoKHR &s) {
+        return prep.Handle(s.memory);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPhysicalDeviceSurfaceInfo2KHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkPhysicalDeviceSurfaceInfo2KHR &s) {
+        return prep.Handle(s.surface);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDisplayPlaneInfo2KHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDisplayPlaneInfo2KHR &s) {
+        return prep.Handle(s.mode);
+    }
+};
+
+template <>
+struct ReplayMembers<VkDisplaySurfaceCreateInfoKHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkDisplaySurfaceCreateInfoKHR &s) {
+        return prep.Handle(s.displayMode);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineInfoKHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkPipelineInfoKHR &s) {
+        return prep.Handle(s.pipeline);
+    }
+};
+
+template <>
+struct ReplayMembers<VkPipelineExecutableInfoKHR> {
+    static constexpr uint32_t kCount = 1;
+    static bool Prepare(ReplayPrep &prep, VkPipelineExecutableInfoKHR &s) {
+        return prep.Handle(s.pipeline);
+    }
+};
+
+struct CreateInstanceArgs {
+    const VkInstanceCreateInfo*                 pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkInstance*                                 pInstance;
+};
+
+static bool PrepareCreateInstance(ReplayPrep &prep) {
+    CreateInstanceArgs &args = prep.NewArgs<CreateInstanceArgs>();
+    return prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pInstance) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateInstance(PFN_vkVoidFunction proc, void *data) {
+    const CreateInstanceArgs &args = *static_cast<const CreateInstanceArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateInstance>(proc)(args.pCreateInfo, args.pAllocator, args.pInstance);
+}
+
+struct DestroyInstanceArgs {
+    VkInstance                                  instance;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyInstance(ReplayPrep &prep) {
+    DestroyInstanceArgs &args = prep.NewArgs<DestroyInstanceArgs>();
+    return prep.Handle(args.instance) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyInstance(PFN_vkVoidFunction proc, void *data) {
+    const DestroyInstanceArgs &args = *static_cast<const DestroyInstanceArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyInstance>(proc)(args.instance, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct EnumeratePhysicalDevicesArgs {
+    VkInstance                                  instance;
+    uint32_t*                                   pPhysicalDeviceCount;
+    VkPhysicalDevice*                           pPhysicalDevices;
+};
+
+static bool PrepareEnumeratePhysicalDevices(ReplayPrep &prep) {
+    EnumeratePhysicalDevicesArgs &args = prep.NewArgs<EnumeratePhysicalDevicesArgs>();
+    return prep.Handle(args.instance) &&
+           prep.Array(args.pPhysicalDeviceCount) &&
+           prep.NewHandles(args.pPhysicalDevices) &&
+           prep.Result();
+}
+
+static VkResult InvokeEnumeratePhysicalDevices(PFN_vkVoidFunction proc, void *data) {
+    const EnumeratePhysicalDevicesArgs &args = *static_cast<const EnumeratePhysicalDevicesArgs *>(data);
+    return reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(proc)(args.instance, args.pPhysicalDeviceCount, args.pPhysicalDevices);
+}
+
+struct GetPhysicalDeviceFeaturesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkPhysicalDeviceFeatures*                   pFeatures;
+};
+
+static bool PrepareGetPhysicalDeviceFeatures(ReplayPrep &prep) {
+    GetPhysicalDeviceFeaturesArgs &args = prep.NewArgs<GetPhysicalDeviceFeaturesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pFeatures);
+}
+
+static VkResult InvokeGetPhysicalDeviceFeatures(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceFeaturesArgs &args = *static_cast<const GetPhysicalDeviceFeaturesArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures>(proc)(args.physicalDevice, args.pFeatures);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceFormatPropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkFormat                                    format;
+    VkFormatProperties*                         pFormatProperties;
+};
+
+static bool PrepareGetPhysicalDeviceFormatProperties(ReplayPrep &prep) {
+    GetPhysicalDeviceFormatPropertiesArgs &args = prep.NewArgs<GetPhysicalDeviceFormatPropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.format) &&
+           prep.Array(args.pFormatProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceFormatProperties(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceFormatPropertiesArgs &args = *static_cast<const GetPhysicalDeviceFormatPropertiesArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceFormatProperties>(proc)(args.physicalDevice, args.format, args.pFormatProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceImageFormatPropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkFormat                                    format;
+    VkImageType                                 type;
+    VkImageTiling                               tiling;
+    VkImageUsageFlags                           usage;
+    VkImageCreateFlags                          flags;
+    VkImageFormatProperties*                    pImageFormatProperties;
+};
+
+static bool PrepareGetPhysicalDeviceImageFormatProperties(ReplayPrep &prep) {
+    GetPhysicalDeviceImageFormatPropertiesArgs &args = prep.NewArgs<GetPhysicalDeviceImageFormatPropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.format) &&
+           prep.Value(args.type) &&
+           prep.Value(args.tiling) &&
+           prep.Value(args.usage) &&
+           prep.Value(args.flags) &&
+           prep.Array(args.pImageFormatProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceImageFormatProperties(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceImageFormatPropertiesArgs &args = *static_cast<const GetPhysicalDeviceImageFormatPropertiesArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceImageFormatProperties>(proc)(args.physicalDevice, args.format, args.type, args.tiling, args.usage, args.flags, args.pImageFormatProperties);
+}
+
+struct GetPhysicalDevicePropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkPhysicalDeviceProperties*                 pProperties;
+};
+
+static bool PrepareGetPhysicalDeviceProperties(ReplayPrep &prep) {
+    GetPhysicalDevicePropertiesArgs &args = prep.NewArgs<GetPhysicalDevicePropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceProperties(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDevicePropertiesArgs &args = *static_cast<const GetPhysicalDevicePropertiesArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceProperties>(proc)(args.physicalDevice, args.pProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceQueueFamilyPropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t*                                   pQueueFamilyPropertyCount;
+    VkQueueFamilyProperties*                    pQueueFamilyProperties;
+};
+
+static bool PrepareGetPhysicalDeviceQueueFamilyProperties(ReplayPrep &prep) {
+    GetPhysicalDeviceQueueFamilyPropertiesArgs &args = prep.NewArgs<GetPhysicalDeviceQueueFamilyPropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pQueueFamilyPropertyCount) &&
+           prep.Array(args.pQueueFamilyProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceQueueFamilyProperties(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceQueueFamilyPropertiesArgs &args = *static_cast<const GetPhysicalDeviceQueueFamilyPropertiesArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties>(proc)(args.physicalDevice, args.pQueueFamilyPropertyCount, args.pQueueFamilyProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceMemoryPropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkPhysicalDeviceMemoryProperties*           pMemoryProperties;
+};
+
+static bool PrepareGetPhysicalDeviceMemoryProperties(ReplayPrep &prep) {
+    GetPhysicalDeviceMemoryPropertiesArgs &args = prep.NewArgs<GetPhysicalDeviceMemoryPropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pMemoryProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceMemoryProperties(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceMemoryPropertiesArgs &args = *static_cast<const GetPhysicalDeviceMemoryPropertiesArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties>(proc)(args.physicalDevice, args.pMemoryProperties);
+    return VK_SUCCESS;
+}
+
+struct GetInstanceProcAddrArgs {
+    VkInstance                                  instance;
+    const char*                                 pName;
+};
+
+static bool PrepareGetInstanceProcAddr(ReplayPrep &prep) {
+    GetInstanceProcAddrArgs &args = prep.NewArgs<GetInstanceProcAddrArgs>();
+    return prep.Handle(args.instance) &&
+           prep.String(args.pName) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetInstanceProcAddr(PFN_vkVoidFunction proc, void *data) {
+    const GetInstanceProcAddrArgs &args = *static_cast<const GetInstanceProcAddrArgs *>(data);
+    reinterpret_cast<PFN_vkGetInstanceProcAddr>(proc)(args.instance, args.pName);
+    return VK_SUCCESS;
+}
+
+struct GetDeviceProcAddrArgs {
+    VkDevice                                    device;
+    const char*                                 pName;
+};
+
+static bool PrepareGetDeviceProcAddr(ReplayPrep &prep) {
+    GetDeviceProcAddrArgs &args = prep.NewArgs<GetDeviceProcAddrArgs>();
+    return prep.Handle(args.device) &&
+           prep.String(args.pName) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetDeviceProcAddr(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceProcAddrArgs &args = *static_cast<const GetDeviceProcAddrArgs *>(data);
+    reinterpret_cast<PFN_vkGetDeviceProcAddr>(proc)(args.device, args.pName);
+    return VK_SUCCESS;
+}
+
+struct CreateDeviceArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkDeviceCreateInfo*                   pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkDevice*                                   pDevice;
+};
+
+static bool PrepareCreateDevice(ReplayPrep &prep) {
+    CreateDeviceArgs &args = prep.NewArgs<CreateDeviceArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pDevice) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateDevice(PFN_vkVoidFunction proc, void *data) {
+    const CreateDeviceArgs &args = *static_cast<const CreateDeviceArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateDevice>(proc)(args.physicalDevice, args.pCreateInfo, args.pAllocator, args.pDevice);
+}
+
+struct DestroyDeviceArgs {
+    VkDevice                                    device;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyDevice(ReplayPrep &prep) {
+    DestroyDeviceArgs &args = prep.NewArgs<DestroyDeviceArgs>();
+    return prep.Handle(args.device) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyDevice(PFN_vkVoidFunction proc, void *data) {
+    const DestroyDeviceArgs &args = *static_cast<const DestroyDeviceArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyDevice>(proc)(args.device, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct EnumerateInstanceExtensionPropertiesArgs {
+    const char*                                 pLayerName;
+    uint32_t*                                   pPropertyCount;
+    VkExtensionProperties*                      pProperties;
+};
+
+static bool PrepareEnumerateInstanceExtensionProperties(ReplayPrep &prep) {
+    EnumerateInstanceExtensionPropertiesArgs &args = prep.NewArgs<EnumerateInstanceExtensionPropertiesArgs>();
+    return prep.String(args.pLayerName) &&
+           prep.Array(args.pPropertyCount) &&
+           prep.Array(args.pProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeEnumerateInstanceExtensionProperties(PFN_vkVoidFunction proc, void *data) {
+    const EnumerateInstanceExtensionPropertiesArgs &args = *static_cast<const EnumerateInstanceExtensionPropertiesArgs *>(data);
+    return reinterpret_cast<PFN_vkEnumerateInstanceExtensionProperties>(proc)(args.pLayerName, args.pPropertyCount, args.pProperties);
+}
+
+struct EnumerateDeviceExtensionPropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const char*                                 pLayerName;
+    uint32_t*                                   pPropertyCount;
+    VkExtensionProperties*                      pProperties;
+};
+
+static bool PrepareEnumerateDeviceExtensionProperties(ReplayPrep &prep) {
+    EnumerateDeviceExtensionPropertiesArgs &args = prep.NewArgs<EnumerateDeviceExtensionPropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.String(args.pLayerName) &&
+           prep.Array(args.pPropertyCount) &&
+           prep.Array(args.pProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeEnumerateDeviceExtensionProperties(PFN_vkVoidFunction proc, void *data) {
+    const EnumerateDeviceExtensionPropertiesArgs &args = *static_cast<const EnumerateDeviceExtensionPropertiesArgs *>(data);
+    return reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(proc)(args.physicalDevice, args.pLayerName, args.pPropertyCount, args.pProperties);
+}
+
+struct EnumerateInstanceLayerPropertiesArgs {
+    uint32_t*                                   pPropertyCount;
+    VkLayerProperties*                          pProperties;
+};
+
+static bool PrepareEnumerateInstanceLayerProperties(ReplayPrep &prep) {
+    EnumerateInstanceLayerPropertiesArgs &args = prep.NewArgs<EnumerateInstanceLayerPropertiesArgs>();
+    return prep.Array(args.pPropertyCount) &&
+           prep.Array(args.pProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeEnumerateInstanceLayerProperties(PFN_vkVoidFunction proc, void *data) {
+    const EnumerateInstanceLayerPropertiesArgs &args = *static_cast<const EnumerateInstanceLayerPropertiesArgs *>(data);
+    return reinterpret_cast<PFN_vkEnumerateInstanceLayerProperties>(proc)(args.pPropertyCount, args.pProperties);
+}
+
+struct EnumerateDeviceLayerPropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t*                                   pPropertyCount;
+    VkLayerProperties*                          pProperties;
+};
+
+static bool PrepareEnumerateDeviceLayerProperties(ReplayPrep &prep) {
+    EnumerateDeviceLayerPropertiesArgs &args = prep.NewArgs<EnumerateDeviceLayerPropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pPropertyCount) &&
+           prep.Array(args.pProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeEnumerateDeviceLayerProperties(PFN_vkVoidFunction proc, void *data) {
+    const EnumerateDeviceLayerPropertiesArgs &args = *static_cast<const EnumerateDeviceLayerPropertiesArgs *>(data);
+    return reinterpret_cast<PFN_vkEnumerateDeviceLayerProperties>(proc)(args.physicalDevice, args.pPropertyCount, args.pProperties);
+}
+
+struct GetDeviceQueueArgs {
+    VkDevice                                    device;
+    uint32_t                                    queueFamilyIndex;
+    uint32_t                                    queueIndex;
+    VkQueue*                                    pQueue;
+};
+
+static bool PrepareGetDeviceQueue(ReplayPrep &prep) {
+    GetDeviceQueueArgs &args = prep.NewArgs<GetDeviceQueueArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.queueFamilyIndex) &&
+           prep.Value(args.queueIndex) &&
+           prep.NewHandles(args.pQueue);
+}
+
+static VkResult InvokeGetDeviceQueue(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceQueueArgs &args = *static_cast<const GetDeviceQueueArgs *>(data);
+    reinterpret_cast<PFN_vkGetDeviceQueue>(proc)(args.device, args.queueFamilyIndex, args.queueIndex, args.pQueue);
+    return VK_SUCCESS;
+}
+
+struct QueueSubmitArgs {
+    VkQueue                                     queue;
+    uint32_t                                    submitCount;
+    const VkSubmitInfo*                         pSubmits;
+    VkFence                                     fence;
+};
+
+static bool PrepareQueueSubmit(ReplayPrep &prep) {
+    QueueSubmitArgs &args = prep.NewArgs<QueueSubmitArgs>();
+    return prep.Handle(args.queue) &&
+           prep.Value(args.submitCount) &&
+           prep.Array(args.pSubmits) &&
+           prep.Handle(args.fence) &&
+           prep.Result();
+}
+
+static VkResult InvokeQueueSubmit(PFN_vkVoidFunction proc, void *data) {
+    const QueueSubmitArgs &args = *static_cast<const QueueSubmitArgs *>(data);
+    return reinterpret_cast<PFN_vkQueueSubmit>(proc)(args.queue, args.submitCount, args.pSubmits, args.fence);
+}
+
+struct QueueWaitIdleArgs {
+    VkQueue                                     queue;
+};
+
+static bool PrepareQueueWaitIdle(ReplayPrep &prep) {
+    QueueWaitIdleArgs &args = prep.NewArgs<QueueWaitIdleArgs>();
+    return prep.Handle(args.queue) &&
+           prep.Result();
+}
+
+static VkResult InvokeQueueWaitIdle(PFN_vkVoidFunction proc, void *data) {
+    const QueueWaitIdleArgs &args = *static_cast<const QueueWaitIdleArgs *>(data);
+    return reinterpret_cast<PFN_vkQueueWaitIdle>(proc)(args.queue);
+}
+
+struct DeviceWaitIdleArgs {
+    VkDevice                                    device;
+};
+
+static bool PrepareDeviceWaitIdle(ReplayPrep &prep) {
+    DeviceWaitIdleArgs &args = prep.NewArgs<DeviceWaitIdleArgs>();
+    return prep.Handle(args.device) &&
+           prep.Result();
+}
+
+static VkResult InvokeDeviceWaitIdle(PFN_vkVoidFunction proc, void *data) {
+    const DeviceWaitIdleArgs &args = *static_cast<const DeviceWaitIdleArgs *>(data);
+    return reinterpret_cast<PFN_vkDeviceWaitIdle>(proc)(args.device);
+}
+
+struct AllocateMemoryArgs {
+    VkDevice                                    device;
+    const VkMemoryAllocateInfo*                 pAllocateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkDeviceMemory*                             pMemory;
+};
+
+static bool PrepareAllocateMemory(ReplayPrep &prep) {
+    AllocateMemoryArgs &args = prep.NewArgs<AllocateMemoryArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pAllocateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pMemory) &&
+           prep.Result();
+}
+
+static VkResult InvokeAllocateMemory(PFN_vkVoidFunction proc, void *data) {
+    const AllocateMemoryArgs &args = *static_cast<const AllocateMemoryArgs *>(data);
+    return reinterpret_cast<PFN_vkAllocateMemory>(proc)(args.device, args.pAllocateInfo, args.pAllocator, args.pMemory);
+}
+
+struct FreeMemoryArgs {
+    VkDevice                                    device;
+    VkDeviceMemory                              memory;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareFreeMemory(ReplayPrep &prep) {
+    FreeMemoryArgs &args = prep.NewArgs<FreeMemoryArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.memory) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeFreeMemory(PFN_vkVoidFunction proc, void *data) {
+    const FreeMemoryArgs &args = *static_cast<const FreeMemoryArgs *>(data);
+    reinterpret_cast<PFN_vkFreeMemory>(proc)(args.device, args.memory, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct MapMemoryArgs {
+    VkDevice                                    device;
+    VkDeviceMemory                              memory;
+    VkDeviceSize                                offset;
+    VkDeviceSize                                size;
+    VkMemoryMapFlags                            flags;
+    void**                                      ppData;
+};
+
+static bool PrepareMapMemory(ReplayPrep &prep) {
+    MapMemoryArgs &args = prep.NewArgs<MapMemoryArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.memory) &&
+           prep.Value(args.offset) &&
+           prep.Value(args.size) &&
+           prep.Value(args.flags) &&
+           prep.Scratch(args.ppData) &&
+           prep.Result();
+}
+
+static VkResult InvokeMapMemory(PFN_vkVoidFunction proc, void *data) {
+    const MapMemoryArgs &args = *static_cast<const MapMemoryArgs *>(data);
+    return reinterpret_cast<PFN_vkMapMemory>(proc)(args.device, args.memory, args.offset, args.size, args.flags, args.ppData);
+}
+
+struct UnmapMemoryArgs {
+    VkDevice                                    device;
+    VkDeviceMemory                              memory;
+};
+
+static bool PrepareUnmapMemory(ReplayPrep &prep) {
+    UnmapMemoryArgs &args = prep.NewArgs<UnmapMemoryArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.memory);
+}
+
+static VkResult InvokeUnmapMemory(PFN_vkVoidFunction proc, void *data) {
+    const UnmapMemoryArgs &args = *static_cast<const UnmapMemoryArgs *>(data);
+    reinterpret_cast<PFN_vkUnmapMemory>(proc)(args.device, args.memory);
+    return VK_SUCCESS;
+}
+
+struct FlushMappedMemoryRangesArgs {
+    VkDevice                                    device;
+    uint32_t                                    memoryRangeCount;
+    const VkMappedMemoryRange*                  pMemoryRanges;
+};
+
+static bool PrepareFlushMappedMemoryRanges(ReplayPrep &prep) {
+    FlushMappedMemoryRangesArgs &args = prep.NewArgs<FlushMappedMemoryRangesArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.memoryRangeCount) &&
+           prep.Array(args.pMemoryRanges) &&
+           prep.Result();
+}
+
+static VkResult InvokeFlushMappedMemoryRanges(PFN_vkVoidFunction proc, void *data) {
+    const FlushMappedMemoryRangesArgs &args = *static_cast<const FlushMappedMemoryRangesArgs *>(data);
+    return reinterpret_cast<PFN_vkFlushMappedMemoryRanges>(proc)(args.device, args.memoryRangeCount, args.pMemoryRanges);
+}
+
+struct InvalidateMappedMemoryRangesArgs {
+    VkDevice                                    device;
+    uint32_t                                    memoryRangeCount;
+    const VkMappedMemoryRange*                  pMemoryRanges;
+};
+
+static bool PrepareInvalidateMappedMemoryRanges(ReplayPrep &prep) {
+    InvalidateMappedMemoryRangesArgs &args = prep.NewArgs<InvalidateMappedMemoryRangesArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.memoryRangeCount) &&
+           prep.Array(args.pMemoryRanges) &&
+           prep.Result();
+}
+
+static VkResult InvokeInvalidateMappedMemoryRanges(PFN_vkVoidFunction proc, void *data) {
+    const InvalidateMappedMemoryRangesArgs &args = *static_cast<const InvalidateMappedMemoryRangesArgs *>(data);
+    return reinterpret_cast<PFN_vkInvalidateMappedMemoryRanges>(proc)(args.device, args.memoryRangeCount, args.pMemoryRanges);
+}
+
+struct GetDeviceMemoryCommitmentArgs {
+    VkDevice                                    device;
+    VkDeviceMemory                              memory;
+    VkDeviceSize*                               pCommittedMemoryInBytes;
+};
+
+static bool PrepareGetDeviceMemoryCommitment(ReplayPrep &prep) {
+    GetDeviceMemoryCommitmentArgs &args = prep.NewArgs<GetDeviceMemoryCommitmentArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.memory) &&
+           prep.Array(args.pCommittedMemoryInBytes);
+}
+
+static VkResult InvokeGetDeviceMemoryCommitment(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceMemoryCommitmentArgs &args = *static_cast<const GetDeviceMemoryCommitmentArgs *>(data);
+    reinterpret_cast<PFN_vkGetDeviceMemoryCommitment>(proc)(args.device, args.memory, args.pCommittedMemoryInBytes);
+    return VK_SUCCESS;
+}
+
+struct BindBufferMemoryArgs {
+    VkDevice                                    device;
+    VkBuffer                                    buffer;
+    VkDeviceMemory                              memory;
+    VkDeviceSize                                memoryOffset;
+};
+
+static bool PrepareBindBufferMemory(ReplayPrep &prep) {
+    BindBufferMemoryArgs &args = prep.NewArgs<BindBufferMemoryArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.buffer) &&
+           prep.Handle(args.memory) &&
+           prep.Value(args.memoryOffset) &&
+           prep.Result();
+}
+
+static VkResult InvokeBindBufferMemory(PFN_vkVoidFunction proc, void *data) {
+    const BindBufferMemoryArgs &args = *static_cast<const BindBufferMemoryArgs *>(data);
+    return reinterpret_cast<PFN_vkBindBufferMemory>(proc)(args.device, args.buffer, args.memory, args.memoryOffset);
+}
+
+struct BindImageMemoryArgs {
+    VkDevice                                    device;
+    VkImage                                     image;
+    VkDeviceMemory                              memory;
+    VkDeviceSize                                memoryOffset;
+};
+
+static bool PrepareBindImageMemory(ReplayPrep &prep) {
+    BindImageMemoryArgs &args = prep.NewArgs<BindImageMemoryArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.image) &&
+           prep.Handle(args.memory) &&
+           prep.Value(args.memoryOffset) &&
+           prep.Result();
+}
+
+static VkResult InvokeBindImageMemory(PFN_vkVoidFunction proc, void *data) {
+    const BindImageMemoryArgs &args = *static_cast<const BindImageMemoryArgs *>(data);
+    return reinterpret_cast<PFN_vkBindImageMemory>(proc)(args.device, args.image, args.memory, args.memoryOffset);
+}
+
+struct GetBufferMemoryRequirementsArgs {
+    VkDevice                                    device;
+    VkBuffer                                    buffer;
+    VkMemoryRequirements*                       pMemoryRequirements;
+};
+
+static bool PrepareGetBufferMemoryRequirements(ReplayPrep &prep) {
+    GetBufferMemoryRequirementsArgs &args = prep.NewArgs<GetBufferMemoryRequirementsArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.buffer) &&
+           prep.Array(args.pMemoryRequirements);
+}
+
+static VkResult InvokeGetBufferMemoryRequirements(PFN_vkVoidFunction proc, void *data) {
+    const GetBufferMemoryRequirementsArgs &args = *static_cast<const GetBufferMemoryRequirementsArgs *>(data);
+    reinterpret_cast<PFN_vkGetBufferMemoryRequirements>(proc)(args.device, args.buffer, args.pMemoryRequirements);
+    return VK_SUCCESS;
+}
+
+struct GetImageMemoryRequirementsArgs {
+    VkDevice                                    device;
+    VkImage                                     image;
+    VkMemoryRequirements*                       pMemoryRequirements;
+};
+
+static bool PrepareGetImageMemoryRequirements(ReplayPrep &prep) {
+    GetImageMemoryRequirementsArgs &args = prep.NewArgs<GetImageMemoryRequirementsArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.image) &&
+           prep.Array(args.pMemoryRequirements);
+}
+
+static VkResult InvokeGetImageMemoryRequirements(PFN_vkVoidFunction proc, void *data) {
+    const GetImageMemoryRequirementsArgs &args = *static_cast<const GetImageMemoryRequirementsArgs *>(data);
+    reinterpret_cast<PFN_vkGetImageMemoryRequirements>(proc)(args.device, args.image, args.pMemoryRequirements);
+    return VK_SUCCESS;
+}
+
+struct GetImageSparseMemoryRequirementsArgs {
+    VkDevice                                    device;
+    VkImage                                     image;
+    uint32_t*                                   pSparseMemoryRequirementCount;
+    VkSparseImageMemoryRequirements*            pSparseMemoryRequirements;
+};
+
+static bool PrepareGetImageSparseMemoryRequirements(ReplayPrep &prep) {
+    GetImageSparseMemoryRequirementsArgs &args = prep.NewArgs<GetImageSparseMemoryRequirementsArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.image) &&
+           prep.Array(args.pSparseMemoryRequirementCount) &&
+           prep.Array(args.pSparseMemoryRequirements);
+}
+
+static VkResult InvokeGetImageSparseMemoryRequirements(PFN_vkVoidFunction proc, void *data) {
+    const GetImageSparseMemoryRequirementsArgs &args = *static_cast<const GetImageSparseMemoryRequirementsArgs *>(data);
+    reinterpret_cast<PFN_vkGetImageSparseMemoryRequirements>(proc)(args.device, args.image, args.pSparseMemoryRequirementCount, args.pSparseMemoryRequirements);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceSparseImageFormatPropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkFormat                                    format;
+    VkImageType                                 type;
+    VkSampleCountFlagBits                       samples;
+    VkImageUsageFlags                           usage;
+    VkImageTiling                               tiling;
+    uint32_t*                                   pPropertyCount;
+    VkSparseImageFormatProperties*              pProperties;
+};
+
+static bool PrepareGetPhysicalDeviceSparseImageFormatProperties(ReplayPrep &prep) {
+    GetPhysicalDeviceSparseImageFormatPropertiesArgs &args = prep.NewArgs<GetPhysicalDeviceSparseImageFormatPropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.format) &&
+           prep.Value(args.type) &&
+           prep.Value(args.samples) &&
+           prep.Value(args.usage) &&
+           prep.Value(args.tiling) &&
+           prep.Array(args.pPropertyCount) &&
+           prep.Array(args.pProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceSparseImageFormatProperties(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSparseImageFormatPropertiesArgs &args = *static_cast<const GetPhysicalDeviceSparseImageFormatPropertiesArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceSparseImageFormatProperties>(proc)(args.physicalDevice, args.format, args.type, args.samples, args.usage, args.tiling, args.pPropertyCount, args.pProperties);
+    return VK_SUCCESS;
+}
+
+struct CreateFenceArgs {
+    VkDevice                                    device;
+    const VkFenceCreateInfo*                    pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkFence*                                    pFence;
+};
+
+static bool PrepareCreateFence(ReplayPrep &prep) {
+    CreateFenceArgs &args = prep.NewArgs<CreateFenceArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pFence) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateFence(PFN_vkVoidFunction proc, void *data) {
+    const CreateFenceArgs &args = *static_cast<const CreateFenceArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateFence>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pFence);
+}
+
+struct DestroyFenceArgs {
+    VkDevice                                    device;
+    VkFence                                     fence;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyFence(ReplayPrep &prep) {
+    DestroyFenceArgs &args = prep.NewArgs<DestroyFenceArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.fence) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyFence(PFN_vkVoidFunction proc, void *data) {
+    const DestroyFenceArgs &args = *static_cast<const DestroyFenceArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyFence>(proc)(args.device, args.fence, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct ResetFencesArgs {
+    VkDevice                                    device;
+    uint32_t                                    fenceCount;
+    const VkFence*                              pFences;
+};
+
+static bool PrepareResetFences(ReplayPrep &prep) {
+    ResetFencesArgs &args = prep.NewArgs<ResetFencesArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.fenceCount) &&
+           prep.Handles(args.pFences) &&
+           prep.Result();
+}
+
+static VkResult InvokeResetFences(PFN_vkVoidFunction proc, void *data) {
+    const ResetFencesArgs &args = *static_cast<const ResetFencesArgs *>(data);
+    return reinterpret_cast<PFN_vkResetFences>(proc)(args.device, args.fenceCount, args.pFences);
+}
+
+struct GetFenceStatusArgs {
+    VkDevice                                    device;
+    VkFence                                     fence;
+};
+
+static bool PrepareGetFenceStatus(ReplayPrep &prep) {
+    GetFenceStatusArgs &args = prep.NewArgs<GetFenceStatusArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.fence) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetFenceStatus(PFN_vkVoidFunction proc, void *data) {
+    const GetFenceStatusArgs &args = *static_cast<const GetFenceStatusArgs *>(data);
+    return reinterpret_cast<PFN_vkGetFenceStatus>(proc)(args.device, args.fence);
+}
+
+struct WaitForFencesArgs {
+    VkDevice                                    device;
+    uint32_t                                    fenceCount;
+    const VkFence*                              pFences;
+    VkBool32                                    waitAll;
+    uint64_t                                    timeout;
+};
+
+static bool PrepareWaitForFences(ReplayPrep &prep) {
+    WaitForFencesArgs &args = prep.NewArgs<WaitForFencesArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.fenceCount) &&
+           prep.Handles(args.pFences) &&
+           prep.Value(args.waitAll) &&
+           prep.Value(args.timeout) &&
+           prep.Result();
+}
+
+static VkResult InvokeWaitForFences(PFN_vkVoidFunction proc, void *data) {
+    const WaitForFencesArgs &args = *static_cast<const WaitForFencesArgs *>(data);
+    return reinterpret_cast<PFN_vkWaitForFences>(proc)(args.device, args.fenceCount, args.pFences, args.waitAll, args.timeout);
+}
+
+struct CreateSemaphoreArgs {
+    VkDevice                                    device;
+    const VkSemaphoreCreateInfo*                pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkSemaphore*                                pSemaphore;
+};
+
+static bool PrepareCreateSemaphore(ReplayPrep &prep) {
+    CreateSemaphoreArgs &args = prep.NewArgs<CreateSemaphoreArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pSemaphore) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateSemaphore(PFN_vkVoidFunction proc, void *data) {
+    const CreateSemaphoreArgs &args = *static_cast<const CreateSemaphoreArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateSemaphore>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pSemaphore);
+}
+
+struct DestroySemaphoreArgs {
+    VkDevice                                    device;
+    VkSemaphore                                 semaphore;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroySemaphore(ReplayPrep &prep) {
+    DestroySemaphoreArgs &args = prep.NewArgs<DestroySemaphoreArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.semaphore) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroySemaphore(PFN_vkVoidFunction proc, void *data) {
+    const DestroySemaphoreArgs &args = *static_cast<const DestroySemaphoreArgs *>(data);
+    reinterpret_cast<PFN_vkDestroySemaphore>(proc)(args.device, args.semaphore, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreateEventArgs {
+    VkDevice                                    device;
+    const VkEventCreateInfo*                    pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkEvent*                                    pEvent;
+};
+
+static bool PrepareCreateEvent(ReplayPrep &prep) {
+    CreateEventArgs &args = prep.NewArgs<CreateEventArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pEvent) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateEvent(PFN_vkVoidFunction proc, void *data) {
+    const CreateEventArgs &args = *static_cast<const CreateEventArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateEvent>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pEvent);
+}
+
+struct DestroyEventArgs {
+    VkDevice                                    device;
+    VkEvent                                     event;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyEvent(ReplayPrep &prep) {
+    DestroyEventArgs &args = prep.NewArgs<DestroyEventArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.event) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyEvent(PFN_vkVoidFunction proc, void *data) {
+    const DestroyEventArgs &args = *static_cast<const DestroyEventArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyEvent>(proc)(args.device, args.event, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct GetEventStatusArgs {
+    VkDevice                                    device;
+    VkEvent                                     event;
+};
+
+static bool PrepareGetEventStatus(ReplayPrep &prep) {
+    GetEventStatusArgs &args = prep.NewArgs<GetEventStatusArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.event) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetEventStatus(PFN_vkVoidFunction proc, void *data) {
+    const GetEventStatusArgs &args = *static_cast<const GetEventStatusArgs *>(data);
+    return reinterpret_cast<PFN_vkGetEventStatus>(proc)(args.device, args.event);
+}
+
+struct SetEventArgs {
+    VkDevice                                    device;
+    VkEvent                                     event;
+};
+
+static bool PrepareSetEvent(ReplayPrep &prep) {
+    SetEventArgs &args = prep.NewArgs<SetEventArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.event) &&
+           prep.Result();
+}
+
+static VkResult InvokeSetEvent(PFN_vkVoidFunction proc, void *data) {
+    const SetEventArgs &args = *static_cast<const SetEventArgs *>(data);
+    return reinterpret_cast<PFN_vkSetEvent>(proc)(args.device, args.event);
+}
+
+struct ResetEventArgs {
+    VkDevice                                    device;
+    VkEvent                                     event;
+};
+
+static bool PrepareResetEvent(ReplayPrep &prep) {
+    ResetEventArgs &args = prep.NewArgs<ResetEventArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.event) &&
+           prep.Result();
+}
+
+static VkResult InvokeResetEvent(PFN_vkVoidFunction proc, void *data) {
+    const ResetEventArgs &args = *static_cast<const ResetEventArgs *>(data);
+    return reinterpret_cast<PFN_vkResetEvent>(proc)(args.device, args.event);
+}
+
+struct CreateQueryPoolArgs {
+    VkDevice                                    device;
+    const VkQueryPoolCreateInfo*                pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkQueryPool*                                pQueryPool;
+};
+
+static bool PrepareCreateQueryPool(ReplayPrep &prep) {
+    CreateQueryPoolArgs &args = prep.NewArgs<CreateQueryPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pQueryPool) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateQueryPool(PFN_vkVoidFunction proc, void *data) {
+    const CreateQueryPoolArgs &args = *static_cast<const CreateQueryPoolArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateQueryPool>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pQueryPool);
+}
+
+struct DestroyQueryPoolArgs {
+    VkDevice                                    device;
+    VkQueryPool                                 queryPool;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyQueryPool(ReplayPrep &prep) {
+    DestroyQueryPoolArgs &args = prep.NewArgs<DestroyQueryPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.queryPool) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyQueryPool(PFN_vkVoidFunction proc, void *data) {
+    const DestroyQueryPoolArgs &args = *static_cast<const DestroyQueryPoolArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyQueryPool>(proc)(args.device, args.queryPool, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct GetQueryPoolResultsArgs {
+    VkDevice                                    device;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+    uint32_t                                    queryCount;
+    size_t                                      dataSize;
+    void*                                       pData;
+    VkDeviceSize                                stride;
+    VkQueryResultFlags                          flags;
+};
+
+static bool PrepareGetQueryPoolResults(ReplayPrep &prep) {
+    GetQueryPoolResultsArgs &args = prep.NewArgs<GetQueryPoolResultsArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.firstQuery) &&
+           prep.Value(args.queryCount) &&
+           prep.Value(args.dataSize) &&
+           prep.Bytes(args.pData) &&
+           prep.Value(args.stride) &&
+           prep.Value(args.flags) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetQueryPoolResults(PFN_vkVoidFunction proc, void *data) {
+    const GetQueryPoolResultsArgs &args = *static_cast<const GetQueryPoolResultsArgs *>(data);
+    return reinterpret_cast<PFN_vkGetQueryPoolResults>(proc)(args.device, args.queryPool, args.firstQuery, args.queryCount, args.dataSize, args.pData, args.stride, args.flags);
+}
+
+struct CreateBufferArgs {
+    VkDevice                                    device;
+    const VkBufferCreateInfo*                   pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkBuffer*                                   pBuffer;
+};
+
+static bool PrepareCreateBuffer(ReplayPrep &prep) {
+    CreateBufferArgs &args = prep.NewArgs<CreateBufferArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pBuffer) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateBuffer(PFN_vkVoidFunction proc, void *data) {
+    const CreateBufferArgs &args = *static_cast<const CreateBufferArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateBuffer>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pBuffer);
+}
+
+struct DestroyBufferArgs {
+    VkDevice                                    device;
+    VkBuffer                                    buffer;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyBuffer(ReplayPrep &prep) {
+    DestroyBufferArgs &args = prep.NewArgs<DestroyBufferArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.buffer) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyBuffer(PFN_vkVoidFunction proc, void *data) {
+    const DestroyBufferArgs &args = *static_cast<const DestroyBufferArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyBuffer>(proc)(args.device, args.buffer, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreateBufferViewArgs {
+    VkDevice                                    device;
+    const VkBufferViewCreateInfo*               pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkBufferView*                               pView;
+};
+
+static bool PrepareCreateBufferView(ReplayPrep &prep) {
+    CreateBufferViewArgs &args = prep.NewArgs<CreateBufferViewArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pView) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateBufferView(PFN_vkVoidFunction proc, void *data) {
+    const CreateBufferViewArgs &args = *static_cast<const CreateBufferViewArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateBufferView>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pView);
+}
+
+struct DestroyBufferViewArgs {
+    VkDevice                                    device;
+    VkBufferView                                bufferView;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyBufferView(ReplayPrep &prep) {
+    DestroyBufferViewArgs &args = prep.NewArgs<DestroyBufferViewArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.bufferView) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyBufferView(PFN_vkVoidFunction proc, void *data) {
+    const DestroyBufferViewArgs &args = *static_cast<const DestroyBufferViewArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyBufferView>(proc)(args.device, args.bufferView, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreateImageArgs {
+    VkDevice                                    device;
+    const VkImageCreateInfo*                    pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkImage*                                    pImage;
+};
+
+static bool PrepareCreateImage(ReplayPrep &prep) {
+    CreateImageArgs &args = prep.NewArgs<CreateImageArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pImage) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateImage(PFN_vkVoidFunction proc, void *data) {
+    const CreateImageArgs &args = *static_cast<const CreateImageArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateImage>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pImage);
+}
+
+struct DestroyImageArgs {
+    VkDevice                                    device;
+    VkImage                                     image;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyImage(ReplayPrep &prep) {
+    DestroyImageArgs &args = prep.NewArgs<DestroyImageArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.image) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyImage(PFN_vkVoidFunction proc, void *data) {
+    const DestroyImageArgs &args = *static_cast<const DestroyImageArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyImage>(proc)(args.device, args.image, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct GetImageSubresourceLayoutArgs {
+    VkDevice                                    device;
+    VkImage                                     image;
+    const VkImageSubresource*                   pSubresource;
+    VkSubresourceLayout*                        pLayout;
+};
+
+static bool PrepareGetImageSubresourceLayout(ReplayPrep &prep) {
+    GetImageSubresourceLayoutArgs &args = prep.NewArgs<GetImageSubresourceLayoutArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.image) &&
+           prep.Array(args.pSubresource) &&
+           prep.Array(args.pLayout);
+}
+
+static VkResult InvokeGetImageSubresourceLayout(PFN_vkVoidFunction proc, void *data) {
+    const GetImageSubresourceLayoutArgs &args = *static_cast<const GetImageSubresourceLayoutArgs *>(data);
+    reinterpret_cast<PFN_vkGetImageSubresourceLayout>(proc)(args.device, args.image, args.pSubresource, args.pLayout);
+    return VK_SUCCESS;
+}
+
+struct CreateImageViewArgs {
+    VkDevice                                    device;
+    const VkImageViewCreateInfo*                pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkImageView*                                pView;
+};
+
+static bool PrepareCreateImageView(ReplayPrep &prep) {
+    CreateImageViewArgs &args = prep.NewArgs<CreateImageViewArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pView) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateImageView(PFN_vkVoidFunction proc, void *data) {
+    const CreateImageViewArgs &args = *static_cast<const CreateImageViewArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateImageView>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pView);
+}
+
+struct DestroyImageViewArgs {
+    VkDevice                                    device;
+    VkImageView                                 imageView;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyImageView(ReplayPrep &prep) {
+    DestroyImageViewArgs &args = prep.NewArgs<DestroyImageViewArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.imageView) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyImageView(PFN_vkVoidFunction proc, void *data) {
+    const DestroyImageViewArgs &args = *static_cast<const DestroyImageViewArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyImageView>(proc)(args.device, args.imageView, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreateShaderModuleArgs {
+    VkDevice                                    device;
+    const VkShaderModuleCreateInfo*             pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkShaderModule*                             pShaderModule;
+};
+
+static bool PrepareCreateShaderModule(ReplayPrep &prep) {
+    CreateShaderModuleArgs &args = prep.NewArgs<CreateShaderModuleArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pShaderModule) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateShaderModule(PFN_vkVoidFunction proc, void *data) {
+    const CreateShaderModuleArgs &args = *static_cast<const CreateShaderModuleArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateShaderModule>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pShaderModule);
+}
+
+struct DestroyShaderModuleArgs {
+    VkDevice                                    device;
+    VkShaderModule                              shaderModule;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyShaderModule(ReplayPrep &prep) {
+    DestroyShaderModuleArgs &args = prep.NewArgs<DestroyShaderModuleArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.shaderModule) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyShaderModule(PFN_vkVoidFunction proc, void *data) {
+    const DestroyShaderModuleArgs &args = *static_cast<const DestroyShaderModuleArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyShaderModule>(proc)(args.device, args.shaderModule, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreatePipelineCacheArgs {
+    VkDevice                                    device;
+    const VkPipelineCacheCreateInfo*            pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkPipelineCache*                            pPipelineCache;
+};
+
+static bool PrepareCreatePipelineCache(ReplayPrep &prep) {
+    CreatePipelineCacheArgs &args = prep.NewArgs<CreatePipelineCacheArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pPipelineCache) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreatePipelineCache(PFN_vkVoidFunction proc, void *data) {
+    const CreatePipelineCacheArgs &args = *static_cast<const CreatePipelineCacheArgs *>(data);
+    return reinterpret_cast<PFN_vkCreatePipelineCache>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pPipelineCache);
+}
+
+struct DestroyPipelineCacheArgs {
+    VkDevice                                    device;
+    VkPipelineCache                             pipelineCache;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyPipelineCache(ReplayPrep &prep) {
+    DestroyPipelineCacheArgs &args = prep.NewArgs<DestroyPipelineCacheArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipelineCache) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyPipelineCache(PFN_vkVoidFunction proc, void *data) {
+    const DestroyPipelineCacheArgs &args = *static_cast<const DestroyPipelineCacheArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyPipelineCache>(proc)(args.device, args.pipelineCache, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct GetPipelineCacheDataArgs {
+    VkDevice                                    device;
+    VkPipelineCache                             pipelineCache;
+    size_t*                                     pDataSize;
+    void*                                       pData;
+};
+
+static bool PrepareGetPipelineCacheData(ReplayPrep &prep) {
+    GetPipelineCacheDataArgs &args = prep.NewArgs<GetPipelineCacheDataArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipelineCache) &&
+           prep.Array(args.pDataSize) &&
+           prep.Bytes(args.pData) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPipelineCacheData(PFN_vkVoidFunction proc, void *data) {
+    const GetPipelineCacheDataArgs &args = *static_cast<const GetPipelineCacheDataArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPipelineCacheData>(proc)(args.device, args.pipelineCache, args.pDataSize, args.pData);
+}
+
+struct MergePipelineCachesArgs {
+    VkDevice                                    device;
+    VkPipelineCache                             dstCache;
+    uint32_t                                    srcCacheCount;
+    const VkPipelineCache*                      pSrcCaches;
+};
+
+static bool PrepareMergePipelineCaches(ReplayPrep &prep) {
+    MergePipelineCachesArgs &args = prep.NewArgs<MergePipelineCachesArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.dstCache) &&
+           prep.Value(args.srcCacheCount) &&
+           prep.Handles(args.pSrcCaches) &&
+           prep.Result();
+}
+
+static VkResult InvokeMergePipelineCaches(PFN_vkVoidFunction proc, void *data) {
+    const MergePipelineCachesArgs &args = *static_cast<const MergePipelineCachesArgs *>(data);
+    return reinterpret_cast<PFN_vkMergePipelineCaches>(proc)(args.device, args.dstCache, args.srcCacheCount, args.pSrcCaches);
+}
+
+struct CreateGraphicsPipelinesArgs {
+    VkDevice                                    device;
+    VkPipelineCache                             pipelineCache;
+    uint32_t                                    createInfoCount;
+    const VkGraphicsPipelineCreateInfo*         pCreateInfos;
+    const VkAllocationCallbacks*                pAllocator;
+    VkPipeline*                                 pPipelines;
+};
+
+static bool PrepareCreateGraphicsPipelines(ReplayPrep &prep) {
+    CreateGraphicsPipelinesArgs &args = prep.NewArgs<CreateGraphicsPipelinesArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipelineCache) &&
+           prep.Value(args.createInfoCount) &&
+           prep.Array(args.pCreateInfos) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pPipelines) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateGraphicsPipelines(PFN_vkVoidFunction proc, void *data) {
+    const CreateGraphicsPipelinesArgs &args = *static_cast<const CreateGraphicsPipelinesArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateGraphicsPipelines>(proc)(args.device, args.pipelineCache, args.createInfoCount, args.pCreateInfos, args.pAllocator, args.pPipelines);
+}
+
+struct CreateComputePipelinesArgs {
+    VkDevice                                    device;
+    VkPipelineCache                             pipelineCache;
+    uint32_t                                    createInfoCount;
+    const VkComputePipelineCreateInfo*          pCreateInfos;
+    const VkAllocationCallbacks*                pAllocator;
+    VkPipeline*                                 pPipelines;
+};
+
+static bool PrepareCreateComputePipelines(ReplayPrep &prep) {
+    CreateComputePipelinesArgs &args = prep.NewArgs<CreateComputePipelinesArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipelineCache) &&
+           prep.Value(args.createInfoCount) &&
+           prep.Array(args.pCreateInfos) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pPipelines) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateComputePipelines(PFN_vkVoidFunction proc, void *data) {
+    const CreateComputePipelinesArgs &args = *static_cast<const CreateComputePipelinesArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateComputePipelines>(proc)(args.device, args.pipelineCache, args.createInfoCount, args.pCreateInfos, args.pAllocator, args.pPipelines);
+}
+
+struct DestroyPipelineArgs {
+    VkDevice                                    device;
+    VkPipeline                                  pipeline;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyPipeline(ReplayPrep &prep) {
+    DestroyPipelineArgs &args = prep.NewArgs<DestroyPipelineArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipeline) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyPipeline(PFN_vkVoidFunction proc, void *data) {
+    const DestroyPipelineArgs &args = *static_cast<const DestroyPipelineArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyPipeline>(proc)(args.device, args.pipeline, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreatePipelineLayoutArgs {
+    VkDevice                                    device;
+    const VkPipelineLayoutCreateInfo*           pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkPipelineLayout*                           pPipelineLayout;
+};
+
+static bool PrepareCreatePipelineLayout(ReplayPrep &prep) {
+    CreatePipelineLayoutArgs &args = prep.NewArgs<CreatePipelineLayoutArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pPipelineLayout) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreatePipelineLayout(PFN_vkVoidFunction proc, void *data) {
+    const CreatePipelineLayoutArgs &args = *static_cast<const CreatePipelineLayoutArgs *>(data);
+    return reinterpret_cast<PFN_vkCreatePipelineLayout>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pPipelineLayout);
+}
+
+struct DestroyPipelineLayoutArgs {
+    VkDevice                                    device;
+    VkPipelineLayout                            pipelineLayout;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyPipelineLayout(ReplayPrep &prep) {
+    DestroyPipelineLayoutArgs &args = prep.NewArgs<DestroyPipelineLayoutArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipelineLayout) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyPipelineLayout(PFN_vkVoidFunction proc, void *data) {
+    const DestroyPipelineLayoutArgs &args = *static_cast<const DestroyPipelineLayoutArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyPipelineLayout>(proc)(args.device, args.pipelineLayout, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreateSamplerArgs {
+    VkDevice                                    device;
+    const VkSamplerCreateInfo*                  pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkSampler*                                  pSampler;
+};
+
+static bool PrepareCreateSampler(ReplayPrep &prep) {
+    CreateSamplerArgs &args = prep.NewArgs<CreateSamplerArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pSampler) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateSampler(PFN_vkVoidFunction proc, void *data) {
+    const CreateSamplerArgs &args = *static_cast<const CreateSamplerArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateSampler>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pSampler);
+}
+
+struct DestroySamplerArgs {
+    VkDevice                                    device;
+    VkSampler                                   sampler;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroySampler(ReplayPrep &prep) {
+    DestroySamplerArgs &args = prep.NewArgs<DestroySamplerArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.sampler) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroySampler(PFN_vkVoidFunction proc, void *data) {
+    const DestroySamplerArgs &args = *static_cast<const DestroySamplerArgs *>(data);
+    reinterpret_cast<PFN_vkDestroySampler>(proc)(args.device, args.sampler, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreateDescriptorSetLayoutArgs {
+    VkDevice                                    device;
+    const VkDescriptorSetLayoutCreateInfo*      pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkDescriptorSetLayout*                      pSetLayout;
+};
+
+static bool PrepareCreateDescriptorSetLayout(ReplayPrep &prep) {
+    CreateDescriptorSetLayoutArgs &args = prep.NewArgs<CreateDescriptorSetLayoutArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pSetLayout) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateDescriptorSetLayout(PFN_vkVoidFunction proc, void *data) {
+    const CreateDescriptorSetLayoutArgs &args = *static_cast<const CreateDescriptorSetLayoutArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateDescriptorSetLayout>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pSetLayout);
+}
+
+struct DestroyDescriptorSetLayoutArgs {
+    VkDevice                                    device;
+    VkDescriptorSetLayout                       descriptorSetLayout;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyDescriptorSetLayout(ReplayPrep &prep) {
+    DestroyDescriptorSetLayoutArgs &args = prep.NewArgs<DestroyDescriptorSetLayoutArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.descriptorSetLayout) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyDescriptorSetLayout(PFN_vkVoidFunction proc, void *data) {
+    const DestroyDescriptorSetLayoutArgs &args = *static_cast<const DestroyDescriptorSetLayoutArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyDescriptorSetLayout>(proc)(args.device, args.descriptorSetLayout, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreateDescriptorPoolArgs {
+    VkDevice                                    device;
+    const VkDescriptorPoolCreateInfo*           pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkDescriptorPool*                           pDescriptorPool;
+};
+
+static bool PrepareCreateDescriptorPool(ReplayPrep &prep) {
+    CreateDescriptorPoolArgs &args = prep.NewArgs<CreateDescriptorPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pDescriptorPool) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateDescriptorPool(PFN_vkVoidFunction proc, void *data) {
+    const CreateDescriptorPoolArgs &args = *static_cast<const CreateDescriptorPoolArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateDescriptorPool>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pDescriptorPool);
+}
+
+struct DestroyDescriptorPoolArgs {
+    VkDevice                                    device;
+    VkDescriptorPool                            descriptorPool;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyDescriptorPool(ReplayPrep &prep) {
+    DestroyDescriptorPoolArgs &args = prep.NewArgs<DestroyDescriptorPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.descriptorPool) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyDescriptorPool(PFN_vkVoidFunction proc, void *data) {
+    const DestroyDescriptorPoolArgs &args = *static_cast<const DestroyDescriptorPoolArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyDescriptorPool>(proc)(args.device, args.descriptorPool, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct ResetDescriptorPoolArgs {
+    VkDevice                                    device;
+    VkDescriptorPool                            descriptorPool;
+    VkDescriptorPoolResetFlags                  flags;
+};
+
+static bool PrepareResetDescriptorPool(ReplayPrep &prep) {
+    ResetDescriptorPoolArgs &args = prep.NewArgs<ResetDescriptorPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.descriptorPool) &&
+           prep.Value(args.flags) &&
+           prep.Result();
+}
+
+static VkResult InvokeResetDescriptorPool(PFN_vkVoidFunction proc, void *data) {
+    const ResetDescriptorPoolArgs &args = *static_cast<const ResetDescriptorPoolArgs *>(data);
+    return reinterpret_cast<PFN_vkResetDescriptorPool>(proc)(args.device, args.descriptorPool, args.flags);
+}
+
+struct AllocateDescriptorSetsArgs {
+    VkDevice                                    device;
+    const VkDescriptorSetAllocateInfo*          pAllocateInfo;
+    VkDescriptorSet*                            pDescriptorSets;
+};
+
+static bool PrepareAllocateDescriptorSets(ReplayPrep &prep) {
+    AllocateDescriptorSetsArgs &args = prep.NewArgs<AllocateDescriptorSetsArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pAllocateInfo) &&
+           prep.NewHandles(args.pDescriptorSets) &&
+           prep.Result();
+}
+
+static VkResult InvokeAllocateDescriptorSets(PFN_vkVoidFunction proc, void *data) {
+    const AllocateDescriptorSetsArgs &args = *static_cast<const AllocateDescriptorSetsArgs *>(data);
+    return reinterpret_cast<PFN_vkAllocateDescriptorSets>(proc)(args.device, args.pAllocateInfo, args.pDescriptorSets);
+}
+
+struct FreeDescriptorSetsArgs {
+    VkDevice                                    device;
+    VkDescriptorPool                            descriptorPool;
+    uint32_t                                    descriptorSetCount;
+    const VkDescriptorSet*                      pDescriptorSets;
+};
+
+static bool PrepareFreeDescriptorSets(ReplayPrep &prep) {
+    FreeDescriptorSetsArgs &args = prep.NewArgs<FreeDescriptorSetsArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.descriptorPool) &&
+           prep.Value(args.descriptorSetCount) &&
+           prep.Handles(args.pDescriptorSets) &&
+           prep.Result();
+}
+
+static VkResult InvokeFreeDescriptorSets(PFN_vkVoidFunction proc, void *data) {
+    const FreeDescriptorSetsArgs &args = *static_cast<const FreeDescriptorSetsArgs *>(data);
+    return reinterpret_cast<PFN_vkFreeDescriptorSets>(proc)(args.device, args.descriptorPool, args.descriptorSetCount, args.pDescriptorSets);
+}
+
+struct UpdateDescriptorSetsArgs {
+    VkDevice                                    device;
+    uint32_t                                    descriptorWriteCount;
+    const VkWriteDescriptorSet*                 pDescriptorWrites;
+    uint32_t                                    descriptorCopyCount;
+    const VkCopyDescriptorSet*                  pDescriptorCopies;
+};
+
+static bool PrepareUpdateDescriptorSets(ReplayPrep &prep) {
+    UpdateDescriptorSetsArgs &args = prep.NewArgs<UpdateDescriptorSetsArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.descriptorWriteCount) &&
+           prep.Array(args.pDescriptorWrites) &&
+           prep.Value(args.descriptorCopyCount) &&
+           prep.Array(args.pDescriptorCopies);
+}
+
+static VkResult InvokeUpdateDescriptorSets(PFN_vkVoidFunction proc, void *data) {
+    const UpdateDescriptorSetsArgs &args = *static_cast<const UpdateDescriptorSetsArgs *>(data);
+    reinterpret_cast<PFN_vkUpdateDescriptorSets>(proc)(args.device, args.descriptorWriteCount, args.pDescriptorWrites, args.descriptorCopyCount, args.pDescriptorCopies);
+    return VK_SUCCESS;
+}
+
+struct CreateFramebufferArgs {
+    VkDevice                                    device;
+    const VkFramebufferCreateInfo*              pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkFramebuffer*                              pFramebuffer;
+};
+
+static bool PrepareCreateFramebuffer(ReplayPrep &prep) {
+    CreateFramebufferArgs &args = prep.NewArgs<CreateFramebufferArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pFramebuffer) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateFramebuffer(PFN_vkVoidFunction proc, void *data) {
+    const CreateFramebufferArgs &args = *static_cast<const CreateFramebufferArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateFramebuffer>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pFramebuffer);
+}
+
+struct DestroyFramebufferArgs {
+    VkDevice                                    device;
+    VkFramebuffer                               framebuffer;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyFramebuffer(ReplayPrep &prep) {
+    DestroyFramebufferArgs &args = prep.NewArgs<DestroyFramebufferArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.framebuffer) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyFramebuffer(PFN_vkVoidFunction proc, void *data) {
+    const DestroyFramebufferArgs &args = *static_cast<const DestroyFramebufferArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyFramebuffer>(proc)(args.device, args.framebuffer, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreateRenderPassArgs {
+    VkDevice                                    device;
+    const VkRenderPassCreateInfo*               pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkRenderPass*                               pRenderPass;
+};
+
+static bool PrepareCreateRenderPass(ReplayPrep &prep) {
+    CreateRenderPassArgs &args = prep.NewArgs<CreateRenderPassArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pRenderPass) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateRenderPass(PFN_vkVoidFunction proc, void *data) {
+    const CreateRenderPassArgs &args = *static_cast<const CreateRenderPassArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateRenderPass>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pRenderPass);
+}
+
+struct DestroyRenderPassArgs {
+    VkDevice                                    device;
+    VkRenderPass                                renderPass;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyRenderPass(ReplayPrep &prep) {
+    DestroyRenderPassArgs &args = prep.NewArgs<DestroyRenderPassArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.renderPass) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyRenderPass(PFN_vkVoidFunction proc, void *data) {
+    const DestroyRenderPassArgs &args = *static_cast<const DestroyRenderPassArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyRenderPass>(proc)(args.device, args.renderPass, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct GetRenderAreaGranularityArgs {
+    VkDevice                                    device;
+    VkRenderPass                                renderPass;
+    VkExtent2D*                                 pGranularity;
+};
+
+static bool PrepareGetRenderAreaGranularity(ReplayPrep &prep) {
+    GetRenderAreaGranularityArgs &args = prep.NewArgs<GetRenderAreaGranularityArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.renderPass) &&
+           prep.Array(args.pGranularity);
+}
+
+static VkResult InvokeGetRenderAreaGranularity(PFN_vkVoidFunction proc, void *data) {
+    const GetRenderAreaGranularityArgs &args = *static_cast<const GetRenderAreaGranularityArgs *>(data);
+    reinterpret_cast<PFN_vkGetRenderAreaGranularity>(proc)(args.device, args.renderPass, args.pGranularity);
+    return VK_SUCCESS;
+}
+
+struct CreateCommandPoolArgs {
+    VkDevice                                    device;
+    const VkCommandPoolCreateInfo*              pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkCommandPool*                              pCommandPool;
+};
+
+static bool PrepareCreateCommandPool(ReplayPrep &prep) {
+    CreateCommandPoolArgs &args = prep.NewArgs<CreateCommandPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pCommandPool) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateCommandPool(PFN_vkVoidFunction proc, void *data) {
+    const CreateCommandPoolArgs &args = *static_cast<const CreateCommandPoolArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateCommandPool>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pCommandPool);
+}
+
+struct DestroyCommandPoolArgs {
+    VkDevice                                    device;
+    VkCommandPool                               commandPool;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyCommandPool(ReplayPrep &prep) {
+    DestroyCommandPoolArgs &args = prep.NewArgs<DestroyCommandPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.commandPool) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyCommandPool(PFN_vkVoidFunction proc, void *data) {
+    const DestroyCommandPoolArgs &args = *static_cast<const DestroyCommandPoolArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyCommandPool>(proc)(args.device, args.commandPool, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct ResetCommandPoolArgs {
+    VkDevice                                    device;
+    VkCommandPool                               commandPool;
+    VkCommandPoolResetFlags                     flags;
+};
+
+static bool PrepareResetCommandPool(ReplayPrep &prep) {
+    ResetCommandPoolArgs &args = prep.NewArgs<ResetCommandPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.commandPool) &&
+           prep.Value(args.flags) &&
+           prep.Result();
+}
+
+static VkResult InvokeResetCommandPool(PFN_vkVoidFunction proc, void *data) {
+    const ResetCommandPoolArgs &args = *static_cast<const ResetCommandPoolArgs *>(data);
+    return reinterpret_cast<PFN_vkResetCommandPool>(proc)(args.device, args.commandPool, args.flags);
+}
+
+struct AllocateCommandBuffersArgs {
+    VkDevice                                    device;
+    const VkCommandBufferAllocateInfo*          pAllocateInfo;
+    VkCommandBuffer*                            pCommandBuffers;
+};
+
+static bool PrepareAllocateCommandBuffers(ReplayPrep &prep) {
+    AllocateCommandBuffersArgs &args = prep.NewArgs<AllocateCommandBuffersArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pAllocateInfo) &&
+           prep.NewHandles(args.pCommandBuffers) &&
+           prep.Result();
+}
+
+static VkResult InvokeAllocateCommandBuffers(PFN_vkVoidFunction proc, void *data) {
+    const AllocateCommandBuffersArgs &args = *static_cast<const AllocateCommandBuffersArgs *>(data);
+    return reinterpret_cast<PFN_vkAllocateCommandBuffers>(proc)(args.device, args.pAllocateInfo, args.pCommandBuffers);
+}
+
+struct FreeCommandBuffersArgs {
+    VkDevice                                    device;
+    VkCommandPool                               commandPool;
+    uint32_t                                    commandBufferCount;
+    const VkCommandBuffer*                      pCommandBuffers;
+};
+
+static bool PrepareFreeCommandBuffers(ReplayPrep &prep) {
+    FreeCommandBuffersArgs &args = prep.NewArgs<FreeCommandBuffersArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.commandPool) &&
+           prep.Value(args.commandBufferCount) &&
+           prep.Handles(args.pCommandBuffers);
+}
+
+static VkResult InvokeFreeCommandBuffers(PFN_vkVoidFunction proc, void *data) {
+    const FreeCommandBuffersArgs &args = *static_cast<const FreeCommandBuffersArgs *>(data);
+    reinterpret_cast<PFN_vkFreeCommandBuffers>(proc)(args.device, args.commandPool, args.commandBufferCount, args.pCommandBuffers);
+    return VK_SUCCESS;
+}
+
+struct BeginCommandBufferArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkCommandBufferBeginInfo*             pBeginInfo;
+};
+
+static bool PrepareBeginCommandBuffer(ReplayPrep &prep) {
+    BeginCommandBufferArgs &args = prep.NewArgs<BeginCommandBufferArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pBeginInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeBeginCommandBuffer(PFN_vkVoidFunction proc, void *data) {
+    const BeginCommandBufferArgs &args = *static_cast<const BeginCommandBufferArgs *>(data);
+    return reinterpret_cast<PFN_vkBeginCommandBuffer>(proc)(args.commandBuffer, args.pBeginInfo);
+}
+
+struct EndCommandBufferArgs {
+    VkCommandBuffer                             commandBuffer;
+};
+
+static bool PrepareEndCommandBuffer(ReplayPrep &prep) {
+    EndCommandBufferArgs &args = prep.NewArgs<EndCommandBufferArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Result();
+}
+
+static VkResult InvokeEndCommandBuffer(PFN_vkVoidFunction proc, void *data) {
+    const EndCommandBufferArgs &args = *static_cast<const EndCommandBufferArgs *>(data);
+    return reinterpret_cast<PFN_vkEndCommandBuffer>(proc)(args.commandBuffer);
+}
+
+struct ResetCommandBufferArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkCommandBufferResetFlags                   flags;
+};
+
+static bool PrepareResetCommandBuffer(ReplayPrep &prep) {
+    ResetCommandBufferArgs &args = prep.NewArgs<ResetCommandBufferArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.flags) &&
+           prep.Result();
+}
+
+static VkResult InvokeResetCommandBuffer(PFN_vkVoidFunction proc, void *data) {
+    const ResetCommandBufferArgs &args = *static_cast<const ResetCommandBufferArgs *>(data);
+    return reinterpret_cast<PFN_vkResetCommandBuffer>(proc)(args.commandBuffer, args.flags);
+}
+
+struct CmdBindPipelineArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineBindPoint                         pipelineBindPoint;
+    VkPipeline                                  pipeline;
+};
+
+static bool PrepareCmdBindPipeline(ReplayPrep &prep) {
+    CmdBindPipelineArgs &args = prep.NewArgs<CmdBindPipelineArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.pipelineBindPoint) &&
+           prep.Handle(args.pipeline);
+}
+
+static VkResult InvokeCmdBindPipeline(PFN_vkVoidFunction proc, void *data) {
+    const CmdBindPipelineArgs &args = *static_cast<const CmdBindPipelineArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBindPipeline>(proc)(args.commandBuffer, args.pipelineBindPoint, args.pipeline);
+    return VK_SUCCESS;
+}
+
+struct CmdSetViewportArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstViewport;
+    uint32_t                                    viewportCount;
+    const VkViewport*                           pViewports;
+};
+
+static bool PrepareCmdSetViewport(ReplayPrep &prep) {
+    CmdSetViewportArgs &args = prep.NewArgs<CmdSetViewportArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstViewport) &&
+           prep.Value(args.viewportCount) &&
+           prep.Array(args.pViewports);
+}
+
+static VkResult InvokeCmdSetViewport(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetViewportArgs &args = *static_cast<const CmdSetViewportArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetViewport>(proc)(args.commandBuffer, args.firstViewport, args.viewportCount, args.pViewports);
+    return VK_SUCCESS;
+}
+
+struct CmdSetScissorArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstScissor;
+    uint32_t                                    scissorCount;
+    const VkRect2D*                             pScissors;
+};
+
+static bool PrepareCmdSetScissor(ReplayPrep &prep) {
+    CmdSetScissorArgs &args = prep.NewArgs<CmdSetScissorArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstScissor) &&
+           prep.Value(args.scissorCount) &&
+           prep.Array(args.pScissors);
+}
+
+static VkResult InvokeCmdSetScissor(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetScissorArgs &args = *static_cast<const CmdSetScissorArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetScissor>(proc)(args.commandBuffer, args.firstScissor, args.scissorCount, args.pScissors);
+    return VK_SUCCESS;
+}
+
+struct CmdSetLineWidthArgs {
+    VkCommandBuffer                             commandBuffer;
+    float                                       lineWidth;
+};
+
+static bool PrepareCmdSetLineWidth(ReplayPrep &prep) {
+    CmdSetLineWidthArgs &args = prep.NewArgs<CmdSetLineWidthArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.lineWidth);
+}
+
+static VkResult InvokeCmdSetLineWidth(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetLineWidthArgs &args = *static_cast<const CmdSetLineWidthArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetLineWidth>(proc)(args.commandBuffer, args.lineWidth);
+    return VK_SUCCESS;
+}
+
+struct CmdSetDepthBiasArgs {
+    VkCommandBuffer                             commandBuffer;
+    float                                       depthBiasConstantFactor;
+    float                                       depthBiasClamp;
+    float                                       depthBiasSlopeFactor;
+};
+
+static bool PrepareCmdSetDepthBias(ReplayPrep &prep) {
+    CmdSetDepthBiasArgs &args = prep.NewArgs<CmdSetDepthBiasArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.depthBiasConstantFactor) &&
+           prep.Value(args.depthBiasClamp) &&
+           prep.Value(args.depthBiasSlopeFactor);
+}
+
+static VkResult InvokeCmdSetDepthBias(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDepthBiasArgs &args = *static_cast<const CmdSetDepthBiasArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDepthBias>(proc)(args.commandBuffer, args.depthBiasConstantFactor, args.depthBiasClamp, args.depthBiasSlopeFactor);
+    return VK_SUCCESS;
+}
+
+struct CmdSetBlendConstantsArgs {
+    VkCommandBuffer                             commandBuffer;
+    const float*                                blendConstants;
+};
+
+static bool PrepareCmdSetBlendConstants(ReplayPrep &prep) {
+    CmdSetBlendConstantsArgs &args = prep.NewArgs<CmdSetBlendConstantsArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.blendConstants);
+}
+
+static VkResult InvokeCmdSetBlendConstants(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetBlendConstantsArgs &args = *static_cast<const CmdSetBlendConstantsArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetBlendConstants>(proc)(args.commandBuffer, args.blendConstants);
+    return VK_SUCCESS;
+}
+
+struct CmdSetDepthBoundsArgs {
+    VkCommandBuffer                             commandBuffer;
+    float                                       minDepthBounds;
+    float                                       maxDepthBounds;
+};
+
+static bool PrepareCmdSetDepthBounds(ReplayPrep &prep) {
+    CmdSetDepthBoundsArgs &args = prep.NewArgs<CmdSetDepthBoundsArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.minDepthBounds) &&
+           prep.Value(args.maxDepthBounds);
+}
+
+static VkResult InvokeCmdSetDepthBounds(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDepthBoundsArgs &args = *static_cast<const CmdSetDepthBoundsArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDepthBounds>(proc)(args.commandBuffer, args.minDepthBounds, args.maxDepthBounds);
+    return VK_SUCCESS;
+}
+
+struct CmdSetStencilCompareMaskArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkStencilFaceFlags                          faceMask;
+    uint32_t                                    compareMask;
+};
+
+static bool PrepareCmdSetStencilCompareMask(ReplayPrep &prep) {
+    CmdSetStencilCompareMaskArgs &args = prep.NewArgs<CmdSetStencilCompareMaskArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.faceMask) &&
+           prep.Value(args.compareMask);
+}
+
+static VkResult InvokeCmdSetStencilCompareMask(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetStencilCompareMaskArgs &args = *static_cast<const CmdSetStencilCompareMaskArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetStencilCompareMask>(proc)(args.commandBuffer, args.faceMask, args.compareMask);
+    return VK_SUCCESS;
+}
+
+struct CmdSetStencilWriteMaskArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkStencilFaceFlags                          faceMask;
+    uint32_t                                    writeMask;
+};
+
+static bool PrepareCmdSetStencilWriteMask(ReplayPrep &prep) {
+    CmdSetStencilWriteMaskArgs &args = prep.NewArgs<CmdSetStencilWriteMaskArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.faceMask) &&
+           prep.Value(args.writeMask);
+}
+
+static VkResult InvokeCmdSetStencilWriteMask(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetStencilWriteMaskArgs &args = *static_cast<const CmdSetStencilWriteMaskArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetStencilWriteMask>(proc)(args.commandBuffer, args.faceMask, args.writeMask);
+    return VK_SUCCESS;
+}
+
+struct CmdSetStencilReferenceArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkStencilFaceFlags                          faceMask;
+    uint32_t                                    reference;
+};
+
+static bool PrepareCmdSetStencilReference(ReplayPrep &prep) {
+    CmdSetStencilReferenceArgs &args = prep.NewArgs<CmdSetStencilReferenceArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.faceMask) &&
+           prep.Value(args.reference);
+}
+
+static VkResult InvokeCmdSetStencilReference(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetStencilReferenceArgs &args = *static_cast<const CmdSetStencilReferenceArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetStencilReference>(proc)(args.commandBuffer, args.faceMask, args.reference);
+    return VK_SUCCESS;
+}
+
+struct CmdBindDescriptorSetsArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineBindPoint                         pipelineBindPoint;
+    VkPipelineLayout                            layout;
+    uint32_t                                    firstSet;
+    uint32_t                                    descriptorSetCount;
+    const VkDescriptorSet*                      pDescriptorSets;
+    uint32_t                                    dynamicOffsetCount;
+    const uint32_t*                             pDynamicOffsets;
+};
+
+static bool PrepareCmdBindDescriptorSets(ReplayPrep &prep) {
+    CmdBindDescriptorSetsArgs &args = prep.NewArgs<CmdBindDescriptorSetsArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.pipelineBindPoint) &&
+           prep.Handle(args.layout) &&
+           prep.Value(args.firstSet) &&
+           prep.Value(args.descriptorSetCount) &&
+           prep.Handles(args.pDescriptorSets) &&
+           prep.Value(args.dynamicOffsetCount) &&
+           prep.Array(args.pDynamicOffsets);
+}
+
+static VkResult InvokeCmdBindDescriptorSets(PFN_vkVoidFunction proc, void *data) {
+    const CmdBindDescriptorSetsArgs &args = *static_cast<const CmdBindDescriptorSetsArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBindDescriptorSets>(proc)(args.commandBuffer, args.pipelineBindPoint, args.layout, args.firstSet, args.descriptorSetCount, args.pDescriptorSets, args.dynamicOffsetCount, args.pDynamicOffsets);
+    return VK_SUCCESS;
+}
+
+struct CmdBindIndexBufferArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkIndexType                                 indexType;
+};
+
+static bool PrepareCmdBindIndexBuffer(ReplayPrep &prep) {
+    CmdBindIndexBufferArgs &args = prep.NewArgs<CmdBindIndexBufferArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Value(args.indexType);
+}
+
+static VkResult InvokeCmdBindIndexBuffer(PFN_vkVoidFunction proc, void *data) {
+    const CmdBindIndexBufferArgs &args = *static_cast<const CmdBindIndexBufferArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBindIndexBuffer>(proc)(args.commandBuffer, args.buffer, args.offset, args.indexType);
+    return VK_SUCCESS;
+}
+
+struct CmdBindVertexBuffersArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstBinding;
+    uint32_t                                    bindingCount;
+    const VkBuffer*                             pBuffers;
+    const VkDeviceSize*                         pOffsets;
+};
+
+static bool PrepareCmdBindVertexBuffers(ReplayPrep &prep) {
+    CmdBindVertexBuffersArgs &args = prep.NewArgs<CmdBindVertexBuffersArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstBinding) &&
+           prep.Value(args.bindingCount) &&
+           prep.Handles(args.pBuffers) &&
+           prep.Array(args.pOffsets);
+}
+
+static VkResult InvokeCmdBindVertexBuffers(PFN_vkVoidFunction proc, void *data) {
+    const CmdBindVertexBuffersArgs &args = *static_cast<const CmdBindVertexBuffersArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBindVertexBuffers>(proc)(args.commandBuffer, args.firstBinding, args.bindingCount, args.pBuffers, args.pOffsets);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    vertexCount;
+    uint32_t                                    instanceCount;
+    uint32_t                                    firstVertex;
+    uint32_t                                    firstInstance;
+};
+
+static bool PrepareCmdDraw(ReplayPrep &prep) {
+    CmdDrawArgs &args = prep.NewArgs<CmdDrawArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.vertexCount) &&
+           prep.Value(args.instanceCount) &&
+           prep.Value(args.firstVertex) &&
+           prep.Value(args.firstInstance);
+}
+
+static VkResult InvokeCmdDraw(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawArgs &args = *static_cast<const CmdDrawArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDraw>(proc)(args.commandBuffer, args.vertexCount, args.instanceCount, args.firstVertex, args.firstInstance);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawIndexedArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    indexCount;
+    uint32_t                                    instanceCount;
+    uint32_t                                    firstIndex;
+    int32_t                                     vertexOffset;
+    uint32_t                                    firstInstance;
+};
+
+static bool PrepareCmdDrawIndexed(ReplayPrep &prep) {
+    CmdDrawIndexedArgs &args = prep.NewArgs<CmdDrawIndexedArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.indexCount) &&
+           prep.Value(args.instanceCount) &&
+           prep.Value(args.firstIndex) &&
+           prep.Value(args.vertexOffset) &&
+           prep.Value(args.firstInstance);
+}
+
+static VkResult InvokeCmdDrawIndexed(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndexedArgs &args = *static_cast<const CmdDrawIndexedArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndexed>(proc)(args.commandBuffer, args.indexCount, args.instanceCount, args.firstIndex, args.vertexOffset, args.firstInstance);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawIndirectArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    uint32_t                                    drawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawIndirect(ReplayPrep &prep) {
+    CmdDrawIndirectArgs &args = prep.NewArgs<CmdDrawIndirectArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Value(args.drawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawIndirect(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndirectArgs &args = *static_cast<const CmdDrawIndirectArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndirect>(proc)(args.commandBuffer, args.buffer, args.offset, args.drawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawIndexedIndirectArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    uint32_t                                    drawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawIndexedIndirect(ReplayPrep &prep) {
+    CmdDrawIndexedIndirectArgs &args = prep.NewArgs<CmdDrawIndexedIndirectArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Value(args.drawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawIndexedIndirect(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndexedIndirectArgs &args = *static_cast<const CmdDrawIndexedIndirectArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndexedIndirect>(proc)(args.commandBuffer, args.buffer, args.offset, args.drawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct CmdDispatchArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    groupCountX;
+    uint32_t                                    groupCountY;
+    uint32_t                                    groupCountZ;
+};
+
+static bool PrepareCmdDispatch(ReplayPrep &prep) {
+    CmdDispatchArgs &args = prep.NewArgs<CmdDispatchArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.groupCountX) &&
+           prep.Value(args.groupCountY) &&
+           prep.Value(args.groupCountZ);
+}
+
+static VkResult InvokeCmdDispatch(PFN_vkVoidFunction proc, void *data) {
+    const CmdDispatchArgs &args = *static_cast<const CmdDispatchArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDispatch>(proc)(args.commandBuffer, args.groupCountX, args.groupCountY, args.groupCountZ);
+    return VK_SUCCESS;
+}
+
+struct CmdDispatchIndirectArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+};
+
+static bool PrepareCmdDispatchIndirect(ReplayPrep &prep) {
+    CmdDispatchIndirectArgs &args = prep.NewArgs<CmdDispatchIndirectArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset);
+}
+
+static VkResult InvokeCmdDispatchIndirect(PFN_vkVoidFunction proc, void *data) {
+    const CmdDispatchIndirectArgs &args = *static_cast<const CmdDispatchIndirectArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDispatchIndirect>(proc)(args.commandBuffer, args.buffer, args.offset);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyBufferArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    srcBuffer;
+    VkBuffer                                    dstBuffer;
+    uint32_t                                    regionCount;
+    const VkBufferCopy*                         pRegions;
+};
+
+static bool PrepareCmdCopyBuffer(ReplayPrep &prep) {
+    CmdCopyBufferArgs &args = prep.NewArgs<CmdCopyBufferArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.srcBuffer) &&
+           prep.Handle(args.dstBuffer) &&
+           prep.Value(args.regionCount) &&
+           prep.Array(args.pRegions);
+}
+
+static VkResult InvokeCmdCopyBuffer(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyBufferArgs &args = *static_cast<const CmdCopyBufferArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyBuffer>(proc)(args.commandBuffer, args.srcBuffer, args.dstBuffer, args.regionCount, args.pRegions);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyImageArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkImage                                     srcImage;
+    VkImageLayout                               srcImageLayout;
+    VkImage                                     dstImage;
+    VkImageLayout                               dstImageLayout;
+    uint32_t                                    regionCount;
+    const VkImageCopy*                          pRegions;
+};
+
+static bool PrepareCmdCopyImage(ReplayPrep &prep) {
+    CmdCopyImageArgs &args = prep.NewArgs<CmdCopyImageArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.srcImage) &&
+           prep.Value(args.srcImageLayout) &&
+           prep.Handle(args.dstImage) &&
+           prep.Value(args.dstImageLayout) &&
+           prep.Value(args.regionCount) &&
+           prep.Array(args.pRegions);
+}
+
+static VkResult InvokeCmdCopyImage(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyImageArgs &args = *static_cast<const CmdCopyImageArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyImage>(proc)(args.commandBuffer, args.srcImage, args.srcImageLayout, args.dstImage, args.dstImageLayout, args.regionCount, args.pRegions);
+    return VK_SUCCESS;
+}
+
+struct CmdBlitImageArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkImage                                     srcImage;
+    VkImageLayout                               srcImageLayout;
+    VkImage                                     dstImage;
+    VkImageLayout                               dstImageLayout;
+    uint32_t                                    regionCount;
+    const VkImageBlit*                          pRegions;
+    VkFilter                                    filter;
+};
+
+static bool PrepareCmdBlitImage(ReplayPrep &prep) {
+    CmdBlitImageArgs &args = prep.NewArgs<CmdBlitImageArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.srcImage) &&
+           prep.Value(args.srcImageLayout) &&
+           prep.Handle(args.dstImage) &&
+           prep.Value(args.dstImageLayout) &&
+           prep.Value(args.regionCount) &&
+           prep.Array(args.pRegions) &&
+           prep.Value(args.filter);
+}
+
+static VkResult InvokeCmdBlitImage(PFN_vkVoidFunction proc, void *data) {
+    const CmdBlitImageArgs &args = *static_cast<const CmdBlitImageArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBlitImage>(proc)(args.commandBuffer, args.srcImage, args.srcImageLayout, args.dstImage, args.dstImageLayout, args.regionCount, args.pRegions, args.filter);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyBufferToImageArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    srcBuffer;
+    VkImage                                     dstImage;
+    VkImageLayout                               dstImageLayout;
+    uint32_t                                    regionCount;
+    const VkBufferImageCopy*                    pRegions;
+};
+
+static bool PrepareCmdCopyBufferToImage(ReplayPrep &prep) {
+    CmdCopyBufferToImageArgs &args = prep.NewArgs<CmdCopyBufferToImageArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.srcBuffer) &&
+           prep.Handle(args.dstImage) &&
+           prep.Value(args.dstImageLayout) &&
+           prep.Value(args.regionCount) &&
+           prep.Array(args.pRegions);
+}
+
+static VkResult InvokeCmdCopyBufferToImage(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyBufferToImageArgs &args = *static_cast<const CmdCopyBufferToImageArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyBufferToImage>(proc)(args.commandBuffer, args.srcBuffer, args.dstImage, args.dstImageLayout, args.regionCount, args.pRegions);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyImageToBufferArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkImage                                     srcImage;
+    VkImageLayout                               srcImageLayout;
+    VkBuffer                                    dstBuffer;
+    uint32_t                                    regionCount;
+    const VkBufferImageCopy*                    pRegions;
+};
+
+static bool PrepareCmdCopyImageToBuffer(ReplayPrep &prep) {
+    CmdCopyImageToBufferArgs &args = prep.NewArgs<CmdCopyImageToBufferArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.srcImage) &&
+           prep.Value(args.srcImageLayout) &&
+           prep.Handle(args.dstBuffer) &&
+           prep.Value(args.regionCount) &&
+           prep.Array(args.pRegions);
+}
+
+static VkResult InvokeCmdCopyImageToBuffer(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyImageToBufferArgs &args = *static_cast<const CmdCopyImageToBufferArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyImageToBuffer>(proc)(args.commandBuffer, args.srcImage, args.srcImageLayout, args.dstBuffer, args.regionCount, args.pRegions);
+    return VK_SUCCESS;
+}
+
+struct CmdUpdateBufferArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    VkDeviceSize                                dataSize;
+    const void*                                 pData;
+};
+
+static bool PrepareCmdUpdateBuffer(ReplayPrep &prep) {
+    CmdUpdateBufferArgs &args = prep.NewArgs<CmdUpdateBufferArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.dstBuffer) &&
+           prep.Value(args.dstOffset) &&
+           prep.Value(args.dataSize) &&
+           prep.Bytes(args.pData);
+}
+
+static VkResult InvokeCmdUpdateBuffer(PFN_vkVoidFunction proc, void *data) {
+    const CmdUpdateBufferArgs &args = *static_cast<const CmdUpdateBufferArgs *>(data);
+    reinterpret_cast<PFN_vkCmdUpdateBuffer>(proc)(args.commandBuffer, args.dstBuffer, args.dstOffset, args.dataSize, args.pData);
+    return VK_SUCCESS;
+}
+
+struct CmdFillBufferArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    VkDeviceSize                                size;
+    uint32_t                                    data;
+};
+
+static bool PrepareCmdFillBuffer(ReplayPrep &prep) {
+    CmdFillBufferArgs &args = prep.NewArgs<CmdFillBufferArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.dstBuffer) &&
+           prep.Value(args.dstOffset) &&
+           prep.Value(args.size) &&
+           prep.Value(args.data);
+}
+
+static VkResult InvokeCmdFillBuffer(PFN_vkVoidFunction proc, void *data) {
+    const CmdFillBufferArgs &args = *static_cast<const CmdFillBufferArgs *>(data);
+    reinterpret_cast<PFN_vkCmdFillBuffer>(proc)(args.commandBuffer, args.dstBuffer, args.dstOffset, args.size, args.data);
+    return VK_SUCCESS;
+}
+
+struct CmdClearColorImageArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkImage                                     image;
+    VkImageLayout                               imageLayout;
+    const VkClearColorValue*                    pColor;
+    uint32_t                                    rangeCount;
+    const VkImageSubresourceRange*              pRanges;
+};
+
+static bool PrepareCmdClearColorImage(ReplayPrep &prep) {
+    CmdClearColorImageArgs &args = prep.NewArgs<CmdClearColorImageArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.image) &&
+           prep.Value(args.imageLayout) &&
+           prep.Array(args.pColor) &&
+           prep.Value(args.rangeCount) &&
+           prep.Array(args.pRanges);
+}
+
+static VkResult InvokeCmdClearColorImage(PFN_vkVoidFunction proc, void *data) {
+    const CmdClearColorImageArgs &args = *static_cast<const CmdClearColorImageArgs *>(data);
+    reinterpret_cast<PFN_vkCmdClearColorImage>(proc)(args.commandBuffer, args.image, args.imageLayout, args.pColor, args.rangeCount, args.pRanges);
+    return VK_SUCCESS;
+}
+
+struct CmdClearDepthStencilImageArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkImage                                     image;
+    VkImageLayout                               imageLayout;
+    const VkClearDepthStencilValue*             pDepthStencil;
+    uint32_t                                    rangeCount;
+    const VkImageSubresourceRange*              pRanges;
+};
+
+static bool PrepareCmdClearDepthStencilImage(ReplayPrep &prep) {
+    CmdClearDepthStencilImageArgs &args = prep.NewArgs<CmdClearDepthStencilImageArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.image) &&
+           prep.Value(args.imageLayout) &&
+           prep.Array(args.pDepthStencil) &&
+           prep.Value(args.rangeCount) &&
+           prep.Array(args.pRanges);
+}
+
+static VkResult InvokeCmdClearDepthStencilImage(PFN_vkVoidFunction proc, void *data) {
+    const CmdClearDepthStencilImageArgs &args = *static_cast<const CmdClearDepthStencilImageArgs *>(data);
+    reinterpret_cast<PFN_vkCmdClearDepthStencilImage>(proc)(args.commandBuffer, args.image, args.imageLayout, args.pDepthStencil, args.rangeCount, args.pRanges);
+    return VK_SUCCESS;
+}
+
+struct CmdClearAttachmentsArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    attachmentCount;
+    const VkClearAttachment*                    pAttachments;
+    uint32_t                                    rectCount;
+    const VkClearRect*                          pRects;
+};
+
+static bool PrepareCmdClearAttachments(ReplayPrep &prep) {
+    CmdClearAttachmentsArgs &args = prep.NewArgs<CmdClearAttachmentsArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.attachmentCount) &&
+           prep.Array(args.pAttachments) &&
+           prep.Value(args.rectCount) &&
+           prep.Array(args.pRects);
+}
+
+static VkResult InvokeCmdClearAttachments(PFN_vkVoidFunction proc, void *data) {
+    const CmdClearAttachmentsArgs &args = *static_cast<const CmdClearAttachmentsArgs *>(data);
+    reinterpret_cast<PFN_vkCmdClearAttachments>(proc)(args.commandBuffer, args.attachmentCount, args.pAttachments, args.rectCount, args.pRects);
+    return VK_SUCCESS;
+}
+
+struct CmdResolveImageArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkImage                                     srcImage;
+    VkImageLayout                               srcImageLayout;
+    VkImage                                     dstImage;
+    VkImageLayout                               dstImageLayout;
+    uint32_t                                    regionCount;
+    const VkImageResolve*                       pRegions;
+};
+
+static bool PrepareCmdResolveImage(ReplayPrep &prep) {
+    CmdResolveImageArgs &args = prep.NewArgs<CmdResolveImageArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.srcImage) &&
+           prep.Value(args.srcImageLayout) &&
+           prep.Handle(args.dstImage) &&
+           prep.Value(args.dstImageLayout) &&
+           prep.Value(args.regionCount) &&
+           prep.Array(args.pRegions);
+}
+
+static VkResult InvokeCmdResolveImage(PFN_vkVoidFunction proc, void *data) {
+    const CmdResolveImageArgs &args = *static_cast<const CmdResolveImageArgs *>(data);
+    reinterpret_cast<PFN_vkCmdResolveImage>(proc)(args.commandBuffer, args.srcImage, args.srcImageLayout, args.dstImage, args.dstImageLayout, args.regionCount, args.pRegions);
+    return VK_SUCCESS;
+}
+
+struct CmdSetEventArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkEvent                                     event;
+    VkPipelineStageFlags                        stageMask;
+};
+
+static bool PrepareCmdSetEvent(ReplayPrep &prep) {
+    CmdSetEventArgs &args = prep.NewArgs<CmdSetEventArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.event) &&
+           prep.Value(args.stageMask);
+}
+
+static VkResult InvokeCmdSetEvent(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetEventArgs &args = *static_cast<const CmdSetEventArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetEvent>(proc)(args.commandBuffer, args.event, args.stageMask);
+    return VK_SUCCESS;
+}
+
+struct CmdResetEventArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkEvent                                     event;
+    VkPipelineStageFlags                        stageMask;
+};
+
+static bool PrepareCmdResetEvent(ReplayPrep &prep) {
+    CmdResetEventArgs &args = prep.NewArgs<CmdResetEventArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.event) &&
+           prep.Value(args.stageMask);
+}
+
+static VkResult InvokeCmdResetEvent(PFN_vkVoidFunction proc, void *data) {
+    const CmdResetEventArgs &args = *static_cast<const CmdResetEventArgs *>(data);
+    reinterpret_cast<PFN_vkCmdResetEvent>(proc)(args.commandBuffer, args.event, args.stageMask);
+    return VK_SUCCESS;
+}
+
+struct CmdWaitEventsArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    eventCount;
+    const VkEvent*                              pEvents;
+    VkPipelineStageFlags                        srcStageMask;
+    VkPipelineStageFlags                        dstStageMask;
+    uint32_t                                    memoryBarrierCount;
+    const VkMemoryBarrier*                      pMemoryBarriers;
+    uint32_t                                    bufferMemoryBarrierCount;
+    const VkBufferMemoryBarrier*                pBufferMemoryBarriers;
+    uint32_t                                    imageMemoryBarrierCount;
+    const VkImageMemoryBarrier*                 pImageMemoryBarriers;
+};
+
+static bool PrepareCmdWaitEvents(ReplayPrep &prep) {
+    CmdWaitEventsArgs &args = prep.NewArgs<CmdWaitEventsArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.eventCount) &&
+           prep.Handles(args.pEvents) &&
+           prep.Value(args.srcStageMask) &&
+           prep.Value(args.dstStageMask) &&
+           prep.Value(args.memoryBarrierCount) &&
+           prep.Array(args.pMemoryBarriers) &&
+           prep.Value(args.bufferMemoryBarrierCount) &&
+           prep.Array(args.pBufferMemoryBarriers) &&
+           prep.Value(args.imageMemoryBarrierCount) &&
+           prep.Array(args.pImageMemoryBarriers);
+}
+
+static VkResult InvokeCmdWaitEvents(PFN_vkVoidFunction proc, void *data) {
+    const CmdWaitEventsArgs &args = *static_cast<const CmdWaitEventsArgs *>(data);
+    reinterpret_cast<PFN_vkCmdWaitEvents>(proc)(args.commandBuffer, args.eventCount, args.pEvents, args.srcStageMask, args.dstStageMask, args.memoryBarrierCount, args.pMemoryBarriers, args.bufferMemoryBarrierCount, args.pBufferMemoryBarriers, args.imageMemoryBarrierCount, args.pImageMemoryBarriers);
+    return VK_SUCCESS;
+}
+
+struct CmdPipelineBarrierArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineStageFlags                        srcStageMask;
+    VkPipelineStageFlags                        dstStageMask;
+    VkDependencyFlags                           dependencyFlags;
+    uint32_t                                    memoryBarrierCount;
+    const VkMemoryBarrier*                      pMemoryBarriers;
+    uint32_t                                    bufferMemoryBarrierCount;
+    const VkBufferMemoryBarrier*                pBufferMemoryBarriers;
+    uint32_t                                    imageMemoryBarrierCount;
+    const VkImageMemoryBarrier*                 pImageMemoryBarriers;
+};
+
+static bool PrepareCmdPipelineBarrier(ReplayPrep &prep) {
+    CmdPipelineBarrierArgs &args = prep.NewArgs<CmdPipelineBarrierArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.srcStageMask) &&
+           prep.Value(args.dstStageMask) &&
+           prep.Value(args.dependencyFlags) &&
+           prep.Value(args.memoryBarrierCount) &&
+           prep.Array(args.pMemoryBarriers) &&
+           prep.Value(args.bufferMemoryBarrierCount) &&
+           prep.Array(args.pBufferMemoryBarriers) &&
+           prep.Value(args.imageMemoryBarrierCount) &&
+           prep.Array(args.pImageMemoryBarriers);
+}
+
+static VkResult InvokeCmdPipelineBarrier(PFN_vkVoidFunction proc, void *data) {
+    const CmdPipelineBarrierArgs &args = *static_cast<const CmdPipelineBarrierArgs *>(data);
+    reinterpret_cast<PFN_vkCmdPipelineBarrier>(proc)(args.commandBuffer, args.srcStageMask, args.dstStageMask, args.dependencyFlags, args.memoryBarrierCount, args.pMemoryBarriers, args.bufferMemoryBarrierCount, args.pBufferMemoryBarriers, args.imageMemoryBarrierCount, args.pImageMemoryBarriers);
+    return VK_SUCCESS;
+}
+
+struct CmdBeginQueryArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+    VkQueryControlFlags                         flags;
+};
+
+static bool PrepareCmdBeginQuery(ReplayPrep &prep) {
+    CmdBeginQueryArgs &args = prep.NewArgs<CmdBeginQueryArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.query) &&
+           prep.Value(args.flags);
+}
+
+static VkResult InvokeCmdBeginQuery(PFN_vkVoidFunction proc, void *data) {
+    const CmdBeginQueryArgs &args = *static_cast<const CmdBeginQueryArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBeginQuery>(proc)(args.commandBuffer, args.queryPool, args.query, args.flags);
+    return VK_SUCCESS;
+}
+
+struct CmdEndQueryArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+};
+
+static bool PrepareCmdEndQuery(ReplayPrep &prep) {
+    CmdEndQueryArgs &args = prep.NewArgs<CmdEndQueryArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.query);
+}
+
+static VkResult InvokeCmdEndQuery(PFN_vkVoidFunction proc, void *data) {
+    const CmdEndQueryArgs &args = *static_cast<const CmdEndQueryArgs *>(data);
+    reinterpret_cast<PFN_vkCmdEndQuery>(proc)(args.commandBuffer, args.queryPool, args.query);
+    return VK_SUCCESS;
+}
+
+struct CmdResetQueryPoolArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+    uint32_t                                    queryCount;
+};
+
+static bool PrepareCmdResetQueryPool(ReplayPrep &prep) {
+    CmdResetQueryPoolArgs &args = prep.NewArgs<CmdResetQueryPoolArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.firstQuery) &&
+           prep.Value(args.queryCount);
+}
+
+static VkResult InvokeCmdResetQueryPool(PFN_vkVoidFunction proc, void *data) {
+    const CmdResetQueryPoolArgs &args = *static_cast<const CmdResetQueryPoolArgs *>(data);
+    reinterpret_cast<PFN_vkCmdResetQueryPool>(proc)(args.commandBuffer, args.queryPool, args.firstQuery, args.queryCount);
+    return VK_SUCCESS;
+}
+
+struct CmdWriteTimestampArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineStageFlagBits                     pipelineStage;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+};
+
+static bool PrepareCmdWriteTimestamp(ReplayPrep &prep) {
+    CmdWriteTimestampArgs &args = prep.NewArgs<CmdWriteTimestampArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.pipelineStage) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.query);
+}
+
+static VkResult InvokeCmdWriteTimestamp(PFN_vkVoidFunction proc, void *data) {
+    const CmdWriteTimestampArgs &args = *static_cast<const CmdWriteTimestampArgs *>(data);
+    reinterpret_cast<PFN_vkCmdWriteTimestamp>(proc)(args.commandBuffer, args.pipelineStage, args.queryPool, args.query);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyQueryPoolResultsArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+    uint32_t                                    queryCount;
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    VkDeviceSize                                stride;
+    VkQueryResultFlags                          flags;
+};
+
+static bool PrepareCmdCopyQueryPoolResults(ReplayPrep &prep) {
+    CmdCopyQueryPoolResultsArgs &args = prep.NewArgs<CmdCopyQueryPoolResultsArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.firstQuery) &&
+           prep.Value(args.queryCount) &&
+           prep.Handle(args.dstBuffer) &&
+           prep.Value(args.dstOffset) &&
+           prep.Value(args.stride) &&
+           prep.Value(args.flags);
+}
+
+static VkResult InvokeCmdCopyQueryPoolResults(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyQueryPoolResultsArgs &args = *static_cast<const CmdCopyQueryPoolResultsArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyQueryPoolResults>(proc)(args.commandBuffer, args.queryPool, args.firstQuery, args.queryCount, args.dstBuffer, args.dstOffset, args.stride, args.flags);
+    return VK_SUCCESS;
+}
+
+struct CmdPushConstantsArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineLayout                            layout;
+    VkShaderStageFlags                          stageFlags;
+    uint32_t                                    offset;
+    uint32_t                                    size;
+    const void*                                 pValues;
+};
+
+static bool PrepareCmdPushConstants(ReplayPrep &prep) {
+    CmdPushConstantsArgs &args = prep.NewArgs<CmdPushConstantsArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.layout) &&
+           prep.Value(args.stageFlags) &&
+           prep.Value(args.offset) &&
+           prep.Value(args.size) &&
+           prep.Bytes(args.pValues);
+}
+
+static VkResult InvokeCmdPushConstants(PFN_vkVoidFunction proc, void *data) {
+    const CmdPushConstantsArgs &args = *static_cast<const CmdPushConstantsArgs *>(data);
+    reinterpret_cast<PFN_vkCmdPushConstants>(proc)(args.commandBuffer, args.layout, args.stageFlags, args.offset, args.size, args.pValues);
+    return VK_SUCCESS;
+}
+
+struct CmdBeginRenderPassArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkRenderPassBeginInfo*                pRenderPassBegin;
+    VkSubpassContents                           contents;
+};
+
+static bool PrepareCmdBeginRenderPass(ReplayPrep &prep) {
+    CmdBeginRenderPassArgs &args = prep.NewArgs<CmdBeginRenderPassArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pRenderPassBegin) &&
+           prep.Value(args.contents);
+}
+
+static VkResult InvokeCmdBeginRenderPass(PFN_vkVoidFunction proc, void *data) {
+    const CmdBeginRenderPassArgs &args = *static_cast<const CmdBeginRenderPassArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBeginRenderPass>(proc)(args.commandBuffer, args.pRenderPassBegin, args.contents);
+    return VK_SUCCESS;
+}
+
+struct CmdNextSubpassArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkSubpassContents                           contents;
+};
+
+static bool PrepareCmdNextSubpass(ReplayPrep &prep) {
+    CmdNextSubpassArgs &args = prep.NewArgs<CmdNextSubpassArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.contents);
+}
+
+static VkResult InvokeCmdNextSubpass(PFN_vkVoidFunction proc, void *data) {
+    const CmdNextSubpassArgs &args = *static_cast<const CmdNextSubpassArgs *>(data);
+    reinterpret_cast<PFN_vkCmdNextSubpass>(proc)(args.commandBuffer, args.contents);
+    return VK_SUCCESS;
+}
+
+struct CmdEndRenderPassArgs {
+    VkCommandBuffer                             commandBuffer;
+};
+
+static bool PrepareCmdEndRenderPass(ReplayPrep &prep) {
+    CmdEndRenderPassArgs &args = prep.NewArgs<CmdEndRenderPassArgs>();
+    return prep.Handle(args.commandBuffer);
+}
+
+static VkResult InvokeCmdEndRenderPass(PFN_vkVoidFunction proc, void *data) {
+    const CmdEndRenderPassArgs &args = *static_cast<const CmdEndRenderPassArgs *>(data);
+    reinterpret_cast<PFN_vkCmdEndRenderPass>(proc)(args.commandBuffer);
+    return VK_SUCCESS;
+}
+
+struct CmdExecuteCommandsArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    commandBufferCount;
+    const VkCommandBuffer*                      pCommandBuffers;
+};
+
+static bool PrepareCmdExecuteCommands(ReplayPrep &prep) {
+    CmdExecuteCommandsArgs &args = prep.NewArgs<CmdExecuteCommandsArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.commandBufferCount) &&
+           prep.Handles(args.pCommandBuffers);
+}
+
+static VkResult InvokeCmdExecuteCommands(PFN_vkVoidFunction proc, void *data) {
+    const CmdExecuteCommandsArgs &args = *static_cast<const CmdExecuteCommandsArgs *>(data);
+    reinterpret_cast<PFN_vkCmdExecuteCommands>(proc)(args.commandBuffer, args.commandBufferCount, args.pCommandBuffers);
+    return VK_SUCCESS;
+}
+
+struct EnumerateInstanceVersionArgs {
+    uint32_t*                                   pApiVersion;
+};
+
+static bool PrepareEnumerateInstanceVersion(ReplayPrep &prep) {
+    EnumerateInstanceVersionArgs &args = prep.NewArgs<EnumerateInstanceVersionArgs>();
+    return prep.Array(args.pApiVersion) &&
+           prep.Result();
+}
+
+static VkResult InvokeEnumerateInstanceVersion(PFN_vkVoidFunction proc, void *data) {
+    const EnumerateInstanceVersionArgs &args = *static_cast<const EnumerateInstanceVersionArgs *>(data);
+    return reinterpret_cast<PFN_vkEnumerateInstanceVersion>(proc)(args.pApiVersion);
+}
+
+struct BindBufferMemory2Args {
+    VkDevice                                    device;
+    uint32_t                                    bindInfoCount;
+    const VkBindBufferMemoryInfo*               pBindInfos;
+};
+
+static bool PrepareBindBufferMemory2(ReplayPrep &prep) {
+    BindBufferMemory2Args &args = prep.NewArgs<BindBufferMemory2Args>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.bindInfoCount) &&
+           prep.Array(args.pBindInfos) &&
+           prep.Result();
+}
+
+static VkResult InvokeBindBufferMemory2(PFN_vkVoidFunction proc, void *data) {
+    const BindBufferMemory2Args &args = *static_cast<const BindBufferMemory2Args *>(data);
+    return reinterpret_cast<PFN_vkBindBufferMemory2>(proc)(args.device, args.bindInfoCount, args.pBindInfos);
+}
+
+struct BindImageMemory2Args {
+    VkDevice                                    device;
+    uint32_t                                    bindInfoCount;
+    const VkBindImageMemoryInfo*                pBindInfos;
+};
+
+static bool PrepareBindImageMemory2(ReplayPrep &prep) {
+    BindImageMemory2Args &args = prep.NewArgs<BindImageMemory2Args>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.bindInfoCount) &&
+           prep.Array(args.pBindInfos) &&
+           prep.Result();
+}
+
+static VkResult InvokeBindImageMemory2(PFN_vkVoidFunction proc, void *data) {
+    const BindImageMemory2Args &args = *static_cast<const BindImageMemory2Args *>(data);
+    return reinterpret_cast<PFN_vkBindImageMemory2>(proc)(args.device, args.bindInfoCount, args.pBindInfos);
+}
+
+struct GetDeviceGroupPeerMemoryFeaturesArgs {
+    VkDevice                                    device;
+    uint32_t                                    heapIndex;
+    uint32_t                                    localDeviceIndex;
+    uint32_t                                    remoteDeviceIndex;
+    VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures;
+};
+
+static bool PrepareGetDeviceGroupPeerMemoryFeatures(ReplayPrep &prep) {
+    GetDeviceGroupPeerMemoryFeaturesArgs &args = prep.NewArgs<GetDeviceGroupPeerMemoryFeaturesArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.heapIndex) &&
+           prep.Value(args.localDeviceIndex) &&
+           prep.Value(args.remoteDeviceIndex) &&
+           prep.Array(args.pPeerMemoryFeatures);
+}
+
+static VkResult InvokeGetDeviceGroupPeerMemoryFeatures(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceGroupPeerMemoryFeaturesArgs &args = *static_cast<const GetDeviceGroupPeerMemoryFeaturesArgs *>(data);
+    reinterpret_cast<PFN_vkGetDeviceGroupPeerMemoryFeatures>(proc)(args.device, args.heapIndex, args.localDeviceIndex, args.remoteDeviceIndex, args.pPeerMemoryFeatures);
+    return VK_SUCCESS;
+}
+
+struct CmdSetDeviceMaskArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    deviceMask;
+};
+
+static bool PrepareCmdSetDeviceMask(ReplayPrep &prep) {
+    CmdSetDeviceMaskArgs &args = prep.NewArgs<CmdSetDeviceMaskArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.deviceMask);
+}
+
+static VkResult InvokeCmdSetDeviceMask(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDeviceMaskArgs &args = *static_cast<const CmdSetDeviceMaskArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDeviceMask>(proc)(args.commandBuffer, args.deviceMask);
+    return VK_SUCCESS;
+}
+
+struct CmdDispatchBaseArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    baseGroupX;
+    uint32_t                                    baseGroupY;
+    uint32_t                                    baseGroupZ;
+    uint32_t                                    groupCountX;
+    uint32_t                                    groupCountY;
+    uint32_t                                    groupCountZ;
+};
+
+static bool PrepareCmdDispatchBase(ReplayPrep &prep) {
+    CmdDispatchBaseArgs &args = prep.NewArgs<CmdDispatchBaseArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.baseGroupX) &&
+           prep.Value(args.baseGroupY) &&
+           prep.Value(args.baseGroupZ) &&
+           prep.Value(args.groupCountX) &&
+           prep.Value(args.groupCountY) &&
+           prep.Value(args.groupCountZ);
+}
+
+static VkResult InvokeCmdDispatchBase(PFN_vkVoidFunction proc, void *data) {
+    const CmdDispatchBaseArgs &args = *static_cast<const CmdDispatchBaseArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDispatchBase>(proc)(args.commandBuffer, args.baseGroupX, args.baseGroupY, args.baseGroupZ, args.groupCountX, args.groupCountY, args.groupCountZ);
+    return VK_SUCCESS;
+}
+
+struct GetImageMemoryRequirements2Args {
+    VkDevice                                    device;
+    const VkImageMemoryRequirementsInfo2*       pInfo;
+    VkMemoryRequirements2*                      pMemoryRequirements;
+};
+
+static bool PrepareGetImageMemoryRequirements2(ReplayPrep &prep) {
+    GetImageMemoryRequirements2Args &args = prep.NewArgs<GetImageMemoryRequirements2Args>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Array(args.pMemoryRequirements);
+}
+
+static VkResult InvokeGetImageMemoryRequirements2(PFN_vkVoidFunction proc, void *data) {
+    const GetImageMemoryRequirements2Args &args = *static_cast<const GetImageMemoryRequirements2Args *>(data);
+    reinterpret_cast<PFN_vkGetImageMemoryRequirements2>(proc)(args.device, args.pInfo, args.pMemoryRequirements);
+    return VK_SUCCESS;
+}
+
+struct GetBufferMemoryRequirements2Args {
+    VkDevice                                    device;
+    const VkBufferMemoryRequirementsInfo2*      pInfo;
+    VkMemoryRequirements2*                      pMemoryRequirements;
+};
+
+static bool PrepareGetBufferMemoryRequirements2(ReplayPrep &prep) {
+    GetBufferMemoryRequirements2Args &args = prep.NewArgs<GetBufferMemoryRequirements2Args>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Array(args.pMemoryRequirements);
+}
+
+static VkResult InvokeGetBufferMemoryRequirements2(PFN_vkVoidFunction proc, void *data) {
+    const GetBufferMemoryRequirements2Args &args = *static_cast<const GetBufferMemoryRequirements2Args *>(data);
+    reinterpret_cast<PFN_vkGetBufferMemoryRequirements2>(proc)(args.device, args.pInfo, args.pMemoryRequirements);
+    return VK_SUCCESS;
+}
+
+struct GetImageSparseMemoryRequirements2Args {
+    VkDevice                                    device;
+    const VkImageSparseMemoryRequirementsInfo2* pInfo;
+    uint32_t*                                   pSparseMemoryRequirementCount;
+    VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements;
+};
+
+static bool PrepareGetImageSparseMemoryRequirements2(ReplayPrep &prep) {
+    GetImageSparseMemoryRequirements2Args &args = prep.NewArgs<GetImageSparseMemoryRequirements2Args>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Array(args.pSparseMemoryRequirementCount) &&
+           prep.Array(args.pSparseMemoryRequirements);
+}
+
+static VkResult InvokeGetImageSparseMemoryRequirements2(PFN_vkVoidFunction proc, void *data) {
+    const GetImageSparseMemoryRequirements2Args &args = *static_cast<const GetImageSparseMemoryRequirements2Args *>(data);
+    reinterpret_cast<PFN_vkGetImageSparseMemoryRequirements2>(proc)(args.device, args.pInfo, args.pSparseMemoryRequirementCount, args.pSparseMemoryRequirements);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceFeatures2Args {
+    VkPhysicalDevice                            physicalDevice;
+    VkPhysicalDeviceFeatures2*                  pFeatures;
+};
+
+static bool PrepareGetPhysicalDeviceFeatures2(ReplayPrep &prep) {
+    GetPhysicalDeviceFeatures2Args &args = prep.NewArgs<GetPhysicalDeviceFeatures2Args>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pFeatures);
+}
+
+static VkResult InvokeGetPhysicalDeviceFeatures2(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceFeatures2Args &args = *static_cast<const GetPhysicalDeviceFeatures2Args *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2>(proc)(args.physicalDevice, args.pFeatures);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceProperties2Args {
+    VkPhysicalDevice                            physicalDevice;
+    VkPhysicalDeviceProperties2*                pProperties;
+};
+
+static bool PrepareGetPhysicalDeviceProperties2(ReplayPrep &prep) {
+    GetPhysicalDeviceProperties2Args &args = prep.NewArgs<GetPhysicalDeviceProperties2Args>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceProperties2(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceProperties2Args &args = *static_cast<const GetPhysicalDeviceProperties2Args *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2>(proc)(args.physicalDevice, args.pProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceFormatProperties2Args {
+    VkPhysicalDevice                            physicalDevice;
+    VkFormat                                    format;
+    VkFormatProperties2*                        pFormatProperties;
+};
+
+static bool PrepareGetPhysicalDeviceFormatProperties2(ReplayPrep &prep) {
+    GetPhysicalDeviceFormatProperties2Args &args = prep.NewArgs<GetPhysicalDeviceFormatProperties2Args>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.format) &&
+           prep.Array(args.pFormatProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceFormatProperties2(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceFormatProperties2Args &args = *static_cast<const GetPhysicalDeviceFormatProperties2Args *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceFormatProperties2>(proc)(args.physicalDevice, args.format, args.pFormatProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceImageFormatProperties2Args {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceImageFormatInfo2*     pImageFormatInfo;
+    VkImageFormatProperties2*                   pImageFormatProperties;
+};
+
+static bool PrepareGetPhysicalDeviceImageFormatProperties2(ReplayPrep &prep) {
+    GetPhysicalDeviceImageFormatProperties2Args &args = prep.NewArgs<GetPhysicalDeviceImageFormatProperties2Args>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pImageFormatInfo) &&
+           prep.Array(args.pImageFormatProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceImageFormatProperties2(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceImageFormatProperties2Args &args = *static_cast<const GetPhysicalDeviceImageFormatProperties2Args *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceImageFormatProperties2>(proc)(args.physicalDevice, args.pImageFormatInfo, args.pImageFormatProperties);
+}
+
+struct GetPhysicalDeviceQueueFamilyProperties2Args {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t*                                   pQueueFamilyPropertyCount;
+    VkQueueFamilyProperties2*                   pQueueFamilyProperties;
+};
+
+static bool PrepareGetPhysicalDeviceQueueFamilyProperties2(ReplayPrep &prep) {
+    GetPhysicalDeviceQueueFamilyProperties2Args &args = prep.NewArgs<GetPhysicalDeviceQueueFamilyProperties2Args>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pQueueFamilyPropertyCount) &&
+           prep.Array(args.pQueueFamilyProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceQueueFamilyProperties2(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceQueueFamilyProperties2Args &args = *static_cast<const GetPhysicalDeviceQueueFamilyProperties2Args *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties2>(proc)(args.physicalDevice, args.pQueueFamilyPropertyCount, args.pQueueFamilyProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceMemoryProperties2Args {
+    VkPhysicalDevice                            physicalDevice;
+    VkPhysicalDeviceMemoryProperties2*          pMemoryProperties;
+};
+
+static bool PrepareGetPhysicalDeviceMemoryProperties2(ReplayPrep &prep) {
+    GetPhysicalDeviceMemoryProperties2Args &args = prep.NewArgs<GetPhysicalDeviceMemoryProperties2Args>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pMemoryProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceMemoryProperties2(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceMemoryProperties2Args &args = *static_cast<const GetPhysicalDeviceMemoryProperties2Args *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties2>(proc)(args.physicalDevice, args.pMemoryProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceSparseImageFormatProperties2Args {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo;
+    uint32_t*                                   pPropertyCount;
+    VkSparseImageFormatProperties2*             pProperties;
+};
+
+static bool PrepareGetPhysicalDeviceSparseImageFormatProperties2(ReplayPrep &prep) {
+    GetPhysicalDeviceSparseImageFormatProperties2Args &args = prep.NewArgs<GetPhysicalDeviceSparseImageFormatProperties2Args>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pFormatInfo) &&
+           prep.Array(args.pPropertyCount) &&
+           prep.Array(args.pProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceSparseImageFormatProperties2(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSparseImageFormatProperties2Args &args = *static_cast<const GetPhysicalDeviceSparseImageFormatProperties2Args *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceSparseImageFormatProperties2>(proc)(args.physicalDevice, args.pFormatInfo, args.pPropertyCount, args.pProperties);
+    return VK_SUCCESS;
+}
+
+struct TrimCommandPoolArgs {
+    VkDevice                                    device;
+    VkCommandPool                               commandPool;
+    VkCommandPoolTrimFlags                      flags;
+};
+
+static bool PrepareTrimCommandPool(ReplayPrep &prep) {
+    TrimCommandPoolArgs &args = prep.NewArgs<TrimCommandPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.commandPool) &&
+           prep.Value(args.flags);
+}
+
+static VkResult InvokeTrimCommandPool(PFN_vkVoidFunction proc, void *data) {
+    const TrimCommandPoolArgs &args = *static_cast<const TrimCommandPoolArgs *>(data);
+    reinterpret_cast<PFN_vkTrimCommandPool>(proc)(args.device, args.commandPool, args.flags);
+    return VK_SUCCESS;
+}
+
+struct GetDeviceQueue2Args {
+    VkDevice                                    device;
+    const VkDeviceQueueInfo2*                   pQueueInfo;
+    VkQueue*                                    pQueue;
+};
+
+static bool PrepareGetDeviceQueue2(ReplayPrep &prep) {
+    GetDeviceQueue2Args &args = prep.NewArgs<GetDeviceQueue2Args>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pQueueInfo) &&
+           prep.NewHandles(args.pQueue);
+}
+
+static VkResult InvokeGetDeviceQueue2(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceQueue2Args &args = *static_cast<const GetDeviceQueue2Args *>(data);
+    reinterpret_cast<PFN_vkGetDeviceQueue2>(proc)(args.device, args.pQueueInfo, args.pQueue);
+    return VK_SUCCESS;
+}
+
+struct CreateSamplerYcbcrConversionArgs {
+    VkDevice                                    device;
+    const VkSamplerYcbcrConversionCreateInfo*   pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkSamplerYcbcrConversion*                   pYcbcrConversion;
+};
+
+static bool PrepareCreateSamplerYcbcrConversion(ReplayPrep &prep) {
+    CreateSamplerYcbcrConversionArgs &args = prep.NewArgs<CreateSamplerYcbcrConversionArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pYcbcrConversion) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateSamplerYcbcrConversion(PFN_vkVoidFunction proc, void *data) {
+    const CreateSamplerYcbcrConversionArgs &args = *static_cast<const CreateSamplerYcbcrConversionArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateSamplerYcbcrConversion>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pYcbcrConversion);
+}
+
+struct DestroySamplerYcbcrConversionArgs {
+    VkDevice                                    device;
+    VkSamplerYcbcrConversion                    ycbcrConversion;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroySamplerYcbcrConversion(ReplayPrep &prep) {
+    DestroySamplerYcbcrConversionArgs &args = prep.NewArgs<DestroySamplerYcbcrConversionArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.ycbcrConversion) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroySamplerYcbcrConversion(PFN_vkVoidFunction proc, void *data) {
+    const DestroySamplerYcbcrConversionArgs &args = *static_cast<const DestroySamplerYcbcrConversionArgs *>(data);
+    reinterpret_cast<PFN_vkDestroySamplerYcbcrConversion>(proc)(args.device, args.ycbcrConversion, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreateDescriptorUpdateTemplateArgs {
+    VkDevice                                    device;
+    const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate;
+};
+
+static bool PrepareCreateDescriptorUpdateTemplate(ReplayPrep &prep) {
+    CreateDescriptorUpdateTemplateArgs &args = prep.NewArgs<CreateDescriptorUpdateTemplateArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pDescriptorUpdateTemplate) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateDescriptorUpdateTemplate(PFN_vkVoidFunction proc, void *data) {
+    const CreateDescriptorUpdateTemplateArgs &args = *static_cast<const CreateDescriptorUpdateTemplateArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateDescriptorUpdateTemplate>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pDescriptorUpdateTemplate);
+}
+
+struct DestroyDescriptorUpdateTemplateArgs {
+    VkDevice                                    device;
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyDescriptorUpdateTemplate(ReplayPrep &prep) {
+    DestroyDescriptorUpdateTemplateArgs &args = prep.NewArgs<DestroyDescriptorUpdateTemplateArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.descriptorUpdateTemplate) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyDescriptorUpdateTemplate(PFN_vkVoidFunction proc, void *data) {
+    const DestroyDescriptorUpdateTemplateArgs &args = *static_cast<const DestroyDescriptorUpdateTemplateArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyDescriptorUpdateTemplate>(proc)(args.device, args.descriptorUpdateTemplate, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct UpdateDescriptorSetWithTemplateArgs {
+    VkDevice                                    device;
+    VkDescriptorSet                             descriptorSet;
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate;
+    const void*                                 pData;
+};
+
+static bool PrepareUpdateDescriptorSetWithTemplate(ReplayPrep &prep) {
+    UpdateDescriptorSetWithTemplateArgs &args = prep.NewArgs<UpdateDescriptorSetWithTemplateArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.descriptorSet) &&
+           prep.Handle(args.descriptorUpdateTemplate) &&
+           prep.Address(args.pData);
+}
+
+static VkResult InvokeUpdateDescriptorSetWithTemplate(PFN_vkVoidFunction proc, void *data) {
+    const UpdateDescriptorSetWithTemplateArgs &args = *static_cast<const UpdateDescriptorSetWithTemplateArgs *>(data);
+    reinterpret_cast<PFN_vkUpdateDescriptorSetWithTemplate>(proc)(args.device, args.descriptorSet, args.descriptorUpdateTemplate, args.pData);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceExternalBufferPropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceExternalBufferInfo*   pExternalBufferInfo;
+    VkExternalBufferProperties*                 pExternalBufferProperties;
+};
+
+static bool PrepareGetPhysicalDeviceExternalBufferProperties(ReplayPrep &prep) {
+    GetPhysicalDeviceExternalBufferPropertiesArgs &args = prep.NewArgs<GetPhysicalDeviceExternalBufferPropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pExternalBufferInfo) &&
+           prep.Array(args.pExternalBufferProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceExternalBufferProperties(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceExternalBufferPropertiesArgs &args = *static_cast<const GetPhysicalDeviceExternalBufferPropertiesArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceExternalBufferProperties>(proc)(args.physicalDevice, args.pExternalBufferInfo, args.pExternalBufferProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceExternalFencePropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceExternalFenceInfo*    pExternalFenceInfo;
+    VkExternalFenceProperties*                  pExternalFenceProperties;
+};
+
+static bool PrepareGetPhysicalDeviceExternalFenceProperties(ReplayPrep &prep) {
+    GetPhysicalDeviceExternalFencePropertiesArgs &args = prep.NewArgs<GetPhysicalDeviceExternalFencePropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pExternalFenceInfo) &&
+           prep.Array(args.pExternalFenceProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceExternalFenceProperties(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceExternalFencePropertiesArgs &args = *static_cast<const GetPhysicalDeviceExternalFencePropertiesArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceExternalFenceProperties>(proc)(args.physicalDevice, args.pExternalFenceInfo, args.pExternalFenceProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceExternalSemaphorePropertiesArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo;
+    VkExternalSemaphoreProperties*              pExternalSemaphoreProperties;
+};
+
+static bool PrepareGetPhysicalDeviceExternalSemaphoreProperties(ReplayPrep &prep) {
+    GetPhysicalDeviceExternalSemaphorePropertiesArgs &args = prep.NewArgs<GetPhysicalDeviceExternalSemaphorePropertiesArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pExternalSemaphoreInfo) &&
+           prep.Array(args.pExternalSemaphoreProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceExternalSemaphoreProperties(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceExternalSemaphorePropertiesArgs &args = *static_cast<const GetPhysicalDeviceExternalSemaphorePropertiesArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceExternalSemaphoreProperties>(proc)(args.physicalDevice, args.pExternalSemaphoreInfo, args.pExternalSemaphoreProperties);
+    return VK_SUCCESS;
+}
+
+struct GetDescriptorSetLayoutSupportArgs {
+    VkDevice                                    device;
+    const VkDescriptorSetLayoutCreateInfo*      pCreateInfo;
+    VkDescriptorSetLayoutSupport*               pSupport;
+};
+
+static bool PrepareGetDescriptorSetLayoutSupport(ReplayPrep &prep) {
+    GetDescriptorSetLayoutSupportArgs &args = prep.NewArgs<GetDescriptorSetLayoutSupportArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Array(args.pSupport);
+}
+
+static VkResult InvokeGetDescriptorSetLayoutSupport(PFN_vkVoidFunction proc, void *data) {
+    const GetDescriptorSetLayoutSupportArgs &args = *static_cast<const GetDescriptorSetLayoutSupportArgs *>(data);
+    reinterpret_cast<PFN_vkGetDescriptorSetLayoutSupport>(proc)(args.device, args.pCreateInfo, args.pSupport);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawIndirectCountArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawIndirectCount(ReplayPrep &prep) {
+    CmdDrawIndirectCountArgs &args = prep.NewArgs<CmdDrawIndirectCountArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Handle(args.countBuffer) &&
+           prep.Value(args.countBufferOffset) &&
+           prep.Value(args.maxDrawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawIndirectCount(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndirectCountArgs &args = *static_cast<const CmdDrawIndirectCountArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndirectCount>(proc)(args.commandBuffer, args.buffer, args.offset, args.countBuffer, args.countBufferOffset, args.maxDrawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawIndexedIndirectCountArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawIndexedIndirectCount(ReplayPrep &prep) {
+    CmdDrawIndexedIndirectCountArgs &args = prep.NewArgs<CmdDrawIndexedIndirectCountArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Handle(args.countBuffer) &&
+           prep.Value(args.countBufferOffset) &&
+           prep.Value(args.maxDrawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawIndexedIndirectCount(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndexedIndirectCountArgs &args = *static_cast<const CmdDrawIndexedIndirectCountArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCount>(proc)(args.commandBuffer, args.buffer, args.offset, args.countBuffer, args.countBufferOffset, args.maxDrawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct CreateRenderPass2Args {
+    VkDevice                                    device;
+    const VkRenderPassCreateInfo2*              pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkRenderPass*                               pRenderPass;
+};
+
+static bool PrepareCreateRenderPass2(ReplayPrep &prep) {
+    CreateRenderPass2Args &args = prep.NewArgs<CreateRenderPass2Args>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pRenderPass) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateRenderPass2(PFN_vkVoidFunction proc, void *data) {
+    const CreateRenderPass2Args &args = *static_cast<const CreateRenderPass2Args *>(data);
+    return reinterpret_cast<PFN_vkCreateRenderPass2>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pRenderPass);
+}
+
+struct CmdBeginRenderPass2Args {
+    VkCommandBuffer                             commandBuffer;
+    const VkRenderPassBeginInfo*                pRenderPassBegin;
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo;
+};
+
+static bool PrepareCmdBeginRenderPass2(ReplayPrep &prep) {
+    CmdBeginRenderPass2Args &args = prep.NewArgs<CmdBeginRenderPass2Args>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pRenderPassBegin) &&
+           prep.Array(args.pSubpassBeginInfo);
+}
+
+static VkResult InvokeCmdBeginRenderPass2(PFN_vkVoidFunction proc, void *data) {
+    const CmdBeginRenderPass2Args &args = *static_cast<const CmdBeginRenderPass2Args *>(data);
+    reinterpret_cast<PFN_vkCmdBeginRenderPass2>(proc)(args.commandBuffer, args.pRenderPassBegin, args.pSubpassBeginInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdNextSubpass2Args {
+    VkCommandBuffer                             commandBuffer;
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo;
+    const VkSubpassEndInfo*                     pSubpassEndInfo;
+};
+
+static bool PrepareCmdNextSubpass2(ReplayPrep &prep) {
+    CmdNextSubpass2Args &args = prep.NewArgs<CmdNextSubpass2Args>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pSubpassBeginInfo) &&
+           prep.Array(args.pSubpassEndInfo);
+}
+
+static VkResult InvokeCmdNextSubpass2(PFN_vkVoidFunction proc, void *data) {
+    const CmdNextSubpass2Args &args = *static_cast<const CmdNextSubpass2Args *>(data);
+    reinterpret_cast<PFN_vkCmdNextSubpass2>(proc)(args.commandBuffer, args.pSubpassBeginInfo, args.pSubpassEndInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdEndRenderPass2Args {
+    VkCommandBuffer                             commandBuffer;
+    const VkSubpassEndInfo*                     pSubpassEndInfo;
+};
+
+static bool PrepareCmdEndRenderPass2(ReplayPrep &prep) {
+    CmdEndRenderPass2Args &args = prep.NewArgs<CmdEndRenderPass2Args>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pSubpassEndInfo);
+}
+
+static VkResult InvokeCmdEndRenderPass2(PFN_vkVoidFunction proc, void *data) {
+    const CmdEndRenderPass2Args &args = *static_cast<const CmdEndRenderPass2Args *>(data);
+    reinterpret_cast<PFN_vkCmdEndRenderPass2>(proc)(args.commandBuffer, args.pSubpassEndInfo);
+    return VK_SUCCESS;
+}
+
+struct ResetQueryPoolArgs {
+    VkDevice                                    device;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+    uint32_t                                    queryCount;
+};
+
+static bool PrepareResetQueryPool(ReplayPrep &prep) {
+    ResetQueryPoolArgs &args = prep.NewArgs<ResetQueryPoolArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.firstQuery) &&
+           prep.Value(args.queryCount);
+}
+
+static VkResult InvokeResetQueryPool(PFN_vkVoidFunction proc, void *data) {
+    const ResetQueryPoolArgs &args = *static_cast<const ResetQueryPoolArgs *>(data);
+    reinterpret_cast<PFN_vkResetQueryPool>(proc)(args.device, args.queryPool, args.firstQuery, args.queryCount);
+    return VK_SUCCESS;
+}
+
+struct GetSemaphoreCounterValueArgs {
+    VkDevice                                    device;
+    VkSemaphore                                 semaphore;
+    uint64_t*                                   pValue;
+};
+
+static bool PrepareGetSemaphoreCounterValue(ReplayPrep &prep) {
+    GetSemaphoreCounterValueArgs &args = prep.NewArgs<GetSemaphoreCounterValueArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.semaphore) &&
+           prep.Array(args.pValue) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetSemaphoreCounterValue(PFN_vkVoidFunction proc, void *data) {
+    const GetSemaphoreCounterValueArgs &args = *static_cast<const GetSemaphoreCounterValueArgs *>(data);
+    return reinterpret_cast<PFN_vkGetSemaphoreCounterValue>(proc)(args.device, args.semaphore, args.pValue);
+}
+
+struct WaitSemaphoresArgs {
+    VkDevice                                    device;
+    const VkSemaphoreWaitInfo*                  pWaitInfo;
+    uint64_t                                    timeout;
+};
+
+static bool PrepareWaitSemaphores(ReplayPrep &prep) {
+    WaitSemaphoresArgs &args = prep.NewArgs<WaitSemaphoresArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pWaitInfo) &&
+           prep.Value(args.timeout) &&
+           prep.Result();
+}
+
+static VkResult InvokeWaitSemaphores(PFN_vkVoidFunction proc, void *data) {
+    const WaitSemaphoresArgs &args = *static_cast<const WaitSemaphoresArgs *>(data);
+    return reinterpret_cast<PFN_vkWaitSemaphores>(proc)(args.device, args.pWaitInfo, args.timeout);
+}
+
+struct SignalSemaphoreArgs {
+    VkDevice                                    device;
+    const VkSemaphoreSignalInfo*                pSignalInfo;
+};
+
+static bool PrepareSignalSemaphore(ReplayPrep &prep) {
+    SignalSemaphoreArgs &args = prep.NewArgs<SignalSemaphoreArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pSignalInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeSignalSemaphore(PFN_vkVoidFunction proc, void *data) {
+    const SignalSemaphoreArgs &args = *static_cast<const SignalSemaphoreArgs *>(data);
+    return reinterpret_cast<PFN_vkSignalSemaphore>(proc)(args.device, args.pSignalInfo);
+}
+
+struct GetBufferDeviceAddressArgs {
+    VkDevice                                    device;
+    const VkBufferDeviceAddressInfo*            pInfo;
+};
+
+static bool PrepareGetBufferDeviceAddress(ReplayPrep &prep) {
+    GetBufferDeviceAddressArgs &args = prep.NewArgs<GetBufferDeviceAddressArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetBufferDeviceAddress(PFN_vkVoidFunction proc, void *data) {
+    const GetBufferDeviceAddressArgs &args = *static_cast<const GetBufferDeviceAddressArgs *>(data);
+    reinterpret_cast<PFN_vkGetBufferDeviceAddress>(proc)(args.device, args.pInfo);
+    return VK_SUCCESS;
+}
+
+struct GetBufferOpaqueCaptureAddressArgs {
+    VkDevice                                    device;
+    const VkBufferDeviceAddressInfo*            pInfo;
+};
+
+static bool PrepareGetBufferOpaqueCaptureAddress(ReplayPrep &prep) {
+    GetBufferOpaqueCaptureAddressArgs &args = prep.NewArgs<GetBufferOpaqueCaptureAddressArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetBufferOpaqueCaptureAddress(PFN_vkVoidFunction proc, void *data) {
+    const GetBufferOpaqueCaptureAddressArgs &args = *static_cast<const GetBufferOpaqueCaptureAddressArgs *>(data);
+    reinterpret_cast<PFN_vkGetBufferOpaqueCaptureAddress>(proc)(args.device, args.pInfo);
+    return VK_SUCCESS;
+}
+
+struct GetDeviceMemoryOpaqueCaptureAddressArgs {
+    VkDevice                                    device;
+    const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo;
+};
+
+static bool PrepareGetDeviceMemoryOpaqueCaptureAddress(ReplayPrep &prep) {
+    GetDeviceMemoryOpaqueCaptureAddressArgs &args = prep.NewArgs<GetDeviceMemoryOpaqueCaptureAddressArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetDeviceMemoryOpaqueCaptureAddress(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceMemoryOpaqueCaptureAddressArgs &args = *static_cast<const GetDeviceMemoryOpaqueCaptureAddressArgs *>(data);
+    reinterpret_cast<PFN_vkGetDeviceMemoryOpaqueCaptureAddress>(proc)(args.device, args.pInfo);
+    return VK_SUCCESS;
+}
+
+struct DestroySurfaceKHRArgs {
+    VkInstance                                  instance;
+    VkSurfaceKHR                                surface;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroySurfaceKHR(ReplayPrep &prep) {
+    DestroySurfaceKHRArgs &args = prep.NewArgs<DestroySurfaceKHRArgs>();
+    return prep.Handle(args.instance) &&
+           prep.Handle(args.surface) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroySurfaceKHR(PFN_vkVoidFunction proc, void *data) {
+    const DestroySurfaceKHRArgs &args = *static_cast<const DestroySurfaceKHRArgs *>(data);
+    reinterpret_cast<PFN_vkDestroySurfaceKHR>(proc)(args.instance, args.surface, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceSurfaceSupportKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    queueFamilyIndex;
+    VkSurfaceKHR                                surface;
+    VkBool32*                                   pSupported;
+};
+
+static bool PrepareGetPhysicalDeviceSurfaceSupportKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceSurfaceSupportKHRArgs &args = prep.NewArgs<GetPhysicalDeviceSurfaceSupportKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.queueFamilyIndex) &&
+           prep.Handle(args.surface) &&
+           prep.Array(args.pSupported) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceSurfaceSupportKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSurfaceSupportKHRArgs &args = *static_cast<const GetPhysicalDeviceSurfaceSupportKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceSupportKHR>(proc)(args.physicalDevice, args.queueFamilyIndex, args.surface, args.pSupported);
+}
+
+struct GetPhysicalDeviceSurfaceCapabilitiesKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkSurfaceKHR                                surface;
+    VkSurfaceCapabilitiesKHR*                   pSurfaceCapabilities;
+};
+
+static bool PrepareGetPhysicalDeviceSurfaceCapabilitiesKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceSurfaceCapabilitiesKHRArgs &args = prep.NewArgs<GetPhysicalDeviceSurfaceCapabilitiesKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Handle(args.surface) &&
+           prep.Array(args.pSurfaceCapabilities) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceSurfaceCapabilitiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSurfaceCapabilitiesKHRArgs &args = *static_cast<const GetPhysicalDeviceSurfaceCapabilitiesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR>(proc)(args.physicalDevice, args.surface, args.pSurfaceCapabilities);
+}
+
+struct GetPhysicalDeviceSurfaceFormatsKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkSurfaceKHR                                surface;
+    uint32_t*                                   pSurfaceFormatCount;
+    VkSurfaceFormatKHR*                         pSurfaceFormats;
+};
+
+static bool PrepareGetPhysicalDeviceSurfaceFormatsKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceSurfaceFormatsKHRArgs &args = prep.NewArgs<GetPhysicalDeviceSurfaceFormatsKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Handle(args.surface) &&
+           prep.Array(args.pSurfaceFormatCount) &&
+           prep.Array(args.pSurfaceFormats) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceSurfaceFormatsKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSurfaceFormatsKHRArgs &args = *static_cast<const GetPhysicalDeviceSurfaceFormatsKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceFormatsKHR>(proc)(args.physicalDevice, args.surface, args.pSurfaceFormatCount, args.pSurfaceFormats);
+}
+
+struct GetPhysicalDeviceSurfacePresentModesKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkSurfaceKHR                                surface;
+    uint32_t*                                   pPresentModeCount;
+    VkPresentModeKHR*                           pPresentModes;
+};
+
+static bool PrepareGetPhysicalDeviceSurfacePresentModesKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceSurfacePresentModesKHRArgs &args = prep.NewArgs<GetPhysicalDeviceSurfacePresentModesKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Handle(args.surface) &&
+           prep.Array(args.pPresentModeCount) &&
+           prep.Array(args.pPresentModes) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceSurfacePresentModesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSurfacePresentModesKHRArgs &args = *static_cast<const GetPhysicalDeviceSurfacePresentModesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceSurfacePresentModesKHR>(proc)(args.physicalDevice, args.surface, args.pPresentModeCount, args.pPresentModes);
+}
+
+struct CreateSwapchainKHRArgs {
+    VkDevice                                    device;
+    const VkSwapchainCreateInfoKHR*             pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkSwapchainKHR*                             pSwapchain;
+};
+
+static bool PrepareCreateSwapchainKHR(ReplayPrep &prep) {
+    CreateSwapchainKHRArgs &args = prep.NewArgs<CreateSwapchainKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pSwapchain) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateSwapchainKHR(PFN_vkVoidFunction proc, void *data) {
+    const CreateSwapchainKHRArgs &args = *static_cast<const CreateSwapchainKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateSwapchainKHR>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pSwapchain);
+}
+
+struct DestroySwapchainKHRArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapchain;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroySwapchainKHR(ReplayPrep &prep) {
+    DestroySwapchainKHRArgs &args = prep.NewArgs<DestroySwapchainKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapchain) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroySwapchainKHR(PFN_vkVoidFunction proc, void *data) {
+    const DestroySwapchainKHRArgs &args = *static_cast<const DestroySwapchainKHRArgs *>(data);
+    reinterpret_cast<PFN_vkDestroySwapchainKHR>(proc)(args.device, args.swapchain, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct GetSwapchainImagesKHRArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapchain;
+    uint32_t*                                   pSwapchainImageCount;
+    VkImage*                                    pSwapchainImages;
+};
+
+static bool PrepareGetSwapchainImagesKHR(ReplayPrep &prep) {
+    GetSwapchainImagesKHRArgs &args = prep.NewArgs<GetSwapchainImagesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapchain) &&
+           prep.Array(args.pSwapchainImageCount) &&
+           prep.NewHandles(args.pSwapchainImages) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetSwapchainImagesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetSwapchainImagesKHRArgs &args = *static_cast<const GetSwapchainImagesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetSwapchainImagesKHR>(proc)(args.device, args.swapchain, args.pSwapchainImageCount, args.pSwapchainImages);
+}
+
+struct AcquireNextImageKHRArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapchain;
+    uint64_t                                    timeout;
+    VkSemaphore                                 semaphore;
+    VkFence                                     fence;
+    uint32_t*                                   pImageIndex;
+};
+
+static bool PrepareAcquireNextImageKHR(ReplayPrep &prep) {
+    AcquireNextImageKHRArgs &args = prep.NewArgs<AcquireNextImageKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapchain) &&
+           prep.Value(args.timeout) &&
+           prep.Handle(args.semaphore) &&
+           prep.Handle(args.fence) &&
+           prep.Array(args.pImageIndex) &&
+           prep.Result();
+}
+
+static VkResult InvokeAcquireNextImageKHR(PFN_vkVoidFunction proc, void *data) {
+    const AcquireNextImageKHRArgs &args = *static_cast<const AcquireNextImageKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkAcquireNextImageKHR>(proc)(args.device, args.swapchain, args.timeout, args.semaphore, args.fence, args.pImageIndex);
+}
+
+struct QueuePresentKHRArgs {
+    VkQueue                                     queue;
+    const VkPresentInfoKHR*                     pPresentInfo;
+};
+
+static bool PrepareQueuePresentKHR(ReplayPrep &prep) {
+    QueuePresentKHRArgs &args = prep.NewArgs<QueuePresentKHRArgs>();
+    return prep.Handle(args.queue) &&
+           prep.Array(args.pPresentInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeQueuePresentKHR(PFN_vkVoidFunction proc, void *data) {
+    const QueuePresentKHRArgs &args = *static_cast<const QueuePresentKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkQueuePresentKHR>(proc)(args.queue, args.pPresentInfo);
+}
+
+struct GetDeviceGroupPresentCapabilitiesKHRArgs {
+    VkDevice                                    device;
+    VkDeviceGroupPresentCapabilitiesKHR*        pDeviceGroupPresentCapabilities;
+};
+
+static bool PrepareGetDeviceGroupPresentCapabilitiesKHR(ReplayPrep &prep) {
+    GetDeviceGroupPresentCapabilitiesKHRArgs &args = prep.NewArgs<GetDeviceGroupPresentCapabilitiesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pDeviceGroupPresentCapabilities) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetDeviceGroupPresentCapabilitiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceGroupPresentCapabilitiesKHRArgs &args = *static_cast<const GetDeviceGroupPresentCapabilitiesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetDeviceGroupPresentCapabilitiesKHR>(proc)(args.device, args.pDeviceGroupPresentCapabilities);
+}
+
+struct GetDeviceGroupSurfacePresentModesKHRArgs {
+    VkDevice                                    device;
+    VkSurfaceKHR                                surface;
+    VkDeviceGroupPresentModeFlagsKHR*           pModes;
+};
+
+static bool PrepareGetDeviceGroupSurfacePresentModesKHR(ReplayPrep &prep) {
+    GetDeviceGroupSurfacePresentModesKHRArgs &args = prep.NewArgs<GetDeviceGroupSurfacePresentModesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.surface) &&
+           prep.Array(args.pModes) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetDeviceGroupSurfacePresentModesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceGroupSurfacePresentModesKHRArgs &args = *static_cast<const GetDeviceGroupSurfacePresentModesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetDeviceGroupSurfacePresentModesKHR>(proc)(args.device, args.surface, args.pModes);
+}
+
+struct GetPhysicalDevicePresentRectanglesKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkSurfaceKHR                                surface;
+    uint32_t*                                   pRectCount;
+    VkRect2D*                                   pRects;
+};
+
+static bool PrepareGetPhysicalDevicePresentRectanglesKHR(ReplayPrep &prep) {
+    GetPhysicalDevicePresentRectanglesKHRArgs &args = prep.NewArgs<GetPhysicalDevicePresentRectanglesKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Handle(args.surface) &&
+           prep.Array(args.pRectCount) &&
+           prep.Array(args.pRects) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDevicePresentRectanglesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDevicePresentRectanglesKHRArgs &args = *static_cast<const GetPhysicalDevicePresentRectanglesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDevicePresentRectanglesKHR>(proc)(args.physicalDevice, args.surface, args.pRectCount, args.pRects);
+}
+
+struct AcquireNextImage2KHRArgs {
+    VkDevice                                    device;
+    const VkAcquireNextImageInfoKHR*            pAcquireInfo;
+    uint32_t*                                   pImageIndex;
+};
+
+static bool PrepareAcquireNextImage2KHR(ReplayPrep &prep) {
+    AcquireNextImage2KHRArgs &args = prep.NewArgs<AcquireNextImage2KHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pAcquireInfo) &&
+           prep.Array(args.pImageIndex) &&
+           prep.Result();
+}
+
+static VkResult InvokeAcquireNextImage2KHR(PFN_vkVoidFunction proc, void *data) {
+    const AcquireNextImage2KHRArgs &args = *static_cast<const AcquireNextImage2KHRArgs *>(data);
+    return reinterpret_cast<PFN_vkAcquireNextImage2KHR>(proc)(args.device, args.pAcquireInfo, args.pImageIndex);
+}
+
+struct GetDisplayPlaneSupportedDisplaysKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    planeIndex;
+    uint32_t*                                   pDisplayCount;
+    VkDisplayKHR*                               pDisplays;
+};
+
+static bool PrepareGetDisplayPlaneSupportedDisplaysKHR(ReplayPrep &prep) {
+    GetDisplayPlaneSupportedDisplaysKHRArgs &args = prep.NewArgs<GetDisplayPlaneSupportedDisplaysKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.planeIndex) &&
+           prep.Array(args.pDisplayCount) &&
+           prep.NewHandles(args.pDisplays) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetDisplayPlaneSupportedDisplaysKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDisplayPlaneSupportedDisplaysKHRArgs &args = *static_cast<const GetDisplayPlaneSupportedDisplaysKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetDisplayPlaneSupportedDisplaysKHR>(proc)(args.physicalDevice, args.planeIndex, args.pDisplayCount, args.pDisplays);
+}
+
+struct CreateDisplayModeKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkDisplayKHR                                display;
+    const VkDisplayModeCreateInfoKHR*           pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkDisplayModeKHR*                           pMode;
+};
+
+static bool PrepareCreateDisplayModeKHR(ReplayPrep &prep) {
+    CreateDisplayModeKHRArgs &args = prep.NewArgs<CreateDisplayModeKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Handle(args.display) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pMode) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateDisplayModeKHR(PFN_vkVoidFunction proc, void *data) {
+    const CreateDisplayModeKHRArgs &args = *static_cast<const CreateDisplayModeKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateDisplayModeKHR>(proc)(args.physicalDevice, args.display, args.pCreateInfo, args.pAllocator, args.pMode);
+}
+
+struct GetDisplayPlaneCapabilitiesKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkDisplayModeKHR                            mode;
+    uint32_t                                    planeIndex;
+    VkDisplayPlaneCapabilitiesKHR*              pCapabilities;
+};
+
+static bool PrepareGetDisplayPlaneCapabilitiesKHR(ReplayPrep &prep) {
+    GetDisplayPlaneCapabilitiesKHRArgs &args = prep.NewArgs<GetDisplayPlaneCapabilitiesKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Handle(args.mode) &&
+           prep.Value(args.planeIndex) &&
+           prep.Array(args.pCapabilities) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetDisplayPlaneCapabilitiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDisplayPlaneCapabilitiesKHRArgs &args = *static_cast<const GetDisplayPlaneCapabilitiesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetDisplayPlaneCapabilitiesKHR>(proc)(args.physicalDevice, args.mode, args.planeIndex, args.pCapabilities);
+}
+
+struct CreateDisplayPlaneSurfaceKHRArgs {
+    VkInstance                                  instance;
+    const VkDisplaySurfaceCreateInfoKHR*        pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkSurfaceKHR*                               pSurface;
+};
+
+static bool PrepareCreateDisplayPlaneSurfaceKHR(ReplayPrep &prep) {
+    CreateDisplayPlaneSurfaceKHRArgs &args = prep.NewArgs<CreateDisplayPlaneSurfaceKHRArgs>();
+    return prep.Handle(args.instance) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pSurface) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateDisplayPlaneSurfaceKHR(PFN_vkVoidFunction proc, void *data) {
+    const CreateDisplayPlaneSurfaceKHRArgs &args = *static_cast<const CreateDisplayPlaneSurfaceKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateDisplayPlaneSurfaceKHR>(proc)(args.instance, args.pCreateInfo, args.pAllocator, args.pSurface);
+}
+
+struct CreateSharedSwapchainsKHRArgs {
+    VkDevice                                    device;
+    uint32_t                                    swapchainCount;
+    const VkSwapchainCreateInfoKHR*             pCreateInfos;
+    const VkAllocationCallbacks*                pAllocator;
+    VkSwapchainKHR*                             pSwapchains;
+};
+
+static bool PrepareCreateSharedSwapchainsKHR(ReplayPrep &prep) {
+    CreateSharedSwapchainsKHRArgs &args = prep.NewArgs<CreateSharedSwapchainsKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.swapchainCount) &&
+           prep.Array(args.pCreateInfos) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pSwapchains) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateSharedSwapchainsKHR(PFN_vkVoidFunction proc, void *data) {
+    const CreateSharedSwapchainsKHRArgs &args = *static_cast<const CreateSharedSwapchainsKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateSharedSwapchainsKHR>(proc)(args.device, args.swapchainCount, args.pCreateInfos, args.pAllocator, args.pSwapchains);
+}
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+struct GetPhysicalDeviceXlibPresentationSupportKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    queueFamilyIndex;
+    Display*                                    dpy;
+    VisualID                                    visualID;
+};
+
+static bool PrepareGetPhysicalDeviceXlibPresentationSupportKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceXlibPresentationSupportKHRArgs &args = prep.NewArgs<GetPhysicalDeviceXlibPresentationSupportKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.queueFamilyIndex) &&
+           prep.Address(args.dpy) &&
+           prep.Value(args.visualID) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetPhysicalDeviceXlibPresentationSupportKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceXlibPresentationSupportKHRArgs &args = *static_cast<const GetPhysicalDeviceXlibPresentationSupportKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR>(proc)(args.physicalDevice, args.queueFamilyIndex, args.dpy, args.visualID);
+    return VK_SUCCESS;
+}
+#endif
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+struct GetPhysicalDeviceXcbPresentationSupportKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    queueFamilyIndex;
+    xcb_connection_t*                           connection;
+    xcb_visualid_t                              visual_id;
+};
+
+static bool PrepareGetPhysicalDeviceXcbPresentationSupportKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceXcbPresentationSupportKHRArgs &args = prep.NewArgs<GetPhysicalDeviceXcbPresentationSupportKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.queueFamilyIndex) &&
+           prep.Address(args.connection) &&
+           prep.Value(args.visual_id) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetPhysicalDeviceXcbPresentationSupportKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceXcbPresentationSupportKHRArgs &args = *static_cast<const GetPhysicalDeviceXcbPresentationSupportKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR>(proc)(args.physicalDevice, args.queueFamilyIndex, args.connection, args.visual_id);
+    return VK_SUCCESS;
+}
+#endif
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+struct GetPhysicalDeviceWaylandPresentationSupportKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    queueFamilyIndex;
+    struct wl_display*                          display;
+};
+
+static bool PrepareGetPhysicalDeviceWaylandPresentationSupportKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceWaylandPresentationSupportKHRArgs &args = prep.NewArgs<GetPhysicalDeviceWaylandPresentationSupportKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.queueFamilyIndex) &&
+           prep.Address(args.display) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetPhysicalDeviceWaylandPresentationSupportKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceWaylandPresentationSupportKHRArgs &args = *static_cast<const GetPhysicalDeviceWaylandPresentationSupportKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR>(proc)(args.physicalDevice, args.queueFamilyIndex, args.display);
+    return VK_SUCCESS;
+}
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+struct GetPhysicalDeviceWin32PresentationSupportKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    queueFamilyIndex;
+};
+
+static bool PrepareGetPhysicalDeviceWin32PresentationSupportKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceWin32PresentationSupportKHRArgs &args = prep.NewArgs<GetPhysicalDeviceWin32PresentationSupportKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.queueFamilyIndex) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetPhysicalDeviceWin32PresentationSupportKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceWin32PresentationSupportKHRArgs &args = *static_cast<const GetPhysicalDeviceWin32PresentationSupportKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR>(proc)(args.physicalDevice, args.queueFamilyIndex);
+    return VK_SUCCESS;
+}
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+struct GetPhysicalDeviceVideoCapabilitiesKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkVideoProfileKHR*                    pVideoProfile;
+    VkVideoCapabilitiesKHR*                     pCapabilities;
+};
+
+static bool PrepareGetPhysicalDeviceVideoCapabilitiesKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceVideoCapabilitiesKHRArgs &args = prep.NewArgs<GetPhysicalDeviceVideoCapabilitiesKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pVideoProfile) &&
+           prep.Array(args.pCapabilities) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceVideoCapabilitiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceVideoCapabilitiesKHRArgs &args = *static_cast<const GetPhysicalDeviceVideoCapabilitiesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceVideoCapabilitiesKHR>(proc)(args.physicalDevice, args.pVideoProfile, args.pCapabilities);
+}
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+struct DestroyVideoSessionKHRArgs {
+    VkDevice                                    device;
+    VkVideoSessionKHR                           videoSession;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyVideoSessionKHR(ReplayPrep &prep) {
+    DestroyVideoSessionKHRArgs &args = prep.NewArgs<DestroyVideoSessionKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.videoSession) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyVideoSessionKHR(PFN_vkVoidFunction proc, void *data) {
+    const DestroyVideoSessionKHRArgs &args = *static_cast<const DestroyVideoSessionKHRArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyVideoSessionKHR>(proc)(args.device, args.videoSession, args.pAllocator);
+    return VK_SUCCESS;
+}
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+struct UpdateVideoSessionParametersKHRArgs {
+    VkDevice                                    device;
+    VkVideoSessionParametersKHR                 videoSessionParameters;
+    const VkVideoSessionParametersUpdateInfoKHR* pUpdateInfo;
+};
+
+static bool PrepareUpdateVideoSessionParametersKHR(ReplayPrep &prep) {
+    UpdateVideoSessionParametersKHRArgs &args = prep.NewArgs<UpdateVideoSessionParametersKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.videoSessionParameters) &&
+           prep.Array(args.pUpdateInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeUpdateVideoSessionParametersKHR(PFN_vkVoidFunction proc, void *data) {
+    const UpdateVideoSessionParametersKHRArgs &args = *static_cast<const UpdateVideoSessionParametersKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkUpdateVideoSessionParametersKHR>(proc)(args.device, args.videoSessionParameters, args.pUpdateInfo);
+}
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+struct DestroyVideoSessionParametersKHRArgs {
+    VkDevice                                    device;
+    VkVideoSessionParametersKHR                 videoSessionParameters;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyVideoSessionParametersKHR(ReplayPrep &prep) {
+    DestroyVideoSessionParametersKHRArgs &args = prep.NewArgs<DestroyVideoSessionParametersKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.videoSessionParameters) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyVideoSessionParametersKHR(PFN_vkVoidFunction proc, void *data) {
+    const DestroyVideoSessionParametersKHRArgs &args = *static_cast<const DestroyVideoSessionParametersKHRArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyVideoSessionParametersKHR>(proc)(args.device, args.videoSessionParameters, args.pAllocator);
+    return VK_SUCCESS;
+}
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+struct CmdEndVideoCodingKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkVideoEndCodingInfoKHR*              pEndCodingInfo;
+};
+
+static bool PrepareCmdEndVideoCodingKHR(ReplayPrep &prep) {
+    CmdEndVideoCodingKHRArgs &args = prep.NewArgs<CmdEndVideoCodingKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pEndCodingInfo);
+}
+
+static VkResult InvokeCmdEndVideoCodingKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdEndVideoCodingKHRArgs &args = *static_cast<const CmdEndVideoCodingKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdEndVideoCodingKHR>(proc)(args.commandBuffer, args.pEndCodingInfo);
+    return VK_SUCCESS;
+}
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+struct CmdControlVideoCodingKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkVideoCodingControlInfoKHR*          pCodingControlInfo;
+};
+
+static bool PrepareCmdControlVideoCodingKHR(ReplayPrep &prep) {
+    CmdControlVideoCodingKHRArgs &args = prep.NewArgs<CmdControlVideoCodingKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pCodingControlInfo);
+}
+
+static VkResult InvokeCmdControlVideoCodingKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdControlVideoCodingKHRArgs &args = *static_cast<const CmdControlVideoCodingKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdControlVideoCodingKHR>(proc)(args.commandBuffer, args.pCodingControlInfo);
+    return VK_SUCCESS;
+}
+#endif
+
+struct GetPhysicalDeviceFeatures2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkPhysicalDeviceFeatures2*                  pFeatures;
+};
+
+static bool PrepareGetPhysicalDeviceFeatures2KHR(ReplayPrep &prep) {
+    GetPhysicalDeviceFeatures2KHRArgs &args = prep.NewArgs<GetPhysicalDeviceFeatures2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pFeatures);
+}
+
+static VkResult InvokeGetPhysicalDeviceFeatures2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceFeatures2KHRArgs &args = *static_cast<const GetPhysicalDeviceFeatures2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(proc)(args.physicalDevice, args.pFeatures);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceProperties2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkPhysicalDeviceProperties2*                pProperties;
+};
+
+static bool PrepareGetPhysicalDeviceProperties2KHR(ReplayPrep &prep) {
+    GetPhysicalDeviceProperties2KHRArgs &args = prep.NewArgs<GetPhysicalDeviceProperties2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceProperties2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceProperties2KHRArgs &args = *static_cast<const GetPhysicalDeviceProperties2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2KHR>(proc)(args.physicalDevice, args.pProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceFormatProperties2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkFormat                                    format;
+    VkFormatProperties2*                        pFormatProperties;
+};
+
+static bool PrepareGetPhysicalDeviceFormatProperties2KHR(ReplayPrep &prep) {
+    GetPhysicalDeviceFormatProperties2KHRArgs &args = prep.NewArgs<GetPhysicalDeviceFormatProperties2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.format) &&
+           prep.Array(args.pFormatProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceFormatProperties2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceFormatProperties2KHRArgs &args = *static_cast<const GetPhysicalDeviceFormatProperties2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceFormatProperties2KHR>(proc)(args.physicalDevice, args.format, args.pFormatProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceImageFormatProperties2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceImageFormatInfo2*     pImageFormatInfo;
+    VkImageFormatProperties2*                   pImageFormatProperties;
+};
+
+static bool PrepareGetPhysicalDeviceImageFormatProperties2KHR(ReplayPrep &prep) {
+    GetPhysicalDeviceImageFormatProperties2KHRArgs &args = prep.NewArgs<GetPhysicalDeviceImageFormatProperties2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pImageFormatInfo) &&
+           prep.Array(args.pImageFormatProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceImageFormatProperties2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceImageFormatProperties2KHRArgs &args = *static_cast<const GetPhysicalDeviceImageFormatProperties2KHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceImageFormatProperties2KHR>(proc)(args.physicalDevice, args.pImageFormatInfo, args.pImageFormatProperties);
+}
+
+struct GetPhysicalDeviceQueueFamilyProperties2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t*                                   pQueueFamilyPropertyCount;
+    VkQueueFamilyProperties2*                   pQueueFamilyProperties;
+};
+
+static bool PrepareGetPhysicalDeviceQueueFamilyProperties2KHR(ReplayPrep &prep) {
+    GetPhysicalDeviceQueueFamilyProperties2KHRArgs &args = prep.NewArgs<GetPhysicalDeviceQueueFamilyProperties2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pQueueFamilyPropertyCount) &&
+           prep.Array(args.pQueueFamilyProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceQueueFamilyProperties2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceQueueFamilyProperties2KHRArgs &args = *static_cast<const GetPhysicalDeviceQueueFamilyProperties2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR>(proc)(args.physicalDevice, args.pQueueFamilyPropertyCount, args.pQueueFamilyProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceMemoryProperties2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkPhysicalDeviceMemoryProperties2*          pMemoryProperties;
+};
+
+static bool PrepareGetPhysicalDeviceMemoryProperties2KHR(ReplayPrep &prep) {
+    GetPhysicalDeviceMemoryProperties2KHRArgs &args = prep.NewArgs<GetPhysicalDeviceMemoryProperties2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pMemoryProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceMemoryProperties2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceMemoryProperties2KHRArgs &args = *static_cast<const GetPhysicalDeviceMemoryProperties2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties2KHR>(proc)(args.physicalDevice, args.pMemoryProperties);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceSparseImageFormatProperties2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo;
+    uint32_t*                                   pPropertyCount;
+    VkSparseImageFormatProperties2*             pProperties;
+};
+
+static bool PrepareGetPhysicalDeviceSparseImageFormatProperties2KHR(ReplayPrep &prep) {
+    GetPhysicalDeviceSparseImageFormatProperties2KHRArgs &args = prep.NewArgs<GetPhysicalDeviceSparseImageFormatProperties2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pFormatInfo) &&
+           prep.Array(args.pPropertyCount) &&
+           prep.Array(args.pProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceSparseImageFormatProperties2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSparseImageFormatProperties2KHRArgs &args = *static_cast<const GetPhysicalDeviceSparseImageFormatProperties2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR>(proc)(args.physicalDevice, args.pFormatInfo, args.pPropertyCount, args.pProperties);
+    return VK_SUCCESS;
+}
+
+struct GetDeviceGroupPeerMemoryFeaturesKHRArgs {
+    VkDevice                                    device;
+    uint32_t                                    heapIndex;
+    uint32_t                                    localDeviceIndex;
+    uint32_t                                    remoteDeviceIndex;
+    VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures;
+};
+
+static bool PrepareGetDeviceGroupPeerMemoryFeaturesKHR(ReplayPrep &prep) {
+    GetDeviceGroupPeerMemoryFeaturesKHRArgs &args = prep.NewArgs<GetDeviceGroupPeerMemoryFeaturesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.heapIndex) &&
+           prep.Value(args.localDeviceIndex) &&
+           prep.Value(args.remoteDeviceIndex) &&
+           prep.Array(args.pPeerMemoryFeatures);
+}
+
+static VkResult InvokeGetDeviceGroupPeerMemoryFeaturesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceGroupPeerMemoryFeaturesKHRArgs &args = *static_cast<const GetDeviceGroupPeerMemoryFeaturesKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR>(proc)(args.device, args.heapIndex, args.localDeviceIndex, args.remoteDeviceIndex, args.pPeerMemoryFeatures);
+    return VK_SUCCESS;
+}
+
+struct CmdSetDeviceMaskKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    deviceMask;
+};
+
+static bool PrepareCmdSetDeviceMaskKHR(ReplayPrep &prep) {
+    CmdSetDeviceMaskKHRArgs &args = prep.NewArgs<CmdSetDeviceMaskKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.deviceMask);
+}
+
+static VkResult InvokeCmdSetDeviceMaskKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDeviceMaskKHRArgs &args = *static_cast<const CmdSetDeviceMaskKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDeviceMaskKHR>(proc)(args.commandBuffer, args.deviceMask);
+    return VK_SUCCESS;
+}
+
+struct CmdDispatchBaseKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    baseGroupX;
+    uint32_t                                    baseGroupY;
+    uint32_t                                    baseGroupZ;
+    uint32_t                                    groupCountX;
+    uint32_t                                    groupCountY;
+    uint32_t                                    groupCountZ;
+};
+
+static bool PrepareCmdDispatchBaseKHR(ReplayPrep &prep) {
+    CmdDispatchBaseKHRArgs &args = prep.NewArgs<CmdDispatchBaseKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.baseGroupX) &&
+           prep.Value(args.baseGroupY) &&
+           prep.Value(args.baseGroupZ) &&
+           prep.Value(args.groupCountX) &&
+           prep.Value(args.groupCountY) &&
+           prep.Value(args.groupCountZ);
+}
+
+static VkResult InvokeCmdDispatchBaseKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdDispatchBaseKHRArgs &args = *static_cast<const CmdDispatchBaseKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDispatchBaseKHR>(proc)(args.commandBuffer, args.baseGroupX, args.baseGroupY, args.baseGroupZ, args.groupCountX, args.groupCountY, args.groupCountZ);
+    return VK_SUCCESS;
+}
+
+struct TrimCommandPoolKHRArgs {
+    VkDevice                                    device;
+    VkCommandPool                               commandPool;
+    VkCommandPoolTrimFlags                      flags;
+};
+
+static bool PrepareTrimCommandPoolKHR(ReplayPrep &prep) {
+    TrimCommandPoolKHRArgs &args = prep.NewArgs<TrimCommandPoolKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.commandPool) &&
+           prep.Value(args.flags);
+}
+
+static VkResult InvokeTrimCommandPoolKHR(PFN_vkVoidFunction proc, void *data) {
+    const TrimCommandPoolKHRArgs &args = *static_cast<const TrimCommandPoolKHRArgs *>(data);
+    reinterpret_cast<PFN_vkTrimCommandPoolKHR>(proc)(args.device, args.commandPool, args.flags);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceExternalBufferPropertiesKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceExternalBufferInfo*   pExternalBufferInfo;
+    VkExternalBufferProperties*                 pExternalBufferProperties;
+};
+
+static bool PrepareGetPhysicalDeviceExternalBufferPropertiesKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceExternalBufferPropertiesKHRArgs &args = prep.NewArgs<GetPhysicalDeviceExternalBufferPropertiesKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pExternalBufferInfo) &&
+           prep.Array(args.pExternalBufferProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceExternalBufferPropertiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceExternalBufferPropertiesKHRArgs &args = *static_cast<const GetPhysicalDeviceExternalBufferPropertiesKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR>(proc)(args.physicalDevice, args.pExternalBufferInfo, args.pExternalBufferProperties);
+    return VK_SUCCESS;
+}
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+struct GetMemoryWin32HandlePropertiesKHRArgs {
+    VkDevice                                    device;
+    VkExternalMemoryHandleTypeFlagBits          handleType;
+    HANDLE                                      handle;
+    VkMemoryWin32HandlePropertiesKHR*           pMemoryWin32HandleProperties;
+};
+
+static bool PrepareGetMemoryWin32HandlePropertiesKHR(ReplayPrep &prep) {
+    GetMemoryWin32HandlePropertiesKHRArgs &args = prep.NewArgs<GetMemoryWin32HandlePropertiesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.handleType) &&
+           prep.Value(args.handle) &&
+           prep.Array(args.pMemoryWin32HandleProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetMemoryWin32HandlePropertiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetMemoryWin32HandlePropertiesKHRArgs &args = *static_cast<const GetMemoryWin32HandlePropertiesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetMemoryWin32HandlePropertiesKHR>(proc)(args.device, args.handleType, args.handle, args.pMemoryWin32HandleProperties);
+}
+#endif
+
+struct GetMemoryFdKHRArgs {
+    VkDevice                                    device;
+    const VkMemoryGetFdInfoKHR*                 pGetFdInfo;
+    int*                                        pFd;
+};
+
+static bool PrepareGetMemoryFdKHR(ReplayPrep &prep) {
+    GetMemoryFdKHRArgs &args = prep.NewArgs<GetMemoryFdKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pGetFdInfo) &&
+           prep.Array(args.pFd) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetMemoryFdKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetMemoryFdKHRArgs &args = *static_cast<const GetMemoryFdKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetMemoryFdKHR>(proc)(args.device, args.pGetFdInfo, args.pFd);
+}
+
+struct GetMemoryFdPropertiesKHRArgs {
+    VkDevice                                    device;
+    VkExternalMemoryHandleTypeFlagBits          handleType;
+    int                                         fd;
+    VkMemoryFdPropertiesKHR*                    pMemoryFdProperties;
+};
+
+static bool PrepareGetMemoryFdPropertiesKHR(ReplayPrep &prep) {
+    GetMemoryFdPropertiesKHRArgs &args = prep.NewArgs<GetMemoryFdPropertiesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.handleType) &&
+           prep.Value(args.fd) &&
+           prep.Array(args.pMemoryFdProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetMemoryFdPropertiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetMemoryFdPropertiesKHRArgs &args = *static_cast<const GetMemoryFdPropertiesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetMemoryFdPropertiesKHR>(proc)(args.device, args.handleType, args.fd, args.pMemoryFdProperties);
+}
+
+struct GetPhysicalDeviceExternalSemaphorePropertiesKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo;
+    VkExternalSemaphoreProperties*              pExternalSemaphoreProperties;
+};
+
+static bool PrepareGetPhysicalDeviceExternalSemaphorePropertiesKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceExternalSemaphorePropertiesKHRArgs &args = prep.NewArgs<GetPhysicalDeviceExternalSemaphorePropertiesKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pExternalSemaphoreInfo) &&
+           prep.Array(args.pExternalSemaphoreProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceExternalSemaphorePropertiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceExternalSemaphorePropertiesKHRArgs &args = *static_cast<const GetPhysicalDeviceExternalSemaphorePropertiesKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR>(proc)(args.physicalDevice, args.pExternalSemaphoreInfo, args.pExternalSemaphoreProperties);
+    return VK_SUCCESS;
+}
+
+struct GetSemaphoreFdKHRArgs {
+    VkDevice                                    device;
+    const VkSemaphoreGetFdInfoKHR*              pGetFdInfo;
+    int*                                        pFd;
+};
+
+static bool PrepareGetSemaphoreFdKHR(ReplayPrep &prep) {
+    GetSemaphoreFdKHRArgs &args = prep.NewArgs<GetSemaphoreFdKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pGetFdInfo) &&
+           prep.Array(args.pFd) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetSemaphoreFdKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetSemaphoreFdKHRArgs &args = *static_cast<const GetSemaphoreFdKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetSemaphoreFdKHR>(proc)(args.device, args.pGetFdInfo, args.pFd);
+}
+
+struct CmdPushDescriptorSetKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineBindPoint                         pipelineBindPoint;
+    VkPipelineLayout                            layout;
+    uint32_t                                    set;
+    uint32_t                                    descriptorWriteCount;
+    const VkWriteDescriptorSet*                 pDescriptorWrites;
+};
+
+static bool PrepareCmdPushDescriptorSetKHR(ReplayPrep &prep) {
+    CmdPushDescriptorSetKHRArgs &args = prep.NewArgs<CmdPushDescriptorSetKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.pipelineBindPoint) &&
+           prep.Handle(args.layout) &&
+           prep.Value(args.set) &&
+           prep.Value(args.descriptorWriteCount) &&
+           prep.Array(args.pDescriptorWrites);
+}
+
+static VkResult InvokeCmdPushDescriptorSetKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdPushDescriptorSetKHRArgs &args = *static_cast<const CmdPushDescriptorSetKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdPushDescriptorSetKHR>(proc)(args.commandBuffer, args.pipelineBindPoint, args.layout, args.set, args.descriptorWriteCount, args.pDescriptorWrites);
+    return VK_SUCCESS;
+}
+
+struct CmdPushDescriptorSetWithTemplateKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate;
+    VkPipelineLayout                            layout;
+    uint32_t                                    set;
+    const void*                                 pData;
+};
+
+static bool PrepareCmdPushDescriptorSetWithTemplateKHR(ReplayPrep &prep) {
+    CmdPushDescriptorSetWithTemplateKHRArgs &args = prep.NewArgs<CmdPushDescriptorSetWithTemplateKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.descriptorUpdateTemplate) &&
+           prep.Handle(args.layout) &&
+           prep.Value(args.set) &&
+           prep.Address(args.pData);
+}
+
+static VkResult InvokeCmdPushDescriptorSetWithTemplateKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdPushDescriptorSetWithTemplateKHRArgs &args = *static_cast<const CmdPushDescriptorSetWithTemplateKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdPushDescriptorSetWithTemplateKHR>(proc)(args.commandBuffer, args.descriptorUpdateTemplate, args.layout, args.set, args.pData);
+    return VK_SUCCESS;
+}
+
+struct CreateDescriptorUpdateTemplateKHRArgs {
+    VkDevice                                    device;
+    const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate;
+};
+
+static bool PrepareCreateDescriptorUpdateTemplateKHR(ReplayPrep &prep) {
+    CreateDescriptorUpdateTemplateKHRArgs &args = prep.NewArgs<CreateDescriptorUpdateTemplateKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pDescriptorUpdateTemplate) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateDescriptorUpdateTemplateKHR(PFN_vkVoidFunction proc, void *data) {
+    const CreateDescriptorUpdateTemplateKHRArgs &args = *static_cast<const CreateDescriptorUpdateTemplateKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateDescriptorUpdateTemplateKHR>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pDescriptorUpdateTemplate);
+}
+
+struct DestroyDescriptorUpdateTemplateKHRArgs {
+    VkDevice                                    device;
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyDescriptorUpdateTemplateKHR(ReplayPrep &prep) {
+    DestroyDescriptorUpdateTemplateKHRArgs &args = prep.NewArgs<DestroyDescriptorUpdateTemplateKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.descriptorUpdateTemplate) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyDescriptorUpdateTemplateKHR(PFN_vkVoidFunction proc, void *data) {
+    const DestroyDescriptorUpdateTemplateKHRArgs &args = *static_cast<const DestroyDescriptorUpdateTemplateKHRArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyDescriptorUpdateTemplateKHR>(proc)(args.device, args.descriptorUpdateTemplate, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct UpdateDescriptorSetWithTemplateKHRArgs {
+    VkDevice                                    device;
+    VkDescriptorSet                             descriptorSet;
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate;
+    const void*                                 pData;
+};
+
+static bool PrepareUpdateDescriptorSetWithTemplateKHR(ReplayPrep &prep) {
+    UpdateDescriptorSetWithTemplateKHRArgs &args = prep.NewArgs<UpdateDescriptorSetWithTemplateKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.descriptorSet) &&
+           prep.Handle(args.descriptorUpdateTemplate) &&
+           prep.Address(args.pData);
+}
+
+static VkResult InvokeUpdateDescriptorSetWithTemplateKHR(PFN_vkVoidFunction proc, void *data) {
+    const UpdateDescriptorSetWithTemplateKHRArgs &args = *static_cast<const UpdateDescriptorSetWithTemplateKHRArgs *>(data);
+    reinterpret_cast<PFN_vkUpdateDescriptorSetWithTemplateKHR>(proc)(args.device, args.descriptorSet, args.descriptorUpdateTemplate, args.pData);
+    return VK_SUCCESS;
+}
+
+struct CreateRenderPass2KHRArgs {
+    VkDevice                                    device;
+    const VkRenderPassCreateInfo2*              pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkRenderPass*                               pRenderPass;
+};
+
+static bool PrepareCreateRenderPass2KHR(ReplayPrep &prep) {
+    CreateRenderPass2KHRArgs &args = prep.NewArgs<CreateRenderPass2KHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pRenderPass) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateRenderPass2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CreateRenderPass2KHRArgs &args = *static_cast<const CreateRenderPass2KHRArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateRenderPass2KHR>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pRenderPass);
+}
+
+struct CmdBeginRenderPass2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkRenderPassBeginInfo*                pRenderPassBegin;
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo;
+};
+
+static bool PrepareCmdBeginRenderPass2KHR(ReplayPrep &prep) {
+    CmdBeginRenderPass2KHRArgs &args = prep.NewArgs<CmdBeginRenderPass2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pRenderPassBegin) &&
+           prep.Array(args.pSubpassBeginInfo);
+}
+
+static VkResult InvokeCmdBeginRenderPass2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdBeginRenderPass2KHRArgs &args = *static_cast<const CmdBeginRenderPass2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBeginRenderPass2KHR>(proc)(args.commandBuffer, args.pRenderPassBegin, args.pSubpassBeginInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdNextSubpass2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo;
+    const VkSubpassEndInfo*                     pSubpassEndInfo;
+};
+
+static bool PrepareCmdNextSubpass2KHR(ReplayPrep &prep) {
+    CmdNextSubpass2KHRArgs &args = prep.NewArgs<CmdNextSubpass2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pSubpassBeginInfo) &&
+           prep.Array(args.pSubpassEndInfo);
+}
+
+static VkResult InvokeCmdNextSubpass2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdNextSubpass2KHRArgs &args = *static_cast<const CmdNextSubpass2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdNextSubpass2KHR>(proc)(args.commandBuffer, args.pSubpassBeginInfo, args.pSubpassEndInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdEndRenderPass2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkSubpassEndInfo*                     pSubpassEndInfo;
+};
+
+static bool PrepareCmdEndRenderPass2KHR(ReplayPrep &prep) {
+    CmdEndRenderPass2KHRArgs &args = prep.NewArgs<CmdEndRenderPass2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pSubpassEndInfo);
+}
+
+static VkResult InvokeCmdEndRenderPass2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdEndRenderPass2KHRArgs &args = *static_cast<const CmdEndRenderPass2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdEndRenderPass2KHR>(proc)(args.commandBuffer, args.pSubpassEndInfo);
+    return VK_SUCCESS;
+}
+
+struct GetSwapchainStatusKHRArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapchain;
+};
+
+static bool PrepareGetSwapchainStatusKHR(ReplayPrep &prep) {
+    GetSwapchainStatusKHRArgs &args = prep.NewArgs<GetSwapchainStatusKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapchain) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetSwapchainStatusKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetSwapchainStatusKHRArgs &args = *static_cast<const GetSwapchainStatusKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetSwapchainStatusKHR>(proc)(args.device, args.swapchain);
+}
+
+struct GetPhysicalDeviceExternalFencePropertiesKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceExternalFenceInfo*    pExternalFenceInfo;
+    VkExternalFenceProperties*                  pExternalFenceProperties;
+};
+
+static bool PrepareGetPhysicalDeviceExternalFencePropertiesKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceExternalFencePropertiesKHRArgs &args = prep.NewArgs<GetPhysicalDeviceExternalFencePropertiesKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pExternalFenceInfo) &&
+           prep.Array(args.pExternalFenceProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceExternalFencePropertiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceExternalFencePropertiesKHRArgs &args = *static_cast<const GetPhysicalDeviceExternalFencePropertiesKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR>(proc)(args.physicalDevice, args.pExternalFenceInfo, args.pExternalFenceProperties);
+    return VK_SUCCESS;
+}
+
+struct GetFenceFdKHRArgs {
+    VkDevice                                    device;
+    const VkFenceGetFdInfoKHR*                  pGetFdInfo;
+    int*                                        pFd;
+};
+
+static bool PrepareGetFenceFdKHR(ReplayPrep &prep) {
+    GetFenceFdKHRArgs &args = prep.NewArgs<GetFenceFdKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pGetFdInfo) &&
+           prep.Array(args.pFd) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetFenceFdKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetFenceFdKHRArgs &args = *static_cast<const GetFenceFdKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetFenceFdKHR>(proc)(args.device, args.pGetFdInfo, args.pFd);
+}
+
+struct EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    queueFamilyIndex;
+    uint32_t*                                   pCounterCount;
+    VkPerformanceCounterKHR*                    pCounters;
+    VkPerformanceCounterDescriptionKHR*         pCounterDescriptions;
+};
+
+static bool PrepareEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(ReplayPrep &prep) {
+    EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHRArgs &args = prep.NewArgs<EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.queueFamilyIndex) &&
+           prep.Array(args.pCounterCount) &&
+           prep.Array(args.pCounters) &&
+           prep.Array(args.pCounterDescriptions) &&
+           prep.Result();
+}
+
+static VkResult InvokeEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(PFN_vkVoidFunction proc, void *data) {
+    const EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHRArgs &args = *static_cast<const EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR>(proc)(args.physicalDevice, args.queueFamilyIndex, args.pCounterCount, args.pCounters, args.pCounterDescriptions);
+}
+
+struct AcquireProfilingLockKHRArgs {
+    VkDevice                                    device;
+    const VkAcquireProfilingLockInfoKHR*        pInfo;
+};
+
+static bool PrepareAcquireProfilingLockKHR(ReplayPrep &prep) {
+    AcquireProfilingLockKHRArgs &args = prep.NewArgs<AcquireProfilingLockKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeAcquireProfilingLockKHR(PFN_vkVoidFunction proc, void *data) {
+    const AcquireProfilingLockKHRArgs &args = *static_cast<const AcquireProfilingLockKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkAcquireProfilingLockKHR>(proc)(args.device, args.pInfo);
+}
+
+struct ReleaseProfilingLockKHRArgs {
+    VkDevice                                    device;
+};
+
+static bool PrepareReleaseProfilingLockKHR(ReplayPrep &prep) {
+    ReleaseProfilingLockKHRArgs &args = prep.NewArgs<ReleaseProfilingLockKHRArgs>();
+    return prep.Handle(args.device);
+}
+
+static VkResult InvokeReleaseProfilingLockKHR(PFN_vkVoidFunction proc, void *data) {
+    const ReleaseProfilingLockKHRArgs &args = *static_cast<const ReleaseProfilingLockKHRArgs *>(data);
+    reinterpret_cast<PFN_vkReleaseProfilingLockKHR>(proc)(args.device);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceSurfaceCapabilities2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceSurfaceInfo2KHR*      pSurfaceInfo;
+    VkSurfaceCapabilities2KHR*                  pSurfaceCapabilities;
+};
+
+static bool PrepareGetPhysicalDeviceSurfaceCapabilities2KHR(ReplayPrep &prep) {
+    GetPhysicalDeviceSurfaceCapabilities2KHRArgs &args = prep.NewArgs<GetPhysicalDeviceSurfaceCapabilities2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pSurfaceInfo) &&
+           prep.Array(args.pSurfaceCapabilities) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceSurfaceCapabilities2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSurfaceCapabilities2KHRArgs &args = *static_cast<const GetPhysicalDeviceSurfaceCapabilities2KHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR>(proc)(args.physicalDevice, args.pSurfaceInfo, args.pSurfaceCapabilities);
+}
+
+struct GetPhysicalDeviceSurfaceFormats2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceSurfaceInfo2KHR*      pSurfaceInfo;
+    uint32_t*                                   pSurfaceFormatCount;
+    VkSurfaceFormat2KHR*                        pSurfaceFormats;
+};
+
+static bool PrepareGetPhysicalDeviceSurfaceFormats2KHR(ReplayPrep &prep) {
+    GetPhysicalDeviceSurfaceFormats2KHRArgs &args = prep.NewArgs<GetPhysicalDeviceSurfaceFormats2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pSurfaceInfo) &&
+           prep.Array(args.pSurfaceFormatCount) &&
+           prep.Array(args.pSurfaceFormats) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceSurfaceFormats2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSurfaceFormats2KHRArgs &args = *static_cast<const GetPhysicalDeviceSurfaceFormats2KHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceFormats2KHR>(proc)(args.physicalDevice, args.pSurfaceInfo, args.pSurfaceFormatCount, args.pSurfaceFormats);
+}
+
+struct GetDisplayPlaneCapabilities2KHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkDisplayPlaneInfo2KHR*               pDisplayPlaneInfo;
+    VkDisplayPlaneCapabilities2KHR*             pCapabilities;
+};
+
+static bool PrepareGetDisplayPlaneCapabilities2KHR(ReplayPrep &prep) {
+    GetDisplayPlaneCapabilities2KHRArgs &args = prep.NewArgs<GetDisplayPlaneCapabilities2KHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pDisplayPlaneInfo) &&
+           prep.Array(args.pCapabilities) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetDisplayPlaneCapabilities2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDisplayPlaneCapabilities2KHRArgs &args = *static_cast<const GetDisplayPlaneCapabilities2KHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetDisplayPlaneCapabilities2KHR>(proc)(args.physicalDevice, args.pDisplayPlaneInfo, args.pCapabilities);
+}
+
+struct GetImageMemoryRequirements2KHRArgs {
+    VkDevice                                    device;
+    const VkImageMemoryRequirementsInfo2*       pInfo;
+    VkMemoryRequirements2*                      pMemoryRequirements;
+};
+
+static bool PrepareGetImageMemoryRequirements2KHR(ReplayPrep &prep) {
+    GetImageMemoryRequirements2KHRArgs &args = prep.NewArgs<GetImageMemoryRequirements2KHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Array(args.pMemoryRequirements);
+}
+
+static VkResult InvokeGetImageMemoryRequirements2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetImageMemoryRequirements2KHRArgs &args = *static_cast<const GetImageMemoryRequirements2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetImageMemoryRequirements2KHR>(proc)(args.device, args.pInfo, args.pMemoryRequirements);
+    return VK_SUCCESS;
+}
+
+struct GetBufferMemoryRequirements2KHRArgs {
+    VkDevice                                    device;
+    const VkBufferMemoryRequirementsInfo2*      pInfo;
+    VkMemoryRequirements2*                      pMemoryRequirements;
+};
+
+static bool PrepareGetBufferMemoryRequirements2KHR(ReplayPrep &prep) {
+    GetBufferMemoryRequirements2KHRArgs &args = prep.NewArgs<GetBufferMemoryRequirements2KHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Array(args.pMemoryRequirements);
+}
+
+static VkResult InvokeGetBufferMemoryRequirements2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetBufferMemoryRequirements2KHRArgs &args = *static_cast<const GetBufferMemoryRequirements2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetBufferMemoryRequirements2KHR>(proc)(args.device, args.pInfo, args.pMemoryRequirements);
+    return VK_SUCCESS;
+}
+
+struct GetImageSparseMemoryRequirements2KHRArgs {
+    VkDevice                                    device;
+    const VkImageSparseMemoryRequirementsInfo2* pInfo;
+    uint32_t*                                   pSparseMemoryRequirementCount;
+    VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements;
+};
+
+static bool PrepareGetImageSparseMemoryRequirements2KHR(ReplayPrep &prep) {
+    GetImageSparseMemoryRequirements2KHRArgs &args = prep.NewArgs<GetImageSparseMemoryRequirements2KHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Array(args.pSparseMemoryRequirementCount) &&
+           prep.Array(args.pSparseMemoryRequirements);
+}
+
+static VkResult InvokeGetImageSparseMemoryRequirements2KHR(PFN_vkVoidFunction proc, void *data) {
+    const GetImageSparseMemoryRequirements2KHRArgs &args = *static_cast<const GetImageSparseMemoryRequirements2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetImageSparseMemoryRequirements2KHR>(proc)(args.device, args.pInfo, args.pSparseMemoryRequirementCount, args.pSparseMemoryRequirements);
+    return VK_SUCCESS;
+}
+
+struct CreateSamplerYcbcrConversionKHRArgs {
+    VkDevice                                    device;
+    const VkSamplerYcbcrConversionCreateInfo*   pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkSamplerYcbcrConversion*                   pYcbcrConversion;
+};
+
+static bool PrepareCreateSamplerYcbcrConversionKHR(ReplayPrep &prep) {
+    CreateSamplerYcbcrConversionKHRArgs &args = prep.NewArgs<CreateSamplerYcbcrConversionKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pYcbcrConversion) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateSamplerYcbcrConversionKHR(PFN_vkVoidFunction proc, void *data) {
+    const CreateSamplerYcbcrConversionKHRArgs &args = *static_cast<const CreateSamplerYcbcrConversionKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateSamplerYcbcrConversionKHR>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pYcbcrConversion);
+}
+
+struct DestroySamplerYcbcrConversionKHRArgs {
+    VkDevice                                    device;
+    VkSamplerYcbcrConversion                    ycbcrConversion;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroySamplerYcbcrConversionKHR(ReplayPrep &prep) {
+    DestroySamplerYcbcrConversionKHRArgs &args = prep.NewArgs<DestroySamplerYcbcrConversionKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.ycbcrConversion) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroySamplerYcbcrConversionKHR(PFN_vkVoidFunction proc, void *data) {
+    const DestroySamplerYcbcrConversionKHRArgs &args = *static_cast<const DestroySamplerYcbcrConversionKHRArgs *>(data);
+    reinterpret_cast<PFN_vkDestroySamplerYcbcrConversionKHR>(proc)(args.device, args.ycbcrConversion, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct BindBufferMemory2KHRArgs {
+    VkDevice                                    device;
+    uint32_t                                    bindInfoCount;
+    const VkBindBufferMemoryInfo*               pBindInfos;
+};
+
+static bool PrepareBindBufferMemory2KHR(ReplayPrep &prep) {
+    BindBufferMemory2KHRArgs &args = prep.NewArgs<BindBufferMemory2KHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.bindInfoCount) &&
+           prep.Array(args.pBindInfos) &&
+           prep.Result();
+}
+
+static VkResult InvokeBindBufferMemory2KHR(PFN_vkVoidFunction proc, void *data) {
+    const BindBufferMemory2KHRArgs &args = *static_cast<const BindBufferMemory2KHRArgs *>(data);
+    return reinterpret_cast<PFN_vkBindBufferMemory2KHR>(proc)(args.device, args.bindInfoCount, args.pBindInfos);
+}
+
+struct BindImageMemory2KHRArgs {
+    VkDevice                                    device;
+    uint32_t                                    bindInfoCount;
+    const VkBindImageMemoryInfo*                pBindInfos;
+};
+
+static bool PrepareBindImageMemory2KHR(ReplayPrep &prep) {
+    BindImageMemory2KHRArgs &args = prep.NewArgs<BindImageMemory2KHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.bindInfoCount) &&
+           prep.Array(args.pBindInfos) &&
+           prep.Result();
+}
+
+static VkResult InvokeBindImageMemory2KHR(PFN_vkVoidFunction proc, void *data) {
+    const BindImageMemory2KHRArgs &args = *static_cast<const BindImageMemory2KHRArgs *>(data);
+    return reinterpret_cast<PFN_vkBindImageMemory2KHR>(proc)(args.device, args.bindInfoCount, args.pBindInfos);
+}
+
+struct GetDescriptorSetLayoutSupportKHRArgs {
+    VkDevice                                    device;
+    const VkDescriptorSetLayoutCreateInfo*      pCreateInfo;
+    VkDescriptorSetLayoutSupport*               pSupport;
+};
+
+static bool PrepareGetDescriptorSetLayoutSupportKHR(ReplayPrep &prep) {
+    GetDescriptorSetLayoutSupportKHRArgs &args = prep.NewArgs<GetDescriptorSetLayoutSupportKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Array(args.pSupport);
+}
+
+static VkResult InvokeGetDescriptorSetLayoutSupportKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDescriptorSetLayoutSupportKHRArgs &args = *static_cast<const GetDescriptorSetLayoutSupportKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetDescriptorSetLayoutSupportKHR>(proc)(args.device, args.pCreateInfo, args.pSupport);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawIndirectCountKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawIndirectCountKHR(ReplayPrep &prep) {
+    CmdDrawIndirectCountKHRArgs &args = prep.NewArgs<CmdDrawIndirectCountKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Handle(args.countBuffer) &&
+           prep.Value(args.countBufferOffset) &&
+           prep.Value(args.maxDrawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawIndirectCountKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndirectCountKHRArgs &args = *static_cast<const CmdDrawIndirectCountKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndirectCountKHR>(proc)(args.commandBuffer, args.buffer, args.offset, args.countBuffer, args.countBufferOffset, args.maxDrawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawIndexedIndirectCountKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawIndexedIndirectCountKHR(ReplayPrep &prep) {
+    CmdDrawIndexedIndirectCountKHRArgs &args = prep.NewArgs<CmdDrawIndexedIndirectCountKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Handle(args.countBuffer) &&
+           prep.Value(args.countBufferOffset) &&
+           prep.Value(args.maxDrawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawIndexedIndirectCountKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndexedIndirectCountKHRArgs &args = *static_cast<const CmdDrawIndexedIndirectCountKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountKHR>(proc)(args.commandBuffer, args.buffer, args.offset, args.countBuffer, args.countBufferOffset, args.maxDrawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct GetSemaphoreCounterValueKHRArgs {
+    VkDevice                                    device;
+    VkSemaphore                                 semaphore;
+    uint64_t*                                   pValue;
+};
+
+static bool PrepareGetSemaphoreCounterValueKHR(ReplayPrep &prep) {
+    GetSemaphoreCounterValueKHRArgs &args = prep.NewArgs<GetSemaphoreCounterValueKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.semaphore) &&
+           prep.Array(args.pValue) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetSemaphoreCounterValueKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetSemaphoreCounterValueKHRArgs &args = *static_cast<const GetSemaphoreCounterValueKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(proc)(args.device, args.semaphore, args.pValue);
+}
+
+struct WaitSemaphoresKHRArgs {
+    VkDevice                                    device;
+    const VkSemaphoreWaitInfo*                  pWaitInfo;
+    uint64_t                                    timeout;
+};
+
+static bool PrepareWaitSemaphoresKHR(ReplayPrep &prep) {
+    WaitSemaphoresKHRArgs &args = prep.NewArgs<WaitSemaphoresKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pWaitInfo) &&
+           prep.Value(args.timeout) &&
+           prep.Result();
+}
+
+static VkResult InvokeWaitSemaphoresKHR(PFN_vkVoidFunction proc, void *data) {
+    const WaitSemaphoresKHRArgs &args = *static_cast<const WaitSemaphoresKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkWaitSemaphoresKHR>(proc)(args.device, args.pWaitInfo, args.timeout);
+}
+
+struct SignalSemaphoreKHRArgs {
+    VkDevice                                    device;
+    const VkSemaphoreSignalInfo*                pSignalInfo;
+};
+
+static bool PrepareSignalSemaphoreKHR(ReplayPrep &prep) {
+    SignalSemaphoreKHRArgs &args = prep.NewArgs<SignalSemaphoreKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pSignalInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeSignalSemaphoreKHR(PFN_vkVoidFunction proc, void *data) {
+    const SignalSemaphoreKHRArgs &args = *static_cast<const SignalSemaphoreKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkSignalSemaphoreKHR>(proc)(args.device, args.pSignalInfo);
+}
+
+struct GetPhysicalDeviceFragmentShadingRatesKHRArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t*                                   pFragmentShadingRateCount;
+    VkPhysicalDeviceFragmentShadingRateKHR*     pFragmentShadingRates;
+};
+
+static bool PrepareGetPhysicalDeviceFragmentShadingRatesKHR(ReplayPrep &prep) {
+    GetPhysicalDeviceFragmentShadingRatesKHRArgs &args = prep.NewArgs<GetPhysicalDeviceFragmentShadingRatesKHRArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pFragmentShadingRateCount) &&
+           prep.Array(args.pFragmentShadingRates) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceFragmentShadingRatesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceFragmentShadingRatesKHRArgs &args = *static_cast<const GetPhysicalDeviceFragmentShadingRatesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR>(proc)(args.physicalDevice, args.pFragmentShadingRateCount, args.pFragmentShadingRates);
+}
+
+struct CmdSetFragmentShadingRateKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkExtent2D*                           pFragmentSize;
+    const VkFragmentShadingRateCombinerOpKHR*   combinerOps;
+};
+
+static bool PrepareCmdSetFragmentShadingRateKHR(ReplayPrep &prep) {
+    CmdSetFragmentShadingRateKHRArgs &args = prep.NewArgs<CmdSetFragmentShadingRateKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pFragmentSize) &&
+           prep.Array(args.combinerOps);
+}
+
+static VkResult InvokeCmdSetFragmentShadingRateKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetFragmentShadingRateKHRArgs &args = *static_cast<const CmdSetFragmentShadingRateKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetFragmentShadingRateKHR>(proc)(args.commandBuffer, args.pFragmentSize, args.combinerOps);
+    return VK_SUCCESS;
+}
+
+struct GetBufferDeviceAddressKHRArgs {
+    VkDevice                                    device;
+    const VkBufferDeviceAddressInfo*            pInfo;
+};
+
+static bool PrepareGetBufferDeviceAddressKHR(ReplayPrep &prep) {
+    GetBufferDeviceAddressKHRArgs &args = prep.NewArgs<GetBufferDeviceAddressKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetBufferDeviceAddressKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetBufferDeviceAddressKHRArgs &args = *static_cast<const GetBufferDeviceAddressKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetBufferDeviceAddressKHR>(proc)(args.device, args.pInfo);
+    return VK_SUCCESS;
+}
+
+struct GetBufferOpaqueCaptureAddressKHRArgs {
+    VkDevice                                    device;
+    const VkBufferDeviceAddressInfo*            pInfo;
+};
+
+static bool PrepareGetBufferOpaqueCaptureAddressKHR(ReplayPrep &prep) {
+    GetBufferOpaqueCaptureAddressKHRArgs &args = prep.NewArgs<GetBufferOpaqueCaptureAddressKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetBufferOpaqueCaptureAddressKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetBufferOpaqueCaptureAddressKHRArgs &args = *static_cast<const GetBufferOpaqueCaptureAddressKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetBufferOpaqueCaptureAddressKHR>(proc)(args.device, args.pInfo);
+    return VK_SUCCESS;
+}
+
+struct GetDeviceMemoryOpaqueCaptureAddressKHRArgs {
+    VkDevice                                    device;
+    const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo;
+};
+
+static bool PrepareGetDeviceMemoryOpaqueCaptureAddressKHR(ReplayPrep &prep) {
+    GetDeviceMemoryOpaqueCaptureAddressKHRArgs &args = prep.NewArgs<GetDeviceMemoryOpaqueCaptureAddressKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetDeviceMemoryOpaqueCaptureAddressKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceMemoryOpaqueCaptureAddressKHRArgs &args = *static_cast<const GetDeviceMemoryOpaqueCaptureAddressKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR>(proc)(args.device, args.pInfo);
+    return VK_SUCCESS;
+}
+
+struct CreateDeferredOperationKHRArgs {
+    VkDevice                                    device;
+    const VkAllocationCallbacks*                pAllocator;
+    VkDeferredOperationKHR*                     pDeferredOperation;
+};
+
+static bool PrepareCreateDeferredOperationKHR(ReplayPrep &prep) {
+    CreateDeferredOperationKHRArgs &args = prep.NewArgs<CreateDeferredOperationKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pDeferredOperation) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateDeferredOperationKHR(PFN_vkVoidFunction proc, void *data) {
+    const CreateDeferredOperationKHRArgs &args = *static_cast<const CreateDeferredOperationKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateDeferredOperationKHR>(proc)(args.device, args.pAllocator, args.pDeferredOperation);
+}
+
+struct DestroyDeferredOperationKHRArgs {
+    VkDevice                                    device;
+    VkDeferredOperationKHR                      operation;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyDeferredOperationKHR(ReplayPrep &prep) {
+    DestroyDeferredOperationKHRArgs &args = prep.NewArgs<DestroyDeferredOperationKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.operation) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyDeferredOperationKHR(PFN_vkVoidFunction proc, void *data) {
+    const DestroyDeferredOperationKHRArgs &args = *static_cast<const DestroyDeferredOperationKHRArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyDeferredOperationKHR>(proc)(args.device, args.operation, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct GetDeferredOperationMaxConcurrencyKHRArgs {
+    VkDevice                                    device;
+    VkDeferredOperationKHR                      operation;
+};
+
+static bool PrepareGetDeferredOperationMaxConcurrencyKHR(ReplayPrep &prep) {
+    GetDeferredOperationMaxConcurrencyKHRArgs &args = prep.NewArgs<GetDeferredOperationMaxConcurrencyKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.operation) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetDeferredOperationMaxConcurrencyKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDeferredOperationMaxConcurrencyKHRArgs &args = *static_cast<const GetDeferredOperationMaxConcurrencyKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetDeferredOperationMaxConcurrencyKHR>(proc)(args.device, args.operation);
+    return VK_SUCCESS;
+}
+
+struct GetDeferredOperationResultKHRArgs {
+    VkDevice                                    device;
+    VkDeferredOperationKHR                      operation;
+};
+
+static bool PrepareGetDeferredOperationResultKHR(ReplayPrep &prep) {
+    GetDeferredOperationResultKHRArgs &args = prep.NewArgs<GetDeferredOperationResultKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.operation) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetDeferredOperationResultKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetDeferredOperationResultKHRArgs &args = *static_cast<const GetDeferredOperationResultKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetDeferredOperationResultKHR>(proc)(args.device, args.operation);
+}
+
+struct DeferredOperationJoinKHRArgs {
+    VkDevice                                    device;
+    VkDeferredOperationKHR                      operation;
+};
+
+static bool PrepareDeferredOperationJoinKHR(ReplayPrep &prep) {
+    DeferredOperationJoinKHRArgs &args = prep.NewArgs<DeferredOperationJoinKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.operation) &&
+           prep.Result();
+}
+
+static VkResult InvokeDeferredOperationJoinKHR(PFN_vkVoidFunction proc, void *data) {
+    const DeferredOperationJoinKHRArgs &args = *static_cast<const DeferredOperationJoinKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkDeferredOperationJoinKHR>(proc)(args.device, args.operation);
+}
+
+struct GetPipelineExecutablePropertiesKHRArgs {
+    VkDevice                                    device;
+    const VkPipelineInfoKHR*                    pPipelineInfo;
+    uint32_t*                                   pExecutableCount;
+    VkPipelineExecutablePropertiesKHR*          pProperties;
+};
+
+static bool PrepareGetPipelineExecutablePropertiesKHR(ReplayPrep &prep) {
+    GetPipelineExecutablePropertiesKHRArgs &args = prep.NewArgs<GetPipelineExecutablePropertiesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pPipelineInfo) &&
+           prep.Array(args.pExecutableCount) &&
+           prep.Array(args.pProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPipelineExecutablePropertiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPipelineExecutablePropertiesKHRArgs &args = *static_cast<const GetPipelineExecutablePropertiesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPipelineExecutablePropertiesKHR>(proc)(args.device, args.pPipelineInfo, args.pExecutableCount, args.pProperties);
+}
+
+struct GetPipelineExecutableStatisticsKHRArgs {
+    VkDevice                                    device;
+    const VkPipelineExecutableInfoKHR*          pExecutableInfo;
+    uint32_t*                                   pStatisticCount;
+    VkPipelineExecutableStatisticKHR*           pStatistics;
+};
+
+static bool PrepareGetPipelineExecutableStatisticsKHR(ReplayPrep &prep) {
+    GetPipelineExecutableStatisticsKHRArgs &args = prep.NewArgs<GetPipelineExecutableStatisticsKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pExecutableInfo) &&
+           prep.Array(args.pStatisticCount) &&
+           prep.Array(args.pStatistics) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPipelineExecutableStatisticsKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetPipelineExecutableStatisticsKHRArgs &args = *static_cast<const GetPipelineExecutableStatisticsKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPipelineExecutableStatisticsKHR>(proc)(args.device, args.pExecutableInfo, args.pStatisticCount, args.pStatistics);
+}
+
+struct CmdSetEvent2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkEvent                                     event;
+    const VkDependencyInfoKHR*                  pDependencyInfo;
+};
+
+static bool PrepareCmdSetEvent2KHR(ReplayPrep &prep) {
+    CmdSetEvent2KHRArgs &args = prep.NewArgs<CmdSetEvent2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.event) &&
+           prep.Array(args.pDependencyInfo);
+}
+
+static VkResult InvokeCmdSetEvent2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetEvent2KHRArgs &args = *static_cast<const CmdSetEvent2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetEvent2KHR>(proc)(args.commandBuffer, args.event, args.pDependencyInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdResetEvent2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkEvent                                     event;
+    VkPipelineStageFlags2KHR                    stageMask;
+};
+
+static bool PrepareCmdResetEvent2KHR(ReplayPrep &prep) {
+    CmdResetEvent2KHRArgs &args = prep.NewArgs<CmdResetEvent2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.event) &&
+           prep.Value(args.stageMask);
+}
+
+static VkResult InvokeCmdResetEvent2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdResetEvent2KHRArgs &args = *static_cast<const CmdResetEvent2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdResetEvent2KHR>(proc)(args.commandBuffer, args.event, args.stageMask);
+    return VK_SUCCESS;
+}
+
+struct CmdWaitEvents2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    eventCount;
+    const VkEvent*                              pEvents;
+    const VkDependencyInfoKHR*                  pDependencyInfos;
+};
+
+static bool PrepareCmdWaitEvents2KHR(ReplayPrep &prep) {
+    CmdWaitEvents2KHRArgs &args = prep.NewArgs<CmdWaitEvents2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.eventCount) &&
+           prep.Handles(args.pEvents) &&
+           prep.Array(args.pDependencyInfos);
+}
+
+static VkResult InvokeCmdWaitEvents2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdWaitEvents2KHRArgs &args = *static_cast<const CmdWaitEvents2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdWaitEvents2KHR>(proc)(args.commandBuffer, args.eventCount, args.pEvents, args.pDependencyInfos);
+    return VK_SUCCESS;
+}
+
+struct CmdPipelineBarrier2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkDependencyInfoKHR*                  pDependencyInfo;
+};
+
+static bool PrepareCmdPipelineBarrier2KHR(ReplayPrep &prep) {
+    CmdPipelineBarrier2KHRArgs &args = prep.NewArgs<CmdPipelineBarrier2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pDependencyInfo);
+}
+
+static VkResult InvokeCmdPipelineBarrier2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdPipelineBarrier2KHRArgs &args = *static_cast<const CmdPipelineBarrier2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdPipelineBarrier2KHR>(proc)(args.commandBuffer, args.pDependencyInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdWriteTimestamp2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineStageFlags2KHR                    stage;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+};
+
+static bool PrepareCmdWriteTimestamp2KHR(ReplayPrep &prep) {
+    CmdWriteTimestamp2KHRArgs &args = prep.NewArgs<CmdWriteTimestamp2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.stage) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.query);
+}
+
+static VkResult InvokeCmdWriteTimestamp2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdWriteTimestamp2KHRArgs &args = *static_cast<const CmdWriteTimestamp2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdWriteTimestamp2KHR>(proc)(args.commandBuffer, args.stage, args.queryPool, args.query);
+    return VK_SUCCESS;
+}
+
+struct QueueSubmit2KHRArgs {
+    VkQueue                                     queue;
+    uint32_t                                    submitCount;
+    const VkSubmitInfo2KHR*                     pSubmits;
+    VkFence                                     fence;
+};
+
+static bool PrepareQueueSubmit2KHR(ReplayPrep &prep) {
+    QueueSubmit2KHRArgs &args = prep.NewArgs<QueueSubmit2KHRArgs>();
+    return prep.Handle(args.queue) &&
+           prep.Value(args.submitCount) &&
+           prep.Array(args.pSubmits) &&
+           prep.Handle(args.fence) &&
+           prep.Result();
+}
+
+static VkResult InvokeQueueSubmit2KHR(PFN_vkVoidFunction proc, void *data) {
+    const QueueSubmit2KHRArgs &args = *static_cast<const QueueSubmit2KHRArgs *>(data);
+    return reinterpret_cast<PFN_vkQueueSubmit2KHR>(proc)(args.queue, args.submitCount, args.pSubmits, args.fence);
+}
+
+struct CmdWriteBufferMarker2AMDArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineStageFlags2KHR                    stage;
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    uint32_t                                    marker;
+};
+
+static bool PrepareCmdWriteBufferMarker2AMD(ReplayPrep &prep) {
+    CmdWriteBufferMarker2AMDArgs &args = prep.NewArgs<CmdWriteBufferMarker2AMDArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.stage) &&
+           prep.Handle(args.dstBuffer) &&
+           prep.Value(args.dstOffset) &&
+           prep.Value(args.marker);
+}
+
+static VkResult InvokeCmdWriteBufferMarker2AMD(PFN_vkVoidFunction proc, void *data) {
+    const CmdWriteBufferMarker2AMDArgs &args = *static_cast<const CmdWriteBufferMarker2AMDArgs *>(data);
+    reinterpret_cast<PFN_vkCmdWriteBufferMarker2AMD>(proc)(args.commandBuffer, args.stage, args.dstBuffer, args.dstOffset, args.marker);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyBuffer2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkCopyBufferInfo2KHR*                 pCopyBufferInfo;
+};
+
+static bool PrepareCmdCopyBuffer2KHR(ReplayPrep &prep) {
+    CmdCopyBuffer2KHRArgs &args = prep.NewArgs<CmdCopyBuffer2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pCopyBufferInfo);
+}
+
+static VkResult InvokeCmdCopyBuffer2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyBuffer2KHRArgs &args = *static_cast<const CmdCopyBuffer2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyBuffer2KHR>(proc)(args.commandBuffer, args.pCopyBufferInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyImage2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkCopyImageInfo2KHR*                  pCopyImageInfo;
+};
+
+static bool PrepareCmdCopyImage2KHR(ReplayPrep &prep) {
+    CmdCopyImage2KHRArgs &args = prep.NewArgs<CmdCopyImage2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pCopyImageInfo);
+}
+
+static VkResult InvokeCmdCopyImage2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyImage2KHRArgs &args = *static_cast<const CmdCopyImage2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyImage2KHR>(proc)(args.commandBuffer, args.pCopyImageInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyBufferToImage2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkCopyBufferToImageInfo2KHR*          pCopyBufferToImageInfo;
+};
+
+static bool PrepareCmdCopyBufferToImage2KHR(ReplayPrep &prep) {
+    CmdCopyBufferToImage2KHRArgs &args = prep.NewArgs<CmdCopyBufferToImage2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pCopyBufferToImageInfo);
+}
+
+static VkResult InvokeCmdCopyBufferToImage2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyBufferToImage2KHRArgs &args = *static_cast<const CmdCopyBufferToImage2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyBufferToImage2KHR>(proc)(args.commandBuffer, args.pCopyBufferToImageInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyImageToBuffer2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkCopyImageToBufferInfo2KHR*          pCopyImageToBufferInfo;
+};
+
+static bool PrepareCmdCopyImageToBuffer2KHR(ReplayPrep &prep) {
+    CmdCopyImageToBuffer2KHRArgs &args = prep.NewArgs<CmdCopyImageToBuffer2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pCopyImageToBufferInfo);
+}
+
+static VkResult InvokeCmdCopyImageToBuffer2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyImageToBuffer2KHRArgs &args = *static_cast<const CmdCopyImageToBuffer2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyImageToBuffer2KHR>(proc)(args.commandBuffer, args.pCopyImageToBufferInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdBlitImage2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkBlitImageInfo2KHR*                  pBlitImageInfo;
+};
+
+static bool PrepareCmdBlitImage2KHR(ReplayPrep &prep) {
+    CmdBlitImage2KHRArgs &args = prep.NewArgs<CmdBlitImage2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pBlitImageInfo);
+}
+
+static VkResult InvokeCmdBlitImage2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdBlitImage2KHRArgs &args = *static_cast<const CmdBlitImage2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBlitImage2KHR>(proc)(args.commandBuffer, args.pBlitImageInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdResolveImage2KHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkResolveImageInfo2KHR*               pResolveImageInfo;
+};
+
+static bool PrepareCmdResolveImage2KHR(ReplayPrep &prep) {
+    CmdResolveImage2KHRArgs &args = prep.NewArgs<CmdResolveImage2KHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pResolveImageInfo);
+}
+
+static VkResult InvokeCmdResolveImage2KHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdResolveImage2KHRArgs &args = *static_cast<const CmdResolveImage2KHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdResolveImage2KHR>(proc)(args.commandBuffer, args.pResolveImageInfo);
+    return VK_SUCCESS;
+}
+
+struct DestroyDebugReportCallbackEXTArgs {
+    VkInstance                                  instance;
+    VkDebugReportCallbackEXT                    callback;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyDebugReportCallbackEXT(ReplayPrep &prep) {
+    DestroyDebugReportCallbackEXTArgs &args = prep.NewArgs<DestroyDebugReportCallbackEXTArgs>();
+    return prep.Handle(args.instance) &&
+           prep.Handle(args.callback) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyDebugReportCallbackEXT(PFN_vkVoidFunction proc, void *data) {
+    const DestroyDebugReportCallbackEXTArgs &args = *static_cast<const DestroyDebugReportCallbackEXTArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(proc)(args.instance, args.callback, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct DebugReportMessageEXTArgs {
+    VkInstance                                  instance;
+    VkDebugReportFlagsEXT                       flags;
+    VkDebugReportObjectTypeEXT                  objectType;
+    uint64_t                                    object;
+    size_t                                      location;
+    int32_t                                     messageCode;
+    const char*                                 pLayerPrefix;
+    const char*                                 pMessage;
+};
+
+static bool PrepareDebugReportMessageEXT(ReplayPrep &prep) {
+    DebugReportMessageEXTArgs &args = prep.NewArgs<DebugReportMessageEXTArgs>();
+    return prep.Handle(args.instance) &&
+           prep.Value(args.flags) &&
+           prep.Value(args.objectType) &&
+           prep.Value(args.object) &&
+           prep.Value(args.location) &&
+           prep.Value(args.messageCode) &&
+           prep.String(args.pLayerPrefix) &&
+           prep.String(args.pMessage);
+}
+
+static VkResult InvokeDebugReportMessageEXT(PFN_vkVoidFunction proc, void *data) {
+    const DebugReportMessageEXTArgs &args = *static_cast<const DebugReportMessageEXTArgs *>(data);
+    reinterpret_cast<PFN_vkDebugReportMessageEXT>(proc)(args.instance, args.flags, args.objectType, args.object, args.location, args.messageCode, args.pLayerPrefix, args.pMessage);
+    return VK_SUCCESS;
+}
+
+struct CmdDebugMarkerBeginEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo;
+};
+
+static bool PrepareCmdDebugMarkerBeginEXT(ReplayPrep &prep) {
+    CmdDebugMarkerBeginEXTArgs &args = prep.NewArgs<CmdDebugMarkerBeginEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pMarkerInfo);
+}
+
+static VkResult InvokeCmdDebugMarkerBeginEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdDebugMarkerBeginEXTArgs &args = *static_cast<const CmdDebugMarkerBeginEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDebugMarkerBeginEXT>(proc)(args.commandBuffer, args.pMarkerInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdDebugMarkerEndEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+};
+
+static bool PrepareCmdDebugMarkerEndEXT(ReplayPrep &prep) {
+    CmdDebugMarkerEndEXTArgs &args = prep.NewArgs<CmdDebugMarkerEndEXTArgs>();
+    return prep.Handle(args.commandBuffer);
+}
+
+static VkResult InvokeCmdDebugMarkerEndEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdDebugMarkerEndEXTArgs &args = *static_cast<const CmdDebugMarkerEndEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDebugMarkerEndEXT>(proc)(args.commandBuffer);
+    return VK_SUCCESS;
+}
+
+struct CmdDebugMarkerInsertEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo;
+};
+
+static bool PrepareCmdDebugMarkerInsertEXT(ReplayPrep &prep) {
+    CmdDebugMarkerInsertEXTArgs &args = prep.NewArgs<CmdDebugMarkerInsertEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pMarkerInfo);
+}
+
+static VkResult InvokeCmdDebugMarkerInsertEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdDebugMarkerInsertEXTArgs &args = *static_cast<const CmdDebugMarkerInsertEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDebugMarkerInsertEXT>(proc)(args.commandBuffer, args.pMarkerInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdBindTransformFeedbackBuffersEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstBinding;
+    uint32_t                                    bindingCount;
+    const VkBuffer*                             pBuffers;
+    const VkDeviceSize*                         pOffsets;
+    const VkDeviceSize*                         pSizes;
+};
+
+static bool PrepareCmdBindTransformFeedbackBuffersEXT(ReplayPrep &prep) {
+    CmdBindTransformFeedbackBuffersEXTArgs &args = prep.NewArgs<CmdBindTransformFeedbackBuffersEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstBinding) &&
+           prep.Value(args.bindingCount) &&
+           prep.Handles(args.pBuffers) &&
+           prep.Array(args.pOffsets) &&
+           prep.Array(args.pSizes);
+}
+
+static VkResult InvokeCmdBindTransformFeedbackBuffersEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdBindTransformFeedbackBuffersEXTArgs &args = *static_cast<const CmdBindTransformFeedbackBuffersEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBindTransformFeedbackBuffersEXT>(proc)(args.commandBuffer, args.firstBinding, args.bindingCount, args.pBuffers, args.pOffsets, args.pSizes);
+    return VK_SUCCESS;
+}
+
+struct CmdBeginTransformFeedbackEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstCounterBuffer;
+    uint32_t                                    counterBufferCount;
+    const VkBuffer*                             pCounterBuffers;
+    const VkDeviceSize*                         pCounterBufferOffsets;
+};
+
+static bool PrepareCmdBeginTransformFeedbackEXT(ReplayPrep &prep) {
+    CmdBeginTransformFeedbackEXTArgs &args = prep.NewArgs<CmdBeginTransformFeedbackEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstCounterBuffer) &&
+           prep.Value(args.counterBufferCount) &&
+           prep.Handles(args.pCounterBuffers) &&
+           prep.Array(args.pCounterBufferOffsets);
+}
+
+static VkResult InvokeCmdBeginTransformFeedbackEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdBeginTransformFeedbackEXTArgs &args = *static_cast<const CmdBeginTransformFeedbackEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBeginTransformFeedbackEXT>(proc)(args.commandBuffer, args.firstCounterBuffer, args.counterBufferCount, args.pCounterBuffers, args.pCounterBufferOffsets);
+    return VK_SUCCESS;
+}
+
+struct CmdEndTransformFeedbackEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstCounterBuffer;
+    uint32_t                                    counterBufferCount;
+    const VkBuffer*                             pCounterBuffers;
+    const VkDeviceSize*                         pCounterBufferOffsets;
+};
+
+static bool PrepareCmdEndTransformFeedbackEXT(ReplayPrep &prep) {
+    CmdEndTransformFeedbackEXTArgs &args = prep.NewArgs<CmdEndTransformFeedbackEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstCounterBuffer) &&
+           prep.Value(args.counterBufferCount) &&
+           prep.Handles(args.pCounterBuffers) &&
+           prep.Array(args.pCounterBufferOffsets);
+}
+
+static VkResult InvokeCmdEndTransformFeedbackEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdEndTransformFeedbackEXTArgs &args = *static_cast<const CmdEndTransformFeedbackEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdEndTransformFeedbackEXT>(proc)(args.commandBuffer, args.firstCounterBuffer, args.counterBufferCount, args.pCounterBuffers, args.pCounterBufferOffsets);
+    return VK_SUCCESS;
+}
+
+struct CmdBeginQueryIndexedEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+    VkQueryControlFlags                         flags;
+    uint32_t                                    index;
+};
+
+static bool PrepareCmdBeginQueryIndexedEXT(ReplayPrep &prep) {
+    CmdBeginQueryIndexedEXTArgs &args = prep.NewArgs<CmdBeginQueryIndexedEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.query) &&
+           prep.Value(args.flags) &&
+           prep.Value(args.index);
+}
+
+static VkResult InvokeCmdBeginQueryIndexedEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdBeginQueryIndexedEXTArgs &args = *static_cast<const CmdBeginQueryIndexedEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBeginQueryIndexedEXT>(proc)(args.commandBuffer, args.queryPool, args.query, args.flags, args.index);
+    return VK_SUCCESS;
+}
+
+struct CmdEndQueryIndexedEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    query;
+    uint32_t                                    index;
+};
+
+static bool PrepareCmdEndQueryIndexedEXT(ReplayPrep &prep) {
+    CmdEndQueryIndexedEXTArgs &args = prep.NewArgs<CmdEndQueryIndexedEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.query) &&
+           prep.Value(args.index);
+}
+
+static VkResult InvokeCmdEndQueryIndexedEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdEndQueryIndexedEXTArgs &args = *static_cast<const CmdEndQueryIndexedEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdEndQueryIndexedEXT>(proc)(args.commandBuffer, args.queryPool, args.query, args.index);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawIndirectByteCountEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    instanceCount;
+    uint32_t                                    firstInstance;
+    VkBuffer                                    counterBuffer;
+    VkDeviceSize                                counterBufferOffset;
+    uint32_t                                    counterOffset;
+    uint32_t                                    vertexStride;
+};
+
+static bool PrepareCmdDrawIndirectByteCountEXT(ReplayPrep &prep) {
+    CmdDrawIndirectByteCountEXTArgs &args = prep.NewArgs<CmdDrawIndirectByteCountEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.instanceCount) &&
+           prep.Value(args.firstInstance) &&
+           prep.Handle(args.counterBuffer) &&
+           prep.Value(args.counterBufferOffset) &&
+           prep.Value(args.counterOffset) &&
+           prep.Value(args.vertexStride);
+}
+
+static VkResult InvokeCmdDrawIndirectByteCountEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndirectByteCountEXTArgs &args = *static_cast<const CmdDrawIndirectByteCountEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndirectByteCountEXT>(proc)(args.commandBuffer, args.instanceCount, args.firstInstance, args.counterBuffer, args.counterBufferOffset, args.counterOffset, args.vertexStride);
+    return VK_SUCCESS;
+}
+
+struct DestroyCuModuleNVXArgs {
+    VkDevice                                    device;
+    VkCuModuleNVX                               module;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyCuModuleNVX(ReplayPrep &prep) {
+    DestroyCuModuleNVXArgs &args = prep.NewArgs<DestroyCuModuleNVXArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.module) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyCuModuleNVX(PFN_vkVoidFunction proc, void *data) {
+    const DestroyCuModuleNVXArgs &args = *static_cast<const DestroyCuModuleNVXArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyCuModuleNVX>(proc)(args.device, args.module, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct DestroyCuFunctionNVXArgs {
+    VkDevice                                    device;
+    VkCuFunctionNVX                             function;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyCuFunctionNVX(ReplayPrep &prep) {
+    DestroyCuFunctionNVXArgs &args = prep.NewArgs<DestroyCuFunctionNVXArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.function) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyCuFunctionNVX(PFN_vkVoidFunction proc, void *data) {
+    const DestroyCuFunctionNVXArgs &args = *static_cast<const DestroyCuFunctionNVXArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyCuFunctionNVX>(proc)(args.device, args.function, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct GetImageViewAddressNVXArgs {
+    VkDevice                                    device;
+    VkImageView                                 imageView;
+    VkImageViewAddressPropertiesNVX*            pProperties;
+};
+
+static bool PrepareGetImageViewAddressNVX(ReplayPrep &prep) {
+    GetImageViewAddressNVXArgs &args = prep.NewArgs<GetImageViewAddressNVXArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.imageView) &&
+           prep.Array(args.pProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetImageViewAddressNVX(PFN_vkVoidFunction proc, void *data) {
+    const GetImageViewAddressNVXArgs &args = *static_cast<const GetImageViewAddressNVXArgs *>(data);
+    return reinterpret_cast<PFN_vkGetImageViewAddressNVX>(proc)(args.device, args.imageView, args.pProperties);
+}
+
+struct CmdDrawIndirectCountAMDArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawIndirectCountAMD(ReplayPrep &prep) {
+    CmdDrawIndirectCountAMDArgs &args = prep.NewArgs<CmdDrawIndirectCountAMDArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Handle(args.countBuffer) &&
+           prep.Value(args.countBufferOffset) &&
+           prep.Value(args.maxDrawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawIndirectCountAMD(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndirectCountAMDArgs &args = *static_cast<const CmdDrawIndirectCountAMDArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndirectCountAMD>(proc)(args.commandBuffer, args.buffer, args.offset, args.countBuffer, args.countBufferOffset, args.maxDrawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawIndexedIndirectCountAMDArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawIndexedIndirectCountAMD(ReplayPrep &prep) {
+    CmdDrawIndexedIndirectCountAMDArgs &args = prep.NewArgs<CmdDrawIndexedIndirectCountAMDArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Handle(args.countBuffer) &&
+           prep.Value(args.countBufferOffset) &&
+           prep.Value(args.maxDrawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawIndexedIndirectCountAMD(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawIndexedIndirectCountAMDArgs &args = *static_cast<const CmdDrawIndexedIndirectCountAMDArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountAMD>(proc)(args.commandBuffer, args.buffer, args.offset, args.countBuffer, args.countBufferOffset, args.maxDrawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct GetShaderInfoAMDArgs {
+    VkDevice                                    device;
+    VkPipeline                                  pipeline;
+    VkShaderStageFlagBits                       shaderStage;
+    VkShaderInfoTypeAMD                         infoType;
+    size_t*                                     pInfoSize;
+    void*                                       pInfo;
+};
+
+static bool PrepareGetShaderInfoAMD(ReplayPrep &prep) {
+    GetShaderInfoAMDArgs &args = prep.NewArgs<GetShaderInfoAMDArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipeline) &&
+           prep.Value(args.shaderStage) &&
+           prep.Value(args.infoType) &&
+           prep.Array(args.pInfoSize) &&
+           prep.Bytes(args.pInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetShaderInfoAMD(PFN_vkVoidFunction proc, void *data) {
+    const GetShaderInfoAMDArgs &args = *static_cast<const GetShaderInfoAMDArgs *>(data);
+    return reinterpret_cast<PFN_vkGetShaderInfoAMD>(proc)(args.device, args.pipeline, args.shaderStage, args.infoType, args.pInfoSize, args.pInfo);
+}
+
+struct GetPhysicalDeviceExternalImageFormatPropertiesNVArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkFormat                                    format;
+    VkImageType                                 type;
+    VkImageTiling                               tiling;
+    VkImageUsageFlags                           usage;
+    VkImageCreateFlags                          flags;
+    VkExternalMemoryHandleTypeFlagsNV           externalHandleType;
+    VkExternalImageFormatPropertiesNV*          pExternalImageFormatProperties;
+};
+
+static bool PrepareGetPhysicalDeviceExternalImageFormatPropertiesNV(ReplayPrep &prep) {
+    GetPhysicalDeviceExternalImageFormatPropertiesNVArgs &args = prep.NewArgs<GetPhysicalDeviceExternalImageFormatPropertiesNVArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.format) &&
+           prep.Value(args.type) &&
+           prep.Value(args.tiling) &&
+           prep.Value(args.usage) &&
+           prep.Value(args.flags) &&
+           prep.Value(args.externalHandleType) &&
+           prep.Array(args.pExternalImageFormatProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceExternalImageFormatPropertiesNV(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceExternalImageFormatPropertiesNVArgs &args = *static_cast<const GetPhysicalDeviceExternalImageFormatPropertiesNVArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV>(proc)(args.physicalDevice, args.format, args.type, args.tiling, args.usage, args.flags, args.externalHandleType, args.pExternalImageFormatProperties);
+}
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+struct GetMemoryWin32HandleNVArgs {
+    VkDevice                                    device;
+    VkDeviceMemory                              memory;
+    VkExternalMemoryHandleTypeFlagsNV           handleType;
+    HANDLE*                                     pHandle;
+};
+
+static bool PrepareGetMemoryWin32HandleNV(ReplayPrep &prep) {
+    GetMemoryWin32HandleNVArgs &args = prep.NewArgs<GetMemoryWin32HandleNVArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.memory) &&
+           prep.Value(args.handleType) &&
+           prep.Address(args.pHandle) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetMemoryWin32HandleNV(PFN_vkVoidFunction proc, void *data) {
+    const GetMemoryWin32HandleNVArgs &args = *static_cast<const GetMemoryWin32HandleNVArgs *>(data);
+    return reinterpret_cast<PFN_vkGetMemoryWin32HandleNV>(proc)(args.device, args.memory, args.handleType, args.pHandle);
+}
+#endif
+
+struct CmdBeginConditionalRenderingEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin;
+};
+
+static bool PrepareCmdBeginConditionalRenderingEXT(ReplayPrep &prep) {
+    CmdBeginConditionalRenderingEXTArgs &args = prep.NewArgs<CmdBeginConditionalRenderingEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pConditionalRenderingBegin);
+}
+
+static VkResult InvokeCmdBeginConditionalRenderingEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdBeginConditionalRenderingEXTArgs &args = *static_cast<const CmdBeginConditionalRenderingEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBeginConditionalRenderingEXT>(proc)(args.commandBuffer, args.pConditionalRenderingBegin);
+    return VK_SUCCESS;
+}
+
+struct CmdEndConditionalRenderingEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+};
+
+static bool PrepareCmdEndConditionalRenderingEXT(ReplayPrep &prep) {
+    CmdEndConditionalRenderingEXTArgs &args = prep.NewArgs<CmdEndConditionalRenderingEXTArgs>();
+    return prep.Handle(args.commandBuffer);
+}
+
+static VkResult InvokeCmdEndConditionalRenderingEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdEndConditionalRenderingEXTArgs &args = *static_cast<const CmdEndConditionalRenderingEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdEndConditionalRenderingEXT>(proc)(args.commandBuffer);
+    return VK_SUCCESS;
+}
+
+struct CmdSetViewportWScalingNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstViewport;
+    uint32_t                                    viewportCount;
+    const VkViewportWScalingNV*                 pViewportWScalings;
+};
+
+static bool PrepareCmdSetViewportWScalingNV(ReplayPrep &prep) {
+    CmdSetViewportWScalingNVArgs &args = prep.NewArgs<CmdSetViewportWScalingNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstViewport) &&
+           prep.Value(args.viewportCount) &&
+           prep.Array(args.pViewportWScalings);
+}
+
+static VkResult InvokeCmdSetViewportWScalingNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetViewportWScalingNVArgs &args = *static_cast<const CmdSetViewportWScalingNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetViewportWScalingNV>(proc)(args.commandBuffer, args.firstViewport, args.viewportCount, args.pViewportWScalings);
+    return VK_SUCCESS;
+}
+
+struct ReleaseDisplayEXTArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkDisplayKHR                                display;
+};
+
+static bool PrepareReleaseDisplayEXT(ReplayPrep &prep) {
+    ReleaseDisplayEXTArgs &args = prep.NewArgs<ReleaseDisplayEXTArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Handle(args.display) &&
+           prep.Result();
+}
+
+static VkResult InvokeReleaseDisplayEXT(PFN_vkVoidFunction proc, void *data) {
+    const ReleaseDisplayEXTArgs &args = *static_cast<const ReleaseDisplayEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkReleaseDisplayEXT>(proc)(args.physicalDevice, args.display);
+}
+
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+struct AcquireXlibDisplayEXTArgs {
+    VkPhysicalDevice                            physicalDevice;
+    Display*                                    dpy;
+    VkDisplayKHR                                display;
+};
+
+static bool PrepareAcquireXlibDisplayEXT(ReplayPrep &prep) {
+    AcquireXlibDisplayEXTArgs &args = prep.NewArgs<AcquireXlibDisplayEXTArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Address(args.dpy) &&
+           prep.Handle(args.display) &&
+           prep.Result();
+}
+
+static VkResult InvokeAcquireXlibDisplayEXT(PFN_vkVoidFunction proc, void *data) {
+    const AcquireXlibDisplayEXTArgs &args = *static_cast<const AcquireXlibDisplayEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkAcquireXlibDisplayEXT>(proc)(args.physicalDevice, args.dpy, args.display);
+}
+#endif
+
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+struct GetRandROutputDisplayEXTArgs {
+    VkPhysicalDevice                            physicalDevice;
+    Display*                                    dpy;
+    RROutput                                    rrOutput;
+    VkDisplayKHR*                               pDisplay;
+};
+
+static bool PrepareGetRandROutputDisplayEXT(ReplayPrep &prep) {
+    GetRandROutputDisplayEXTArgs &args = prep.NewArgs<GetRandROutputDisplayEXTArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Address(args.dpy) &&
+           prep.Value(args.rrOutput) &&
+           prep.NewHandles(args.pDisplay) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetRandROutputDisplayEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetRandROutputDisplayEXTArgs &args = *static_cast<const GetRandROutputDisplayEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetRandROutputDisplayEXT>(proc)(args.physicalDevice, args.dpy, args.rrOutput, args.pDisplay);
+}
+#endif
+
+struct GetPhysicalDeviceSurfaceCapabilities2EXTArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkSurfaceKHR                                surface;
+    VkSurfaceCapabilities2EXT*                  pSurfaceCapabilities;
+};
+
+static bool PrepareGetPhysicalDeviceSurfaceCapabilities2EXT(ReplayPrep &prep) {
+    GetPhysicalDeviceSurfaceCapabilities2EXTArgs &args = prep.NewArgs<GetPhysicalDeviceSurfaceCapabilities2EXTArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Handle(args.surface) &&
+           prep.Array(args.pSurfaceCapabilities) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceSurfaceCapabilities2EXT(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSurfaceCapabilities2EXTArgs &args = *static_cast<const GetPhysicalDeviceSurfaceCapabilities2EXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT>(proc)(args.physicalDevice, args.surface, args.pSurfaceCapabilities);
+}
+
+struct DisplayPowerControlEXTArgs {
+    VkDevice                                    device;
+    VkDisplayKHR                                display;
+    const VkDisplayPowerInfoEXT*                pDisplayPowerInfo;
+};
+
+static bool PrepareDisplayPowerControlEXT(ReplayPrep &prep) {
+    DisplayPowerControlEXTArgs &args = prep.NewArgs<DisplayPowerControlEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.display) &&
+           prep.Array(args.pDisplayPowerInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeDisplayPowerControlEXT(PFN_vkVoidFunction proc, void *data) {
+    const DisplayPowerControlEXTArgs &args = *static_cast<const DisplayPowerControlEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkDisplayPowerControlEXT>(proc)(args.device, args.display, args.pDisplayPowerInfo);
+}
+
+struct RegisterDeviceEventEXTArgs {
+    VkDevice                                    device;
+    const VkDeviceEventInfoEXT*                 pDeviceEventInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkFence*                                    pFence;
+};
+
+static bool PrepareRegisterDeviceEventEXT(ReplayPrep &prep) {
+    RegisterDeviceEventEXTArgs &args = prep.NewArgs<RegisterDeviceEventEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pDeviceEventInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pFence) &&
+           prep.Result();
+}
+
+static VkResult InvokeRegisterDeviceEventEXT(PFN_vkVoidFunction proc, void *data) {
+    const RegisterDeviceEventEXTArgs &args = *static_cast<const RegisterDeviceEventEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkRegisterDeviceEventEXT>(proc)(args.device, args.pDeviceEventInfo, args.pAllocator, args.pFence);
+}
+
+struct RegisterDisplayEventEXTArgs {
+    VkDevice                                    device;
+    VkDisplayKHR                                display;
+    const VkDisplayEventInfoEXT*                pDisplayEventInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkFence*                                    pFence;
+};
+
+static bool PrepareRegisterDisplayEventEXT(ReplayPrep &prep) {
+    RegisterDisplayEventEXTArgs &args = prep.NewArgs<RegisterDisplayEventEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.display) &&
+           prep.Array(args.pDisplayEventInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pFence) &&
+           prep.Result();
+}
+
+static VkResult InvokeRegisterDisplayEventEXT(PFN_vkVoidFunction proc, void *data) {
+    const RegisterDisplayEventEXTArgs &args = *static_cast<const RegisterDisplayEventEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkRegisterDisplayEventEXT>(proc)(args.device, args.display, args.pDisplayEventInfo, args.pAllocator, args.pFence);
+}
+
+struct GetSwapchainCounterEXTArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapchain;
+    VkSurfaceCounterFlagBitsEXT                 counter;
+    uint64_t*                                   pCounterValue;
+};
+
+static bool PrepareGetSwapchainCounterEXT(ReplayPrep &prep) {
+    GetSwapchainCounterEXTArgs &args = prep.NewArgs<GetSwapchainCounterEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapchain) &&
+           prep.Value(args.counter) &&
+           prep.Array(args.pCounterValue) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetSwapchainCounterEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetSwapchainCounterEXTArgs &args = *static_cast<const GetSwapchainCounterEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetSwapchainCounterEXT>(proc)(args.device, args.swapchain, args.counter, args.pCounterValue);
+}
+
+struct GetRefreshCycleDurationGOOGLEArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapchain;
+    VkRefreshCycleDurationGOOGLE*               pDisplayTimingProperties;
+};
+
+static bool PrepareGetRefreshCycleDurationGOOGLE(ReplayPrep &prep) {
+    GetRefreshCycleDurationGOOGLEArgs &args = prep.NewArgs<GetRefreshCycleDurationGOOGLEArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapchain) &&
+           prep.Array(args.pDisplayTimingProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetRefreshCycleDurationGOOGLE(PFN_vkVoidFunction proc, void *data) {
+    const GetRefreshCycleDurationGOOGLEArgs &args = *static_cast<const GetRefreshCycleDurationGOOGLEArgs *>(data);
+    return reinterpret_cast<PFN_vkGetRefreshCycleDurationGOOGLE>(proc)(args.device, args.swapchain, args.pDisplayTimingProperties);
+}
+
+struct GetPastPresentationTimingGOOGLEArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapchain;
+    uint32_t*                                   pPresentationTimingCount;
+    VkPastPresentationTimingGOOGLE*             pPresentationTimings;
+};
+
+static bool PrepareGetPastPresentationTimingGOOGLE(ReplayPrep &prep) {
+    GetPastPresentationTimingGOOGLEArgs &args = prep.NewArgs<GetPastPresentationTimingGOOGLEArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapchain) &&
+           prep.Array(args.pPresentationTimingCount) &&
+           prep.Array(args.pPresentationTimings) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPastPresentationTimingGOOGLE(PFN_vkVoidFunction proc, void *data) {
+    const GetPastPresentationTimingGOOGLEArgs &args = *static_cast<const GetPastPresentationTimingGOOGLEArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPastPresentationTimingGOOGLE>(proc)(args.device, args.swapchain, args.pPresentationTimingCount, args.pPresentationTimings);
+}
+
+struct CmdSetDiscardRectangleEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstDiscardRectangle;
+    uint32_t                                    discardRectangleCount;
+    const VkRect2D*                             pDiscardRectangles;
+};
+
+static bool PrepareCmdSetDiscardRectangleEXT(ReplayPrep &prep) {
+    CmdSetDiscardRectangleEXTArgs &args = prep.NewArgs<CmdSetDiscardRectangleEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstDiscardRectangle) &&
+           prep.Value(args.discardRectangleCount) &&
+           prep.Array(args.pDiscardRectangles);
+}
+
+static VkResult InvokeCmdSetDiscardRectangleEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDiscardRectangleEXTArgs &args = *static_cast<const CmdSetDiscardRectangleEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDiscardRectangleEXT>(proc)(args.commandBuffer, args.firstDiscardRectangle, args.discardRectangleCount, args.pDiscardRectangles);
+    return VK_SUCCESS;
+}
+
+struct SetHdrMetadataEXTArgs {
+    VkDevice                                    device;
+    uint32_t                                    swapchainCount;
+    const VkSwapchainKHR*                       pSwapchains;
+    const VkHdrMetadataEXT*                     pMetadata;
+};
+
+static bool PrepareSetHdrMetadataEXT(ReplayPrep &prep) {
+    SetHdrMetadataEXTArgs &args = prep.NewArgs<SetHdrMetadataEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.swapchainCount) &&
+           prep.Handles(args.pSwapchains) &&
+           prep.Array(args.pMetadata);
+}
+
+static VkResult InvokeSetHdrMetadataEXT(PFN_vkVoidFunction proc, void *data) {
+    const SetHdrMetadataEXTArgs &args = *static_cast<const SetHdrMetadataEXTArgs *>(data);
+    reinterpret_cast<PFN_vkSetHdrMetadataEXT>(proc)(args.device, args.swapchainCount, args.pSwapchains, args.pMetadata);
+    return VK_SUCCESS;
+}
+
+struct QueueBeginDebugUtilsLabelEXTArgs {
+    VkQueue                                     queue;
+    const VkDebugUtilsLabelEXT*                 pLabelInfo;
+};
+
+static bool PrepareQueueBeginDebugUtilsLabelEXT(ReplayPrep &prep) {
+    QueueBeginDebugUtilsLabelEXTArgs &args = prep.NewArgs<QueueBeginDebugUtilsLabelEXTArgs>();
+    return prep.Handle(args.queue) &&
+           prep.Array(args.pLabelInfo);
+}
+
+static VkResult InvokeQueueBeginDebugUtilsLabelEXT(PFN_vkVoidFunction proc, void *data) {
+    const QueueBeginDebugUtilsLabelEXTArgs &args = *static_cast<const QueueBeginDebugUtilsLabelEXTArgs *>(data);
+    reinterpret_cast<PFN_vkQueueBeginDebugUtilsLabelEXT>(proc)(args.queue, args.pLabelInfo);
+    return VK_SUCCESS;
+}
+
+struct QueueEndDebugUtilsLabelEXTArgs {
+    VkQueue                                     queue;
+};
+
+static bool PrepareQueueEndDebugUtilsLabelEXT(ReplayPrep &prep) {
+    QueueEndDebugUtilsLabelEXTArgs &args = prep.NewArgs<QueueEndDebugUtilsLabelEXTArgs>();
+    return prep.Handle(args.queue);
+}
+
+static VkResult InvokeQueueEndDebugUtilsLabelEXT(PFN_vkVoidFunction proc, void *data) {
+    const QueueEndDebugUtilsLabelEXTArgs &args = *static_cast<const QueueEndDebugUtilsLabelEXTArgs *>(data);
+    reinterpret_cast<PFN_vkQueueEndDebugUtilsLabelEXT>(proc)(args.queue);
+    return VK_SUCCESS;
+}
+
+struct QueueInsertDebugUtilsLabelEXTArgs {
+    VkQueue                                     queue;
+    const VkDebugUtilsLabelEXT*                 pLabelInfo;
+};
+
+static bool PrepareQueueInsertDebugUtilsLabelEXT(ReplayPrep &prep) {
+    QueueInsertDebugUtilsLabelEXTArgs &args = prep.NewArgs<QueueInsertDebugUtilsLabelEXTArgs>();
+    return prep.Handle(args.queue) &&
+           prep.Array(args.pLabelInfo);
+}
+
+static VkResult InvokeQueueInsertDebugUtilsLabelEXT(PFN_vkVoidFunction proc, void *data) {
+    const QueueInsertDebugUtilsLabelEXTArgs &args = *static_cast<const QueueInsertDebugUtilsLabelEXTArgs *>(data);
+    reinterpret_cast<PFN_vkQueueInsertDebugUtilsLabelEXT>(proc)(args.queue, args.pLabelInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdBeginDebugUtilsLabelEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkDebugUtilsLabelEXT*                 pLabelInfo;
+};
+
+static bool PrepareCmdBeginDebugUtilsLabelEXT(ReplayPrep &prep) {
+    CmdBeginDebugUtilsLabelEXTArgs &args = prep.NewArgs<CmdBeginDebugUtilsLabelEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pLabelInfo);
+}
+
+static VkResult InvokeCmdBeginDebugUtilsLabelEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdBeginDebugUtilsLabelEXTArgs &args = *static_cast<const CmdBeginDebugUtilsLabelEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBeginDebugUtilsLabelEXT>(proc)(args.commandBuffer, args.pLabelInfo);
+    return VK_SUCCESS;
+}
+
+struct CmdEndDebugUtilsLabelEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+};
+
+static bool PrepareCmdEndDebugUtilsLabelEXT(ReplayPrep &prep) {
+    CmdEndDebugUtilsLabelEXTArgs &args = prep.NewArgs<CmdEndDebugUtilsLabelEXTArgs>();
+    return prep.Handle(args.commandBuffer);
+}
+
+static VkResult InvokeCmdEndDebugUtilsLabelEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdEndDebugUtilsLabelEXTArgs &args = *static_cast<const CmdEndDebugUtilsLabelEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdEndDebugUtilsLabelEXT>(proc)(args.commandBuffer);
+    return VK_SUCCESS;
+}
+
+struct CmdInsertDebugUtilsLabelEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkDebugUtilsLabelEXT*                 pLabelInfo;
+};
+
+static bool PrepareCmdInsertDebugUtilsLabelEXT(ReplayPrep &prep) {
+    CmdInsertDebugUtilsLabelEXTArgs &args = prep.NewArgs<CmdInsertDebugUtilsLabelEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pLabelInfo);
+}
+
+static VkResult InvokeCmdInsertDebugUtilsLabelEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdInsertDebugUtilsLabelEXTArgs &args = *static_cast<const CmdInsertDebugUtilsLabelEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdInsertDebugUtilsLabelEXT>(proc)(args.commandBuffer, args.pLabelInfo);
+    return VK_SUCCESS;
+}
+
+struct DestroyDebugUtilsMessengerEXTArgs {
+    VkInstance                                  instance;
+    VkDebugUtilsMessengerEXT                    messenger;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyDebugUtilsMessengerEXT(ReplayPrep &prep) {
+    DestroyDebugUtilsMessengerEXTArgs &args = prep.NewArgs<DestroyDebugUtilsMessengerEXTArgs>();
+    return prep.Handle(args.instance) &&
+           prep.Handle(args.messenger) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyDebugUtilsMessengerEXT(PFN_vkVoidFunction proc, void *data) {
+    const DestroyDebugUtilsMessengerEXTArgs &args = *static_cast<const DestroyDebugUtilsMessengerEXTArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(proc)(args.instance, args.messenger, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+struct GetAndroidHardwareBufferPropertiesANDROIDArgs {
+    VkDevice                                    device;
+    const struct AHardwareBuffer*               buffer;
+    VkAndroidHardwareBufferPropertiesANDROID*   pProperties;
+};
+
+static bool PrepareGetAndroidHardwareBufferPropertiesANDROID(ReplayPrep &prep) {
+    GetAndroidHardwareBufferPropertiesANDROIDArgs &args = prep.NewArgs<GetAndroidHardwareBufferPropertiesANDROIDArgs>();
+    return prep.Handle(args.device) &&
+           prep.Address(args.buffer) &&
+           prep.Array(args.pProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetAndroidHardwareBufferPropertiesANDROID(PFN_vkVoidFunction proc, void *data) {
+    const GetAndroidHardwareBufferPropertiesANDROIDArgs &args = *static_cast<const GetAndroidHardwareBufferPropertiesANDROIDArgs *>(data);
+    return reinterpret_cast<PFN_vkGetAndroidHardwareBufferPropertiesANDROID>(proc)(args.device, args.buffer, args.pProperties);
+}
+#endif
+
+struct GetPhysicalDeviceMultisamplePropertiesEXTArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkSampleCountFlagBits                       samples;
+    VkMultisamplePropertiesEXT*                 pMultisampleProperties;
+};
+
+static bool PrepareGetPhysicalDeviceMultisamplePropertiesEXT(ReplayPrep &prep) {
+    GetPhysicalDeviceMultisamplePropertiesEXTArgs &args = prep.NewArgs<GetPhysicalDeviceMultisamplePropertiesEXTArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.samples) &&
+           prep.Array(args.pMultisampleProperties);
+}
+
+static VkResult InvokeGetPhysicalDeviceMultisamplePropertiesEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceMultisamplePropertiesEXTArgs &args = *static_cast<const GetPhysicalDeviceMultisamplePropertiesEXTArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT>(proc)(args.physicalDevice, args.samples, args.pMultisampleProperties);
+    return VK_SUCCESS;
+}
+
+struct GetImageDrmFormatModifierPropertiesEXTArgs {
+    VkDevice                                    device;
+    VkImage                                     image;
+    VkImageDrmFormatModifierPropertiesEXT*      pProperties;
+};
+
+static bool PrepareGetImageDrmFormatModifierPropertiesEXT(ReplayPrep &prep) {
+    GetImageDrmFormatModifierPropertiesEXTArgs &args = prep.NewArgs<GetImageDrmFormatModifierPropertiesEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.image) &&
+           prep.Array(args.pProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetImageDrmFormatModifierPropertiesEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetImageDrmFormatModifierPropertiesEXTArgs &args = *static_cast<const GetImageDrmFormatModifierPropertiesEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetImageDrmFormatModifierPropertiesEXT>(proc)(args.device, args.image, args.pProperties);
+}
+
+struct DestroyValidationCacheEXTArgs {
+    VkDevice                                    device;
+    VkValidationCacheEXT                        validationCache;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyValidationCacheEXT(ReplayPrep &prep) {
+    DestroyValidationCacheEXTArgs &args = prep.NewArgs<DestroyValidationCacheEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.validationCache) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyValidationCacheEXT(PFN_vkVoidFunction proc, void *data) {
+    const DestroyValidationCacheEXTArgs &args = *static_cast<const DestroyValidationCacheEXTArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyValidationCacheEXT>(proc)(args.device, args.validationCache, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct MergeValidationCachesEXTArgs {
+    VkDevice                                    device;
+    VkValidationCacheEXT                        dstCache;
+    uint32_t                                    srcCacheCount;
+    const VkValidationCacheEXT*                 pSrcCaches;
+};
+
+static bool PrepareMergeValidationCachesEXT(ReplayPrep &prep) {
+    MergeValidationCachesEXTArgs &args = prep.NewArgs<MergeValidationCachesEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.dstCache) &&
+           prep.Value(args.srcCacheCount) &&
+           prep.Handles(args.pSrcCaches) &&
+           prep.Result();
+}
+
+static VkResult InvokeMergeValidationCachesEXT(PFN_vkVoidFunction proc, void *data) {
+    const MergeValidationCachesEXTArgs &args = *static_cast<const MergeValidationCachesEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkMergeValidationCachesEXT>(proc)(args.device, args.dstCache, args.srcCacheCount, args.pSrcCaches);
+}
+
+struct GetValidationCacheDataEXTArgs {
+    VkDevice                                    device;
+    VkValidationCacheEXT                        validationCache;
+    size_t*                                     pDataSize;
+    void*                                       pData;
+};
+
+static bool PrepareGetValidationCacheDataEXT(ReplayPrep &prep) {
+    GetValidationCacheDataEXTArgs &args = prep.NewArgs<GetValidationCacheDataEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.validationCache) &&
+           prep.Array(args.pDataSize) &&
+           prep.Bytes(args.pData) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetValidationCacheDataEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetValidationCacheDataEXTArgs &args = *static_cast<const GetValidationCacheDataEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetValidationCacheDataEXT>(proc)(args.device, args.validationCache, args.pDataSize, args.pData);
+}
+
+struct CmdBindShadingRateImageNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkImageView                                 imageView;
+    VkImageLayout                               imageLayout;
+};
+
+static bool PrepareCmdBindShadingRateImageNV(ReplayPrep &prep) {
+    CmdBindShadingRateImageNVArgs &args = prep.NewArgs<CmdBindShadingRateImageNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.imageView) &&
+           prep.Value(args.imageLayout);
+}
+
+static VkResult InvokeCmdBindShadingRateImageNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdBindShadingRateImageNVArgs &args = *static_cast<const CmdBindShadingRateImageNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBindShadingRateImageNV>(proc)(args.commandBuffer, args.imageView, args.imageLayout);
+    return VK_SUCCESS;
+}
+
+struct DestroyAccelerationStructureNVArgs {
+    VkDevice                                    device;
+    VkAccelerationStructureNV                   accelerationStructure;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyAccelerationStructureNV(ReplayPrep &prep) {
+    DestroyAccelerationStructureNVArgs &args = prep.NewArgs<DestroyAccelerationStructureNVArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.accelerationStructure) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyAccelerationStructureNV(PFN_vkVoidFunction proc, void *data) {
+    const DestroyAccelerationStructureNVArgs &args = *static_cast<const DestroyAccelerationStructureNVArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyAccelerationStructureNV>(proc)(args.device, args.accelerationStructure, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CmdCopyAccelerationStructureNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkAccelerationStructureNV                   dst;
+    VkAccelerationStructureNV                   src;
+    VkCopyAccelerationStructureModeKHR          mode;
+};
+
+static bool PrepareCmdCopyAccelerationStructureNV(ReplayPrep &prep) {
+    CmdCopyAccelerationStructureNVArgs &args = prep.NewArgs<CmdCopyAccelerationStructureNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.dst) &&
+           prep.Handle(args.src) &&
+           prep.Value(args.mode);
+}
+
+static VkResult InvokeCmdCopyAccelerationStructureNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdCopyAccelerationStructureNVArgs &args = *static_cast<const CmdCopyAccelerationStructureNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdCopyAccelerationStructureNV>(proc)(args.commandBuffer, args.dst, args.src, args.mode);
+    return VK_SUCCESS;
+}
+
+struct CmdTraceRaysNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    raygenShaderBindingTableBuffer;
+    VkDeviceSize                                raygenShaderBindingOffset;
+    VkBuffer                                    missShaderBindingTableBuffer;
+    VkDeviceSize                                missShaderBindingOffset;
+    VkDeviceSize                                missShaderBindingStride;
+    VkBuffer                                    hitShaderBindingTableBuffer;
+    VkDeviceSize                                hitShaderBindingOffset;
+    VkDeviceSize                                hitShaderBindingStride;
+    VkBuffer                                    callableShaderBindingTableBuffer;
+    VkDeviceSize                                callableShaderBindingOffset;
+    VkDeviceSize                                callableShaderBindingStride;
+    uint32_t                                    width;
+    uint32_t                                    height;
+    uint32_t                                    depth;
+};
+
+static bool PrepareCmdTraceRaysNV(ReplayPrep &prep) {
+    CmdTraceRaysNVArgs &args = prep.NewArgs<CmdTraceRaysNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.raygenShaderBindingTableBuffer) &&
+           prep.Value(args.raygenShaderBindingOffset) &&
+           prep.Handle(args.missShaderBindingTableBuffer) &&
+           prep.Value(args.missShaderBindingOffset) &&
+           prep.Value(args.missShaderBindingStride) &&
+           prep.Handle(args.hitShaderBindingTableBuffer) &&
+           prep.Value(args.hitShaderBindingOffset) &&
+           prep.Value(args.hitShaderBindingStride) &&
+           prep.Handle(args.callableShaderBindingTableBuffer) &&
+           prep.Value(args.callableShaderBindingOffset) &&
+           prep.Value(args.callableShaderBindingStride) &&
+           prep.Value(args.width) &&
+           prep.Value(args.height) &&
+           prep.Value(args.depth);
+}
+
+static VkResult InvokeCmdTraceRaysNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdTraceRaysNVArgs &args = *static_cast<const CmdTraceRaysNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdTraceRaysNV>(proc)(args.commandBuffer, args.raygenShaderBindingTableBuffer, args.raygenShaderBindingOffset, args.missShaderBindingTableBuffer, args.missShaderBindingOffset, args.missShaderBindingStride, args.hitShaderBindingTableBuffer, args.hitShaderBindingOffset, args.hitShaderBindingStride, args.callableShaderBindingTableBuffer, args.callableShaderBindingOffset, args.callableShaderBindingStride, args.width, args.height, args.depth);
+    return VK_SUCCESS;
+}
+
+struct GetRayTracingShaderGroupHandlesKHRArgs {
+    VkDevice                                    device;
+    VkPipeline                                  pipeline;
+    uint32_t                                    firstGroup;
+    uint32_t                                    groupCount;
+    size_t                                      dataSize;
+    void*                                       pData;
+};
+
+static bool PrepareGetRayTracingShaderGroupHandlesKHR(ReplayPrep &prep) {
+    GetRayTracingShaderGroupHandlesKHRArgs &args = prep.NewArgs<GetRayTracingShaderGroupHandlesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipeline) &&
+           prep.Value(args.firstGroup) &&
+           prep.Value(args.groupCount) &&
+           prep.Value(args.dataSize) &&
+           prep.Bytes(args.pData) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetRayTracingShaderGroupHandlesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetRayTracingShaderGroupHandlesKHRArgs &args = *static_cast<const GetRayTracingShaderGroupHandlesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetRayTracingShaderGroupHandlesKHR>(proc)(args.device, args.pipeline, args.firstGroup, args.groupCount, args.dataSize, args.pData);
+}
+
+struct GetRayTracingShaderGroupHandlesNVArgs {
+    VkDevice                                    device;
+    VkPipeline                                  pipeline;
+    uint32_t                                    firstGroup;
+    uint32_t                                    groupCount;
+    size_t                                      dataSize;
+    void*                                       pData;
+};
+
+static bool PrepareGetRayTracingShaderGroupHandlesNV(ReplayPrep &prep) {
+    GetRayTracingShaderGroupHandlesNVArgs &args = prep.NewArgs<GetRayTracingShaderGroupHandlesNVArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipeline) &&
+           prep.Value(args.firstGroup) &&
+           prep.Value(args.groupCount) &&
+           prep.Value(args.dataSize) &&
+           prep.Bytes(args.pData) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetRayTracingShaderGroupHandlesNV(PFN_vkVoidFunction proc, void *data) {
+    const GetRayTracingShaderGroupHandlesNVArgs &args = *static_cast<const GetRayTracingShaderGroupHandlesNVArgs *>(data);
+    return reinterpret_cast<PFN_vkGetRayTracingShaderGroupHandlesNV>(proc)(args.device, args.pipeline, args.firstGroup, args.groupCount, args.dataSize, args.pData);
+}
+
+struct GetAccelerationStructureHandleNVArgs {
+    VkDevice                                    device;
+    VkAccelerationStructureNV                   accelerationStructure;
+    size_t                                      dataSize;
+    void*                                       pData;
+};
+
+static bool PrepareGetAccelerationStructureHandleNV(ReplayPrep &prep) {
+    GetAccelerationStructureHandleNVArgs &args = prep.NewArgs<GetAccelerationStructureHandleNVArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.accelerationStructure) &&
+           prep.Value(args.dataSize) &&
+           prep.Bytes(args.pData) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetAccelerationStructureHandleNV(PFN_vkVoidFunction proc, void *data) {
+    const GetAccelerationStructureHandleNVArgs &args = *static_cast<const GetAccelerationStructureHandleNVArgs *>(data);
+    return reinterpret_cast<PFN_vkGetAccelerationStructureHandleNV>(proc)(args.device, args.accelerationStructure, args.dataSize, args.pData);
+}
+
+struct CmdWriteAccelerationStructuresPropertiesNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    accelerationStructureCount;
+    const VkAccelerationStructureNV*            pAccelerationStructures;
+    VkQueryType                                 queryType;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+};
+
+static bool PrepareCmdWriteAccelerationStructuresPropertiesNV(ReplayPrep &prep) {
+    CmdWriteAccelerationStructuresPropertiesNVArgs &args = prep.NewArgs<CmdWriteAccelerationStructuresPropertiesNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.accelerationStructureCount) &&
+           prep.Handles(args.pAccelerationStructures) &&
+           prep.Value(args.queryType) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.firstQuery);
+}
+
+static VkResult InvokeCmdWriteAccelerationStructuresPropertiesNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdWriteAccelerationStructuresPropertiesNVArgs &args = *static_cast<const CmdWriteAccelerationStructuresPropertiesNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdWriteAccelerationStructuresPropertiesNV>(proc)(args.commandBuffer, args.accelerationStructureCount, args.pAccelerationStructures, args.queryType, args.queryPool, args.firstQuery);
+    return VK_SUCCESS;
+}
+
+struct CompileDeferredNVArgs {
+    VkDevice                                    device;
+    VkPipeline                                  pipeline;
+    uint32_t                                    shader;
+};
+
+static bool PrepareCompileDeferredNV(ReplayPrep &prep) {
+    CompileDeferredNVArgs &args = prep.NewArgs<CompileDeferredNVArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipeline) &&
+           prep.Value(args.shader) &&
+           prep.Result();
+}
+
+static VkResult InvokeCompileDeferredNV(PFN_vkVoidFunction proc, void *data) {
+    const CompileDeferredNVArgs &args = *static_cast<const CompileDeferredNVArgs *>(data);
+    return reinterpret_cast<PFN_vkCompileDeferredNV>(proc)(args.device, args.pipeline, args.shader);
+}
+
+struct GetMemoryHostPointerPropertiesEXTArgs {
+    VkDevice                                    device;
+    VkExternalMemoryHandleTypeFlagBits          handleType;
+    const void*                                 pHostPointer;
+    VkMemoryHostPointerPropertiesEXT*           pMemoryHostPointerProperties;
+};
+
+static bool PrepareGetMemoryHostPointerPropertiesEXT(ReplayPrep &prep) {
+    GetMemoryHostPointerPropertiesEXTArgs &args = prep.NewArgs<GetMemoryHostPointerPropertiesEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.handleType) &&
+           prep.Address(args.pHostPointer) &&
+           prep.Array(args.pMemoryHostPointerProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetMemoryHostPointerPropertiesEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetMemoryHostPointerPropertiesEXTArgs &args = *static_cast<const GetMemoryHostPointerPropertiesEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetMemoryHostPointerPropertiesEXT>(proc)(args.device, args.handleType, args.pHostPointer, args.pMemoryHostPointerProperties);
+}
+
+struct CmdWriteBufferMarkerAMDArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineStageFlagBits                     pipelineStage;
+    VkBuffer                                    dstBuffer;
+    VkDeviceSize                                dstOffset;
+    uint32_t                                    marker;
+};
+
+static bool PrepareCmdWriteBufferMarkerAMD(ReplayPrep &prep) {
+    CmdWriteBufferMarkerAMDArgs &args = prep.NewArgs<CmdWriteBufferMarkerAMDArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.pipelineStage) &&
+           prep.Handle(args.dstBuffer) &&
+           prep.Value(args.dstOffset) &&
+           prep.Value(args.marker);
+}
+
+static VkResult InvokeCmdWriteBufferMarkerAMD(PFN_vkVoidFunction proc, void *data) {
+    const CmdWriteBufferMarkerAMDArgs &args = *static_cast<const CmdWriteBufferMarkerAMDArgs *>(data);
+    reinterpret_cast<PFN_vkCmdWriteBufferMarkerAMD>(proc)(args.commandBuffer, args.pipelineStage, args.dstBuffer, args.dstOffset, args.marker);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceCalibrateableTimeDomainsEXTArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t*                                   pTimeDomainCount;
+    VkTimeDomainEXT*                            pTimeDomains;
+};
+
+static bool PrepareGetPhysicalDeviceCalibrateableTimeDomainsEXT(ReplayPrep &prep) {
+    GetPhysicalDeviceCalibrateableTimeDomainsEXTArgs &args = prep.NewArgs<GetPhysicalDeviceCalibrateableTimeDomainsEXTArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pTimeDomainCount) &&
+           prep.Array(args.pTimeDomains) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceCalibrateableTimeDomainsEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceCalibrateableTimeDomainsEXTArgs &args = *static_cast<const GetPhysicalDeviceCalibrateableTimeDomainsEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT>(proc)(args.physicalDevice, args.pTimeDomainCount, args.pTimeDomains);
+}
+
+struct GetCalibratedTimestampsEXTArgs {
+    VkDevice                                    device;
+    uint32_t                                    timestampCount;
+    const VkCalibratedTimestampInfoEXT*         pTimestampInfos;
+    uint64_t*                                   pTimestamps;
+    uint64_t*                                   pMaxDeviation;
+};
+
+static bool PrepareGetCalibratedTimestampsEXT(ReplayPrep &prep) {
+    GetCalibratedTimestampsEXTArgs &args = prep.NewArgs<GetCalibratedTimestampsEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.timestampCount) &&
+           prep.Array(args.pTimestampInfos) &&
+           prep.Array(args.pTimestamps) &&
+           prep.Array(args.pMaxDeviation) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetCalibratedTimestampsEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetCalibratedTimestampsEXTArgs &args = *static_cast<const GetCalibratedTimestampsEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetCalibratedTimestampsEXT>(proc)(args.device, args.timestampCount, args.pTimestampInfos, args.pTimestamps, args.pMaxDeviation);
+}
+
+struct CmdDrawMeshTasksNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    taskCount;
+    uint32_t                                    firstTask;
+};
+
+static bool PrepareCmdDrawMeshTasksNV(ReplayPrep &prep) {
+    CmdDrawMeshTasksNVArgs &args = prep.NewArgs<CmdDrawMeshTasksNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.taskCount) &&
+           prep.Value(args.firstTask);
+}
+
+static VkResult InvokeCmdDrawMeshTasksNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawMeshTasksNVArgs &args = *static_cast<const CmdDrawMeshTasksNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawMeshTasksNV>(proc)(args.commandBuffer, args.taskCount, args.firstTask);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawMeshTasksIndirectNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    uint32_t                                    drawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawMeshTasksIndirectNV(ReplayPrep &prep) {
+    CmdDrawMeshTasksIndirectNVArgs &args = prep.NewArgs<CmdDrawMeshTasksIndirectNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Value(args.drawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawMeshTasksIndirectNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawMeshTasksIndirectNVArgs &args = *static_cast<const CmdDrawMeshTasksIndirectNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawMeshTasksIndirectNV>(proc)(args.commandBuffer, args.buffer, args.offset, args.drawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct CmdDrawMeshTasksIndirectCountNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBuffer                                    buffer;
+    VkDeviceSize                                offset;
+    VkBuffer                                    countBuffer;
+    VkDeviceSize                                countBufferOffset;
+    uint32_t                                    maxDrawCount;
+    uint32_t                                    stride;
+};
+
+static bool PrepareCmdDrawMeshTasksIndirectCountNV(ReplayPrep &prep) {
+    CmdDrawMeshTasksIndirectCountNVArgs &args = prep.NewArgs<CmdDrawMeshTasksIndirectCountNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Handle(args.buffer) &&
+           prep.Value(args.offset) &&
+           prep.Handle(args.countBuffer) &&
+           prep.Value(args.countBufferOffset) &&
+           prep.Value(args.maxDrawCount) &&
+           prep.Value(args.stride);
+}
+
+static VkResult InvokeCmdDrawMeshTasksIndirectCountNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdDrawMeshTasksIndirectCountNVArgs &args = *static_cast<const CmdDrawMeshTasksIndirectCountNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdDrawMeshTasksIndirectCountNV>(proc)(args.commandBuffer, args.buffer, args.offset, args.countBuffer, args.countBufferOffset, args.maxDrawCount, args.stride);
+    return VK_SUCCESS;
+}
+
+struct CmdSetExclusiveScissorNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstExclusiveScissor;
+    uint32_t                                    exclusiveScissorCount;
+    const VkRect2D*                             pExclusiveScissors;
+};
+
+static bool PrepareCmdSetExclusiveScissorNV(ReplayPrep &prep) {
+    CmdSetExclusiveScissorNVArgs &args = prep.NewArgs<CmdSetExclusiveScissorNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstExclusiveScissor) &&
+           prep.Value(args.exclusiveScissorCount) &&
+           prep.Array(args.pExclusiveScissors);
+}
+
+static VkResult InvokeCmdSetExclusiveScissorNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetExclusiveScissorNVArgs &args = *static_cast<const CmdSetExclusiveScissorNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetExclusiveScissorNV>(proc)(args.commandBuffer, args.firstExclusiveScissor, args.exclusiveScissorCount, args.pExclusiveScissors);
+    return VK_SUCCESS;
+}
+
+struct CmdSetCheckpointNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    const void*                                 pCheckpointMarker;
+};
+
+static bool PrepareCmdSetCheckpointNV(ReplayPrep &prep) {
+    CmdSetCheckpointNVArgs &args = prep.NewArgs<CmdSetCheckpointNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Address(args.pCheckpointMarker);
+}
+
+static VkResult InvokeCmdSetCheckpointNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetCheckpointNVArgs &args = *static_cast<const CmdSetCheckpointNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetCheckpointNV>(proc)(args.commandBuffer, args.pCheckpointMarker);
+    return VK_SUCCESS;
+}
+
+struct UninitializePerformanceApiINTELArgs {
+    VkDevice                                    device;
+};
+
+static bool PrepareUninitializePerformanceApiINTEL(ReplayPrep &prep) {
+    UninitializePerformanceApiINTELArgs &args = prep.NewArgs<UninitializePerformanceApiINTELArgs>();
+    return prep.Handle(args.device);
+}
+
+static VkResult InvokeUninitializePerformanceApiINTEL(PFN_vkVoidFunction proc, void *data) {
+    const UninitializePerformanceApiINTELArgs &args = *static_cast<const UninitializePerformanceApiINTELArgs *>(data);
+    reinterpret_cast<PFN_vkUninitializePerformanceApiINTEL>(proc)(args.device);
+    return VK_SUCCESS;
+}
+
+struct CmdSetPerformanceMarkerINTELArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkPerformanceMarkerInfoINTEL*         pMarkerInfo;
+};
+
+static bool PrepareCmdSetPerformanceMarkerINTEL(ReplayPrep &prep) {
+    CmdSetPerformanceMarkerINTELArgs &args = prep.NewArgs<CmdSetPerformanceMarkerINTELArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pMarkerInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeCmdSetPerformanceMarkerINTEL(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetPerformanceMarkerINTELArgs &args = *static_cast<const CmdSetPerformanceMarkerINTELArgs *>(data);
+    return reinterpret_cast<PFN_vkCmdSetPerformanceMarkerINTEL>(proc)(args.commandBuffer, args.pMarkerInfo);
+}
+
+struct CmdSetPerformanceStreamMarkerINTELArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkPerformanceStreamMarkerInfoINTEL*   pMarkerInfo;
+};
+
+static bool PrepareCmdSetPerformanceStreamMarkerINTEL(ReplayPrep &prep) {
+    CmdSetPerformanceStreamMarkerINTELArgs &args = prep.NewArgs<CmdSetPerformanceStreamMarkerINTELArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pMarkerInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeCmdSetPerformanceStreamMarkerINTEL(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetPerformanceStreamMarkerINTELArgs &args = *static_cast<const CmdSetPerformanceStreamMarkerINTELArgs *>(data);
+    return reinterpret_cast<PFN_vkCmdSetPerformanceStreamMarkerINTEL>(proc)(args.commandBuffer, args.pMarkerInfo);
+}
+
+struct CmdSetPerformanceOverrideINTELArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkPerformanceOverrideInfoINTEL*       pOverrideInfo;
+};
+
+static bool PrepareCmdSetPerformanceOverrideINTEL(ReplayPrep &prep) {
+    CmdSetPerformanceOverrideINTELArgs &args = prep.NewArgs<CmdSetPerformanceOverrideINTELArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pOverrideInfo) &&
+           prep.Result();
+}
+
+static VkResult InvokeCmdSetPerformanceOverrideINTEL(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetPerformanceOverrideINTELArgs &args = *static_cast<const CmdSetPerformanceOverrideINTELArgs *>(data);
+    return reinterpret_cast<PFN_vkCmdSetPerformanceOverrideINTEL>(proc)(args.commandBuffer, args.pOverrideInfo);
+}
+
+struct AcquirePerformanceConfigurationINTELArgs {
+    VkDevice                                    device;
+    const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo;
+    VkPerformanceConfigurationINTEL*            pConfiguration;
+};
+
+static bool PrepareAcquirePerformanceConfigurationINTEL(ReplayPrep &prep) {
+    AcquirePerformanceConfigurationINTELArgs &args = prep.NewArgs<AcquirePerformanceConfigurationINTELArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pAcquireInfo) &&
+           prep.NewHandles(args.pConfiguration) &&
+           prep.Result();
+}
+
+static VkResult InvokeAcquirePerformanceConfigurationINTEL(PFN_vkVoidFunction proc, void *data) {
+    const AcquirePerformanceConfigurationINTELArgs &args = *static_cast<const AcquirePerformanceConfigurationINTELArgs *>(data);
+    return reinterpret_cast<PFN_vkAcquirePerformanceConfigurationINTEL>(proc)(args.device, args.pAcquireInfo, args.pConfiguration);
+}
+
+struct ReleasePerformanceConfigurationINTELArgs {
+    VkDevice                                    device;
+    VkPerformanceConfigurationINTEL             configuration;
+};
+
+static bool PrepareReleasePerformanceConfigurationINTEL(ReplayPrep &prep) {
+    ReleasePerformanceConfigurationINTELArgs &args = prep.NewArgs<ReleasePerformanceConfigurationINTELArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.configuration) &&
+           prep.Result();
+}
+
+static VkResult InvokeReleasePerformanceConfigurationINTEL(PFN_vkVoidFunction proc, void *data) {
+    const ReleasePerformanceConfigurationINTELArgs &args = *static_cast<const ReleasePerformanceConfigurationINTELArgs *>(data);
+    return reinterpret_cast<PFN_vkReleasePerformanceConfigurationINTEL>(proc)(args.device, args.configuration);
+}
+
+struct QueueSetPerformanceConfigurationINTELArgs {
+    VkQueue                                     queue;
+    VkPerformanceConfigurationINTEL             configuration;
+};
+
+static bool PrepareQueueSetPerformanceConfigurationINTEL(ReplayPrep &prep) {
+    QueueSetPerformanceConfigurationINTELArgs &args = prep.NewArgs<QueueSetPerformanceConfigurationINTELArgs>();
+    return prep.Handle(args.queue) &&
+           prep.Handle(args.configuration) &&
+           prep.Result();
+}
+
+static VkResult InvokeQueueSetPerformanceConfigurationINTEL(PFN_vkVoidFunction proc, void *data) {
+    const QueueSetPerformanceConfigurationINTELArgs &args = *static_cast<const QueueSetPerformanceConfigurationINTELArgs *>(data);
+    return reinterpret_cast<PFN_vkQueueSetPerformanceConfigurationINTEL>(proc)(args.queue, args.configuration);
+}
+
+struct SetLocalDimmingAMDArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapChain;
+    VkBool32                                    localDimmingEnable;
+};
+
+static bool PrepareSetLocalDimmingAMD(ReplayPrep &prep) {
+    SetLocalDimmingAMDArgs &args = prep.NewArgs<SetLocalDimmingAMDArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapChain) &&
+           prep.Value(args.localDimmingEnable);
+}
+
+static VkResult InvokeSetLocalDimmingAMD(PFN_vkVoidFunction proc, void *data) {
+    const SetLocalDimmingAMDArgs &args = *static_cast<const SetLocalDimmingAMDArgs *>(data);
+    reinterpret_cast<PFN_vkSetLocalDimmingAMD>(proc)(args.device, args.swapChain, args.localDimmingEnable);
+    return VK_SUCCESS;
+}
+
+struct GetBufferDeviceAddressEXTArgs {
+    VkDevice                                    device;
+    const VkBufferDeviceAddressInfo*            pInfo;
+};
+
+static bool PrepareGetBufferDeviceAddressEXT(ReplayPrep &prep) {
+    GetBufferDeviceAddressEXTArgs &args = prep.NewArgs<GetBufferDeviceAddressEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pInfo) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetBufferDeviceAddressEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetBufferDeviceAddressEXTArgs &args = *static_cast<const GetBufferDeviceAddressEXTArgs *>(data);
+    reinterpret_cast<PFN_vkGetBufferDeviceAddressEXT>(proc)(args.device, args.pInfo);
+    return VK_SUCCESS;
+}
+
+struct GetPhysicalDeviceToolPropertiesEXTArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t*                                   pToolCount;
+    VkPhysicalDeviceToolPropertiesEXT*          pToolProperties;
+};
+
+static bool PrepareGetPhysicalDeviceToolPropertiesEXT(ReplayPrep &prep) {
+    GetPhysicalDeviceToolPropertiesEXTArgs &args = prep.NewArgs<GetPhysicalDeviceToolPropertiesEXTArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pToolCount) &&
+           prep.Array(args.pToolProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceToolPropertiesEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceToolPropertiesEXTArgs &args = *static_cast<const GetPhysicalDeviceToolPropertiesEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceToolPropertiesEXT>(proc)(args.physicalDevice, args.pToolCount, args.pToolProperties);
+}
+
+struct GetPhysicalDeviceCooperativeMatrixPropertiesNVArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t*                                   pPropertyCount;
+    VkCooperativeMatrixPropertiesNV*            pProperties;
+};
+
+static bool PrepareGetPhysicalDeviceCooperativeMatrixPropertiesNV(ReplayPrep &prep) {
+    GetPhysicalDeviceCooperativeMatrixPropertiesNVArgs &args = prep.NewArgs<GetPhysicalDeviceCooperativeMatrixPropertiesNVArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pPropertyCount) &&
+           prep.Array(args.pProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceCooperativeMatrixPropertiesNV(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceCooperativeMatrixPropertiesNVArgs &args = *static_cast<const GetPhysicalDeviceCooperativeMatrixPropertiesNVArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV>(proc)(args.physicalDevice, args.pPropertyCount, args.pProperties);
+}
+
+struct GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNVArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t*                                   pCombinationCount;
+    VkFramebufferMixedSamplesCombinationNV*     pCombinations;
+};
+
+static bool PrepareGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(ReplayPrep &prep) {
+    GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNVArgs &args = prep.NewArgs<GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNVArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pCombinationCount) &&
+           prep.Array(args.pCombinations) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNVArgs &args = *static_cast<const GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNVArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV>(proc)(args.physicalDevice, args.pCombinationCount, args.pCombinations);
+}
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+struct GetPhysicalDeviceSurfacePresentModes2EXTArgs {
+    VkPhysicalDevice                            physicalDevice;
+    const VkPhysicalDeviceSurfaceInfo2KHR*      pSurfaceInfo;
+    uint32_t*                                   pPresentModeCount;
+    VkPresentModeKHR*                           pPresentModes;
+};
+
+static bool PrepareGetPhysicalDeviceSurfacePresentModes2EXT(ReplayPrep &prep) {
+    GetPhysicalDeviceSurfacePresentModes2EXTArgs &args = prep.NewArgs<GetPhysicalDeviceSurfacePresentModes2EXTArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Array(args.pSurfaceInfo) &&
+           prep.Array(args.pPresentModeCount) &&
+           prep.Array(args.pPresentModes) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetPhysicalDeviceSurfacePresentModes2EXT(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceSurfacePresentModes2EXTArgs &args = *static_cast<const GetPhysicalDeviceSurfacePresentModes2EXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetPhysicalDeviceSurfacePresentModes2EXT>(proc)(args.physicalDevice, args.pSurfaceInfo, args.pPresentModeCount, args.pPresentModes);
+}
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+struct AcquireFullScreenExclusiveModeEXTArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapchain;
+};
+
+static bool PrepareAcquireFullScreenExclusiveModeEXT(ReplayPrep &prep) {
+    AcquireFullScreenExclusiveModeEXTArgs &args = prep.NewArgs<AcquireFullScreenExclusiveModeEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapchain) &&
+           prep.Result();
+}
+
+static VkResult InvokeAcquireFullScreenExclusiveModeEXT(PFN_vkVoidFunction proc, void *data) {
+    const AcquireFullScreenExclusiveModeEXTArgs &args = *static_cast<const AcquireFullScreenExclusiveModeEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkAcquireFullScreenExclusiveModeEXT>(proc)(args.device, args.swapchain);
+}
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+struct ReleaseFullScreenExclusiveModeEXTArgs {
+    VkDevice                                    device;
+    VkSwapchainKHR                              swapchain;
+};
+
+static bool PrepareReleaseFullScreenExclusiveModeEXT(ReplayPrep &prep) {
+    ReleaseFullScreenExclusiveModeEXTArgs &args = prep.NewArgs<ReleaseFullScreenExclusiveModeEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.swapchain) &&
+           prep.Result();
+}
+
+static VkResult InvokeReleaseFullScreenExclusiveModeEXT(PFN_vkVoidFunction proc, void *data) {
+    const ReleaseFullScreenExclusiveModeEXTArgs &args = *static_cast<const ReleaseFullScreenExclusiveModeEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkReleaseFullScreenExclusiveModeEXT>(proc)(args.device, args.swapchain);
+}
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+struct GetDeviceGroupSurfacePresentModes2EXTArgs {
+    VkDevice                                    device;
+    const VkPhysicalDeviceSurfaceInfo2KHR*      pSurfaceInfo;
+    VkDeviceGroupPresentModeFlagsKHR*           pModes;
+};
+
+static bool PrepareGetDeviceGroupSurfacePresentModes2EXT(ReplayPrep &prep) {
+    GetDeviceGroupSurfacePresentModes2EXTArgs &args = prep.NewArgs<GetDeviceGroupSurfacePresentModes2EXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pSurfaceInfo) &&
+           prep.Array(args.pModes) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetDeviceGroupSurfacePresentModes2EXT(PFN_vkVoidFunction proc, void *data) {
+    const GetDeviceGroupSurfacePresentModes2EXTArgs &args = *static_cast<const GetDeviceGroupSurfacePresentModes2EXTArgs *>(data);
+    return reinterpret_cast<PFN_vkGetDeviceGroupSurfacePresentModes2EXT>(proc)(args.device, args.pSurfaceInfo, args.pModes);
+}
+#endif
+
+struct CreateHeadlessSurfaceEXTArgs {
+    VkInstance                                  instance;
+    const VkHeadlessSurfaceCreateInfoEXT*       pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkSurfaceKHR*                               pSurface;
+};
+
+static bool PrepareCreateHeadlessSurfaceEXT(ReplayPrep &prep) {
+    CreateHeadlessSurfaceEXTArgs &args = prep.NewArgs<CreateHeadlessSurfaceEXTArgs>();
+    return prep.Handle(args.instance) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pSurface) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreateHeadlessSurfaceEXT(PFN_vkVoidFunction proc, void *data) {
+    const CreateHeadlessSurfaceEXTArgs &args = *static_cast<const CreateHeadlessSurfaceEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkCreateHeadlessSurfaceEXT>(proc)(args.instance, args.pCreateInfo, args.pAllocator, args.pSurface);
+}
+
+struct CmdSetLineStippleEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    lineStippleFactor;
+    uint16_t                                    lineStipplePattern;
+};
+
+static bool PrepareCmdSetLineStippleEXT(ReplayPrep &prep) {
+    CmdSetLineStippleEXTArgs &args = prep.NewArgs<CmdSetLineStippleEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.lineStippleFactor) &&
+           prep.Value(args.lineStipplePattern);
+}
+
+static VkResult InvokeCmdSetLineStippleEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetLineStippleEXTArgs &args = *static_cast<const CmdSetLineStippleEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetLineStippleEXT>(proc)(args.commandBuffer, args.lineStippleFactor, args.lineStipplePattern);
+    return VK_SUCCESS;
+}
+
+struct ResetQueryPoolEXTArgs {
+    VkDevice                                    device;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+    uint32_t                                    queryCount;
+};
+
+static bool PrepareResetQueryPoolEXT(ReplayPrep &prep) {
+    ResetQueryPoolEXTArgs &args = prep.NewArgs<ResetQueryPoolEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.firstQuery) &&
+           prep.Value(args.queryCount);
+}
+
+static VkResult InvokeResetQueryPoolEXT(PFN_vkVoidFunction proc, void *data) {
+    const ResetQueryPoolEXTArgs &args = *static_cast<const ResetQueryPoolEXTArgs *>(data);
+    reinterpret_cast<PFN_vkResetQueryPoolEXT>(proc)(args.device, args.queryPool, args.firstQuery, args.queryCount);
+    return VK_SUCCESS;
+}
+
+struct CmdSetCullModeEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkCullModeFlags                             cullMode;
+};
+
+static bool PrepareCmdSetCullModeEXT(ReplayPrep &prep) {
+    CmdSetCullModeEXTArgs &args = prep.NewArgs<CmdSetCullModeEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.cullMode);
+}
+
+static VkResult InvokeCmdSetCullModeEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetCullModeEXTArgs &args = *static_cast<const CmdSetCullModeEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetCullModeEXT>(proc)(args.commandBuffer, args.cullMode);
+    return VK_SUCCESS;
+}
+
+struct CmdSetFrontFaceEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkFrontFace                                 frontFace;
+};
+
+static bool PrepareCmdSetFrontFaceEXT(ReplayPrep &prep) {
+    CmdSetFrontFaceEXTArgs &args = prep.NewArgs<CmdSetFrontFaceEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.frontFace);
+}
+
+static VkResult InvokeCmdSetFrontFaceEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetFrontFaceEXTArgs &args = *static_cast<const CmdSetFrontFaceEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetFrontFaceEXT>(proc)(args.commandBuffer, args.frontFace);
+    return VK_SUCCESS;
+}
+
+struct CmdSetPrimitiveTopologyEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPrimitiveTopology                         primitiveTopology;
+};
+
+static bool PrepareCmdSetPrimitiveTopologyEXT(ReplayPrep &prep) {
+    CmdSetPrimitiveTopologyEXTArgs &args = prep.NewArgs<CmdSetPrimitiveTopologyEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.primitiveTopology);
+}
+
+static VkResult InvokeCmdSetPrimitiveTopologyEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetPrimitiveTopologyEXTArgs &args = *static_cast<const CmdSetPrimitiveTopologyEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetPrimitiveTopologyEXT>(proc)(args.commandBuffer, args.primitiveTopology);
+    return VK_SUCCESS;
+}
+
+struct CmdSetViewportWithCountEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    viewportCount;
+    const VkViewport*                           pViewports;
+};
+
+static bool PrepareCmdSetViewportWithCountEXT(ReplayPrep &prep) {
+    CmdSetViewportWithCountEXTArgs &args = prep.NewArgs<CmdSetViewportWithCountEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.viewportCount) &&
+           prep.Array(args.pViewports);
+}
+
+static VkResult InvokeCmdSetViewportWithCountEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetViewportWithCountEXTArgs &args = *static_cast<const CmdSetViewportWithCountEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetViewportWithCountEXT>(proc)(args.commandBuffer, args.viewportCount, args.pViewports);
+    return VK_SUCCESS;
+}
+
+struct CmdSetScissorWithCountEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    scissorCount;
+    const VkRect2D*                             pScissors;
+};
+
+static bool PrepareCmdSetScissorWithCountEXT(ReplayPrep &prep) {
+    CmdSetScissorWithCountEXTArgs &args = prep.NewArgs<CmdSetScissorWithCountEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.scissorCount) &&
+           prep.Array(args.pScissors);
+}
+
+static VkResult InvokeCmdSetScissorWithCountEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetScissorWithCountEXTArgs &args = *static_cast<const CmdSetScissorWithCountEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetScissorWithCountEXT>(proc)(args.commandBuffer, args.scissorCount, args.pScissors);
+    return VK_SUCCESS;
+}
+
+struct CmdBindVertexBuffers2EXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    firstBinding;
+    uint32_t                                    bindingCount;
+    const VkBuffer*                             pBuffers;
+    const VkDeviceSize*                         pOffsets;
+    const VkDeviceSize*                         pSizes;
+    const VkDeviceSize*                         pStrides;
+};
+
+static bool PrepareCmdBindVertexBuffers2EXT(ReplayPrep &prep) {
+    CmdBindVertexBuffers2EXTArgs &args = prep.NewArgs<CmdBindVertexBuffers2EXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.firstBinding) &&
+           prep.Value(args.bindingCount) &&
+           prep.Handles(args.pBuffers) &&
+           prep.Array(args.pOffsets) &&
+           prep.Array(args.pSizes) &&
+           prep.Array(args.pStrides);
+}
+
+static VkResult InvokeCmdBindVertexBuffers2EXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdBindVertexBuffers2EXTArgs &args = *static_cast<const CmdBindVertexBuffers2EXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBindVertexBuffers2EXT>(proc)(args.commandBuffer, args.firstBinding, args.bindingCount, args.pBuffers, args.pOffsets, args.pSizes, args.pStrides);
+    return VK_SUCCESS;
+}
+
+struct CmdSetDepthTestEnableEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBool32                                    depthTestEnable;
+};
+
+static bool PrepareCmdSetDepthTestEnableEXT(ReplayPrep &prep) {
+    CmdSetDepthTestEnableEXTArgs &args = prep.NewArgs<CmdSetDepthTestEnableEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.depthTestEnable);
+}
+
+static VkResult InvokeCmdSetDepthTestEnableEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDepthTestEnableEXTArgs &args = *static_cast<const CmdSetDepthTestEnableEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDepthTestEnableEXT>(proc)(args.commandBuffer, args.depthTestEnable);
+    return VK_SUCCESS;
+}
+
+struct CmdSetDepthWriteEnableEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBool32                                    depthWriteEnable;
+};
+
+static bool PrepareCmdSetDepthWriteEnableEXT(ReplayPrep &prep) {
+    CmdSetDepthWriteEnableEXTArgs &args = prep.NewArgs<CmdSetDepthWriteEnableEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.depthWriteEnable);
+}
+
+static VkResult InvokeCmdSetDepthWriteEnableEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDepthWriteEnableEXTArgs &args = *static_cast<const CmdSetDepthWriteEnableEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDepthWriteEnableEXT>(proc)(args.commandBuffer, args.depthWriteEnable);
+    return VK_SUCCESS;
+}
+
+struct CmdSetDepthCompareOpEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkCompareOp                                 depthCompareOp;
+};
+
+static bool PrepareCmdSetDepthCompareOpEXT(ReplayPrep &prep) {
+    CmdSetDepthCompareOpEXTArgs &args = prep.NewArgs<CmdSetDepthCompareOpEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.depthCompareOp);
+}
+
+static VkResult InvokeCmdSetDepthCompareOpEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDepthCompareOpEXTArgs &args = *static_cast<const CmdSetDepthCompareOpEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDepthCompareOpEXT>(proc)(args.commandBuffer, args.depthCompareOp);
+    return VK_SUCCESS;
+}
+
+struct CmdSetDepthBoundsTestEnableEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBool32                                    depthBoundsTestEnable;
+};
+
+static bool PrepareCmdSetDepthBoundsTestEnableEXT(ReplayPrep &prep) {
+    CmdSetDepthBoundsTestEnableEXTArgs &args = prep.NewArgs<CmdSetDepthBoundsTestEnableEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.depthBoundsTestEnable);
+}
+
+static VkResult InvokeCmdSetDepthBoundsTestEnableEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDepthBoundsTestEnableEXTArgs &args = *static_cast<const CmdSetDepthBoundsTestEnableEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDepthBoundsTestEnableEXT>(proc)(args.commandBuffer, args.depthBoundsTestEnable);
+    return VK_SUCCESS;
+}
+
+struct CmdSetStencilTestEnableEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBool32                                    stencilTestEnable;
+};
+
+static bool PrepareCmdSetStencilTestEnableEXT(ReplayPrep &prep) {
+    CmdSetStencilTestEnableEXTArgs &args = prep.NewArgs<CmdSetStencilTestEnableEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.stencilTestEnable);
+}
+
+static VkResult InvokeCmdSetStencilTestEnableEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetStencilTestEnableEXTArgs &args = *static_cast<const CmdSetStencilTestEnableEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetStencilTestEnableEXT>(proc)(args.commandBuffer, args.stencilTestEnable);
+    return VK_SUCCESS;
+}
+
+struct CmdSetStencilOpEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkStencilFaceFlags                          faceMask;
+    VkStencilOp                                 failOp;
+    VkStencilOp                                 passOp;
+    VkStencilOp                                 depthFailOp;
+    VkCompareOp                                 compareOp;
+};
+
+static bool PrepareCmdSetStencilOpEXT(ReplayPrep &prep) {
+    CmdSetStencilOpEXTArgs &args = prep.NewArgs<CmdSetStencilOpEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.faceMask) &&
+           prep.Value(args.failOp) &&
+           prep.Value(args.passOp) &&
+           prep.Value(args.depthFailOp) &&
+           prep.Value(args.compareOp);
+}
+
+static VkResult InvokeCmdSetStencilOpEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetStencilOpEXTArgs &args = *static_cast<const CmdSetStencilOpEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetStencilOpEXT>(proc)(args.commandBuffer, args.faceMask, args.failOp, args.passOp, args.depthFailOp, args.compareOp);
+    return VK_SUCCESS;
+}
+
+struct CmdBindPipelineShaderGroupNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkPipelineBindPoint                         pipelineBindPoint;
+    VkPipeline                                  pipeline;
+    uint32_t                                    groupIndex;
+};
+
+static bool PrepareCmdBindPipelineShaderGroupNV(ReplayPrep &prep) {
+    CmdBindPipelineShaderGroupNVArgs &args = prep.NewArgs<CmdBindPipelineShaderGroupNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.pipelineBindPoint) &&
+           prep.Handle(args.pipeline) &&
+           prep.Value(args.groupIndex);
+}
+
+static VkResult InvokeCmdBindPipelineShaderGroupNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdBindPipelineShaderGroupNVArgs &args = *static_cast<const CmdBindPipelineShaderGroupNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdBindPipelineShaderGroupNV>(proc)(args.commandBuffer, args.pipelineBindPoint, args.pipeline, args.groupIndex);
+    return VK_SUCCESS;
+}
+
+struct DestroyIndirectCommandsLayoutNVArgs {
+    VkDevice                                    device;
+    VkIndirectCommandsLayoutNV                  indirectCommandsLayout;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyIndirectCommandsLayoutNV(ReplayPrep &prep) {
+    DestroyIndirectCommandsLayoutNVArgs &args = prep.NewArgs<DestroyIndirectCommandsLayoutNVArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.indirectCommandsLayout) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyIndirectCommandsLayoutNV(PFN_vkVoidFunction proc, void *data) {
+    const DestroyIndirectCommandsLayoutNVArgs &args = *static_cast<const DestroyIndirectCommandsLayoutNVArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyIndirectCommandsLayoutNV>(proc)(args.device, args.indirectCommandsLayout, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct CreatePrivateDataSlotEXTArgs {
+    VkDevice                                    device;
+    const VkPrivateDataSlotCreateInfoEXT*       pCreateInfo;
+    const VkAllocationCallbacks*                pAllocator;
+    VkPrivateDataSlotEXT*                       pPrivateDataSlot;
+};
+
+static bool PrepareCreatePrivateDataSlotEXT(ReplayPrep &prep) {
+    CreatePrivateDataSlotEXTArgs &args = prep.NewArgs<CreatePrivateDataSlotEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Array(args.pCreateInfo) &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pPrivateDataSlot) &&
+           prep.Result();
+}
+
+static VkResult InvokeCreatePrivateDataSlotEXT(PFN_vkVoidFunction proc, void *data) {
+    const CreatePrivateDataSlotEXTArgs &args = *static_cast<const CreatePrivateDataSlotEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkCreatePrivateDataSlotEXT>(proc)(args.device, args.pCreateInfo, args.pAllocator, args.pPrivateDataSlot);
+}
+
+struct DestroyPrivateDataSlotEXTArgs {
+    VkDevice                                    device;
+    VkPrivateDataSlotEXT                        privateDataSlot;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyPrivateDataSlotEXT(ReplayPrep &prep) {
+    DestroyPrivateDataSlotEXTArgs &args = prep.NewArgs<DestroyPrivateDataSlotEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.privateDataSlot) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyPrivateDataSlotEXT(PFN_vkVoidFunction proc, void *data) {
+    const DestroyPrivateDataSlotEXTArgs &args = *static_cast<const DestroyPrivateDataSlotEXTArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyPrivateDataSlotEXT>(proc)(args.device, args.privateDataSlot, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct SetPrivateDataEXTArgs {
+    VkDevice                                    device;
+    VkObjectType                                objectType;
+    uint64_t                                    objectHandle;
+    VkPrivateDataSlotEXT                        privateDataSlot;
+    uint64_t                                    data;
+};
+
+static bool PrepareSetPrivateDataEXT(ReplayPrep &prep) {
+    SetPrivateDataEXTArgs &args = prep.NewArgs<SetPrivateDataEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.objectType) &&
+           prep.Value(args.objectHandle) &&
+           prep.Handle(args.privateDataSlot) &&
+           prep.Value(args.data) &&
+           prep.Result();
+}
+
+static VkResult InvokeSetPrivateDataEXT(PFN_vkVoidFunction proc, void *data) {
+    const SetPrivateDataEXTArgs &args = *static_cast<const SetPrivateDataEXTArgs *>(data);
+    return reinterpret_cast<PFN_vkSetPrivateDataEXT>(proc)(args.device, args.objectType, args.objectHandle, args.privateDataSlot, args.data);
+}
+
+struct GetPrivateDataEXTArgs {
+    VkDevice                                    device;
+    VkObjectType                                objectType;
+    uint64_t                                    objectHandle;
+    VkPrivateDataSlotEXT                        privateDataSlot;
+    uint64_t*                                   pData;
+};
+
+static bool PrepareGetPrivateDataEXT(ReplayPrep &prep) {
+    GetPrivateDataEXTArgs &args = prep.NewArgs<GetPrivateDataEXTArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.objectType) &&
+           prep.Value(args.objectHandle) &&
+           prep.Handle(args.privateDataSlot) &&
+           prep.Array(args.pData);
+}
+
+static VkResult InvokeGetPrivateDataEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetPrivateDataEXTArgs &args = *static_cast<const GetPrivateDataEXTArgs *>(data);
+    reinterpret_cast<PFN_vkGetPrivateDataEXT>(proc)(args.device, args.objectType, args.objectHandle, args.privateDataSlot, args.pData);
+    return VK_SUCCESS;
+}
+
+struct CmdSetFragmentShadingRateEnumNVArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkFragmentShadingRateNV                     shadingRate;
+    const VkFragmentShadingRateCombinerOpKHR*   combinerOps;
+};
+
+static bool PrepareCmdSetFragmentShadingRateEnumNV(ReplayPrep &prep) {
+    CmdSetFragmentShadingRateEnumNVArgs &args = prep.NewArgs<CmdSetFragmentShadingRateEnumNVArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.shadingRate) &&
+           prep.Array(args.combinerOps);
+}
+
+static VkResult InvokeCmdSetFragmentShadingRateEnumNV(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetFragmentShadingRateEnumNVArgs &args = *static_cast<const CmdSetFragmentShadingRateEnumNVArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetFragmentShadingRateEnumNV>(proc)(args.commandBuffer, args.shadingRate, args.combinerOps);
+    return VK_SUCCESS;
+}
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+struct AcquireWinrtDisplayNVArgs {
+    VkPhysicalDevice                            physicalDevice;
+    VkDisplayKHR                                display;
+};
+
+static bool PrepareAcquireWinrtDisplayNV(ReplayPrep &prep) {
+    AcquireWinrtDisplayNVArgs &args = prep.NewArgs<AcquireWinrtDisplayNVArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Handle(args.display) &&
+           prep.Result();
+}
+
+static VkResult InvokeAcquireWinrtDisplayNV(PFN_vkVoidFunction proc, void *data) {
+    const AcquireWinrtDisplayNVArgs &args = *static_cast<const AcquireWinrtDisplayNVArgs *>(data);
+    return reinterpret_cast<PFN_vkAcquireWinrtDisplayNV>(proc)(args.physicalDevice, args.display);
+}
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+struct GetWinrtDisplayNVArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    deviceRelativeId;
+    VkDisplayKHR*                               pDisplay;
+};
+
+static bool PrepareGetWinrtDisplayNV(ReplayPrep &prep) {
+    GetWinrtDisplayNVArgs &args = prep.NewArgs<GetWinrtDisplayNVArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.deviceRelativeId) &&
+           prep.NewHandles(args.pDisplay) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetWinrtDisplayNV(PFN_vkVoidFunction proc, void *data) {
+    const GetWinrtDisplayNVArgs &args = *static_cast<const GetWinrtDisplayNVArgs *>(data);
+    return reinterpret_cast<PFN_vkGetWinrtDisplayNV>(proc)(args.physicalDevice, args.deviceRelativeId, args.pDisplay);
+}
+#endif
+
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+struct GetPhysicalDeviceDirectFBPresentationSupportEXTArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    queueFamilyIndex;
+    IDirectFB*                                  dfb;
+};
+
+static bool PrepareGetPhysicalDeviceDirectFBPresentationSupportEXT(ReplayPrep &prep) {
+    GetPhysicalDeviceDirectFBPresentationSupportEXTArgs &args = prep.NewArgs<GetPhysicalDeviceDirectFBPresentationSupportEXTArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.queueFamilyIndex) &&
+           prep.Address(args.dfb) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetPhysicalDeviceDirectFBPresentationSupportEXT(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceDirectFBPresentationSupportEXTArgs &args = *static_cast<const GetPhysicalDeviceDirectFBPresentationSupportEXTArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceDirectFBPresentationSupportEXT>(proc)(args.physicalDevice, args.queueFamilyIndex, args.dfb);
+    return VK_SUCCESS;
+}
+#endif
+
+struct CmdSetVertexInputEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    vertexBindingDescriptionCount;
+    const VkVertexInputBindingDescription2EXT*  pVertexBindingDescriptions;
+    uint32_t                                    vertexAttributeDescriptionCount;
+    const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions;
+};
+
+static bool PrepareCmdSetVertexInputEXT(ReplayPrep &prep) {
+    CmdSetVertexInputEXTArgs &args = prep.NewArgs<CmdSetVertexInputEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.vertexBindingDescriptionCount) &&
+           prep.Array(args.pVertexBindingDescriptions) &&
+           prep.Value(args.vertexAttributeDescriptionCount) &&
+           prep.Array(args.pVertexAttributeDescriptions);
+}
+
+static VkResult InvokeCmdSetVertexInputEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetVertexInputEXTArgs &args = *static_cast<const CmdSetVertexInputEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetVertexInputEXT>(proc)(args.commandBuffer, args.vertexBindingDescriptionCount, args.pVertexBindingDescriptions, args.vertexAttributeDescriptionCount, args.pVertexAttributeDescriptions);
+    return VK_SUCCESS;
+}
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+struct GetMemoryZirconHandlePropertiesFUCHSIAArgs {
+    VkDevice                                    device;
+    VkExternalMemoryHandleTypeFlagBits          handleType;
+    zx_handle_t                                 zirconHandle;
+    VkMemoryZirconHandlePropertiesFUCHSIA*      pMemoryZirconHandleProperties;
+};
+
+static bool PrepareGetMemoryZirconHandlePropertiesFUCHSIA(ReplayPrep &prep) {
+    GetMemoryZirconHandlePropertiesFUCHSIAArgs &args = prep.NewArgs<GetMemoryZirconHandlePropertiesFUCHSIAArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.handleType) &&
+           prep.Value(args.zirconHandle) &&
+           prep.Array(args.pMemoryZirconHandleProperties) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetMemoryZirconHandlePropertiesFUCHSIA(PFN_vkVoidFunction proc, void *data) {
+    const GetMemoryZirconHandlePropertiesFUCHSIAArgs &args = *static_cast<const GetMemoryZirconHandlePropertiesFUCHSIAArgs *>(data);
+    return reinterpret_cast<PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA>(proc)(args.device, args.handleType, args.zirconHandle, args.pMemoryZirconHandleProperties);
+}
+#endif
+
+struct CmdSetPatchControlPointsEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    patchControlPoints;
+};
+
+static bool PrepareCmdSetPatchControlPointsEXT(ReplayPrep &prep) {
+    CmdSetPatchControlPointsEXTArgs &args = prep.NewArgs<CmdSetPatchControlPointsEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.patchControlPoints);
+}
+
+static VkResult InvokeCmdSetPatchControlPointsEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetPatchControlPointsEXTArgs &args = *static_cast<const CmdSetPatchControlPointsEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetPatchControlPointsEXT>(proc)(args.commandBuffer, args.patchControlPoints);
+    return VK_SUCCESS;
+}
+
+struct CmdSetRasterizerDiscardEnableEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBool32                                    rasterizerDiscardEnable;
+};
+
+static bool PrepareCmdSetRasterizerDiscardEnableEXT(ReplayPrep &prep) {
+    CmdSetRasterizerDiscardEnableEXTArgs &args = prep.NewArgs<CmdSetRasterizerDiscardEnableEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.rasterizerDiscardEnable);
+}
+
+static VkResult InvokeCmdSetRasterizerDiscardEnableEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetRasterizerDiscardEnableEXTArgs &args = *static_cast<const CmdSetRasterizerDiscardEnableEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetRasterizerDiscardEnableEXT>(proc)(args.commandBuffer, args.rasterizerDiscardEnable);
+    return VK_SUCCESS;
+}
+
+struct CmdSetDepthBiasEnableEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBool32                                    depthBiasEnable;
+};
+
+static bool PrepareCmdSetDepthBiasEnableEXT(ReplayPrep &prep) {
+    CmdSetDepthBiasEnableEXTArgs &args = prep.NewArgs<CmdSetDepthBiasEnableEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.depthBiasEnable);
+}
+
+static VkResult InvokeCmdSetDepthBiasEnableEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetDepthBiasEnableEXTArgs &args = *static_cast<const CmdSetDepthBiasEnableEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetDepthBiasEnableEXT>(proc)(args.commandBuffer, args.depthBiasEnable);
+    return VK_SUCCESS;
+}
+
+struct CmdSetLogicOpEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkLogicOp                                   logicOp;
+};
+
+static bool PrepareCmdSetLogicOpEXT(ReplayPrep &prep) {
+    CmdSetLogicOpEXTArgs &args = prep.NewArgs<CmdSetLogicOpEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.logicOp);
+}
+
+static VkResult InvokeCmdSetLogicOpEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetLogicOpEXTArgs &args = *static_cast<const CmdSetLogicOpEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetLogicOpEXT>(proc)(args.commandBuffer, args.logicOp);
+    return VK_SUCCESS;
+}
+
+struct CmdSetPrimitiveRestartEnableEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    VkBool32                                    primitiveRestartEnable;
+};
+
+static bool PrepareCmdSetPrimitiveRestartEnableEXT(ReplayPrep &prep) {
+    CmdSetPrimitiveRestartEnableEXTArgs &args = prep.NewArgs<CmdSetPrimitiveRestartEnableEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.primitiveRestartEnable);
+}
+
+static VkResult InvokeCmdSetPrimitiveRestartEnableEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetPrimitiveRestartEnableEXTArgs &args = *static_cast<const CmdSetPrimitiveRestartEnableEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetPrimitiveRestartEnableEXT>(proc)(args.commandBuffer, args.primitiveRestartEnable);
+    return VK_SUCCESS;
+}
+
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+struct GetPhysicalDeviceScreenPresentationSupportQNXArgs {
+    VkPhysicalDevice                            physicalDevice;
+    uint32_t                                    queueFamilyIndex;
+    struct _screen_window*                      window;
+};
+
+static bool PrepareGetPhysicalDeviceScreenPresentationSupportQNX(ReplayPrep &prep) {
+    GetPhysicalDeviceScreenPresentationSupportQNXArgs &args = prep.NewArgs<GetPhysicalDeviceScreenPresentationSupportQNXArgs>();
+    return prep.Handle(args.physicalDevice) &&
+           prep.Value(args.queueFamilyIndex) &&
+           prep.Address(args.window) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetPhysicalDeviceScreenPresentationSupportQNX(PFN_vkVoidFunction proc, void *data) {
+    const GetPhysicalDeviceScreenPresentationSupportQNXArgs &args = *static_cast<const GetPhysicalDeviceScreenPresentationSupportQNXArgs *>(data);
+    reinterpret_cast<PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX>(proc)(args.physicalDevice, args.queueFamilyIndex, args.window);
+    return VK_SUCCESS;
+}
+#endif
+
+struct CmdSetColorWriteEnableEXTArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    attachmentCount;
+    const VkBool32*                             pColorWriteEnables;
+};
+
+static bool PrepareCmdSetColorWriteEnableEXT(ReplayPrep &prep) {
+    CmdSetColorWriteEnableEXTArgs &args = prep.NewArgs<CmdSetColorWriteEnableEXTArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.attachmentCount) &&
+           prep.Array(args.pColorWriteEnables) &&
+           prep.Skip();
+}
+
+static VkResult InvokeCmdSetColorWriteEnableEXT(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetColorWriteEnableEXTArgs &args = *static_cast<const CmdSetColorWriteEnableEXTArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetColorWriteEnableEXT>(proc)(args.commandBuffer, args.attachmentCount, args.pColorWriteEnables);
+    return VK_SUCCESS;
+}
+
+struct DestroyAccelerationStructureKHRArgs {
+    VkDevice                                    device;
+    VkAccelerationStructureKHR                  accelerationStructure;
+    const VkAllocationCallbacks*                pAllocator;
+};
+
+static bool PrepareDestroyAccelerationStructureKHR(ReplayPrep &prep) {
+    DestroyAccelerationStructureKHRArgs &args = prep.NewArgs<DestroyAccelerationStructureKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.accelerationStructure) &&
+           prep.Allocator(args.pAllocator);
+}
+
+static VkResult InvokeDestroyAccelerationStructureKHR(PFN_vkVoidFunction proc, void *data) {
+    const DestroyAccelerationStructureKHRArgs &args = *static_cast<const DestroyAccelerationStructureKHRArgs *>(data);
+    reinterpret_cast<PFN_vkDestroyAccelerationStructureKHR>(proc)(args.device, args.accelerationStructure, args.pAllocator);
+    return VK_SUCCESS;
+}
+
+struct WriteAccelerationStructuresPropertiesKHRArgs {
+    VkDevice                                    device;
+    uint32_t                                    accelerationStructureCount;
+    const VkAccelerationStructureKHR*           pAccelerationStructures;
+    VkQueryType                                 queryType;
+    size_t                                      dataSize;
+    void*                                       pData;
+    size_t                                      stride;
+};
+
+static bool PrepareWriteAccelerationStructuresPropertiesKHR(ReplayPrep &prep) {
+    WriteAccelerationStructuresPropertiesKHRArgs &args = prep.NewArgs<WriteAccelerationStructuresPropertiesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Value(args.accelerationStructureCount) &&
+           prep.Handles(args.pAccelerationStructures) &&
+           prep.Value(args.queryType) &&
+           prep.Value(args.dataSize) &&
+           prep.Bytes(args.pData) &&
+           prep.Value(args.stride) &&
+           prep.Result();
+}
+
+static VkResult InvokeWriteAccelerationStructuresPropertiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const WriteAccelerationStructuresPropertiesKHRArgs &args = *static_cast<const WriteAccelerationStructuresPropertiesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkWriteAccelerationStructuresPropertiesKHR>(proc)(args.device, args.accelerationStructureCount, args.pAccelerationStructures, args.queryType, args.dataSize, args.pData, args.stride);
+}
+
+struct CmdWriteAccelerationStructuresPropertiesKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    accelerationStructureCount;
+    const VkAccelerationStructureKHR*           pAccelerationStructures;
+    VkQueryType                                 queryType;
+    VkQueryPool                                 queryPool;
+    uint32_t                                    firstQuery;
+};
+
+static bool PrepareCmdWriteAccelerationStructuresPropertiesKHR(ReplayPrep &prep) {
+    CmdWriteAccelerationStructuresPropertiesKHRArgs &args = prep.NewArgs<CmdWriteAccelerationStructuresPropertiesKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.accelerationStructureCount) &&
+           prep.Handles(args.pAccelerationStructures) &&
+           prep.Value(args.queryType) &&
+           prep.Handle(args.queryPool) &&
+           prep.Value(args.firstQuery);
+}
+
+static VkResult InvokeCmdWriteAccelerationStructuresPropertiesKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdWriteAccelerationStructuresPropertiesKHRArgs &args = *static_cast<const CmdWriteAccelerationStructuresPropertiesKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdWriteAccelerationStructuresPropertiesKHR>(proc)(args.commandBuffer, args.accelerationStructureCount, args.pAccelerationStructures, args.queryType, args.queryPool, args.firstQuery);
+    return VK_SUCCESS;
+}
+
+struct CmdTraceRaysKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkStridedDeviceAddressRegionKHR*      pRaygenShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pMissShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pHitShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pCallableShaderBindingTable;
+    uint32_t                                    width;
+    uint32_t                                    height;
+    uint32_t                                    depth;
+};
+
+static bool PrepareCmdTraceRaysKHR(ReplayPrep &prep) {
+    CmdTraceRaysKHRArgs &args = prep.NewArgs<CmdTraceRaysKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pRaygenShaderBindingTable) &&
+           prep.Array(args.pMissShaderBindingTable) &&
+           prep.Array(args.pHitShaderBindingTable) &&
+           prep.Array(args.pCallableShaderBindingTable) &&
+           prep.Value(args.width) &&
+           prep.Value(args.height) &&
+           prep.Value(args.depth);
+}
+
+static VkResult InvokeCmdTraceRaysKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdTraceRaysKHRArgs &args = *static_cast<const CmdTraceRaysKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdTraceRaysKHR>(proc)(args.commandBuffer, args.pRaygenShaderBindingTable, args.pMissShaderBindingTable, args.pHitShaderBindingTable, args.pCallableShaderBindingTable, args.width, args.height, args.depth);
+    return VK_SUCCESS;
+}
+
+struct GetRayTracingCaptureReplayShaderGroupHandlesKHRArgs {
+    VkDevice                                    device;
+    VkPipeline                                  pipeline;
+    uint32_t                                    firstGroup;
+    uint32_t                                    groupCount;
+    size_t                                      dataSize;
+    void*                                       pData;
+};
+
+static bool PrepareGetRayTracingCaptureReplayShaderGroupHandlesKHR(ReplayPrep &prep) {
+    GetRayTracingCaptureReplayShaderGroupHandlesKHRArgs &args = prep.NewArgs<GetRayTracingCaptureReplayShaderGroupHandlesKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipeline) &&
+           prep.Value(args.firstGroup) &&
+           prep.Value(args.groupCount) &&
+           prep.Value(args.dataSize) &&
+           prep.Bytes(args.pData) &&
+           prep.Result();
+}
+
+static VkResult InvokeGetRayTracingCaptureReplayShaderGroupHandlesKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetRayTracingCaptureReplayShaderGroupHandlesKHRArgs &args = *static_cast<const GetRayTracingCaptureReplayShaderGroupHandlesKHRArgs *>(data);
+    return reinterpret_cast<PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR>(proc)(args.device, args.pipeline, args.firstGroup, args.groupCount, args.dataSize, args.pData);
+}
+
+struct CmdTraceRaysIndirectKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    const VkStridedDeviceAddressRegionKHR*      pRaygenShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pMissShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pHitShaderBindingTable;
+    const VkStridedDeviceAddressRegionKHR*      pCallableShaderBindingTable;
+    VkDeviceAddress                             indirectDeviceAddress;
+};
+
+static bool PrepareCmdTraceRaysIndirectKHR(ReplayPrep &prep) {
+    CmdTraceRaysIndirectKHRArgs &args = prep.NewArgs<CmdTraceRaysIndirectKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Array(args.pRaygenShaderBindingTable) &&
+           prep.Array(args.pMissShaderBindingTable) &&
+           prep.Array(args.pHitShaderBindingTable) &&
+           prep.Array(args.pCallableShaderBindingTable) &&
+           prep.Value(args.indirectDeviceAddress);
+}
+
+static VkResult InvokeCmdTraceRaysIndirectKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdTraceRaysIndirectKHRArgs &args = *static_cast<const CmdTraceRaysIndirectKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdTraceRaysIndirectKHR>(proc)(args.commandBuffer, args.pRaygenShaderBindingTable, args.pMissShaderBindingTable, args.pHitShaderBindingTable, args.pCallableShaderBindingTable, args.indirectDeviceAddress);
+    return VK_SUCCESS;
+}
+
+struct GetRayTracingShaderGroupStackSizeKHRArgs {
+    VkDevice                                    device;
+    VkPipeline                                  pipeline;
+    uint32_t                                    group;
+    VkShaderGroupShaderKHR                      groupShader;
+};
+
+static bool PrepareGetRayTracingShaderGroupStackSizeKHR(ReplayPrep &prep) {
+    GetRayTracingShaderGroupStackSizeKHRArgs &args = prep.NewArgs<GetRayTracingShaderGroupStackSizeKHRArgs>();
+    return prep.Handle(args.device) &&
+           prep.Handle(args.pipeline) &&
+           prep.Value(args.group) &&
+           prep.Value(args.groupShader) &&
+           prep.Skip();
+}
+
+static VkResult InvokeGetRayTracingShaderGroupStackSizeKHR(PFN_vkVoidFunction proc, void *data) {
+    const GetRayTracingShaderGroupStackSizeKHRArgs &args = *static_cast<const GetRayTracingShaderGroupStackSizeKHRArgs *>(data);
+    reinterpret_cast<PFN_vkGetRayTracingShaderGroupStackSizeKHR>(proc)(args.device, args.pipeline, args.group, args.groupShader);
+    return VK_SUCCESS;
+}
+
+struct CmdSetRayTracingPipelineStackSizeKHRArgs {
+    VkCommandBuffer                             commandBuffer;
+    uint32_t                                    pipelineStackSize;
+};
+
+static bool PrepareCmdSetRayTracingPipelineStackSizeKHR(ReplayPrep &prep) {
+    CmdSetRayTracingPipelineStackSizeKHRArgs &args = prep.NewArgs<CmdSetRayTracingPipelineStackSizeKHRArgs>();
+    return prep.Handle(args.commandBuffer) &&
+           prep.Value(args.pipelineStackSize);
+}
+
+static VkResult InvokeCmdSetRayTracingPipelineStackSizeKHR(PFN_vkVoidFunction proc, void *data) {
+    const CmdSetRayTracingPipelineStackSizeKHRArgs &args = *static_cast<const CmdSetRayTracingPipelineStackSizeKHRArgs *>(data);
+    reinterpret_cast<PFN_vkCmdSetRayTracingPipelineStackSizeKHR>(proc)(args.commandBuffer, args.pipelineStackSize);
+    return VK_SUCCESS;
+}
+
+// Entry points vktracereplay can make calls to, sorted by name
+static const ReplayEntryPoint kReplayEntryPoints[] = {
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkAcquireFullScreenExclusiveModeEXT", PrepareAcquireFullScreenExclusiveModeEXT, InvokeAcquireFullScreenExclusiveModeEXT},
+#endif
+    {"vkAcquireNextImage2KHR", PrepareAcquireNextImage2KHR, InvokeAcquireNextImage2KHR},
+    {"vkAcquireNextImageKHR", PrepareAcquireNextImageKHR, InvokeAcquireNextImageKHR},
+    {"vkAcquirePerformanceConfigurationINTEL", PrepareAcquirePerformanceConfigurationINTEL, InvokeAcquirePerformanceConfigurationINTEL},
+    {"vkAcquireProfilingLockKHR", PrepareAcquireProfilingLockKHR, InvokeAcquireProfilingLockKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkAcquireWinrtDisplayNV", PrepareAcquireWinrtDisplayNV, InvokeAcquireWinrtDisplayNV},
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {"vkAcquireXlibDisplayEXT", PrepareAcquireXlibDisplayEXT, InvokeAcquireXlibDisplayEXT},
+#endif
+    {"vkAllocateCommandBuffers", PrepareAllocateCommandBuffers, InvokeAllocateCommandBuffers},
+    {"vkAllocateDescriptorSets", PrepareAllocateDescriptorSets, InvokeAllocateDescriptorSets},
+    {"vkAllocateMemory", PrepareAllocateMemory, InvokeAllocateMemory},
+    {"vkBeginCommandBuffer", PrepareBeginCommandBuffer, InvokeBeginCommandBuffer},
+    {"vkBindBufferMemory", PrepareBindBufferMemory, InvokeBindBufferMemory},
+    {"vkBindBufferMemory2", PrepareBindBufferMemory2, InvokeBindBufferMemory2},
+    {"vkBindBufferMemory2KHR", PrepareBindBufferMemory2KHR, InvokeBindBufferMemory2KHR},
+    {"vkBindImageMemory", PrepareBindImageMemory, InvokeBindImageMemory},
+    {"vkBindImageMemory2", PrepareBindImageMemory2, InvokeBindImageMemory2},
+    {"vkBindImageMemory2KHR", PrepareBindImageMemory2KHR, InvokeBindImageMemory2KHR},
+    {"vkCmdBeginConditionalRenderingEXT", PrepareCmdBeginConditionalRenderingEXT, InvokeCmdBeginConditionalRenderingEXT},
+    {"vkCmdBeginDebugUtilsLabelEXT", PrepareCmdBeginDebugUtilsLabelEXT, InvokeCmdBeginDebugUtilsLabelEXT},
+    {"vkCmdBeginQuery", PrepareCmdBeginQuery, InvokeCmdBeginQuery},
+    {"vkCmdBeginQueryIndexedEXT", PrepareCmdBeginQueryIndexedEXT, InvokeCmdBeginQueryIndexedEXT},
+    {"vkCmdBeginRenderPass", PrepareCmdBeginRenderPass, InvokeCmdBeginRenderPass},
+    {"vkCmdBeginRenderPass2", PrepareCmdBeginRenderPass2, InvokeCmdBeginRenderPass2},
+    {"vkCmdBeginRenderPass2KHR", PrepareCmdBeginRenderPass2KHR, InvokeCmdBeginRenderPass2KHR},
+    {"vkCmdBeginTransformFeedbackEXT", PrepareCmdBeginTransformFeedbackEXT, InvokeCmdBeginTransformFeedbackEXT},
+    {"vkCmdBindDescriptorSets", PrepareCmdBindDescriptorSets, InvokeCmdBindDescriptorSets},
+    {"vkCmdBindIndexBuffer", PrepareCmdBindIndexBuffer, InvokeCmdBindIndexBuffer},
+    {"vkCmdBindPipeline", PrepareCmdBindPipeline, InvokeCmdBindPipeline},
+    {"vkCmdBindPipelineShaderGroupNV", PrepareCmdBindPipelineShaderGroupNV, InvokeCmdBindPipelineShaderGroupNV},
+    {"vkCmdBindShadingRateImageNV", PrepareCmdBindShadingRateImageNV, InvokeCmdBindShadingRateImageNV},
+    {"vkCmdBindTransformFeedbackBuffersEXT", PrepareCmdBindTransformFeedbackBuffersEXT, InvokeCmdBindTransformFeedbackBuffersEXT},
+    {"vkCmdBindVertexBuffers", PrepareCmdBindVertexBuffers, InvokeCmdBindVertexBuffers},
+    {"vkCmdBindVertexBuffers2EXT", PrepareCmdBindVertexBuffers2EXT, InvokeCmdBindVertexBuffers2EXT},
+    {"vkCmdBlitImage", PrepareCmdBlitImage, InvokeCmdBlitImage},
+    {"vkCmdBlitImage2KHR", PrepareCmdBlitImage2KHR, InvokeCmdBlitImage2KHR},
+    {"vkCmdClearAttachments", PrepareCmdClearAttachments, InvokeCmdClearAttachments},
+    {"vkCmdClearColorImage", PrepareCmdClearColorImage, InvokeCmdClearColorImage},
+    {"vkCmdClearDepthStencilImage", PrepareCmdClearDepthStencilImage, InvokeCmdClearDepthStencilImage},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdControlVideoCodingKHR", PrepareCmdControlVideoCodingKHR, InvokeCmdControlVideoCodingKHR},
+#endif
+    {"vkCmdCopyAccelerationStructureNV", PrepareCmdCopyAccelerationStructureNV, InvokeCmdCopyAccelerationStructureNV},
+    {"vkCmdCopyBuffer", PrepareCmdCopyBuffer, InvokeCmdCopyBuffer},
+    {"vkCmdCopyBuffer2KHR", PrepareCmdCopyBuffer2KHR, InvokeCmdCopyBuffer2KHR},
+    {"vkCmdCopyBufferToImage", PrepareCmdCopyBufferToImage, InvokeCmdCopyBufferToImage},
+    {"vkCmdCopyBufferToImage2KHR", PrepareCmdCopyBufferToImage2KHR, InvokeCmdCopyBufferToImage2KHR},
+    {"vkCmdCopyImage", PrepareCmdCopyImage, InvokeCmdCopyImage},
+    {"vkCmdCopyImage2KHR", PrepareCmdCopyImage2KHR, InvokeCmdCopyImage2KHR},
+    {"vkCmdCopyImageToBuffer", PrepareCmdCopyImageToBuffer, InvokeCmdCopyImageToBuffer},
+    {"vkCmdCopyImageToBuffer2KHR", PrepareCmdCopyImageToBuffer2KHR, InvokeCmdCopyImageToBuffer2KHR},
+    {"vkCmdCopyQueryPoolResults", PrepareCmdCopyQueryPoolResults, InvokeCmdCopyQueryPoolResults},
+    {"vkCmdDebugMarkerBeginEXT", PrepareCmdDebugMarkerBeginEXT, InvokeCmdDebugMarkerBeginEXT},
+    {"vkCmdDebugMarkerEndEXT", PrepareCmdDebugMarkerEndEXT, InvokeCmdDebugMarkerEndEXT},
+    {"vkCmdDebugMarkerInsertEXT", PrepareCmdDebugMarkerInsertEXT, InvokeCmdDebugMarkerInsertEXT},
+    {"vkCmdDispatch", PrepareCmdDispatch, InvokeCmdDispatch},
+    {"vkCmdDispatchBase", PrepareCmdDispatchBase, InvokeCmdDispatchBase},
+    {"vkCmdDispatchBaseKHR", PrepareCmdDispatchBaseKHR, InvokeCmdDispatchBaseKHR},
+    {"vkCmdDispatchIndirect", PrepareCmdDispatchIndirect, InvokeCmdDispatchIndirect},
+    {"vkCmdDraw", PrepareCmdDraw, InvokeCmdDraw},
+    {"vkCmdDrawIndexed", PrepareCmdDrawIndexed, InvokeCmdDrawIndexed},
+    {"vkCmdDrawIndexedIndirect", PrepareCmdDrawIndexedIndirect, InvokeCmdDrawIndexedIndirect},
+    {"vkCmdDrawIndexedIndirectCount", PrepareCmdDrawIndexedIndirectCount, InvokeCmdDrawIndexedIndirectCount},
+    {"vkCmdDrawIndexedIndirectCountAMD", PrepareCmdDrawIndexedIndirectCountAMD, InvokeCmdDrawIndexedIndirectCountAMD},
+    {"vkCmdDrawIndexedIndirectCountKHR", PrepareCmdDrawIndexedIndirectCountKHR, InvokeCmdDrawIndexedIndirectCountKHR},
+    {"vkCmdDrawIndirect", PrepareCmdDrawIndirect, InvokeCmdDrawIndirect},
+    {"vkCmdDrawIndirectByteCountEXT", PrepareCmdDrawIndirectByteCountEXT, InvokeCmdDrawIndirectByteCountEXT},
+    {"vkCmdDrawIndirectCount", PrepareCmdDrawIndirectCount, InvokeCmdDrawIndirectCount},
+    {"vkCmdDrawIndirectCountAMD", PrepareCmdDrawIndirectCountAMD, InvokeCmdDrawIndirectCountAMD},
+    {"vkCmdDrawIndirectCountKHR", PrepareCmdDrawIndirectCountKHR, InvokeCmdDrawIndirectCountKHR},
+    {"vkCmdDrawMeshTasksIndirectCountNV", PrepareCmdDrawMeshTasksIndirectCountNV, InvokeCmdDrawMeshTasksIndirectCountNV},
+    {"vkCmdDrawMeshTasksIndirectNV", PrepareCmdDrawMeshTasksIndirectNV, InvokeCmdDrawMeshTasksIndirectNV},
+    {"vkCmdDrawMeshTasksNV", PrepareCmdDrawMeshTasksNV, InvokeCmdDrawMeshTasksNV},
+    {"vkCmdEndConditionalRenderingEXT", PrepareCmdEndConditionalRenderingEXT, InvokeCmdEndConditionalRenderingEXT},
+    {"vkCmdEndDebugUtilsLabelEXT", PrepareCmdEndDebugUtilsLabelEXT, InvokeCmdEndDebugUtilsLabelEXT},
+    {"vkCmdEndQuery", PrepareCmdEndQuery, InvokeCmdEndQuery},
+    {"vkCmdEndQueryIndexedEXT", PrepareCmdEndQueryIndexedEXT, InvokeCmdEndQueryIndexedEXT},
+    {"vkCmdEndRenderPass", PrepareCmdEndRenderPass, InvokeCmdEndRenderPass},
+    {"vkCmdEndRenderPass2", PrepareCmdEndRenderPass2, InvokeCmdEndRenderPass2},
+    {"vkCmdEndRenderPass2KHR", PrepareCmdEndRenderPass2KHR, InvokeCmdEndRenderPass2KHR},
+    {"vkCmdEndTransformFeedbackEXT", PrepareCmdEndTransformFeedbackEXT, InvokeCmdEndTransformFeedbackEXT},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdEndVideoCodingKHR", PrepareCmdEndVideoCodingKHR, InvokeCmdEndVideoCodingKHR},
+#endif
+    {"vkCmdExecuteCommands", PrepareCmdExecuteCommands, InvokeCmdExecuteCommands},
+    {"vkCmdFillBuffer", PrepareCmdFillBuffer, InvokeCmdFillBuffer},
+    {"vkCmdInsertDebugUtilsLabelEXT", PrepareCmdInsertDebugUtilsLabelEXT, InvokeCmdInsertDebugUtilsLabelEXT},
+    {"vkCmdNextSubpass", PrepareCmdNextSubpass, InvokeCmdNextSubpass},
+    {"vkCmdNextSubpass2", PrepareCmdNextSubpass2, InvokeCmdNextSubpass2},
+    {"vkCmdNextSubpass2KHR", PrepareCmdNextSubpass2KHR, InvokeCmdNextSubpass2KHR},
+    {"vkCmdPipelineBarrier", PrepareCmdPipelineBarrier, InvokeCmdPipelineBarrier},
+    {"vkCmdPipelineBarrier2KHR", PrepareCmdPipelineBarrier2KHR, InvokeCmdPipelineBarrier2KHR},
+    {"vkCmdPushConstants", PrepareCmdPushConstants, InvokeCmdPushConstants},
+    {"vkCmdPushDescriptorSetKHR", PrepareCmdPushDescriptorSetKHR, InvokeCmdPushDescriptorSetKHR},
+    {"vkCmdPushDescriptorSetWithTemplateKHR", PrepareCmdPushDescriptorSetWithTemplateKHR, InvokeCmdPushDescriptorSetWithTemplateKHR},
+    {"vkCmdResetEvent", PrepareCmdResetEvent, InvokeCmdResetEvent},
+    {"vkCmdResetEvent2KHR", PrepareCmdResetEvent2KHR, InvokeCmdResetEvent2KHR},
+    {"vkCmdResetQueryPool", PrepareCmdResetQueryPool, InvokeCmdResetQueryPool},
+    {"vkCmdResolveImage", PrepareCmdResolveImage, InvokeCmdResolveImage},
+    {"vkCmdResolveImage2KHR", PrepareCmdResolveImage2KHR, InvokeCmdResolveImage2KHR},
+    {"vkCmdSetBlendConstants", PrepareCmdSetBlendConstants, InvokeCmdSetBlendConstants},
+    {"vkCmdSetCheckpointNV", PrepareCmdSetCheckpointNV, InvokeCmdSetCheckpointNV},
+    {"vkCmdSetColorWriteEnableEXT", PrepareCmdSetColorWriteEnableEXT, InvokeCmdSetColorWriteEnableEXT},
+    {"vkCmdSetCullModeEXT", PrepareCmdSetCullModeEXT, InvokeCmdSetCullModeEXT},
+    {"vkCmdSetDepthBias", PrepareCmdSetDepthBias, InvokeCmdSetDepthBias},
+    {"vkCmdSetDepthBiasEnableEXT", PrepareCmdSetDepthBiasEnableEXT, InvokeCmdSetDepthBiasEnableEXT},
+    {"vkCmdSetDepthBounds", PrepareCmdSetDepthBounds, InvokeCmdSetDepthBounds},
+    {"vkCmdSetDepthBoundsTestEnableEXT", PrepareCmdSetDepthBoundsTestEnableEXT, InvokeCmdSetDepthBoundsTestEnableEXT},
+    {"vkCmdSetDepthCompareOpEXT", PrepareCmdSetDepthCompareOpEXT, InvokeCmdSetDepthCompareOpEXT},
+    {"vkCmdSetDepthTestEnableEXT", PrepareCmdSetDepthTestEnableEXT, InvokeCmdSetDepthTestEnableEXT},
+    {"vkCmdSetDepthWriteEnableEXT", PrepareCmdSetDepthWriteEnableEXT, InvokeCmdSetDepthWriteEnableEXT},
+    {"vkCmdSetDeviceMask", PrepareCmdSetDeviceMask, InvokeCmdSetDeviceMask},
+    {"vkCmdSetDeviceMaskKHR", PrepareCmdSetDeviceMaskKHR, InvokeCmdSetDeviceMaskKHR},
+    {"vkCmdSetDiscardRectangleEXT", PrepareCmdSetDiscardRectangleEXT, InvokeCmdSetDiscardRectangleEXT},
+    {"vkCmdSetEvent", PrepareCmdSetEvent, InvokeCmdSetEvent},
+    {"vkCmdSetEvent2KHR", PrepareCmdSetEvent2KHR, InvokeCmdSetEvent2KHR},
+    {"vkCmdSetExclusiveScissorNV", PrepareCmdSetExclusiveScissorNV, InvokeCmdSetExclusiveScissorNV},
+    {"vkCmdSetFragmentShadingRateEnumNV", PrepareCmdSetFragmentShadingRateEnumNV, InvokeCmdSetFragmentShadingRateEnumNV},
+    {"vkCmdSetFragmentShadingRateKHR", PrepareCmdSetFragmentShadingRateKHR, InvokeCmdSetFragmentShadingRateKHR},
+    {"vkCmdSetFrontFaceEXT", PrepareCmdSetFrontFaceEXT, InvokeCmdSetFrontFaceEXT},
+    {"vkCmdSetLineStippleEXT", PrepareCmdSetLineStippleEXT, InvokeCmdSetLineStippleEXT},
+    {"vkCmdSetLineWidth", PrepareCmdSetLineWidth, InvokeCmdSetLineWidth},
+    {"vkCmdSetLogicOpEXT", PrepareCmdSetLogicOpEXT, InvokeCmdSetLogicOpEXT},
+    {"vkCmdSetPatchControlPointsEXT", PrepareCmdSetPatchControlPointsEXT, InvokeCmdSetPatchControlPointsEXT},
+    {"vkCmdSetPerformanceMarkerINTEL", PrepareCmdSetPerformanceMarkerINTEL, InvokeCmdSetPerformanceMarkerINTEL},
+    {"vkCmdSetPerformanceOverrideINTEL", PrepareCmdSetPerformanceOverrideINTEL, InvokeCmdSetPerformanceOverrideINTEL},
+    {"vkCmdSetPerformanceStreamMarkerINTEL", PrepareCmdSetPerformanceStreamMarkerINTEL, InvokeCmdSetPerformanceStreamMarkerINTEL},
+    {"vkCmdSetPrimitiveRestartEnableEXT", PrepareCmdSetPrimitiveRestartEnableEXT, InvokeCmdSetPrimitiveRestartEnableEXT},
+    {"vkCmdSetPrimitiveTopologyEXT", PrepareCmdSetPrimitiveTopologyEXT, InvokeCmdSetPrimitiveTopologyEXT},
+    {"vkCmdSetRasterizerDiscardEnableEXT", PrepareCmdSetRasterizerDiscardEnableEXT, InvokeCmdSetRasterizerDiscardEnableEXT},
+    {"vkCmdSetRayTracingPipelineStackSizeKHR", PrepareCmdSetRayTracingPipelineStackSizeKHR, InvokeCmdSetRayTracingPipelineStackSizeKHR},
+    {"vkCmdSetScissor", PrepareCmdSetScissor, InvokeCmdSetScissor},
+    {"vkCmdSetScissorWithCountEXT", PrepareCmdSetScissorWithCountEXT, InvokeCmdSetScissorWithCountEXT},
+    {"vkCmdSetStencilCompareMask", PrepareCmdSetStencilCompareMask, InvokeCmdSetStencilCompareMask},
+    {"vkCmdSetStencilOpEXT", PrepareCmdSetStencilOpEXT, InvokeCmdSetStencilOpEXT},
+    {"vkCmdSetStencilReference", PrepareCmdSetStencilReference, InvokeCmdSetStencilReference},
+    {"vkCmdSetStencilTestEnableEXT", PrepareCmdSetStencilTestEnableEXT, InvokeCmdSetStencilTestEnableEXT},
+    {"vkCmdSetStencilWriteMask", PrepareCmdSetStencilWriteMask, InvokeCmdSetStencilWriteMask},
+    {"vkCmdSetVertexInputEXT", PrepareCmdSetVertexInputEXT, InvokeCmdSetVertexInputEXT},
+    {"vkCmdSetViewport", PrepareCmdSetViewport, InvokeCmdSetViewport},
+    {"vkCmdSetViewportWScalingNV", PrepareCmdSetViewportWScalingNV, InvokeCmdSetViewportWScalingNV},
+    {"vkCmdSetViewportWithCountEXT", PrepareCmdSetViewportWithCountEXT, InvokeCmdSetViewportWithCountEXT},
+    {"vkCmdTraceRaysIndirectKHR", PrepareCmdTraceRaysIndirectKHR, InvokeCmdTraceRaysIndirectKHR},
+    {"vkCmdTraceRaysKHR", PrepareCmdTraceRaysKHR, InvokeCmdTraceRaysKHR},
+    {"vkCmdTraceRaysNV", PrepareCmdTraceRaysNV, InvokeCmdTraceRaysNV},
+    {"vkCmdUpdateBuffer", PrepareCmdUpdateBuffer, InvokeCmdUpdateBuffer},
+    {"vkCmdWaitEvents", PrepareCmdWaitEvents, InvokeCmdWaitEvents},
+    {"vkCmdWaitEvents2KHR", PrepareCmdWaitEvents2KHR, InvokeCmdWaitEvents2KHR},
+    {"vkCmdWriteAccelerationStructuresPropertiesKHR", PrepareCmdWriteAccelerationStructuresPropertiesKHR, InvokeCmdWriteAccelerationStructuresPropertiesKHR},
+    {"vkCmdWriteAccelerationStructuresPropertiesNV", PrepareCmdWriteAccelerationStructuresPropertiesNV, InvokeCmdWriteAccelerationStructuresPropertiesNV},
+    {"vkCmdWriteBufferMarker2AMD", PrepareCmdWriteBufferMarker2AMD, InvokeCmdWriteBufferMarker2AMD},
+    {"vkCmdWriteBufferMarkerAMD", PrepareCmdWriteBufferMarkerAMD, InvokeCmdWriteBufferMarkerAMD},
+    {"vkCmdWriteTimestamp", PrepareCmdWriteTimestamp, InvokeCmdWriteTimestamp},
+    {"vkCmdWriteTimestamp2KHR", PrepareCmdWriteTimestamp2KHR, InvokeCmdWriteTimestamp2KHR},
+    {"vkCompileDeferredNV", PrepareCompileDeferredNV, InvokeCompileDeferredNV},
+    {"vkCreateBuffer", PrepareCreateBuffer, InvokeCreateBuffer},
+    {"vkCreateBufferView", PrepareCreateBufferView, InvokeCreateBufferView},
+    {"vkCreateCommandPool", PrepareCreateCommandPool, InvokeCreateCommandPool},
+    {"vkCreateComputePipelines", PrepareCreateComputePipelines, InvokeCreateComputePipelines},
+    {"vkCreateDeferredOperationKHR", PrepareCreateDeferredOperationKHR, InvokeCreateDeferredOperationKHR},
+    {"vkCreateDescriptorPool", PrepareCreateDescriptorPool, InvokeCreateDescriptorPool},
+    {"vkCreateDescriptorSetLayout", PrepareCreateDescriptorSetLayout, InvokeCreateDescriptorSetLayout},
+    {"vkCreateDescriptorUpdateTemplate", PrepareCreateDescriptorUpdateTemplate, InvokeCreateDescriptorUpdateTemplate},
+    {"vkCreateDescriptorUpdateTemplateKHR", PrepareCreateDescriptorUpdateTemplateKHR, InvokeCreateDescriptorUpdateTemplateKHR},
+    {"vkCreateDevice", PrepareCreateDevice, InvokeCreateDevice},
+    {"vkCreateDisplayModeKHR", PrepareCreateDisplayModeKHR, InvokeCreateDisplayModeKHR},
+    {"vkCreateDisplayPlaneSurfaceKHR", PrepareCreateDisplayPlaneSurfaceKHR, InvokeCreateDisplayPlaneSurfaceKHR},
+    {"vkCreateEvent", PrepareCreateEvent, InvokeCreateEvent},
+    {"vkCreateFence", PrepareCreateFence, InvokeCreateFence},
+    {"vkCreateFramebuffer", PrepareCreateFramebuffer, InvokeCreateFramebuffer},
+    {"vkCreateGraphicsPipelines", PrepareCreateGraphicsPipelines, InvokeCreateGraphicsPipelines},
+    {"vkCreateHeadlessSurfaceEXT", PrepareCreateHeadlessSurfaceEXT, InvokeCreateHeadlessSurfaceEXT},
+    {"vkCreateImage", PrepareCreateImage, InvokeCreateImage},
+    {"vkCreateImageView", PrepareCreateImageView, InvokeCreateImageView},
+    {"vkCreateInstance", PrepareCreateInstance, InvokeCreateInstance},
+    {"vkCreatePipelineCache", PrepareCreatePipelineCache, InvokeCreatePipelineCache},
+    {"vkCreatePipelineLayout", PrepareCreatePipelineLayout, InvokeCreatePipelineLayout},
+    {"vkCreatePrivateDataSlotEXT", PrepareCreatePrivateDataSlotEXT, InvokeCreatePrivateDataSlotEXT},
+    {"vkCreateQueryPool", PrepareCreateQueryPool, InvokeCreateQueryPool},
+    {"vkCreateRenderPass", PrepareCreateRenderPass, InvokeCreateRenderPass},
+    {"vkCreateRenderPass2", PrepareCreateRenderPass2, InvokeCreateRenderPass2},
+    {"vkCreateRenderPass2KHR", PrepareCreateRenderPass2KHR, InvokeCreateRenderPass2KHR},
+    {"vkCreateSampler", PrepareCreateSampler, InvokeCreateSampler},
+    {"vkCreateSamplerYcbcrConversion", PrepareCreateSamplerYcbcrConversion, InvokeCreateSamplerYcbcrConversion},
+    {"vkCreateSamplerYcbcrConversionKHR", PrepareCreateSamplerYcbcrConversionKHR, InvokeCreateSamplerYcbcrConversionKHR},
+    {"vkCreateSemaphore", PrepareCreateSemaphore, InvokeCreateSemaphore},
+    {"vkCreateShaderModule", PrepareCreateShaderModule, InvokeCreateShaderModule},
+    {"vkCreateSharedSwapchainsKHR", PrepareCreateSharedSwapchainsKHR, InvokeCreateSharedSwapchainsKHR},
+    {"vkCreateSwapchainKHR", PrepareCreateSwapchainKHR, InvokeCreateSwapchainKHR},
+    {"vkDebugReportMessageEXT", PrepareDebugReportMessageEXT, InvokeDebugReportMessageEXT},
+    {"vkDeferredOperationJoinKHR", PrepareDeferredOperationJoinKHR, InvokeDeferredOperationJoinKHR},
+    {"vkDestroyAccelerationStructureKHR", PrepareDestroyAccelerationStructureKHR, InvokeDestroyAccelerationStructureKHR},
+    {"vkDestroyAccelerationStructureNV", PrepareDestroyAccelerationStructureNV, InvokeDestroyAccelerationStructureNV},
+    {"vkDestroyBuffer", PrepareDestroyBuffer, InvokeDestroyBuffer},
+    {"vkDestroyBufferView", PrepareDestroyBufferView, InvokeDestroyBufferView},
+    {"vkDestroyCommandPool", PrepareDestroyCommandPool, InvokeDestroyCommandPool},
+    {"vkDestroyCuFunctionNVX", PrepareDestroyCuFunctionNVX, InvokeDestroyCuFunctionNVX},
+    {"vkDestroyCuModuleNVX", PrepareDestroyCuModuleNVX, InvokeDestroyCuModuleNVX},
+    {"vkDestroyDebugReportCallbackEXT", PrepareDestroyDebugReportCallbackEXT, InvokeDestroyDebugReportCallbackEXT},
+    {"vkDestroyDebugUtilsMessengerEXT", PrepareDestroyDebugUtilsMessengerEXT, InvokeDestroyDebugUtilsMessengerEXT},
+    {"vkDestroyDeferredOperationKHR", PrepareDestroyDeferredOperationKHR, InvokeDestroyDeferredOperationKHR},
+    {"vkDestroyDescriptorPool", PrepareDestroyDescriptorPool, InvokeDestroyDescriptorPool},
+    {"vkDestroyDescriptorSetLayout", PrepareDestroyDescriptorSetLayout, InvokeDestroyDescriptorSetLayout},
+    {"vkDestroyDescriptorUpdateTemplate", PrepareDestroyDescriptorUpdateTemplate, InvokeDestroyDescriptorUpdateTemplate},
+    {"vkDestroyDescriptorUpdateTemplateKHR", PrepareDestroyDescriptorUpdateTemplateKHR, InvokeDestroyDescriptorUpdateTemplateKHR},
+    {"vkDestroyDevice", PrepareDestroyDevice, InvokeDestroyDevice},
+    {"vkDestroyEvent", PrepareDestroyEvent, InvokeDestroyEvent},
+    {"vkDestroyFence", PrepareDestroyFence, InvokeDestroyFence},
+    {"vkDestroyFramebuffer", PrepareDestroyFramebuffer, InvokeDestroyFramebuffer},
+    {"vkDestroyImage", PrepareDestroyImage, InvokeDestroyImage},
+    {"vkDestroyImageView", PrepareDestroyImageView, InvokeDestroyImageView},
+    {"vkDestroyIndirectCommandsLayoutNV", PrepareDestroyIndirectCommandsLayoutNV, InvokeDestroyIndirectCommandsLayoutNV},
+    {"vkDestroyInstance", PrepareDestroyInstance, InvokeDestroyInstance},
+    {"vkDestroyPipeline", PrepareDestroyPipeline, InvokeDestroyPipeline},
+    {"vkDestroyPipelineCache", PrepareDestroyPipelineCache, InvokeDestroyPipelineCache},
+    {"vkDestroyPipelineLayout", PrepareDestroyPipelineLayout, InvokeDestroyPipelineLayout},
+    {"vkDestroyPrivateDataSlotEXT", PrepareDestroyPrivateDataSlotEXT, InvokeDestroyPrivateDataSlotEXT},
+    {"vkDestroyQueryPool", PrepareDestroyQueryPool, InvokeDestroyQueryPool},
+    {"vkDestroyRenderPass", PrepareDestroyRenderPass, InvokeDestroyRenderPass},
+    {"vkDestroySampler", PrepareDestroySampler, InvokeDestroySampler},
+    {"vkDestroySamplerYcbcrConversion", PrepareDestroySamplerYcbcrConversion, InvokeDestroySamplerYcbcrConversion},
+    {"vkDestroySamplerYcbcrConversionKHR", PrepareDestroySamplerYcbcrConversionKHR, InvokeDestroySamplerYcbcrConversionKHR},
+    {"vkDestroySemaphore", PrepareDestroySemaphore, InvokeDestroySemaphore},
+    {"vkDestroyShaderModule", PrepareDestroyShaderModule, InvokeDestroyShaderModule},
+    {"vkDestroySurfaceKHR", PrepareDestroySurfaceKHR, InvokeDestroySurfaceKHR},
+    {"vkDestroySwapchainKHR", PrepareDestroySwapchainKHR, InvokeDestroySwapchainKHR},
+    {"vkDestroyValidationCacheEXT", PrepareDestroyValidationCacheEXT, InvokeDestroyValidationCacheEXT},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkDestroyVideoSessionKHR", PrepareDestroyVideoSessionKHR, InvokeDestroyVideoSessionKHR},
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkDestroyVideoSessionParametersKHR", PrepareDestroyVideoSessionParametersKHR, InvokeDestroyVideoSessionParametersKHR},
+#endif
+    {"vkDeviceWaitIdle", PrepareDeviceWaitIdle, InvokeDeviceWaitIdle},
+    {"vkDisplayPowerControlEXT", PrepareDisplayPowerControlEXT, InvokeDisplayPowerControlEXT},
+    {"vkEndCommandBuffer", PrepareEndCommandBuffer, InvokeEndCommandBuffer},
+    {"vkEnumerateDeviceExtensionProperties", PrepareEnumerateDeviceExtensionProperties, InvokeEnumerateDeviceExtensionProperties},
+    {"vkEnumerateDeviceLayerProperties", PrepareEnumerateDeviceLayerProperties, InvokeEnumerateDeviceLayerProperties},
+    {"vkEnumerateInstanceExtensionProperties", PrepareEnumerateInstanceExtensionProperties, InvokeEnumerateInstanceExtensionProperties},
+    {"vkEnumerateInstanceLayerProperties", PrepareEnumerateInstanceLayerProperties, InvokeEnumerateInstanceLayerProperties},
+    {"vkEnumerateInstanceVersion", PrepareEnumerateInstanceVersion, InvokeEnumerateInstanceVersion},
+    {"vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR", PrepareEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR, InvokeEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR},
+    {"vkEnumeratePhysicalDevices", PrepareEnumeratePhysicalDevices, InvokeEnumeratePhysicalDevices},
+    {"vkFlushMappedMemoryRanges", PrepareFlushMappedMemoryRanges, InvokeFlushMappedMemoryRanges},
+    {"vkFreeCommandBuffers", PrepareFreeCommandBuffers, InvokeFreeCommandBuffers},
+    {"vkFreeDescriptorSets", PrepareFreeDescriptorSets, InvokeFreeDescriptorSets},
+    {"vkFreeMemory", PrepareFreeMemory, InvokeFreeMemory},
+    {"vkGetAccelerationStructureHandleNV", PrepareGetAccelerationStructureHandleNV, InvokeGetAccelerationStructureHandleNV},
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {"vkGetAndroidHardwareBufferPropertiesANDROID", PrepareGetAndroidHardwareBufferPropertiesANDROID, InvokeGetAndroidHardwareBufferPropertiesANDROID},
+#endif
+    {"vkGetBufferDeviceAddress", PrepareGetBufferDeviceAddress, InvokeGetBufferDeviceAddress},
+    {"vkGetBufferDeviceAddressEXT", PrepareGetBufferDeviceAddressEXT, InvokeGetBufferDeviceAddressEXT},
+    {"vkGetBufferDeviceAddressKHR", PrepareGetBufferDeviceAddressKHR, InvokeGetBufferDeviceAddressKHR},
+    {"vkGetBufferMemoryRequirements", PrepareGetBufferMemoryRequirements, InvokeGetBufferMemoryRequirements},
+    {"vkGetBufferMemoryRequirements2", PrepareGetBufferMemoryRequirements2, InvokeGetBufferMemoryRequirements2},
+    {"vkGetBufferMemoryRequirements2KHR", PrepareGetBufferMemoryRequirements2KHR, InvokeGetBufferMemoryRequirements2KHR},
+    {"vkGetBufferOpaqueCaptureAddress", PrepareGetBufferOpaqueCaptureAddress, InvokeGetBufferOpaqueCaptureAddress},
+    {"vkGetBufferOpaqueCaptureAddressKHR", PrepareGetBufferOpaqueCaptureAddressKHR, InvokeGetBufferOpaqueCaptureAddressKHR},
+    {"vkGetCalibratedTimestampsEXT", PrepareGetCalibratedTimestampsEXT, InvokeGetCalibratedTimestampsEXT},
+    {"vkGetDeferredOperationMaxConcurrencyKHR", PrepareGetDeferredOperationMaxConcurrencyKHR, InvokeGetDeferredOperationMaxConcurrencyKHR},
+    {"vkGetDeferredOperationResultKHR", PrepareGetDeferredOperationResultKHR, InvokeGetDeferredOperationResultKHR},
+    {"vkGetDescriptorSetLayoutSupport", PrepareGetDescriptorSetLayoutSupport, InvokeGetDescriptorSetLayoutSupport},
+    {"vkGetDescriptorSetLayoutSupportKHR", PrepareGetDescriptorSetLayoutSupportKHR, InvokeGetDescriptorSetLayoutSupportKHR},
+    {"vkGetDeviceGroupPeerMemoryFeatures", PrepareGetDeviceGroupPeerMemoryFeatures, InvokeGetDeviceGroupPeerMemoryFeatures},
+    {"vkGetDeviceGroupPeerMemoryFeaturesKHR", PrepareGetDeviceGroupPeerMemoryFeaturesKHR, InvokeGetDeviceGroupPeerMemoryFeaturesKHR},
+    {"vkGetDeviceGroupPresentCapabilitiesKHR", PrepareGetDeviceGroupPresentCapabilitiesKHR, InvokeGetDeviceGroupPresentCapabilitiesKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetDeviceGroupSurfacePresentModes2EXT", PrepareGetDeviceGroupSurfacePresentModes2EXT, InvokeGetDeviceGroupSurfacePresentModes2EXT},
+#endif
+    {"vkGetDeviceGroupSurfacePresentModesKHR", PrepareGetDeviceGroupSurfacePresentModesKHR, InvokeGetDeviceGroupSurfacePresentModesKHR},
+    {"vkGetDeviceMemoryCommitment", PrepareGetDeviceMemoryCommitment, InvokeGetDeviceMemoryCommitment},
+    {"vkGetDeviceMemoryOpaqueCaptureAddress", PrepareGetDeviceMemoryOpaqueCaptureAddress, InvokeGetDeviceMemoryOpaqueCaptureAddress},
+    {"vkGetDeviceMemoryOpaqueCaptureAddressKHR", PrepareGetDeviceMemoryOpaqueCaptureAddressKHR, InvokeGetDeviceMemoryOpaqueCaptureAddressKHR},
+    {"vkGetDeviceProcAddr", PrepareGetDeviceProcAddr, InvokeGetDeviceProcAddr},
+    {"vkGetDeviceQueue", PrepareGetDeviceQueue, InvokeGetDeviceQueue},
+    {"vkGetDeviceQueue2", PrepareGetDeviceQueue2, InvokeGetDeviceQueue2},
+    {"vkGetDisplayPlaneCapabilities2KHR", PrepareGetDisplayPlaneCapabilities2KHR, InvokeGetDisplayPlaneCapabilities2KHR},
+    {"vkGetDisplayPlaneCapabilitiesKHR", PrepareGetDisplayPlaneCapabilitiesKHR, InvokeGetDisplayPlaneCapabilitiesKHR},
+    {"vkGetDisplayPlaneSupportedDisplaysKHR", PrepareGetDisplayPlaneSupportedDisplaysKHR, InvokeGetDisplayPlaneSupportedDisplaysKHR},
+    {"vkGetEventStatus", PrepareGetEventStatus, InvokeGetEventStatus},
+    {"vkGetFenceFdKHR", PrepareGetFenceFdKHR, InvokeGetFenceFdKHR},
+    {"vkGetFenceStatus", PrepareGetFenceStatus, InvokeGetFenceStatus},
+    {"vkGetImageDrmFormatModifierPropertiesEXT", PrepareGetImageDrmFormatModifierPropertiesEXT, InvokeGetImageDrmFormatModifierPropertiesEXT},
+    {"vkGetImageMemoryRequirements", PrepareGetImageMemoryRequirements, InvokeGetImageMemoryRequirements},
+    {"vkGetImageMemoryRequirements2", PrepareGetImageMemoryRequirements2, InvokeGetImageMemoryRequirements2},
+    {"vkGetImageMemoryRequirements2KHR", PrepareGetImageMemoryRequirements2KHR, InvokeGetImageMemoryRequirements2KHR},
+    {"vkGetImageSparseMemoryRequirements", PrepareGetImageSparseMemoryRequirements, InvokeGetImageSparseMemoryRequirements},
+    {"vkGetImageSparseMemoryRequirements2", PrepareGetImageSparseMemoryRequirements2, InvokeGetImageSparseMemoryRequirements2},
+    {"vkGetImageSparseMemoryRequirements2KHR", PrepareGetImageSparseMemoryRequirements2KHR, InvokeGetImageSparseMemoryRequirements2KHR},
+    {"vkGetImageSubresourceLayout", PrepareGetImageSubresourceLayout, InvokeGetImageSubresourceLayout},
+    {"vkGetImageViewAddressNVX", PrepareGetImageViewAddressNVX, InvokeGetImageViewAddressNVX},
+    {"vkGetInstanceProcAddr", PrepareGetInstanceProcAddr, InvokeGetInstanceProcAddr},
+    {"vkGetMemoryFdKHR", PrepareGetMemoryFdKHR, InvokeGetMemoryFdKHR},
+    {"vkGetMemoryFdPropertiesKHR", PrepareGetMemoryFdPropertiesKHR, InvokeGetMemoryFdPropertiesKHR},
+    {"vkGetMemoryHostPointerPropertiesEXT", PrepareGetMemoryHostPointerPropertiesEXT, InvokeGetMemoryHostPointerPropertiesEXT},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetMemoryWin32HandleNV", PrepareGetMemoryWin32HandleNV, InvokeGetMemoryWin32HandleNV},
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetMemoryWin32HandlePropertiesKHR", PrepareGetMemoryWin32HandlePropertiesKHR, InvokeGetMemoryWin32HandlePropertiesKHR},
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {"vkGetMemoryZirconHandlePropertiesFUCHSIA", PrepareGetMemoryZirconHandlePropertiesFUCHSIA, InvokeGetMemoryZirconHandlePropertiesFUCHSIA},
+#endif
+    {"vkGetPastPresentationTimingGOOGLE", PrepareGetPastPresentationTimingGOOGLE, InvokeGetPastPresentationTimingGOOGLE},
+    {"vkGetPhysicalDeviceCalibrateableTimeDomainsEXT", PrepareGetPhysicalDeviceCalibrateableTimeDomainsEXT, InvokeGetPhysicalDeviceCalibrateableTimeDomainsEXT},
+    {"vkGetPhysicalDeviceCooperativeMatrixPropertiesNV", PrepareGetPhysicalDeviceCooperativeMatrixPropertiesNV, InvokeGetPhysicalDeviceCooperativeMatrixPropertiesNV},
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    {"vkGetPhysicalDeviceDirectFBPresentationSupportEXT", PrepareGetPhysicalDeviceDirectFBPresentationSupportEXT, InvokeGetPhysicalDeviceDirectFBPresentationSupportEXT},
+#endif
+    {"vkGetPhysicalDeviceExternalBufferProperties", PrepareGetPhysicalDeviceExternalBufferProperties, InvokeGetPhysicalDeviceExternalBufferProperties},
+    {"vkGetPhysicalDeviceExternalBufferPropertiesKHR", PrepareGetPhysicalDeviceExternalBufferPropertiesKHR, InvokeGetPhysicalDeviceExternalBufferPropertiesKHR},
+    {"vkGetPhysicalDeviceExternalFenceProperties", PrepareGetPhysicalDeviceExternalFenceProperties, InvokeGetPhysicalDeviceExternalFenceProperties},
+    {"vkGetPhysicalDeviceExternalFencePropertiesKHR", PrepareGetPhysicalDeviceExternalFencePropertiesKHR, InvokeGetPhysicalDeviceExternalFencePropertiesKHR},
+    {"vkGetPhysicalDeviceExternalImageFormatPropertiesNV", PrepareGetPhysicalDeviceExternalImageFormatPropertiesNV, InvokeGetPhysicalDeviceExternalImageFormatPropertiesNV},
+    {"vkGetPhysicalDeviceExternalSemaphoreProperties", PrepareGetPhysicalDeviceExternalSemaphoreProperties, InvokeGetPhysicalDeviceExternalSemaphoreProperties},
+    {"vkGetPhysicalDeviceExternalSemaphorePropertiesKHR", PrepareGetPhysicalDeviceExternalSemaphorePropertiesKHR, InvokeGetPhysicalDeviceExternalSemaphorePropertiesKHR},
+    {"vkGetPhysicalDeviceFeatures", PrepareGetPhysicalDeviceFeatures, InvokeGetPhysicalDeviceFeatures},
+    {"vkGetPhysicalDeviceFeatures2", PrepareGetPhysicalDeviceFeatures2, InvokeGetPhysicalDeviceFeatures2},
+    {"vkGetPhysicalDeviceFeatures2KHR", PrepareGetPhysicalDeviceFeatures2KHR, InvokeGetPhysicalDeviceFeatures2KHR},
+    {"vkGetPhysicalDeviceFormatProperties", PrepareGetPhysicalDeviceFormatProperties, InvokeGetPhysicalDeviceFormatProperties},
+    {"vkGetPhysicalDeviceFormatProperties2", PrepareGetPhysicalDeviceFormatProperties2, InvokeGetPhysicalDeviceFormatProperties2},
+    {"vkGetPhysicalDeviceFormatProperties2KHR", PrepareGetPhysicalDeviceFormatProperties2KHR, InvokeGetPhysicalDeviceFormatProperties2KHR},
+    {"vkGetPhysicalDeviceFragmentShadingRatesKHR", PrepareGetPhysicalDeviceFragmentShadingRatesKHR, InvokeGetPhysicalDeviceFragmentShadingRatesKHR},
+    {"vkGetPhysicalDeviceImageFormatProperties", PrepareGetPhysicalDeviceImageFormatProperties, InvokeGetPhysicalDeviceImageFormatProperties},
+    {"vkGetPhysicalDeviceImageFormatProperties2", PrepareGetPhysicalDeviceImageFormatProperties2, InvokeGetPhysicalDeviceImageFormatProperties2},
+    {"vkGetPhysicalDeviceImageFormatProperties2KHR", PrepareGetPhysicalDeviceImageFormatProperties2KHR, InvokeGetPhysicalDeviceImageFormatProperties2KHR},
+    {"vkGetPhysicalDeviceMemoryProperties", PrepareGetPhysicalDeviceMemoryProperties, InvokeGetPhysicalDeviceMemoryProperties},
+    {"vkGetPhysicalDeviceMemoryProperties2", PrepareGetPhysicalDeviceMemoryProperties2, InvokeGetPhysicalDeviceMemoryProperties2},
+    {"vkGetPhysicalDeviceMemoryProperties2KHR", PrepareGetPhysicalDeviceMemoryProperties2KHR, InvokeGetPhysicalDeviceMemoryProperties2KHR},
+    {"vkGetPhysicalDeviceMultisamplePropertiesEXT", PrepareGetPhysicalDeviceMultisamplePropertiesEXT, InvokeGetPhysicalDeviceMultisamplePropertiesEXT},
+    {"vkGetPhysicalDevicePresentRectanglesKHR", PrepareGetPhysicalDevicePresentRectanglesKHR, InvokeGetPhysicalDevicePresentRectanglesKHR},
+    {"vkGetPhysicalDeviceProperties", PrepareGetPhysicalDeviceProperties, InvokeGetPhysicalDeviceProperties},
+    {"vkGetPhysicalDeviceProperties2", PrepareGetPhysicalDeviceProperties2, InvokeGetPhysicalDeviceProperties2},
+    {"vkGetPhysicalDeviceProperties2KHR", PrepareGetPhysicalDeviceProperties2KHR, InvokeGetPhysicalDeviceProperties2KHR},
+    {"vkGetPhysicalDeviceQueueFamilyProperties", PrepareGetPhysicalDeviceQueueFamilyProperties, InvokeGetPhysicalDeviceQueueFamilyProperties},
+    {"vkGetPhysicalDeviceQueueFamilyProperties2", PrepareGetPhysicalDeviceQueueFamilyProperties2, InvokeGetPhysicalDeviceQueueFamilyProperties2},
+    {"vkGetPhysicalDeviceQueueFamilyProperties2KHR", PrepareGetPhysicalDeviceQueueFamilyProperties2KHR, InvokeGetPhysicalDeviceQueueFamilyProperties2KHR},
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+    {"vkGetPhysicalDeviceScreenPresentationSupportQNX", PrepareGetPhysicalDeviceScreenPresentationSupportQNX, InvokeGetPhysicalDeviceScreenPresentationSupportQNX},
+#endif
+    {"vkGetPhysicalDeviceSparseImageFormatProperties", PrepareGetPhysicalDeviceSparseImageFormatProperties, InvokeGetPhysicalDeviceSparseImageFormatProperties},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties2", PrepareGetPhysicalDeviceSparseImageFormatProperties2, InvokeGetPhysicalDeviceSparseImageFormatProperties2},
+    {"vkGetPhysicalDeviceSparseImageFormatProperties2KHR", PrepareGetPhysicalDeviceSparseImageFormatProperties2KHR, InvokeGetPhysicalDeviceSparseImageFormatProperties2KHR},
+    {"vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV", PrepareGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV, InvokeGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV},
+    {"vkGetPhysicalDeviceSurfaceCapabilities2EXT", PrepareGetPhysicalDeviceSurfaceCapabilities2EXT, InvokeGetPhysicalDeviceSurfaceCapabilities2EXT},
+    {"vkGetPhysicalDeviceSurfaceCapabilities2KHR", PrepareGetPhysicalDeviceSurfaceCapabilities2KHR, InvokeGetPhysicalDeviceSurfaceCapabilities2KHR},
+    {"vkGetPhysicalDeviceSurfaceCapabilitiesKHR", PrepareGetPhysicalDeviceSurfaceCapabilitiesKHR, InvokeGetPhysicalDeviceSurfaceCapabilitiesKHR},
+    {"vkGetPhysicalDeviceSurfaceFormats2KHR", PrepareGetPhysicalDeviceSurfaceFormats2KHR, InvokeGetPhysicalDeviceSurfaceFormats2KHR},
+    {"vkGetPhysicalDeviceSurfaceFormatsKHR", PrepareGetPhysicalDeviceSurfaceFormatsKHR, InvokeGetPhysicalDeviceSurfaceFormatsKHR},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetPhysicalDeviceSurfacePresentModes2EXT", PrepareGetPhysicalDeviceSurfacePresentModes2EXT, InvokeGetPhysicalDeviceSurfacePresentModes2EXT},
+#endif
+    {"vkGetPhysicalDeviceSurfacePresentModesKHR", PrepareGetPhysicalDeviceSurfacePresentModesKHR, InvokeGetPhysicalDeviceSurfacePresentModesKHR},
+    {"vkGetPhysicalDeviceSurfaceSupportKHR", PrepareGetPhysicalDeviceSurfaceSupportKHR, InvokeGetPhysicalDeviceSurfaceSupportKHR},
+    {"vkGetPhysicalDeviceToolPropertiesEXT", PrepareGetPhysicalDeviceToolPropertiesEXT, InvokeGetPhysicalDeviceToolPropertiesEXT},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkGetPhysicalDeviceVideoCapabilitiesKHR", PrepareGetPhysicalDeviceVideoCapabilitiesKHR, InvokeGetPhysicalDeviceVideoCapabilitiesKHR},
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    {"vkGetPhysicalDeviceWaylandPresentationSupportKHR", PrepareGetPhysicalDeviceWaylandPresentationSupportKHR, InvokeGetPhysicalDeviceWaylandPresentationSupportKHR},
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetPhysicalDeviceWin32PresentationSupportKHR", PrepareGetPhysicalDeviceWin32PresentationSupportKHR, InvokeGetPhysicalDeviceWin32PresentationSupportKHR},
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    {"vkGetPhysicalDeviceXcbPresentationSupportKHR", PrepareGetPhysicalDeviceXcbPresentationSupportKHR, InvokeGetPhysicalDeviceXcbPresentationSupportKHR},
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    {"vkGetPhysicalDeviceXlibPresentationSupportKHR", PrepareGetPhysicalDeviceXlibPresentationSupportKHR, InvokeGetPhysicalDeviceXlibPresentationSupportKHR},
+#endif
+    {"vkGetPipelineCacheData", PrepareGetPipelineCacheData, InvokeGetPipelineCacheData},
+    {"vkGetPipelineExecutablePropertiesKHR", PrepareGetPipelineExecutablePropertiesKHR, InvokeGetPipelineExecutablePropertiesKHR},
+    {"vkGetPipelineExecutableStatisticsKHR", PrepareGetPipelineExecutableStatisticsKHR, InvokeGetPipelineExecutableStatisticsKHR},
+    {"vkGetPrivateDataEXT", PrepareGetPrivateDataEXT, InvokeGetPrivateDataEXT},
+    {"vkGetQueryPoolResults", PrepareGetQueryPoolResults, InvokeGetQueryPoolResults},
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {"vkGetRandROutputDisplayEXT", PrepareGetRandROutputDisplayEXT, InvokeGetRandROutputDisplayEXT},
+#endif
+    {"vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", PrepareGetRayTracingCaptureReplayShaderGroupHandlesKHR, InvokeGetRayTracingCaptureReplayShaderGroupHandlesKHR},
+    {"vkGetRayTracingShaderGroupHandlesKHR", PrepareGetRayTracingShaderGroupHandlesKHR, InvokeGetRayTracingShaderGroupHandlesKHR},
+    {"vkGetRayTracingShaderGroupHandlesNV", PrepareGetRayTracingShaderGroupHandlesNV, InvokeGetRayTracingShaderGroupHandlesNV},
+    {"vkGetRayTracingShaderGroupStackSizeKHR", PrepareGetRayTracingShaderGroupStackSizeKHR, InvokeGetRayTracingShaderGroupStackSizeKHR},
+    {"vkGetRefreshCycleDurationGOOGLE", PrepareGetRefreshCycleDurationGOOGLE, InvokeGetRefreshCycleDurationGOOGLE},
+    {"vkGetRenderAreaGranularity", PrepareGetRenderAreaGranularity, InvokeGetRenderAreaGranularity},
+    {"vkGetSemaphoreCounterValue", PrepareGetSemaphoreCounterValue, InvokeGetSemaphoreCounterValue},
+    {"vkGetSemaphoreCounterValueKHR", PrepareGetSemaphoreCounterValueKHR, InvokeGetSemaphoreCounterValueKHR},
+    {"vkGetSemaphoreFdKHR", PrepareGetSemaphoreFdKHR, InvokeGetSemaphoreFdKHR},
+    {"vkGetShaderInfoAMD", PrepareGetShaderInfoAMD, InvokeGetShaderInfoAMD},
+    {"vkGetSwapchainCounterEXT", PrepareGetSwapchainCounterEXT, InvokeGetSwapchainCounterEXT},
+    {"vkGetSwapchainImagesKHR", PrepareGetSwapchainImagesKHR, InvokeGetSwapchainImagesKHR},
+    {"vkGetSwapchainStatusKHR", PrepareGetSwapchainStatusKHR, InvokeGetSwapchainStatusKHR},
+    {"vkGetValidationCacheDataEXT", PrepareGetValidationCacheDataEXT, InvokeGetValidationCacheDataEXT},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetWinrtDisplayNV", PrepareGetWinrtDisplayNV, InvokeGetWinrtDisplayNV},
+#endif
+    {"vkInvalidateMappedMemoryRanges", PrepareInvalidateMappedMemoryRanges, InvokeInvalidateMappedMemoryRanges},
+    {"vkMapMemory", PrepareMapMemory, InvokeMapMemory},
+    {"vkMergePipelineCaches", PrepareMergePipelineCaches, InvokeMergePipelineCaches},
+    {"vkMergeValidationCachesEXT", PrepareMergeValidationCachesEXT, InvokeMergeValidationCachesEXT},
+    {"vkQueueBeginDebugUtilsLabelEXT", PrepareQueueBeginDebugUtilsLabelEXT, InvokeQueueBeginDebugUtilsLabelEXT},
+    {"vkQueueEndDebugUtilsLabelEXT", PrepareQueueEndDebugUtilsLabelEXT, InvokeQueueEndDebugUtilsLabelEXT},
+    {"vkQueueInsertDebugUtilsLabelEXT", PrepareQueueInsertDebugUtilsLabelEXT, InvokeQueueInsertDebugUtilsLabelEXT},
+    {"vkQueuePresentKHR", PrepareQueuePresentKHR, InvokeQueuePresentKHR},
+    {"vkQueueSetPerformanceConfigurationINTEL", PrepareQueueSetPerformanceConfigurationINTEL, InvokeQueueSetPerformanceConfigurationINTEL},
+    {"vkQueueSubmit", PrepareQueueSubmit, InvokeQueueSubmit},
+    {"vkQueueSubmit2KHR", PrepareQueueSubmit2KHR, InvokeQueueSubmit2KHR},
+    {"vkQueueWaitIdle", PrepareQueueWaitIdle, InvokeQueueWaitIdle},
+    {"vkRegisterDeviceEventEXT", PrepareRegisterDeviceEventEXT, InvokeRegisterDeviceEventEXT},
+    {"vkRegisterDisplayEventEXT", PrepareRegisterDisplayEventEXT, InvokeRegisterDisplayEventEXT},
+    {"vkReleaseDisplayEXT", PrepareReleaseDisplayEXT, InvokeReleaseDisplayEXT},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {"vkReleaseFullScreenExclusiveModeEXT", PrepareReleaseFullScreenExclusiveModeEXT, InvokeReleaseFullScreenExclusiveModeEXT},
+#endif
+    {"vkReleasePerformanceConfigurationINTEL", PrepareReleasePerformanceConfigurationINTEL, InvokeReleasePerformanceConfigurationINTEL},
+    {"vkReleaseProfilingLockKHR", PrepareReleaseProfilingLockKHR, InvokeReleaseProfilingLockKHR},
+    {"vkResetCommandBuffer", PrepareResetCommandBuffer, InvokeResetCommandBuffer},
+    {"vkResetCommandPool", PrepareResetCommandPool, InvokeResetCommandPool},
+    {"vkResetDescriptorPool", PrepareResetDescriptorPool, InvokeResetDescriptorPool},
+    {"vkResetEvent", PrepareResetEvent, InvokeResetEvent},
+    {"vkResetFences", PrepareResetFences, InvokeResetFences},
+    {"vkResetQueryPool", PrepareResetQueryPool, InvokeResetQueryPool},
+    {"vkResetQueryPoolEXT", PrepareResetQueryPoolEXT, InvokeResetQueryPoolEXT},
+    {"vkSetEvent", PrepareSetEvent, InvokeSetEvent},
+    {"vkSetHdrMetadataEXT", PrepareSetHdrMetadataEXT, InvokeSetHdrMetadataEXT},
+    {"vkSetLocalDimmingAMD", PrepareSetLocalDimmingAMD, InvokeSetLocalDimmingAMD},
+    {"vkSetPrivateDataEXT", PrepareSetPrivateDataEXT, InvokeSetPrivateDataEXT},
+    {"vkSignalSemaphore", PrepareSignalSemaphore, InvokeSignalSemaphore},
+    {"vkSignalSemaphoreKHR", PrepareSignalSemaphoreKHR, InvokeSignalSemaphoreKHR},
+    {"vkTrimCommandPool", PrepareTrimCommandPool, InvokeTrimCommandPool},
+    {"vkTrimCommandPoolKHR", PrepareTrimCommandPoolKHR, InvokeTrimCommandPoolKHR},
+    {"vkUninitializePerformanceApiINTEL", PrepareUninitializePerformanceApiINTEL, InvokeUninitializePerformanceApiINTEL},
+    {"vkUnmapMemory", PrepareUnmapMemory, InvokeUnmapMemory},
+    {"vkUpdateDescriptorSetWithTemplate", PrepareUpdateDescriptorSetWithTemplate, InvokeUpdateDescriptorSetWithTemplate},
+    {"vkUpdateDescriptorSetWithTemplateKHR", PrepareUpdateDescriptorSetWithTemplateKHR, InvokeUpdateDescriptorSetWithTemplateKHR},
+    {"vkUpdateDescriptorSets", PrepareUpdateDescriptorSets, InvokeUpdateDescriptorSets},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {"vkUpdateVideoSessionParametersKHR", PrepareUpdateVideoSessionParametersKHR, InvokeUpdateVideoSessionParametersKHR},
+#endif
+    {"vkWaitForFences", PrepareWaitForFences, InvokeWaitForFences},
+    {"vkWaitSemaphores", PrepareWaitSemaphores, InvokeWaitSemaphores},
+    {"vkWaitSemaphoresKHR", PrepareWaitSemaphoresKHR, InvokeWaitSemaphoresKHR},
+    {"vkWriteAccelerationStructuresPropertiesKHR", PrepareWriteAccelerationStructuresPropertiesKHR, InvokeWriteAccelerationStructuresPropertiesKHR},
+};
@@ -0,0 +1,611 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Replays a trace the mock ICD recorded with VKMOCK_TRACE against a driver, and reports how fast the driver made the calls.
+// Against the mock ICD, that's how much the driver itself costs each call, and against a real driver, how that compares.
+// Calls are made in the order they were recorded, from one thread, with the handles the driver returns in place of the
+// ones in the trace. pNext chains are dropped, so the driver sees each call without the extension structs the app chained
+// to it. Calls the trace doesn't have everything for are skipped and counted.
+//
+// Usage: vktracereplay [--driver PATH] [--frames FIRST[-LAST]] [--loop N] TRACE
+//
+//   --driver  The Vulkan loader, by default, or an ICD library such as the mock ICD's, which is then called directly
+//   --frames  Only time the frames in the range, counting from 0, where each frame ends with a vkQueuePresentKHR. Calls
+//             before the range are made once first, and calls after it once at the end.
+//   --loop    How many times to make the calls in the range, 1 by default
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#include <sys/resource.h>
+#endif
+
+#include "tracereplay.h"
+#include "tracereplay.hpp"
+
+#if defined(_WIN32)
+static const char *const kDefaultDriver = "vulkan-1.dll";
+#elif defined(__APPLE__)
+static const char *const kDefaultDriver = "libvulkan.1.dylib";
+#else
+static const char *const kDefaultDriver = "libvulkan.so.1";
+#endif
+
+// Loader interface version asked for when calling an ICD directly. The mock ICD fails vkCreateInstance below version 5.
+static const uint32_t kLoaderIcdInterfaceVersion = 5;
+
+static const char *const kSkipNames[] = {
+    "none",
+    "entry point vktracereplay can't call",
+    "arguments truncated in the trace",
+    "failed when traced",
+    "trace only has the address of data the call takes",
+    "bad record",
+    "handle the call takes wasn't created",
+    "driver doesn't have the entry point",
+};
+static_assert(sizeof(kSkipNames) / sizeof(kSkipNames[0]) == static_cast<size_t>(ReplaySkip::Count), "kSkipNames is out of date");
+
+// Instance extensions for window systems. Replay creates headless surfaces in their place.
+static const char *const kWindowSystemExtensions[] = {
+    "VK_EXT_directfb_surface", "VK_EXT_metal_surface",   "VK_FUCHSIA_imagepipe_surface", "VK_GGP_stream_descriptor_surface",
+    "VK_KHR_android_surface",  "VK_KHR_wayland_surface", "VK_KHR_win32_surface",         "VK_KHR_xcb_surface",
+    "VK_KHR_xlib_surface",     "VK_MVK_ios_surface",     "VK_MVK_macos_surface",         "VK_NN_vi_surface",
+    "VK_QNX_screen_surface",
+};
+
+static bool IsWindowSystemExtension(const char *name) {
+    for (const char *extension : kWindowSystemExtensions) {
+        if (strcmp(name, extension) == 0) return true;
+    }
+    return false;
+}
+
+// Replays vkCreateInstance with VK_EXT_headless_surface in place of the window system extensions the app enabled
+static bool PrepareCreateInstanceHeadless(ReplayPrep &prep) {
+    if (!PrepareCreateInstance(prep)) return false;
+    const CreateInstanceArgs &args = *static_cast<const CreateInstanceArgs *>(prep.args());
+    if (!args.pCreateInfo || !args.pCreateInfo->ppEnabledExtensionNames) return true;
+    VkInstanceCreateInfo &create_info = const_cast<VkInstanceCreateInfo &>(*args.pCreateInfo);
+    const char **extensions = prep.arena().New<const char *>(create_info.enabledExtensionCount + 1);
+    uint32_t count = 0;
+    bool headless = false;
+    bool window_system = false;
+    for (uint32_t i = 0; i < create_info.enabledExtensionCount; ++i) {
+        const char *extension = create_info.ppEnabledExtensionNames[i];
+        if (IsWindowSystemExtension(extension)) {
+            window_system = true;
+            continue;
+        }
+        headless |= strcmp(extension, VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME) == 0;
+        extensions[count++] = extension;
+    }
+    if (window_system && !headless) extensions[count++] = VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME;
+    create_info.enabledExtensionCount = count;
+    create_info.ppEnabledExtensionNames = extensions;
+    return true;
+}
+
+// Replays the vkCreate*Surface* of any window system as vkCreateHeadlessSurfaceEXT
+static bool PrepareHeadlessSurface(ReplayPrep &prep) {
+    CreateHeadlessSurfaceEXTArgs &args = prep.NewArgs<CreateHeadlessSurfaceEXTArgs>();
+    VkHeadlessSurfaceCreateInfoEXT *create_info = prep.arena().New<VkHeadlessSurfaceCreateInfoEXT>();
+    create_info->sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+    args.pCreateInfo = create_info;
+    return prep.Handle(args.instance) &&
+           prep.Skip() &&
+           prep.Allocator(args.pAllocator) &&
+           prep.NewHandles(args.pSurface) &&
+           prep.Result();
+}
+
+// Entry points replayed differently from how tracereplay.hpp makes the calls
+static const ReplayEntryPoint kReplayOverrides[] = {
+    {"vkCreateAndroidSurfaceKHR", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateDirectFBSurfaceEXT", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateIOSSurfaceMVK", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateImagePipeSurfaceFUCHSIA", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateInstance", PrepareCreateInstanceHeadless, InvokeCreateInstance},
+    {"vkCreateMacOSSurfaceMVK", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateMetalSurfaceEXT", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateScreenSurfaceQNX", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateStreamDescriptorSurfaceGGP", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateViSurfaceNN", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateWaylandSurfaceKHR", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateWin32SurfaceKHR", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateXcbSurfaceKHR", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+    {"vkCreateXlibSurfaceKHR", PrepareHeadlessSurface, InvokeCreateHeadlessSurfaceEXT, "vkCreateHeadlessSurfaceEXT"},
+};
+
+static const ReplayEntryPoint *FindEntryPoint(const char *name) {
+    for (const ReplayEntryPoint &entry_point : kReplayOverrides) {
+        if (strcmp(entry_point.name, name) == 0) return &entry_point;
+    }
+    const ReplayEntryPoint *end = kReplayEntryPoints + sizeof(kReplayEntryPoints) / sizeof(kReplayEntryPoints[0]);
+    const ReplayEntryPoint *found = std::lower_bound(
+        kReplayEntryPoints, end, name, [](const ReplayEntryPoint &entry, const char *key) { return strcmp(entry.name, key) < 0; });
+    return found != end && strcmp(found->name, name) == 0 ? found : nullptr;
+}
+
+// Entry points called without an instance
+static bool IsGlobalCommand(const char *name) {
+    return strcmp(name, "vkCreateInstance") == 0 || strcmp(name, "vkEnumerateInstanceExtensionProperties") == 0 ||
+           strcmp(name, "vkEnumerateInstanceLayerProperties") == 0 || strcmp(name, "vkEnumerateInstanceVersion") == 0;
+}
+
+static PFN_vkGetInstanceProcAddr LoadDriver(const char *path) {
+#if defined(_WIN32)
+    HMODULE library = LoadLibraryA(path);
+    if (!library) return nullptr;
+    auto load = [library](const char *name) { return reinterpret_cast<void *>(GetProcAddress(library, name)); };
+#else
+    void *library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!library) return nullptr;
+    auto load = [library](const char *name) { return dlsym(library, name); };
+#endif
+    // An ICD is called the way the loader would call it
+    auto get_instance_proc_addr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(load("vk_icdGetInstanceProcAddr"));
+    if (!get_instance_proc_addr) return reinterpret_cast<PFN_vkGetInstanceProcAddr>(load("vkGetInstanceProcAddr"));
+    typedef VkResult(VKAPI_PTR * PFN_NegotiateLoaderICDInterfaceVersion)(uint32_t * pVersion);
+    auto negotiate = reinterpret_cast<PFN_NegotiateLoaderICDInterfaceVersion>(load("vk_icdNegotiateLoaderICDInterfaceVersion"));
+    uint32_t version = kLoaderIcdInterfaceVersion;
+    if (negotiate && negotiate(&version) != VK_SUCCESS) return nullptr;
+    return get_instance_proc_addr;
+}
+
+// A call as the trace recorded it
+struct TraceCall {
+    uint64_t timestamp;
+    uint64_t sequence;  // Of the chunk it's in
+    uint32_t offset;    // In the chunk
+    uint16_t entry_point;
+    uint16_t flags;
+    const uint8_t *args;
+    const uint8_t *end;
+};
+
+struct Trace {
+    std::vector<uint8_t> file;
+    std::vector<std::string> entry_points;
+    std::vector<TraceCall> calls;
+    uint64_t chunks_taken = 0;
+    uint32_t chunk_count = 0;
+    uint64_t dropped_records = 0;
+};
+
+// The file's structs hold atomics, so fields are copied out of it rather than read through casts
+template <typename T>
+static T Load(const std::vector<uint8_t> &file, uint64_t offset) {
+    T value;
+    memcpy(&value, file.data() + offset, sizeof(T));
+    return value;
+}
+
+static bool ReadFile(const char *path, std::vector<uint8_t> &contents) {
+    FILE *file = fopen(path, "rb");
+    if (!file) return false;
+    bool read = fseek(file, 0, SEEK_END) == 0;
+    const long size = read ? ftell(file) : -1;
+    read = size >= 0 && fseek(file, 0, SEEK_SET) == 0;
+    if (read) {
+        contents.resize(static_cast<size_t>(size));
+        read = fread(contents.data(), 1, contents.size(), file) == contents.size();
+    }
+    fclose(file);
+    return read;
+}
+
+static bool LoadTrace(const char *path, Trace &trace) {
+    typedef vkmock::TraceFileHeader FileHeader;
+    typedef vkmock::TraceChunkHeader ChunkHeader;
+    if (!ReadFile(path, trace.file)) {
+        fprintf(stderr, "Can't read %s\n", path);
+        return false;
+    }
+    const std::vector<uint8_t> &file = trace.file;
+    if (file.size() < sizeof(FileHeader) || Load<uint64_t>(file, offsetof(FileHeader, magic)) != vkmock::kTraceMagic) {
+        fprintf(stderr, "%s isn't a mock ICD trace\n", path);
+        return false;
+    }
+    const uint32_t version = Load<uint32_t>(file, offsetof(FileHeader, version));
+    if (version != vkmock::kTraceVersion) {
+        fprintf(stderr, "%s is a version %u trace, but vktracereplay reads version %u\n", path, version, vkmock::kTraceVersion);
+        return false;
+    }
+    const uint32_t chunk_size = Load<uint32_t>(file, offsetof(FileHeader, chunk_size));
+    const uint64_t chunks_offset = Load<uint64_t>(file, offsetof(FileHeader, chunks_offset));
+    const uint64_t entry_points_offset = Load<uint64_t>(file, offsetof(FileHeader, entry_points_offset));
+    const uint32_t entry_point_count = Load<uint32_t>(file, offsetof(FileHeader, entry_point_count));
+    trace.chunk_count = Load<uint32_t>(file, offsetof(FileHeader, chunk_count));
+    trace.chunks_taken = Load<uint64_t>(file, offsetof(FileHeader, next_chunk));
+    trace.dropped_records = Load<uint64_t>(file, offsetof(FileHeader, dropped_records));
+    if (chunk_size <= sizeof(ChunkHeader) || chunks_offset > file.size() ||
+        (file.size() - chunks_offset) / chunk_size < trace.chunk_count || entry_points_offset > chunks_offset) {
+        fprintf(stderr, "%s is truncated or corrupt\n", path);
+        return false;
+    }
+
+    const char *name = reinterpret_cast<const char *>(file.data() + entry_points_offset);
+    const char *names_end = reinterpret_cast<const char *>(file.data() + chunks_offset);
+    for (uint32_t i = 0; i < entry_point_count; ++i) {
+        const char *end = std::find(name, names_end, '\0');
+        if (end == names_end) {
+            fprintf(stderr, "%s is truncated or corrupt\n", path);
+            return false;
+        }
+        trace.entry_points.emplace_back(name, end);
+        name = end + 1;
+    }
+
+    // A chunk can take a run of slots, so the slots after its first hold records, and a chunk is only whole if no chunk
+    // taken after it took any of its slots
+    struct Chunk {
+        uint32_t slot;
+        uint32_t slots;
+        uint64_t sequence;
+    };
+    std::vector<Chunk> chunks;
+    std::vector<uint64_t> newest(trace.chunk_count, 0);
+    for (uint32_t slot = 0; slot < trace.chunk_count; ++slot) {
+        const uint64_t start = chunks_offset + static_cast<uint64_t>(slot) * chunk_size;
+        const Chunk chunk = {slot, Load<uint32_t>(file, start + offsetof(ChunkHeader, slots)),
+                             Load<uint64_t>(file, start + offsetof(ChunkHeader, sequence))};
+        if (!Load<uint32_t>(file, start + offsetof(ChunkHeader, used)) || !chunk.slots ||
+            chunk.slots > trace.chunk_count - slot || chunk.sequence % trace.chunk_count != slot ||
+            chunk.sequence >= trace.chunks_taken) {
+            continue;
+        }
+        chunks.push_back(chunk);
+        for (uint32_t i = 0; i < chunk.slots; ++i) newest[slot + i] = std::max(newest[slot + i], chunk.sequence + 1);
+    }
+    for (const Chunk &chunk : chunks) {
+        bool whole = true;
+        for (uint32_t i = 0; i < chunk.slots; ++i) whole = whole && newest[chunk.slot + i] == chunk.sequence + 1;
+        if (!whole) continue;
+        const uint64_t start = chunks_offset + static_cast<uint64_t>(chunk.slot) * chunk_size;
+        const uint64_t capacity = static_cast<uint64_t>(chunk.slots) * chunk_size - sizeof(ChunkHeader);
+        const uint32_t used =
+            static_cast<uint32_t>(std::min<uint64_t>(Load<uint32_t>(file, start + offsetof(ChunkHeader, used)), capacity));
+        const uint64_t sequence = chunk.sequence;
+        const uint64_t data = start + sizeof(ChunkHeader);
+        for (uint32_t offset = 0; used - offset >= sizeof(vkmock::TraceRecordHeader);) {
+            const vkmock::TraceRecordHeader record = Load<vkmock::TraceRecordHeader>(file, data + offset);
+            if (record.size < sizeof(record) || record.size > used - offset) break;
+            if (record.entry_point < entry_point_count) {
+                const uint8_t *args = file.data() + data + offset + sizeof(record);
+                trace.calls.push_back(
+                    {record.timestamp_ns, sequence, offset, record.entry_point, record.flags, args, args + record.size - sizeof(record)});
+            }
+            offset += record.size;
+        }
+    }
+    std::sort(trace.calls.begin(), trace.calls.end(), [](const TraceCall &a, const TraceCall &b) {
+        if (a.timestamp != b.timestamp) return a.timestamp < b.timestamp;
+        if (a.sequence != b.sequence) return a.sequence < b.sequence;
+        return a.offset < b.offset;
+    });
+    return true;
+}
+
+// A call prepared to be made again
+struct ReplayCall {
+    uint16_t entry_point;  // Trace entry point id
+    ReplaySkip skip;
+    void *args;
+    uint32_t first_patch;
+    uint32_t patch_count;
+};
+
+// Everything about one of the trace's entry points while replaying
+struct ReplayEntryPointState {
+    const ReplayEntryPoint *entry_point = nullptr;
+    const char *name = nullptr;  // What to ask the driver for
+    bool global = false;
+    PFN_vkVoidFunction proc = nullptr;
+    uint64_t proc_generation = 0;  // Of the instance proc was looked up with
+    LatencyHistogram latency;
+};
+
+class Replayer {
+  public:
+    Replayer(PFN_vkGetInstanceProcAddr get_instance_proc_addr, const Trace &trace)
+        : get_instance_proc_addr_(get_instance_proc_addr), prep_(arena_, handles_), entry_points_(trace.entry_points.size()) {
+        for (size_t i = 0; i < trace.entry_points.size(); ++i) {
+            ReplayEntryPointState &state = entry_points_[i];
+            state.entry_point = FindEntryPoint(trace.entry_points[i].c_str());
+            if (!state.entry_point) continue;
+            state.name = state.entry_point->proc_name ? state.entry_point->proc_name : state.entry_point->name;
+            state.global = IsGlobalCommand(state.name);
+        }
+        calls_.reserve(trace.calls.size());
+        for (const TraceCall &call : trace.calls) Prepare(call);
+    }
+
+    size_t call_count() const { return calls_.size(); }
+    const std::vector<ReplayEntryPointState> &entry_points() const { return entry_points_; }
+    const std::array<uint64_t, static_cast<size_t>(ReplaySkip::Count)> &skipped() const { return skipped_; }
+
+    void Execute(size_t index, bool timed) {
+        const ReplayCall &call = calls_[index];
+        if (call.skip != ReplaySkip::None) {
+            ++skipped_[static_cast<size_t>(call.skip)];
+            return;
+        }
+        const ReplayPatch *patches = patches_.data() + call.first_patch;
+        for (uint32_t i = 0; i < call.patch_count; ++i) {
+            if (patches[i].output) continue;
+            const uint64_t handle = handles_[patches[i].handle];
+            if (!handle) {
+                ++skipped_[static_cast<size_t>(ReplaySkip::MissingHandle)];
+                return;
+            }
+            StoreHandle(patches[i], handle);
+        }
+
+        ReplayEntryPointState &state = entry_points_[call.entry_point];
+        const uint64_t generation = state.global ? 0 : instance_generation_;
+        if (state.proc_generation != generation || !state.proc) {
+            state.proc = get_instance_proc_addr_(state.global ? VK_NULL_HANDLE : instance_, state.name);
+            state.proc_generation = generation;
+        }
+        if (!state.proc) {
+            ++skipped_[static_cast<size_t>(ReplaySkip::MissingProc)];
+            return;
+        }
+
+        VkResult result;
+        if (timed) {
+            const auto start = std::chrono::steady_clock::now();
+            result = state.entry_point->invoke(state.proc, call.args);
+            const auto end = std::chrono::steady_clock::now();
+            state.latency.Add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+        } else {
+            result = state.entry_point->invoke(state.proc, call.args);
+        }
+        if (result < 0) return;
+
+        for (uint32_t i = 0; i < call.patch_count; ++i) {
+            if (patches[i].output) handles_[patches[i].handle] = LoadHandle(patches[i]);
+        }
+        if (state.entry_point->invoke == InvokeCreateInstance) {
+            instance_ = *static_cast<const CreateInstanceArgs *>(call.args)->pInstance;
+            ++instance_generation_;
+        } else if (state.entry_point->invoke == InvokeDestroyInstance &&
+                   static_cast<const DestroyInstanceArgs *>(call.args)->instance == instance_) {
+            instance_ = VK_NULL_HANDLE;
+            ++instance_generation_;
+        }
+    }
+
+  private:
+    void Prepare(const TraceCall &traced) {
+        ReplayCall call = {traced.entry_point, ReplaySkip::None, nullptr, static_cast<uint32_t>(patches_.size()), 0};
+        const ReplayEntryPoint *entry_point = entry_points_[traced.entry_point].entry_point;
+        if (!entry_point) {
+            call.skip = ReplaySkip::UnknownEntryPoint;
+        } else if (traced.flags & vkmock::kTraceRecordTruncated) {
+            call.skip = ReplaySkip::Truncated;
+        } else {
+            prep_.Begin(traced.args, traced.end);
+            if (entry_point->prepare(prep_)) {
+                prep_.Commit();
+                call.args = prep_.args();
+                call.patch_count = static_cast<uint32_t>(prep_.patches().size());
+                patches_.insert(patches_.end(), prep_.patches().begin(), prep_.patches().end());
+            } else {
+                call.skip = prep_.skip();
+            }
+        }
+        calls_.push_back(call);
+    }
+
+    static void StoreHandle(const ReplayPatch &patch, uint64_t handle) {
+        if (patch.size == sizeof(uint64_t)) {
+            memcpy(patch.location, &handle, sizeof(handle));
+        } else {
+            const uint32_t narrow = static_cast<uint32_t>(handle);
+            memcpy(patch.location, &narrow, sizeof(narrow));
+        }
+    }
+
+    static uint64_t LoadHandle(const ReplayPatch &patch) {
+        if (patch.size == sizeof(uint64_t)) {
+            uint64_t handle;
+            memcpy(&handle, patch.location, sizeof(handle));
+            return handle;
+        }
+        uint32_t narrow;
+        memcpy(&narrow, patch.location, sizeof(narrow));
+        return narrow;
+    }
+
+    PFN_vkGetInstanceProcAddr get_instance_proc_addr_;
+    ReplayArena arena_;
+    ReplayHandles handles_;
+    ReplayPrep prep_;
+    std::vector<ReplayCall> calls_;
+    std::vector<ReplayPatch> patches_;
+    std::vector<ReplayEntryPointState> entry_points_;
+    std::array<uint64_t, static_cast<size_t>(ReplaySkip::Count)> skipped_ = {};
+    VkInstance instance_ = VK_NULL_HANDLE;
+    uint64_t instance_generation_ = 1;
+};
+
+// User and system CPU time the process has taken, in nanoseconds
+static void GetCpuTime(uint64_t *user_ns, uint64_t *system_ns) {
+#if defined(_WIN32)
+    FILETIME creation, exit, kernel, user;
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+    *user_ns = ((static_cast<uint64_t>(user.dwHighDateTime) << 32) | user.dwLowDateTime) * 100;
+    *system_ns = ((static_cast<uint64_t>(kernel.dwHighDateTime) << 32) | kernel.dwLowDateTime) * 100;
+#else
+    struct rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    *user_ns = static_cast<uint64_t>(usage.ru_utime.tv_sec) * 1000000000 + static_cast<uint64_t>(usage.ru_utime.tv_usec) * 1000;
+    *system_ns = static_cast<uint64_t>(usage.ru_stime.tv_sec) * 1000000000 + static_cast<uint64_t>(usage.ru_stime.tv_usec) * 1000;
+#endif
+}
+
+static void PrintReport(const Replayer &replayer, double wall_ns, uint64_t user_ns, uint64_t system_ns) {
+    std::vector<const ReplayEntryPointState *> timed;
+    uint64_t calls = 0;
+    uint64_t driver_ns = 0;
+    for (const ReplayEntryPointState &state : replayer.entry_points()) {
+        if (!state.latency.count()) continue;
+        timed.push_back(&state);
+        calls += state.latency.count();
+        driver_ns += state.latency.total();
+    }
+    std::sort(timed.begin(), timed.end(), [](const ReplayEntryPointState *a, const ReplayEntryPointState *b) {
+        return a->latency.total() > b->latency.total();
+    });
+
+    printf("Calls:       %llu\n", static_cast<unsigned long long>(calls));
+    printf("Wall time:   %.3f ms, %.0f calls/s\n", wall_ns / 1e6, wall_ns > 0 ? calls / (wall_ns / 1e9) : 0.0);
+    printf("Driver time: %.3f ms\n", driver_ns / 1e6);
+    printf("CPU time:    %.3f ms (user %.3f ms, system %.3f ms)\n", (user_ns + system_ns) / 1e6, user_ns / 1e6, system_ns / 1e6);
+
+    bool skipped = false;
+    for (size_t reason = 1; reason < replayer.skipped().size(); ++reason) {
+        if (!replayer.skipped()[reason]) continue;
+        if (!skipped) printf("\nSkipped calls:\n");
+        skipped = true;
+        printf("  %10llu  %s\n", static_cast<unsigned long long>(replayer.skipped()[reason]), kSkipNames[reason]);
+    }
+
+    printf("\n%-48s %10s %12s %10s %10s %10s %10s\n", "Entry point", "Calls", "Total ms", "Mean ns", "p50 ns", "p99 ns", "Max ns");
+    for (const ReplayEntryPointState *state : timed) {
+        const LatencyHistogram &latency = state->latency;
+        printf("%-48s %10llu %12.3f %10.0f %10llu %10llu %10llu\n", state->entry_point->name,
+               static_cast<unsigned long long>(latency.count()), latency.total() / 1e6,
+               static_cast<double>(latency.total()) / latency.count(), static_cast<unsigned long long>(latency.Percentile(0.5)),
+               static_cast<unsigned long long>(latency.Percentile(0.99)), static_cast<unsigned long long>(latency.max()));
+    }
+
+    // Each power of two of latency, with a bar as long as its share of the entry point's calls
+    printf("\nLatency histograms:\n");
+    for (const ReplayEntryPointState *state : timed) {
+        const LatencyHistogram &latency = state->latency;
+        printf("%s\n", state->entry_point->name);
+        for (uint32_t octave = 0; octave < 64; ++octave) {
+            const uint64_t count = latency.octave(octave);
+            if (!count) continue;
+            const int bar = static_cast<int>(count * 50 / latency.count());
+            printf("  %12llu ns %10llu %.*s\n", octave ? 1ull << octave : 0ull, static_cast<unsigned long long>(count), bar,
+                   "##################################################");
+        }
+    }
+}
+
+static void Usage(const char *program) {
+    fprintf(stderr, "Usage: %s [--driver PATH] [--frames FIRST[-LAST]] [--loop N] TRACE\n", program);
+}
+
+int main(int argc, char **argv) {
+    const char *driver = kDefaultDriver;
+    const char *path = nullptr;
+    uint64_t first_frame = 0;
+    uint64_t last_frame = UINT64_MAX;
+    bool frames = false;
+    uint64_t loops = 1;
+    for (int i = 1; i < argc; ++i) {
+        char *end = nullptr;
+        if (strcmp(argv[i], "--driver") == 0 && i + 1 < argc) {
+            driver = argv[++i];
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            first_frame = strtoull(argv[++i], &end, 10);
+            last_frame = *end == '-' ? strtoull(end + 1, &end, 10) : first_frame;
+            if (*end || last_frame < first_frame) {
+                Usage(argv[0]);
+                return 1;
+            }
+            frames = true;
+        } else if (strcmp(argv[i], "--loop") == 0 && i + 1 < argc) {
+            loops = strtoull(argv[++i], &end, 10);
+            if (*end || loops == 0) {
+                Usage(argv[0]);
+                return 1;
+            }
+        } else if (argv[i][0] != '-' && !path) {
+            path = argv[i];
+        } else {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+    if (!path) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    Trace trace;
+    if (!LoadTrace(path, trace)) return 1;
+    if (trace.chunks_taken > trace.chunk_count) {
+        printf("The trace wrapped around, so it's missing the oldest calls.\n");
+    }
+    if (trace.dropped_records) {
+        printf("%llu calls were dropped while tracing.\n", static_cast<unsigned long long>(trace.dropped_records));
+    }
+
+    // Frames end after each present
+    size_t begin = 0;
+    size_t end = trace.calls.size();
+    if (frames) {
+        uint64_t frame = 0;
+        begin = SIZE_MAX;
+        for (size_t i = 0; i < trace.calls.size() && frame <= last_frame; ++i) {
+            if (frame == first_frame && begin == SIZE_MAX) begin = i;
+            if (trace.entry_points[trace.calls[i].entry_point] == "vkQueuePresentKHR" && frame++ == last_frame) end = i + 1;
+        }
+        if (begin == SIZE_MAX) {
+            fprintf(stderr, "The trace only has %llu frames\n", static_cast<unsigned long long>(frame));
+            return 1;
+        }
+    }
+
+    PFN_vkGetInstanceProcAddr get_instance_proc_addr = LoadDriver(driver);
+    if (!get_instance_proc_addr) {
+        fprintf(stderr, "Can't load %s\n", driver);
+        return 1;
+    }
+    Replayer replayer(get_instance_proc_addr, trace);
+
+    for (size_t i = 0; i < begin; ++i) replayer.Execute(i, false);
+    uint64_t user_start, system_start, user_end, system_end;
+    GetCpuTime(&user_start, &system_start);
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t loop = 0; loop < loops; ++loop) {
+        for (size_t i = begin; i < end; ++i) replayer.Execute(i, true);
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    GetCpuTime(&user_end, &system_end);
+    for (size_t i = end; i < replayer.call_count(); ++i) replayer.Execute(i, false);
+
+    PrintReport(replayer, elapsed.count(), user_end - user_start, system_end - system_start);
+    return 0;
+}
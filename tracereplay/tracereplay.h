@@ -0,0 +1,498 @@
+/*
+ * Copyright (c) 2021 The Khronos Group Inc.
+ * Copyright (c) 2021 Valve Corporation
+ * Copyright (c) 2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+#include "mock_icd_trace.h"
+
+// vktracereplay makes the calls a trace the mock ICD recorded (see mock_icd_trace.h) again, against any driver. Each record
+// is prepared once, into a struct of the call's arguments with everything they point to, so making the call again only
+// takes filling in the handles it uses. tracereplay.hpp is generated with a struct and the functions that prepare and make
+// the call for each entry point.
+
+// Why a call in the trace wasn't replayed
+enum class ReplaySkip : uint32_t {
+    None,
+    UnknownEntryPoint,  // vktracereplay can't make calls to the entry point
+    Truncated,          // The record's arguments didn't fit in the trace's ring, or no run of slots for them was free
+    FailedWhenTraced,   // The call failed when it was recorded
+    MissingData,        // The trace only has the address of data the call takes
+    BadRecord,          // The arguments aren't what the entry point takes
+    MissingHandle,      // A handle the call takes wasn't created during replay
+    MissingProc,        // The driver doesn't have the entry point
+    Count,
+};
+
+// Memory for the arguments of prepared calls and what they point to. Allocations are zeroed and 16 byte aligned, and stay
+// where they are until the arena is destroyed, so calls can be made again and again.
+class ReplayArena {
+  public:
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    void *Allocate(size_t size) {
+        size = (size + 15) & ~static_cast<size_t>(15);
+        if (size > kBlockSize) return NewBlock(size);
+        if (!block_ || used_ + size > kBlockSize) {
+            block_ = NewBlock(kBlockSize);
+            used_ = 0;
+        }
+        void *memory = block_ + used_;
+        used_ += size;
+        return memory;
+    }
+
+    template <typename T>
+    T *New(size_t count = 1) {
+        return static_cast<T *>(Allocate(sizeof(T) * count));
+    }
+
+  private:
+    uint8_t *NewBlock(size_t size) {
+        blocks_.emplace_back(new std::max_align_t[(size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)]());
+        return reinterpret_cast<uint8_t *>(blocks_.back().get());
+    }
+
+    std::vector<std::unique_ptr<std::max_align_t[]>> blocks_;
+    uint8_t *block_ = nullptr;
+    size_t used_ = 0;
+};
+
+// Gives each handle in the trace a dense id, which indexes the table of handles replay created in their place. A handle
+// the trace saw again after it was destroyed gets a new id when it's created again. Id 0 is VK_NULL_HANDLE.
+class ReplayHandles {
+  public:
+    ReplayHandles() : values_(1, 0) {}
+
+    // The id of the latest object the trace had the handle for
+    uint32_t Find(uint64_t traced) {
+        if (!traced) return 0;
+        auto id = ids_.find(traced);
+        if (id != ids_.end()) return id->second;
+        return ids_[traced] = Add();
+    }
+
+    uint32_t Add() {
+        values_.push_back(0);
+        return static_cast<uint32_t>(values_.size() - 1);
+    }
+
+    // Makes the handle the trace has stand for the object with the given id from now on
+    void Bind(uint64_t traced, uint32_t id) { ids_[traced] = id; }
+
+    uint64_t &operator[](uint32_t id) { return values_[id]; }
+
+  private:
+    std::unordered_map<uint64_t, uint32_t> ids_;
+    std::vector<uint64_t> values_;
+};
+
+// Where a prepared call's arguments hold a handle. Inputs are written from the table of handles before the call, and
+// outputs read back into it after it succeeds.
+struct ReplayPatch {
+    void *location;
+    uint32_t handle;
+    uint8_t size;
+    bool output;
+};
+
+class ReplayPrep;
+
+// Reads back the arguments TraceMembers recorded for a struct. Specialized in tracereplay.hpp.
+template <typename T>
+struct ReplayMembers {
+    static constexpr uint32_t kCount = 0;
+    static bool Prepare(ReplayPrep &, T &) { return true; }
+};
+
+// Prepares a call from a record's arguments. Each method reads the next argument into the call's argument struct, and
+// returns false if the call can't be replayed, leaving why in skip().
+class ReplayPrep {
+  public:
+    ReplayPrep(ReplayArena &arena, ReplayHandles &handles) : arena_(arena), handles_(handles) {}
+
+    void Begin(const uint8_t *data, const uint8_t *end) {
+        data_ = data;
+        end_ = end;
+        args_ = nullptr;
+        skip_ = ReplaySkip::None;
+        patches_.clear();
+        new_handles_.clear();
+    }
+
+    // Once every argument is prepared, makes the handles the call creates stand in for the ones it created when traced
+    void Commit() {
+        for (const auto &handle : new_handles_) handles_.Bind(handle.first, handle.second);
+    }
+
+    ReplayArena &arena() { return arena_; }
+    void *args() const { return args_; }
+    ReplaySkip skip() const { return skip_; }
+    const std::vector<ReplayPatch> &patches() const { return patches_; }
+
+    template <typename T>
+    T &NewArgs() {
+        T *args = arena_.New<T>();
+        args_ = args;
+        return *args;
+    }
+
+    template <typename T>
+    bool Value(T &value) {
+        uint32_t size = 0;
+        if (!Kind(vkmock::TraceArg::Value) || !Read(&size) || size != sizeof(T)) return Bad();
+        return Read(&value) || Bad();
+    }
+
+    template <typename T>
+    bool Handle(T &handle) {
+        uint64_t traced = 0;
+        if (!Kind(vkmock::TraceArg::Handle) || !Read(&traced)) return Bad();
+        handle = T();
+        if (traced) patches_.push_back({&handle, handles_.Find(traced), sizeof(T), false});
+        return true;
+    }
+
+    template <typename T>
+    bool Handles(T *&handles) {
+        typedef typename std::remove_const<T>::type Handle;
+        uint32_t count = 0;
+        if (!Kind(vkmock::TraceArg::HandleArray) || !Read(&count)) return Bad();
+        handles = nullptr;
+        if (count == vkmock::kTraceNull) return true;
+        Handle *copy = arena_.New<Handle>(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            uint64_t traced = 0;
+            if (!Read(&traced)) return Bad();
+            if (traced) patches_.push_back({&copy[i], handles_.Find(traced), sizeof(Handle), false});
+        }
+        handles = copy;
+        return true;
+    }
+
+    // Handles the call creates
+    template <typename T>
+    bool NewHandles(T *&handles) {
+        uint32_t count = 0;
+        if (!Kind(vkmock::TraceArg::HandleArray) || !Read(&count)) return Bad();
+        handles = nullptr;
+        if (count == vkmock::kTraceNull) return true;
+        T *copy = arena_.New<T>(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            uint64_t traced = 0;
+            if (!Read(&traced)) return Bad();
+            if (!traced) continue;
+            const uint32_t id = handles_.Add();
+            new_handles_.emplace_back(traced, id);
+            patches_.push_back({&copy[i], id, sizeof(T), true});
+        }
+        handles = copy;
+        return true;
+    }
+
+    // Arrays of values and structs, with what the structs TRACE_FOLLOWED_STRUCTS lists hold, and the call's outputs. Outputs
+    // start out as the traced call left them, which gives counts the size of the arrays they count.
+    template <typename T>
+    bool Array(T *&elements) {
+        typedef typename std::remove_const<T>::type Element;
+        const bool structs = vkmock::TraceHasPNext<Element>::value || ReplayMembers<Element>::kCount > 0;
+        uint32_t count = 0;
+        uint32_t size = 0;
+        if (!Kind(structs ? vkmock::TraceArg::StructArray : vkmock::TraceArg::Array) || !Read(&count) || !Read(&size)) {
+            return Bad();
+        }
+        elements = nullptr;
+        if (count == vkmock::kTraceNull) return true;
+        if (size != sizeof(Element) || !Available(static_cast<uint64_t>(count) * size)) return Bad();
+        Element *copy = arena_.New<Element>(count);
+        memcpy(static_cast<void *>(copy), data_, static_cast<size_t>(count) * size);
+        data_ += static_cast<size_t>(count) * size;
+        elements = copy;
+        for (uint32_t i = 0; structs && i < count; ++i) {
+            uint32_t members = 0;
+            if (!SkipChain() || !Read(&members) || members != ReplayMembers<Element>::kCount) return Bad();
+            if (!Members(copy[i])) return false;
+        }
+        return true;
+    }
+
+    // A struct held by value in another. pNext chains aren't replayed.
+    template <typename T>
+    bool Members(T &s) {
+        ClearNext(s, vkmock::TraceHasPNext<T>());
+        return ReplayMembers<T>::Prepare(*this, s);
+    }
+
+    bool String(const char *&string) { return (Kind(vkmock::TraceArg::String) && ReadString(string)) || Bad(); }
+
+    bool Strings(const char *const *&strings) {
+        uint32_t count = 0;
+        if (!Kind(vkmock::TraceArg::StringArray) || !Read(&count)) return Bad();
+        strings = nullptr;
+        if (count == vkmock::kTraceNull) return true;
+        const char **copy = arena_.New<const char *>(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!ReadString(copy[i])) return Bad();
+        }
+        strings = copy;
+        return true;
+    }
+
+    template <typename T>
+    bool Bytes(T *&data) {
+        uint32_t size = 0;
+        if (!Kind(vkmock::TraceArg::Bytes) || !Read(&size)) return Bad();
+        data = nullptr;
+        if (size == vkmock::kTraceNull) return true;
+        if (!Available(size)) return Bad();
+        void *copy = arena_.Allocate(size);
+        memcpy(copy, data_, size);
+        data_ += size;
+        data = static_cast<T *>(copy);
+        return true;
+    }
+
+    // Pointers the trace only has the address of can only be replayed when they're null
+    template <typename T>
+    bool Address(T *&pointer) {
+        uint64_t address = 0;
+        if (!Kind(vkmock::TraceArg::Address) || !Read(&address)) return Bad();
+        pointer = nullptr;
+        if (!address) return true;
+        skip_ = ReplaySkip::MissingData;
+        return false;
+    }
+
+    // Somewhere for the call to return a pointer, e.g. vkMapMemory's ppData
+    template <typename T>
+    bool Scratch(T *&pointer) {
+        uint64_t address = 0;
+        if (!Kind(vkmock::TraceArg::Address) || !Read(&address)) return Bad();
+        pointer = address ? arena_.New<T>() : nullptr;
+        return true;
+    }
+
+    // Replay leaves the driver to allocate host memory itself
+    template <typename T>
+    bool Allocator(T *&allocator) {
+        allocator = nullptr;
+        return Skip();
+    }
+
+    // Calls that failed when traced aren't replayed
+    bool Result() {
+        VkResult result = VK_SUCCESS;
+        if (!Value(result)) return false;
+        if (result >= 0) return true;
+        skip_ = ReplaySkip::FailedWhenTraced;
+        return false;
+    }
+
+    // Skips an argument replay has no use for
+    bool Skip() { return SkipArg() || Bad(); }
+
+  private:
+    bool Bad() {
+        if (skip_ == ReplaySkip::None) skip_ = ReplaySkip::BadRecord;
+        return false;
+    }
+
+    bool Available(uint64_t size) const { return size <= static_cast<uint64_t>(end_ - data_); }
+
+    template <typename T>
+    bool Read(T *value) {
+        if (!Available(sizeof(T))) return false;
+        memcpy(static_cast<void *>(value), data_, sizeof(T));
+        data_ += sizeof(T);
+        return true;
+    }
+
+    bool Advance(uint64_t size) {
+        if (!Available(size)) return false;
+        data_ += size;
+        return true;
+    }
+
+    bool Kind(vkmock::TraceArg kind) {
+        uint8_t traced = 0;
+        return Read(&traced) && traced == static_cast<uint8_t>(kind);
+    }
+
+    bool ReadString(const char *&string) {
+        uint32_t length = 0;
+        if (!Read(&length)) return false;
+        string = nullptr;
+        if (length == vkmock::kTraceNull) return true;
+        if (!Available(length)) return false;
+        char *copy = arena_.New<char>(length + 1);
+        memcpy(copy, data_, length);
+        data_ += length;
+        string = copy;
+        return true;
+    }
+
+    bool SkipString() {
+        uint32_t length = 0;
+        return Read(&length) && (length == vkmock::kTraceNull || Advance(length));
+    }
+
+    bool SkipChain() {
+        uint32_t count = 0;
+        if (!Read(&count)) return false;
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t size = 0;
+            if (!Advance(sizeof(uint32_t)) || !Read(&size) || !Advance(size)) return false;
+        }
+        return true;
+    }
+
+    bool SkipArg() {
+        uint8_t kind = 0;
+        uint32_t count = 0;
+        uint32_t size = 0;
+        if (!Read(&kind)) return false;
+        switch (static_cast<vkmock::TraceArg>(kind)) {
+            case vkmock::TraceArg::Value:
+                return Read(&size) && Advance(size);
+            case vkmock::TraceArg::Handle:
+            case vkmock::TraceArg::Address:
+                return Advance(sizeof(uint64_t));
+            case vkmock::TraceArg::String:
+                return SkipString();
+            case vkmock::TraceArg::StringArray:
+                if (!Read(&count)) return false;
+                for (uint32_t i = 0; count != vkmock::kTraceNull && i < count; ++i) {
+                    if (!SkipString()) return false;
+                }
+                return true;
+            case vkmock::TraceArg::HandleArray:
+                return Read(&count) && (count == vkmock::kTraceNull || Advance(static_cast<uint64_t>(count) * sizeof(uint64_t)));
+            case vkmock::TraceArg::Bytes:
+                return Read(&size) && (size == vkmock::kTraceNull || Advance(size));
+            case vkmock::TraceArg::Array:
+            case vkmock::TraceArg::StructArray:
+                if (!Read(&count) || !Read(&size)) return false;
+                if (count == vkmock::kTraceNull) return true;
+                if (!Advance(static_cast<uint64_t>(count) * size)) return false;
+                for (uint32_t i = 0; kind == static_cast<uint8_t>(vkmock::TraceArg::StructArray) && i < count; ++i) {
+                    uint32_t members = 0;
+                    if (!SkipChain() || !Read(&members)) return false;
+                    for (uint32_t j = 0; j < members; ++j) {
+                        if (!SkipArg()) return false;
+                    }
+                }
+                return true;
+        }
+        return false;
+    }
+
+    template <typename T>
+    static void ClearNext(T &, std::false_type) {}
+
+    template <typename T>
+    static void ClearNext(T &s, std::true_type) {
+        s.pNext = nullptr;
+    }
+
+    ReplayArena &arena_;
+    ReplayHandles &handles_;
+    const uint8_t *data_ = nullptr;
+    const uint8_t *end_ = nullptr;
+    void *args_ = nullptr;
+    ReplaySkip skip_ = ReplaySkip::None;
+    std::vector<ReplayPatch> patches_;
+    std::vector<std::pair<uint64_t, uint32_t>> new_handles_;
+};
+
+struct ReplayEntryPoint {
+    const char *name;
+    bool (*prepare)(ReplayPrep &prep);
+    VkResult (*invoke)(PFN_vkVoidFunction proc, void *args);
+    const char *proc_name;  // The entry point to call in place of the named one, if any
+};
+
+// Latencies in nanoseconds, counted in buckets a sixteenth of a power of two wide, so percentiles come out within about 6%
+class LatencyHistogram {
+  public:
+    static constexpr uint32_t kSubBuckets = 16;
+
+    void Add(uint64_t ns) {
+        ++buckets_[Bucket(ns)];
+        ++octaves_[HighestBit(ns)];
+        ++count_;
+        total_ += ns;
+        max_ = std::max(max_, ns);
+    }
+
+    uint64_t count() const { return count_; }
+    uint64_t total() const { return total_; }
+    uint64_t max() const { return max_; }
+
+    // How many latencies were at least 2^octave ns but less than twice that, or 0 and 1 ns for octave 0
+    uint64_t octave(uint32_t octave) const { return octaves_[octave]; }
+
+    // The latency the given fraction of them were at most, rounded up to the end of its bucket
+    uint64_t Percentile(double fraction) const {
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(fraction * count_ + 0.5));
+        uint64_t seen = 0;
+        for (uint32_t bucket = 0; bucket < buckets_.size(); ++bucket) {
+            seen += buckets_[bucket];
+            if (seen >= rank) return std::min(BucketEnd(bucket), max_);
+        }
+        return max_;
+    }
+
+  private:
+    static uint32_t HighestBit(uint64_t value) {
+        uint32_t bit = 0;
+        while (value >>= 1) ++bit;
+        return bit;
+    }
+
+    // Latencies under kSubBuckets ns get a bucket each, the rest one of kSubBuckets in their power of two
+    static uint32_t Bucket(uint64_t ns) {
+        if (ns < kSubBuckets) return static_cast<uint32_t>(ns);
+        const uint32_t bit = HighestBit(ns);
+        return (bit - 3) * kSubBuckets + static_cast<uint32_t>((ns >> (bit - 4)) & (kSubBuckets - 1));
+    }
+
+    static uint64_t BucketEnd(uint32_t bucket) {
+        if (bucket < kSubBuckets) return bucket;
+        const uint32_t bit = bucket / kSubBuckets + 3;
+        return ((kSubBuckets + bucket % kSubBuckets + 1ull) << (bit - 4)) - 1;
+    }
+
+    std::array<uint64_t, 61 * kSubBuckets> buckets_ = {};
+    std::array<uint64_t, 64> octaves_ = {};
+    uint64_t count_ = 0;
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+};